@@ -13,6 +13,7 @@
 // Включаем структуры для системного алгоритма
 struct SensorData;  // Предварительное объявление
 struct RecommendationResult;  // Предварительное объявление
+enum class CropId : uint8_t;  // business/crop_table.h
 
 // Структура конфигурации культуры
 struct CropConfig
@@ -25,9 +26,9 @@ struct CropConfig
     float phosphorus;   // мг/кг
     float potassium;    // мг/кг
 
-    CropConfig() : temperature(0), humidity(0), ec(0), ph(0), nitrogen(0), phosphorus(0), potassium(0) {}
+    constexpr CropConfig() : temperature(0), humidity(0), ec(0), ph(0), nitrogen(0), phosphorus(0), potassium(0) {}
 
-    CropConfig(float temp, float hum, float ec_val, float ph_val, float nit, float phos, float pot)
+    constexpr CropConfig(float temp, float hum, float ec_val, float ph_val, float nit, float phos, float pot)
         : temperature(temp), humidity(hum), ec(ec_val), ph(ph_val), nitrogen(nit), phosphorus(phos), potassium(pot)
     {
     }
@@ -83,12 +84,25 @@ class ICropRecommendationEngine
 
     /**
      * @brief Генерирует специфические рекомендации по культурам для неизмеряемых элементов
+     * @details Правила - таблица CropRules::RULES (include/business/crop_rules.h)
+     *
+     * @param cropId Культура
+     * @param npk NPK данные
+     * @param soilType Тип почвы
+     * @param pH Значение pH
+     * @return String Рекомендации, по одной на строку
+     */
+    virtual String generateCropSpecificRecommendations(CropId cropId, const NPKReferences& npk, SoilType soilType,
+                                                      float pH) = 0;
+
+    /**
+     * @brief То же по строковому id культуры ("tomato") или местному названию ("томат")
      *
      * @param cropName Название культуры
      * @param npk NPK данные
      * @param soilType Тип почвы
      * @param pH Значение pH
-     * @param season Текущий сезон для корректировки порогов
+     * @param season Не влияет на пороги правил; оставлен для совместимости
      * @return String Рекомендации
      */
     virtual String generateCropSpecificRecommendations(const String& cropName,
@@ -116,6 +130,14 @@ class ICropRecommendationEngine
      * @return CropConfig Конфигурация культуры или generic если не найдена
      */
     virtual CropConfig getCropConfig(const String& cropType) const = 0;
+
+    /**
+     * @brief Получает конфигурацию культуры по идентификатору без поиска по строке
+     *
+     * @param cropId Идентификатор культуры (cropIdFromName() из business/crop_table.h)
+     * @return const CropConfig& Табличные значения культуры во flash
+     */
+    virtual const CropConfig& getCropConfig(CropId cropId) const = 0;
 };
 
 #endif  // ICROP_RECOMMENDATION_ENGINE_H
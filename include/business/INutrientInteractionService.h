@@ -9,6 +9,7 @@
 
 #include <Arduino.h>
 #include "../sensor_types.h"
+#include "advice_codes.h"
 
 /**
  * @brief Структура для хранения взаимодействий питательных веществ
@@ -44,10 +45,10 @@ public:
     /**
      * @brief Получает фактор антагонизма между двумя элементами
      * 
-     * @param element1 Первый элемент
-     * @param element2 Второй элемент
-     * @param ratio1 Соотношение первого элемента
-     * @param ratio2 Соотношение второго элемента
+     * @param element1 Обозначение первого элемента ("N", "Mg" - NutrientInteractions::NUTRIENT_SYMBOLS)
+     * @param element2 Обозначение второго элемента
+     * @param ratio1 Количество первого элемента
+     * @param ratio2 Количество второго элемента (для соотношений P/K)
      * @return float Фактор антагонизма
      */
     virtual float getAntagonismFactor(const String& element1, 
@@ -58,10 +59,10 @@ public:
     /**
      * @brief Получает фактор синергизма между двумя элементами
      * 
-     * @param element1 Первый элемент
-     * @param element2 Второй элемент
-     * @param ratio1 Соотношение первого элемента
-     * @param ratio2 Соотношение второго элемента
+     * @param element1 Обозначение первого элемента ("N", "Mg" - NutrientInteractions::NUTRIENT_SYMBOLS)
+     * @param element2 Обозначение второго элемента
+     * @param ratio1 Количество первого элемента
+     * @param ratio2 Количество второго элемента (для соотношений P/K)
      * @return float Фактор синергизма
      */
     virtual float getSynergyFactor(const String& element1, 
@@ -69,9 +70,20 @@ public:
                                   float ratio1, 
                                   float ratio2) = 0;
 
+    /**
+     * @brief Оценивает антагонизмы и синергизмы без сборки текста
+     *
+     * @param npk NPK данные
+     * @param soilType Тип почвы
+     * @param pH Значение pH
+     * @return Advice::List Коды рекомендаций с измеренным значением и порогом
+     */
+    virtual Advice::List assessAntagonisms(const NPKReferences& npk, SoilType soilType, float pH) = 0;
+
     /**
      * @brief Генерирует рекомендации по устранению антагонизмов
-     * 
+     * @details Текст кодов assessAntagonisms() из таблицы Advice::ADVICE_TEXTS
+     *
      * @param npk NPK данные
      * @param soilType Тип почвы
      * @param pH Значение pH
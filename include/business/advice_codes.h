@@ -0,0 +1,258 @@
+/**
+ * @file advice_codes.h
+ * @brief Коды агрономических рекомендаций и их тексты во flash
+ * @details Рекомендации по условиям выращивания и по взаимодействию питательных веществ
+ *          возвращаются как коды с числовыми параметрами (измеренное значение и опорное -
+ *          цель культуры или порог правила), а не как собранные String. Уровень важности
+ *          и русский текст кода - строка таблицы ADVICE_TEXTS: текст разворачивается
+ *          одним выделением только там, где нужен (render()), клиент API может
+ *          показывать коды на своём языке. Порядок таблицы проверяется при компиляции.
+ */
+
+#ifndef ADVICE_CODES_H
+#define ADVICE_CODES_H
+
+#include <Arduino.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Advice
+{
+enum class Severity : uint8_t
+{
+    OK = 0,
+    INFO,
+    WARNING,
+    CRITICAL,
+    COUNT
+};
+
+inline constexpr std::array<const char*, static_cast<size_t>(Severity::COUNT)> SEVERITY_NAMES = {
+    {"ok", "info", "warning", "critical"}};
+
+/**
+ * @brief Коды рекомендаций; порядок совпадает с ADVICE_TEXTS
+ */
+enum class Code : uint8_t
+{
+    // Условия выращивания относительно цели культуры
+    TEMPERATURE_LOW_HEAT = 0,
+    TEMPERATURE_LOW_COVER,
+    TEMPERATURE_HIGH,
+    HUMIDITY_LOW_SAND,
+    HUMIDITY_LOW_CLAY,
+    HUMIDITY_LOW_MIST,
+    HUMIDITY_LOW,
+    HUMIDITY_HIGH_CLAY,
+    HUMIDITY_HIGH,
+    EC_LOW_SAND,
+    EC_LOW,
+    EC_HIGH_CLAY,
+    EC_HIGH,
+    PH_ACIDIC_BLUEBERRY,
+    PH_ACIDIC_PEAT,
+    PH_ACIDIC,
+    PH_ALKALINE_CLAY,
+    PH_ALKALINE,
+    NITROGEN_LOW_SAND,
+    NITROGEN_LOW_PEAT,
+    NITROGEN_LOW,
+    PHOSPHORUS_LOW_CLAY,
+    PHOSPHORUS_LOW,
+    POTASSIUM_LOW_SAND,
+    POTASSIUM_LOW,
+    TOMATO_HIGH_EC,
+    TOMATO_HIGH_EC_CLAY,
+    BLUEBERRY_HIGH_PH,
+    BLUEBERRY_HIGH_PH_CLAY,
+    CONDITIONS_OPTIMAL,
+    // Взаимодействие питательных веществ
+    NITROGEN_BLOCKS_POTASSIUM,
+    ALKALINE_SOIL,
+    PHOSPHORUS_BLOCKS_POTASSIUM,
+    POTASSIUM_BLOCKS_MAGNESIUM,
+    NITROGEN_NEEDS_SULFUR,
+    PHOSPHORUS_BLOCKS_ZINC,
+    ACIDIC_LIME_BORON,
+    NO_ANTAGONISMS,
+    COUNT
+};
+
+constexpr size_t CODE_COUNT = static_cast<size_t>(Code::COUNT);
+
+struct CodeText
+{
+    Code code;
+    Severity severity;
+    const char* text;
+};
+
+inline constexpr std::array<CodeText, CODE_COUNT> ADVICE_TEXTS = {{
+    {Code::TEMPERATURE_LOW_HEAT, Severity::WARNING,
+     "🌡️ Температура ниже оптимальной. Рекомендуется: увеличить обогрев, использовать мульчирование"},
+    {Code::TEMPERATURE_LOW_COVER, Severity::WARNING,
+     "🌡️ Температура ниже оптимальной. Рекомендуется: укрыть растения, добавить обогрев"},
+    {Code::TEMPERATURE_HIGH, Severity::WARNING,
+     "🌡️ Температура выше оптимальной. Рекомендуется: увеличить вентиляцию, притенение, полив"},
+    {Code::HUMIDITY_LOW_SAND, Severity::WARNING,
+     "💧 Влажность низкая. Рекомендуется: частый полив малыми дозами (песок быстро дренирует)"},
+    {Code::HUMIDITY_LOW_CLAY, Severity::WARNING,
+     "💧 Влажность низкая. Рекомендуется: глубокий полив с интервалами (глина удерживает влагу)"},
+    {Code::HUMIDITY_LOW_MIST, Severity::WARNING,
+     "💧 Влажность низкая. Рекомендуется: увеличить полив, использовать туманообразование"},
+    {Code::HUMIDITY_LOW, Severity::WARNING, "💧 Влажность низкая. Рекомендуется: увеличить полив, мульчирование почвы"},
+    {Code::HUMIDITY_HIGH_CLAY, Severity::WARNING,
+     "💧 Влажность высокая. Рекомендуется: улучшить дренаж, уменьшить полив (глина медленно дренирует)"},
+    {Code::HUMIDITY_HIGH, Severity::WARNING,
+     "💧 Влажность высокая. Рекомендуется: улучшить вентиляцию, уменьшить полив, профилактика грибковых "
+     "заболеваний"},
+    {Code::EC_LOW_SAND, Severity::WARNING,
+     "⚡ EC низкий (недостаток питательных веществ). Рекомендуется: частое внесение удобрений малыми дозами "
+     "(песок быстро вымывает)"},
+    {Code::EC_LOW, Severity::WARNING,
+     "⚡ EC низкий (недостаток питательных веществ). Рекомендуется: внести комплексное удобрение, увеличить "
+     "концентрацию питательного раствора"},
+    {Code::EC_HIGH_CLAY, Severity::CRITICAL,
+     "⚠️ EC высокий (риск засоления). Рекомендуется: промывка почвы, гипсование (глина склонна к засолению)"},
+    {Code::EC_HIGH, Severity::CRITICAL,
+     "⚠️ EC высокий (риск засоления). Рекомендуется: промывка почвы, снижение концентрации удобрений, "
+     "использование гипса"},
+    {Code::PH_ACIDIC_BLUEBERRY, Severity::INFO,
+     "🧪 pH кислый. Рекомендуется: pH подходит для черники, но контролируйте другие культуры"},
+    {Code::PH_ACIDIC_PEAT, Severity::WARNING, "🧪 pH кислый. Рекомендуется: внести известь, доломитовую муку (торф кислый)"},
+    {Code::PH_ACIDIC, Severity::WARNING, "🧪 pH кислый. Рекомендуется: внести известь, доломитовую муку, древесную золу"},
+    {Code::PH_ALKALINE_CLAY, Severity::WARNING,
+     "🧪 pH щелочной. Рекомендуется: внести серу, кислые удобрения (глина склонна к щелочности)"},
+    {Code::PH_ALKALINE, Severity::WARNING, "🧪 pH щелочной. Рекомендуется: внести серу, торф, кислые удобрения"},
+    {Code::NITROGEN_LOW_SAND, Severity::WARNING,
+     "🌱 Азот (N) дефицитен. Рекомендуется: частое внесение азотных удобрений (песок быстро вымывает азот)"},
+    {Code::NITROGEN_LOW_PEAT, Severity::WARNING,
+     "🌱 Азот (N) дефицитен. Рекомендуется: органические азотные удобрения (торф богат органикой)"},
+    {Code::NITROGEN_LOW, Severity::WARNING,
+     "🌱 Азот (N) дефицитен. Рекомендуется: внести азотные удобрения (мочевина, аммиачная селитра), органические "
+     "удобрения"},
+    {Code::PHOSPHORUS_LOW_CLAY, Severity::WARNING,
+     "🌱 Фосфор (P) дефицитен. Рекомендуется: внести фосфорные удобрения с органическими (глина связывает фосфор)"},
+    {Code::PHOSPHORUS_LOW, Severity::WARNING,
+     "🌱 Фосфор (P) дефицитен. Рекомендуется: внести фосфорные удобрения (суперфосфат), костную муку"},
+    {Code::POTASSIUM_LOW_SAND, Severity::WARNING,
+     "🌱 Калий (K) дефицитен. Рекомендуется: частое внесение калийных удобрений (песок быстро вымывает калий)"},
+    {Code::POTASSIUM_LOW, Severity::WARNING,
+     "🌱 Калий (K) дефицитен. Рекомендуется: внести калийные удобрения (хлористый калий), древесную золу"},
+    {Code::TOMATO_HIGH_EC, Severity::WARNING,
+     "🍅 Для томатов: высокий EC может вызвать вершинную гниль. Увеличьте кальций"},
+    {Code::TOMATO_HIGH_EC_CLAY, Severity::WARNING,
+     "🍅 Для томатов: высокий EC может вызвать вершинную гниль. Увеличьте кальций, улучшите дренаж"},
+    {Code::BLUEBERRY_HIGH_PH, Severity::WARNING, "🫐 Для черники: pH слишком высокий. Внесите серу или кислый торф"},
+    {Code::BLUEBERRY_HIGH_PH_CLAY, Severity::WARNING,
+     "🫐 Для черники: pH слишком высокий. Внесите серу или кислый торф, добавьте торф для подкисления"},
+    {Code::CONDITIONS_OPTIMAL, Severity::OK, "✅ Все параметры в оптимальном диапазоне. Продолжайте текущий уход."},
+    {Code::NITROGEN_BLOCKS_POTASSIUM, Severity::WARNING, "⚠️ Высокий N → уменьшить N, увеличить K"},
+    {Code::ALKALINE_SOIL, Severity::WARNING, "⚠️ Щелочная почва → подкислить"},
+    {Code::PHOSPHORUS_BLOCKS_POTASSIUM, Severity::WARNING, "⚠️ Высокий P → уменьшить P, увеличить K"},
+    {Code::POTASSIUM_BLOCKS_MAGNESIUM, Severity::INFO, "💡 Высокий K → внести MgSO4"},
+    {Code::NITROGEN_NEEDS_SULFUR, Severity::INFO, "💡 Высокий N → внести серу"},
+    {Code::PHOSPHORUS_BLOCKS_ZINC, Severity::INFO, "💡 Высокий P → внести цинк"},
+    {Code::ACIDIC_LIME_BORON, Severity::INFO, "💡 Кислая почва → известковать, бор"},
+    {Code::NO_ANTAGONISMS, Severity::OK, "✅ Антагонизмов питательных веществ не обнаружено"},
+}};
+
+/**
+ * @brief Сработавшая рекомендация
+ */
+struct Item
+{
+    Code code;
+    float value;      // Измеренное значение (или рассчитанное соотношение)
+    float reference;  // Цель культуры или порог, с которым сравнивалось значение
+};
+
+constexpr size_t MAX_ITEMS = 12;
+
+/**
+ * @brief Сработавшие рекомендации в порядке проверки; пустой список - всё в норме
+ */
+struct List
+{
+    std::array<Item, MAX_ITEMS> items{};
+    uint8_t count = 0;
+
+    void add(Code code, float value, float reference)
+    {
+        if (count < MAX_ITEMS)
+        {
+            items[count++] = Item{code, value, reference};
+        }
+    }
+    const Item* begin() const
+    {
+        return items.data();
+    }
+    const Item* end() const
+    {
+        return items.data() + count;
+    }
+};
+
+constexpr const char* text(Code code)
+{
+    return ADVICE_TEXTS[static_cast<size_t>(code)].text;
+}
+
+constexpr Severity severity(Code code)
+{
+    return ADVICE_TEXTS[static_cast<size_t>(code)].severity;
+}
+
+/**
+ * @brief Текст рекомендаций: по строке на код, одно выделение под весь результат
+ * @param whenEmpty Код текста для пустого списка (без перевода строки)
+ */
+inline String render(const List& list, Code whenEmpty)
+{
+    if (list.count == 0)
+    {
+        return String(text(whenEmpty));
+    }
+    size_t length = 0;
+    for (const Item& item : list)
+    {
+        length += strlen(text(item.code)) + 1;
+    }
+    String result;
+    result.reserve(length);
+    for (const Item& item : list)
+    {
+        result += text(item.code);
+        result += '\n';
+    }
+    return result;
+}
+
+// Проверки при компиляции: порядок таблицы и тексты без символов, требующих
+// экранирования в JSON (каталог /api/v2/advice пишется без сериализатора)
+constexpr bool textsAreConsistent()
+{
+    for (size_t i = 0; i < CODE_COUNT; ++i)
+    {
+        if (static_cast<size_t>(ADVICE_TEXTS[i].code) != i)
+        {
+            return false;
+        }
+        for (const char* c = ADVICE_TEXTS[i].text; *c != '\0'; ++c)
+        {
+            if (*c == '"' || *c == '\\' || *c == '\n')
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(textsAreConsistent(), "Advice: порядок ADVICE_TEXTS не совпадает с Code или текст требует экранирования");
+}  // namespace Advice
+
+#endif  // ADVICE_CODES_H
@@ -0,0 +1,187 @@
+/**
+ * @file crop_corrections.h
+ * @brief Коэффициенты коррекции табличных значений культур
+ * @details Коррекции по типу выращивания, типу почвы и сезону - constexpr таблицы
+ *          множителей, индексированные EnvironmentType, SoilType и Season, вместо
+ *          цепочек сравнений String. Вся цепочка - покомпонентное произведение
+ *          трёх множителей на табличные значения культуры; результат зависит только
+ *          от (культура, почва, среда, сезон), поэтому его можно кэшировать.
+ *          Строковые названия ("greenhouse", "spring", ...) переводятся в перечисления
+ *          только на входе.
+ */
+
+#ifndef CROP_CORRECTIONS_H
+#define CROP_CORRECTIONS_H
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include "../sensor_types.h"
+#include "ICropRecommendationEngine.h"  // CropConfig
+
+// Множители в порядке полей CropConfig: температура, влажность, EC, pH, N, P, K
+using CropMultipliers = CropConfig;
+
+constexpr CropMultipliers NO_CORRECTION(1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F);
+
+constexpr size_t ENVIRONMENT_TYPE_COUNT = static_cast<size_t>(EnvironmentType::ORGANIC) + 1;
+constexpr size_t SEASON_COUNT = static_cast<size_t>(Season::WINTER) + 1;
+
+// ============================================================================
+// ТИП ВЫРАЩИВАНИЯ (первая коррекция, все параметры кроме pH)
+// ============================================================================
+inline constexpr std::array<CropMultipliers, ENVIRONMENT_TYPE_COUNT> GROWING_TYPE_MULTIPLIERS = {{
+    // OUTDOOR: без изменений (0%)
+    NO_CORRECTION,
+    // GREENHOUSE: контролируемая среда, интенсивное выращивание (T/влажность +5%, EC +10%, NPK +15%)
+    CropMultipliers(1.05F, 1.05F, 1.10F, 1.0F, 1.15F, 1.15F, 1.15F),
+    // INDOOR: контролируемая среда, умеренная интенсивность (T +2%, влажность +3%, EC +5%, NPK +8%)
+    CropMultipliers(1.02F, 1.03F, 1.05F, 1.0F, 1.08F, 1.08F, 1.08F),
+    // HYDROPONICS: точный контроль питательных веществ (T +3%, влажность +2%, EC +20%, NPK +25%)
+    CropMultipliers(1.03F, 1.02F, 1.20F, 1.0F, 1.25F, 1.25F, 1.25F),
+    // AEROPONICS: максимальная эффективность (T +4%, влажность +3%, EC +18%, NPK +20%)
+    CropMultipliers(1.04F, 1.03F, 1.18F, 1.0F, 1.20F, 1.20F, 1.20F),
+    // ORGANIC: естественные процессы (T -1%, влажность +2%, EC и NPK -10%)
+    CropMultipliers(0.99F, 1.02F, 0.90F, 1.0F, 0.90F, 0.90F, 0.90F),
+}};
+
+// ============================================================================
+// ТИП ПОЧВЫ (вторая коррекция, консервативные коэффициенты)
+// Источник: Soil Fertility Manual, International Plant Nutrition Institute, 2020
+// ============================================================================
+inline constexpr std::array<CropMultipliers, SOIL_TYPE_COUNT> SOIL_TYPE_MULTIPLIERS = {{
+    // SAND: быстрое вымывание, низкая влагоемкость, обычно щелочной
+    CropMultipliers(1.0F, 0.95F, 0.98F, 1.02F, 1.05F, 1.03F, 1.04F),
+    // LOAM
+    NO_CORRECTION,
+    // PEAT: органический, кислый, высокая влагоемкость, низкая минерализация
+    CropMultipliers(1.0F, 1.06F, 0.98F, 0.95F, 1.05F, 1.03F, 1.01F),
+    // CLAY: высокая влагоемкость, связывание питательных веществ, накопление солей
+    CropMultipliers(1.0F, 1.05F, 1.03F, 0.99F, 0.97F, 0.95F, 0.98F),
+    // SANDPEAT, SILT, CLAY_LOAM
+    NO_CORRECTION,
+    NO_CORRECTION,
+    NO_CORRECTION,
+    // ORGANIC: богатая органикой, кислая
+    CropMultipliers(1.0F, 1.05F, 0.98F, 0.96F, 1.06F, 1.04F, 1.03F),
+    // SANDY_LOAM, SILTY_LOAM, LOAMY_CLAY
+    NO_CORRECTION,
+    NO_CORRECTION,
+    NO_CORRECTION,
+    // SALINE, ALKALINE: специальные случаи - пока без изменений
+    NO_CORRECTION,
+    NO_CORRECTION,
+}};
+
+// ============================================================================
+// СЕЗОН (последняя коррекция, только NPK)
+// ============================================================================
+inline constexpr std::array<CropMultipliers, SEASON_COUNT> SEASON_MULTIPLIERS = {{
+    // SPRING: активный рост, потребность в азоте
+    CropMultipliers(1.0F, 1.0F, 1.0F, 1.0F, 1.15F, 1.10F, 1.12F),
+    // SUMMER: жаркий период, потребность в калии
+    CropMultipliers(1.0F, 1.0F, 1.0F, 1.0F, 1.05F, 1.03F, 1.08F),
+    // AUTUMN: подготовка к зиме
+    CropMultipliers(1.0F, 1.0F, 1.0F, 1.0F, 0.95F, 0.97F, 0.92F),
+    // WINTER: период покоя
+    CropMultipliers(1.0F, 1.0F, 1.0F, 1.0F, 0.90F, 0.95F, 0.85F),
+}};
+
+// Названия для строкового API и RecommendationResult; порядок совпадает с перечислениями
+inline constexpr std::array<const char*, ENVIRONMENT_TYPE_COUNT> ENVIRONMENT_TYPE_NAMES = {
+    {"outdoor", "greenhouse", "indoor", "hydroponics", "aeroponics", "organic"}};
+inline constexpr std::array<const char*, SOIL_TYPE_COUNT> SOIL_TYPE_NAMES = {
+    {"sand", "loam", "peat", "clay", "sand_peat", "silt", "clay_loam", "organic", "sandy_loam", "silty_loam",
+     "loamy_clay", "saline", "alkaline"}};
+inline constexpr std::array<const char*, SEASON_COUNT> SEASON_NAMES = {{"spring", "summer", "autumn", "winter"}};
+
+constexpr CropConfig scaleCropConfig(const CropConfig& values, const CropMultipliers& multipliers)
+{
+    return CropConfig(values.temperature * multipliers.temperature, values.humidity * multipliers.humidity,
+                      values.ec * multipliers.ec, values.ph * multipliers.ph, values.nitrogen * multipliers.nitrogen,
+                      values.phosphorus * multipliers.phosphorus, values.potassium * multipliers.potassium);
+}
+
+constexpr const CropMultipliers& growingTypeMultipliers(EnvironmentType environment)
+{
+    return GROWING_TYPE_MULTIPLIERS[static_cast<size_t>(environment)];
+}
+
+constexpr const CropMultipliers& soilTypeMultipliers(SoilType soil)
+{
+    return SOIL_TYPE_MULTIPLIERS[static_cast<size_t>(soil)];
+}
+
+constexpr const CropMultipliers& seasonMultipliers(Season season)
+{
+    return SEASON_MULTIPLIERS[static_cast<size_t>(season)];
+}
+
+/**
+ * @brief Итоговые значения культуры после коррекций среды, почвы и сезона
+ * @param season Множители сезона; NO_CORRECTION - без сезонной коррекции
+ */
+constexpr CropConfig applyCropCorrections(const CropConfig& table, EnvironmentType environment, SoilType soil,
+                                          const CropMultipliers& season)
+{
+    return scaleCropConfig(scaleCropConfig(scaleCropConfig(table, growingTypeMultipliers(environment)),
+                                           soilTypeMultipliers(soil)),
+                           season);
+}
+
+/**
+ * @brief Индекс названия в таблице названий
+ * @return true и индекс, false для неизвестного названия
+ */
+template <size_t N>
+bool findCorrectionName(const std::array<const char*, N>& names, const char* name, size_t& index)
+{
+    for (size_t i = 0; name != nullptr && i < N; ++i)
+    {
+        if (strcmp(names[i], name) == 0)
+        {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Неизвестный тип выращивания - открытый грунт (без коррекции)
+inline EnvironmentType environmentTypeFromName(const char* name)
+{
+    size_t index = 0;
+    return findCorrectionName(ENVIRONMENT_TYPE_NAMES, name, index) ? static_cast<EnvironmentType>(index)
+                                                                   : EnvironmentType::OUTDOOR;
+}
+
+// Неизвестный сезон ("none") - false, без сезонной коррекции
+inline bool seasonFromName(const char* name, Season& season)
+{
+    size_t index = 0;
+    if (!findCorrectionName(SEASON_NAMES, name, index))
+    {
+        return false;
+    }
+    season = static_cast<Season>(index);
+    return true;
+}
+
+inline const CropMultipliers& seasonMultipliersFromName(const char* name)
+{
+    Season season = Season::SPRING;
+    return seasonFromName(name, season) ? seasonMultipliers(season) : NO_CORRECTION;
+}
+
+// config.soilProfile вне диапазона - суглинок
+constexpr SoilType soilTypeFromProfile(uint8_t soilProfile)
+{
+    return soilProfile < SOIL_TYPE_COUNT ? static_cast<SoilType>(soilProfile) : SoilType::LOAM;
+}
+
+constexpr const char* soilTypeName(SoilType soil)
+{
+    return SOIL_TYPE_NAMES[static_cast<size_t>(soil)];
+}
+
+#endif  // CROP_CORRECTIONS_H
@@ -0,0 +1,848 @@
+/**
+ * @file crop_rules.h
+ * @brief Правила специфических рекомендаций культур во flash
+ * @details Рекомендации по неизмеряемым элементам (Ca, Mg, B, Fe, Zn, Mn, S, Mo) - constexpr
+ *          таблица правил (культура, условие на N/P/K/pH, тип почвы, код сообщения) вместо
+ *          цепочки if/else по названию культуры. Правила проверяются за один проход без
+ *          выделений памяти; результат - коды сообщений, текст по коду берётся из таблицы
+ *          MESSAGE_TEXTS при сериализации. Новая культура - строки таблиц, а не новый код.
+ *          Порядок таблиц и ёмкость списка сообщений проверяются при компиляции.
+ */
+
+#ifndef CROP_RULES_H
+#define CROP_RULES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../sensor_types.h"
+#include "crop_table.h"
+
+namespace CropRules
+{
+/**
+ * @brief Коды сообщений; порядок совпадает с MESSAGE_TEXTS
+ */
+enum class MessageId : uint8_t
+{
+    TOMATO_CALCIUM = 0,
+    TOMATO_NP_BALANCE,
+    TOMATO_BORON,
+    CUCUMBER_POTASSIUM,
+    CUCUMBER_BORON,
+    CUCUMBER_CALCIUM,
+    CUCUMBER_MAGNESIUM,
+    PEPPER_ZINC,
+    PEPPER_CALCIUM,
+    PEPPER_BORON,
+    PEPPER_POTASSIUM,
+    PEPPER_MAGNESIUM,
+    LETTUCE_SULFUR,
+    LETTUCE_IRON,
+    LETTUCE_NITROGEN,
+    LETTUCE_CALCIUM,
+    BLUEBERRY_ACIDITY,
+    BLUEBERRY_IRON,
+    BLUEBERRY_MANGANESE,
+    BLUEBERRY_AMMONIUM,
+    STRAWBERRY_CALCIUM,
+    STRAWBERRY_BORON,
+    STRAWBERRY_ZINC,
+    STRAWBERRY_POTASSIUM,
+    APPLE_CALCIUM,
+    APPLE_BORON,
+    APPLE_ZINC,
+    APPLE_POTASSIUM,
+    APPLE_MAGNESIUM,
+    GRAPE_POTASSIUM,
+    GRAPE_BORON,
+    GRAPE_CALCIUM,
+    GRAPE_MAGNESIUM,
+    SPINACH_IRON,
+    SPINACH_MAGNESIUM,
+    SPINACH_NITROGEN,
+    BASIL_POTASSIUM,
+    BASIL_MAGNESIUM,
+    BASIL_BORON,
+    CANNABIS_NITROGEN,
+    CANNABIS_PHOSPHORUS,
+    CANNABIS_POTASSIUM,
+    CANNABIS_CALCIUM,
+    CANNABIS_MAGNESIUM,
+    WHEAT_NITROGEN,
+    WHEAT_PHOSPHORUS,
+    WHEAT_SULFUR,
+    WHEAT_POTASSIUM,
+    POTATO_POTASSIUM,
+    POTATO_MAGNESIUM,
+    POTATO_CALCIUM,
+    POTATO_NP_BALANCE,
+    POTATO_NITROGEN_EXCESS,
+    KALE_CALCIUM,
+    KALE_SULFUR,
+    KALE_BORON,
+    RASPBERRY_IRON,
+    RASPBERRY_MANGANESE,
+    RASPBERRY_ZINC,
+    BLACKBERRY_IRON,
+    BLACKBERRY_MANGANESE,
+    BLACKBERRY_BORON,
+    SOYBEAN_PHOSPHORUS,
+    SOYBEAN_POTASSIUM,
+    SOYBEAN_MOLYBDENUM,
+    SOYBEAN_NITROGEN_EXCESS,
+    CARROT_BORON,
+    CARROT_CALCIUM,
+    CARROT_POTASSIUM,
+    CARROT_NITROGEN_EXCESS,
+    LAWN_NITROGEN,
+    LAWN_PHOSPHORUS,
+    LAWN_POTASSIUM,
+    LAWN_IRON,
+    LAWN_CALCIUM,
+    LAWN_MAGNESIUM,
+    LAWN_SULFUR,
+    LAWN_MICRONUTRIENTS,
+    CONIFER_ACIDITY,
+    CONIFER_MAGNESIUM,
+    CONIFER_NITROGEN_EXCESS,
+    PEAR_CALCIUM,
+    PEAR_BORON,
+    PEAR_ZINC,
+    CHERRY_CALCIUM,
+    CHERRY_BORON,
+    CHERRY_IRON,
+    CURRANT_IRON,
+    CURRANT_BORON,
+    CURRANT_MANGANESE,
+    SOIL_CLAY_CHELATES,
+    SOIL_SAND_FREQUENT_FEEDING,
+    SOIL_PEAT_PHOSPHORUS,
+    COUNT
+};
+
+constexpr size_t MESSAGE_COUNT = static_cast<size_t>(MessageId::COUNT);
+
+struct MessageText
+{
+    MessageId id;
+    const char* text;  // одна строка рекомендации, без перевода строки
+};
+
+inline constexpr std::array<MessageText, MESSAGE_COUNT> MESSAGE_TEXTS = {{
+    {MessageId::TOMATO_CALCIUM, "🍅 Томаты → кальций Ca(NO3)2"},
+    {MessageId::TOMATO_NP_BALANCE, "🍅 Томаты → баланс N/P"},
+    {MessageId::TOMATO_BORON, "🍅 Томаты → бор H3BO3"},
+    {MessageId::CUCUMBER_POTASSIUM,
+     "🥒 Огурцы требуют калий для качества плодов. "
+     "Рекомендуется: внести калийную селитру (KNO3) или сульфат калия (K2SO4)"},
+    {MessageId::CUCUMBER_BORON,
+     "🥒 Огурцы требуют бор для завязывания плодов. "
+     "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)"},
+    {MessageId::CUCUMBER_CALCIUM,
+     "🥒 Огурцы требуют кальций для качества плодов. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)"},
+    {MessageId::CUCUMBER_MAGNESIUM,
+     "🥒 Огурцы требуют магний для фотосинтеза. "
+     "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку"},
+    {MessageId::PEPPER_ZINC,
+     "🌶️ Перец требует цинк при высоком фосфоре. "
+     "Рекомендуется: внести хелат цинка (Zn-EDTA) или сульфат цинка (ZnSO4)"},
+    {MessageId::PEPPER_CALCIUM,
+     "🌶️ Перец требует кальций против вершинной гнили. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)"},
+    {MessageId::PEPPER_BORON,
+     "🌶️ Перец требует бор для завязывания плодов. "
+     "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)"},
+    {MessageId::PEPPER_POTASSIUM,
+     "🌶️ Перец требует калий для качества и остроты плодов. "
+     "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)"},
+    {MessageId::PEPPER_MAGNESIUM,
+     "🌶️ Перец требует магний для фотосинтеза. "
+     "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку"},
+    {MessageId::LETTUCE_SULFUR,
+     "🥬 Салат требует серу для синтеза белка. "
+     "Рекомендуется: внести сульфат аммония ((NH4)2SO4) или элементарную серу (S)"},
+    {MessageId::LETTUCE_IRON,
+     "🥬 Салат требует железо для предотвращения хлороза. "
+     "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)"},
+    {MessageId::LETTUCE_NITROGEN,
+     "🥬 Салат требует много азота для интенсивного роста листьев. "
+     "Рекомендуется: внести аммиачную селитру (NH4NO3) или мочевину (CO(NH2)2)"},
+    {MessageId::LETTUCE_CALCIUM,
+     "🥬 Салат требует кальций для качества листьев. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)"},
+    {MessageId::BLUEBERRY_ACIDITY,
+     "🫐 Черника требует кислую почву для усвоения железа. "
+     "Рекомендуется: внести элементарную серу (S) или сульфат аммония ((NH4)2SO4)"},
+    {MessageId::BLUEBERRY_IRON,
+     "🫐 Черника требует железо для предотвращения хлороза. "
+     "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)"},
+    {MessageId::BLUEBERRY_MANGANESE,
+     "🫐 Черника требует марганец для фотосинтеза. "
+     "Рекомендуется: внести сульфат марганца (MnSO4) или хелат марганца (Mn-EDTA)"},
+    {MessageId::BLUEBERRY_AMMONIUM,
+     "🫐 Черника предпочитает аммонийный азот. "
+     "Рекомендуется: внести сульфат аммония ((NH4)2SO4) вместо нитратов"},
+    {MessageId::STRAWBERRY_CALCIUM,
+     "🍓 Клубника требует кальций для качества ягод. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)"},
+    {MessageId::STRAWBERRY_BORON,
+     "🍓 Клубника требует бор для опыления и развития плодов. "
+     "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)"},
+    {MessageId::STRAWBERRY_ZINC,
+     "🍓 Клубника требует цинк для синтеза ауксинов. "
+     "Рекомендуется: внести хелат цинка (Zn-EDTA) или сульфат цинка (ZnSO4)"},
+    {MessageId::STRAWBERRY_POTASSIUM,
+     "🍓 Клубника требует калий для качества и сладости ягод. "
+     "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)"},
+    {MessageId::APPLE_CALCIUM,
+     "🍎 Яблоня требует кальций против горькой ямчатости плодов. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)"},
+    {MessageId::APPLE_BORON,
+     "🍎 Яблоня требует бор для развития плодов и опыления. "
+     "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)"},
+    {MessageId::APPLE_ZINC,
+     "🍎 Яблоня требует цинк для предотвращения розеточности листьев. "
+     "Рекомендуется: внести сульфат цинка (ZnSO4) или хелат цинка (Zn-EDTA)"},
+    {MessageId::APPLE_POTASSIUM,
+     "🍎 Яблоня требует калий для качества и лежкости плодов. "
+     "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)"},
+    {MessageId::APPLE_MAGNESIUM,
+     "🍎 Яблоня требует магний для фотосинтеза. "
+     "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку"},
+    {MessageId::GRAPE_POTASSIUM,
+     "🍇 Виноград требует калий для качества ягод и сахаристости. "
+     "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)"},
+    {MessageId::GRAPE_BORON,
+     "🍇 Виноград требует бор для опыления и развития ягод. "
+     "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)"},
+    {MessageId::GRAPE_CALCIUM,
+     "🍇 Виноград требует кальций для качества ягод. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)"},
+    {MessageId::GRAPE_MAGNESIUM,
+     "🍇 Виноград требует магний для фотосинтеза. "
+     "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку"},
+    {MessageId::SPINACH_IRON,
+     "🥬 Шпинат требует железо для предотвращения хлороза. "
+     "Рекомендуется: внести хелатное железо (Fe-EDTA)"},
+    {MessageId::SPINACH_MAGNESIUM,
+     "🥬 Высокий калий может блокировать магний у шпината. "
+     "Рекомендуется: внести сульфат магния (MgSO4)"},
+    {MessageId::SPINACH_NITROGEN,
+     "🥬 Шпинат требует много азота для интенсивного роста листьев. "
+     "Рекомендуется: внести азотные удобрения (NH4NO3)"},
+    {MessageId::BASIL_POTASSIUM,
+     "🌿 Базилик требует калий для синтеза эфирных масел. "
+     "Рекомендуется: внести калийную селитру (KNO3)"},
+    {MessageId::BASIL_MAGNESIUM,
+     "🌿 Базилик требует магний для фотосинтеза. "
+     "Рекомендуется: внести сульфат магния (MgSO4)"},
+    {MessageId::BASIL_BORON,
+     "🌿 Базилик требует бор для предотвращения деформации листьев. "
+     "Рекомендуется: внести борную кислоту (H3BO3)"},
+    {MessageId::CANNABIS_NITROGEN,
+     "🌿 Конопля требует много азота для роста листьев. "
+     "Рекомендуется: внести азотные удобрения (NH4NO3)"},
+    {MessageId::CANNABIS_PHOSPHORUS,
+     "🌿 Конопля требует фосфор для развития соцветий. "
+     "Рекомендуется: внести фосфорные удобрения (H3PO4)"},
+    {MessageId::CANNABIS_POTASSIUM,
+     "🌿 Конопля требует калий для синтеза активных веществ. "
+     "Рекомендуется: внести калийную селитру (KNO3)"},
+    {MessageId::CANNABIS_CALCIUM,
+     "🌿 Конопля требует кальций для структуры клеток. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)"},
+    {MessageId::CANNABIS_MAGNESIUM,
+     "🌿 Высокий калий может блокировать магний у конопли. "
+     "Рекомендуется: внести сульфат магния (MgSO4)"},
+    {MessageId::WHEAT_NITROGEN, "🌾 Пшеница → азот NH4NO3"},
+    {MessageId::WHEAT_PHOSPHORUS, "🌾 Пшеница → фосфор"},
+    {MessageId::WHEAT_SULFUR, "🌾 Пшеница → сера (NH4)2SO4"},
+    {MessageId::WHEAT_POTASSIUM, "🌾 Пшеница → калий KCl"},
+    {MessageId::POTATO_POTASSIUM,
+     "🥔 Картофель требует калий для качества клубней. "
+     "Рекомендуется: внести калийную селитру (KNO3)"},
+    {MessageId::POTATO_MAGNESIUM,
+     "🥔 Картофель требует магний для фотосинтеза. "
+     "Рекомендуется: внести сульфат магния (MgSO4)"},
+    {MessageId::POTATO_CALCIUM,
+     "🥔 Картофель требует кальций для качества клубней. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)"},
+    {MessageId::POTATO_NP_BALANCE,
+     "🥔 Картофель нуждается в сбалансированном питании. "
+     "Рекомендуется: увеличить фосфор для развития клубней"},
+    {MessageId::POTATO_NITROGEN_EXCESS,
+     "🥔 Избыток азота снижает качество клубней картофеля. "
+     "Рекомендуется: сократить азотные подкормки"},
+    {MessageId::KALE_CALCIUM,
+     "🥬 Кале требует кальций для качества листьев. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)"},
+    {MessageId::KALE_SULFUR,
+     "🥬 Кале требует серу для синтеза глюкозинолатов. "
+     "Рекомендуется: внести сульфат аммония ((NH4)2SO4)"},
+    {MessageId::KALE_BORON,
+     "🥬 Кале требует бор для структуры стеблей. "
+     "Рекомендуется: внести борную кислоту (H3BO3)"},
+    {MessageId::RASPBERRY_IRON,
+     "🍇 Малина требует железо для зеленой окраски листьев. "
+     "Рекомендуется: внести хелатное железо (Fe-EDTA)"},
+    {MessageId::RASPBERRY_MANGANESE,
+     "🍇 Малина требует марганец для фотосинтеза. "
+     "Рекомендуется: внести сульфат марганца (MnSO4)"},
+    {MessageId::RASPBERRY_ZINC,
+     "🍇 Высокий фосфор может блокировать цинк у малины. "
+     "Рекомендуется: внести хелатный цинк (Zn-EDTA)"},
+    {MessageId::BLACKBERRY_IRON,
+     "🫐 Ежевика требует железо при щелочной почве. "
+     "Рекомендуется: внести хелатное железо (Fe-EDTA)"},
+    {MessageId::BLACKBERRY_MANGANESE,
+     "🫐 Ежевика требует марганец для качества ягод. "
+     "Рекомендуется: внести сульфат марганца (MnSO4)"},
+    {MessageId::BLACKBERRY_BORON,
+     "🫐 Ежевика требует бор для формирования ягод. "
+     "Рекомендуется: внести борную кислоту (H3BO3)"},
+    {MessageId::SOYBEAN_PHOSPHORUS,
+     "🌱 Соя требует фосфор для работы клубеньковых бактерий. "
+     "Рекомендуется: внести суперфосфат (Ca(H2PO4)2)"},
+    {MessageId::SOYBEAN_POTASSIUM,
+     "🌱 Соя требует калий для формирования бобов. "
+     "Рекомендуется: внести хлорид калия (KCl)"},
+    {MessageId::SOYBEAN_MOLYBDENUM,
+     "🌱 Соя требует молибден для фиксации азота. "
+     "Рекомендуется: внести молибдат аммония ((NH4)2MoO4)"},
+    {MessageId::SOYBEAN_NITROGEN_EXCESS,
+     "🌱 Избыток азота подавляет азотфиксацию у сои. "
+     "Рекомендуется: сократить азотные подкормки"},
+    {MessageId::CARROT_BORON,
+     "🥕 Морковь требует бор для качества корнеплодов. "
+     "Рекомендуется: внести борную кислоту (H3BO3)"},
+    {MessageId::CARROT_CALCIUM,
+     "🥕 Морковь требует кальций для устойчивости к болезням. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)"},
+    {MessageId::CARROT_POTASSIUM,
+     "🥕 Морковь требует калий для сладости и лежкости. "
+     "Рекомендуется: внести калийную селитру (KNO3)"},
+    {MessageId::CARROT_NITROGEN_EXCESS,
+     "🥕 Избыток азота вызывает разветвление корнеплодов моркови. "
+     "Рекомендуется: сократить азотные подкормки"},
+    {MessageId::LAWN_NITROGEN,
+     "🌱 Газон требует азот для активного роста листьев. "
+     "Рекомендуется: внести мочевину (CO(NH2)2) или аммиачную селитру (NH4NO3)"},
+    {MessageId::LAWN_PHOSPHORUS,
+     "🌱 Газон требует фосфор для развития корневой системы. "
+     "Рекомендуется: внести суперфосфат (Ca(H2PO4)2) или диаммофос (NH4H2PO4)"},
+    {MessageId::LAWN_POTASSIUM,
+     "🌱 Газон требует калий для устойчивости к стрессам и болезням. "
+     "Рекомендуется: внести хлористый калий (KCl) или сульфат калия (K2SO4)"},
+    {MessageId::LAWN_IRON,
+     "🌱 Газон требует железо для предотвращения хлороза. "
+     "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)"},
+    {MessageId::LAWN_CALCIUM,
+     "🌱 Газон требует кальций для улучшения структуры почвы. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или известь (CaCO3)"},
+    {MessageId::LAWN_MAGNESIUM,
+     "🌱 Высокий калий может блокировать магний у газона. "
+     "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку"},
+    {MessageId::LAWN_SULFUR,
+     "🌱 Газон требует серу для синтеза белка. "
+     "Рекомендуется: внести сульфат аммония ((NH4)2SO4) или элементарную серу"},
+    {MessageId::LAWN_MICRONUTRIENTS,
+     "🌱 Газон требует микроэлементы при интенсивном питании. "
+     "Рекомендуется: внести комплексное микроудобрение (Zn, Mn, Cu, B)"},
+    {MessageId::CONIFER_ACIDITY,
+     "🌲 Хвойные требуют кислую почву для нормального роста. "
+     "Рекомендуется: подкислить почву серой или торфом"},
+    {MessageId::CONIFER_MAGNESIUM,
+     "🌲 Хвойные требуют магний для предотвращения пожелтения. "
+     "Рекомендуется: внести сульфат магния (MgSO4)"},
+    {MessageId::CONIFER_NITROGEN_EXCESS,
+     "🌲 Избыток азота может повредить хвойные растения. "
+     "Рекомендуется: сократить азотные подкормки"},
+    {MessageId::PEAR_CALCIUM,
+     "🍐 Груша требует кальций для качества плодов. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)"},
+    {MessageId::PEAR_BORON,
+     "🍐 Груша требует бор для формирования плодов. "
+     "Рекомендуется: внести борную кислоту (H3BO3)"},
+    {MessageId::PEAR_ZINC,
+     "🍐 Груша требует цинк для нормального роста. "
+     "Рекомендуется: внести хелатный цинк (Zn-EDTA)"},
+    {MessageId::CHERRY_CALCIUM,
+     "🍒 Вишня требует кальций для предотвращения растрескивания. "
+     "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)"},
+    {MessageId::CHERRY_BORON,
+     "🍒 Вишня требует бор для опыления и завязывания. "
+     "Рекомендуется: внести борную кислоту (H3BO3)"},
+    {MessageId::CHERRY_IRON,
+     "🍒 Вишня требует железо для предотвращения хлороза. "
+     "Рекомендуется: внести хелатное железо (Fe-EDTA)"},
+    {MessageId::CURRANT_IRON,
+     "🫐 Смородина требует железо для предотвращения хлороза. "
+     "Рекомендуется: внести хелатное железо (Fe-EDTA)"},
+    {MessageId::CURRANT_BORON,
+     "🫐 Смородина требует бор для формирования ягод. "
+     "Рекомендуется: внести борную кислоту (H3BO3)"},
+    {MessageId::CURRANT_MANGANESE,
+     "🫐 Смородина требует марганец для качества ягод. "
+     "Рекомендуется: внести сульфат марганца (MnSO4)"},
+    {MessageId::SOIL_CLAY_CHELATES,
+     "🏺 Глинистые почвы могут связывать микроэлементы. "
+     "Рекомендуется: использовать хелатные формы удобрений"},
+    {MessageId::SOIL_SAND_FREQUENT_FEEDING,
+     "🏖️ Песчаные почвы быстро теряют питательные вещества. "
+     "Рекомендуется: частые подкормки малыми дозами"},
+    {MessageId::SOIL_PEAT_PHOSPHORUS, "🟫 Торф → дефицит P"},
+}};
+
+// ============================================================================
+// УСЛОВИЯ ПРАВИЛ
+// ============================================================================
+enum class Channel : uint8_t
+{
+    NITROGEN = 0,
+    PHOSPHORUS,
+    POTASSIUM,
+    PH,
+    COUNT
+};
+
+enum class Compare : uint8_t
+{
+    NONE = 0,  // пустое условие (не влияет на результат правила)
+    BELOW,     // значение < порога
+    ABOVE,     // значение > порога
+    AT_LEAST   // значение >= порога
+};
+
+struct Term
+{
+    Channel channel;
+    Compare compare;
+    float threshold;
+};
+
+enum class Match : uint8_t
+{
+    ALL,  // все условия (&&)
+    ANY   // хотя бы одно (||)
+};
+
+constexpr size_t MAX_TERMS = 3;
+
+struct Rule
+{
+    CropId crop;        // ANY_CROP - правило для любой культуры
+    uint16_t soilMask;  // бит на SoilType
+    Match match;
+    std::array<Term, MAX_TERMS> terms;
+    MessageId message;
+};
+
+constexpr CropId ANY_CROP = CropId::COUNT;
+constexpr uint16_t ALL_SOILS = 0xFFFFU;
+constexpr Term NO_TERM{Channel::NITROGEN, Compare::NONE, 0.0F};
+
+// Стандартные пороги дефицита (без сезонных корректировок): культурное правило
+// «не дефицит, но ниже нормы культуры» срабатывает только при значении не ниже порога,
+// чтобы не дублировать общую рекомендацию по дефициту
+constexpr float N_DEFICIT = 100.0F;
+constexpr float P_DEFICIT = 50.0F;
+constexpr float K_DEFICIT = 150.0F;
+
+constexpr uint16_t soilBit(SoilType soil)
+{
+    return static_cast<uint16_t>(1U << static_cast<uint8_t>(soil));
+}
+
+constexpr Term nBelow(float threshold)
+{
+    return {Channel::NITROGEN, Compare::BELOW, threshold};
+}
+
+constexpr Term nAbove(float threshold)
+{
+    return {Channel::NITROGEN, Compare::ABOVE, threshold};
+}
+
+constexpr Term nAtLeast(float threshold)
+{
+    return {Channel::NITROGEN, Compare::AT_LEAST, threshold};
+}
+
+constexpr Term pBelow(float threshold)
+{
+    return {Channel::PHOSPHORUS, Compare::BELOW, threshold};
+}
+
+constexpr Term pAbove(float threshold)
+{
+    return {Channel::PHOSPHORUS, Compare::ABOVE, threshold};
+}
+
+constexpr Term pAtLeast(float threshold)
+{
+    return {Channel::PHOSPHORUS, Compare::AT_LEAST, threshold};
+}
+
+constexpr Term kBelow(float threshold)
+{
+    return {Channel::POTASSIUM, Compare::BELOW, threshold};
+}
+
+constexpr Term kAbove(float threshold)
+{
+    return {Channel::POTASSIUM, Compare::ABOVE, threshold};
+}
+
+constexpr Term kAtLeast(float threshold)
+{
+    return {Channel::POTASSIUM, Compare::AT_LEAST, threshold};
+}
+
+constexpr Term phBelow(float threshold)
+{
+    return {Channel::PH, Compare::BELOW, threshold};
+}
+
+constexpr Term phAbove(float threshold)
+{
+    return {Channel::PH, Compare::ABOVE, threshold};
+}
+
+
+constexpr Rule whenAll(CropId crop, MessageId message, Term first, Term second = NO_TERM, Term third = NO_TERM)
+{
+    return {crop, ALL_SOILS, Match::ALL, {{first, second, third}}, message};
+}
+
+constexpr Rule whenAny(CropId crop, MessageId message, Term first, Term second = NO_TERM, Term third = NO_TERM)
+{
+    return {crop, ALL_SOILS, Match::ANY, {{first, second, third}}, message};
+}
+
+// Правило по типу почвы для любой культуры; без условий срабатывает всегда
+constexpr Rule forSoils(uint16_t soilMask, MessageId message, Term first = NO_TERM)
+{
+    return {ANY_CROP, soilMask, Match::ALL, {{first, NO_TERM, NO_TERM}}, message};
+}
+
+// ============================================================================
+// ПРАВИЛА: порядок строк - порядок рекомендаций в ответе
+// ============================================================================
+inline constexpr std::array<Rule, MESSAGE_COUNT> RULES = {{
+    // Томаты: кальций против вершинной гнили, баланс N/P, бор для качества плодов;
+    // магний (антагонизм K→Mg) - в nutrient_interactions
+    whenAll(CropId::TOMATO, MessageId::TOMATO_CALCIUM, phBelow(6.5F)),
+    whenAll(CropId::TOMATO, MessageId::TOMATO_NP_BALANCE, nAbove(150.0F), pBelow(100.0F)),
+    whenAny(CropId::TOMATO, MessageId::TOMATO_BORON, phAbove(7.0F), kAbove(300.0F)),
+
+    // Огурцы: калий для плодов, бор (доступность падает при pH > 7.5), кальций, магний;
+    // антагонизм K→Mg - в nutrient_interactions
+    whenAll(CropId::CUCUMBER, MessageId::CUCUMBER_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(200.0F)),
+    whenAll(CropId::CUCUMBER, MessageId::CUCUMBER_BORON, phAbove(7.5F)),
+    whenAny(CropId::CUCUMBER, MessageId::CUCUMBER_CALCIUM, phBelow(6.0F), kAbove(250.0F)),
+    whenAny(CropId::CUCUMBER, MessageId::CUCUMBER_MAGNESIUM, kAbove(300.0F), phAbove(7.0F)),
+
+    // Перец: цинк при высоком фосфоре (антагонизм P→Zn), кальций, бор, калий, магний
+    whenAll(CropId::PEPPER, MessageId::PEPPER_ZINC, pAbove(100.0F)),
+    whenAll(CropId::PEPPER, MessageId::PEPPER_CALCIUM, phBelow(6.5F)),
+    whenAny(CropId::PEPPER, MessageId::PEPPER_BORON, phAbove(7.0F), kAbove(300.0F)),
+    whenAll(CropId::PEPPER, MessageId::PEPPER_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(180.0F)),
+    whenAny(CropId::PEPPER, MessageId::PEPPER_MAGNESIUM, kAbove(350.0F), phAbove(7.0F)),
+
+    // Салат: сера при высоком азоте, железо при высоком pH, азот для листьев, кальций
+    whenAll(CropId::LETTUCE, MessageId::LETTUCE_SULFUR, nAbove(250.0F)),
+    whenAll(CropId::LETTUCE, MessageId::LETTUCE_IRON, phAbove(7.0F)),
+    whenAll(CropId::LETTUCE, MessageId::LETTUCE_NITROGEN, nAtLeast(N_DEFICIT), nBelow(150.0F)),
+    whenAny(CropId::LETTUCE, MessageId::LETTUCE_CALCIUM, phBelow(6.0F), kAbove(200.0F)),
+
+    // Черника: кислая почва (pH 4.0-5.5), железо, марганец, аммонийный азот
+    whenAll(CropId::BLUEBERRY, MessageId::BLUEBERRY_ACIDITY, phAbove(5.5F)),
+    whenAll(CropId::BLUEBERRY, MessageId::BLUEBERRY_IRON, phAbove(5.0F)),
+    whenAll(CropId::BLUEBERRY, MessageId::BLUEBERRY_MANGANESE, phBelow(5.5F), nAbove(100.0F)),
+    whenAll(CropId::BLUEBERRY, MessageId::BLUEBERRY_AMMONIUM, nAtLeast(N_DEFICIT), nBelow(80.0F), phBelow(5.5F)),
+
+    // Клубника: кальций против гнили, бор для опыления, цинк при высоком фосфоре, калий
+    whenAll(CropId::STRAWBERRY, MessageId::STRAWBERRY_CALCIUM, phBelow(6.0F)),
+    whenAny(CropId::STRAWBERRY, MessageId::STRAWBERRY_BORON, phAbove(6.5F), kAbove(200.0F)),
+    whenAll(CropId::STRAWBERRY, MessageId::STRAWBERRY_ZINC, pAbove(80.0F)),
+    whenAll(CropId::STRAWBERRY, MessageId::STRAWBERRY_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(150.0F)),
+
+    // Яблоня: кальций против горькой ямчатости, бор, цинк (розеточность), калий, магний
+    whenAny(CropId::APPLE, MessageId::APPLE_CALCIUM, phBelow(6.5F), kAbove(250.0F)),
+    whenAll(CropId::APPLE, MessageId::APPLE_BORON, phAbove(7.0F)),
+    whenAny(CropId::APPLE, MessageId::APPLE_ZINC, phAbove(7.0F), pAbove(60.0F)),
+    whenAll(CropId::APPLE, MessageId::APPLE_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(180.0F)),
+    whenAny(CropId::APPLE, MessageId::APPLE_MAGNESIUM, kAbove(300.0F), phAbove(7.0F)),
+
+    // Виноград: калий для сахаристости, бор для опыления, кальций, магний;
+    // антагонизм K→Mg - в nutrient_interactions
+    whenAll(CropId::GRAPE, MessageId::GRAPE_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(200.0F)),
+    whenAll(CropId::GRAPE, MessageId::GRAPE_BORON, phAbove(7.0F)),
+    whenAny(CropId::GRAPE, MessageId::GRAPE_CALCIUM, phBelow(6.0F), kAbove(250.0F)),
+    whenAny(CropId::GRAPE, MessageId::GRAPE_MAGNESIUM, kAbove(300.0F), phAbove(7.0F)),
+
+    // Шпинат: железо против хлороза, магний при высоком калии, азот для листьев
+    whenAny(CropId::SPINACH, MessageId::SPINACH_IRON, phAbove(7.0F), nBelow(200.0F)),
+    whenAll(CropId::SPINACH, MessageId::SPINACH_MAGNESIUM, kAbove(400.0F)),
+    whenAll(CropId::SPINACH, MessageId::SPINACH_NITROGEN, nAtLeast(N_DEFICIT), nBelow(200.0F)),
+
+    // Базилик: калий для эфирных масел, магний, бор
+    whenAll(CropId::BASIL, MessageId::BASIL_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(200.0F)),
+    whenAny(CropId::BASIL, MessageId::BASIL_MAGNESIUM, kAbove(300.0F), phAbove(6.5F)),
+    whenAll(CropId::BASIL, MessageId::BASIL_BORON, phAbove(6.5F)),
+
+    // Конопля: азот (вегетация), фосфор (цветение), калий, кальций, магний при высоком калии
+    whenAll(CropId::CANNABIS, MessageId::CANNABIS_NITROGEN, nAtLeast(N_DEFICIT), nBelow(160.0F)),
+    whenAll(CropId::CANNABIS, MessageId::CANNABIS_PHOSPHORUS, pAtLeast(P_DEFICIT), pBelow(40.0F)),
+    whenAll(CropId::CANNABIS, MessageId::CANNABIS_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(200.0F)),
+    whenAll(CropId::CANNABIS, MessageId::CANNABIS_CALCIUM, phBelow(6.0F)),
+    whenAll(CropId::CANNABIS, MessageId::CANNABIS_MAGNESIUM, kAbove(300.0F)),
+
+    // Пшеница: азот для белка, фосфор для корней, сера, калий для устойчивости к болезням
+    whenAll(CropId::WHEAT, MessageId::WHEAT_NITROGEN, nAtLeast(N_DEFICIT), nBelow(200.0F)),
+    whenAll(CropId::WHEAT, MessageId::WHEAT_PHOSPHORUS, pAtLeast(P_DEFICIT), pBelow(50.0F)),
+    whenAll(CropId::WHEAT, MessageId::WHEAT_SULFUR, nAbove(250.0F), phAbove(7.0F)),
+    whenAll(CropId::WHEAT, MessageId::WHEAT_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(150.0F)),
+
+    // Картофель: калий для клубней, магний, кальций против пятнистости, баланс NPK, избыток азота
+    whenAll(CropId::POTATO, MessageId::POTATO_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(250.0F)),
+    whenAny(CropId::POTATO, MessageId::POTATO_MAGNESIUM, kAbove(400.0F), phBelow(6.0F)),
+    whenAll(CropId::POTATO, MessageId::POTATO_CALCIUM, phBelow(5.8F)),
+    whenAll(CropId::POTATO, MessageId::POTATO_NP_BALANCE, nAbove(200.0F), pBelow(50.0F)),
+    whenAll(CropId::POTATO, MessageId::POTATO_NITROGEN_EXCESS, nAbove(250.0F)),
+
+    // Кале: кальций против краевого ожога, сера (крестоцветные), бор против полых стеблей
+    whenAll(CropId::KALE, MessageId::KALE_CALCIUM, phBelow(6.0F)),
+    whenAll(CropId::KALE, MessageId::KALE_SULFUR, nAbove(200.0F), phAbove(6.5F)),
+    whenAny(CropId::KALE, MessageId::KALE_BORON, phAbove(7.0F), kAbove(350.0F)),
+
+    // Малина: железо против хлороза, марганец, цинк при высоком фосфоре
+    whenAll(CropId::RASPBERRY, MessageId::RASPBERRY_IRON, phAbove(6.5F)),
+    whenAll(CropId::RASPBERRY, MessageId::RASPBERRY_MANGANESE, phBelow(5.5F), nAbove(150.0F)),
+    whenAll(CropId::RASPBERRY, MessageId::RASPBERRY_ZINC, pAbove(70.0F)),
+
+    // Ежевика: железо (устойчивее малины), марганец, бор для завязывания плодов
+    whenAll(CropId::BLACKBERRY, MessageId::BLACKBERRY_IRON, phAbove(7.0F)),
+    whenAll(CropId::BLACKBERRY, MessageId::BLACKBERRY_MANGANESE, phBelow(5.8F)),
+    whenAny(CropId::BLACKBERRY, MessageId::BLACKBERRY_BORON, phAbove(6.8F), kAbove(300.0F)),
+
+    // Соя: фосфор и молибден для азотфиксации, калий для бобов, избыток азота её подавляет
+    whenAll(CropId::SOYBEAN, MessageId::SOYBEAN_PHOSPHORUS, pAtLeast(P_DEFICIT), pBelow(40.0F)),
+    whenAll(CropId::SOYBEAN, MessageId::SOYBEAN_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(200.0F)),
+    whenAll(CropId::SOYBEAN, MessageId::SOYBEAN_MOLYBDENUM, nBelow(80.0F), phBelow(6.0F)),
+    whenAll(CropId::SOYBEAN, MessageId::SOYBEAN_NITROGEN_EXCESS, nAbove(120.0F)),
+
+    // Морковь: бор против растрескивания, кальций против мягкой гнили, калий, избыток азота
+    whenAny(CropId::CARROT, MessageId::CARROT_BORON, phAbove(7.0F), kAbove(300.0F)),
+    whenAll(CropId::CARROT, MessageId::CARROT_CALCIUM, phBelow(6.0F)),
+    whenAll(CropId::CARROT, MessageId::CARROT_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(200.0F)),
+    whenAll(CropId::CARROT, MessageId::CARROT_NITROGEN_EXCESS, nAbove(180.0F)),
+
+    // Газон (N:P:K = 3:1:2): NPK, железо, кальций, магний, сера, микроэлементы
+    whenAll(CropId::LAWN, MessageId::LAWN_NITROGEN, nAtLeast(N_DEFICIT), nBelow(120.0F)),
+    whenAll(CropId::LAWN, MessageId::LAWN_PHOSPHORUS, pAtLeast(P_DEFICIT), pBelow(40.0F)),
+    whenAll(CropId::LAWN, MessageId::LAWN_POTASSIUM, kAtLeast(K_DEFICIT), kBelow(80.0F)),
+    whenAll(CropId::LAWN, MessageId::LAWN_IRON, phAbove(7.0F)),
+    whenAll(CropId::LAWN, MessageId::LAWN_CALCIUM, phBelow(6.0F)),
+    whenAll(CropId::LAWN, MessageId::LAWN_MAGNESIUM, kAbove(200.0F), phAbove(6.5F)),
+    whenAll(CropId::LAWN, MessageId::LAWN_SULFUR, nAbove(150.0F), phAbove(7.0F)),
+    whenAll(CropId::LAWN, MessageId::LAWN_MICRONUTRIENTS, nAbove(200.0F), pAbove(60.0F)),
+
+    // Хвойные: кислая почва, магний против пожелтения, чувствительность к избытку азота
+    whenAll(CropId::CONIFER, MessageId::CONIFER_ACIDITY, phAbove(6.0F)),
+    whenAll(CropId::CONIFER, MessageId::CONIFER_MAGNESIUM, kAbove(100.0F)),
+    whenAll(CropId::CONIFER, MessageId::CONIFER_NITROGEN_EXCESS, nAbove(100.0F)),
+
+    // Груша: кальций против горькой ямчатости, бор, цинк
+    whenAny(CropId::PEAR, MessageId::PEAR_CALCIUM, phBelow(6.5F), kAbove(250.0F)),
+    whenAll(CropId::PEAR, MessageId::PEAR_BORON, phAbove(7.0F)),
+    whenAny(CropId::PEAR, MessageId::PEAR_ZINC, phAbove(7.0F), pAbove(60.0F)),
+
+    // Вишня: кальций против растрескивания, бор для завязывания, железо
+    whenAny(CropId::CHERRY, MessageId::CHERRY_CALCIUM, phBelow(6.5F), kAbove(250.0F)),
+    whenAll(CropId::CHERRY, MessageId::CHERRY_BORON, phAbove(7.0F)),
+    whenAll(CropId::CHERRY, MessageId::CHERRY_IRON, phAbove(7.0F)),
+
+    // Смородина: железо против хлороза, бор для завязывания ягод, марганец
+    whenAll(CropId::CURRANT, MessageId::CURRANT_IRON, phAbove(7.0F)),
+    whenAny(CropId::CURRANT, MessageId::CURRANT_BORON, phAbove(6.8F), kAbove(300.0F)),
+    whenAll(CropId::CURRANT, MessageId::CURRANT_MANGANESE, phBelow(5.8F)),
+
+    // Общие рекомендации по типу почвы
+    forSoils(soilBit(SoilType::CLAY) | soilBit(SoilType::CLAY_LOAM), MessageId::SOIL_CLAY_CHELATES),
+    forSoils(soilBit(SoilType::SAND) | soilBit(SoilType::SANDY_LOAM), MessageId::SOIL_SAND_FREQUENT_FEEDING),
+    forSoils(soilBit(SoilType::PEAT), MessageId::SOIL_PEAT_PHOSPHORUS, pBelow(30.0F)),
+}};
+
+// Местные названия культур для строкового API (прежние варианты "томат", "огурец", ...)
+struct LocalCropName
+{
+    CropId id;
+    const char* name;
+};
+
+inline constexpr std::array<LocalCropName, CROP_COUNT - 1> LOCAL_CROP_NAMES = {{
+    {CropId::TOMATO, "томат"},
+    {CropId::CUCUMBER, "огурец"},
+    {CropId::PEPPER, "перец"},
+    {CropId::LETTUCE, "салат"},
+    {CropId::BLUEBERRY, "черника"},
+    {CropId::LAWN, "газон"},
+    {CropId::GRAPE, "виноград"},
+    {CropId::CONIFER, "хвойные"},
+    {CropId::STRAWBERRY, "клубника"},
+    {CropId::APPLE, "яблоня"},
+    {CropId::PEAR, "груша"},
+    {CropId::CHERRY, "вишня"},
+    {CropId::RASPBERRY, "малина"},
+    {CropId::CURRANT, "смородина"},
+    {CropId::SPINACH, "шпинат"},
+    {CropId::BASIL, "базилик"},
+    {CropId::CANNABIS, "конопля"},
+    {CropId::WHEAT, "пшеница"},
+    {CropId::POTATO, "картофель"},
+    {CropId::KALE, "кале"},
+    {CropId::BLACKBERRY, "ежевика"},
+    {CropId::SOYBEAN, "соя"},
+    {CropId::CARROT, "морковь"},
+}};
+
+// ============================================================================
+// ОЦЕНКА ПРАВИЛ
+// ============================================================================
+constexpr size_t MAX_MESSAGES = 12;
+
+/**
+ * @brief Сработавшие правила: коды сообщений в порядке RULES
+ */
+struct MessageList
+{
+    std::array<MessageId, MAX_MESSAGES> ids{};
+    uint8_t count = 0;
+
+    const MessageId* begin() const
+    {
+        return ids.data();
+    }
+    const MessageId* end() const
+    {
+        return ids.data() + count;
+    }
+};
+
+constexpr bool termHolds(const Term& term, const std::array<float, static_cast<size_t>(Channel::COUNT)>& values,
+                         bool neutral)
+{
+    const float value = values[static_cast<size_t>(term.channel)];
+    switch (term.compare)
+    {
+        case Compare::BELOW:
+            return value < term.threshold;
+        case Compare::ABOVE:
+            return value > term.threshold;
+        case Compare::AT_LEAST:
+            return value >= term.threshold;
+        case Compare::NONE:
+        default:
+            return neutral;
+    }
+}
+
+constexpr bool ruleFires(const Rule& rule, CropId crop, SoilType soil,
+                         const std::array<float, static_cast<size_t>(Channel::COUNT)>& values)
+{
+    if ((rule.crop != crop && rule.crop != ANY_CROP) || (rule.soilMask & soilBit(soil)) == 0)
+    {
+        return false;
+    }
+    const bool all = rule.match == Match::ALL;
+    bool result = all;
+    for (const Term& term : rule.terms)
+    {
+        const bool holds = termHolds(term, values, all);
+        result = all ? (result && holds) : (result || holds);
+    }
+    return result;
+}
+
+/**
+ * @brief Проверяет все правила за один проход
+ * @param crop Культура; GENERIC - только правила по типу почвы
+ * @param soil Тип почвы
+ * @param npk Научно компенсированные N, P, K (мг/кг)
+ * @param pH Значение pH
+ */
+inline MessageList evaluate(CropId crop, SoilType soil, const NPKReferences& npk, float pH)
+{
+    const std::array<float, static_cast<size_t>(Channel::COUNT)> values = {
+        {npk.nitrogen, npk.phosphorus, npk.potassium, pH}};
+    MessageList messages;
+    for (const Rule& rule : RULES)
+    {
+        if (ruleFires(rule, crop, soil, values))
+        {
+            messages.ids[messages.count++] = rule.message;
+        }
+    }
+    return messages;
+}
+
+constexpr const char* messageText(MessageId id)
+{
+    return MESSAGE_TEXTS[static_cast<size_t>(id)].text;
+}
+
+/**
+ * @brief CropId по id культуры ("tomato") или местному названию ("томат"); иначе GENERIC
+ */
+inline CropId cropIdFromAnyName(const char* name)
+{
+    CropId cropId = CropId::GENERIC;
+    if (name == nullptr || findCropId(name, cropId))
+    {
+        return cropId;
+    }
+    for (const LocalCropName& local : LOCAL_CROP_NAMES)
+    {
+        if (strcmp(local.name, name) == 0)
+        {
+            return local.id;
+        }
+    }
+    return CropId::GENERIC;
+}
+
+// Проверки при компиляции: порядок MESSAGE_TEXTS, у каждого кода ровно одно правило,
+// список сообщений вмещает все правила одной культуры вместе с правилами по почве
+constexpr bool rulesAreConsistent()
+{
+    for (size_t i = 0; i < MESSAGE_COUNT; ++i)
+    {
+        if (static_cast<size_t>(MESSAGE_TEXTS[i].id) != i || static_cast<size_t>(RULES[i].message) != i)
+        {
+            return false;
+        }
+    }
+    for (size_t crop = 0; crop < CROP_COUNT; ++crop)
+    {
+        size_t possible = 0;
+        for (const Rule& rule : RULES)
+        {
+            possible += (static_cast<size_t>(rule.crop) == crop || rule.crop == ANY_CROP) ? 1 : 0;
+        }
+        if (possible > MAX_MESSAGES)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(rulesAreConsistent(),
+              "CropRules: порядок MESSAGE_TEXTS/RULES не совпадает с MessageId или MAX_MESSAGES мал для культуры");
+}  // namespace CropRules
+
+#endif  // CROP_RULES_H
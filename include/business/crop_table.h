@@ -0,0 +1,265 @@
+/**
+ * @file crop_table.h
+ * @brief Табличные значения культур во flash
+ * @details База культур - constexpr массив, индексированный CropId: без String-ключей
+ *          и узлов std::map в куче, без сборки при старте. Строковый id культуры
+ *          (config.cropId, параметры API) переводится в CropId один раз на входе через
+ *          совершенный хэш: FNV-1a с подобранной затравкой даёт каждой культуре свою
+ *          ячейку, поиск - один хэш и одно сравнение строк, без выделений памяти.
+ *          Совершенность хэша и порядок таблицы проверяются при компиляции.
+ */
+
+#ifndef CROP_TABLE_H
+#define CROP_TABLE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "ICropRecommendationEngine.h"  // CropConfig
+
+/**
+ * @brief Идентификаторы культур; порядок совпадает с CROP_TABLE
+ */
+enum class CropId : uint8_t
+{
+    GENERIC = 0,
+    TOMATO,
+    CUCUMBER,
+    PEPPER,
+    LETTUCE,
+    BLUEBERRY,
+    LAWN,
+    GRAPE,
+    CONIFER,
+    STRAWBERRY,
+    APPLE,
+    PEAR,
+    CHERRY,
+    RASPBERRY,
+    CURRANT,
+    SPINACH,
+    BASIL,
+    CANNABIS,
+    WHEAT,
+    POTATO,
+    KALE,
+    BLACKBERRY,
+    SOYBEAN,
+    CARROT,
+    COUNT
+};
+
+constexpr size_t CROP_COUNT = static_cast<size_t>(CropId::COUNT);
+
+struct CropTableEntry
+{
+    CropId id;
+    const char* name;  // id культуры в config.cropId и API
+    CropConfig config;
+};
+
+// ЯБЛОНИ (Malus domestica) - Journal of Horticultural Science; груша - та же конфигурация
+// pH 6.0-7.0, EC 1.0-1.8 mS/cm, N: 90-130, P: 35-55, K: 110-150 мг/кг
+constexpr CropConfig POME_CROP_CONFIG(20.0F, 75.0F, 1200.0F, 6.5F, 110.0F, 45.0F, 130.0F);
+
+// ============================================================================
+// ЗНАЧЕНИЯ ВЛАЖНОСТИ В ASM (Available Soil Moisture)
+// Источник: Научные публикации, ASM рекомендации (70-85% ASM)
+// Порядок полей CropConfig: температура, влажность(ASM), EC, pH, N, P, K (мг/кг)
+// ============================================================================
+inline constexpr std::array<CropTableEntry, CROP_COUNT> CROP_TABLE = {{
+    // Базовые значения (generic) - FAO Irrigation and Drainage Paper 56
+    {CropId::GENERIC, "generic", CropConfig(22.0F, 75.0F, 1500.0F, 6.5F, 150.0F, 60.0F, 200.0F)},
+
+    // ТОМАТЫ (Solanum lycopersicum) - University of Florida IFAS Extension, B. Santos, 2019
+    // pH 6.0-6.8, EC 1.5-3.0 mS/cm, N: 150-250, P: 50-100, K: 200-400 мг/кг
+    {CropId::TOMATO, "tomato", CropConfig(24.0F, 80.0F, 2000.0F, 6.5F, 200.0F, 80.0F, 300.0F)},
+
+    // ОГУРЦЫ (Cucumis sativus) - USDA Natural Resources Conservation Service, 2020
+    // pH 6.0-7.0, EC 1.2-2.5 mS/cm, N: 120-200, P: 40-80, K: 150-300 мг/кг
+    {CropId::CUCUMBER, "cucumber", CropConfig(26.0F, 75.0F, 1800.0F, 6.5F, 160.0F, 60.0F, 225.0F)},
+
+    // ПЕРЕЦ (Capsicum annuum) - Cornell University Cooperative Extension, 2022
+    // pH 6.0-7.0, EC 1.4-2.8 mS/cm, N: 100-180, P: 30-70, K: 150-350 мг/кг
+    {CropId::PEPPER, "pepper", CropConfig(27.0F, 75.0F, 2100.0F, 6.5F, 140.0F, 50.0F, 250.0F)},
+
+    // САЛАТ (Lactuca sativa) - University of California Agriculture and Natural Resources, 2018
+    // pH 6.0-7.0, EC 1.0-2.0 mS/cm, N: 80-150, P: 20-50, K: 100-250 мг/кг
+    {CropId::LETTUCE, "lettuce", CropConfig(18.0F, 85.0F, 1500.0F, 6.5F, 115.0F, 35.0F, 175.0F)},
+
+    // ЧЕРНИКА (Vaccinium corymbosum) - Michigan State University Extension, A. Schilder, 2021
+    // pH 4.5-5.5, EC 0.8-1.5 mS/cm, N: 50-100, P: 20-40, K: 40-80 мг/кг
+    {CropId::BLUEBERRY, "blueberry", CropConfig(20.0F, 65.0F, 1200.0F, 5.0F, 75.0F, 30.0F, 60.0F)},
+
+    // ГАЗОН (Lawn) - Turfgrass Science + FAO Crop Calendar
+    // pH 6.0-7.0, EC 1.2-1.8 mS/cm, N: 120-180, P: 45-75, K: 160-240 мг/кг
+    {CropId::LAWN, "lawn", CropConfig(22.0F, 75.0F, 1500.0F, 6.5F, 150.0F, 60.0F, 200.0F)},
+
+    // ВИНОГРАД (Vitis vinifera) - Viticulture Research 2021
+    // pH 6.0-7.5, EC 1.0-2.0 mS/cm, N: 100-140, P: 40-60, K: 120-180 мг/кг
+    {CropId::GRAPE, "grape", CropConfig(26.0F, 60.0F, 2000.0F, 6.8F, 130.0F, 40.0F, 200.0F)},
+
+    // ХВОЙНЫЕ (Conifer) - Forest Science
+    // pH 5.5-6.5, EC 0.5-1.2 mS/cm, N: 50-70, P: 20-30, K: 40-60 мг/кг
+    {CropId::CONIFER, "conifer", CropConfig(18.0F, 65.0F, 1000.0F, 5.8F, 60.0F, 25.0F, 50.0F)},
+
+    // КЛУБНИКА (Fragaria × ananassa) - HortScience
+    // pH 5.5-6.5, EC 1.2-2.0 mS/cm, N: 110-150, P: 45-65, K: 130-170 мг/кг
+    {CropId::STRAWBERRY, "strawberry", CropConfig(22.0F, 75.0F, 1600.0F, 6.0F, 130.0F, 55.0F, 150.0F)},
+
+    // ЯБЛОНИ и ГРУШИ - общая конфигурация семечковых
+    {CropId::APPLE, "apple", POME_CROP_CONFIG},
+    {CropId::PEAR, "pear", POME_CROP_CONFIG},
+
+    // ВИШНЯ (Prunus avium) - HortScience
+    // pH 6.0-7.0, EC 1.0-1.8 mS/cm, N: 100-140, P: 40-60, K: 120-160 мг/кг
+    {CropId::CHERRY, "cherry", CropConfig(22.0F, 75.0F, 1300.0F, 6.5F, 120.0F, 50.0F, 140.0F)},
+
+    // МАЛИНА (Rubus idaeus) - Acta Horticulturae
+    // pH 5.5-6.5, EC 0.8-1.5 mS/cm, N: 80-120, P: 30-50, K: 100-140 мг/кг
+    {CropId::RASPBERRY, "raspberry", CropConfig(20.0F, 75.0F, 1100.0F, 6.0F, 100.0F, 40.0F, 120.0F)},
+
+    // СМОРОДИНА (Ribes spp.) - HortScience
+    // pH 5.5-6.5, EC 0.8-1.3 mS/cm, N: 70-90, P: 30-40, K: 90-110 мг/кг
+    {CropId::CURRANT, "currant", CropConfig(18.0F, 65.0F, 1000.0F, 6.0F, 80.0F, 35.0F, 100.0F)},
+
+    // ШПИНАТ (Spinacia oleracea) - UC Extension, 2019
+    // pH 6.0-7.0, EC 1.0-1.8 mS/cm, N: 150-250, P: 40-60, K: 250-350 мг/кг
+    {CropId::SPINACH, "spinach", CropConfig(20.0F, 80.0F, 1400.0F, 6.5F, 200.0F, 50.0F, 300.0F)},
+
+    // БАЗИЛИК (Ocimum basilicum) - Journal of Essential Oil Research, 2019
+    // pH 6.0-7.0, EC 1.0-1.8 mS/cm, N: 100-140, P: 30-50, K: 150-210 мг/кг
+    {CropId::BASIL, "basil", CropConfig(25.0F, 75.0F, 1400.0F, 6.5F, 120.0F, 40.0F, 180.0F)},
+
+    // КОНОПЛЯ МЕДИЦИНСКАЯ (Cannabis sativa) - Journal of Cannabis Research, 2020
+    // pH 6.0-7.0, EC 1.2-2.0 mS/cm, N: 140-180, P: 30-50, K: 180-220 мг/кг
+    {CropId::CANNABIS, "cannabis", CropConfig(24.0F, 80.0F, 1600.0F, 6.5F, 160.0F, 40.0F, 200.0F)},
+
+    // ПШЕНИЦА (Triticum aestivum) - Kansas State University, 2020
+    // pH 6.0-7.0, EC 1.0-1.5 mS/cm, N: 180-220, P: 40-60, K: 130-170 мг/кг
+    {CropId::WHEAT, "wheat", CropConfig(20.0F, 65.0F, 1200.0F, 6.5F, 200.0F, 50.0F, 150.0F)},
+
+    // КАРТОФЕЛЬ (Solanum tuberosum) - University of Idaho, 2020
+    // pH 5.5-6.5, EC 1.2-1.8 mS/cm, 35% ASM - научно обосновано, N: 160-200, P: 40-60, K: 220-280 мг/кг
+    {CropId::POTATO, "potato", CropConfig(18.0F, 35.0F, 1500.0F, 6.0F, 180.0F, 50.0F, 250.0F)},
+
+    // КАЛЕ (Brassica oleracea var. sabellica) - University of Wisconsin, 2020
+    // pH 6.0-7.0, EC 1.0-1.6 mS/cm, N: 130-170, P: 30-50, K: 180-220 мг/кг
+    {CropId::KALE, "kale", CropConfig(18.0F, 75.0F, 1300.0F, 6.5F, 150.0F, 40.0F, 200.0F)},
+
+    // ЕЖЕВИКА (Rubus fruticosus) - University of Arkansas, 2020
+    // pH 5.5-6.5, EC 1.0-1.5 mS/cm, N: 100-140, P: 25-45, K: 160-200 мг/кг
+    {CropId::BLACKBERRY, "blackberry", CropConfig(22.0F, 75.0F, 1200.0F, 6.0F, 120.0F, 35.0F, 180.0F)},
+
+    // СОЯ (Glycine max) - University of Illinois, 2020
+    // pH 6.0-7.0, EC 1.0-1.8 mS/cm, N: 60-100, P: 30-50, K: 180-220 мг/кг
+    {CropId::SOYBEAN, "soybean", CropConfig(24.0F, 65.0F, 1400.0F, 6.5F, 80.0F, 40.0F, 200.0F)},
+
+    // МОРКОВЬ (Daucus carota) - UC Extension, 2020
+    // pH 6.0-7.0, EC 1.0-1.5 mS/cm, N: 100-140, P: 30-50, K: 160-200 мг/кг
+    {CropId::CARROT, "carrot", CropConfig(18.0F, 75.0F, 1200.0F, 6.5F, 120.0F, 40.0F, 180.0F)},
+}};
+
+// ============================================================================
+// СОВЕРШЕННЫЙ ХЭШ id КУЛЬТУРЫ
+// При добавлении культуры static_assert ниже может потребовать новую затравку:
+// подойдёт любая, при которой старшие CROP_HASH_BITS бит хэша всех id различны
+// (test/test_crop_table.py печатает подходящую при падении проверки)
+// ============================================================================
+constexpr uint32_t CROP_HASH_SEED = 0x811C9FE8U;
+constexpr uint32_t CROP_HASH_PRIME = 16777619U;  // FNV-1a
+constexpr uint32_t CROP_HASH_BITS = 6;
+constexpr size_t CROP_HASH_BUCKETS = size_t{1} << CROP_HASH_BITS;
+constexpr uint8_t CROP_HASH_EMPTY = 0xFF;
+
+constexpr uint32_t cropNameHash(const char* name)
+{
+    uint32_t hash = CROP_HASH_SEED;
+    for (; *name != '\0'; ++name)
+    {
+        hash ^= static_cast<uint8_t>(*name);
+        hash *= CROP_HASH_PRIME;
+    }
+    return hash >> (32U - CROP_HASH_BITS);
+}
+
+constexpr bool cropNameEquals(const char* left, const char* right)
+{
+    for (; *left != '\0' && *left == *right; ++left, ++right)
+    {
+    }
+    return *left == *right;
+}
+
+constexpr std::array<uint8_t, CROP_HASH_BUCKETS> buildCropHashIndex()
+{
+    std::array<uint8_t, CROP_HASH_BUCKETS> index{};
+    for (auto& slot : index)
+    {
+        slot = CROP_HASH_EMPTY;
+    }
+    for (size_t i = 0; i < CROP_COUNT; ++i)
+    {
+        index[cropNameHash(CROP_TABLE[i].name)] = static_cast<uint8_t>(i);
+    }
+    return index;
+}
+
+// Ячейка хэша -> индекс в CROP_TABLE (CROP_HASH_EMPTY - нет культуры)
+inline constexpr std::array<uint8_t, CROP_HASH_BUCKETS> CROP_HASH_INDEX = buildCropHashIndex();
+
+constexpr bool cropTableIsConsistent()
+{
+    for (size_t i = 0; i < CROP_COUNT; ++i)
+    {
+        if (static_cast<size_t>(CROP_TABLE[i].id) != i || CROP_HASH_INDEX[cropNameHash(CROP_TABLE[i].name)] != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(CROP_COUNT < CROP_HASH_EMPTY, "CropId не помещается в индекс хэша");
+static_assert(cropTableIsConsistent(),
+              "CROP_TABLE: порядок не совпадает с CropId или хэш id культур не совершенный - подберите CROP_HASH_SEED");
+
+/**
+ * @brief Ищет культуру по строковому id
+ * @return true и id культуры, false для неизвестного id
+ */
+constexpr bool findCropId(const char* name, CropId& cropId)
+{
+    if (name == nullptr)
+    {
+        return false;
+    }
+    const uint8_t index = CROP_HASH_INDEX[cropNameHash(name)];
+    if (index == CROP_HASH_EMPTY || !cropNameEquals(CROP_TABLE[index].name, name))
+    {
+        return false;
+    }
+    cropId = CROP_TABLE[index].id;
+    return true;
+}
+
+/**
+ * @brief CropId по строковому id; неизвестная культура, "" и "none" - GENERIC
+ */
+constexpr CropId cropIdFromName(const char* name)
+{
+    CropId cropId = CropId::GENERIC;
+    return findCropId(name, cropId) ? cropId : CropId::GENERIC;
+}
+
+constexpr const CropConfig& cropTableConfig(CropId cropId)
+{
+    return CROP_TABLE[static_cast<size_t>(cropId)].config;
+}
+
+constexpr const char* cropTableName(CropId cropId)
+{
+    return CROP_TABLE[static_cast<size_t>(cropId)].name;
+}
+
+#endif  // CROP_TABLE_H
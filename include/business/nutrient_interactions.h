@@ -0,0 +1,210 @@
+/**
+ * @file nutrient_interactions.h
+ * @brief Коэффициенты взаимодействия питательных веществ во flash
+ * @details Антагонизмы и синергизмы - constexpr таблица, индексируемая перечислениями
+ *          элементов, вместо сравнения названий "N", "K", "Mg" String при каждом вызове.
+ *          Все формулы сервиса имеют один вид: доля x = количество / масштаб (или / количество
+ *          второго элемента) сравнивается с порогом, и фактор линейно уходит от 1 за порогом.
+ *          computeFactors() считает все факторы для тройки NPK за один проход без ветвлений
+ *          по элементам; результат побитово совпадает с прежними формулами.
+ *          Порядок таблицы проверяется при компиляции.
+ */
+
+#ifndef NUTRIENT_INTERACTIONS_H
+#define NUTRIENT_INTERACTIONS_H
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../sensor_types.h"
+
+namespace NutrientInteractions
+{
+/**
+ * @brief Элементы питания; датчик измеряет только N, P, K
+ */
+enum class Nutrient : uint8_t
+{
+    NITROGEN = 0,
+    PHOSPHORUS,
+    POTASSIUM,
+    CALCIUM,
+    MAGNESIUM,
+    SULFUR,
+    ZINC,
+    BORON,
+    COUNT
+};
+
+constexpr size_t NUTRIENT_COUNT = static_cast<size_t>(Nutrient::COUNT);
+
+// Обозначения элементов для строкового API (getAntagonismFactor("N", "K", ...))
+inline constexpr std::array<const char*, NUTRIENT_COUNT> NUTRIENT_SYMBOLS = {
+    {"N", "P", "K", "Ca", "Mg", "S", "Zn", "B"}};
+
+enum class Effect : uint8_t
+{
+    ANTAGONISM,  // фактор < 1, когда доля выше порога
+    SYNERGY      // фактор > 1, когда доля ниже порога
+};
+
+/**
+ * @brief Взаимодействия; порядок совпадает с INTERACTIONS
+ */
+enum class Interaction : uint8_t
+{
+    NITROGEN_BLOCKS_POTASSIUM = 0,
+    PHOSPHORUS_BLOCKS_POTASSIUM,
+    POTASSIUM_BLOCKS_MAGNESIUM,
+    PHOSPHORUS_BLOCKS_ZINC,
+    NITROGEN_WITH_SULFUR,
+    CALCIUM_WITH_BORON,
+    COUNT
+};
+
+constexpr size_t INTERACTION_COUNT = static_cast<size_t>(Interaction::COUNT);
+
+/**
+ * @brief Коэффициенты одного взаимодействия
+ * @details x = количество(from) / scale (при scale = 0 - / количество(to));
+ *          антагонизм: 1 + bonus - slope * max(0, x - onset) / span;
+ *          синергизм:  1 + bonus + slope * max(0, onset - x) / span
+ */
+struct Coefficients
+{
+    Interaction id;
+    Nutrient from;
+    Nutrient to;
+    Effect effect;
+    float scale;  // 0 - соотношение с количеством второго элемента
+    float onset;  // порог доли
+    float slope;
+    float span;   // делитель наклона (1 - без нормировки)
+    float bonus;  // постоянная часть (для пар, которые датчик не измеряет)
+};
+
+// Источники: Marschner, 2012 (антагонизмы); White & Brown, 2010 (синергизмы)
+inline constexpr std::array<Coefficients, INTERACTION_COUNT> INTERACTIONS = {{
+    // Высокий азот блокирует калий: оптимум N:K = 1:1 при 200 мг/кг
+    {Interaction::NITROGEN_BLOCKS_POTASSIUM, Nutrient::NITROGEN, Nutrient::POTASSIUM, Effect::ANTAGONISM, 200.0F,
+     1.5F, 0.3F, 1.0F, 0.0F},
+    // Высокий фосфор блокирует калий: P/K выше 0.8
+    {Interaction::PHOSPHORUS_BLOCKS_POTASSIUM, Nutrient::PHOSPHORUS, Nutrient::POTASSIUM, Effect::ANTAGONISM, 0.0F,
+     0.8F, 0.15F, 1.0F, 0.0F},
+    // Высокий калий блокирует магний: оптимум K:Mg = 2:1
+    {Interaction::POTASSIUM_BLOCKS_MAGNESIUM, Nutrient::POTASSIUM, Nutrient::MAGNESIUM, Effect::ANTAGONISM, 200.0F,
+     2.5F, 0.25F, 1.0F, 0.0F},
+    // Высокий фосфор блокирует цинк: оптимум P:Zn = 10:1
+    {Interaction::PHOSPHORUS_BLOCKS_ZINC, Nutrient::PHOSPHORUS, Nutrient::ZINC, Effect::ANTAGONISM, 100.0F, 15.0F,
+     0.4F, 15.0F, 0.0F},
+    // Сера усиливает усвоение азота: оптимум N:S = 15:1 при среднем содержании S
+    {Interaction::NITROGEN_WITH_SULFUR, Nutrient::NITROGEN, Nutrient::SULFUR, Effect::SYNERGY, 10.0F, 15.0F, 0.15F,
+     15.0F, 0.0F},
+    // Кальций улучшает транспорт бора; оба не измеряются - постоянный эффект
+    {Interaction::CALCIUM_WITH_BORON, Nutrient::CALCIUM, Nutrient::BORON, Effect::SYNERGY, 1.0F, 0.0F, 0.0F, 1.0F,
+     0.1F},
+}};
+
+using Amounts = std::array<float, NUTRIENT_COUNT>;
+using Factors = std::array<float, INTERACTION_COUNT>;
+
+/**
+ * @brief Фактор одного взаимодействия
+ * @details Порог - через max(0, ...), а не ветвление: ниже порога фактор ровно 1 + bonus.
+ *          Порядок операций повторяет прежние формулы, поэтому результат побитово тот же
+ */
+inline float factor(const Coefficients& coefficients, const Amounts& amounts)
+{
+    const float divisor = coefficients.scale > 0.0F ? coefficients.scale
+                                                    : amounts[static_cast<size_t>(coefficients.to)];
+    const float share = amounts[static_cast<size_t>(coefficients.from)] / divisor;
+    const float sign = coefficients.effect == Effect::SYNERGY ? 1.0F : -1.0F;
+    const float excess = std::fmax(0.0F, (share - coefficients.onset) * -sign);
+    return 1.0F + coefficients.bonus + sign * (coefficients.slope * excess / coefficients.span);
+}
+
+inline Amounts amountsFromNpk(const NPKReferences& npk)
+{
+    // Ca, Mg, S, Zn, B датчиком не измеряются
+    return {{npk.nitrogen, npk.phosphorus, npk.potassium}};
+}
+
+/**
+ * @brief Все факторы взаимодействий для тройки NPK за один проход
+ * @param npk N, P, K (мг/кг)
+ * @return Factors Индекс - Interaction
+ */
+inline Factors computeFactors(const NPKReferences& npk)
+{
+    const Amounts amounts = amountsFromNpk(npk);
+    Factors factors{};
+    for (size_t i = 0; i < INTERACTION_COUNT; ++i)
+    {
+        factors[i] = factor(INTERACTIONS[i], amounts);
+    }
+    return factors;
+}
+
+constexpr float get(const Factors& factors, Interaction id)
+{
+    return factors[static_cast<size_t>(id)];
+}
+
+/**
+ * @brief Элемент по обозначению ("N", "Mg"); false - неизвестное обозначение
+ */
+inline bool nutrientFromSymbol(const char* symbol, Nutrient& nutrient)
+{
+    for (size_t i = 0; i < NUTRIENT_COUNT; ++i)
+    {
+        if (symbol != nullptr && strcmp(NUTRIENT_SYMBOLS[i], symbol) == 0)
+        {
+            nutrient = static_cast<Nutrient>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Взаимодействие пары элементов; false - пара не взаимодействует с таким эффектом
+ */
+constexpr bool findInteraction(Nutrient from, Nutrient to, Effect effect, Interaction& id)
+{
+    for (const Coefficients& coefficients : INTERACTIONS)
+    {
+        if (coefficients.from == from && coefficients.to == to && coefficients.effect == effect)
+        {
+            id = coefficients.id;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Проверки при компиляции: порядок таблицы, делители ненулевые, пары не повторяются
+constexpr bool interactionsAreConsistent()
+{
+    for (size_t i = 0; i < INTERACTION_COUNT; ++i)
+    {
+        const Coefficients& coefficients = INTERACTIONS[i];
+        if (static_cast<size_t>(coefficients.id) != i || coefficients.span <= 0.0F || coefficients.scale < 0.0F)
+        {
+            return false;
+        }
+        Interaction first = Interaction::COUNT;
+        if (!findInteraction(coefficients.from, coefficients.to, coefficients.effect, first) ||
+            first != coefficients.id)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(interactionsAreConsistent(), "INTERACTIONS не совпадает с Interaction или содержит повтор пары");
+}  // namespace NutrientInteractions
+
+#endif  // NUTRIENT_INTERACTIONS_H
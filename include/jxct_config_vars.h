@@ -66,6 +66,12 @@ struct __attribute__((packed)) Config
     char thingSpeakChannelId[12];  // Сократил с 16 до 12 байт
     uint16_t thingspeakInterval;
 
+    // Дополнительные выгрузки (uplink-приёмники)
+    char influxUrl[128];    // Полный URL записи InfluxDB (…/api/v2/write?org=…&bucket=…&precision=s)
+    char influxToken[96];   // API-токен InfluxDB (заголовок Authorization: Token …)
+    char httpJsonUrl[96];   // URL приёмника HTTP JSON (POST массива сэмплов)
+    char uplinkTlsFingerprint[96];  // SHA-256 сертификата своего HTTPS-сервера (hex, ':' допустимы)
+
     // Информация о устройстве
     char manufacturer[24];  // Сократил с 32 до 24 байт
     char model[24];         // Сократил с 32 до 24 байт
@@ -145,6 +151,9 @@ struct __attribute__((packed)) Config
         uint8_t isGreenhouse : 1;           // 1 = теплица, 0 = открытый грунт (устарело)
         uint8_t seasonalAdjustEnabled : 1;  // Учитывать сезонные коэффициенты
         uint8_t autoOtaEnabled : 1;         // автоматическое OTA разрешено
+        uint8_t influxEnabled : 1;          // Выгрузка в InfluxDB (line protocol)
+        uint8_t httpJsonEnabled : 1;        // Выгрузка на HTTP JSON приёмник
+        uint8_t uplinkTlsInsecure : 1;      // Не проверять сертификат HTTPS-приёмников (явный отказ)
     } flags;
 };
 
@@ -46,6 +46,13 @@ constexpr unsigned long LED_BLINK_FAST = 100;    // 0.1 секунды
 
 // Порты и адреса
 constexpr int DEFAULT_WEB_SERVER_PORT = 80;
+constexpr size_t WEB_CHUNK_BUFFER_SIZE = 1024;  // Буфер потоковой отдачи ответа (один HTTP-чанк)
+
+// Server-Sent Events (поток показаний для открытых страниц)
+constexpr size_t SSE_MAX_CLIENTS = 4;                       // Одновременных потоков; остальным - 503
+constexpr unsigned long SSE_KEEPALIVE_INTERVAL_MS = 15000;  // Комментарий-пинг при отсутствии событий
+constexpr unsigned long SSE_RETRY_MS = 5000;                // Пауза переподключения EventSource
+constexpr unsigned long SSE_STALL_TIMEOUT_MS = 30000;       // Без места в окне TCP дольше - поток закрывается
 constexpr int DEFAULT_MQTT_PORT = 1883;
 constexpr int DEFAULT_DNS_PORT = 53;
 constexpr uint8_t DEFAULT_MODBUS_ADDRESS = 1;
@@ -108,6 +115,31 @@ constexpr unsigned long CONFIG_INTERVAL_MIN = 1000;       // 1 секунда
 constexpr unsigned long CONFIG_INTERVAL_MAX = 3600000;    // 1 час
 constexpr unsigned long CONFIG_THINGSPEAK_MIN = 20000;    // 20 секунд (избегаем таймаутов)
 constexpr unsigned long CONFIG_THINGSPEAK_MAX = 7200000;  // 2 часа
+
+// ThingSpeak bulk-update: сэмплы копятся локально и уходят одним запросом
+// (bulk_update.json принимает до 960 записей за запрос, лимит запросов тот же ~15с)
+constexpr size_t THINGSPEAK_BULK_MAX_SAMPLES = 32;             // Ёмкость локального буфера (≈5 КБ JSON)
+constexpr unsigned long THINGSPEAK_BULK_SAMPLE_MIN_MS = 10000;  // 10 сек - разрешение сэмплов
+constexpr int THINGSPEAK_BULK_HTTP_ACCEPTED = 202;              // Успешный ответ bulk_update.json
+
+// Uplink-приёмники: общая очередь сэмплов и фоновая HTTP-доставка
+constexpr size_t UPLINK_SAMPLE_QUEUE_SIZE = 32;        // Сэмплов в общей очереди
+constexpr size_t UPLINK_MAX_SINKS = 6;                 // Максимум зарегистрированных приёмников
+constexpr unsigned long UPLINK_SINK_INTERVAL_MS = 60000;  // Интервал InfluxDB / HTTP JSON
+constexpr uint8_t UPLINK_SINK_MAX_BATCH = 16;           // Сэмплов в одном запросе InfluxDB / HTTP JSON
+constexpr uint16_t UPLINK_HTTP_TIMEOUT_MS = 15000;
+constexpr uint32_t UPLINK_SESSION_LOCK_WAIT_MS = 5;  // loop()/веб-задача не ждут чужой запрос (до 60 с)
+constexpr int UPLINK_SESSION_BUSY = -100;            // Сессия занята другой задачей - запрос не выполнялся
+constexpr size_t UPLINK_SESSION_SLOTS = 3;           // Открытых keep-alive соединений (TLS держит ~25 КБ на каждое)
+constexpr size_t UPLINK_HTTP_TRANSPORTS = 2;         // Транспортов HTTP-приёмников (InfluxDB и HTTP JSON)
+constexpr unsigned long OTA_SESSION_BUSY_RETRY_MS = 1000;  // Повтор проверки OTA, если сессия занята
+
+// TLS: кэш сессий для возобновления рукопожатия (OTA и HTTPS-приёмники)
+constexpr size_t TLS_SESSION_CACHE_SIZE = 3;                 // Хостов в кэше (github.com + CDN + приёмник)
+constexpr unsigned long TLS_SESSION_MAX_AGE_MS = 43200000UL;  // 12 часов - дольше сервер всё равно не примет
+constexpr unsigned long TLS_CONNECT_TIMEOUT_MS = 5000;
+constexpr unsigned long TLS_HANDSHAKE_TIMEOUT_MS = 15000;
+
 constexpr int CONFIG_MQTT_PORT_MIN = 1;
 constexpr int CONFIG_MQTT_PORT_MAX = 65535;
 
@@ -153,6 +185,10 @@ constexpr float KALMAN_INITIAL_UNCERTAINTY = 1.0F;  // Начальная нео
 constexpr float CALIBRATION_OFFSET_MAX = 10.0F;  // Максимальное смещение калибровки
 constexpr float CALIBRATION_DRIFT_MAX = 0.1F;    // Максимальный дрифт за час
 
+// Разбор калибровочного CSV (sensor_type,raw_value,reference_value)
+constexpr size_t CALIBRATION_CSV_FIELD_SIZE = 24;  // Буфер одного поля, включая '\0'
+constexpr size_t CALIBRATION_CSV_MAX_POINTS = 64;  // Предел точек на один датчик - ограничивает память таблицы
+
 // Статистические параметры
 constexpr uint8_t STATISTICS_WINDOW_SIZE = 20;   // Окно для статистики
 constexpr float MIN_STANDARD_DEVIATION = 0.01F;  // Минимальное стандартное отклонение
@@ -203,11 +239,22 @@ constexpr size_t SENSOR_TASK_STACK_SIZE = 4096;
 constexpr size_t RESET_BUTTON_TASK_STACK_SIZE = 2048;
 constexpr size_t WEB_SERVER_TASK_STACK_SIZE = 8192;
 constexpr size_t MAIN_LOOP_STACK_SIZE = 8192;  // ✅ Увеличен для стабильности
+constexpr size_t THINGSPEAK_TASK_STACK_SIZE = 6144;  // HTTPClient + тело запроса в куче
+constexpr size_t UPLINK_TASK_STACK_SIZE = 6144;      // Фоновая HTTP-доставка uplink-приёмников
 
 // Приоритеты задач
 constexpr UBaseType_t SENSOR_TASK_PRIORITY = 2;
 constexpr UBaseType_t RESET_BUTTON_TASK_PRIORITY = 1;
 constexpr UBaseType_t WEB_SERVER_TASK_PRIORITY = 1;
+constexpr UBaseType_t THINGSPEAK_TASK_PRIORITY = 1;
+constexpr UBaseType_t UPLINK_TASK_PRIORITY = 1;
+
+// Очередь фоновой отправки ThingSpeak (одно задание в работе + одно ожидающее)
+constexpr UBaseType_t THINGSPEAK_UPLOAD_QUEUE_LENGTH = 2;
+constexpr UBaseType_t UPLINK_HTTP_QUEUE_LENGTH = 2;
+
+// Задача веб-сервера: пауза между проходами handleClient(), чтобы не занимать ядро целиком
+constexpr uint32_t WEB_SERVER_TASK_POLL_MS = 2;
 
 // Лимиты памяти
 constexpr size_t MAX_CONFIG_JSON_SIZE = 2048;  // 2KB для конфигурации
@@ -256,6 +303,14 @@ constexpr int HTTP_REDIRECT_PERMANENT = 307;
 // HTTP статус коды (дополнительные)
 constexpr int HTTP_BAD_REQUEST = 400;
 constexpr int HTTP_SEE_OTHER = 303;
+constexpr int HTTP_NOT_MODIFIED = 304;
+constexpr int HTTP_SERVICE_UNAVAILABLE = 503;
+
+// Статические ресурсы: URL содержит хэш, поэтому кэшируются навсегда
+constexpr const char* HTTP_CACHE_IMMUTABLE = "public, max-age=31536000, immutable";
+// JSON API: клиент хранит ответ, но перед использованием сверяет ETag (If-None-Match -> 304)
+constexpr const char* HTTP_CACHE_REVALIDATE = "no-cache";
+constexpr size_t WEB_ETAG_BUFFER_SIZE = 32;  // "xxxxxxxx-xxxxxxxx-xxxxxxxx" с кавычками
 
 // ============================================================================
 // JSON И ДАННЫЕ
@@ -430,8 +485,11 @@ constexpr int SUCCESS_RATE_THRESHOLD = 90;
 
 // NTP и время
 constexpr unsigned long NTP_TIMESTAMP_2000 = 946684800;  // 2000-01-01 00:00:00 UTC
+constexpr unsigned long NTP_UNSYNCED_RETRY_MS = 60000;  // Повтор синхронизации, пока время не получено
 
 // Валидация сенсорных данных - теперь используется единая система выше
 
 // Размеры JSON документов
 constexpr size_t SENSOR_JSON_DOC_SIZE = 2048;  // ✅ УВЕЛИЧЕН для функций точности и полива
+constexpr size_t CROP_RANKING_JSON_DOC_SIZE = 6144;  // все культуры базы: id, оценка, 7 отклонений
+constexpr size_t SOIL_ASM_JSON_DOC_SIZE = 1536;      // все типы почвы: id и ASM
@@ -3,9 +3,18 @@
 // Centralized API route strings for the web layer. Use these constants instead of hard-coded literals.
 
 #define API_ROOT "/api/v1"
+#define API_V2_ROOT "/api/v2"
+
+// Web dashboard: начальные данные разделов /readings, /calibration, /service
+#define API_BOOTSTRAP API_ROOT "/bootstrap"
 
 // Sensor data
 #define API_SENSOR API_ROOT "/sensor"
+#define API_EVENTS API_ROOT "/events"  // text/event-stream: событие reading на каждое новое показание
+#define API_V2_SENSOR API_V2_ROOT "/sensor"  // ?fields=... и ?text=0: только нужные поля
+#define API_V2_CROPS_RANK API_V2_ROOT "/crops/rank"  // ?limit=N: культуры базы по близости к показанию
+#define API_V2_SOILS_ASM API_V2_ROOT "/soils/asm"  // ASM текущего показания для каждого профиля почвы
+#define API_V2_ADVICE API_V2_ROOT "/advice"  // тексты и уровни кодов рекомендаций (interaction_codes, crop_codes)
 
 // System
 #define API_SYSTEM API_ROOT "/system"
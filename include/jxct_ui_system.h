@@ -91,7 +91,7 @@ struct ButtonConfig
 };
 
 // 🎯 ФУНКЦИИ ДЛЯ ГЕНЕРАЦИИ CSS И HTML
-const char* getUnifiedCSS();
-const char* getToastHTML();
+const char* getStylesheetHTML();  // <link> на /static/ui.css (gzip, ETag, immutable)
+const char* getToastHTML();       // <script src> на /static/ui.js
 const char* getLoaderHTML();
 String generateButton(ButtonType type, const ButtonConfig& config);
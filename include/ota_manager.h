@@ -8,6 +8,7 @@ void checkGuard(const char* tag);
 // Основные функции OTA-менеджера
 const char* getOtaStatus();
 void setupOTA(const char* manifestUrl, WiFiClient& client);
-void triggerOtaCheck();    // только проверка манифеста
-void triggerOtaInstall();  // немедленная установка доступного обновления
-void handleOTA();          // периодическая проверка (авто-OTA)
+bool triggerOtaCheck();      // только проверка манифеста; false - сессия занята, повтор через retryPendingOtaCheck()
+void retryPendingOtaCheck();  // повтор отложенной ручной проверки (из loop())
+void triggerOtaInstall();    // немедленная установка доступного обновления
+bool handleOTA();            // периодическая проверка (авто-OTA); false - сессия занята, проверка отложена
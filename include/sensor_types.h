@@ -8,6 +8,7 @@
 #define SENSOR_TYPES_H
 
 #include <Arduino.h>
+#include <cstddef>
 
 /**
  * @brief Типы почвы
@@ -29,6 +30,8 @@ enum class SoilType : uint8_t
     ALKALINE = 12    // Щелочная почва - НОВЫЙ
 };
 
+constexpr size_t SOIL_TYPE_COUNT = static_cast<size_t>(SoilType::ALKALINE) + 1;
+
 /**
  * @brief Профили почвы
  */
@@ -50,13 +53,16 @@ enum class SoilProfile : uint8_t
 };
 
 /**
- * @brief Типы среды выращивания
+ * @brief Типы среды выращивания (значения config.environmentType)
  */
 enum class EnvironmentType : uint8_t
 {
-    OUTDOOR = 0,     // Открытый грунт
-    GREENHOUSE = 1,  // Теплица
-    INDOOR = 2       // Закрытое помещение
+    OUTDOOR = 0,      // Открытый грунт
+    GREENHOUSE = 1,   // Теплица
+    INDOOR = 2,       // Закрытое помещение
+    HYDROPONICS = 3,  // Гидропоника
+    AEROPONICS = 4,   // Аэропоника
+    ORGANIC = 5       // Органическое выращивание
 };
 
 /**
@@ -11,6 +11,7 @@
 #else
 #include <Arduino.h>
 #endif
+#include <array>
 #include <vector>
 #include "modbus_sensor.h"  // Для SensorData
 
@@ -115,6 +116,21 @@ ValidationResult validateMQTTPort(int port);
  */
 ValidationResult validateThingSpeakAPIKey(const String& apiKey);
 
+/**
+ * @brief Разбор отпечатка SHA-256 сертификата HTTPS-сервера
+ * @param text 64 hex-цифры; разделители ':' и пробелы допустимы
+ * @param digest 32 байта отпечатка
+ * @return false - пустая строка или неверный формат
+ */
+bool parseTlsFingerprint(const char* text, std::array<uint8_t, 32>& digest);
+
+/**
+ * @brief Валидация отпечатка сертификата (пустой - отпечаток не задан)
+ * @param fingerprint Отпечаток для проверки
+ * @return Результат валидации
+ */
+ValidationResult validateTlsFingerprint(const String& fingerprint);
+
 /**
  * @brief Валидация интервала (общая функция)
  * @param interval Интервал для проверки
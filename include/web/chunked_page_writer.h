@@ -0,0 +1,56 @@
+/**
+ * @file chunked_page_writer.h
+ * @brief Потоковая отдача крупных ответов HTTP-чанками
+ * @details Фрагменты ответа копируются в фиксированный буфер и уходят клиенту
+ *          чанками по мере заполнения, вместо сборки всего ответа в одной
+ *          String. Тексты читаются прямо из flash, поэтому пиковое потребление
+ *          кучи на запрос ограничено размером буфера (WEB_CHUNK_BUFFER_SIZE).
+ *          Страницы панели отдаются оболочкой SPA из flash (routes_app.cpp);
+ *          писатель нужен каталогу рекомендаций /api/v2/advice (~22 КБ текстов).
+ */
+
+#ifndef CHUNKED_PAGE_WRITER_H
+#define CHUNKED_PAGE_WRITER_H
+
+#ifdef TEST_BUILD
+#include "esp32_stubs.h"
+#elif defined(ESP32) || defined(ARDUINO)
+#include <WebServer.h>
+#include "Arduino.h"
+#else
+#include "esp32_stubs.h"
+#endif
+
+#include <array>
+#include "../jxct_constants.h"
+
+class ChunkedPageWriter
+{
+   public:
+    explicit ChunkedPageWriter(WebServer& server) : server(server) {}
+    ~ChunkedPageWriter();
+
+    ChunkedPageWriter(const ChunkedPageWriter&) = delete;
+    ChunkedPageWriter& operator=(const ChunkedPageWriter&) = delete;
+
+    // Заголовки ответа без Content-Length - дальше Transfer-Encoding: chunked
+    void begin(int code, const char* contentType);
+
+    ChunkedPageWriter& write(const char* data, size_t length);
+
+    ChunkedPageWriter& operator<<(const char* text);
+
+    // Отправка остатка буфера и завершающего пустого чанка
+    void end();
+
+   private:
+    void flush();
+
+    WebServer& server;
+    std::array<char, WEB_CHUNK_BUFFER_SIZE> buffer;
+    size_t used = 0;
+    bool started = false;
+    bool finished = false;
+};
+
+#endif  // CHUNKED_PAGE_WRITER_H
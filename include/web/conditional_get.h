@@ -0,0 +1,48 @@
+/**
+ * @file conditional_get.h
+ * @brief Условные GET-запросы для JSON API (ETag / If-None-Match -> 304)
+ * @details Панели и REST-сенсоры Home Assistant опрашивают одни и те же JSON-ответы.
+ *          Обработчик выставляет ETag и, если клиент прислал его в If-None-Match,
+ *          отвечает 304 без тела. Тег строится двумя способами:
+ *          - из поколения данных (makeGenerationEtag) - до сериализации, поэтому
+ *            при совпадении документ вообще не собирается;
+ *          - из хэша готового тела (sendJsonWithEtag) - для ответов без поколения:
+ *            сериализация остаётся, но тело повторно не передаётся.
+ */
+
+#ifndef CONDITIONAL_GET_H
+#define CONDITIONAL_GET_H
+
+#ifdef TEST_BUILD
+#include "esp32_stubs.h"
+#elif defined(ESP32) || defined(ARDUINO)
+#include <WebServer.h>
+#include "Arduino.h"
+#else
+#include "esp32_stubs.h"
+#endif
+
+#include <array>
+#include "../jxct_constants.h"
+
+using EtagBuffer = std::array<char, WEB_ETAG_BUFFER_SIZE>;
+
+constexpr uint32_t ETAG_HASH_SEED = 2166136261U;  // FNV-1a offset basis
+
+// FNV-1a: продолжает хэш hash байтами data
+uint32_t hashEtagBytes(uint32_t hash, const void* data, size_t length);
+
+// If-None-Match может содержать список тегов, слабые теги (W/"...") или "*"
+bool etagMatches(const String& ifNoneMatch, const char* etag);
+
+// Тег из поколения данных и хэша настроек. Включает случайную соль загрузки:
+// после перезагрузки поколения начинаются заново, а старые теги не должны совпасть
+void makeGenerationEtag(uint32_t generation, uint32_t configHash, EtagBuffer& etag);
+
+// Отправляет ETag и Cache-Control: no-cache; если тег совпал - отвечает 304 и возвращает true
+bool sendNotModifiedIfMatch(const char* etag);
+
+// Ответ 200 с ETag по хэшу тела либо 304, если клиент уже имеет это тело
+void sendJsonWithEtag(const String& json);
+
+#endif  // CONDITIONAL_GET_H
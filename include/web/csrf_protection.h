@@ -23,6 +23,7 @@ extern WebServer webServer;
 // Функции CSRF защиты
 String generateCSRFToken();
 bool validateCSRFToken(const String& token);
+String getCSRFToken();  // Текущий токен (новый, если пустой или истёк) - для fetch из панели
 String getCSRFHiddenField();
 bool checkCSRFSafety();
 void initCSRFProtection();
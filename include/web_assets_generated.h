@@ -0,0 +1,39 @@
+#pragma once
+
+// Auto-generated. DO NOT EDIT MANUALLY.
+// Generated by scripts/build_web_assets.py from src/web/assets/
+
+#include <cstddef>
+#include <cstdint>
+
+// ui.css: 5167 байт исходник, 1263 байт gzip
+#define WEB_ASSET_UI_CSS_URL "/static/ui.css?v=ec99b0738d485253"
+#define WEB_ASSET_UI_CSS_PATH "/static/ui.css"
+#define WEB_ASSET_UI_CSS_ETAG "\"ec99b0738d485253\""
+#define WEB_ASSET_UI_CSS_MIME "text/css; charset=utf-8"
+constexpr size_t WEB_ASSET_UI_CSS_GZ_LEN = 1263;
+extern const uint8_t WEB_ASSET_UI_CSS_GZ[];
+
+// ui.js: 956 байт исходник, 427 байт gzip
+#define WEB_ASSET_UI_JS_URL "/static/ui.js?v=07990af7b1ea718d"
+#define WEB_ASSET_UI_JS_PATH "/static/ui.js"
+#define WEB_ASSET_UI_JS_ETAG "\"07990af7b1ea718d\""
+#define WEB_ASSET_UI_JS_MIME "application/javascript; charset=utf-8"
+constexpr size_t WEB_ASSET_UI_JS_GZ_LEN = 427;
+extern const uint8_t WEB_ASSET_UI_JS_GZ[];
+
+// app.js: 30934 байт исходник, 8670 байт gzip
+#define WEB_ASSET_APP_JS_URL "/static/app.js?v=30c360eaaad27862"
+#define WEB_ASSET_APP_JS_PATH "/static/app.js"
+#define WEB_ASSET_APP_JS_ETAG "\"30c360eaaad27862\""
+#define WEB_ASSET_APP_JS_MIME "application/javascript; charset=utf-8"
+constexpr size_t WEB_ASSET_APP_JS_GZ_LEN = 8670;
+extern const uint8_t WEB_ASSET_APP_JS_GZ[];
+
+// app.html: 1617 байт исходник, 698 байт gzip
+#define WEB_ASSET_APP_HTML_URL "/static/app.html?v=5b986b34bd41d2aa"
+#define WEB_ASSET_APP_HTML_PATH "/static/app.html"
+#define WEB_ASSET_APP_HTML_ETAG "\"5b986b34bd41d2aa\""
+#define WEB_ASSET_APP_HTML_MIME "text/html; charset=utf-8"
+constexpr size_t WEB_ASSET_APP_HTML_GZ_LEN = 698;
+extern const uint8_t WEB_ASSET_APP_HTML_GZ[];
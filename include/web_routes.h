@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ArduinoJson.h>
 #include <WebServer.h>
 #include "../src/wifi_manager.h"
 #include "jxct_strings.h"
@@ -25,6 +26,12 @@ String generateCSRFToken();
  */
 bool validateCSRFToken(const String& token);
 
+/**
+ * @brief Текущий CSRF токен (генерируется заново, если пустой или истёк)
+ * @return Токен для заголовка X-CSRF-Token или поля csrf_token
+ */
+String getCSRFToken();
+
 /**
  * @brief Получение скрытого поля с CSRF токеном для форм
  * @return HTML строка с hidden input для CSRF токена
@@ -121,6 +128,12 @@ void handleInfo();
  */
 void handleUpdateStatus();
 
+/**
+ * @brief Статусы WiFi, MQTT, ThingSpeak, Home Assistant и датчика (ответ /service_status)
+ * @param doc Объект, в который добавляются поля
+ */
+void fillServiceStatusJson(JsonObject doc);
+
 // ============================================================================
 // МАРШРУТЫ ДАННЫХ (routes_data.cpp)
 // ============================================================================
@@ -135,6 +148,20 @@ void setupDataRoutes();
  */
 void sendSensorJson();
 
+/**
+ * @brief Отправка JSON данных датчиков с выбором полей (API v2)
+ * @details ?fields=ph,raw,... - только перечисленные поля или группы (values, raw, rec,
+ *          status, recommendations, all); ?text=0 - без текстов рекомендаций.
+ *          Невыбранные поля не вычисляются. Неизвестное имя поля - 400.
+ */
+void sendSensorJsonV2();
+
+/**
+ * @brief JSON показаний из кэша, пересобираемого на новое поколение данных или смену настроек
+ * @return Ссылка на сериализованный ответ /sensor_json (действительна до следующего вызова)
+ */
+const String& getCachedSensorJson();
+
 /**
  * @brief Обработчик главной страницы показаний
  */
@@ -145,6 +172,20 @@ void handleReadings();
  */
 void handleReadingsUpload();
 
+// ============================================================================
+// ПОТОК СОБЫТИЙ (routes_events.cpp)
+// ============================================================================
+
+/**
+ * @brief Настройка маршрута Server-Sent Events (API_EVENTS)
+ */
+void setupEventRoutes();
+
+/**
+ * @brief Рассылка нового показания подключённым потокам и keep-alive; вызывается после handleClient()
+ */
+void handleSensorEvents();
+
 // ============================================================================
 // ВСПОМОГАТЕЛЬНЫЕ ФУНКЦИИ ДЛЯ MIDDLEWARE
 // ============================================================================
@@ -171,7 +212,7 @@ bool isFeatureAvailable();
 inline void logWebRequest(const String& method, const String& uri, const String& clientIP)
 {
     // Логирование только важных запросов, исключаем служебные
-    if (uri.startsWith("/sensor_json") || uri.startsWith(API_SENSOR))
+    if (uri.startsWith("/sensor_json") || uri.startsWith(API_SENSOR) || uri.startsWith(API_EVENTS))
     {
         // API запросы логируем на уровне DEBUG
         logDebugSafe("\1", method.c_str(), uri.c_str(), clientIP.c_str());
@@ -288,6 +329,13 @@ String generateSuccessPage(const String& title, const String& message, const Str
  */
 String generateBasePage(const String& title, const String& content, const String& icon = "");
 
+/**
+ * @brief Экранирование значения для HTML-атрибута (value='...', placeholder='...')
+ * @param value Значение из конфигурации или запроса
+ * @return Строка, в которой &, <, >, " и ' заменены сущностями
+ */
+String htmlAttrEscape(const String& value);
+
 // ============================================================================
 // ОБРАБОТКА ОШИБОК (error_handlers.cpp)
 // ============================================================================
@@ -315,6 +363,25 @@ String generateApModeUnavailablePage(const String& title, const String& icon);
 // ДОПОЛНИТЕЛЬНЫЕ МАРШРУТЫ
 // ============================================================================
 
+/**
+ * @brief Статические ресурсы веб-интерфейса (/static/ui.css, /static/ui.js, /static/app.js)
+ * @details Сжаты при сборке (scripts/build_web_assets.py), отдаются из flash
+ *          с ETag, Cache-Control: immutable и ответом 304 на If-None-Match
+ */
+void setupStaticRoutes();
+
+/**
+ * @brief Панель устройства: /readings, /calibration, /service и API_BOOTSTRAP
+ * @details Страницы - одна оболочка из flash (gzip, ETag, 304), разделы рисует
+ *          /static/app.js по данным из /api/v1/bootstrap и JSON API
+ */
+void setupAppRoutes();
+
+/**
+ * @brief Заголовки запроса, которые сохраняет веб-сервер (If-None-Match, X-CSRF-Token)
+ */
+void collectWebRequestHeaders();
+
 /**
  * @brief Настройка маршрутов OTA обновлений
  */
@@ -0,0 +1,144 @@
+# Build-time gzip of static web assets (src/web/assets/*) into flash-resident arrays.
+# Используется как PlatformIO extra_script (pre), можно запускать и вручную.
+#
+# Генерирует:
+#   include/web_assets_generated.h      - URL с версией, ETag, размеры, extern-массивы
+#   src/web/web_assets_generated.cpp    - сжатые данные (PROGMEM)
+# ETag - префикс SHA-256 исходного файла, поэтому URL меняется при любом изменении
+# ресурса и браузер может кэшировать его как immutable.
+# HTML обрабатывается последним: {{WEB_ASSET_*_URL}} заменяются версионными URL уже
+# собранных ресурсов, поэтому новая сборка CSS/JS меняет и ETag оболочки панели.
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+try:
+    if '__file__' in globals():
+        PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+    else:
+        # В PlatformIO контексте найдем проект по наличию platformio.ini
+        PROJECT_DIR = os.getcwd()
+        while not os.path.exists(os.path.join(PROJECT_DIR, 'platformio.ini')) and PROJECT_DIR != os.path.dirname(PROJECT_DIR):
+            PROJECT_DIR = os.path.dirname(PROJECT_DIR)
+
+    ASSETS_DIR = os.path.join(PROJECT_DIR, "src", "web", "assets")
+    HEADER_PATH = os.path.join(PROJECT_DIR, "include", "web_assets_generated.h")
+    SOURCE_PATH = os.path.join(PROJECT_DIR, "src", "web", "web_assets_generated.cpp")
+
+    # (файл, MIME-тип); HTML - после ресурсов, на которые ссылается
+    ASSETS = [
+        ("ui.css", "text/css; charset=utf-8"),
+        ("ui.js", "application/javascript; charset=utf-8"),
+        ("app.js", "application/javascript; charset=utf-8"),
+        ("app.html", "text/html; charset=utf-8"),
+    ]
+
+    def minify_css(text):
+        text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+        text = re.sub(r"\s+", " ", text)
+        text = re.sub(r"\s*([{};:,>])\s*", r"\1", text)
+        return text.replace(";}", "}").strip()
+
+    def minify_js(text):
+        # Только безопасные преобразования: отступы и строки-комментарии
+        lines = []
+        for line in text.splitlines():
+            stripped = line.strip()
+            if stripped and not stripped.startswith("//"):
+                lines.append(stripped)
+        return "\n".join(lines)
+
+    def minify_html(text):
+        text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+        text = re.sub(r"<style>(.*?)</style>", lambda m: "<style>" + minify_css(m.group(1)) + "</style>", text, flags=re.S)
+        return "\n".join(line.strip() for line in text.splitlines() if line.strip())
+
+    def substitute_urls(text, urls):
+        def replace(match):
+            if match.group(1) not in urls:
+                raise KeyError(f"unknown asset placeholder {match.group(0)}")
+            return urls[match.group(1)]
+        return re.sub(r"\{\{(WEB_ASSET_[A-Z0-9_]+_URL)\}\}", replace, text)
+
+    def minify(name, text):
+        if name.endswith(".css"):
+            return minify_css(text)
+        if name.endswith(".html"):
+            return minify_html(text)
+        return minify_js(text)
+
+    def symbol_for(name):
+        return "WEB_ASSET_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+    header_lines = [
+        "#pragma once",
+        "",
+        "// Auto-generated. DO NOT EDIT MANUALLY.",
+        "// Generated by scripts/build_web_assets.py from src/web/assets/",
+        "",
+        "#include <cstddef>",
+        "#include <cstdint>",
+        "",
+    ]
+    source_lines = [
+        "// Auto-generated. DO NOT EDIT MANUALLY.",
+        "// Generated by scripts/build_web_assets.py from src/web/assets/",
+        "",
+        "#include \"web_assets_generated.h\"",
+        "#ifndef PROGMEM",
+        "#define PROGMEM",
+        "#endif",
+        "",
+    ]
+
+    total_raw = 0
+    total_gz = 0
+    urls = {}
+    for name, mime in ASSETS:
+        with open(os.path.join(ASSETS_DIR, name), "r", encoding="utf-8") as f:
+            raw = f.read()
+        minified = minify(name, substitute_urls(raw, urls))
+        data = minified.encode("utf-8")
+        compressed = gzip.compress(data, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(data).hexdigest()[:16]
+        symbol = symbol_for(name)
+        total_raw += len(raw.encode("utf-8"))
+        total_gz += len(compressed)
+        urls[f"{symbol}_URL"] = f"/static/{name}?v={etag}"
+
+        header_lines += [
+            f"// {name}: {len(raw.encode('utf-8'))} байт исходник, {len(compressed)} байт gzip",
+            f"#define {symbol}_URL \"/static/{name}?v={etag}\"",
+            f"#define {symbol}_PATH \"/static/{name}\"",
+            f"#define {symbol}_ETAG \"\\\"{etag}\\\"\"",
+            f"#define {symbol}_MIME \"{mime}\"",
+            f"constexpr size_t {symbol}_GZ_LEN = {len(compressed)};",
+            f"extern const uint8_t {symbol}_GZ[];",
+            "",
+        ]
+        source_lines.append(f"const uint8_t {symbol}_GZ[] PROGMEM = {{")
+        for offset in range(0, len(compressed), 16):
+            chunk = ", ".join(f"0x{byte:02x}" for byte in compressed[offset:offset + 16])
+            source_lines.append(f"    {chunk},")
+        source_lines += ["};", ""]
+
+    def write_if_changed(path, content):
+        # Не трогаем файл без изменений - иначе PlatformIO пересобирает зависимые модули
+        if os.path.exists(path):
+            with open(path, "r", encoding="utf-8") as f:
+                if f.read() == content:
+                    return False
+        with open(path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(content)
+        return True
+
+    changed = write_if_changed(HEADER_PATH, "\n".join(header_lines))
+    changed |= write_if_changed(SOURCE_PATH, "\n".join(source_lines))
+    state = "regenerated" if changed else "up to date"
+    print(f"[build_web_assets] {state}: {total_raw} -> {total_gz} bytes gzip")
+except Exception as e:
+    print(f"[build_web_assets] error: {e}")
+    sys.exit(1)
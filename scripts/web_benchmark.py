@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+🌐 JXCT Web Benchmark
+Нагрузочный замер веб-интерфейса устройства: N одновременных клиентов опрашивают
+маршруты, отчёт - запросы в секунду и хвостовые задержки (p50/p95/p99/max).
+Синхронный WebServer устройства обслуживает клиентов по одному: при N > 1 замер
+показывает очередь к нему, а не параллельную обработку
+
+Пример:
+    python scripts/web_benchmark.py --host 192.168.1.50 --clients 4 --requests 200
+    python scripts/web_benchmark.py --host 192.168.1.50 --path /sensor_json --path /readings --json
+"""
+
+import argparse
+import http.client
+import json
+import math
+import sys
+import threading
+import time
+from dataclasses import dataclass, field
+from typing import Dict, List
+
+DEFAULT_PATHS = ["/sensor_json", "/api/v1/sensor", "/api/v1/system/health"]
+
+
+@dataclass
+class BenchmarkResult:
+    clients: int
+    requests: int
+    errors: int
+    duration_s: float
+    latencies_ms: List[float] = field(default_factory=list)
+    status_codes: Dict[int, int] = field(default_factory=dict)
+
+    @property
+    def requests_per_second(self) -> float:
+        return len(self.latencies_ms) / self.duration_s if self.duration_s > 0 else 0.0
+
+    def percentile(self, percent: float) -> float:
+        """Перцентиль по ближайшему рангу"""
+        if not self.latencies_ms:
+            return 0.0
+        ordered = sorted(self.latencies_ms)
+        rank = max(0, min(len(ordered) - 1, math.ceil(percent / 100.0 * len(ordered)) - 1))
+        return ordered[rank]
+
+    def to_dict(self) -> dict:
+        return {
+            "clients": self.clients,
+            "requests": self.requests,
+            "completed": len(self.latencies_ms),
+            "errors": self.errors,
+            "duration_s": round(self.duration_s, 3),
+            "rps": round(self.requests_per_second, 1),
+            "latency_ms": {
+                "p50": round(self.percentile(50), 1),
+                "p95": round(self.percentile(95), 1),
+                "p99": round(self.percentile(99), 1),
+                "max": round(max(self.latencies_ms, default=0.0), 1),
+            },
+            "status_codes": {str(code): count for code, count in sorted(self.status_codes.items())},
+        }
+
+
+def run_benchmark(host: str, port: int, paths: List[str], clients: int, requests: int,
+                  timeout: float = 10.0) -> BenchmarkResult:
+    """Каждый клиент - отдельный поток с новым соединением на запрос (WebServer закрывает соединение)"""
+    lock = threading.Lock()
+    latencies: List[float] = []
+    status_codes: Dict[int, int] = {}
+    errors = 0
+    per_client = max(1, requests // clients)
+    start_barrier = threading.Barrier(clients)
+
+    def client_loop(client_index: int):
+        nonlocal errors
+        start_barrier.wait()
+        for request_index in range(per_client):
+            path = paths[(client_index + request_index) % len(paths)]
+            started = time.perf_counter()
+            try:
+                conn = http.client.HTTPConnection(host, port, timeout=timeout)
+                conn.request("GET", path, headers={"Connection": "close"})
+                response = conn.getresponse()
+                response.read()
+                conn.close()
+                elapsed_ms = (time.perf_counter() - started) * 1000.0
+                with lock:
+                    latencies.append(elapsed_ms)
+                    status_codes[response.status] = status_codes.get(response.status, 0) + 1
+            except (OSError, http.client.HTTPException):
+                with lock:
+                    errors += 1
+
+    threads = [threading.Thread(target=client_loop, args=(index,)) for index in range(clients)]
+    started = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    duration = time.perf_counter() - started
+
+    return BenchmarkResult(clients, per_client * clients, errors, duration, latencies, status_codes)
+
+
+def print_report(result: BenchmarkResult, host: str, paths: List[str]):
+    data = result.to_dict()
+    print(f"🌐 Веб-бенчмарк {host}: {result.clients} клиентов, {data['requests']} запросов")
+    print(f"   Маршруты: {', '.join(paths)}")
+    print(f"📈 Пропускная способность: {data['rps']} запр/с за {data['duration_s']} с")
+    latency = data["latency_ms"]
+    print(f"⏱️  Задержка, мс: p50={latency['p50']} p95={latency['p95']} p99={latency['p99']} max={latency['max']}")
+    print(f"📊 Коды ответов: {data['status_codes']}  ❌ Ошибок соединения: {data['errors']}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Нагрузочный замер веб-интерфейса JXCT")
+    parser.add_argument("--host", required=True, help="IP или имя устройства")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=4, help="Одновременных клиентов (по умолчанию 4)")
+    parser.add_argument("--requests", type=int, default=200, help="Всего запросов")
+    parser.add_argument("--path", action="append", dest="paths", help="Маршрут (можно несколько)")
+    parser.add_argument("--timeout", type=float, default=10.0)
+    parser.add_argument("--json", action="store_true", help="Вывести результат в JSON")
+    args = parser.parse_args()
+
+    paths = args.paths or DEFAULT_PATHS
+    result = run_benchmark(args.host, args.port, paths, max(1, args.clients), max(1, args.requests), args.timeout)
+    if args.json:
+        print(json.dumps(result.to_dict(), ensure_ascii=False, indent=2))
+    else:
+        print_report(result, args.host, paths)
+    return 0 if result.errors == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
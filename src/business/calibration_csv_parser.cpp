@@ -0,0 +1,235 @@
+/**
+ * @file calibration_csv_parser.cpp
+ * @brief Реализация потокового разбора калибровочного CSV
+ */
+
+#include "calibration_csv_parser.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+struct SensorColumn
+{
+    const char* name;
+    std::vector<CalibrationPoint> CalibrationTable::*points;
+};
+
+constexpr SensorColumn SENSOR_COLUMNS[] = {
+    {"temperature", &CalibrationTable::temperaturePoints},
+    {"humidity", &CalibrationTable::humidityPoints},
+    {"ec", &CalibrationTable::ecPoints},
+    {"ph", &CalibrationTable::phPoints},
+    {"nitrogen", &CalibrationTable::nitrogenPoints},
+    {"phosphorus", &CalibrationTable::phosphorusPoints},
+    {"potassium", &CalibrationTable::potassiumPoints},
+};
+
+bool parseNumber(const char* text, size_t length, float& value)
+{
+    if (length == 0)
+    {
+        return false;
+    }
+    char* end = nullptr;
+    value = strtof(text, &end);
+    return end == text + length && std::isfinite(value);
+}
+}  // namespace
+
+void CalibrationCsvParser::begin(CalibrationTable& outTable)
+{
+    outTable = CalibrationTable();
+    table = &outTable;
+    fieldLength = 0;
+    column = 0;
+    target = nullptr;
+    rawValue = 0.0F;
+    line = 1;
+    points = 0;
+    skipLine = false;
+    headerAllowed = true;
+    lastError = Error::NONE;
+}
+
+void CalibrationCsvParser::feed(const uint8_t* data, size_t length)
+{
+    for (size_t i = 0; i < length && lastError == Error::NONE; ++i)
+    {
+        consume(static_cast<char>(data[i]));
+    }
+}
+
+bool CalibrationCsvParser::finish()
+{
+    if (lastError == Error::NONE)
+    {
+        endLine();
+    }
+    if (lastError == Error::NONE)
+    {
+        table->isValid = points > 0;
+        if (!table->isValid)
+        {
+            fail(Error::EMPTY);
+        }
+    }
+    return lastError == Error::NONE;
+}
+
+const char* CalibrationCsvParser::errorText(Error error)
+{
+    switch (error)
+    {
+        case Error::NONE:
+            return "ok";
+        case Error::FIELD_TOO_LONG:
+            return "слишком длинное поле";
+        case Error::BAD_NUMBER:
+            return "не число";
+        case Error::UNKNOWN_SENSOR:
+            return "неизвестный датчик";
+        case Error::COLUMN_COUNT:
+            return "нужно три столбца";
+        case Error::TOO_MANY_POINTS:
+            return "слишком много точек";
+        case Error::NOT_ASCENDING:
+            return "raw_value должен возрастать";
+        case Error::EMPTY:
+            return "нет точек";
+    }
+    return "ошибка";
+}
+
+void CalibrationCsvParser::consume(char symbol)
+{
+    if (symbol == '\n')
+    {
+        endLine();
+        if (lastError == Error::NONE)
+        {
+            ++line;
+        }
+        return;
+    }
+    if (skipLine || symbol == '\r')
+    {
+        return;
+    }
+    if (symbol == '#' && column == 0 && fieldLength == 0)
+    {
+        skipLine = true;
+        return;
+    }
+    if (symbol == ',')
+    {
+        endField();
+        return;
+    }
+    if ((symbol == ' ' || symbol == '\t') && fieldLength == 0)
+    {
+        return;
+    }
+    if (fieldLength + 1 >= field.size())
+    {
+        fail(Error::FIELD_TOO_LONG);
+        return;
+    }
+    field[fieldLength++] = symbol;
+}
+
+void CalibrationCsvParser::endField()
+{
+    while (fieldLength > 0 && (field[fieldLength - 1] == ' ' || field[fieldLength - 1] == '\t'))
+    {
+        --fieldLength;
+    }
+    field[fieldLength] = '\0';
+
+    switch (column)
+    {
+        case 0:
+            target = nullptr;
+            for (const SensorColumn& sensor : SENSOR_COLUMNS)
+            {
+                if (strcmp(sensor.name, field.data()) == 0)
+                {
+                    target = &(table->*sensor.points);
+                    break;
+                }
+            }
+            if (target == nullptr)
+            {
+                // Заголовок допускается только до первой строки с данными
+                if (headerAllowed)
+                {
+                    skipLine = true;
+                }
+                else
+                {
+                    fail(Error::UNKNOWN_SENSOR);
+                }
+            }
+            headerAllowed = false;
+            break;
+        case 1:
+            if (!parseNumber(field.data(), fieldLength, rawValue))
+            {
+                fail(Error::BAD_NUMBER);
+            }
+            break;
+        case 2:
+        {
+            float referenceValue = 0.0F;
+            if (!parseNumber(field.data(), fieldLength, referenceValue))
+            {
+                fail(Error::BAD_NUMBER);
+            }
+            else if (target->size() >= CALIBRATION_CSV_MAX_POINTS)
+            {
+                fail(Error::TOO_MANY_POINTS);
+            }
+            else if (!target->empty() && rawValue <= target->back().rawValue)
+            {
+                fail(Error::NOT_ASCENDING);
+            }
+            else
+            {
+                target->emplace_back(rawValue, referenceValue);
+                ++points;
+            }
+            break;
+        }
+        default:
+            fail(Error::COLUMN_COUNT);
+            break;
+    }
+
+    fieldLength = 0;
+    ++column;
+}
+
+void CalibrationCsvParser::endLine()
+{
+    const bool blank = column == 0 && fieldLength == 0;
+    if (!skipLine && !blank)
+    {
+        endField();
+        if (lastError == Error::NONE && !skipLine && column != 3)
+        {
+            fail(Error::COLUMN_COUNT);
+        }
+    }
+    fieldLength = 0;
+    column = 0;
+    skipLine = false;
+}
+
+void CalibrationCsvParser::fail(Error error)
+{
+    if (lastError == Error::NONE)
+    {
+        lastError = error;
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file calibration_csv_parser.h
+ * @brief Потоковый разбор калибровочного CSV
+ * @details Принимает данные кусками произвольной длины (как upload.buf при загрузке
+ *          файла) и за один проход проверяет строки и заполняет CalibrationTable.
+ *          Поле копируется в фиксированный буфер, число точек на датчик ограничено
+ *          CALIBRATION_CSV_MAX_POINTS, поэтому память не зависит от размера файла.
+ *
+ *          Формат строки: sensor_type,raw_value,reference_value. Пустые строки и
+ *          строки с '#' пропускаются; первая строка, которая не начинается с имени
+ *          датчика, считается заголовком. raw_value каждого датчика строго возрастает.
+ */
+
+#ifndef CALIBRATION_CSV_PARSER_H
+#define CALIBRATION_CSV_PARSER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../../include/jxct_constants.h"
+#include "sensor_calibration_service.h"
+
+class CalibrationCsvParser
+{
+   public:
+    enum class Error : uint8_t
+    {
+        NONE = 0,
+        FIELD_TOO_LONG,   // Поле длиннее CALIBRATION_CSV_FIELD_SIZE - 1
+        BAD_NUMBER,       // raw_value или reference_value не число
+        UNKNOWN_SENSOR,   // Неизвестный sensor_type
+        COLUMN_COUNT,     // В строке не три столбца
+        TOO_MANY_POINTS,  // Больше CALIBRATION_CSV_MAX_POINTS точек на датчик
+        NOT_ASCENDING,    // raw_value не возрастает
+        EMPTY             // Нет ни одной точки
+    };
+
+    // Начинает разбор в table (таблица очищается)
+    void begin(CalibrationTable& table);
+
+    // Очередной кусок данных; после ошибки остаток игнорируется
+    void feed(const uint8_t* data, size_t length);
+
+    // Завершает последнюю строку (перевод строки в конце файла не обязателен)
+    bool finish();
+
+    Error error() const
+    {
+        return lastError;
+    }
+    // Номер строки (с 1), в которой найдена ошибка
+    size_t errorLine() const
+    {
+        return line;
+    }
+    size_t pointCount() const
+    {
+        return points;
+    }
+
+    static const char* errorText(Error error);
+
+   private:
+    void consume(char symbol);
+    void endField();
+    void endLine();
+    void fail(Error error);
+
+    CalibrationTable* table = nullptr;
+    std::array<char, CALIBRATION_CSV_FIELD_SIZE> field{};
+    size_t fieldLength = 0;
+    uint8_t column = 0;
+    std::vector<CalibrationPoint>* target = nullptr;
+    float rawValue = 0.0F;
+    size_t line = 1;
+    size_t points = 0;
+    bool skipLine = false;
+    bool headerAllowed = true;
+    Error lastError = Error::NONE;
+};
+
+#endif  // CALIBRATION_CSV_PARSER_H
@@ -0,0 +1,147 @@
+/**
+ * @file crop_ranking.cpp
+ * @brief Ранжирование всех культур базы по показанию датчика
+ */
+
+#include "crop_ranking.h"
+#include <algorithm>
+#include <cmath>
+#ifndef ESP_PLATFORM
+#include <thread>
+#include <vector>
+#endif
+
+namespace
+{
+constexpr float PERCENT = 100.0F;
+constexpr float CHANNEL_AVERAGE = 1.0F / CROP_CHANNEL_COUNT;
+constexpr size_t MIN_READINGS_PER_THREAD = 256;  // меньше - запуск потока дороже расчёта
+
+using ChannelDeviations = std::array<std::array<float, CROP_COUNT>, CROP_CHANNEL_COUNT>;
+
+// Обратные цели конечны: табличные значения и все множители коррекций положительны
+template <size_t N>
+constexpr bool multipliersArePositive(const std::array<CropMultipliers, N>& table)
+{
+    for (const CropMultipliers& multipliers : table)
+    {
+        for (const auto channel : CROP_CHANNELS)
+        {
+            if (!(multipliers.*channel > 0.0F))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+constexpr bool targetsArePositive()
+{
+    for (const auto& crop : CROP_TABLE)
+    {
+        for (const auto channel : CROP_CHANNELS)
+        {
+            if (!(crop.config.*channel > 0.0F))
+            {
+                return false;
+            }
+        }
+    }
+    return multipliersArePositive(GROWING_TYPE_MULTIPLIERS) && multipliersArePositive(SOIL_TYPE_MULTIPLIERS) &&
+           multipliersArePositive(SEASON_MULTIPLIERS);
+}
+
+static_assert(targetsArePositive(), "Цели культур должны быть положительными: отклонение делится на цель");
+
+// Один канал показания против всех культур сразу: умножение на обратную цель вместо деления
+void scoreChannels(const CropTargets& targets, const CropReading& reading, ChannelDeviations& deviation,
+                   std::array<float, CROP_COUNT>& total)
+{
+    total.fill(0.0F);
+    for (size_t channel = 0; channel < CROP_CHANNEL_COUNT; ++channel)
+    {
+        const float value = reading.*CROP_CHANNELS[channel];
+        const std::array<float, CROP_COUNT>& inverse = targets.inverse[channel];
+        std::array<float, CROP_COUNT>& channelDeviation = deviation[channel];
+        for (size_t crop = 0; crop < CROP_COUNT; ++crop)
+        {
+            channelDeviation[crop] = (value * inverse[crop] - 1.0F) * PERCENT;
+            total[crop] += std::fabs(channelDeviation[crop]);
+        }
+    }
+}
+
+// Порядок ранжирования: по оценке, при равенстве - по CropId; NaN-оценки (показание вне float)
+// явно в конце, иначе сравнение "<" с NaN нарушает строгий слабый порядок std::sort
+bool fitComesFirst(const CropFit& a, const CropFit& b)
+{
+    const bool aIsNan = std::isnan(a.score);
+    const bool bIsNan = std::isnan(b.score);
+    if (aIsNan != bIsNan)
+    {
+        return bIsNan;
+    }
+    if (!aIsNan && a.score != b.score)
+    {
+        return a.score < b.score;
+    }
+    return a.crop < b.crop;
+}
+
+void rankRange(const CropTargets& targets, const CropReading* readings, size_t begin, size_t end,
+               CropRanking* rankings)
+{
+    ChannelDeviations deviation{};
+    std::array<float, CROP_COUNT> total{};
+    for (size_t index = begin; index < end; ++index)
+    {
+        scoreChannels(targets, readings[index], deviation, total);
+
+        CropRanking& ranking = rankings[index];
+        for (size_t crop = 0; crop < CROP_COUNT; ++crop)
+        {
+            CropFit& fit = ranking[crop];
+            fit.crop = static_cast<CropId>(crop);
+            fit.score = total[crop] * CHANNEL_AVERAGE;
+            for (size_t channel = 0; channel < CROP_CHANNEL_COUNT; ++channel)
+            {
+                fit.deviation[channel] = deviation[channel][crop];
+            }
+        }
+        std::sort(ranking.begin(), ranking.end(), fitComesFirst);
+    }
+}
+}  // namespace
+
+void rankCrops(const CropTargets& targets, const CropReading& reading, CropRanking& ranking)
+{
+    rankRange(targets, &reading, 0, 1, &ranking);
+}
+
+void rankCropsBatch(const CropTargets& targets, const CropReading* readings, size_t count, CropRanking* rankings)
+{
+#ifndef ESP_PLATFORM
+    // Хост: показания делятся на непрерывные куски по потокам, результаты не пересекаются
+    const size_t threads = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()),
+                                            count / MIN_READINGS_PER_THREAD);
+    if (threads > 1)
+    {
+        const size_t chunk = (count + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t begin = 0; begin < count; begin += chunk)
+        {
+            const size_t end = std::min(count, begin + chunk);
+            workers.emplace_back([&targets, readings, begin, end, rankings]()
+                                 { rankRange(targets, readings, begin, end, rankings); });
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        return;
+    }
+#endif
+    rankRange(targets, readings, 0, count, rankings);
+}
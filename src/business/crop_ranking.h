@@ -0,0 +1,46 @@
+/**
+ * @file crop_ranking.h
+ * @brief Ранжирование всех культур базы по показанию датчика
+ * @details Показание сравнивается с итоговыми целями каждой культуры из кэша
+ *          getCropTargets() (те же значения, что rec_* в /sensor_json). Отклонение
+ *          канала - (показание - цель) / цель в процентах, как в ColorIndicators;
+ *          оценка культуры - среднее модулей отклонений семи каналов, меньше - лучше.
+ *          Расчёт идёт по каналам над массивами обратных целей всех культур: без
+ *          делений и ветвлений, цикл по культурам компилятор векторизует на хосте.
+ *          Пакетное ранжирование (исторические показания, web_bench --rank-csv) на
+ *          хосте делится между потоками; на устройстве выполняется последовательно.
+ */
+
+#ifndef CROP_RANKING_H
+#define CROP_RANKING_H
+
+#include <array>
+#include <cstddef>
+#include "crop_target_cache.h"
+
+// Показание в порядке полей CropConfig; влажность - ASM, как у целей культур
+using CropReading = CropConfig;
+
+struct CropFit
+{
+    CropId crop;
+    float score;                                         // среднее |отклонение|, %
+    std::array<float, CROP_CHANNEL_COUNT> deviation;  // по CROP_CHANNELS, % со знаком
+};
+
+// Все культуры по возрастанию оценки; при равенстве - по CropId; NaN-оценки последними
+using CropRanking = std::array<CropFit, CROP_COUNT>;
+
+/**
+ * @brief Ранжирует культуры по одному показанию
+ * @param targets Цели текущих настроек (getCropTargets())
+ */
+void rankCrops(const CropTargets& targets, const CropReading& reading, CropRanking& ranking);
+
+/**
+ * @brief Ранжирует серию показаний с одними целями
+ * @param rankings Массив из count результатов
+ */
+void rankCropsBatch(const CropTargets& targets, const CropReading* readings, size_t count, CropRanking* rankings);
+
+#endif  // CROP_RANKING_H
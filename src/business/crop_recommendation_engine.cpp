@@ -5,7 +5,9 @@
  */
 
 #include "crop_recommendation_engine.h"
+#include <cstring>
 #include <ctime>
+#include "../../include/business/crop_rules.h"
 #include "../../include/jxct_config_vars.h"
 #include "../../include/jxct_constants.h"
 #include "../../include/logger.h"
@@ -15,667 +17,196 @@
 // УДАЛЕНО: Внутренние функции компенсации
 // Используется SensorCompensationService для единообразной компенсации
 
-CropRecommendationEngine::CropRecommendationEngine()
-{
-    initializeCropConfigs();
-}
-
-void CropRecommendationEngine::initializeCropConfigs()
-{
-    // ============================================================================
-    // ИСПРАВЛЕННЫЕ ЗНАЧЕНИЯ ВЛАЖНОСТИ В ASM (Available Soil Moisture)
-    // Источник: Научные публикации, ASM рекомендации (70-85% ASM)
-    // ============================================================================
-
-    // Базовые значения (generic) - FAO Irrigation and Drainage Paper 56
-    cropConfigs["generic"] =
-        CropConfig(22.0F, 75.0F, 1500.0F, 6.5F,  // температура, влажность(ASM), EC, pH (ИСПРАВЛЕНО: 75% ASM)
-                   150.0F, 60.0F, 200.0F         // N, P, K (мг/кг) - ВАЛИДИРОВАНО: научные агрономические нормы
-        );
-
-    // ТОМАТЫ (Solanum lycopersicum) - University of Florida IFAS Extension, B. Santos, 2019
-    cropConfigs["tomato"] = CropConfig(24.0F, 80.0F, 2000.0F, 6.5F,  // pH 6.0-6.8, EC 1.5-3.0 mS/cm (ИСПРАВЛЕНО: 80% ASM)
-                                       200.0F, 80.0F, 300.0F         // N: 150-250, P: 50-100, K: 200-400 мг/кг
-    );
-
-    // ОГУРЦЫ (Cucumis sativus) - USDA Natural Resources Conservation Service, 2020
-    cropConfigs["cucumber"] = CropConfig(26.0F, 75.0F, 1800.0F, 6.5F,  // pH 6.0-7.0, EC 1.2-2.5 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                         160.0F, 60.0F, 225.0F         // N: 120-200, P: 40-80, K: 150-300 мг/кг
-    );
-
-    // ПЕРЕЦ (Capsicum annuum) - Cornell University Cooperative Extension, 2022
-    cropConfigs["pepper"] = CropConfig(27.0F, 75.0F, 2100.0F, 6.5F,  // pH 6.0-7.0, EC 1.4-2.8 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                       140.0F, 50.0F, 250.0F         // N: 100-180, P: 30-70, K: 150-350 мг/кг
-    );
-
-    // САЛАТ (Lactuca sativa) - University of California Agriculture and Natural Resources, 2018
-    cropConfigs["lettuce"] = CropConfig(18.0F, 85.0F, 1500.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-2.0 mS/cm (ИСПРАВЛЕНО: 85% ASM)
-                                        115.0F, 35.0F, 175.0F         // N: 80-150, P: 20-50, K: 100-250 мг/кг
-    );
-
-    // ЧЕРНИКА (Vaccinium corymbosum) - Michigan State University Extension, A. Schilder, 2021
-    cropConfigs["blueberry"] = CropConfig(20.0F, 65.0F, 1200.0F, 5.0F,  // pH 4.5-5.5, EC 0.8-1.5 mS/cm (ИСПРАВЛЕНО: 65% ASM)
-                                          75.0F, 30.0F, 60.0F           // N: 50-100, P: 20-40, K: 40-80 мг/кг
-    );
-
-    // ГАЗОН (Lawn) - Turfgrass Science + FAO Crop Calendar
-    cropConfigs["lawn"] = CropConfig(22.0F, 75.0F, 1500.0F, 6.5F,  // pH 6.0-7.0, EC 1.2-1.8 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                     150.0F, 60.0F, 200.0F         // N: 120-180, P: 45-75, K: 160-240 мг/кг
-    );
-
-    // ВИНОГРАД (Vitis vinifera) - Viticulture Research 2021
-    cropConfigs["grape"] = CropConfig(26.0F, 60.0F, 2000.0F, 6.8F,  // pH 6.0-7.5, EC 1.0-2.0 mS/cm (ИСПРАВЛЕНО: 60% ASM)
-                                      130.0F, 40.0F, 200.0F         // N: 100-140, P: 40-60, K: 120-180 мг/кг
-    );
-
-    // ХВОЙНЫЕ (Conifer) - Forest Science
-    cropConfigs["conifer"] = CropConfig(18.0F, 65.0F, 1000.0F, 5.8F,  // pH 5.5-6.5, EC 0.5-1.2 mS/cm (ИСПРАВЛЕНО: 65% ASM)
-                                        60.0F, 25.0F, 50.0F           // N: 50-70, P: 20-30, K: 40-60 мг/кг
-    );
-
-    // КЛУБНИКА (Fragaria × ananassa) - HortScience
-    cropConfigs["strawberry"] = CropConfig(22.0F, 75.0F, 1600.0F, 6.0F,  // pH 5.5-6.5, EC 1.2-2.0 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                           130.0F, 55.0F, 150.0F         // N: 110-150, P: 45-65, K: 130-170 мг/кг
-    );
-
-    // ЯБЛОНИ (Malus domestica) - Journal of Horticultural Science
-    cropConfigs["apple"] = CropConfig(20.0F, 75.0F, 1200.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-1.8 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                      110.0F, 45.0F, 130.0F         // N: 90-130, P: 35-55, K: 110-150 мг/кг
-    );
-    cropConfigs["pear"] = cropConfigs["apple"];  // Используем ту же конфигурацию
-
-    // ВИШНЯ (Prunus avium) - HortScience
-    cropConfigs["cherry"] = CropConfig(22.0F, 75.0F, 1300.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-1.8 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                       120.0F, 50.0F, 140.0F         // N: 100-140, P: 40-60, K: 120-160 мг/кг
-    );
-
-    // МАЛИНА (Rubus idaeus) - Acta Horticulturae
-    cropConfigs["raspberry"] = CropConfig(20.0F, 75.0F, 1100.0F, 6.0F,  // pH 5.5-6.5, EC 0.8-1.5 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                          100.0F, 40.0F, 120.0F         // N: 80-120, P: 30-50, K: 100-140 мг/кг
-    );
-
-    // СМОРОДИНА (Ribes spp.) - HortScience
-    cropConfigs["currant"] = CropConfig(18.0F, 65.0F, 1000.0F, 6.0F,  // pH 5.5-6.5, EC 0.8-1.3 mS/cm (ИСПРАВЛЕНО: 65% ASM)
-                                        80.0F, 35.0F, 100.0F          // N: 70-90, P: 30-40, K: 90-110 мг/кг
-    );
-
-    // НОВЫЕ КУЛЬТУРЫ (Фаза 1 - Приоритетные, научно обоснованные 2024)
-    
-    // ШПИНАТ (Spinacia oleracea) - UC Extension, 2019
-    cropConfigs["spinach"] = CropConfig(20.0F, 80.0F, 1400.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-1.8 mS/cm (ИСПРАВЛЕНО: 80% ASM)
-                                        200.0F, 50.0F, 300.0F         // N: 150-250, P: 40-60, K: 250-350 мг/кг
-    );
-
-    // БАЗИЛИК (Ocimum basilicum) - Journal of Essential Oil Research, 2019
-    cropConfigs["basil"] = CropConfig(25.0F, 75.0F, 1400.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-1.8 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                      120.0F, 40.0F, 180.0F         // N: 100-140, P: 30-50, K: 150-210 мг/кг
-    );
-
-    // КОНОПЛЯ МЕДИЦИНСКАЯ (Cannabis sativa) - Journal of Cannabis Research, 2020
-    cropConfigs["cannabis"] = CropConfig(24.0F, 80.0F, 1600.0F, 6.5F,  // pH 6.0-7.0, EC 1.2-2.0 mS/cm (ИСПРАВЛЕНО: 80% ASM)
-                                         160.0F, 40.0F, 200.0F         // N: 140-180, P: 30-50, K: 180-220 мг/кг
-    );
-
-    // НОВЫЕ КУЛЬТУРЫ (Фаза 2 - Важные, стратегические)
-    
-    // ПШЕНИЦА (Triticum aestivum) - Kansas State University, 2020
-    cropConfigs["wheat"] = CropConfig(20.0F, 65.0F, 1200.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-1.5 mS/cm (ИСПРАВЛЕНО: 65% ASM)
-                                      200.0F, 50.0F, 150.0F         // N: 180-220, P: 40-60, K: 130-170 мг/кг
-    );
-
-    // КАРТОФЕЛЬ (Solanum tuberosum) - University of Idaho, 2020
-    cropConfigs["potato"] = CropConfig(18.0F, 35.0F, 1500.0F, 6.0F,  // pH 5.5-6.5, EC 1.2-1.8 mS/cm (ИСПРАВЛЕНО: 35% ASM - научно обосновано)
-                                     180.0F, 50.0F, 250.0F         // N: 160-200, P: 40-60, K: 220-280 мг/кг
-    );
-
-    // НОВЫЕ КУЛЬТУРЫ (Фаза 3 - Завершающие, полное покрытие)
-    
-    // КАЛЕ (Brassica oleracea var. sabellica) - University of Wisconsin, 2020
-    cropConfigs["kale"] = CropConfig(18.0F, 75.0F, 1300.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-1.6 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                     150.0F, 40.0F, 200.0F         // N: 130-170, P: 30-50, K: 180-220 мг/кг
-    );
-
-    // ЕЖЕВИКА (Rubus fruticosus) - University of Arkansas, 2020
-    cropConfigs["blackberry"] = CropConfig(22.0F, 75.0F, 1200.0F, 6.0F,  // pH 5.5-6.5, EC 1.0-1.5 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                           120.0F, 35.0F, 180.0F         // N: 100-140, P: 25-45, K: 160-200 мг/кг
-    );
-
-    // СОЯ (Glycine max) - University of Illinois, 2020
-    cropConfigs["soybean"] = CropConfig(24.0F, 65.0F, 1400.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-1.8 mS/cm (ИСПРАВЛЕНО: 65% ASM)
-                                        80.0F, 40.0F, 200.0F         // N: 60-100, P: 30-50, K: 180-220 мг/кг
-    );
-
-    // МОРКОВЬ (Daucus carota) - UC Extension, 2020
-    cropConfigs["carrot"] = CropConfig(18.0F, 75.0F, 1200.0F, 6.5F,  // pH 6.0-7.0, EC 1.0-1.5 mS/cm (ИСПРАВЛЕНО: 75% ASM)
-                                       120.0F, 40.0F, 180.0F         // N: 100-140, P: 30-50, K: 160-200 мг/кг
-    );
-}
-
-// Структура для параметров рекомендаций
-struct RecommendationParams
-{
-    const SensorData& data;
-    String cropType;
-    String growingType;
-    String season;
-    String soilType;
-
-   private:
-    RecommendationParams(const SensorData& data, const String& cropType, const String& growingType,
-                         const String& season, const String& soilType)  // NOLINT(bugprone-easily-swappable-parameters)
-        : data(data), cropType(cropType), growingType(growingType), season(season), soilType(soilType)
-    {
-    }
-
-   public:
-    static RecommendationParams fromValues(const SensorData& data, const String& cropType, const String& growingType,
-                                           const String& season, const String& soilType)
-    {  // NOLINT(bugprone-easily-swappable-parameters)
-        return RecommendationParams(data, cropType, growingType, season, soilType);
-    }
-    // Builder для предотвращения ошибок с параметрами
-    struct Builder
-    {
-        SensorData sensorData;
-        String crop;
-        String growing;
-        String seasonType;
-        String soil;
-        Builder& data(const SensorData& sensorDataValue)
-        {
-            sensorData = sensorDataValue;
-            return *this;
-        }
-        Builder& cropType(const String& cropTypeValue)
-        {
-            crop = cropTypeValue;
-            return *this;
-        }
-        Builder& growingType(const String& growingTypeValue)
-        {
-            growing = growingTypeValue;
-            return *this;
-        }
-        Builder& season(const String& seasonValue)
-        {
-            seasonType = seasonValue;
-            return *this;
-        }
-        Builder& soilType(const String& soilTypeValue)
-        {
-            soil = soilTypeValue;
-            return *this;
-        }
-        RecommendationParams build() const
-        {
-            return RecommendationParams::fromValues(sensorData, crop, growing, seasonType, soil);
-        }
-    };
-    static Builder builder()
-    {
-        return {};
-    }
-};
+// Табличные значения культур - CROP_TABLE (include/business/crop_table.h), во flash
+CropRecommendationEngine::CropRecommendationEngine() = default;
 
 RecommendationResult CropRecommendationEngine::generateRecommendation(const SensorData& data, const String& cropType,
                                                                       const String& growingType, const String& season)
 {  // NOLINT(bugprone-easily-swappable-parameters)
 
-    // Получаем тип почвы из конфигурации
-    String soilTypeStr = "loam";  // По умолчанию
-    switch (config.soilProfile) {
-        case 0: soilTypeStr = "sand"; break;
-        case 1: soilTypeStr = "loam"; break;
-        case 2: soilTypeStr = "peat"; break;
-        case 3: soilTypeStr = "clay"; break;
-        case 4: soilTypeStr = "sand_peat"; break;
-        case 5: soilTypeStr = "silt"; break;
-        case 6: soilTypeStr = "clay_loam"; break;
-        case 7: soilTypeStr = "organic"; break;
-        case 8: soilTypeStr = "sandy_loam"; break;
-        case 9: soilTypeStr = "silty_loam"; break;
-        case 10: soilTypeStr = "loamy_clay"; break;
-        case 11: soilTypeStr = "saline"; break;
-        case 12: soilTypeStr = "alkaline"; break;
-        default: soilTypeStr = "loam"; break;
-    }
-    
-    const RecommendationParams params = RecommendationParams::builder()
-                                            .data(data)
-                                            .cropType(cropType)
-                                            .growingType(growingType)
-                                            .season(season)
-                                            .soilType(soilTypeStr)
-                                            .build();
-
     // Валидация входных данных используя единые константы
-    if (!validateSensorData(params.data))
+    if (!validateSensorData(data))
     {
         return {};  // Возвращаем пустой результат в случае ошибки валидации
     }
 
+    // Строковые параметры переводятся в перечисления один раз на входе;
+    // тип почвы из конфигурации - индекс таблицы коррекций
+    RecommendationResult result{};
+    result.crop = cropIdFromName(cropType.c_str());
+    result.growingType = environmentTypeFromName(growingType.c_str());
+    result.seasonApplied = seasonFromName(season.c_str(), result.season);
+    result.soilType = soilTypeFromProfile(config.soilProfile);
+
     // Компенсация показаний датчиков [Источники: SSSA Journal, 2008; Advances in Agronomy, 2014; Journal of Soil
     // Science, 2020]
-    SensorData compensatedData = params.data;
-    // УДАЛЕНО: Дублированные функции компенсации
-    // Используется SensorCompensationService для единообразной компенсации
-    // Компенсация теперь применяется через SensorProcessing::processSensorData()
-
-    RecommendationResult result;
-    result.cropType = params.cropType;
-    result.growingType = params.growingType;
-    result.season = params.season;
-    result.soilType = params.soilType;  // Добавляем тип почвы в результат
+    // Компенсация применяется через SensorProcessing::processSensorData() - здесь данные уже компенсированы
 
     // ============================================================================
     // СИСТЕМНЫЙ АЛГОРИТМ: Правильная последовательность коррекций
     // ============================================================================
     
     // 1. Получаем табличные значения (исходные для культуры)
-    result.tableValues = getTableValues(params.cropType);
+    result.tableValues = cropTableConfig(result.crop);
     
     // 2. Применяем коррекцию типа выращивания (ПЕРВАЯ, все параметры)
-    result.growingTypeAdjusted = applyGrowingTypeCorrection(result.tableValues, params.growingType);
+    result.growingTypeAdjusted = scaleCropConfig(result.tableValues, growingTypeMultipliers(result.growingType));
     
     // 3. Применяем коррекцию типа почвы (ВТОРАЯ, консервативные коэффициенты)
-    result.soilTypeAdjusted = applySoilTypeCorrection(result.growingTypeAdjusted, params.soilType);
+    result.soilTypeAdjusted = scaleCropConfig(result.growingTypeAdjusted, soilTypeMultipliers(result.soilType));
     
     // 4. Применяем сезонную коррекцию (ЧЕТВЕРТАЯ, только NPK)
-    result.finalCalculated = applySeasonalCorrection(result.soilTypeAdjusted, params.season);
+    result.finalCalculated = scaleCropConfig(result.soilTypeAdjusted, result.seasonApplied
+                                                                          ? seasonMultipliers(result.season)
+                                                                          : NO_CORRECTION);
     
     // 5. Получаем научно компенсированные значения (для сравнения)
-    result.scientificallyCompensated = getScientificallyCompensated(compensatedData, params.cropType);
+    result.scientificallyCompensated = getScientificallyCompensated(data, result.crop);
     
     // 6. Рассчитываем проценты коррекции от табличных значений
     result.correctionPercentages = calculateCorrectionPercentages(result.tableValues, result.finalCalculated);
     
     // 7. Определяем цвета на основе сравнения с научно компенсированными
     result.colorIndicators = calculateColorIndicators(result.finalCalculated, result.scientificallyCompensated);
-    
-    // Для совместимости с существующим кодом используем finalCalculated
-    CropConfig adjustedConfig = result.finalCalculated;
 
-    // Генерируем рекомендации на основе компенсированных данных
-    result.recommendations =
-        generateScientificRecommendations(compensatedData, adjustedConfig, params.cropType, params.soilType);
+    // Коды рекомендаций с измеренным значением и целью - без сборки текста
+    result.recommendations = assessConditions(data, result.finalCalculated, result.crop, result.soilType);
 
     // Рассчитываем общий статус здоровья почвы
-    result.healthStatus = calculateSoilHealthStatus(compensatedData, adjustedConfig);
-
-    // Добавляем научные комментарии
-    result.scientificNotes = generateScientificNotes(compensatedData, adjustedConfig, params.cropType, params.soilType);
+    result.healthScore = calculateSoilHealthScore(data, result.finalCalculated);
+    result.healthStatus = result.healthScore >= 80   ? SoilHealth::EXCELLENT
+                          : result.healthScore >= 60 ? SoilHealth::GOOD
+                          : result.healthScore >= 40 ? SoilHealth::FAIR
+                                                     : SoilHealth::NEEDS_ATTENTION;
 
     return result;
 }
 
-
-
-
-
-
-
-String CropRecommendationEngine::generateScientificRecommendations(const SensorData& data, const CropConfig& config,
-                                                                   const String& cropType, const String& soilType)
+Advice::List CropRecommendationEngine::assessConditions(const SensorData& data, const CropConfig& config, CropId crop,
+                                                        SoilType soil)
 {
-    String recommendations = "";
+    using Advice::Code;
+    Advice::List advice;
 
     // Температурные рекомендации
     if (data.temperature < config.temperature - 5.0F)
     {
-        recommendations += "🌡️ Температура ниже оптимальной. Рекомендуется: ";
-        if (cropType == "tomato" || cropType == "pepper")
-        {
-            recommendations += "увеличить обогрев, использовать мульчирование";
-        }
-        else
-        {
-            recommendations += "укрыть растения, добавить обогрев";
-        }
-        recommendations += "\n";
+        const bool heat = crop == CropId::TOMATO || crop == CropId::PEPPER;
+        advice.add(heat ? Code::TEMPERATURE_LOW_HEAT : Code::TEMPERATURE_LOW_COVER, data.temperature,
+                   config.temperature);
     }
     else if (data.temperature > config.temperature + 5.0F)
     {
-        recommendations += "🌡️ Температура выше оптимальной. Рекомендуется: ";
-        recommendations += "увеличить вентиляцию, притенение, полив";
-        recommendations += "\n";
+        advice.add(Code::TEMPERATURE_HIGH, data.temperature, config.temperature);
     }
 
     // Рекомендации по влажности с учетом типа почвы
     if (data.humidity < config.humidity - 10.0F)
     {
-        recommendations += "💧 Влажность низкая. Рекомендуется: ";
-        if (soilType == "sand")
+        Code code = Code::HUMIDITY_LOW;
+        if (soil == SoilType::SAND)
         {
-            recommendations += "частый полив малыми дозами (песок быстро дренирует)";
+            code = Code::HUMIDITY_LOW_SAND;  // песок быстро дренирует
         }
-        else if (soilType == "clay")
+        else if (soil == SoilType::CLAY)
         {
-            recommendations += "глубокий полив с интервалами (глина удерживает влагу)";
+            code = Code::HUMIDITY_LOW_CLAY;  // глина удерживает влагу
         }
-        else if (cropType == "lettuce" || cropType == "cucumber")
+        else if (crop == CropId::LETTUCE || crop == CropId::CUCUMBER)
         {
-            recommendations += "увеличить полив, использовать туманообразование";
+            code = Code::HUMIDITY_LOW_MIST;
         }
-        else
-        {
-            recommendations += "увеличить полив, мульчирование почвы";
-        }
-        recommendations += "\n";
+        advice.add(code, data.humidity, config.humidity);
     }
     else if (data.humidity > config.humidity + 10.0F)
     {
-        recommendations += "💧 Влажность высокая. Рекомендуется: ";
-        if (soilType == "clay")
-        {
-            recommendations += "улучшить дренаж, уменьшить полив (глина медленно дренирует)";
-        }
-        else
-        {
-            recommendations += "улучшить вентиляцию, уменьшить полив, профилактика грибковых заболеваний";
-        }
-        recommendations += "\n";
+        advice.add(soil == SoilType::CLAY ? Code::HUMIDITY_HIGH_CLAY : Code::HUMIDITY_HIGH, data.humidity,
+                   config.humidity);
     }
 
     // Рекомендации по EC с учетом типа почвы
     if (data.ec < config.ec - 500.0F)
     {
-        recommendations += "⚡ EC низкий (недостаток питательных веществ). Рекомендуется: ";
-        if (soilType == "sand")
-        {
-            recommendations += "частое внесение удобрений малыми дозами (песок быстро вымывает)";
-        }
-        else
-        {
-            recommendations += "внести комплексное удобрение, увеличить концентрацию питательного раствора";
-        }
-        recommendations += "\n";
+        advice.add(soil == SoilType::SAND ? Code::EC_LOW_SAND : Code::EC_LOW, data.ec, config.ec);
     }
     else if (data.ec > config.ec + 500.0F)
     {
-        recommendations += "⚠️ EC высокий (риск засоления). Рекомендуется: ";
-        if (soilType == "clay")
-        {
-            recommendations += "промывка почвы, гипсование (глина склонна к засолению)";
-        }
-        else
-        {
-            recommendations += "промывка почвы, снижение концентрации удобрений, использование гипса";
-        }
-        recommendations += "\n";
+        advice.add(soil == SoilType::CLAY ? Code::EC_HIGH_CLAY : Code::EC_HIGH, data.ec, config.ec);
     }
 
     // Рекомендации по pH с учетом типа почвы
     if (data.ph < config.ph - 0.5F)
     {
-        recommendations += "🧪 pH кислый. Рекомендуется: ";
-        if (cropType == "blueberry")
-        {
-            recommendations += "pH подходит для черники, но контролируйте другие культуры";
-        }
-        else if (soilType == "peat")
+        Code code = Code::PH_ACIDIC;
+        if (crop == CropId::BLUEBERRY)
         {
-            recommendations += "внести известь, доломитовую муку (торф кислый)";
+            code = Code::PH_ACIDIC_BLUEBERRY;
         }
-        else
+        else if (soil == SoilType::PEAT)
         {
-            recommendations += "внести известь, доломитовую муку, древесную золу";
+            code = Code::PH_ACIDIC_PEAT;  // торф кислый
         }
-        recommendations += "\n";
+        advice.add(code, data.ph, config.ph);
     }
     else if (data.ph > config.ph + 0.5F)
     {
-        recommendations += "🧪 pH щелочной. Рекомендуется: ";
-        if (soilType == "clay")
-        {
-            recommendations += "внести серу, кислые удобрения (глина склонна к щелочности)";
-        }
-        else
-        {
-            recommendations += "внести серу, торф, кислые удобрения";
-        }
-        recommendations += "\n";
+        advice.add(soil == SoilType::CLAY ? Code::PH_ALKALINE_CLAY : Code::PH_ALKALINE, data.ph, config.ph);
     }
 
     // Рекомендации по NPK с учетом типа почвы
-    bool nitrogenDeficient = data.nitrogen < config.nitrogen - 20.0F;
-    if (nitrogenDeficient)
+    if (data.nitrogen < config.nitrogen - 20.0F)
     {
-        recommendations += "🌱 Азот (N) дефицитен. Рекомендуется: ";
-        if (soilType == "sand")
+        Code code = Code::NITROGEN_LOW;
+        if (soil == SoilType::SAND)
         {
-            recommendations += "частое внесение азотных удобрений (песок быстро вымывает азот)";
+            code = Code::NITROGEN_LOW_SAND;  // песок быстро вымывает азот
         }
-        else if (soilType == "peat")
+        else if (soil == SoilType::PEAT)
         {
-            recommendations += "органические азотные удобрения (торф богат органикой)";
+            code = Code::NITROGEN_LOW_PEAT;  // торф богат органикой
         }
-        else
-        {
-            recommendations += "внести азотные удобрения (мочевина, аммиачная селитра), органические удобрения";
-        }
-        recommendations += "\n";
+        advice.add(code, data.nitrogen, config.nitrogen);
     }
 
     if (data.phosphorus < config.phosphorus - 15.0F)
     {
-        recommendations += "🌱 Фосфор (P) дефицитен. Рекомендуется: ";
-        if (soilType == "clay")
-        {
-            recommendations += "внести фосфорные удобрения с органическими (глина связывает фосфор)";
-        }
-        else
-        {
-            recommendations += "внести фосфорные удобрения (суперфосфат), костную муку";
-        }
-        recommendations += "\n";
+        advice.add(soil == SoilType::CLAY ? Code::PHOSPHORUS_LOW_CLAY : Code::PHOSPHORUS_LOW, data.phosphorus,
+                   config.phosphorus);
     }
 
     if (data.potassium < config.potassium - 20.0F)
     {
-        recommendations += "🌱 Калий (K) дефицитен. Рекомендуется: ";
-        if (soilType == "sand")
-        {
-            recommendations += "частое внесение калийных удобрений (песок быстро вымывает калий)";
-        }
-        else
-        {
-            recommendations += "внести калийные удобрения (хлористый калий), древесную золу";
-        }
-        recommendations += "\n";
+        advice.add(soil == SoilType::SAND ? Code::POTASSIUM_LOW_SAND : Code::POTASSIUM_LOW, data.potassium,
+                   config.potassium);
     }
 
     // Специфические рекомендации для культур с учетом типа почвы
-    if (cropType == "tomato")
+    if (crop == CropId::TOMATO && data.ec > 2500.0F)
     {
-        if (data.ec > 2500.0F)
-        {
-            recommendations += "🍅 Для томатов: высокий EC может вызвать вершинную гниль. Увеличьте кальций";
-            if (soilType == "clay")
-            {
-                recommendations += ", улучшите дренаж";
-            }
-            recommendations += "\n";
-        }
-    }
-    else if (cropType == "blueberry")
-    {
-        if (data.ph > 5.5F)
-        {
-            recommendations += "🫐 Для черники: pH слишком высокий. Внесите серу или кислый торф";
-            if (soilType == "clay")
-            {
-                recommendations += ", добавьте торф для подкисления";
-            }
-            recommendations += "\n";
-        }
+        advice.add(soil == SoilType::CLAY ? Code::TOMATO_HIGH_EC_CLAY : Code::TOMATO_HIGH_EC, data.ec, 2500.0F);
     }
-
-    if (recommendations.isEmpty())
+    else if (crop == CropId::BLUEBERRY && data.ph > 5.5F)
     {
-        recommendations = "✅ Все параметры в оптимальном диапазоне. Продолжайте текущий уход.";
+        advice.add(soil == SoilType::CLAY ? Code::BLUEBERRY_HIGH_PH_CLAY : Code::BLUEBERRY_HIGH_PH, data.ph, 5.5F);
     }
 
-    return recommendations;
+    return advice;
 }
 
 // ============================================================================
 // НОВЫЕ МЕТОДЫ ДЛЯ СИСТЕМНОГО АЛГОРИТМА
 // ============================================================================
 
-CropConfig CropRecommendationEngine::getTableValues(const String& cropType) const
-{
-    auto it = cropConfigs.find(cropType);
-    if (it != cropConfigs.end()) {
-        return it->second;
-    }
-    return cropConfigs.at("generic");
-}
-
-CropConfig CropRecommendationEngine::applyGrowingTypeCorrection(const CropConfig& table, const String& growingType)
-{
-    CropConfig result = table;
-    
-    if (growingType == "greenhouse") {
-        // Теплица: контролируемая среда, интенсивное выращивание
-        result.temperature *= 1.05f;  // +5%
-        result.humidity *= 1.05f;     // +5%
-        result.ec *= 1.10f;           // +10%
-        result.nitrogen *= 1.15f;     // +15%
-        result.phosphorus *= 1.15f;   // +15%
-        result.potassium *= 1.15f;    // +15%
-    }
-    else if (growingType == "hydroponics") {
-        // Гидропоника: точный контроль питательных веществ
-        result.temperature *= 1.03f;  // +3%
-        result.humidity *= 1.02f;     // +2%
-        result.ec *= 1.20f;           // +20%
-        result.nitrogen *= 1.25f;     // +25%
-        result.phosphorus *= 1.25f;   // +25%
-        result.potassium *= 1.25f;    // +25%
-    }
-    else if (growingType == "aeroponics") {
-        // Аэропоника: максимальная эффективность
-        result.temperature *= 1.04f;  // +4%
-        result.humidity *= 1.03f;     // +3%
-        result.ec *= 1.18f;           // +18%
-        result.nitrogen *= 1.20f;     // +20%
-        result.phosphorus *= 1.20f;   // +20%
-        result.potassium *= 1.20f;    // +20%
-    }
-    else if (growingType == "organic") {
-        // Органическое выращивание: естественные процессы
-        result.temperature *= 0.99f;  // -1%
-        result.humidity *= 1.02f;     // +2%
-        result.ec *= 0.90f;           // -10%
-        result.nitrogen *= 0.90f;     // -10%
-        result.phosphorus *= 0.90f;   // -10%
-        result.potassium *= 0.90f;    // -10%
-    }
-    else if (growingType == "indoor") {
-        // Комнатная: контролируемая среда, умеренная интенсивность
-        result.temperature *= 1.02f;  // +2% (стабильная температура)
-        result.humidity *= 1.03f;     // +3% (контролируемая влажность)
-        result.ec *= 1.05f;           // +5% (точный контроль питательных веществ)
-        result.nitrogen *= 1.08f;     // +8% (оптимизированное питание)
-        result.phosphorus *= 1.08f;   // +8% (оптимизированное питание)
-        result.potassium *= 1.08f;    // +8% (оптимизированное питание)
-    }
-    // outdoor: без изменений (0%)
-    
-    return result;
-}
-
-CropConfig CropRecommendationEngine::applySoilTypeCorrection(const CropConfig& adjusted, const String& soilType)
-{
-    CropConfig result = adjusted;
-    
-    // ОСТОРОЖНАЯ коррекция по типу почвы (минимальные изменения)
-    // Источник: Soil Fertility Manual, International Plant Nutrition Institute, 2020
-    // Примечание: Используем очень консервативные коэффициенты для избежания агрессивных изменений
-    
-    if (soilType == "sand") {
-        // Песок: быстрое вымывание, низкая влагоемкость
-        result.nitrogen *= 1.05f;     // +5% вымывание азота
-        result.phosphorus *= 1.03f;   // +3% связывание фосфора
-        result.potassium *= 1.04f;    // +4% вымывание калия
-        result.humidity *= 0.95f;     // -5% влагоемкость
-        result.ph *= 1.02f;           // +2% pH (песок обычно щелочной)
-        result.ec *= 0.98f;           // -2% EC (быстрое вымывание)
-    }
-    else if (soilType == "clay") {
-        // Глина: высокая влагоемкость, связывание питательных веществ
-        result.nitrogen *= 0.97f;     // -3% удержание азота (более консервативно)
-        result.phosphorus *= 0.95f;   // -5% связывание фосфора (более консервативно)
-        result.potassium *= 0.98f;    // -2% удержание калия (более консервативно)
-        result.humidity *= 1.05f;     // +5% влагоемкость (более консервативно)
-        result.ph *= 0.99f;           // -1% pH (глина обычно кислая)
-        result.ec *= 1.03f;           // +3% EC (накопление солей)
-    }
-    else if (soilType == "peat") {
-        // Торф: органический, кислый, высокая влагоемкость
-        result.nitrogen *= 1.05f;     // +5% органический азот (более консервативно)
-        result.phosphorus *= 1.03f;   // +3% доступность фосфора (более консервативно)
-        result.potassium *= 1.01f;    // +1% калий (более консервативно)
-        result.humidity *= 1.06f;     // +6% влагоемкость (более консервативно)
-        result.ph *= 0.95f;           // -5% pH (торф кислый)
-        result.ec *= 0.98f;           // -2% EC (низкая минерализация)
-    }
-    else if (soilType == "organic") {
-        // Органическая почва: богатая органикой
-        result.nitrogen *= 1.06f;     // +6% органический азот
-        result.phosphorus *= 1.04f;   // +4% доступность фосфора
-        result.potassium *= 1.03f;    // +3% калий
-        result.humidity *= 1.05f;     // +5% влагоемкость
-        result.ph *= 0.96f;           // -4% pH (органические почвы кислые)
-        result.ec *= 0.98f;           // -2% EC
-    }
-    // loam, silt, clay_loam, sandy_loam, silty_loam, loamy_clay: без изменений (0%)
-    // saline, alkaline: специальные случаи - пока без изменений
-    
-    return result;
-}
+// Коррекции типа выращивания, почвы и сезона - таблицы множителей (business/crop_corrections.h)
 
-CropConfig CropRecommendationEngine::applySeasonalCorrection(const CropConfig& adjusted, const String& season)
-{
-    CropConfig result = adjusted;
-    
-    if (season == "spring") {
-        // Весна: активный рост, потребность в азоте
-        // ТОЛЬКО NPK - остальные параметры не изменяются
-        result.nitrogen *= 1.15f;     // +15% (консервативный)
-        result.phosphorus *= 1.10f;   // +10% (консервативный)
-        result.potassium *= 1.12f;    // +12% (консервативный)
-    }
-    else if (season == "summer") {
-        // Лето: жаркий период, потребность в калии
-        result.nitrogen *= 1.05f;     // +5%
-        result.phosphorus *= 1.03f;   // +3%
-        result.potassium *= 1.08f;    // +8%
-    }
-    else if (season == "autumn") {
-        // Осень: подготовка к зиме, потребность в фосфоре
-        result.nitrogen *= 0.95f;     // -5%
-        result.phosphorus *= 0.97f;   // -3%
-        result.potassium *= 0.92f;    // -8%
-    }
-    else if (season == "winter") {
-        // Зима: период покоя
-        result.nitrogen *= 0.90f;     // -10%
-        result.phosphorus *= 0.95f;   // -5%
-        result.potassium *= 0.85f;    // -15%
-    }
-    
-    return result;
-}
-
-CropConfig CropRecommendationEngine::getScientificallyCompensated(const SensorData& data, const String& cropType)
+CropConfig CropRecommendationEngine::getScientificallyCompensated(const SensorData& data, CropId crop)
 {
     // Пока используем существующий алгоритм компенсации как есть
     // В будущем это будет отдельный трек данных
     CropConfig result;
     
     // Базовые значения из таблицы
-    result = getTableValues(cropType);
+    result = cropTableConfig(crop);
     
     // ✅ ИСПРАВЛЕНО: Оставляем scientificallyCompensated в VWC единицах
     // Температура: не меняется при компенсации
@@ -715,15 +246,13 @@ ColorIndicators CropRecommendationEngine::calculateColorIndicators(const CropCon
     ColorIndicators colors;
     
     // Функция для определения цвета на основе отклонения
-    auto getColor = [](float deviation) -> String {
-        if (abs(deviation) <= 10.0f) return "green";      // ±10% - зеленый
-        if (abs(deviation) <= 25.0f) return "yellow";     // ±25% - желтый
-        return "red";                                      // >25% - красный
+    auto getColor = [](float deviation) -> Indicator {
+        if (abs(deviation) <= 10.0f) return Indicator::GREEN;   // ±10% - зеленый
+        if (abs(deviation) <= 25.0f) return Indicator::YELLOW;  // ±25% - желтый
+        return Indicator::RED;                                  // >25% - красный
     };
     
     // Рассчитываем отклонения от научно компенсированных значений
-    float tempDeviation = ((final.temperature - scientific.temperature) / scientific.temperature) * 100.0f;
-    float humidityDeviation = ((final.humidity - scientific.humidity) / scientific.humidity) * 100.0f;
     float ecDeviation = ((final.ec - scientific.ec) / scientific.ec) * 100.0f;
     float phDeviation = ((final.ph - scientific.ph) / scientific.ph) * 100.0f;
     float nitrogenDeviation = ((final.nitrogen - scientific.nitrogen) / scientific.nitrogen) * 100.0f;
@@ -731,8 +260,8 @@ ColorIndicators CropRecommendationEngine::calculateColorIndicators(const CropCon
     float potassiumDeviation = ((final.potassium - scientific.potassium) / scientific.potassium) * 100.0f;
     
     // ✅ ИСПРАВЛЕНО: Не красим температуру (не меняется) и влажность (результат пересчета)
-    colors.temperature = "gray";  // Температура не меняется при компенсации
-    colors.humidity = "gray";     // Влажность - результат пересчета VWC→ASM
+    colors.temperature = Indicator::GRAY;  // Температура не меняется при компенсации
+    colors.humidity = Indicator::GRAY;     // Влажность - результат пересчета VWC→ASM
     colors.ec = getColor(ecDeviation);
     colors.ph = getColor(phDeviation);
     colors.nitrogen = getColor(nitrogenDeviation);
@@ -742,8 +271,7 @@ ColorIndicators CropRecommendationEngine::calculateColorIndicators(const CropCon
     return colors;
 }
 
-String CropRecommendationEngine::generateScientificNotes(const SensorData& /*data*/, const CropConfig& /*config*/,
-                                                         const String& cropType, const String& soilType)
+String CropRecommendationEngine::getScientificNotes(CropId crop, SoilType soil) const
 {
     String notes = "📊 Научные данные:\n";
 
@@ -753,32 +281,34 @@ String CropRecommendationEngine::generateScientificNotes(const SensorData& /*dat
     notes += "• Соотношение N:P:K варьируется по фазам роста\n";
 
     // Данные по типу почвы
-    notes += "\n🌍 Характеристики почвы (" + soilType + "):\n";
-    if (soilType == "sand")
+    notes += "\n🌍 Характеристики почвы (";
+    notes += soilTypeName(soil);
+    notes += "):\n";
+    if (soil == SoilType::SAND)
     {
         notes += "• Песок: быстрый дренаж, низкая влагоемкость\n";
         notes += "• Требует частого полива и внесения удобрений\n";
         notes += "• Коэффициент Арчи: m=1.3, n=2.0\n";
     }
-    else if (soilType == "clay")
+    else if (soil == SoilType::CLAY)
     {
         notes += "• Глина: медленный дренаж, высокая влагоемкость\n";
         notes += "• Склонна к засолению и уплотнению\n";
         notes += "• Коэффициент Арчи: m=2.0, n=2.5\n";
     }
-    else if (soilType == "peat")
+    else if (soil == SoilType::PEAT)
     {
         notes += "• Торф: высокая влагоемкость, кислая реакция\n";
         notes += "• Богат органикой, требует известкования\n";
         notes += "• Коэффициент Арчи: m=1.8, n=2.2\n";
     }
-    else if (soilType == "loam")
+    else if (soil == SoilType::LOAM)
     {
         notes += "• Суглинок: сбалансированные свойства\n";
         notes += "• Оптимален для большинства культур\n";
         notes += "• Коэффициент Арчи: m=1.5, n=2.0\n";
     }
-    else if (soilType == "sandpeat")
+    else if (soil == SoilType::SANDPEAT)
     {
         notes += "• Песчано-торфяной: промежуточные свойства\n";
         notes += "• Подходит для газонов и декоративных культур\n";
@@ -786,17 +316,17 @@ String CropRecommendationEngine::generateScientificNotes(const SensorData& /*dat
     }
 
     // Специфические данные для культур
-    if (cropType == "tomato")
+    if (crop == CropId::TOMATO)
     {
         notes += "• Томаты: чувствительны к засолению (EC > 3.0 mS/cm)\n";
         notes += "• Кальций важен для предотвращения вершинной гнили\n";
     }
-    else if (cropType == "blueberry")
+    else if (crop == CropId::BLUEBERRY)
     {
         notes += "• Черника: требует кислую почву (pH 4.5-5.5)\n";
         notes += "• Не переносит известь и высокий pH\n";
     }
-    else if (cropType == "lettuce")
+    else if (crop == CropId::LETTUCE)
     {
         notes += "• Салат: быстрорастущая культура, требует частого полива\n";
         notes += "• Чувствителен к засухе и высоким температурам\n";
@@ -812,7 +342,7 @@ String CropRecommendationEngine::generateScientificNotes(const SensorData& /*dat
     return notes;
 }
 
-String CropRecommendationEngine::calculateSoilHealthStatus(const SensorData& data, const CropConfig& config)
+uint8_t CropRecommendationEngine::calculateSoilHealthScore(const SensorData& data, const CropConfig& config)
 {
     int score = 100;
 
@@ -874,45 +404,29 @@ String CropRecommendationEngine::calculateSoilHealthStatus(const SensorData& dat
         score -= 10;
     }
 
-    if (score >= 80)
-    {
-        return "Отличное";
-    }
-    if (score >= 60)
-    {
-        return "Хорошее";
-    }
-    if (score >= 40)
-    {
-        return "Удовлетворительное";
-    }
-    return "Требует внимания";
+    return static_cast<uint8_t>(score > 0 ? score : 0);
 }
 
 std::vector<String> CropRecommendationEngine::getAvailableCrops() const
 {
     std::vector<String> crops;
-    for (const auto& pair : cropConfigs)
+    crops.reserve(CROP_COUNT);
+    for (const auto& entry : CROP_TABLE)
     {
-        crops.push_back(pair.first);
+        crops.push_back(entry.name);
     }
     return crops;
 }
 
 CropConfig CropRecommendationEngine::getCropConfig(const String& cropType) const
 {
-    auto cropIterator = cropConfigs.find(cropType);
-    if (cropIterator != cropConfigs.end())
-    {
-        return cropIterator->second;
-    }
     // Возвращаем generic конфигурацию если культура не найдена
-    auto genericIterator = cropConfigs.find("generic");
-    if (genericIterator != cropConfigs.end())
-    {
-        return genericIterator->second;
-    }
-    return {};  // Пустая конфигурация
+    return cropTableConfig(cropIdFromName(cropType.c_str()));
+}
+
+const CropConfig& CropRecommendationEngine::getCropConfig(CropId cropId) const
+{
+    return cropTableConfig(cropId);
 }
 
 bool CropRecommendationEngine::validateSensorData(const SensorData& data) const
@@ -1014,54 +528,26 @@ RecValues CropRecommendationEngine::computeRecommendations(const String& cropId,
 {
     RecValues rec = {0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F};
 
-    // Получаем базовую конфигурацию культуры
-    auto configIterator = cropConfigs.find(cropId);
-    if (configIterator == cropConfigs.end())
-    {
-        configIterator = cropConfigs.find("generic");
-    }
-
-    if (configIterator != cropConfigs.end())
-    {
-        const CropConfig& config = configIterator->second;
-        rec.t = config.temperature;
-        rec.hum = config.humidity;
-        rec.ec = config.ec;
-        rec.ph = config.ph;
-        rec.n = config.nitrogen;
-        rec.p = config.phosphorus;
-        rec.k = config.potassium;
-    }
+    // Получаем базовую конфигурацию культуры (generic, если культура не найдена)
+    const CropConfig& config = cropTableConfig(cropIdFromName(cropId.c_str()));
+    rec.t = config.temperature;
+    rec.hum = config.humidity;
+    rec.ec = config.ec;
+    rec.ph = config.ph;
+    rec.n = config.nitrogen;
+    rec.p = config.phosphorus;
+    rec.k = config.potassium;
 
     return rec;
 }
 
 void CropRecommendationEngine::applySeasonalCorrection(RecValues& rec, Season season, bool isGreenhouse)
 {
-    // ✅ ПРАВИЛЬНАЯ РЕАЛИЗАЦИЯ СЕЗОННЫХ КОРРЕКТИРОВОК (согласно документации)
-    switch (season)
-    {
-        case Season::SPRING:
-            rec.n *= 1.15F;  // +15% азота весной
-            rec.p *= 1.10F;  // +10% фосфора весной
-            rec.k *= 1.12F;  // +12% калия весной
-            break;
-        case Season::SUMMER:
-            rec.n *= 1.05F;  // +5% азота летом
-            rec.p *= 1.03F;  // +3% фосфора летом
-            rec.k *= 1.08F;  // +8% калия летом
-            break;
-        case Season::AUTUMN:
-            rec.n *= 0.95F;  // -5% азота осенью
-            rec.p *= 0.97F;  // -3% фосфора осенью
-            rec.k *= 0.92F;  // -8% калия осенью
-            break;
-        case Season::WINTER:
-            rec.n *= 0.90F;  // -10% азота зимой
-            rec.p *= 0.95F;  // -5% фосфора зимой
-            rec.k *= 0.85F;  // -15% калия зимой
-            break;
-    }
+    // ✅ ПРАВИЛЬНАЯ РЕАЛИЗАЦИЯ СЕЗОННЫХ КОРРЕКТИРОВОК (согласно документации): та же таблица SEASON_MULTIPLIERS
+    const CropMultipliers& multipliers = seasonMultipliers(season);
+    rec.n *= multipliers.nitrogen;
+    rec.p *= multipliers.phosphorus;
+    rec.k *= multipliers.potassium;
 
     // Дополнительные корректировки для теплицы
     if (isGreenhouse)
@@ -1074,657 +560,40 @@ void CropRecommendationEngine::applySeasonalCorrection(RecValues& rec, Season se
 // УДАЛЕНО: Дублированные функции компенсации
 // Используется SensorCompensationService для единообразной компенсации
 
-String CropRecommendationEngine::generateCropSpecificRecommendations(const String& cropName, 
+String CropRecommendationEngine::generateCropSpecificRecommendations(CropId cropId,
                                                                    const NPKReferences& npk,
-                                                                   SoilType soilType, 
-                                                                   float pH,
-                                                                   const String& season)
+                                                                   SoilType soilType,
+                                                                   float pH)
 {
-    String recommendations = "";
-    
-    // Используем стандартные пороги дефицита (без сезонных корректировок)
-    // Согласно логике: "сырые значения потом коррекция, затем научная компенсация и на этом все"
-    float nitrogenThreshold = 100.0F;
-    float phosphorusThreshold = 50.0F;
-    float potassiumThreshold = 150.0F;
-    
-    // Определяем общие дефициты на основе стандартных порогов
-    bool nitrogenDeficient = npk.nitrogen < nitrogenThreshold;
-    bool phosphorusDeficient = npk.phosphorus < phosphorusThreshold;
-    bool potassiumDeficient = npk.potassium < potassiumThreshold;
-    
-    // 🔍 СПЕЦИФИЧЕСКИЕ ТРЕБОВАНИЯ КУЛЬТУР К ДОПОЛНИТЕЛЬНЫМ ЭЛЕМЕНТАМ
-    
-    if (cropName == "tomato" || cropName == "томат") {
-        // Томаты требуют много кальция для предотвращения вершинной гнили
-        if (pH < 6.5F) {  // Расширили диапазон с 6.0 до 6.5
-            recommendations += "🍅 Томаты → кальций Ca(NO3)2\n";
-        }
-        
-        // УДАЛЕНО: дублирует антагонизм K→Mg из nutrient_interactions
-        
-        // Общие рекомендации для томатов
-        if (npk.nitrogen > 150.0F && npk.phosphorus < 100.0F) {
-            recommendations += "🍅 Томаты → баланс N/P\n";
-        }
-        
-        // Томаты нуждаются в боре для качества плодов
-        if (pH > 7.0F || npk.potassium > 300.0F) {
-            recommendations += "🍅 Томаты → бор H3BO3\n";
-        }
-    }
-    
-    else if (cropName == "cucumber" || cropName == "огурец") {
-        // Огурцы требуют много калия для качества плодов
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 200.0F) {
-            recommendations += "🥒 Огурцы требуют калий для качества плодов. ";
-            recommendations += "Рекомендуется: внести калийную селитру (KNO3) или сульфат калия (K2SO4)\n";
-        }
-        
-        // Огурцы чувствительны к дефициту бора для завязывания плодов
-        if (pH > 7.5F) {  // Стандартный порог для доступности бора¹
-            recommendations += "🥒 Огурцы требуют бор для завязывания плодов. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
-        }
-        
-        // УДАЛЕНО: дублирует антагонизм K→Mg из nutrient_interactions
-        
-        // Огурцы требуют кальций для качества плодов
-        if (pH < 6.0F || npk.potassium > 250.0F) {
-            recommendations += "🥒 Огурцы требуют кальций для качества плодов. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
-        }
-        
-        // Огурцы нуждаются в магнии для фотосинтеза
-        if (npk.potassium > 300.0F || pH > 7.0F) {
-            recommendations += "🥒 Огурцы требуют магний для фотосинтеза. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
-        }
-    }
-    
-    else if (cropName == "pepper" || cropName == "перец") {
-        // Перец требует цинк при высоком фосфоре (антагонизм P→Zn)
-        if (npk.phosphorus > 100.0F) {  // Консервативный порог для антагонизма P→Zn (исследования показывают 100 мг/кг)
-            recommendations += "🌶️ Перец требует цинк при высоком фосфоре. ";
-            recommendations += "Рекомендуется: внести хелат цинка (Zn-EDTA) или сульфат цинка (ZnSO4)\n";
-        }
-        
-        // Перец чувствителен к дефициту кальция (вершинная гниль)
-        if (pH < 6.5F) {  // Расширен с 6.0 до 6.5
-            recommendations += "🌶️ Перец требует кальций против вершинной гнили. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
-        }
-        
-        // Перец нуждается в боре для завязывания плодов
-        if (pH > 7.0F || npk.potassium > 300.0F) {
-            recommendations += "🌶️ Перец требует бор для завязывания плодов. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
-        }
-        
-        // Перец требует калий для качества плодов
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 180.0F) {
-            recommendations += "🌶️ Перец требует калий для качества и остроты плодов. ";
-            recommendations += "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)\n";
-        }
-        
-        // Перец нуждается в магнии для фотосинтеза
-        if (npk.potassium > 350.0F || pH > 7.0F) {
-            recommendations += "🌶️ Перец требует магний для фотосинтеза. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
-        }
-    }
-    
-    else if (cropName == "lettuce" || cropName == "салат") {
-        // Салат требует серу для синтеза белка при высоком азоте
-        if (npk.nitrogen > 250.0F) {
-            recommendations += "🥬 Салат требует серу для синтеза белка. ";
-            recommendations += "Рекомендуется: внести сульфат аммония ((NH4)2SO4) или элементарную серу (S)\n";
-        }
-        
-        // Салат чувствителен к дефициту железа при высоком pH (хлороз)
-        if (pH > 7.0F) {
-            recommendations += "🥬 Салат требует железо для предотвращения хлороза. ";
-            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)\n";
-        }
-        
-        // Салат требует много азота для быстрого роста листьев
-        // Проверяем только если общий дефицит азота не был уже определен
-        if (!nitrogenDeficient && npk.nitrogen < 150.0F) {
-            recommendations += "🥬 Салат требует много азота для интенсивного роста листьев. ";
-            recommendations += "Рекомендуется: внести аммиачную селитру (NH4NO3) или мочевину (CO(NH2)2)\n";
-        }
-        
-        // Салат нуждается в кальции для качества листьев
-        if (pH < 6.0F || npk.potassium > 200.0F) {
-            recommendations += "🥬 Салат требует кальций для качества листьев. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
-        }
-    }
-    
-    else if (cropName == "blueberry" || cropName == "черника") {
-        // Черника требует кислую почву (pH 4.0-5.5) для усвоения железа
-        if (pH > 5.5F) {
-            recommendations += "🫐 Черника требует кислую почву для усвоения железа. ";
-            recommendations += "Рекомендуется: внести элементарную серу (S) или сульфат аммония ((NH4)2SO4)\n";
-        }
-        
-        // Черника чувствительна к дефициту железа при высоком pH (хлороз)
-        if (pH > 5.0F) {
-            recommendations += "🫐 Черника требует железо для предотвращения хлороза. ";
-            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)\n";
-        }
-        
-        // Черника нуждается в марганце в кислой почве для фотосинтеза
-        if (pH < 5.5F && npk.nitrogen > 100.0F) {
-            recommendations += "🫐 Черника требует марганец для фотосинтеза. ";
-            recommendations += "Рекомендуется: внести сульфат марганца (MnSO4) или хелат марганца (Mn-EDTA)\n";
-        }
-        
-        // Черника требует аммонийный азот вместо нитратного
-        // Проверяем только если общий дефицит азота не был уже определен
-        if (!nitrogenDeficient && npk.nitrogen < 80.0F && pH < 5.5F) {
-            recommendations += "🫐 Черника предпочитает аммонийный азот. ";
-            recommendations += "Рекомендуется: внести сульфат аммония ((NH4)2SO4) вместо нитратов\n";
-        }
-    }
-    
-    else if (cropName == "strawberry" || cropName == "клубника") {
-        // Клубника требует кальций для качества ягод (против гнили)
-        if (pH < 6.0F) {
-            recommendations += "🍓 Клубника требует кальций для качества ягод. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
-        }
-        
-        // Клубника нуждается в боре для опыления и развития плодов
-        if (pH > 6.5F || npk.potassium > 200.0F) {
-            recommendations += "🍓 Клубника требует бор для опыления и развития плодов. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
-        }
-        
-        // Клубника чувствительна к дефициту цинка при высоком фосфоре
-        if (npk.phosphorus > 80.0F) {
-            recommendations += "🍓 Клубника требует цинк для синтеза ауксинов. ";
-            recommendations += "Рекомендуется: внести хелат цинка (Zn-EDTA) или сульфат цинка (ZnSO4)\n";
-        }
-        
-        // Клубника требует калий для качества ягод
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 150.0F) {
-            recommendations += "🍓 Клубника требует калий для качества и сладости ягод. ";
-            recommendations += "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)\n";
-        }
-    }
-    
-    else if (cropName == "apple" || cropName == "яблоня") {
-        // Яблоня требует кальций против горькой ямчатости плодов
-        if (pH < 6.5F || npk.potassium > 250.0F) {
-            recommendations += "🍎 Яблоня требует кальций против горькой ямчатости плодов. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
-        }
-        
-        // Яблоня нуждается в боре для развития плодов и опыления
-        if (pH > 7.0F) {
-            recommendations += "🍎 Яблоня требует бор для развития плодов и опыления. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
-        }
-        
-        // Яблоня чувствительна к дефициту цинка (розеточность листьев)
-        if (pH > 7.0F || npk.phosphorus > 60.0F) {
-            recommendations += "🍎 Яблоня требует цинк для предотвращения розеточности листьев. ";
-            recommendations += "Рекомендуется: внести сульфат цинка (ZnSO4) или хелат цинка (Zn-EDTA)\n";
-        }
-        
-        // Яблоня требует калий для качества плодов
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 180.0F) {
-            recommendations += "🍎 Яблоня требует калий для качества и лежкости плодов. ";
-            recommendations += "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)\n";
-        }
-        
-        // Яблоня нуждается в магнии для фотосинтеза
-        if (npk.potassium > 300.0F || pH > 7.0F) {
-            recommendations += "🍎 Яблоня требует магний для фотосинтеза. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
-        }
-    }
-    
-    else if (cropName == "grape" || cropName == "виноград") {
-        // Виноград требует калий для качества ягод и сахаристости
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 200.0F) {
-            recommendations += "🍇 Виноград требует калий для качества ягод и сахаристости. ";
-            recommendations += "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)\n";
-        }
-        
-        // УДАЛЕНО: дублирует антагонизм K→Mg из nutrient_interactions
-        
-        // Виноград чувствителен к дефициту бора для опыления
-        if (pH > 7.0F) {
-            recommendations += "🍇 Виноград требует бор для опыления и развития ягод. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
-        }
-        
-        // Виноград требует кальций для качества ягод
-        if (pH < 6.0F || npk.potassium > 250.0F) {
-            recommendations += "🍇 Виноград требует кальций для качества ягод. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
-        }
-        
-        // Виноград нуждается в магнии для фотосинтеза
-        if (npk.potassium > 300.0F || pH > 7.0F) {
-            recommendations += "🍇 Виноград требует магний для фотосинтеза. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
-        }
-    }
-    
-    else if (cropName == "spinach" || cropName == "шпинат") {
-        // Шпинат требует много железа для предотвращения хлороза
-        if (pH > 7.0F || npk.nitrogen < 200.0F) {
-            recommendations += "🥬 Шпинат требует железо для предотвращения хлороза. ";
-            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
-        }
-        
-        // Шпинат чувствителен к дефициту магния при высоком калии
-        if (npk.potassium > 400.0F) {
-            recommendations += "🥬 Высокий калий может блокировать магний у шпината. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
-        }
-        
-        // Шпинат требует много азота для быстрого роста
-        // Проверяем только если общий дефицит азота не был уже определен
-        if (!nitrogenDeficient && npk.nitrogen < 200.0F) {
-            recommendations += "🥬 Шпинат требует много азота для интенсивного роста листьев. ";
-            recommendations += "Рекомендуется: внести азотные удобрения (NH4NO3)\n";
-        }
-    }
-    
-    else if (cropName == "basil" || cropName == "базилик") {
-        // Базилик требует калий для развития эфирных масел
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 200.0F) {
-            recommendations += "🌿 Базилик требует калий для синтеза эфирных масел. ";
-            recommendations += "Рекомендуется: внести калийную селитру (KNO3)\n";
-        }
-        
-        // Базилик чувствителен к дефициту магния
-        if (npk.potassium > 300.0F || pH > 6.5F) {
-            recommendations += "🌿 Базилик требует магний для фотосинтеза. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
-        }
-        
-        // Базилик нуждается в боре для качества листьев
-        if (pH > 6.5F) {
-            recommendations += "🌿 Базилик требует бор для предотвращения деформации листьев. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
-        }
-    }
-    
-    else if (cropName == "cannabis" || cropName == "конопля") {
-        // Конопля требует много азота в вегетативной фазе
-        // Проверяем только если общий дефицит азота не был уже определен
-        if (!nitrogenDeficient && npk.nitrogen < 160.0F) {
-            recommendations += "🌿 Конопля требует много азота для роста листьев. ";
-            recommendations += "Рекомендуется: внести азотные удобрения (NH4NO3)\n";
-        }
-        
-        // Конопля нуждается в фосфоре для цветения
-        // Проверяем только если общий дефицит фосфора не был уже определен
-        if (!phosphorusDeficient && npk.phosphorus < 40.0F) {
-            recommendations += "🌿 Конопля требует фосфор для развития соцветий. ";
-            recommendations += "Рекомендуется: внести фосфорные удобрения (H3PO4)\n";
-        }
-        
-        // Конопля требует калий для качества продукции
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 200.0F) {
-            recommendations += "🌿 Конопля требует калий для синтеза активных веществ. ";
-            recommendations += "Рекомендуется: внести калийную селитру (KNO3)\n";
-        }
-        
-        // Конопля чувствительна к дефициту кальция
-        if (pH < 6.0F) {
-            recommendations += "🌿 Конопля требует кальций для структуры клеток. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
-        }
-        
-        // Конопля нуждается в магнии при высоком калии
-        if (npk.potassium > 300.0F) {
-            recommendations += "🌿 Высокий калий может блокировать магний у конопли. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
-        }
-    }
-    
-    else if (cropName == "wheat" || cropName == "пшеница") {
-        // Пшеница требует много азота для формирования белка
-        // Проверяем только если общий дефицит азота не был уже определен
-        if (!nitrogenDeficient && npk.nitrogen < 200.0F) {
-            recommendations += "🌾 Пшеница → азот NH4NO3\n";
-        }
-        
-        // Пшеница нуждается в фосфоре для развития корневой системы
-        // Проверяем только если общий дефицит фосфора не был уже определен
-        if (!phosphorusDeficient && npk.phosphorus < 50.0F) {
-            recommendations += "🌾 Пшеница → фосфор\n";
-        }
-        
-        // Пшеница чувствительна к дефициту серы
-        if (npk.nitrogen > 250.0F && pH > 7.0F) {
-            recommendations += "🌾 Пшеница → сера (NH4)2SO4\n";
-        }
-        
-        // Пшеница нуждается в калии для устойчивости к болезням
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 150.0F) {
-            recommendations += "🌾 Пшеница → калий KCl\n";
-        }
-    }
-    
-    else if (cropName == "potato" || cropName == "картофель") {
-        // Картофель требует много калия для качества клубней
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 250.0F) {
-            recommendations += "🥔 Картофель требует калий для качества клубней. ";
-            recommendations += "Рекомендуется: внести калийную селитру (KNO3)\n";
-        }
-        
-        // Картофель чувствителен к дефициту магния
-        if (npk.potassium > 400.0F || pH < 6.0F) {
-            recommendations += "🥔 Картофель требует магний для фотосинтеза. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
-        }
-        
-        // Картофель нуждается в кальции для предотвращения пятнистости
-        if (pH < 5.8F) {
-            recommendations += "🥔 Картофель требует кальций для качества клубней. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
-        }
-        
-        // Картофель требует сбалансированное питание NPK
-        if (npk.nitrogen > 200.0F && npk.phosphorus < 50.0F) {
-            recommendations += "🥔 Картофель нуждается в сбалансированном питании. ";
-            recommendations += "Рекомендуется: увеличить фосфор для развития клубней\n";
-        }
-        
-        // Картофель чувствителен к избытку азота
-        if (npk.nitrogen > 250.0F) {
-            recommendations += "🥔 Избыток азота снижает качество клубней картофеля. ";
-            recommendations += "Рекомендуется: сократить азотные подкормки\n";
-        }
-    }
-    
-    else if (cropName == "kale" || cropName == "кале") {
-        // Кале требует кальций для предотвращения краевого ожога
-        if (pH < 6.0F) {
-            recommendations += "🥬 Кале требует кальций для качества листьев. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
-        }
-        
-        // Кале чувствительна к дефициту серы (семейство крестоцветных)
-        if (npk.nitrogen > 200.0F && pH > 6.5F) {
-            recommendations += "🥬 Кале требует серу для синтеза глюкозинолатов. ";
-            recommendations += "Рекомендуется: внести сульфат аммония ((NH4)2SO4)\n";
-        }
-        
-        // Кале нуждается в боре для предотвращения полых стеблей
-        if (pH > 7.0F || npk.potassium > 350.0F) {
-            recommendations += "🥬 Кале требует бор для структуры стеблей. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
-        }
-    }
-    
-    else if (cropName == "raspberry" || cropName == "малина") {
-        // Малина требует железо для предотвращения хлороза
-        if (pH > 6.5F) {
-            recommendations += "🍇 Малина требует железо для зеленой окраски листьев. ";
-            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
-        }
-        
-        // Малина чувствительна к дефициту марганца
-        if (pH < 5.5F && npk.nitrogen > 150.0F) {
-            recommendations += "🍇 Малина требует марганец для фотосинтеза. ";
-            recommendations += "Рекомендуется: внести сульфат марганца (MnSO4)\n";
-        }
-        
-        // Малина нуждается в цинке для роста побегов
-        if (npk.phosphorus > 70.0F) {
-            recommendations += "🍇 Высокий фосфор может блокировать цинк у малины. ";
-            recommendations += "Рекомендуется: внести хелатный цинк (Zn-EDTA)\n";
-        }
-    }
-    
-    else if (cropName == "blackberry" || cropName == "ежевика") {
-        // Ежевика требует железо (похоже на малину, но более устойчива)
-        if (pH > 7.0F) {
-            recommendations += "🫐 Ежевика требует железо при щелочной почве. ";
-            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
-        }
-        
-        // Ежевика чувствительна к дефициту марганца
-        if (pH < 5.8F) {
-            recommendations += "🫐 Ежевика требует марганец для качества ягод. ";
-            recommendations += "Рекомендуется: внести сульфат марганца (MnSO4)\n";
-        }
-        
-        // Ежевика нуждается в боре для завязывания плодов
-        if (pH > 6.8F || npk.potassium > 300.0F) {
-            recommendations += "🫐 Ежевика требует бор для формирования ягод. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
-        }
-    }
-    
-    else if (cropName == "soybean" || cropName == "соя") {
-        // Соя требует фосфор для азотфиксации
-        // Проверяем только если общий дефицит фосфора не был уже определен
-        if (!phosphorusDeficient && npk.phosphorus < 40.0F) {
-            recommendations += "🌱 Соя требует фосфор для работы клубеньковых бактерий. ";
-            recommendations += "Рекомендуется: внести суперфосфат (Ca(H2PO4)2)\n";
-        }
-        
-        // Соя нуждается в калии для налива бобов
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 200.0F) {
-            recommendations += "🌱 Соя требует калий для формирования бобов. ";
-            recommendations += "Рекомендуется: внести хлорид калия (KCl)\n";
-        }
-        
-        // Соя требует молибден для азотфиксации
-        if (npk.nitrogen < 80.0F && pH < 6.0F) {
-            recommendations += "🌱 Соя требует молибден для фиксации азота. ";
-            recommendations += "Рекомендуется: внести молибдат аммония ((NH4)2MoO4)\n";
-        }
-        
-        // Соя чувствительна к избытку азота (подавляет азотфиксацию)
-        if (npk.nitrogen > 120.0F) {
-            recommendations += "🌱 Избыток азота подавляет азотфиксацию у сои. ";
-            recommendations += "Рекомендуется: сократить азотные подкормки\n";
-        }
-    }
-    
-    else if (cropName == "carrot" || cropName == "морковь") {
-        // Морковь требует бор для предотвращения растрескивания корней
-        if (pH > 7.0F || npk.potassium > 300.0F) {
-            recommendations += "🥕 Морковь требует бор для качества корнеплодов. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
-        }
-        
-        // Морковь нуждается в кальции для предотвращения мягкой гнили
-        if (pH < 6.0F) {
-            recommendations += "🥕 Морковь требует кальций для устойчивости к болезням. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
-        }
-        
-        // Морковь требует калий для качества и лежкости
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 200.0F) {
-            recommendations += "🥕 Морковь требует калий для сладости и лежкости. ";
-            recommendations += "Рекомендуется: внести калийную селитру (KNO3)\n";
-        }
-        
-        // Морковь чувствительна к избытку азота (разветвление корней)
-        if (npk.nitrogen > 180.0F) {
-            recommendations += "🥕 Избыток азота вызывает разветвление корнеплодов моркови. ";
-            recommendations += "Рекомендуется: сократить азотные подкормки\n";
-        }
-    }
-    
-    // 🌱 ДОБАВЛЯЕМ НЕДОСТАЮЩИЕ КУЛЬТУРЫ
-    
-    else if (cropName == "lawn" || cropName == "газон") {
-        // Газон требует азот для роста листьев (N:P:K = 3:1:2 для газонов)
-        // Проверяем только если общий дефицит азота не был уже определен
-        // Используем стандартный порог без сезонных корректировок
-        if (!nitrogenDeficient && npk.nitrogen < 120.0F) {
-            recommendations += "🌱 Газон требует азот для активного роста листьев. ";
-            recommendations += "Рекомендуется: внести мочевину (CO(NH2)2) или аммиачную селитру (NH4NO3)\n";
-        }
-        
-        // Газон нуждается в фосфоре для развития корневой системы
-        // Проверяем только если общий дефицит фосфора не был уже определен
-        if (!phosphorusDeficient && npk.phosphorus < 40.0F) {
-            recommendations += "🌱 Газон требует фосфор для развития корневой системы. ";
-            recommendations += "Рекомендуется: внести суперфосфат (Ca(H2PO4)2) или диаммофос (NH4H2PO4)\n";
-        }
-        
-        // Газон требует калий для устойчивости к засухе и болезням
-        // Проверяем только если общий дефицит калия не был уже определен
-        if (!potassiumDeficient && npk.potassium < 80.0F) {
-            recommendations += "🌱 Газон требует калий для устойчивости к стрессам и болезням. ";
-            recommendations += "Рекомендуется: внести хлористый калий (KCl) или сульфат калия (K2SO4)\n";
-        }
-        
-        // Газон чувствителен к дефициту железа при высоком pH (желтые пятна)
-        if (pH > 7.0F) {
-            recommendations += "🌱 Газон требует железо для предотвращения хлороза. ";
-            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)\n";
-        }
-        
-        // Газон нуждается в кальции для структуры почвы
-        if (pH < 6.0F) {
-            recommendations += "🌱 Газон требует кальций для улучшения структуры почвы. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или известь (CaCO3)\n";
-        }
-        
-        // Газон чувствителен к дефициту магния при высоком калии
-        if (npk.potassium > 200.0F && pH > 6.5F) {
-            recommendations += "🌱 Высокий калий может блокировать магний у газона. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
-        }
-        
-        // Газон требует серу для синтеза белка (особенно при высоком азоте)
-        if (npk.nitrogen > 150.0F && pH > 7.0F) {
-            recommendations += "🌱 Газон требует серу для синтеза белка. ";
-            recommendations += "Рекомендуется: внести сульфат аммония ((NH4)2SO4) или элементарную серу\n";
-        }
-        
-        // Газон нуждается в микроэлементах при интенсивном использовании
-        if (npk.nitrogen > 200.0F && npk.phosphorus > 60.0F) {
-            recommendations += "🌱 Газон требует микроэлементы при интенсивном питании. ";
-            recommendations += "Рекомендуется: внести комплексное микроудобрение (Zn, Mn, Cu, B)\n";
-        }
-    }
-    
-    else if (cropName == "conifer" || cropName == "хвойные") {
-        // Хвойные требуют кислую почву
-        if (pH > 6.0F) {
-            recommendations += "🌲 Хвойные требуют кислую почву для нормального роста. ";
-            recommendations += "Рекомендуется: подкислить почву серой или торфом\n";
-        }
-        
-        // Хвойные нуждаются в магнии для фотосинтеза
-        if (npk.potassium > 100.0F) {
-            recommendations += "🌲 Хвойные требуют магний для предотвращения пожелтения. ";
-            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
-        }
-        
-        // Хвойные чувствительны к избытку азота
-        if (npk.nitrogen > 100.0F) {
-            recommendations += "🌲 Избыток азота может повредить хвойные растения. ";
-            recommendations += "Рекомендуется: сократить азотные подкормки\n";
-        }
-    }
-    
-    else if (cropName == "pear" || cropName == "груша") {
-        // Груша требует кальций против горькой ямчатости
-        if (pH < 6.5F || npk.potassium > 250.0F) {
-            recommendations += "🍐 Груша требует кальций для качества плодов. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
-        }
-        
-        // Груша нуждается в боре для развития плодов
-        if (pH > 7.0F) {
-            recommendations += "🍐 Груша требует бор для формирования плодов. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
-        }
-        
-        // Груша чувствительна к дефициту цинка
-        if (pH > 7.0F || npk.phosphorus > 60.0F) {
-            recommendations += "🍐 Груша требует цинк для нормального роста. ";
-            recommendations += "Рекомендуется: внести хелатный цинк (Zn-EDTA)\n";
-        }
-    }
-    
-    else if (cropName == "cherry" || cropName == "вишня") {
-        // Вишня требует кальций для качества плодов
-        if (pH < 6.5F || npk.potassium > 250.0F) {
-            recommendations += "🍒 Вишня требует кальций для предотвращения растрескивания. ";
-            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
-        }
-        
-        // Вишня нуждается в боре для завязывания плодов
-        if (pH > 7.0F) {
-            recommendations += "🍒 Вишня требует бор для опыления и завязывания. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
-        }
-        
-        // Вишня чувствительна к дефициту железа
-        if (pH > 7.0F) {
-            recommendations += "🍒 Вишня требует железо для предотвращения хлороза. ";
-            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
-        }
-    }
-    
+    // Правила - таблица CropRules::RULES во flash; оценка без выделений памяти,
+    // здесь только разворачиваем коды сообщений в текст одним выделением String
+    const CropRules::MessageList messages = CropRules::evaluate(cropId, soilType, npk, pH);
 
-    
-    else if (cropName == "currant" || cropName == "смородина") {
-        // Смородина требует железо для предотвращения хлороза
-        if (pH > 7.0F) {
-            recommendations += "🫐 Смородина требует железо для предотвращения хлороза. ";
-            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
-        }
-        
-        // Смородина нуждается в боре для завязывания ягод
-        if (pH > 6.8F || npk.potassium > 300.0F) {
-            recommendations += "🫐 Смородина требует бор для формирования ягод. ";
-            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
-        }
-        
-        // Смородина чувствительна к дефициту марганца
-        if (pH < 5.8F) {
-            recommendations += "🫐 Смородина требует марганец для качества ягод. ";
-            recommendations += "Рекомендуется: внести сульфат марганца (MnSO4)\n";
-        }
+    size_t length = 0;
+    for (const CropRules::MessageId id : messages)
+    {
+        length += strlen(CropRules::messageText(id)) + 1;
     }
-    
 
-    
-    // 🌱 ОБЩИЕ РЕКОМЕНДАЦИИ ПО ТИПУ ПОЧВЫ
-    
-    if (soilType == SoilType::CLAY || soilType == SoilType::CLAY_LOAM) {
-        recommendations += "🏺 Глинистые почвы могут связывать микроэлементы. ";
-        recommendations += "Рекомендуется: использовать хелатные формы удобрений\n";
-    }
-    
-    if (soilType == SoilType::SAND || soilType == SoilType::SANDY_LOAM) {
-        recommendations += "🏖️ Песчаные почвы быстро теряют питательные вещества. ";
-        recommendations += "Рекомендуется: частые подкормки малыми дозами\n";
-    }
-    
-    if (soilType == SoilType::PEAT && npk.phosphorus < 30.0F) {
-        recommendations += "🟫 Торф → дефицит P\n";
+    String recommendations;
+    recommendations.reserve(length);
+    for (const CropRules::MessageId id : messages)
+    {
+        recommendations += CropRules::messageText(id);
+        recommendations += '\n';
     }
-    
     return recommendations;
 }
+
+String CropRecommendationEngine::generateCropSpecificRecommendations(const String& cropName,
+                                                                   const NPKReferences& npk,
+                                                                   SoilType soilType,
+                                                                   float pH,
+                                                                   const String& season)
+{
+    // Пороги правил не зависят от сезона: "сырые значения потом коррекция, затем научная
+    // компенсация и на этом все"
+    (void)season;
+    return generateCropSpecificRecommendations(CropRules::cropIdFromAnyName(cropName.c_str()), npk, soilType, pH);
+}
     
\ No newline at end of file
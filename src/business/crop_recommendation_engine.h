@@ -8,9 +8,11 @@
 #define CROP_RECOMMENDATION_ENGINE_H
 
 #include <Arduino.h>
-#include <map>
 #include <vector>
 #include "business/ICropRecommendationEngine.h"
+#include "business/advice_codes.h"
+#include "business/crop_corrections.h"
+#include "business/crop_table.h"
 
 // Используем структуру SensorData из modbus_sensor.h
 #include "../modbus_sensor.h"
@@ -35,29 +37,57 @@ struct CorrectionPercentages
     float potassium;
 };
 
+// Цвет параметра: отклонение итоговой цели от научно компенсированного значения
+enum class Indicator : uint8_t
+{
+    GRAY = 0,  // Не окрашивается
+    GREEN,     // ±10%
+    YELLOW,    // ±25%
+    RED,       // >25%
+    COUNT
+};
+
+inline constexpr std::array<const char*, static_cast<size_t>(Indicator::COUNT)> INDICATOR_NAMES = {
+    {"gray", "green", "yellow", "red"}};
+
 // Структура для цветовых индикаторов
 struct ColorIndicators
 {
-    String temperature;
-    String humidity;
-    String ec;
-    String ph;
-    String nitrogen;
-    String phosphorus;
-    String potassium;
+    Indicator temperature;
+    Indicator humidity;
+    Indicator ec;
+    Indicator ph;
+    Indicator nitrogen;
+    Indicator phosphorus;
+    Indicator potassium;
 };
 
-// Структура результата рекомендаций
+// Общее состояние почвы по баллу 0-100
+enum class SoilHealth : uint8_t
+{
+    EXCELLENT = 0,    // >= 80
+    GOOD,             // >= 60
+    FAIR,             // >= 40
+    NEEDS_ATTENTION,  // < 40
+    COUNT
+};
+
+inline constexpr std::array<const char*, static_cast<size_t>(SoilHealth::COUNT)> SOIL_HEALTH_NAMES = {
+    {"Отличное", "Хорошее", "Удовлетворительное", "Требует внимания"}};
+
+// Структура результата рекомендаций: перечисления и коды вместо строк,
+// тексты - по запросу (Advice::render(), getScientificNotes())
 struct RecommendationResult
 {
-    String cropType;
-    String growingType;
-    String season;
-    String soilType;  // Добавляем тип почвы
-    String recommendations;
-    String healthStatus;
-    String scientificNotes;
-    
+    CropId crop;
+    EnvironmentType growingType;
+    Season season;
+    bool seasonApplied;  // false - сезон неизвестен ("none"), без сезонной коррекции
+    SoilType soilType;
+    Advice::List recommendations;  // пусто - все параметры в норме
+    SoilHealth healthStatus;
+    uint8_t healthScore;
+
     // Новые поля для системного алгоритма
     CropConfig tableValues;              // Исходные табличные значения
     CropConfig growingTypeAdjusted;      // После коррекции типа выращивания
@@ -71,7 +101,7 @@ struct RecommendationResult
 class CropRecommendationEngine : public ICropRecommendationEngine
 {
    private:
-    std::map<String, CropConfig> cropConfigs;
+    // Табличные значения культур - CROP_TABLE во flash (business/crop_table.h)
 
     // Коэффициенты компенсации датчиков [Источник: SSSA Journal, 2008; Advances in Agronomy, 2014]
     const float pH_alpha = -0.01F;    // Температурный коэффициент для pH
@@ -83,21 +113,14 @@ class CropRecommendationEngine : public ICropRecommendationEngine
     // УДАЛЕНО: Функции компенсации датчиков
     // Используется SensorCompensationService для единообразной компенсации
 
-    void initializeCropConfigs();
     // ❌ УДАЛЕНО: Старые функции корректировок - заменены на системный алгоритм
     // ❌ УДАЛЕНО: applySeasonalAdjustments, applyGrowingTypeAdjustments, applySoilTypeAdjustments
-    String generateScientificRecommendations(const SensorData& data, const CropConfig& config, const String& cropType,
-                                             const String& soilType);
-    String calculateSoilHealthStatus(const SensorData& data, const CropConfig& config);
-    String generateScientificNotes(const SensorData& data, const CropConfig& config, const String& cropType,
-                                   const String& soilType);
+    // Коррекции типа выращивания, почвы и сезона - таблицы множителей в business/crop_corrections.h
+    Advice::List assessConditions(const SensorData& data, const CropConfig& config, CropId crop, SoilType soil);
+    static uint8_t calculateSoilHealthScore(const SensorData& data, const CropConfig& config);
     
     // Новые методы для системного алгоритма
-    CropConfig getTableValues(const String& cropType) const;
-    CropConfig applyGrowingTypeCorrection(const CropConfig& table, const String& growingType);
-    CropConfig applySoilTypeCorrection(const CropConfig& adjusted, const String& soilType);
-    CropConfig applySeasonalCorrection(const CropConfig& adjusted, const String& season);
-    CropConfig getScientificallyCompensated(const SensorData& data, const String& cropType);
+    CropConfig getScientificallyCompensated(const SensorData& data, CropId crop);
     CorrectionPercentages calculateCorrectionPercentages(const CropConfig& table, const CropConfig& final);
     ColorIndicators calculateColorIndicators(const CropConfig& final, const CropConfig& scientific);
 
@@ -113,6 +136,7 @@ class CropRecommendationEngine : public ICropRecommendationEngine
 
     // Получение конфигурации культуры
     CropConfig getCropConfig(const String& cropType) const override;
+    const CropConfig& getCropConfig(CropId cropId) const override;
 
     // Валидация данных с датчиков
     bool validateSensorData(const SensorData& data) const;
@@ -120,6 +144,9 @@ class CropRecommendationEngine : public ICropRecommendationEngine
     // Получение научных данных о культуре
     String getCropScientificInfo(const String& cropType) const;
 
+    // Научные комментарии по культуре и почве - текст собирается только по запросу
+    String getScientificNotes(CropId crop, SoilType soil) const;
+
     // Реализация интерфейса ICropRecommendationEngine
     RecValues computeRecommendations(const String& cropId, const SoilProfile& soilProfile,
                                      const EnvironmentType& envType) override;
@@ -127,6 +154,8 @@ class CropRecommendationEngine : public ICropRecommendationEngine
     void applySeasonalCorrection(RecValues& rec, Season season, bool isGreenhouse) override;
 
     // 🌱 Специфические рекомендации по культурам для неизмеряемых элементов
+    String generateCropSpecificRecommendations(CropId cropId, const NPKReferences& npk, SoilType soilType,
+                                               float pH) override;
     String generateCropSpecificRecommendations(const String& cropName, 
                                              const NPKReferences& npk,
                                              SoilType soilType, 
@@ -0,0 +1,58 @@
+/**
+ * @file crop_target_cache.cpp
+ * @brief Кэш рекомендуемых значений культур
+ * @details Читается из задачи веб-сервера; invalidateCropTargets() может прийти из
+ *          любой задачи, поэтому сброс - только увеличение атомарной ревизии,
+ *          а пересчёт выполняет читатель.
+ */
+
+#include "crop_target_cache.h"
+#include <atomic>
+#include "../../include/jxct_config_vars.h"
+
+namespace
+{
+CropTargets cropTargets;
+std::atomic<uint32_t> targetsRevision{1};
+uint32_t cachedRevision = 0;  // 0 - кэш пуст
+
+void rebuildCropTargets(Season season, bool seasonApplied)
+{
+    cropTargets.soil = soilTypeFromProfile(config.soilProfile);
+    cropTargets.environment = config.environmentType < ENVIRONMENT_TYPE_COUNT
+                                  ? static_cast<EnvironmentType>(config.environmentType)
+                                  : EnvironmentType::OUTDOOR;
+    cropTargets.seasonApplied = seasonApplied;
+    cropTargets.season = season;
+
+    const CropMultipliers& seasonal = seasonApplied ? seasonMultipliers(season) : NO_CORRECTION;
+    for (const auto& crop : CROP_TABLE)
+    {
+        const size_t index = static_cast<size_t>(crop.id);
+        cropTargets.corrected[index] =
+            applyCropCorrections(crop.config, cropTargets.environment, cropTargets.soil, seasonal);
+        for (size_t channel = 0; channel < CROP_CHANNEL_COUNT; ++channel)
+        {
+            cropTargets.inverse[channel][index] = 1.0F / (cropTargets.corrected[index].*CROP_CHANNELS[channel]);
+        }
+    }
+}
+}  // namespace
+
+const CropTargets& getCropTargets(Season season, bool seasonKnown)
+{
+    const bool seasonApplied = seasonKnown && config.flags.seasonalAdjustEnabled != 0;
+    const uint32_t revision = targetsRevision.load(std::memory_order_acquire);
+    if (cachedRevision != revision || cropTargets.seasonApplied != seasonApplied ||
+        (seasonApplied && cropTargets.season != season))
+    {
+        rebuildCropTargets(season, seasonApplied);
+        cachedRevision = revision;
+    }
+    return cropTargets;
+}
+
+void invalidateCropTargets()
+{
+    targetsRevision.fetch_add(1, std::memory_order_release);
+}
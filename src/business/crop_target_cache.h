@@ -0,0 +1,53 @@
+/**
+ * @file crop_target_cache.h
+ * @brief Кэш рекомендуемых значений культур
+ * @details Итоговые целевые значения (табличные с коррекциями среды, почвы и сезона)
+ *          зависят только от культуры, config.soilProfile, config.environmentType,
+ *          сезонной поправки и текущего сезона. Кэш держит их сразу для всех культур
+ *          текущих настроек: запрос показаний получает цель культуры одним индексом.
+ *          Пересчёт - после invalidateCropTargets() (saveConfig()) или смены сезона.
+ *          Рядом хранятся обратные значения целей по каналам (структура массивов) для
+ *          ранжирования культур по показанию (crop_ranking.h): деление заменяется
+ *          умножением, цикл по культурам - непрерывный массив float.
+ */
+
+#ifndef CROP_TARGET_CACHE_H
+#define CROP_TARGET_CACHE_H
+
+#include <array>
+#include "../../include/business/crop_corrections.h"
+#include "../../include/business/crop_table.h"
+
+// Каналы CropConfig в порядке полей: температура, влажность, EC, pH, N, P, K
+constexpr size_t CROP_CHANNEL_COUNT = 7;
+inline constexpr std::array<float CropConfig::*, CROP_CHANNEL_COUNT> CROP_CHANNELS = {
+    {&CropConfig::temperature, &CropConfig::humidity, &CropConfig::ec, &CropConfig::ph, &CropConfig::nitrogen,
+     &CropConfig::phosphorus, &CropConfig::potassium}};
+
+struct CropTargets
+{
+    std::array<CropConfig, CROP_COUNT> corrected;  // по CropId
+    // 1 / цель: [канал][CropId]
+    std::array<std::array<float, CROP_COUNT>, CROP_CHANNEL_COUNT> inverse;
+    SoilType soil = SoilType::LOAM;
+    EnvironmentType environment = EnvironmentType::OUTDOOR;
+    bool seasonApplied = false;  // false - сезон неизвестен или поправка выключена
+    Season season = Season::SPRING;
+
+    const CropConfig& operator[](CropId cropId) const
+    {
+        return corrected[static_cast<size_t>(cropId)];
+    }
+};
+
+/**
+ * @brief Целевые значения всех культур для текущих настроек
+ * @param season Текущий сезон
+ * @param seasonKnown false, пока время не синхронизировано (без сезонной коррекции)
+ */
+const CropTargets& getCropTargets(Season season, bool seasonKnown);
+
+// Сбрасывает кэш; вызывается из saveConfig() после изменения настроек
+void invalidateCropTargets();
+
+#endif  // CROP_TARGET_CACHE_H
@@ -8,10 +8,11 @@
 #include "../../include/logger.h"
 #include <cmath>
 
+using NutrientInteractions::Interaction;
+
 NutrientInteractionService::NutrientInteractionService()
 {
     logDebugSafe("NutrientInteractionService: Инициализация сервиса взаимодействия питательных веществ");
-    initializeInteractionCoefficients();
 }
 
 NPKReferences NutrientInteractionService::applyNutrientInteractions(const NPKReferences& npk, 
@@ -19,12 +20,12 @@ NPKReferences NutrientInteractionService::applyNutrientInteractions(const NPKRef
                                                                    float pH)
 {
     NPKReferences corrected = npk;
+    const NutrientInteractions::Factors factors = NutrientInteractions::computeFactors(npk);
     
     // ✅ РЕАЛЬНО ИЗМЕРЯЕМЫЕ ВЗАИМОДЕЙСТВИЯ
     
     // 1. N vs K антагонизм (Азот блокирует калий) - ИЗМЕРЯЕТСЯ!
-    float nk_antagonism = getAntagonismFactor("N", "K", npk.nitrogen, npk.potassium);
-    corrected.potassium *= nk_antagonism;
+    corrected.potassium *= get(factors, Interaction::NITROGEN_BLOCKS_POTASSIUM);
     
     // 2. pH-зависимые взаимодействия - pH ИЗМЕРЯЕТСЯ!
     if (pH > 7.5F) {
@@ -33,13 +34,8 @@ NPKReferences NutrientInteractionService::applyNutrientInteractions(const NPKRef
         corrected.phosphorus *= pca_antagonism;
     }
     
-    // 3. P vs K взаимодействие (измеряются оба!)
-    float pk_ratio = npk.phosphorus / npk.potassium;
-    if (pk_ratio > 0.8F) {
-        // Высокий фосфор может блокировать калий
-        float pk_antagonism = 1.0F - (0.15F * (pk_ratio - 0.8F));
-        corrected.potassium *= pk_antagonism;
-    }
+    // 3. P vs K взаимодействие (измеряются оба!): высокий фосфор может блокировать калий
+    corrected.potassium *= get(factors, Interaction::PHOSPHORUS_BLOCKS_POTASSIUM);
     
     logDebugSafe("NutrientInteractionService: Применены взаимодействия N:%.2f P:%.2f K:%.2f", 
                  corrected.nitrogen, corrected.phosphorus, corrected.potassium);
@@ -52,33 +48,8 @@ float NutrientInteractionService::getAntagonismFactor(const String& element1,
                                                      float ratio1, 
                                                      float ratio2)
 {
-    // Научные формулы антагонизма (Marschner, 2012)
-    
-    if (element1 == "N" && element2 == "K") {
-        // N vs K антагонизм: высокий азот блокирует калий
-        float n_ratio = ratio1 / 200.0F; // Оптимальное соотношение N:K = 1:1
-        if (n_ratio > 1.5F) {
-            return 1.0F - (0.3F * (n_ratio - 1.5F));
-        }
-    }
-    
-    if (element1 == "K" && element2 == "Mg") {
-        // K vs Mg антагонизм: высокий калий блокирует магний
-        float k_ratio = ratio1 / 200.0F; // Оптимальное соотношение K:Mg = 2:1
-        if (k_ratio > 2.5F) {
-            return 1.0F - (0.25F * (k_ratio - 2.5F));
-        }
-    }
-    
-    if (element1 == "P" && element2 == "Zn") {
-        // P vs Zn антагонизм: высокий фосфор блокирует цинк
-        float p_ratio = ratio1 / 100.0F; // Оптимальное соотношение P:Zn = 10:1
-        if (p_ratio > 15.0F) {
-            return 1.0F - (0.4F * (p_ratio - 15.0F) / 15.0F);
-        }
-    }
-    
-    return 1.0F; // Нет антагонизма
+    // Научные формулы антагонизма (Marschner, 2012) - таблица NutrientInteractions::INTERACTIONS
+    return pairFactor(element1, element2, NutrientInteractions::Effect::ANTAGONISM, ratio1, ratio2);
 }
 
 float NutrientInteractionService::getSynergyFactor(const String& element1, 
@@ -86,88 +57,84 @@ float NutrientInteractionService::getSynergyFactor(const String& element1,
                                                   float ratio1, 
                                                   float ratio2)
 {
-    // Научные формулы синергизма (White & Brown, 2010)
-    
-    if (element1 == "N" && element2 == "S") {
-        // N + S синергизм: сера усиливает усвоение азота
-        // Примечание: S не измеряется датчиком, используем оптимальное соотношение
-        float optimal_ns_ratio = 15.0F; // Оптимальное соотношение N:S = 15:1
-        float current_ratio = ratio1 / 10.0F; // Предполагаем среднее содержание S
-        
-        if (current_ratio < optimal_ns_ratio) {
-            return 1.0F + (0.15F * (optimal_ns_ratio - current_ratio) / optimal_ns_ratio);
-        }
-    }
-    
-    if (element1 == "Ca" && element2 == "B") {
-        // Ca + B синергизм: кальций улучшает транспорт бора
-        // Примечание: Ca и B не измеряются датчиком
-        return 1.0F + 0.1F; // Небольшой синергический эффект
+    // Научные формулы синергизма (White & Brown, 2010) - таблица NutrientInteractions::INTERACTIONS
+    return pairFactor(element1, element2, NutrientInteractions::Effect::SYNERGY, ratio1, ratio2);
+}
+
+float NutrientInteractionService::pairFactor(const String& element1, const String& element2,
+                                             NutrientInteractions::Effect effect, float amount1, float amount2)
+{
+    using namespace NutrientInteractions;
+    Nutrient from = Nutrient::COUNT;
+    Nutrient to = Nutrient::COUNT;
+    Interaction id = Interaction::COUNT;
+    if (!nutrientFromSymbol(element1.c_str(), from) || !nutrientFromSymbol(element2.c_str(), to) ||
+        !findInteraction(from, to, effect, id))
+    {
+        return 1.0F; // Нет взаимодействия
     }
-    
-    return 1.0F; // Нет синергизма
+    Amounts amounts{};
+    amounts[static_cast<size_t>(from)] = amount1;
+    amounts[static_cast<size_t>(to)] = amount2;
+    return factor(INTERACTIONS[static_cast<size_t>(id)], amounts);
 }
 
-String NutrientInteractionService::generateAntagonismRecommendations(const NPKReferences& npk,
-                                                                   SoilType soilType,
-                                                                   float pH)
+Advice::List NutrientInteractionService::assessAntagonisms(const NPKReferences& npk, SoilType /*soilType*/, float pH)
 {
-    String recommendations = "";
+    Advice::List advice;
     
     // ✅ РЕАЛЬНО ИЗМЕРЯЕМЫЕ ВЗАИМОДЕЙСТВИЯ
     
     // 1. N vs K антагонизм (измеряются оба!)
-    float nk_antagonism = getAntagonismFactor("N", "K", npk.nitrogen, npk.potassium);
+    const float nk_antagonism =
+        get(NutrientInteractions::computeFactors(npk), Interaction::NITROGEN_BLOCKS_POTASSIUM);
     if (nk_antagonism < 0.8F) {
-        recommendations += "⚠️ Высокий N → уменьшить N, увеличить K\n";
+        advice.add(Advice::Code::NITROGEN_BLOCKS_POTASSIUM, nk_antagonism, 0.8F);
     }
     
     // 2. pH-зависимые антагонизмы (pH измеряется!)
     if (pH > 7.5F) {
-        recommendations += "⚠️ Щелочная почва → подкислить\n";
+        advice.add(Advice::Code::ALKALINE_SOIL, pH, 7.5F);
     }
     
     // 3. P vs K взаимодействие (измеряются оба!)
+    const float pk_onset =
+        NutrientInteractions::INTERACTIONS[static_cast<size_t>(Interaction::PHOSPHORUS_BLOCKS_POTASSIUM)].onset;
     float pk_ratio = npk.phosphorus / npk.potassium;
-    if (pk_ratio > 0.8F) {
-        recommendations += "⚠️ Высокий P → уменьшить P, увеличить K\n";
+    if (pk_ratio > pk_onset) {
+        advice.add(Advice::Code::PHOSPHORUS_BLOCKS_POTASSIUM, pk_ratio, pk_onset);
     }
     
     // 🔍 РЕКОМЕНДАЦИИ ДЛЯ НЕИЗМЕРЯЕМЫХ ЭЛЕМЕНТОВ
     
     // 4. K vs Mg антагонизм (K измеряется, Mg - нет)
     if (npk.potassium > 400.0F) {
-        recommendations += "💡 Высокий K → внести MgSO4\n";
+        advice.add(Advice::Code::POTASSIUM_BLOCKS_MAGNESIUM, npk.potassium, 400.0F);
     }
     
     // 5. N + S синергизм (N измеряется, S - нет)
     if (npk.nitrogen > 300.0F) {
-        recommendations += "💡 Высокий N → внести серу\n";
+        advice.add(Advice::Code::NITROGEN_NEEDS_SULFUR, npk.nitrogen, 300.0F);
     }
     
     // 6. P vs Zn антагонизм (P измеряется, Zn - нет)
     if (npk.phosphorus > 200.0F) {
-        recommendations += "💡 Высокий P → внести цинк\n";
+        advice.add(Advice::Code::PHOSPHORUS_BLOCKS_ZINC, npk.phosphorus, 200.0F);
     }
     
     // 7. Ca + B синергизм (ни один не измеряется, но pH влияет)
     if (pH < 6.0F) {
-        recommendations += "💡 Кислая почва → известковать, бор\n";
+        advice.add(Advice::Code::ACIDIC_LIME_BORON, pH, 6.0F);
     }
     
-    if (recommendations.isEmpty()) {
-        recommendations = "✅ Антагонизмов питательных веществ не обнаружено";
-    }
-    
-    return recommendations;
+    return advice;
 }
 
-void NutrientInteractionService::initializeInteractionCoefficients()
+String NutrientInteractionService::generateAntagonismRecommendations(const NPKReferences& npk,
+                                                                   SoilType soilType,
+                                                                   float pH)
 {
-    // Инициализация коэффициентов взаимодействий
-    // Источник: [Marschner, 2012. Mineral Nutrition of Higher Plants]
-    
-    logDebugSafe("NutrientInteractionService: Коэффициенты взаимодействий инициализированы");
+    return Advice::render(assessAntagonisms(npk, soilType, pH), Advice::Code::NO_ANTAGONISMS);
 }
 
 NutrientInteractionService::~NutrientInteractionService()
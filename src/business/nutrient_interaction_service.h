@@ -8,7 +8,7 @@
 #define NUTRIENT_INTERACTION_SERVICE_H
 
 #include "../../include/business/INutrientInteractionService.h"
-#include <map>
+#include "../../include/business/nutrient_interactions.h"
 
 /**
  * @brief Реализация сервиса взаимодействия питательных веществ
@@ -24,11 +24,9 @@
 class NutrientInteractionService : public INutrientInteractionService
 {
 private:
-    // Карта коэффициентов взаимодействий
-    std::map<String, NutrientInteraction> interactionCoefficients;
-    
-    // Инициализация коэффициентов взаимодействий
-    void initializeInteractionCoefficients();
+    // Фактор пары по обозначениям элементов; коэффициенты - NutrientInteractions::INTERACTIONS
+    static float pairFactor(const String& element1, const String& element2, NutrientInteractions::Effect effect,
+                            float amount1, float amount2);
 
 public:
     /**
@@ -56,6 +54,8 @@ public:
                           float ratio1, 
                           float ratio2) override;
     
+    Advice::List assessAntagonisms(const NPKReferences& npk, SoilType soilType, float pH) override;
+
     String generateAntagonismRecommendations(const NPKReferences& npk,
                                            SoilType soilType,
                                            float pH) override;
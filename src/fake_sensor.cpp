@@ -13,6 +13,7 @@
 #include "business/sensor_calibration_service.h"
 #include "sensor_types.h"  // Для SoilProfile
 #include "sensor_processing.h"    // Общая логика обработки
+#include "wifi_manager.h"         // WebServerLock
 // Глобальные экземпляры бизнес-сервисов объявлены в business_instances.cpp
 extern SensorCalibrationService gCalibrationService;
 extern SensorCompensationService gCompensationService;
@@ -56,8 +57,12 @@ void fakeSensorTask(void* parameters)
     sensorData.phosphorus = npk.phosphorus;
     sensorData.potassium = npk.potassium;
 
-    // Применяем единую логику обработки данных датчика
-    SensorProcessing::processSensorData(sensorData, config);
+    // Применяем единую логику обработки данных датчика (калибровка и config - под блокировкой веб-состояния)
+    {
+        const WebServerLock webStateLock;
+        SensorProcessing::processSensorData(sensorData, config);
+        markSensorDataUpdated();
+    }
 
     DEBUG_PRINTLN("[fakeSensorTask] Сгенерированы начальные тестовые данные датчика");
 
@@ -98,8 +103,12 @@ void fakeSensorTask(void* parameters)
             sensorData.phosphorus = npk.phosphorus;
             sensorData.potassium = npk.potassium;
 
-            // Применяем единую логику обработки данных датчика
-            SensorProcessing::processSensorData(sensorData, config);
+            // Применяем единую логику обработки данных датчика (калибровка и config - под блокировкой веб-состояния)
+            {
+                const WebServerLock webStateLock;
+                SensorProcessing::processSensorData(sensorData, config);
+                markSensorDataUpdated();
+            }
 
 
 
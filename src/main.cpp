@@ -9,7 +9,6 @@
 #include <Arduino.h>
 #include <NTPClient.h>
 #include <WiFiClient.h>
-#include <WiFiClientSecure.h>
 #include <WiFiUdp.h>
 #include <esp_ota_ops.h>
 #include <esp_task_wdt.h>
@@ -29,6 +28,8 @@
 #include "ota_manager.h"
 #include "sensor_factory.h"
 #include "thingspeak_client.h"
+#include "uplink_sink.h"
+#include "uplink_tls_client.h"
 #include "version.h"     // ✅ Централизованное управление версией
 #include "web_routes.h"  // ✅ CSRF защита
 #include "wifi_manager.h"
@@ -56,10 +57,6 @@ unsigned long lastDataPublish = 0;
 unsigned long lastNtpUpdate = 0;
 
 unsigned long lastStatusPrint = 0;
-unsigned long mqttBatchTimer = 0;
-unsigned long thingspeakBatchTimer = 0;
-bool pendingMqttPublish = false;
-bool pendingThingspeakPublish = false;
 }  // namespace
 
 // Функции уже объявлены в соответствующих заголовочных файлах:
@@ -236,9 +233,12 @@ void setup()  // NOLINT(misc-use-internal-linkage)
         logSuccess("MQTT инициализирован");
     }
 
+    // Uplink-приёмники: MQTT, ThingSpeak, InfluxDB, HTTP JSON из общей очереди сэмплов
+    setupUplinkSinks();
+
     // Инициализация OTA 2.0 (проверка манифеста раз в час) через HTTPS
-    static WiFiClientSecure otaClient;
-    otaClient.setInsecure();  // временно отключаем проверку сертификата
+    // Кэш TLS-сессий + проверка цепочки по закреплённым корням (uplink_tls_anchors.h)
+    static UplinkTlsClient otaClient("ota");
     // Всегда устанавливаем URL манифеста для ручной и автоматической проверки
     // ИСПРАВЛЕНО - используем правильный URL манифеста
     // ВОЗВРАЩАЮ КАК РАБОТАЛО - /latest/download/
@@ -316,8 +316,11 @@ void loop()  // NOLINT(misc-use-internal-linkage)
         lastMemoryCheck = currentTime;
     }
 
-    // Обновление NTP каждые 6 часов
-    if (timeClient != nullptr && millis() - lastNtpUpdate > 6 * 3600 * 1000)
+    // Обновление NTP каждые 6 часов; пока время не получено - раз в NTP_UNSYNCED_RETRY_MS
+    // (веб-маршруты берут сезон только из уже синхронизированного времени и сами в сеть не ходят)
+    const unsigned long ntpInterval =
+        timeClient != nullptr && timeClient->isTimeSet() ? 6UL * 3600UL * 1000UL : NTP_UNSYNCED_RETRY_MS;
+    if (timeClient != nullptr && millis() - lastNtpUpdate > ntpInterval)
     {
         timeClient->forceUpdate();
         lastNtpUpdate = millis();
@@ -351,46 +354,25 @@ void loop()  // NOLINT(misc-use-internal-linkage)
         lastStatusPrint = currentTime;
     }
 
-    // === Проверяем наличие новых данных датчика (НАСТРАИВАЕМО v2.3.0) ===
-    if (sensorData.valid && (currentTime - lastDataPublish >= config.sensorReadInterval))
+    // ✅ config, кэши JSON и uplink-приёмники меняют обработчики задачи WebServer: под WebServerLock
+    // только шаг очереди приёмников (доставка ставится фоновым задачам или в handleMQTT()).
+    // Сетевые вызовы ниже идут без неё и сами берут блокировку вокруг чтения/записи общего
+    // состояния - задача веб-сервера не ждёт подключения к брокеру, WiFi или загрузки манифеста
+    bool autoOtaEnabled = false;
     {
-        pendingMqttPublish = true;
-        pendingThingspeakPublish = true;
-        lastDataPublish = currentTime;
-        DEBUG_PRINTLN("[BATCH] Новые данные помечены для групповой отправки");
-    }
-
-    // ✅ Групповая отправка MQTT (настраиваемо v2.3.0)
-    if (pendingMqttPublish && (currentTime - mqttBatchTimer >= config.mqttPublishInterval))
-    {
-        publishSensorData();
-        pendingMqttPublish = false;
-        mqttBatchTimer = currentTime;
-        DEBUG_PRINTLN("[BATCH] MQTT данные отправлены группой");
-    }
+        WebServerLock webStateLock;
 
-    // ✅ Групповая отправка ThingSpeak (настраиваемо v2.3.0)
-    if (pendingThingspeakPublish && (currentTime - thingspeakBatchTimer >= config.thingSpeakInterval))
-    {
-        // ✅ ДОБАВЛЕНО: Предварительная проверка возможности отправки
-        if (canSendToThingSpeak())
+        // === Проверяем наличие новых данных датчика (НАСТРАИВАЕМО v2.3.0) ===
+        if (sensorData.valid && (currentTime - lastDataPublish >= config.sensorReadInterval))
         {
-            const bool tsOk = sendDataToThingSpeak();
-            if (tsOk)
-            {
-                thingspeakBatchTimer = currentTime;  // Сбрасываем таймер только при успешной отправке
-                DEBUG_PRINTLN("[BATCH] ThingSpeak данные отправлены группой");
-            }
-            else
-            {
-                DEBUG_PRINTLN("[BATCH] ThingSpeak отправка не удалась, повтор через следующий интервал");
-            }
+            publishUplinkSample();  // ✅ Сэмпл в общую очередь uplink-приёмников
+            lastDataPublish = currentTime;
+            DEBUG_PRINTLN("[BATCH] Новые данные поставлены в очередь выгрузки");
         }
-        else
-        {
-            DEBUG_PRINTLN("[BATCH] ThingSpeak отправка заблокирована (ограничения/ошибки)");
-        }
-        pendingThingspeakPublish = false;
+
+        // ✅ Доставка MQTT / ThingSpeak / InfluxDB / HTTP JSON по политикам приёмников (неблокирующе)
+        handleUplinkSinks();
+        autoOtaEnabled = config.flags.autoOtaEnabled;
     }
 
     // ✅ Управление MQTT (каждые 100мс)
@@ -409,13 +391,16 @@ void loop()  // NOLINT(misc-use-internal-linkage)
         lastWiFiCheck = currentTime;
     }
 
-    // Проверяем OTA раз в час (или при принудительной проверке)
+    // Проверяем OTA раз в час (или при принудительной проверке); если сессию держит фоновая
+    // выгрузка, повторяем через OTA_SESSION_BUSY_RETRY_MS вместо ожидания в loop()
     static unsigned long lastOtaCheck = 0;
-    if (config.flags.autoOtaEnabled && (currentTime - lastOtaCheck >= 3600000UL))
+    static unsigned long otaCheckInterval = 3600000UL;
+    if (autoOtaEnabled && (currentTime - lastOtaCheck >= otaCheckInterval))
     {
-        handleOTA();
+        otaCheckInterval = handleOTA() ? 3600000UL : OTA_SESSION_BUSY_RETRY_MS;
         lastOtaCheck = currentTime;
     }
+    retryPendingOtaCheck();  // ручная проверка, отложенная из-за занятой сессии
 
     // ✅ Минимальная задержка для стабильности (10мс вместо 100мс)
     vTaskDelay(10 / portTICK_PERIOD_MS);
@@ -7,6 +7,7 @@
 #include "modbus_sensor.h"
 #include <Arduino.h>
 #include <algorithm>           // для std::min
+#include <atomic>
 #include "advanced_filters.h"  // ✅ Улучшенная система фильтрации
 #include "business_services.h"
 #include "calibration_manager.h"
@@ -18,6 +19,7 @@
 #include "sensor_processing.h"  // Общая логика обработки
 #include "sensor_types.h"
 #include "validation_utils.h"  // Для централизованной валидации
+#include "wifi_manager.h"     // WebServerLock
 #include "sensor_correction.h"  // ✅ Система коррекции показаний
 
 // Глобальные переменные (должны быть доступны через extern)
@@ -27,6 +29,7 @@ namespace
 // Внутренние переменные с внутренней связностью
 ModbusMaster modbus;
 String sensorLastError;
+std::atomic<uint32_t> sensorDataGeneration{0};  // Пишет задача датчика, читает веб-сервер
 
 // Структура для устранения проблемы с легко перепутываемыми параметрами
 struct RegisterConversion
@@ -172,7 +175,8 @@ void updateIrrigationFlag(ModbusSensorData& data)
 
 void applyCompensationIfEnabled(ModbusSensorData& data)
 {
-    // Применяем единую логику обработки данных датчика
+    // Калибровку и config меняют обработчики задачи WebServer - читаем их под той же блокировкой
+    const WebServerLock webStateLock;
     SensorProcessing::processSensorData(data, config);
 }
 
@@ -520,6 +524,7 @@ void finalizeSensorData(bool success)
     if (!success)
     {
         logError("❌ Не удалось прочитать один или несколько параметров");
+        markSensorDataUpdated();
         return;
     }
 
@@ -542,6 +547,7 @@ void finalizeSensorData(bool success)
         logWarn("⚠️ Данные прочитаны, но не прошли валидацию");
         sensorData.valid = false;
     }
+    markSensorDataUpdated();
 }
 }  // namespace
 
@@ -762,6 +768,16 @@ String& getSensorLastError()
     return sensorLastError;
 }  // NOLINT(misc-use-internal-linkage)
 
+void markSensorDataUpdated()  // NOLINT(misc-use-internal-linkage)
+{
+    sensorDataGeneration.fetch_add(1, std::memory_order_release);
+}
+
+uint32_t getSensorDataGeneration()  // NOLINT(misc-use-internal-linkage)
+{
+    return sensorDataGeneration.load(std::memory_order_acquire);
+}
+
 // Функции доступа к глобальным переменным
 ModbusSensorData& getSensorDataRef()
 {
@@ -136,6 +136,11 @@ extern ModbusSensorData sensorData;
 extern SensorCache sensorCache;
 String& getSensorLastError();
 
+// Поколение показаний: растёт при каждом обновлении sensorData (реальный или тестовый датчик).
+// Потребители сравнивают его с сохранённым значением, чтобы не пересчитывать производные данные
+void markSensorDataUpdated();
+uint32_t getSensorDataGeneration();
+
 // Получение текущих данных датчика
 ModbusSensorData getSensorData();
 
@@ -34,7 +34,7 @@ void publishAvailabilityInternal(bool online);
 void setupMQTTInternal();
 bool connectMQTTInternal();
 void handleMQTTInternal();
-void publishSensorDataInternal();
+MqttPublishResult publishSensorDataInternal();
 void publishHomeAssistantConfigInternal();
 void removeHomeAssistantConfigInternal();
 void handleMqttCommandInternal(const String& cmd);
@@ -75,10 +75,16 @@ std::array<char, 128> mqttLastErrorBuffer = {""};
 // Буферы для идентификаторов и топиков
 std::array<char, 32> clientIdBuffer = {""};
 std::array<char, 128> statusTopicBuffer = {""};
+std::array<char, 128> stateTopicBuffer = {""};
 std::array<char, 128> commandTopicBuffer = {""};
 std::array<char, 128> otaStatusTopicBuffer = {""};
 std::array<char, 128> otaCommandTopicBuffer = {""};
 
+// Публикация по запросу uplink-приёмника: ставится под WebServerLock, выполняется handleMQTT() вне его
+bool sensorPublishRequested = false;
+bool sensorPublishResultReady = false;
+MqttPublishResult sensorPublishResult = MqttPublishResult::NOT_CONNECTED;
+
 // Кэш JSON датчиков
 std::array<char, 256> cachedSensorJson = {""};
 unsigned long lastCachedSensorTime = 0;
@@ -255,28 +261,45 @@ bool connectMQTTInternal()
         return false;
     }
 
+    // Параметры копируются под WebServerLock: подключение к брокеру длится до таймаута сокета,
+    // а config в это время может сохранить обработчик веб-сервера
+    static std::array<char, sizeof(Config::mqttServer)> server = {""};  // PubSubClient хранит указатель
+    std::array<char, sizeof(Config::mqttUser)> user = {""};
+    std::array<char, sizeof(Config::mqttPassword)> password = {""};
+    std::array<char, sizeof(Config::mqttDeviceName)> clientId = {""};
+    uint16_t port = 0;
+    const char* willTopic = nullptr;
+    {
+        const WebServerLock webStateLock;
+        strlcpy(server.data(), config.mqttServer, server.size());
+        strlcpy(user.data(), config.mqttUser, user.size());
+        strlcpy(password.data(), config.mqttPassword, password.size());
+        strlcpy(clientId.data(), getMqttClientName(), clientId.size());
+        port = config.mqttPort;
+        willTopic = getStatusTopic();  // Кэшируется в буфере при первом вызове
+    }
+
     // Расширенная проверка параметров
-    if (strlen(config.mqttServer) == 0)
+    if (strlen(server.data()) == 0)
     {
         ERROR_PRINTLN("[ОШИБКА] Не указан MQTT-сервер");
         return false;
     }
 
     // Попытка подключения с максимальной детализацией
-    const char* const clientId = getMqttClientName();
-    DEBUG_PRINTF("[MQTT] Сервер: %s\n", config.mqttServer);
-    DEBUG_PRINTF("[MQTT] Порт: %d\n", config.mqttPort);
-    DEBUG_PRINTF("[MQTT] ID клиента: %s\n", clientId);
-    DEBUG_PRINTF("[MQTT] Пользователь: %s\n", config.mqttUser);
-    DEBUG_PRINTF("[MQTT] Пароль: %s\n", config.mqttPassword);
+    DEBUG_PRINTF("[MQTT] Сервер: %s\n", server.data());
+    DEBUG_PRINTF("[MQTT] Порт: %d\n", port);
+    DEBUG_PRINTF("[MQTT] ID клиента: %s\n", clientId.data());
+    DEBUG_PRINTF("[MQTT] Пользователь: %s\n", user.data());
+    DEBUG_PRINTF("[MQTT] Пароль: %s\n", password.data());
 
-    mqttClient.setServer(config.mqttServer, config.mqttPort);
+    mqttClient.setServer(server.data(), port);
 
     // Попытка подключения с максимально подробной информацией
-    const bool result = mqttClient.connect(clientId,
-                                           config.mqttUser,      // может быть пустым
-                                           config.mqttPassword,  // может быть пустым
-                                           getStatusTopic(),
+    const bool result = mqttClient.connect(clientId.data(),
+                                           user.data(),      // может быть пустым
+                                           password.data(),  // может быть пустым
+                                           willTopic,
                                            1,         // QoS
                                            true,      // retain
                                            "offline"  // will message
@@ -354,11 +377,8 @@ bool connectMQTTInternal()
         // Публикуем статус availability
         publishAvailabilityInternal(true);
 
-        // Публикуем конфигурацию Home Assistant discovery если включено
-        if (config.flags.hassEnabled)
-        {
-            publishHomeAssistantConfigInternal();
-        }
+        // Публикуем конфигурацию Home Assistant discovery (функция сама проверяет hassEnabled)
+        publishHomeAssistantConfigInternal();
 
         // Принудительная первичная публикация состояния сразу после подключения к MQTT
         // Даже если данные ещё не валидны — чтобы HA сразу получил state
@@ -370,8 +390,19 @@ bool connectMQTTInternal()
 
 void handleMQTTInternal()
 {
-    if (!config.flags.mqttEnabled)
+    bool enabled = false;
     {
+        const WebServerLock webStateLock;
+        enabled = config.flags.mqttEnabled;
+    }
+    if (!enabled)
+    {
+        if (sensorPublishRequested)
+        {
+            sensorPublishRequested = false;
+            sensorPublishResult = MqttPublishResult::NOT_CONNECTED;
+            sensorPublishResultReady = true;
+        }
         return;
     }
 
@@ -418,6 +449,14 @@ void handleMQTTInternal()
             lastOtaPublish = millis();
         }
     }
+
+    // Публикация, запрошенная uplink-приёмником MQTT: сеть - здесь, вне блокировки веб-сервера
+    if (sensorPublishRequested)
+    {
+        sensorPublishRequested = false;
+        sensorPublishResult = publishSensorDataInternal();
+        sensorPublishResultReady = true;
+    }
 }
 
 // ДЕЛЬТА-ФИЛЬТР v2.2.1: Проверка необходимости публикации
@@ -455,10 +494,9 @@ bool shouldPublishMqtt()
 
     {
         // Сравнение по ASM вместо VWC
-        SensorCompensationService compensationService;
         const SoilType soil = SensorProcessing::getSoilType(config.soilProfile);
-        const float prevAsm = compensationService.vwcToAsm(sensorData.prev_humidity / 100.0F, soil);
-        const float curAsm = compensationService.vwcToAsm(sensorData.humidity / 100.0F, soil);
+        const float prevAsm = SensorCompensationService::vwcToAsm(sensorData.prev_humidity / 100.0F, soil);
+        const float curAsm = SensorCompensationService::vwcToAsm(sensorData.humidity / 100.0F, soil);
         if (fabsf(curAsm - prevAsm) >= config.deltaHumidityAsm)
         {
             DEBUG_PRINTF("[DELTA] Влажность (ASM) изменилась: %.1f%% -> %.1f%% (дельта=%.1f)\n", prevAsm, curAsm,
@@ -521,17 +559,22 @@ bool shouldPublishMqtt()
     return hasSignificantChange;
 }
 
-void publishSensorDataInternal()
+// Собирает JSON показаний в cachedSensorJson и топик state; вызывается под WebServerLock.
+// PUBLISHED - JSON готов к публикации, иначе - причина, по которой публиковать нечего
+MqttPublishResult buildSensorStateJson()
 {
-    DEBUG_PRINTF("[MQTT DEBUG] mqttEnabled=%d, connected=%d, valid=%d\n", config.flags.mqttEnabled,
-                 mqttClient.connected(), sensorData.valid);
+    DEBUG_PRINTF("[MQTT DEBUG] mqttEnabled=%d, valid=%d\n", config.flags.mqttEnabled, sensorData.valid);
 
     // Разрешаем первую публикацию даже при невалидных данных (после перезапуска)
     const bool allowFirstBootPublish = (sensorData.last_mqtt_publish == 0);
-    if (!config.flags.mqttEnabled || !mqttClient.connected() || (!sensorData.valid && !allowFirstBootPublish))
+    if (!config.flags.mqttEnabled)
     {
-        DEBUG_PRINTLN("[MQTT DEBUG] Условия не выполнены, публикация отменена");
-        return;
+        return MqttPublishResult::NOT_CONNECTED;
+    }
+    if (!sensorData.valid && !allowFirstBootPublish)
+    {
+        DEBUG_PRINTLN("[MQTT DEBUG] Данные невалидны, публикация отменена");
+        return MqttPublishResult::UNCHANGED;
     }
 
     // ДЕЛЬТА-ФИЛЬТР v2.2.1: Проверяем необходимость публикации
@@ -539,7 +582,7 @@ void publishSensorDataInternal()
     if (!allowFirstBootPublish && !shouldPublishMqtt())
     {
         DEBUG_PRINTLN("[MQTT DEBUG] Дельты не изменились, публикация отменена");
-        return;
+        return MqttPublishResult::UNCHANGED;
     }
 
     DEBUG_PRINTLN("[MQTT DEBUG] Начинаем публикацию данных...");
@@ -563,10 +606,9 @@ void publishSensorDataInternal()
         // ✅ ОПТИМИЗАЦИЯ 3.1: Сокращенные ключи для экономии трафика
         doc["t"] = round(sensorData.temperature * 10) / 10.0;                        // temperature → t (-10 байт)
         // Влажность: публикуем ASM в h и VWC в hv (обратная совместимость)
-        SensorCompensationService compensationService;
         const SoilType soil = SensorProcessing::getSoilType(config.soilProfile);
         const float vwcFraction = sensorData.humidity / 100.0F; // sensorData.humidity хранит VWC в %
-        const float asmPercent = compensationService.vwcToAsm(vwcFraction, soil);
+        const float asmPercent = SensorCompensationService::vwcToAsm(vwcFraction, soil);
         doc["h"] = round(asmPercent * 10) / 10.0;                                    // humidity (ASM) → h
         doc["hv"] = round(sensorData.humidity * 10) / 10.0;                          // humidity (VWC) → hv
         doc["e"] = static_cast<int>(round(sensorData.ec));                            // ec → e (стабильно)
@@ -588,47 +630,64 @@ void publishSensorDataInternal()
     }
 
     // ✅ Кэшируем топик публикации
-    static std::array<char, 128> stateTopicBuffer = {""};
-    static bool stateTopicCached = false;
-    if (!stateTopicCached)
+    if (stateTopicBuffer[0] == '\0')
     {
         snprintf(stateTopicBuffer.data(), stateTopicBuffer.size(), "%s/state", config.mqttTopicPrefix);
-        stateTopicCached = true;
     }
+    return MqttPublishResult::PUBLISHED;
+}
 
-    // Публикуем кэшированный JSON
-    bool res = mqttClient.publish(stateTopicBuffer.data(), cachedSensorJson.data(), true);
-
-    if (res)
+MqttPublishResult publishSensorDataInternal()
+{
+    if (!mqttClient.connected())
     {
-        mqttLastErrorBuffer.fill('\0');
-
-        // ДЕЛЬТА-ФИЛЬТР v2.2.1: Сохраняем текущие значения как предыдущие
-        // Даже если это была публикация при невалидных данных первого запуска — фиксируем базовую точку
-        sensorData.prev_temperature = sensorData.temperature;
-        sensorData.prev_humidity = sensorData.humidity; // prev хранит VWC, для дельты конвертируем в ASM динамически
-        sensorData.prev_ec = sensorData.ec;
-        sensorData.prev_ph = sensorData.ph;
-        sensorData.prev_nitrogen = sensorData.nitrogen;
-        sensorData.prev_phosphorus = sensorData.phosphorus;
-        sensorData.prev_potassium = sensorData.potassium;
-        sensorData.last_mqtt_publish = millis();
+        DEBUG_PRINTLN("[MQTT DEBUG] Нет соединения с брокером, публикация отменена");
+        return MqttPublishResult::NOT_CONNECTED;
+    }
 
-        DEBUG_PRINTLN("[MQTT] Данные опубликованы, предыдущие значения обновлены");
+    // config и sensorData меняют задачи веб-сервера и датчика: JSON собирается под их блокировкой,
+    // публикация идёт вне её
+    {
+        const WebServerLock webStateLock;
+        const MqttPublishResult prepared = buildSensorStateJson();
+        if (prepared != MqttPublishResult::PUBLISHED)
+        {
+            return prepared;
+        }
     }
-    else
+
+    // Публикуем кэшированный JSON
+    if (!mqttClient.publish(stateTopicBuffer.data(), cachedSensorJson.data(), true))
     {
         strlcpy(mqttLastErrorBuffer.data(), "Ошибка публикации MQTT", mqttLastErrorBuffer.size());
+        return MqttPublishResult::FAILED;
     }
+    mqttLastErrorBuffer.fill('\0');
+
+    const WebServerLock webStateLock;
+
+    // ДЕЛЬТА-ФИЛЬТР v2.2.1: Сохраняем текущие значения как предыдущие
+    // Даже если это была публикация при невалидных данных первого запуска — фиксируем базовую точку
+    sensorData.prev_temperature = sensorData.temperature;
+    sensorData.prev_humidity = sensorData.humidity; // prev хранит VWC, для дельты конвертируем в ASM динамически
+    sensorData.prev_ec = sensorData.ec;
+    sensorData.prev_ph = sensorData.ph;
+    sensorData.prev_nitrogen = sensorData.nitrogen;
+    sensorData.prev_phosphorus = sensorData.phosphorus;
+    sensorData.prev_potassium = sensorData.potassium;
+    sensorData.last_mqtt_publish = millis();
+
+    DEBUG_PRINTLN("[MQTT] Данные опубликованы, предыдущие значения обновлены");
+    return MqttPublishResult::PUBLISHED;
 }
 
-void publishHomeAssistantConfigInternal()
+// Собирает discovery-конфиги в haConfigCache; вызывается под WebServerLock. false - публикация не нужна
+bool buildHomeAssistantConfigs()
 {
-    DEBUG_PRINTLN("[publishHomeAssistantConfig] Публикация discovery-конфигов Home Assistant...");
-    if (!config.flags.mqttEnabled || !mqttClient.connected() || !config.flags.hassEnabled)
+    if (!config.flags.mqttEnabled || !config.flags.hassEnabled)
     {
         DEBUG_PRINTLN("[publishHomeAssistantConfig] Условия не выполнены, публикация отменена");
-        return;
+        return false;
     }
 
     const String deviceIdStr = getDeviceId();
@@ -747,6 +806,26 @@ void publishHomeAssistantConfigInternal()
         haConfigCache.isValid = true;
         INFO_PRINTLN("[HA] Конфигурации созданы и закэшированы");
     }
+    return true;
+}
+
+void publishHomeAssistantConfigInternal()
+{
+    DEBUG_PRINTLN("[publishHomeAssistantConfig] Публикация discovery-конфигов Home Assistant...");
+    if (!mqttClient.connected())
+    {
+        DEBUG_PRINTLN("[publishHomeAssistantConfig] Нет соединения с брокером, публикация отменена");
+        return;
+    }
+
+    // Кэш конфигураций собирается из config под WebServerLock, публикация идёт вне его
+    {
+        const WebServerLock webStateLock;
+        if (!buildHomeAssistantConfigs())
+        {
+            return;
+        }
+    }
 
     // ✅ Публикуем из кэша (супер быстро!)
     mqttClient.publish(pubTopicCache[0].data(), haConfigCache.tempConfig.data(), true);
@@ -787,7 +866,10 @@ void handleMqttCommandInternal(const String& cmd)
     }
     else if (cmd == "reset")
     {
-        resetConfig();
+        {
+            const WebServerLock webStateLock;  // Команды приходят из mqttClient.loop() вне блокировки
+            resetConfig();
+        }
         ESP.restart();
     }
     else if (cmd == "publish_test")
@@ -804,13 +886,15 @@ void handleMqttCommandInternal(const String& cmd)
     }
     else if (cmd == "ota_check")
     {
-        triggerOtaCheck();
-        handleOTA();
+        triggerOtaCheck();  // занятая сессия - проверка повторится из loop()
     }
     else if (cmd == "ota_auto_on" || cmd == "ota_auto_off")
     {
-        config.flags.autoOtaEnabled = (cmd == "ota_auto_on") ? 1 : 0;
-        saveConfig();
+        {
+            const WebServerLock webStateLock;
+            config.flags.autoOtaEnabled = (cmd == "ota_auto_on") ? 1 : 0;
+            saveConfig();
+        }
         publishAvailabilityInternal(true);
     }
     else
@@ -859,9 +943,26 @@ void handleMQTT()
     handleMQTTInternal();
 }
 
-void publishSensorData()
+MqttPublishResult publishSensorData()
+{
+    return publishSensorDataInternal();
+}
+
+void requestSensorDataPublish()  // NOLINT(misc-use-internal-linkage)
+{
+    sensorPublishRequested = true;
+    sensorPublishResultReady = false;
+}
+
+bool takeSensorDataPublishResult(MqttPublishResult& result)  // NOLINT(misc-use-internal-linkage)
 {
-    publishSensorDataInternal();
+    if (!sensorPublishResultReady)
+    {
+        return false;
+    }
+    sensorPublishResultReady = false;
+    result = sensorPublishResult;
+    return true;
 }
 
 void publishHomeAssistantConfig()
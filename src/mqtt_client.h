@@ -29,8 +29,22 @@ bool connectMQTT();
 // Обработка MQTT (вызывать в loop)
 void handleMQTT();
 
+// Результат публикации показаний
+enum class MqttPublishResult : uint8_t
+{
+    PUBLISHED,      // Показания опубликованы
+    UNCHANGED,      // Изменения ниже дельта-фильтра или данных ещё нет - публиковать нечего
+    NOT_CONNECTED,  // MQTT выключен или нет соединения с брокером
+    FAILED          // Брокер не принял публикацию
+};
+
 // Публикация данных с датчика
-void publishSensorData();
+MqttPublishResult publishSensorData();
+
+// Отложенная публикация для uplink-приёмника: запрос ставится под WebServerLock, публикацию
+// выполняет handleMQTT() вне блокировки; false - итога ещё нет
+void requestSensorDataPublish();
+bool takeSensorDataPublishResult(MqttPublishResult& result);
 
 // Публикация конфигурации для Home Assistant
 void publishHomeAssistantConfig();
@@ -8,9 +8,12 @@
 #include <mbedtls/sha256.h>
 #include <strings.h>
 #include <array>
+#include <atomic>
 #include "jxct_config_vars.h"
 #include "logger.h"
+#include "uplink_http_session.h"
 #include "version.h"
+#include "wifi_manager.h"  // WebServerLock
 
 // Глобальные переменные для OTA 2.0
 namespace
@@ -28,6 +31,10 @@ String pendingUpdateUrl = "";
 String pendingUpdateSha256 = "";
 String pendingUpdateVersion = "";
 
+// Ручная проверка упёрлась в занятую сессию исходящих запросов - повторяется из loop()
+bool manualCheckRetryPending = false;
+unsigned long manualCheckAttemptMs = 0;
+
 std::array<char, 8> guardSentinel = {"GUARD!"};  // часовой после URL, как раньше
 }  // namespace
 
@@ -438,21 +445,40 @@ static bool downloadAndUpdate(const String& binUrl, const char* expectedSha256)
     return true;
 }
 
-// Принудительная проверка OTA (игнорирует таймер)
-void triggerOtaCheck()  // NOLINT(misc-use-internal-linkage)
+// Принудительная проверка OTA (игнорирует таймер); false - сессия занята, проверка повторится сама
+bool triggerOtaCheck()  // NOLINT(misc-use-internal-linkage)
 {
-    static bool isChecking = false;
+    // Вызывается и из задачи веб-сервера (кнопка), и из loop() (повтор, MQTT-команда)
+    static std::atomic<bool> isChecking{false};
 
-    if (isChecking)
+    if (isChecking.exchange(true))
     {
         logWarn("[OTA] Проверка уже выполняется, пропускаем");
-        return;
+        return true;
     }
 
-    isChecking = true;
     logSystem("[OTA] Принудительная проверка OTA запущена");
-    handleOTA();
+    const bool completed = handleOTA();
     isChecking = false;
+
+    const WebServerLock webStateLock;
+    manualCheckRetryPending = !completed;
+    manualCheckAttemptMs = millis();
+    return completed;
+}
+
+// Повтор ручной проверки, отложенной из-за занятой сессии (вызывается из loop() вне блокировки)
+void retryPendingOtaCheck()  // NOLINT(misc-use-internal-linkage)
+{
+    bool due = false;
+    {
+        const WebServerLock webStateLock;
+        due = manualCheckRetryPending && millis() - manualCheckAttemptMs >= OTA_SESSION_BUSY_RETRY_MS;
+    }
+    if (due)
+    {
+        triggerOtaCheck();
+    }
 }
 
 // Принудительная установка найденного обновления
@@ -488,7 +514,7 @@ void triggerOtaInstall()  // NOLINT(misc-use-internal-linkage)
     }
 }
 
-void handleOTA()  // NOLINT(misc-use-internal-linkage)
+bool handleOTA()  // NOLINT(misc-use-internal-linkage)
 {
     // ДОБАВЛЕНО: Детальная диагностика для отладки
     static unsigned long debugCallCount = 0;
@@ -501,7 +527,7 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
     if (!urlInitialized || strlen(manifestUrlGlobal.data()) == 0)
     {
         logError("[OTA] [DEBUG] OTA не инициализирован или URL пуст - выходим");
-        return;
+        return true;
     }
 
     // КРИТИЧЕСКАЯ ПРОВЕРКА: Проверяем целостность URL перед использованием
@@ -510,7 +536,7 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
         logErrorSafe("\1", manifestUrlGlobal.data());
         logError("[OTA] [DEBUG] Переинициализируем OTA...");
         urlInitialized = false;  // Сбрасываем флаг для переинициализации
-        return;
+        return true;
     }
 
     logSystemSafe("\1", debugCallCount, manifestUrlGlobal.data());
@@ -518,23 +544,29 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
     if (clientPtr == nullptr)
     {
         logError("[OTA] [DEBUG] clientPtr не задан - выходим");
-        return;
+        return true;
     }
 
     logSystem("[OTA] [DEBUG] Начинаем проверку обновлений...");
     logSystemSafe("\1", manifestUrlGlobal.data());
     strlcpy(statusBuf.data(), "Проверка обновлений", sizeof(statusBuf));
 
-    HTTPClient http;
-    logSystem("[OTA] [DEBUG] Инициализируем HTTP клиент...");
-    http.begin(*clientPtr, manifestUrlGlobal.data());
-    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-    http.setTimeout(15000);  // 15 секунд таймаут
-
+    // ✅ ОПТИМИЗАЦИЯ: Манифест запрашивается через общую keep-alive сессию исходящих запросов
     logSystem("[OTA] [DEBUG] Отправляем GET запрос...");
-    int code = http.GET();
+    String manifestContent;
+    const int code = getUplinkSession().get(*clientPtr, manifestUrlGlobal.data(), manifestContent,
+                                            15000,  // 15 секунд таймаут
+                                            true);  // манифест GitHub отдаётся через редирект
     esp_task_wdt_reset();
 
+    // Сессию держит фоновая выгрузка (до минуты) - не ждём её, проверка будет повторена
+    if (code == UPLINK_SESSION_BUSY)
+    {
+        strlcpy(statusBuf.data(), "Сеть занята, повтор", sizeof(statusBuf));
+        logSystem("[OTA] Сессия исходящих запросов занята - проверка отложена");
+        return false;
+    }
+
     logSystemSafe("\1", code);
 
     if (code != HTTP_CODE_OK)
@@ -560,13 +592,10 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
             logError("[OTA] [DEBUG] -11 - таймаут подключения");
         }
 
-        http.end();
-        return;
+        return true;
     }
 
-    String manifestContent = http.getString();
     const unsigned int contentLength = manifestContent.length();
-    http.end();
 
     logSystemSafe("\1", contentLength);
 
@@ -579,7 +608,7 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
     {
         logError("[OTA] [DEBUG] Манифест не начинается с '{' - возможно HTML ошибка");
         strlcpy(statusBuf.data(), "Неверный формат", sizeof(statusBuf));
-        return;
+        return true;
     }
 
     const size_t capacity = JSON_OBJECT_SIZE(3) + 300;  // Увеличиваем буфер
@@ -590,7 +619,7 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
         strlcpy(statusBuf.data(), "Ошибка JSON", sizeof(statusBuf));
         logErrorSafe("\1", err.c_str());
         logErrorSafe("\1", manifestContent.c_str());
-        return;
+        return true;
     }
 
     const char* newVersion = doc["version"] | "";
@@ -608,24 +637,27 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
     {
         logError("[OTA] [DEBUG] Поле 'version' пустое или отсутствует");
         strlcpy(statusBuf.data(), "Нет версии в манифесте", sizeof(statusBuf));
-        return;
+        return true;
     }
     if (strlen(binUrl) == 0)
     {
         logError("[OTA] [DEBUG] Поле 'url' пустое или отсутствует");
         strlcpy(statusBuf.data(), "Нет URL в манифесте", sizeof(statusBuf));
-        return;
+        return true;
     }
     if (strlen(sha256) != 64U)
     {
         logErrorSafe("\1", static_cast<unsigned int>(strlen(sha256)));
         strlcpy(statusBuf.data(), "Неверная подпись", sizeof(statusBuf));
-        return;
+        return true;
     }
 
     // Проверка версий
     logSystemSafe("\1", newVersion, JXCT_VERSION_STRING);
 
+    // Сведения об обновлении читают обработчики веб-сервера: запись под WebServerLock, манифест
+    // загружен выше без неё
+    const WebServerLock webStateLock;
     if (strcmp(newVersion, JXCT_VERSION_STRING) == 0)
     {
         strlcpy(statusBuf.data(), "Актуальная версия", sizeof(statusBuf));
@@ -634,7 +666,7 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
         pendingUpdateSha256 = "";
         pendingUpdateVersion = "";
         logSystem("[OTA] [DEBUG] Версии совпадают - обновление не требуется");
-        return;
+        return true;
     }
 
     // Сохраняем информацию об обновлении
@@ -650,4 +682,5 @@ void handleOTA()  // NOLINT(misc-use-internal-linkage)
     logSystemSafe("\1", binUrl);
     logSystemSafe("\1", sha256);
     logSystem("[OTA] [DEBUG] Ожидаем подтверждения установки через веб-интерфейс");
+    return true;
 }
@@ -115,20 +115,13 @@ void processSensorData(SensorData& sensorData, const Config& config) {
         
         const SoilType soil = getSoilType(config.soilProfile);
         
-        // EC: консервативная температурная компенсация
-        sensorData.ec = gCompensationService.correctEC(sensorData.ec, soil, sensorData.temperature);
-
-        // pH: температурная поправка по уравнению Нернста
-        sensorData.ph = gCompensationService.correctPH(sensorData.temperature, sensorData.ph);
-
-        // NPK: температурная и влажностная компенсация
-        NPKReferences npk{sensorData.nitrogen, sensorData.phosphorus, sensorData.potassium};
-        gCompensationService.correctNPK(sensorData.temperature, sensorData.humidity, soil, npk);
-
-        // Сохраняем скорректированные NPK данные в sensorData
-        sensorData.nitrogen = npk.nitrogen;
-        sensorData.phosphorus = npk.phosphorus;
-        sensorData.potassium = npk.potassium;
+        // EC (Rhoades), pH (Нернст), NPK (Delgado) за один проход по строке почвы
+        const CompensatedReading compensated = SensorCompensationService::compensate(sensorData, soil);
+        sensorData.ec = compensated.ec;
+        sensorData.ph = compensated.ph;
+        sensorData.nitrogen = compensated.nitrogen;
+        sensorData.phosphorus = compensated.phosphorus;
+        sensorData.potassium = compensated.potassium;
     } else {
         logDebugSafe("🔬 Компенсация отключена");
     }
@@ -6,7 +6,9 @@
 #include <array>
 #include <cctype>
 #include <cmath>
+#include <ctime>
 #include "jxct_config_vars.h"
+#include "jxct_constants.h"
 #include "jxct_device_info.h"
 #include "jxct_format_utils.h"
 #include "logger.h"
@@ -14,12 +16,17 @@
 #include "wifi_manager.h"
 #include "business/sensor_compensation_service.h"
 #include "sensor_processing.h"
+#include "uplink_http_session.h"
+#include "uplink_tls_client.h"
 extern NTPClient* timeClient;
 
 namespace
 {
-// URL для отправки данных в ThingSpeak
-const char* THINGSPEAK_API_URL = "https://api.thingspeak.com/update";
+// ✅ ДОБАВЛЕНО: Пакетная отправка (bulk-update), %lu - Channel ID. Только HTTPS: в теле write_api_key
+const char* THINGSPEAK_BULK_URL_FMT = "https://api.thingspeak.com/channels/%lu/bulk_update.json";
+// Одиночная запись (form POST), идёт через ту же keep-alive сессию
+const char* THINGSPEAK_UPDATE_URL = "https://api.thingspeak.com/update";
+constexpr uint16_t THINGSPEAK_HTTP_TIMEOUT_MS = 30000;
 
 unsigned long lastTsPublish = 0;
 unsigned long lastFailTime = 0;  // ✅ ДОБАВЛЕНО: Время последней ошибки
@@ -85,10 +92,273 @@ std::array<char, 32> thingSpeakLastPublishBuffer = {"0"};
 // Увеличиваем буфер ошибки, чтобы не обрезать текст причины (ранее 64)
 std::array<char, 128> thingSpeakLastErrorBuffer = {""};
 
-// Используем отдельный WiFiClient для ThingSpeak, чтобы не конфликтовать с MQTT
-static WiFiClient thingSpeakClient;
+// Отдельный TLS-клиент для ThingSpeak, чтобы не конфликтовать с MQTT; цепочка проверяется
+// по закреплённым корням, сессия возобновляется между отправками
+static UplinkTlsClient thingSpeakClient("thingspeak");
+
+// ✅ ДОБАВЛЕНО: Локальный буфер сэмплов для bulk-update
+// Время хранится в millis(), абсолютная метка считается в момент отправки,
+// поэтому сэмплы, снятые до синхронизации NTP, тоже получают корректное время
+struct ThingSpeakSample
+{
+    unsigned long capturedMs;
+    float temperature;
+    float asmPercent;
+    float ec;
+    float ph;
+    long nitrogen;
+    long phosphorus;
+    long potassium;
+};
+
+std::array<ThingSpeakSample, THINGSPEAK_BULK_MAX_SAMPLES> bulkSamples{};
+size_t bulkHead = 0;   // индекс самого старого сэмпла
+size_t bulkCount = 0;  // количество сэмплов в буфере
+unsigned long lastBulkSampleTime = 0;
+bool uploadInFlight = false;  // задание отправки передано фоновой задаче
+size_t inFlightSamples = 0;   // сэмплов буфера в отправляемом запросе (уменьшается при вытеснении)
+
+// Что именно ушло в запросе: от этого зависит, какие сэмплы удаляются при 400
+enum class ThingSpeakUploadKind : uint8_t
+{
+    BULK,     // первые inFlightSamples сэмплов одним bulk_update.json
+    SAMPLE,   // самый старый сэмпл одиночной записью (досылка после отклонённого пакета)
+    CURRENT,  // текущие показания без метки времени (NTP не синхронизирован)
+};
+ThingSpeakUploadKind inFlightKind = ThingSpeakUploadKind::BULK;
+bool uploadOutcomeReady = false;      // итог отправки ещё не забран uplink-приёмником
+bool uploadOutcomeDelivered = false;  // данные приняты ThingSpeak
+
+// ✅ Пакет, отклонённый с 400, не выбрасывается целиком: его сэмплы досылаются по одному,
+// и удаляется только сэмпл, который ThingSpeak отклонил и поодиночке
+size_t singleSampleFallback = 0;  // сэмплов отклонённого пакета, ещё не досланных по одному
+
+float computeAsmPercent(const SensorData& data)
+{
+    const SoilType soil = SensorProcessing::getSoilType(config.soilProfile);
+    return SensorCompensationService::vwcToAsm(data.humidity / 100.0F, soil);
+}
+
+void pushBulkSample(unsigned long now)
+{
+    if (bulkCount == bulkSamples.size())
+    {
+        // Буфер полон - вытесняем самый старый сэмпл
+        bulkHead = (bulkHead + 1) % bulkSamples.size();
+        --bulkCount;
+        if (inFlightSamples > 0)
+        {
+            --inFlightSamples;  // вытеснен сэмпл из отправляемого запроса
+        }
+        if (singleSampleFallback > 0)
+        {
+            --singleSampleFallback;  // вытеснен сэмпл, ожидавший досылки по одному
+        }
+        logDebug("ThingSpeak: буфер сэмплов заполнен, старейший сэмпл вытеснен");
+    }
+
+    ThingSpeakSample& sample = bulkSamples[(bulkHead + bulkCount) % bulkSamples.size()];
+    sample.capturedMs = now;
+    sample.temperature = sensorData.temperature;
+    sample.asmPercent = computeAsmPercent(sensorData);
+    sample.ec = sensorData.ec;
+    sample.ph = sensorData.ph;
+    sample.nitrogen = static_cast<long>(sensorData.nitrogen);
+    sample.phosphorus = static_cast<long>(sensorData.phosphorus);
+    sample.potassium = static_cast<long>(sensorData.potassium);
+    ++bulkCount;
+    lastBulkSampleTime = now;
+}
+
+void dropBulkSamples(size_t count)
+{
+    if (count > bulkCount)
+    {
+        count = bulkCount;
+    }
+    bulkHead = (bulkHead + count) % bulkSamples.size();
+    bulkCount -= count;
+    if (singleSampleFallback > bulkCount)
+    {
+        singleSampleFallback = bulkCount;  // досылаемые сэмплы вытеснены переполнением буфера
+    }
+}
+
+// Текущее UNIX-время, если NTP синхронизирован
+bool getSyncedEpoch(unsigned long& epoch)
+{
+    if (timeClient == nullptr || !timeClient->isTimeSet())
+    {
+        return false;
+    }
+    epoch = timeClient->getEpochTime();
+    return epoch > NTP_TIMESTAMP_2000;
+}
+
+// Формирует тело bulk_update.json:
+// {"write_api_key":"KEY","updates":[{"created_at":"2025-01-22 12:00:00 +0000","field1":..},..]}
+void buildBulkBody(String& body, const char* apiKey, unsigned long epochNow, unsigned long nowMs, size_t count)
+{
+    body.reserve(48 + (count * 176));
+    body = "{\"write_api_key\":\"";
+    body += apiKey;
+    body += "\",\"updates\":[";
+
+    std::array<char, 32> createdAt;
+    std::array<char, 192> entry;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ThingSpeakSample& sample = bulkSamples[(bulkHead + i) % bulkSamples.size()];
+        const time_t sampleEpoch = static_cast<time_t>(epochNow - ((nowMs - sample.capturedMs) / 1000UL));
+        struct tm tmUtc;
+        gmtime_r(&sampleEpoch, &tmUtc);
+        strftime(createdAt.data(), createdAt.size(), "%Y-%m-%d %H:%M:%S +0000", &tmUtc);
+
+        snprintf(entry.data(), entry.size(),
+                 "%s{\"created_at\":\"%s\",\"field1\":%.2f,\"field2\":%.2f,\"field3\":%.2f,\"field4\":%.2f,"
+                 "\"field5\":%ld,\"field6\":%ld,\"field7\":%ld,\"field8\":\"%lu\"}",
+                 i == 0 ? "" : ",", createdAt.data(), sample.temperature, sample.asmPercent, sample.ec, sample.ph,
+                 sample.nitrogen, sample.phosphorus, sample.potassium, sample.capturedMs);
+        body += entry.data();
+    }
+    body += "]}";
+}
+
+// Тело одиночной записи самого старого сэмпла буфера с его меткой времени (form POST /update)
+void buildOldestSampleBody(String& body, const char* apiKey, unsigned long epochNow, unsigned long nowMs)
+{
+    const ThingSpeakSample& sample = bulkSamples[bulkHead];
+    const time_t sampleEpoch = static_cast<time_t>(epochNow - ((nowMs - sample.capturedMs) / 1000UL));
+    struct tm tmUtc;
+    gmtime_r(&sampleEpoch, &tmUtc);
+    std::array<char, 24> createdAt;
+    strftime(createdAt.data(), createdAt.size(), "%Y-%m-%dT%H:%M:%SZ", &tmUtc);  // ISO 8601, без URL-кодирования
+
+    std::array<char, 192> fields;
+    snprintf(fields.data(), fields.size(),
+             "&created_at=%s&field1=%.2f&field2=%.2f&field3=%.2f&field4=%.2f&field5=%ld&field6=%ld&field7=%ld"
+             "&field8=%lu",
+             createdAt.data(), sample.temperature, sample.asmPercent, sample.ec, sample.ph, sample.nitrogen,
+             sample.phosphorus, sample.potassium, sample.capturedMs);
+    body.reserve(16 + strlen(apiKey) + strlen(fields.data()));
+    body = "api_key=";
+    body += apiKey;
+    body += fields.data();
+}
+
+// Приводит сетевые ошибки HTTPClient к кодам ThingSpeak (TS_ERR_*)
+int toThingSpeakCode(int httpCode)
+{
+    if (httpCode == HTTPC_ERROR_READ_TIMEOUT)
+    {
+        return TS_ERR_TIMEOUT;
+    }
+    if (httpCode < 0)
+    {
+        return TS_ERR_CONNECT_FAILED;
+    }
+    return httpCode;
+}
+
+// Тело одиночной записи текущих показаний (form POST /update)
+void buildSingleBody(String& body, const char* apiKey)
+{
+    body.reserve(200);
+    body += "api_key="; body += apiKey;
+    body += "&field1="; body += String(sensorData.temperature, 2);
+    body += "&field2="; body += String(computeAsmPercent(sensorData), 2); // ASM
+    body += "&field3="; body += String(sensorData.ec, 2);
+    body += "&field4="; body += String(sensorData.ph, 2);
+    body += "&field5="; body += String(static_cast<int>(sensorData.nitrogen));
+    body += "&field6="; body += String(static_cast<int>(sensorData.phosphorus));
+    body += "&field7="; body += String(static_cast<int>(sensorData.potassium));
+    // Уникальный идентификатор для избежания HTTP 304
+    body += "&field8="; body += String(millis());
+}
+
+// ✅ ДОБАВЛЕНО: Фоновая отправка. Тело запроса собирается в loop(), в задаче - только DNS и HTTP;
+// результат возвращается в loop() через очередь, поэтому всё состояние клиента меняется в одном потоке
+struct ThingSpeakUploadJob
+{
+    String* body;  // владеет задача, освобождает после отправки
+    bool bulk;
+    std::array<char, 96> url;
+};
+
+struct ThingSpeakUploadResult
+{
+    int code;  // HTTP-код или TS_ERR_*
+};
+
+QueueHandle_t uploadJobQueue = nullptr;
+QueueHandle_t uploadResultQueue = nullptr;
+
+// Выполняется в задаче: сетевая часть отправки
+int performUpload(const ThingSpeakUploadJob& job)
+{
+    // ✅ Проверка DNS перед отправкой (разрешаем оба хоста)
+    IPAddress thingSpeakIP;
+    if (!WiFi.hostByName("api.thingspeak.com", thingSpeakIP) && !WiFi.hostByName("thingspeak.com", thingSpeakIP))
+    {
+        return TS_ERR_UNEXPECTED_FAIL;  // -302, отображается как DNS Error
+    }
+
+    // ✅ ДОБАВЛЕНО: Увеличенный таймаут для ThingSpeak (на отдельном клиенте)
+    thingSpeakClient.setTimeout(30000);  // 30 секунд вместо стандартных 5
+
+    String response;
+    const int httpCode = getUplinkSession().post(
+        thingSpeakClient, job.url.data(), job.bulk ? "application/json" : "application/x-www-form-urlencoded",
+        *job.body, response, THINGSPEAK_HTTP_TIMEOUT_MS, nullptr, portMAX_DELAY);  // фоновая задача может ждать
+
+    // ThingSpeak отвечает на /update 200 с entry_id, "0" - запись не принята (например, слишком часто)
+    if (!job.bulk && httpCode == 200 && (response.length() == 0 || response == "0"))
+    {
+        return TS_ERR_NOT_INSERTED;
+    }
+    return toThingSpeakCode(httpCode);
+}
+
+void thingSpeakUploadTask(void* /*parameters*/)
+{
+    for (;;)
+    {
+        ThingSpeakUploadJob job;
+        if (xQueueReceive(uploadJobQueue, &job, portMAX_DELAY) != pdTRUE)
+        {
+            continue;
+        }
+
+        const ThingSpeakUploadResult result = {performUpload(job)};
+        delete job.body;
+        xQueueSend(uploadResultQueue, &result, portMAX_DELAY);
+    }
+}
 }  // namespace
 
+// ✅ ДОБАВЛЕНО: Сохранение сэмпла в буфер для пакетной отправки
+bool queueThingSpeakSample()
+{
+    if (!config.flags.thingSpeakEnabled || !sensorData.valid || !validateSensorData(sensorData))
+    {
+        return false;
+    }
+
+    const unsigned long now = millis();
+    if (bulkCount > 0 && (now - lastBulkSampleTime) < THINGSPEAK_BULK_SAMPLE_MIN_MS)
+    {
+        return false;
+    }
+
+    pushBulkSample(now);
+    return true;
+}
+
+size_t getThingSpeakBufferedSamples()
+{
+    return bulkCount;
+}
+
 // ✅ ДОБАВЛЕНО: Функция принудительного сброса блокировки ThingSpeak
 void resetThingSpeakBlock()
 {
@@ -147,6 +417,9 @@ String getThingSpeakDiagnosticsJson()
     json += "\"blocked\":" + String((consecutiveFailCount >= 5 && timeSinceLastFail < 1800000UL) ? "true" : "false") + ",";
     json += "\"remaining_block_time_ms\":" + String(remainingBlockTime) + ",";
     json += "\"remaining_block_time_min\":" + String(remainingBlockTime / 60000) + ",";
+    json += "\"buffered_samples\":" + String(static_cast<unsigned long>(bulkCount)) + ",";
+    json += "\"upload_in_flight\":" + String(uploadInFlight ? "true" : "false") + ",";
+    json += "\"uplink_session\":" + getUplinkSession().getStatsJson() + ",";
     json += "\"last_error\":\"" + String(thingSpeakLastErrorBuffer.data()) + "\",";
     json += "\"last_publish\":\"" + String(thingSpeakLastPublishBuffer.data()) + "\"";
     json += "}";
@@ -177,6 +450,10 @@ bool canSendToThingSpeak()
     if (!sensorData.valid) {
         return false;
     }
+    // ✅ ДОБАВЛЕНО: Предыдущее задание ещё выполняется фоновой задачей
+    if (uploadInFlight) {
+        return false;
+    }
 
     const unsigned long now = millis();
     
@@ -224,118 +501,35 @@ void setupThingSpeak(WiFiClient& /*client*/)  // NOLINT(misc-use-internal-linkag
 {
     // Инициализируем библиотеку на отдельном клиенте, чтобы исключить конкуренцию с MQTT
     ThingSpeak.begin(thingSpeakClient);
-}
 
-bool sendDataToThingSpeak()
-{
-    // ✅ ДОБАВЛЕНО: Подробная диагностика входа в функцию
-    logDebug("ThingSpeak: Попытка отправки данных");
-    logDebugSafe("ThingSpeak: enabled=%d, wifi=%d, data_valid=%d", 
-                 static_cast<int>(config.flags.thingSpeakEnabled), wifiConnected, sensorData.valid);
-    
-    // Проверки
-    if (!config.flags.thingSpeakEnabled)
+    // ✅ ДОБАВЛЕНО: Фоновая задача отправки, loop() не блокируется на сети
+    if (uploadJobQueue == nullptr)
     {
-        logDebug("ThingSpeak: Отключен в настройках");
-        return false;
-    }
-    if (!wifiConnected)
-    {
-        logDebug("ThingSpeak: WiFi не подключен");
-        return false;
-    }
-    if (!sensorData.valid)
-    {
-        logDebug("ThingSpeak: Данные датчика невалидны");
-        return false;
-    }
-
-    const unsigned long now = millis();
-    // Частотные ограничения проверяются в canSendToThingSpeak()
-
-    std::array<char, 25> apiKeyBuf;
-    std::array<char, 16> channelBuf;
-    strlcpy(apiKeyBuf.data(), config.thingSpeakApiKey, apiKeyBuf.size());
-    strlcpy(channelBuf.data(), config.thingSpeakChannelId, channelBuf.size());
-    trim(apiKeyBuf.data());
-    trim(channelBuf.data());
-
-    const unsigned long channelId = strtoul(channelBuf.data(), nullptr, 10);
-
-    // ✅ ДОБАВЛЕНО: Диагностика настроек
-    logDebugSafe("ThingSpeak: Channel ID: '%s' -> %lu, API Key: '%s' (длина: %zu)", 
-                 channelBuf.data(), channelId, apiKeyBuf.data(), strlen(apiKeyBuf.data()));
-
-    // Проверяем корректность ID и API ключа - если неверные, молча пропускаем
-    if (channelId == 0 || strlen(apiKeyBuf.data()) < 16)
-    {
-        // Не логируем ошибку каждый раз, просто пропускаем отправку
-        if (strlen(thingSpeakLastErrorBuffer.data()) == 0)  // логируем только первый раз
+        uploadJobQueue = xQueueCreate(THINGSPEAK_UPLOAD_QUEUE_LENGTH, sizeof(ThingSpeakUploadJob));
+        uploadResultQueue = xQueueCreate(THINGSPEAK_UPLOAD_QUEUE_LENGTH, sizeof(ThingSpeakUploadResult));
+        if (uploadJobQueue == nullptr || uploadResultQueue == nullptr)
         {
-            logWarnSafe("ThingSpeak: Неверные настройки - Channel ID: '%s', API Key длина: %zu", channelBuf.data(), strlen(apiKeyBuf.data()));
-            strlcpy(thingSpeakLastErrorBuffer.data(), "Настройки не заданы", thingSpeakLastErrorBuffer.size());
+            logError("ThingSpeak: не удалось создать очереди фоновой отправки");
+            return;
         }
-        return false;
-    }
-
-    // ✅ ДОБАВЛЕНО: Валидация данных перед отправкой
-    if (!validateSensorData(sensorData)) {
-        logWarn("ThingSpeak: Данные датчика невалидны, пропускаем отправку");
-        return false;
-    }
-
-    // ✅ ДОБАВЛЕНО: Проверка стабильности WiFi соединения
-    if (WiFi.status() != WL_CONNECTED) {
-        logWarn("ThingSpeak: WiFi соединение нестабильно, пропускаем отправку");
-        return false;
-    }
-
-    // ✅ Проверка DNS перед отправкой (разрешаем оба хоста)
-    IPAddress thingSpeakIP;
-    if (!WiFi.hostByName("api.thingspeak.com", thingSpeakIP) && !WiFi.hostByName("thingspeak.com", thingSpeakIP)) {
-        logWarn("ThingSpeak: DNS ошибка - не удается разрешить api.thingspeak.com/thingspeak.com");
-        strlcpy(thingSpeakLastErrorBuffer.data(), "DNS Error", thingSpeakLastErrorBuffer.size());
-        return false;
+        xTaskCreate(thingSpeakUploadTask, "ThingSpeak", THINGSPEAK_TASK_STACK_SIZE, nullptr, THINGSPEAK_TASK_PRIORITY,
+                    nullptr);
     }
+}
 
-    // ✅ ДОБАВЛЕНО: Увеличенный таймаут для ThingSpeak (на отдельном клиенте)
-    thingSpeakClient.setTimeout(30000);  // 30 секунд вместо стандартных 5
-
-    // ✅ Диагностика данных перед отправкой + User-Agent через фейковое поле 8
-    logDebugSafe("ThingSpeak: Данные для отправки - T:%.2f, H:%.2f, EC:%.2f, pH:%.2f, N:%d, P:%d, K:%d", 
-                 sensorData.temperature, sensorData.humidity, sensorData.ec, sensorData.ph,
-                 static_cast<int>(sensorData.nitrogen), static_cast<int>(sensorData.phosphorus), static_cast<int>(sensorData.potassium));
-
-    // Обнуляем поля перед заполнением, чтобы избежать унаследованных значений
-    for (unsigned f = 1; f <= 8; ++f) { ThingSpeak.setField(f, ""); }
-
-    // Формируем данные для отправки (влажность как ASM, остальные компенсированные)
-    ThingSpeak.setField(1, sensorData.temperature);
-    {
-        SensorCompensationService compensationService;
-        const SoilType soil = SensorProcessing::getSoilType(config.soilProfile);
-        const float vwcFraction = sensorData.humidity / 100.0F;
-        const float asmPercent = compensationService.vwcToAsm(vwcFraction, soil);
-        ThingSpeak.setField(2, asmPercent); // ASM
-    }
-    ThingSpeak.setField(3, sensorData.ec);
-    ThingSpeak.setField(4, sensorData.ph);
-    ThingSpeak.setField(5, static_cast<long>(sensorData.nitrogen));
-    ThingSpeak.setField(6, static_cast<long>(sensorData.phosphorus));
-    ThingSpeak.setField(7, static_cast<long>(sensorData.potassium));
-
-    // Уникальный идентификатор для избежания HTTP 304 (исправлено: используем строку вместо float)
-    char buf[12];
-    snprintf(buf, sizeof(buf), "%lu", millis());
-    ThingSpeak.setField(8, buf);
-
-    // ✅ ДОБАВЛЕНО: Улучшенная обработка ошибок с детальной диагностикой
-    // Важно: ThingSpeak.update ожидает до 8 полей; используем writeFields с Channel ID и API ключом
-    const int res = ThingSpeak.writeFields(channelId, apiKeyBuf.data());
-    
-         if (res == 200)  // ✅ HTTP 200 - настоящий успех
+namespace
+{
+// Обработка результата отправки: счётчики ошибок, блокировка, повторы и статус для веб-интерфейса
+bool applyUploadResult(int res, size_t flushedSamples, ThingSpeakUploadKind kind)
+{
+         if (res == 200 || res == THINGSPEAK_BULK_HTTP_ACCEPTED)  // ✅ HTTP 200/202 - настоящий успех
      {
-         logSuccess("ThingSpeak: данные отправлены (HTTP 200)");
+         logSuccessSafe("ThingSpeak: данные отправлены (HTTP %d, сэмплов: %zu)", res, flushedSamples);
+         if (kind == ThingSpeakUploadKind::SAMPLE && flushedSamples > 0 && singleSampleFallback > 0)
+         {
+             --singleSampleFallback;  // до удаления: dropBulkSamples() сам ограничивает счётчик размером буфера
+         }
+         dropBulkSamples(flushedSamples);
          lastTsPublish = millis();
          snprintf(thingSpeakLastPublishBuffer.data(), thingSpeakLastPublishBuffer.size(), "%lu", lastTsPublish);
          thingSpeakLastErrorBuffer[0] = '\0';  // Очистка ошибки
@@ -407,6 +601,9 @@ bool sendDataToThingSpeak()
             case 0:
                 strlcpy(errorMsg, "HTTP 0 (проверьте WiFi)", sizeof(errorMsg));
                 break;
+            case TS_ERR_NOT_INSERTED:
+                strlcpy(errorMsg, "Запись не принята -401 (слишком часто?)", sizeof(errorMsg));
+                break;
             default:
                 snprintf(errorMsg, sizeof(errorMsg), "HTTP %d", res);
                 break;
@@ -414,46 +611,19 @@ bool sendDataToThingSpeak()
         
         logWarnSafe("ThingSpeak: ошибка отправки: %s", errorMsg);
         
-        // 🔁 Fallback: прямой HTTP POST без channelId при HTTP 400 (проверяем связку api_key+fields)
+        // Отклонено как неверное (400): повтор того же пакета бессмысленен, но и выбрасывать весь
+        // буфер из-за одной плохой записи нельзя - сэмплы пакета досылаются по одному,
+        // а удаляется только сэмпл, отклонённый и поодиночке
         if (res == 400) {
-            HTTPClient http;
-            String url = String("http://api.thingspeak.com/update");
-            if (http.begin(url)) {
-                http.addHeader("Content-Type", "application/x-www-form-urlencoded");
-                String body;
-                body.reserve(200);
-                body += "api_key="; body += apiKeyBuf.data();
-                body += "&field1="; body += String(sensorData.temperature, 2);
-                {
-                    SensorCompensationService compensationService;
-                    const SoilType soil = SensorProcessing::getSoilType(config.soilProfile);
-                    const float vwcFraction = sensorData.humidity / 100.0F;
-                    const float asmPercent = compensationService.vwcToAsm(vwcFraction, soil);
-                    body += "&field2="; body += String(asmPercent, 2); // ASM
-                }
-                body += "&field3="; body += String(sensorData.ec, 2);
-                body += "&field4="; body += String(sensorData.ph, 2);
-                body += "&field5="; body += String(static_cast<int>(sensorData.nitrogen));
-                body += "&field6="; body += String(static_cast<int>(sensorData.phosphorus));
-                body += "&field7="; body += String(static_cast<int>(sensorData.potassium));
-                body += "&field8="; body += String(millis());
-
-                int httpCode = http.POST(body);
-                String resp = http.getString();
-                http.end();
-
-                if (httpCode == 200 && resp.length() > 0 && resp != "0") {
-                    logSuccessSafe("ThingSpeak fallback: данные отправлены (entry_id=%s)", resp.c_str());
-                    lastTsPublish = millis();
-                    snprintf(thingSpeakLastPublishBuffer.data(), thingSpeakLastPublishBuffer.size(), "%lu", lastTsPublish);
-                    thingSpeakLastErrorBuffer[0] = '\0';
-                    consecutiveFailCount = 0;
-                    lastFailTime = 0;
-                    nextThingSpeakTry = 0;
-                    return true;
-                } else {
-                    logWarnSafe("ThingSpeak fallback: HTTP %d, resp='%s'", httpCode, resp.c_str());
+            if (kind == ThingSpeakUploadKind::BULK && flushedSamples > 1) {
+                singleSampleFallback = flushedSamples;
+                logWarnSafe("ThingSpeak: пакет отклонён, %zu сэмплов будут досланы по одному", flushedSamples);
+            } else if (kind != ThingSpeakUploadKind::CURRENT && flushedSamples > 0) {
+                if (singleSampleFallback > 0) {
+                    --singleSampleFallback;
                 }
+                dropBulkSamples(1);
+                logWarn("ThingSpeak: сэмпл отклонён и поодиночке - удалён из буфера");
             }
         }
         strlcpy(thingSpeakLastErrorBuffer.data(), errorMsg, thingSpeakLastErrorBuffer.size());
@@ -502,3 +672,154 @@ bool sendDataToThingSpeak()
         return false;
     }
 }
+}  // namespace
+
+bool sendDataToThingSpeak()
+{
+    // ✅ ДОБАВЛЕНО: Подробная диагностика входа в функцию
+    logDebug("ThingSpeak: Попытка отправки данных");
+    logDebugSafe("ThingSpeak: enabled=%d, wifi=%d, data_valid=%d", 
+                 static_cast<int>(config.flags.thingSpeakEnabled), wifiConnected, sensorData.valid);
+    
+    // Проверки
+    if (!config.flags.thingSpeakEnabled)
+    {
+        logDebug("ThingSpeak: Отключен в настройках");
+        return false;
+    }
+    if (!wifiConnected)
+    {
+        logDebug("ThingSpeak: WiFi не подключен");
+        return false;
+    }
+    if (!sensorData.valid)
+    {
+        logDebug("ThingSpeak: Данные датчика невалидны");
+        return false;
+    }
+
+    const unsigned long now = millis();
+    // Частотные ограничения проверяются в canSendToThingSpeak()
+
+    std::array<char, 25> apiKeyBuf;
+    std::array<char, 16> channelBuf;
+    strlcpy(apiKeyBuf.data(), config.thingSpeakApiKey, apiKeyBuf.size());
+    strlcpy(channelBuf.data(), config.thingSpeakChannelId, channelBuf.size());
+    trim(apiKeyBuf.data());
+    trim(channelBuf.data());
+
+    const unsigned long channelId = strtoul(channelBuf.data(), nullptr, 10);
+
+    // ✅ ДОБАВЛЕНО: Диагностика настроек
+    logDebugSafe("ThingSpeak: Channel ID: '%s' -> %lu, API Key: '%s' (длина: %zu)", 
+                 channelBuf.data(), channelId, apiKeyBuf.data(), strlen(apiKeyBuf.data()));
+
+    // Проверяем корректность ID и API ключа - если неверные, молча пропускаем
+    if (channelId == 0 || strlen(apiKeyBuf.data()) < 16)
+    {
+        // Не логируем ошибку каждый раз, просто пропускаем отправку
+        if (strlen(thingSpeakLastErrorBuffer.data()) == 0)  // логируем только первый раз
+        {
+            logWarnSafe("ThingSpeak: Неверные настройки - Channel ID: '%s', API Key длина: %zu", channelBuf.data(), strlen(apiKeyBuf.data()));
+            strlcpy(thingSpeakLastErrorBuffer.data(), "Настройки не заданы", thingSpeakLastErrorBuffer.size());
+        }
+        return false;
+    }
+
+    // ✅ ДОБАВЛЕНО: Валидация данных перед отправкой
+    if (!validateSensorData(sensorData)) {
+        logWarn("ThingSpeak: Данные датчика невалидны, пропускаем отправку");
+        return false;
+    }
+
+    // ✅ ДОБАВЛЕНО: Проверка стабильности WiFi соединения
+    if (WiFi.status() != WL_CONNECTED) {
+        logWarn("ThingSpeak: WiFi соединение нестабильно, пропускаем отправку");
+        return false;
+    }
+
+    // ✅ Диагностика данных перед отправкой
+    logDebugSafe("ThingSpeak: Данные для отправки - T:%.2f, H:%.2f, EC:%.2f, pH:%.2f, N:%d, P:%d, K:%d", 
+                 sensorData.temperature, sensorData.humidity, sensorData.ec, sensorData.ph,
+                 static_cast<int>(sensorData.nitrogen), static_cast<int>(sensorData.phosphorus), static_cast<int>(sensorData.potassium));
+
+    // ✅ ДОБАВЛЕНО: Пакетная отправка накопленных сэмплов через bulk_update.json.
+    // Без синхронизированного NTP метки времени не вычислить - отправляем одну запись текущего состояния как
+    // раньше, а буфер сохраняем: сэмплы помнят millis() съёма и получат метки после синхронизации
+    ThingSpeakUploadJob job = {};
+    job.body = new String();
+    unsigned long epochNow = 0;
+    const bool timeSynced = getSyncedEpoch(epochNow);
+    ThingSpeakUploadKind kind = ThingSpeakUploadKind::CURRENT;
+    size_t samplesInJob = 0;  // одиночная запись текущего состояния не доставляет сэмплы буфера
+    if (timeSynced && singleSampleFallback > 0 && bulkCount > 0)
+    {
+        kind = ThingSpeakUploadKind::SAMPLE;
+        samplesInJob = 1;
+        job.bulk = false;
+        strlcpy(job.url.data(), THINGSPEAK_UPDATE_URL, job.url.size());
+        buildOldestSampleBody(*job.body, apiKeyBuf.data(), epochNow, millis());
+        logDebugSafe("ThingSpeak: досылка по одному, осталось %zu сэмплов", singleSampleFallback);
+    }
+    else if (timeSynced)
+    {
+        if (bulkCount == 0)
+        {
+            pushBulkSample(now);  // гарантируем хотя бы текущий сэмпл
+        }
+        kind = ThingSpeakUploadKind::BULK;
+        samplesInJob = bulkCount;
+        job.bulk = true;
+        snprintf(job.url.data(), job.url.size(), THINGSPEAK_BULK_URL_FMT, channelId);
+        buildBulkBody(*job.body, apiKeyBuf.data(), epochNow, millis(), bulkCount);
+        logDebugSafe("ThingSpeak: bulk-update %zu сэмплов, %u байт", bulkCount, job.body->length());
+    }
+    else
+    {
+        job.bulk = false;
+        strlcpy(job.url.data(), THINGSPEAK_UPDATE_URL, job.url.size());
+        buildSingleBody(*job.body, apiKeyBuf.data());
+    }
+
+    if (uploadJobQueue == nullptr || xQueueSend(uploadJobQueue, &job, 0) != pdTRUE)
+    {
+        delete job.body;
+        logWarn("ThingSpeak: очередь фоновой отправки недоступна, пропускаем");
+        return false;
+    }
+
+    uploadInFlight = true;
+    inFlightKind = kind;
+    inFlightSamples = samplesInJob;
+    logDebug("ThingSpeak: задание передано фоновой задаче");
+    return true;
+}
+
+// ✅ ДОБАВЛЕНО: Применение результатов фоновой отправки (вызывается из loop())
+void handleThingSpeak()
+{
+    if (uploadResultQueue == nullptr)
+    {
+        return;
+    }
+
+    ThingSpeakUploadResult result;
+    while (xQueueReceive(uploadResultQueue, &result, 0) == pdTRUE)
+    {
+        uploadInFlight = false;
+        uploadOutcomeDelivered = applyUploadResult(result.code, inFlightSamples, inFlightKind);
+        uploadOutcomeReady = true;
+        inFlightSamples = 0;
+    }
+}
+
+bool takeThingSpeakUploadOutcome(bool& delivered)
+{
+    if (!uploadOutcomeReady)
+    {
+        return false;
+    }
+    uploadOutcomeReady = false;
+    delivered = uploadOutcomeDelivered;
+    return true;
+}
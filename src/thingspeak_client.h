@@ -26,7 +26,23 @@ void diagnoseThingSpeakStatus();
 // ✅ ДОБАВЛЕНО: Получение диагностики ThingSpeak в JSON формате
 String getThingSpeakDiagnosticsJson();
 
-// Отправка данных в ThingSpeak (с учётом интервала)
+// ✅ ДОБАВЛЕНО: Сохранение текущих показаний в локальный буфер для пакетной отправки
+// (не чаще THINGSPEAK_BULK_SAMPLE_MIN_MS); true - сэмпл добавлен
+bool queueThingSpeakSample();
+
+// ✅ ДОБАВЛЕНО: Количество сэмплов, ожидающих отправки
+size_t getThingSpeakBufferedSamples();
+
+// Отправка данных в ThingSpeak (с учётом интервала).
+// При синхронизированном NTP буфер уходит одним запросом bulk_update.json.
+// Запрос выполняет фоновая задача: true - задание принято, результат придёт в handleThingSpeak()
 bool sendDataToThingSpeak();
 
+// ✅ ДОБАВЛЕНО: Применение результатов фоновой отправки (статус, ошибки, блокировка) - из loop()
+void handleThingSpeak();
+
+// Итог последней отправки, применённой handleThingSpeak(), для uplink-приёмника.
+// true - итог ещё не забирался; delivered - ThingSpeak принял данные (HTTP 200/202/304)
+bool takeThingSpeakUploadOutcome(bool& delivered);
+
 #endif  // THINGSPEAK_CLIENT_H
@@ -0,0 +1,297 @@
+/**
+ * @file uplink_http_session.cpp
+ * @brief Реализация постоянной HTTP-сессии для исходящих запросов
+ */
+
+#include "uplink_http_session.h"
+#include <cstring>
+#include "logger.h"
+
+namespace
+{
+constexpr uint16_t HTTP_DEFAULT_PORT = 80;
+constexpr uint16_t HTTPS_DEFAULT_PORT = 443;
+constexpr int UPLINK_MAX_ATTEMPTS = 2;  // Исходная попытка + повтор на свежем сокете
+
+// Разбор "http(s)://host[:port]/path" на хост и порт
+bool parseHostPort(const char* url, std::array<char, 64>& host, uint16_t& port)
+{
+    const char* cursor = nullptr;
+    if (strncmp(url, "https://", 8) == 0)
+    {
+        cursor = url + 8;
+        port = HTTPS_DEFAULT_PORT;
+    }
+    else if (strncmp(url, "http://", 7) == 0)
+    {
+        cursor = url + 7;
+        port = HTTP_DEFAULT_PORT;
+    }
+    else
+    {
+        return false;
+    }
+
+    const size_t hostLen = strcspn(cursor, ":/");
+    if (hostLen == 0 || hostLen >= host.size())
+    {
+        return false;
+    }
+    memcpy(host.data(), cursor, hostLen);
+    host[hostLen] = '\0';
+
+    if (cursor[hostLen] == ':')
+    {
+        const unsigned long parsedPort = strtoul(cursor + hostLen + 1, nullptr, 10);
+        if (parsedPort == 0 || parsedPort > 65535UL)
+        {
+            return false;
+        }
+        port = static_cast<uint16_t>(parsedPort);
+    }
+    return true;
+}
+
+// Ошибки, при которых сокет мог быть закрыт сервером между запросами
+bool isConnectionLevelError(int code)
+{
+    return code == HTTPC_ERROR_CONNECTION_REFUSED || code == HTTPC_ERROR_SEND_HEADER_FAILED ||
+           code == HTTPC_ERROR_SEND_PAYLOAD_FAILED || code == HTTPC_ERROR_NOT_CONNECTED ||
+           code == HTTPC_ERROR_CONNECTION_LOST || code == HTTPC_ERROR_NO_HTTP_SERVER;
+}
+
+UplinkHttpSession uplinkSession;  // NOLINT(misc-use-internal-linkage)
+}  // namespace
+
+UplinkHttpSession& getUplinkSession()  // NOLINT(misc-use-internal-linkage)
+{
+    return uplinkSession;
+}
+
+UplinkHttpSession::UplinkHttpSession() : lock(xSemaphoreCreateMutex()), statsLock(xSemaphoreCreateMutex()) {}
+
+int UplinkHttpSession::get(WiFiClient& transport, const char* url, String& response, uint16_t timeoutMs,
+                           bool followRedirects, TickType_t lockWait)
+{
+    return execute(transport, url, nullptr, nullptr, nullptr, response, timeoutMs, followRedirects, lockWait);
+}
+
+int UplinkHttpSession::post(WiFiClient& transport, const char* url, const char* contentType, const String& body,
+                            String& response, uint16_t timeoutMs, const char* authorization, TickType_t lockWait)
+{
+    return execute(transport, url, contentType, authorization, &body, response, timeoutMs, false, lockWait);
+}
+
+void UplinkHttpSession::close()
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (UplinkConnectionSlot& slot : slots)
+    {
+        closeSlot(slot);
+    }
+    xSemaphoreGive(lock);
+}
+
+void UplinkHttpSession::closeSlot(UplinkConnectionSlot& slot)
+{
+    if (slot.transport != nullptr)
+    {
+        slot.transport->stop();
+    }
+    slot = UplinkConnectionSlot{};
+}
+
+UplinkSessionStats UplinkHttpSession::getStats() const
+{
+    xSemaphoreTake(statsLock, portMAX_DELAY);
+    const UplinkSessionStats snapshot = statsSnapshot;
+    xSemaphoreGive(statsLock);
+    return snapshot;
+}
+
+uint32_t UplinkHttpSession::getAverageConnectMs() const
+{
+    const UplinkSessionStats snapshot = getStats();
+    return snapshot.connects > 0 ? snapshot.totalConnectMs / snapshot.connects : 0;
+}
+
+String UplinkHttpSession::getStatsJson() const
+{
+    // Все поля из одного снимка: счётчики не расходятся, даже если запрос завершится во время сборки
+    const UplinkSessionStats snapshot = getStats();
+    const uint32_t averageConnectMs = snapshot.connects > 0 ? snapshot.totalConnectMs / snapshot.connects : 0;
+    String json = "{";
+    json += "\"requests\":" + String(snapshot.requests) + ",";
+    json += "\"reused_requests\":" + String(snapshot.reusedRequests) + ",";
+    json += "\"connects\":" + String(snapshot.connects) + ",";
+    json += "\"reconnect_retries\":" + String(snapshot.reconnectRetries) + ",";
+    json += "\"last_connect_ms\":" + String(snapshot.lastConnectMs) + ",";
+    json += "\"avg_connect_ms\":" + String(averageConnectMs) + ",";
+    json += "\"saved_ms\":" + String(snapshot.savedMs) + ",";
+    json += "\"evictions\":" + String(snapshot.evictions);
+    json += "}";
+    return json;
+}
+
+// Слот для транспорта: его собственный (транспорт держит один сокет), свободный или давно не использованный
+UplinkConnectionSlot* UplinkHttpSession::acquireSlot(WiFiClient& transport)
+{
+    UplinkConnectionSlot* freeSlot = nullptr;
+    UplinkConnectionSlot* oldest = nullptr;
+    for (UplinkConnectionSlot& slot : slots)
+    {
+        if (slot.transport == &transport)
+        {
+            return &slot;
+        }
+        if (slot.transport == nullptr)
+        {
+            if (freeSlot == nullptr)
+            {
+                freeSlot = &slot;
+            }
+        }
+        else if (oldest == nullptr || static_cast<int32_t>(slot.lastUsedMs - oldest->lastUsedMs) < 0)
+        {
+            oldest = &slot;
+        }
+    }
+    if (freeSlot != nullptr)
+    {
+        return freeSlot;
+    }
+    logDebugSafe("Uplink: пул заполнен, закрываем соединение с %s", oldest->host.data());
+    ++stats.evictions;
+    closeSlot(*oldest);
+    return oldest;
+}
+
+UplinkConnectionSlot* UplinkHttpSession::connect(WiFiClient& transport, const char* host, uint16_t port,
+                                                 bool& reused)
+{
+    UplinkConnectionSlot* slot = acquireSlot(transport);
+    slot->lastUsedMs = millis();
+    if (slot->transport == &transport && slot->port == port && strcmp(slot->host.data(), host) == 0 &&
+        transport.connected())
+    {
+        reused = true;
+        return slot;
+    }
+
+    // Транспорт переключается на другой хост или сокет закрыт сервером - открываем заново
+    closeSlot(*slot);
+    reused = false;
+
+    const unsigned long started = millis();
+    const int connected = transport.connect(host, port);
+    stats.lastConnectMs = static_cast<uint32_t>(millis() - started);
+    stats.totalConnectMs += stats.lastConnectMs;
+    ++stats.connects;
+
+    if (connected == 0)
+    {
+        logWarnSafe("Uplink: не удалось подключиться к %s:%u (%lu мс)", host, static_cast<unsigned>(port),
+                    static_cast<unsigned long>(stats.lastConnectMs));
+        return nullptr;
+    }
+
+    logDebugSafe("Uplink: подключение к %s:%u за %lu мс", host, static_cast<unsigned>(port),
+                 static_cast<unsigned long>(stats.lastConnectMs));
+    slot->transport = &transport;
+    strlcpy(slot->host.data(), host, slot->host.size());
+    slot->port = port;
+    slot->connectMs = stats.lastConnectMs;
+    slot->lastUsedMs = millis();
+    return slot;
+}
+
+int UplinkHttpSession::execute(WiFiClient& transport, const char* url, const char* contentType,
+                               const char* authorization, const String* body, String& response, uint16_t timeoutMs,
+                               bool followRedirects, TickType_t lockWait)
+{
+    std::array<char, 64> host = {""};
+    uint16_t port = 0;
+    if (!parseHostPort(url, host, port))
+    {
+        logWarnSafe("Uplink: неверный URL %s", url);
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+
+    // Один запрос за раз: пул и HTTPClient общие для всех задач. Вызывающий из loop() не ждёт
+    // чужой запрос (до таймаута сервера) - получает UPLINK_SESSION_BUSY и повторяет позже
+    if (xSemaphoreTake(lock, lockWait) != pdTRUE)
+    {
+        logDebugSafe("Uplink: сессия занята, запрос к %s отложен", host.data());
+        return UPLINK_SESSION_BUSY;
+    }
+    const int code = executeLocked(transport, url, host.data(), port, contentType, authorization, body, response,
+                                   timeoutMs, followRedirects);
+    xSemaphoreTake(statsLock, portMAX_DELAY);
+    statsSnapshot = stats;
+    xSemaphoreGive(statsLock);
+    xSemaphoreGive(lock);
+    return code;
+}
+
+int UplinkHttpSession::executeLocked(WiFiClient& transport, const char* url, const char* host, uint16_t port,
+                                     const char* contentType, const char* authorization, const String* body,
+                                     String& response, uint16_t timeoutMs, bool followRedirects)
+{
+    int code = HTTPC_ERROR_CONNECTION_REFUSED;
+    for (int attempt = 0; attempt < UPLINK_MAX_ATTEMPTS; ++attempt)
+    {
+        bool reused = false;
+        UplinkConnectionSlot* slot = connect(transport, host, port, reused);
+        if (slot == nullptr)
+        {
+            return HTTPC_ERROR_CONNECTION_REFUSED;
+        }
+
+        // HTTPClient видит уже открытый сокет и не переподключается; end() оставляет его открытым
+        http.setReuse(true);
+        if (!http.begin(transport, url))
+        {
+            closeSlot(*slot);
+            return HTTPC_ERROR_CONNECTION_REFUSED;
+        }
+        http.setTimeout(timeoutMs);
+        http.setFollowRedirects(followRedirects ? HTTPC_STRICT_FOLLOW_REDIRECTS : HTTPC_DISABLE_FOLLOW_REDIRECTS);
+        if (contentType != nullptr)
+        {
+            http.addHeader("Content-Type", contentType);
+        }
+        if (authorization != nullptr && authorization[0] != '\0')
+        {
+            http.addHeader("Authorization", authorization);
+        }
+
+        code = (body != nullptr) ? http.POST(*body) : http.GET();
+        response = (code > 0) ? http.getString() : String();
+        const bool redirected = followRedirects && http.getLocation().length() > 0;
+        http.end();
+        ++stats.requests;
+
+        if (reused && isConnectionLevelError(code) && attempt + 1 < UPLINK_MAX_ATTEMPTS)
+        {
+            // Сервер закрыл keep-alive сокет между запросами - повторяем на свежем
+            ++stats.reconnectRetries;
+            closeSlot(*slot);
+            continue;
+        }
+
+        if (reused && code > 0)
+        {
+            // Сэкономлено ровно столько, сколько заняло подключение этого соединения к этому хосту
+            ++stats.reusedRequests;
+            stats.savedMs += slot->connectMs;
+        }
+
+        // После редиректа сокет принадлежит другому хосту; при ошибке или Connection: close - закрыт
+        if (redirected || code <= 0 || !transport.connected())
+        {
+            closeSlot(*slot);
+        }
+        return code;
+    }
+    return code;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file uplink_http_session.h
+ * @brief Постоянная HTTP-сессия для исходящих запросов (ThingSpeak, манифест OTA)
+ * @details Держит сокеты открытыми между запросами (keep-alive) и прозрачно
+ *          переподключается, если сервер закрыл соединение. Соединения
+ *          хранятся в небольшом пуле UPLINK_SESSION_SLOTS слотов по ключу
+ *          (транспорт, хост, порт): запросы ThingSpeak, приёмников и
+ *          манифеста OTA не закрывают сокеты друг друга; при заполненном
+ *          пуле закрывается давно не использованное соединение. Подключение
+ *          выполняется явно и замеряется, поэтому экономия на каждом
+ *          повторно использованном сокете считается по фактическому времени
+ *          установки этого соединения. Запросы сериализуются мьютексом: сессией
+ *          пользуются loop() (манифест OTA) и фоновые задачи ThingSpeak и
+ *          uplink. Вызывающий из loop() ждёт мьютекс не дольше
+ *          UPLINK_SESSION_LOCK_WAIT_MS и при занятой сессии получает
+ *          UPLINK_SESSION_BUSY; фоновые задачи передают portMAX_DELAY.
+ *          Статистика копируется в снимок под отдельным коротким мьютексом,
+ *          поэтому чтение не ждёт идущий запрос.
+ */
+
+#ifndef UPLINK_HTTP_SESSION_H
+#define UPLINK_HTTP_SESSION_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <array>
+#include "jxct_constants.h"
+
+// Статистика сессии для диагностики
+struct UplinkSessionStats
+{
+    uint32_t requests;          // Всего запросов
+    uint32_t reusedRequests;    // Запросов на уже открытом сокете
+    uint32_t connects;          // Новых подключений (TCP/TLS)
+    uint32_t reconnectRetries;  // Повторов после потери сокета
+    uint32_t lastConnectMs;     // Длительность последнего подключения
+    uint32_t totalConnectMs;    // Суммарное время подключений
+    uint32_t savedMs;           // Сэкономлено за счёт повторного использования
+    uint32_t evictions;         // Соединений, закрытых ради другого (пул заполнен)
+};
+
+// Открытое keep-alive соединение: транспорт держит один сокет к одному хосту
+struct UplinkConnectionSlot
+{
+    WiFiClient* transport;
+    std::array<char, 64> host;
+    uint16_t port;
+    uint32_t connectMs;   // Длительность подключения этого соединения
+    uint32_t lastUsedMs;  // millis() последнего запроса - для вытеснения
+};
+
+class UplinkHttpSession
+{
+   public:
+    UplinkHttpSession();
+
+    // GET; при followRedirects сокет после редиректа закрывается (он указывает на другой хост).
+    // lockWait - сколько ждать занятую сессию; по истечении возвращается UPLINK_SESSION_BUSY
+    int get(WiFiClient& transport, const char* url, String& response, uint16_t timeoutMs,
+            bool followRedirects = false, TickType_t lockWait = pdMS_TO_TICKS(UPLINK_SESSION_LOCK_WAIT_MS));
+
+    // POST с телом и типом содержимого; authorization - значение заголовка Authorization (опционально)
+    int post(WiFiClient& transport, const char* url, const char* contentType, const String& body, String& response,
+             uint16_t timeoutMs, const char* authorization = nullptr,
+             TickType_t lockWait = pdMS_TO_TICKS(UPLINK_SESSION_LOCK_WAIT_MS));
+
+    // Принудительное закрытие всех соединений пула
+    void close();
+
+    // Снимок статистики на момент последнего завершённого запроса
+    UplinkSessionStats getStats() const;
+    uint32_t getAverageConnectMs() const;
+    String getStatsJson() const;
+
+   private:
+    int execute(WiFiClient& transport, const char* url, const char* contentType, const char* authorization,
+                const String* body, String& response, uint16_t timeoutMs, bool followRedirects,
+                TickType_t lockWait);
+    int executeLocked(WiFiClient& transport, const char* url, const char* host, uint16_t port,
+                      const char* contentType, const char* authorization, const String* body, String& response,
+                      uint16_t timeoutMs, bool followRedirects);
+    UplinkConnectionSlot* connect(WiFiClient& transport, const char* host, uint16_t port, bool& reused);
+    UplinkConnectionSlot* acquireSlot(WiFiClient& transport);
+    static void closeSlot(UplinkConnectionSlot& slot);
+
+    HTTPClient http;
+    std::array<UplinkConnectionSlot, UPLINK_SESSION_SLOTS> slots = {};
+    UplinkSessionStats stats = {};          // Рабочие счётчики, меняются только под lock
+    UplinkSessionStats statsSnapshot = {};  // Копия для чтения, под statsLock
+    SemaphoreHandle_t lock = nullptr;
+    SemaphoreHandle_t statsLock = nullptr;
+};
+
+// Единая сессия исходящих запросов (общий пул соединений)
+UplinkHttpSession& getUplinkSession();
+
+#endif  // UPLINK_HTTP_SESSION_H
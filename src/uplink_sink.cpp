@@ -0,0 +1,540 @@
+/**
+ * @file uplink_sink.cpp
+ * @brief Общая очередь сэмплов, кодировщики и планировщик uplink-приёмников
+ */
+
+#include "uplink_sink.h"
+#include <NTPClient.h>
+#include <WiFiClient.h>
+#include <array>
+#include <cmath>
+#include "business/sensor_compensation_service.h"
+#include "jxct_config_vars.h"
+#include "jxct_constants.h"
+#include "jxct_device_info.h"
+#include "logger.h"
+#include "modbus_sensor.h"
+#include "sensor_processing.h"
+#include "uplink_http_session.h"
+#include "uplink_tls_client.h"
+#include "validation_utils.h"
+
+extern NTPClient* timeClient;
+
+namespace
+{
+constexpr size_t FORMAT_COUNT = static_cast<size_t>(UplinkFormat::COUNT);
+
+// ----------------------------------------------------------------------------
+// Общая очередь сэмплов (кольцо, адресация по сквозному номеру)
+// ----------------------------------------------------------------------------
+std::array<UplinkSample, UPLINK_SAMPLE_QUEUE_SIZE> samples{};
+uint32_t nextSequence = 1;  // номер следующего сэмпла
+size_t sampleCount = 0;     // сэмплов в очереди
+
+// Кэш кодирования: каждый сэмпл кодируется не более одного раза на формат
+std::array<std::array<String, FORMAT_COUNT>, UPLINK_SAMPLE_QUEUE_SIZE> encodedCache;
+std::array<uint8_t, UPLINK_SAMPLE_QUEUE_SIZE> encodedMask{};
+uint32_t encodeCount = 0;  // для диагностики
+
+std::array<char, 32> deviceTag = {""};
+
+size_t slotOf(uint32_t sequence)
+{
+    return sequence % UPLINK_SAMPLE_QUEUE_SIZE;
+}
+
+uint32_t oldestSequence()
+{
+    return nextSequence - static_cast<uint32_t>(sampleCount);
+}
+
+void encodeInfluxLine(const UplinkSample& sample, String& out)
+{
+    std::array<char, 256> line;
+    int len = snprintf(line.data(), line.size(),
+                       "soil,device=%s temperature=%.2f,humidity=%.2f,asm=%.2f,ec=%.1f,ph=%.2f,nitrogen=%.1f,"
+                       "phosphorus=%.1f,potassium=%.1f",
+                       deviceTag.data(), sample.temperature, sample.humidity, sample.asmPercent, sample.ec, sample.ph,
+                       sample.nitrogen, sample.phosphorus, sample.potassium);
+    // Без NTP метку не ставим - InfluxDB использует время приёма
+    if (sample.epoch != 0 && len > 0 && static_cast<size_t>(len) < line.size())
+    {
+        snprintf(line.data() + len, line.size() - len, " %lu", static_cast<unsigned long>(sample.epoch));
+    }
+    out = line.data();
+}
+
+// Ключи совпадают с компактным JSON MQTT (t, h=ASM, hv=VWC, e, p, n, r, k, ts)
+void encodeJsonSample(const UplinkSample& sample, String& out)
+{
+    std::array<char, 192> json;
+    snprintf(json.data(), json.size(),
+             "{\"seq\":%lu,\"ts\":%lu,\"t\":%.1f,\"h\":%.1f,\"hv\":%.1f,\"e\":%d,\"p\":%.1f,\"n\":%d,\"r\":%d,\"k\":%d}",
+             static_cast<unsigned long>(sample.sequence), static_cast<unsigned long>(sample.epoch), sample.temperature,
+             sample.asmPercent, sample.humidity, static_cast<int>(lroundf(sample.ec)), sample.ph,
+             static_cast<int>(lroundf(sample.nitrogen)), static_cast<int>(lroundf(sample.phosphorus)),
+             static_cast<int>(lroundf(sample.potassium)));
+    out = json.data();
+}
+
+const String& getEncoded(uint32_t sequence, UplinkFormat format)
+{
+    const size_t slot = slotOf(sequence);
+    const size_t formatIndex = static_cast<size_t>(format);
+    const uint8_t bit = static_cast<uint8_t>(1U << formatIndex);
+    String& cached = encodedCache[slot][formatIndex];
+    if ((encodedMask[slot] & bit) == 0)
+    {
+        if (format == UplinkFormat::INFLUX_LINE)
+        {
+            encodeInfluxLine(samples[slot], cached);
+        }
+        else if (format == UplinkFormat::JSON_SAMPLES)
+        {
+            encodeJsonSample(samples[slot], cached);
+        }
+        encodedMask[slot] |= bit;
+        ++encodeCount;
+    }
+    return cached;
+}
+
+void buildPayload(UplinkFormat format, uint32_t firstSequence, size_t count, String& payload)
+{
+    payload = "";
+    if (format == UplinkFormat::NATIVE)
+    {
+        return;
+    }
+
+    payload.reserve(count * 160 + 2);
+    if (format == UplinkFormat::JSON_SAMPLES)
+    {
+        payload += '[';
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+        {
+            payload += (format == UplinkFormat::INFLUX_LINE) ? '\n' : ',';
+        }
+        payload += getEncoded(firstSequence + static_cast<uint32_t>(i), format);
+    }
+    if (format == UplinkFormat::JSON_SAMPLES)
+    {
+        payload += ']';
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Состояние приёмников
+// ----------------------------------------------------------------------------
+struct SinkState
+{
+    IUplinkSink* sink;
+    uint32_t cursor;           // следующий недоставленный сэмпл
+    uint32_t lastDeliveryMs;   // время последней доставки
+    uint32_t nextAttemptMs;    // 0 - без задержки повтора
+    uint32_t inFlightLast;     // последний сэмпл в отправляемом пакете
+    uint32_t inFlightCount;
+    uint32_t delivered;        // доставлено сэмплов
+    uint32_t lost;             // вытеснено из очереди до доставки
+    uint32_t dropped;          // отвергнуто приёмником
+    uint8_t failures;          // ошибок подряд
+    bool inFlight;
+    int lastCode;
+};
+
+std::array<SinkState, UPLINK_MAX_SINKS> sinkStates{};
+size_t sinkCount = 0;
+
+void markSent(SinkState& state, uint32_t lastSequence, uint32_t count)
+{
+    state.cursor = lastSequence + 1;
+    state.lastDeliveryMs = millis();
+    state.nextAttemptMs = 0;
+    state.failures = 0;
+    state.delivered += count;
+}
+
+void applyResult(SinkState& state, UplinkDeliveryResult result, uint32_t lastSequence, uint32_t count)
+{
+    switch (result)
+    {
+        case UplinkDeliveryResult::SENT:
+            markSent(state, lastSequence, count);
+            break;
+        case UplinkDeliveryResult::PENDING:
+            state.inFlight = true;
+            state.inFlightLast = lastSequence;
+            state.inFlightCount = count;
+            break;
+        case UplinkDeliveryResult::DROP:
+            state.cursor = lastSequence + 1;
+            state.lastDeliveryMs = millis();
+            state.nextAttemptMs = 0;
+            state.dropped += count;
+            logWarnSafe("Uplink %s: пакет из %lu сэмплов отвергнут", state.sink->getName(),
+                        static_cast<unsigned long>(count));
+            break;
+        case UplinkDeliveryResult::RETRY:
+        default:
+        {
+            const UplinkRetryPolicy retry = state.sink->getRetryPolicy();
+            if (state.failures < 16)
+            {
+                ++state.failures;
+            }
+            uint32_t delay = retry.baseDelayMs << (state.failures - 1);
+            if (delay > retry.maxDelayMs || delay < retry.baseDelayMs)
+            {
+                delay = retry.maxDelayMs;
+            }
+            state.nextAttemptMs = millis() + delay;
+            if (state.nextAttemptMs == 0)
+            {
+                state.nextAttemptMs = 1;  // 0 зарезервирован под «без задержки»
+            }
+            logDebugSafe("Uplink %s: повтор через %lu мс", state.sink->getName(), static_cast<unsigned long>(delay));
+            break;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Фоновая HTTP-доставка
+// ----------------------------------------------------------------------------
+struct UplinkHttpJob
+{
+    uint8_t sinkIndex;
+    uint8_t transportIndex;  // Транспорт приёмника: свой keep-alive сокет и TLS-сессия
+    String* payload;  // владеет задача
+    std::array<char, 128> url;
+    std::array<char, 40> contentType;
+    std::array<char, 112> authorization;
+    UplinkTlsTrust trust;  // Снимок настроек доверия на момент постановки задания
+};
+
+struct UplinkHttpResult
+{
+    uint8_t sinkIndex;
+    int code;
+};
+
+QueueHandle_t httpJobQueue = nullptr;
+QueueHandle_t httpResultQueue = nullptr;
+
+// Транспорт на HTTP-приёмник: InfluxDB и HTTP JSON держат свои соединения в пуле сессии
+// и не закрывают сокеты друг друга
+struct UplinkHttpTransport
+{
+    explicit UplinkHttpTransport(const char* name) : secure(name) {}
+
+    WiFiClient plain;
+    UplinkTlsClient secure;
+};
+
+UplinkHttpTransport firstHttpTransport("uplink");
+UplinkHttpTransport secondHttpTransport("uplink2");
+std::array<UplinkHttpTransport*, UPLINK_HTTP_TRANSPORTS> httpTransports = {&firstHttpTransport,
+                                                                          &secondHttpTransport};
+std::array<uint8_t, UPLINK_HTTP_TRANSPORTS> transportOwners = {UINT8_MAX, UINT8_MAX};  // sinkIndex владельца
+
+// Транспорт закрепляется за приёмником при первой отправке; лишние приёмники делят транспорты
+uint8_t transportIndexFor(uint8_t sinkIndex)
+{
+    for (size_t i = 0; i < transportOwners.size(); ++i)
+    {
+        if (transportOwners[i] == sinkIndex)
+        {
+            return static_cast<uint8_t>(i);
+        }
+        if (transportOwners[i] == UINT8_MAX)
+        {
+            transportOwners[i] = sinkIndex;
+            return static_cast<uint8_t>(i);
+        }
+    }
+    return static_cast<uint8_t>(sinkIndex % transportOwners.size());
+}
+
+void uplinkHttpTask(void* /*parameters*/)
+{
+    for (;;)
+    {
+        UplinkHttpJob job;
+        if (xQueueReceive(httpJobQueue, &job, portMAX_DELAY) != pdTRUE)
+        {
+            continue;
+        }
+
+        const bool secure = strncmp(job.url.data(), "https://", 8) == 0;
+        UplinkHttpTransport& pair = *httpTransports[job.transportIndex];
+        if (secure)
+        {
+            pair.secure.setTrust(job.trust);
+        }
+        WiFiClient& transport = secure ? static_cast<WiFiClient&>(pair.secure) : pair.plain;
+        String response;
+        const UplinkHttpResult result = {
+            job.sinkIndex, getUplinkSession().post(transport, job.url.data(), job.contentType.data(), *job.payload,
+                                                   response, UPLINK_HTTP_TIMEOUT_MS, job.authorization.data(),
+                                                   portMAX_DELAY)};  // фоновая задача может ждать сессию
+        delete job.payload;
+        xQueueSend(httpResultQueue, &result, portMAX_DELAY);
+    }
+}
+
+void resolveHttpResult(const UplinkHttpResult& result)
+{
+    if (result.sinkIndex >= sinkCount)
+    {
+        return;
+    }
+    SinkState& state = sinkStates[result.sinkIndex];
+    state.inFlight = false;
+    state.lastCode = result.code;
+
+    UplinkDeliveryResult outcome = UplinkDeliveryResult::RETRY;
+    if (result.code >= 200 && result.code < 300)
+    {
+        outcome = UplinkDeliveryResult::SENT;
+    }
+    else if (result.code >= 400 && result.code < 500 && result.code != 408 && result.code != 429)
+    {
+        outcome = UplinkDeliveryResult::DROP;
+    }
+    applyResult(state, outcome, state.inFlightLast, state.inFlightCount);
+}
+
+const char* formatName(UplinkFormat format)
+{
+    switch (format)
+    {
+        case UplinkFormat::INFLUX_LINE:
+            return "influx_line";
+        case UplinkFormat::JSON_SAMPLES:
+            return "json";
+        case UplinkFormat::NATIVE:
+        default:
+            return "native";
+    }
+}
+}  // namespace
+
+bool registerUplinkSink(IUplinkSink* sink)  // NOLINT(misc-use-internal-linkage)
+{
+    if (sink == nullptr || sinkCount >= sinkStates.size())
+    {
+        logError("Uplink: превышено число приёмников");
+        return false;
+    }
+    SinkState& state = sinkStates[sinkCount++];
+    state = SinkState{};
+    state.sink = sink;
+    state.cursor = nextSequence;
+    logSystemSafe("Uplink: зарегистрирован приёмник %s (%s)", sink->getName(), formatName(sink->getFormat()));
+    return true;
+}
+
+UplinkDeliveryResult submitUplinkHttpPost(const UplinkBatch& batch, const char* url, const char* contentType,
+                                          const char* authorization)
+{
+    if (httpJobQueue == nullptr || url == nullptr || url[0] == '\0')
+    {
+        return UplinkDeliveryResult::RETRY;
+    }
+
+    UplinkHttpJob job = {};
+    job.sinkIndex = batch.sinkIndex;
+    job.transportIndex = transportIndexFor(batch.sinkIndex);
+    strlcpy(job.url.data(), url, job.url.size());
+    strlcpy(job.contentType.data(), contentType, job.contentType.size());
+    strlcpy(job.authorization.data(), authorization != nullptr ? authorization : "", job.authorization.size());
+    job.trust.insecure = config.flags.uplinkTlsInsecure != 0;
+    job.trust.hasFingerprint = parseTlsFingerprint(config.uplinkTlsFingerprint, job.trust.fingerprint);
+    job.payload = new String(batch.payload);
+
+    if (xQueueSend(httpJobQueue, &job, 0) != pdTRUE)
+    {
+        delete job.payload;
+        return UplinkDeliveryResult::RETRY;
+    }
+    return UplinkDeliveryResult::PENDING;
+}
+
+void publishUplinkSample()  // NOLINT(misc-use-internal-linkage)
+{
+    if (!sensorData.valid)
+    {
+        return;
+    }
+
+    const uint32_t sequence = nextSequence++;
+    const size_t slot = slotOf(sequence);
+    UplinkSample& sample = samples[slot];
+    sample.sequence = sequence;
+    sample.capturedMs = millis();
+    sample.epoch = 0;
+    if (timeClient != nullptr && timeClient->isTimeSet() && timeClient->getEpochTime() > NTP_TIMESTAMP_2000)
+    {
+        sample.epoch = timeClient->getEpochTime();
+    }
+    sample.temperature = sensorData.temperature;
+    sample.humidity = sensorData.humidity;
+    sample.asmPercent = SensorCompensationService::vwcToAsm(sensorData.humidity / 100.0F,
+                                                            SensorProcessing::getSoilType(config.soilProfile));
+    sample.ec = sensorData.ec;
+    sample.ph = sensorData.ph;
+    sample.nitrogen = sensorData.nitrogen;
+    sample.phosphorus = sensorData.phosphorus;
+    sample.potassium = sensorData.potassium;
+    encodedMask[slot] = 0;  // слот переиспользован - кэш кодирования недействителен
+
+    if (sampleCount < samples.size())
+    {
+        ++sampleCount;
+    }
+
+    for (size_t i = 0; i < sinkCount; ++i)
+    {
+        if (sinkStates[i].sink->isEnabled())
+        {
+            sinkStates[i].sink->onSample(sample);
+        }
+    }
+}
+
+void handleUplinkSinks()  // NOLINT(misc-use-internal-linkage)
+{
+    if (httpResultQueue != nullptr)
+    {
+        UplinkHttpResult result;
+        while (xQueueReceive(httpResultQueue, &result, 0) == pdTRUE)
+        {
+            resolveHttpResult(result);
+        }
+    }
+
+    const uint32_t now = millis();
+    const uint32_t oldest = oldestSequence();
+
+    for (size_t i = 0; i < sinkCount; ++i)
+    {
+        SinkState& state = sinkStates[i];
+        IUplinkSink* sink = state.sink;
+        sink->poll();
+
+        UplinkDeliveryResult deferred = UplinkDeliveryResult::RETRY;
+        if (state.inFlight && sink->takeDeliveryResult(deferred))
+        {
+            state.inFlight = false;
+            applyResult(state, deferred, state.inFlightLast, state.inFlightCount);
+        }
+
+        if (!sink->isEnabled())
+        {
+            state.cursor = nextSequence;  // выключенный приёмник не копит хвост
+            continue;
+        }
+        if (state.inFlight)
+        {
+            continue;
+        }
+        if (static_cast<int32_t>(state.cursor - oldest) < 0)
+        {
+            state.lost += oldest - state.cursor;
+            state.cursor = oldest;
+        }
+
+        const uint32_t pending = nextSequence - state.cursor;
+        if (pending == 0)
+        {
+            continue;
+        }
+
+        const UplinkBatchPolicy batchPolicy = sink->getBatchPolicy();
+        if (now - state.lastDeliveryMs < batchPolicy.intervalMs)
+        {
+            continue;
+        }
+        if (state.nextAttemptMs != 0 && static_cast<int32_t>(now - state.nextAttemptMs) < 0)
+        {
+            continue;
+        }
+        if (!sink->isReady())
+        {
+            continue;
+        }
+
+        // NATIVE-приёмник публикует актуальное состояние - поглощает все ожидающие сэмплы
+        const UplinkFormat format = sink->getFormat();
+        uint32_t count = pending;
+        if (format != UplinkFormat::NATIVE && batchPolicy.maxSamples > 0 && count > batchPolicy.maxSamples)
+        {
+            count = batchPolicy.maxSamples;
+        }
+
+        String payload;
+        buildPayload(format, state.cursor, count, payload);
+        const UplinkBatch batch = {payload, count, static_cast<uint8_t>(i)};
+        applyResult(state, sink->deliver(batch), state.cursor + count - 1, count);
+    }
+}
+
+String getUplinkSinksStatusJson()
+{
+    String json = "{\"queued_samples\":" + String(static_cast<unsigned long>(sampleCount));
+    json += ",\"encodes\":" + String(static_cast<unsigned long>(encodeCount));
+    json += ",\"sinks\":[";
+    for (size_t i = 0; i < sinkCount; ++i)
+    {
+        const SinkState& state = sinkStates[i];
+        if (i > 0)
+        {
+            json += ",";
+        }
+        json += "{\"name\":\"" + String(state.sink->getName()) + "\"";
+        json += ",\"format\":\"" + String(formatName(state.sink->getFormat())) + "\"";
+        json += ",\"enabled\":" + String(state.sink->isEnabled() ? "true" : "false");
+        json += ",\"pending\":" + String(static_cast<unsigned long>(nextSequence - state.cursor));
+        json += ",\"in_flight\":" + String(state.inFlight ? "true" : "false");
+        json += ",\"delivered\":" + String(static_cast<unsigned long>(state.delivered));
+        json += ",\"lost\":" + String(static_cast<unsigned long>(state.lost));
+        json += ",\"dropped\":" + String(static_cast<unsigned long>(state.dropped));
+        json += ",\"failures\":" + String(static_cast<unsigned>(state.failures));
+        json += ",\"last_code\":" + String(state.lastCode) + "}";
+    }
+    json += "],\"tls\":" + getUplinkTlsStatsJson() + "}";
+    return json;
+}
+
+namespace
+{
+void startUplinkHttpTask()
+{
+    if (httpJobQueue != nullptr)
+    {
+        return;
+    }
+    httpJobQueue = xQueueCreate(UPLINK_HTTP_QUEUE_LENGTH, sizeof(UplinkHttpJob));
+    httpResultQueue = xQueueCreate(UPLINK_HTTP_QUEUE_LENGTH, sizeof(UplinkHttpResult));
+    if (httpJobQueue == nullptr || httpResultQueue == nullptr)
+    {
+        logError("Uplink: не удалось создать очереди HTTP-доставки");
+        return;
+    }
+    xTaskCreate(uplinkHttpTask, "Uplink", UPLINK_TASK_STACK_SIZE, nullptr, UPLINK_TASK_PRIORITY, nullptr);
+}
+}  // namespace
+
+// Объявлена в uplink_sinks_builtin.cpp
+void registerBuiltinUplinkSinks();
+
+void setupUplinkSinks()  // NOLINT(misc-use-internal-linkage)
+{
+    strlcpy(deviceTag.data(), getDeviceId().c_str(), deviceTag.size());
+    startUplinkHttpTask();
+    registerBuiltinUplinkSinks();
+}
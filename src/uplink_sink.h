@@ -0,0 +1,126 @@
+/**
+ * @file uplink_sink.h
+ * @brief Подключаемые приёмники данных (uplink-приёмники)
+ * @details Все выгрузки (MQTT, ThingSpeak, InfluxDB, HTTP JSON) читают общую
+ *          очередь сэмплов. Каждый приёмник объявляет формат кодирования,
+ *          политику пакетирования и политику повторов; планировщик сам решает,
+ *          когда вызвать доставку. Сэмпл кодируется один раз на формат, а не на
+ *          приёмник. Новый приёмник регистрируется в setupUplinkSinks() -
+ *          loop() при этом не меняется.
+ */
+
+#ifndef UPLINK_SINK_H
+#define UPLINK_SINK_H
+
+#include <Arduino.h>
+
+// Один сэмпл общей очереди
+struct UplinkSample
+{
+    uint32_t sequence;    // Сквозной номер сэмпла
+    uint32_t capturedMs;  // millis() в момент снятия
+    uint32_t epoch;       // UNIX-время (0 - NTP не синхронизирован)
+    float temperature;
+    float humidity;    // VWC, %
+    float asmPercent;  // ASM, %
+    float ec;
+    float ph;
+    float nitrogen;
+    float phosphorus;
+    float potassium;
+};
+
+// Формат кодирования сэмплов
+enum class UplinkFormat : uint8_t
+{
+    NATIVE,        // Приёмник кодирует данные сам (MQTT, ThingSpeak)
+    INFLUX_LINE,   // InfluxDB line protocol, строки через '\n'
+    JSON_SAMPLES,  // JSON-массив сэмплов
+    COUNT
+};
+
+// Политика пакетирования
+struct UplinkBatchPolicy
+{
+    uint32_t intervalMs;  // Минимальный интервал между доставками
+    uint8_t maxSamples;   // Максимум сэмплов в одной доставке
+};
+
+// Политика повторов (экспоненциальная задержка)
+struct UplinkRetryPolicy
+{
+    uint32_t baseDelayMs;  // Задержка после первой ошибки
+    uint32_t maxDelayMs;   // Верхняя граница задержки
+};
+
+// Результат доставки
+enum class UplinkDeliveryResult : uint8_t
+{
+    SENT,     // Доставлено (или принято собственной очередью приёмника)
+    PENDING,  // Передано фоновой задаче, результат придёт позже
+    RETRY,    // Временная ошибка - повтор по политике повторов
+    DROP      // Пакет отвергнут - повтор бессмысленен
+};
+
+// Пакет, передаваемый приёмнику
+struct UplinkBatch
+{
+    const String& payload;  // Закодированные сэмплы (пусто для NATIVE)
+    size_t sampleCount;
+    uint8_t sinkIndex;  // Для submitUplinkHttpPost()
+};
+
+class IUplinkSink
+{
+   public:
+    virtual ~IUplinkSink() = default;
+
+    virtual const char* getName() const = 0;
+    virtual UplinkFormat getFormat() const = 0;
+    virtual UplinkBatchPolicy getBatchPolicy() const = 0;
+    virtual UplinkRetryPolicy getRetryPolicy() const = 0;
+    virtual bool isEnabled() const = 0;
+
+    // Дополнительные ограничения приёмника (например, лимиты сервиса)
+    virtual bool isReady()
+    {
+        return true;
+    }
+
+    // Периодическое обслуживание (результаты собственной фоновой отправки) - каждый loop()
+    virtual void poll() {}
+
+    // Новый сэмпл поставлен в общую очередь
+    virtual void onSample(const UplinkSample& /*sample*/) {}
+
+    // Доставка пакета; не должна блокироваться на сети (используйте submitUplinkHttpPost)
+    virtual UplinkDeliveryResult deliver(const UplinkBatch& batch) = 0;
+
+    // Итог доставки, которую приёмник вернул как PENDING и выполняет своей фоновой отправкой
+    // (не через submitUplinkHttpPost); опрашивается после poll(). true - итог готов
+    virtual bool takeDeliveryResult(UplinkDeliveryResult& /*result*/)
+    {
+        return false;
+    }
+};
+
+// Регистрация приёмника (до setupUplinkSinks() или из неё)
+bool registerUplinkSink(IUplinkSink* sink);
+
+// Регистрация встроенных приёмников и запуск фоновой задачи HTTP-доставки
+void setupUplinkSinks();
+
+// Снять сэмпл с текущих показаний и поставить в общую очередь
+void publishUplinkSample();
+
+// Планировщик доставки - вызывается из loop()
+void handleUplinkSinks();
+
+// Асинхронный HTTP POST пакета; результат вернётся в планировщик. Возвращает PENDING или RETRY
+UplinkDeliveryResult submitUplinkHttpPost(const UplinkBatch& batch, const char* url, const char* contentType,
+                                          const char* authorization);
+
+// Диагностика приёмников в JSON
+String getUplinkSinksStatusJson();
+
+#endif  // UPLINK_SINK_H
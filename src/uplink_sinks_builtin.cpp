@@ -0,0 +1,207 @@
+/**
+ * @file uplink_sinks_builtin.cpp
+ * @brief Встроенные uplink-приёмники: MQTT, ThingSpeak, InfluxDB, HTTP JSON
+ * @details MQTT и ThingSpeak кодируют данные сами (формат NATIVE) и сохраняют
+ *          свои протоколы; InfluxDB и HTTP JSON получают готовый пакет из общей
+ *          очереди и отправляются фоновой задачей через submitUplinkHttpPost().
+ */
+
+#include <array>
+#include "jxct_config_vars.h"
+#include "jxct_constants.h"
+#include "mqtt_client.h"
+#include "thingspeak_client.h"
+#include "uplink_sink.h"
+
+namespace
+{
+constexpr uint32_t HTTP_SINK_RETRY_BASE_MS = 15000;
+constexpr uint32_t HTTP_SINK_RETRY_MAX_MS = 600000;
+constexpr uint32_t THINGSPEAK_SINK_RETRY_BASE_MS = 20000;  // Не чаще лимита ThingSpeak (15 с)
+constexpr uint32_t THINGSPEAK_SINK_RETRY_MAX_MS = 300000;
+
+class MqttSink : public IUplinkSink
+{
+   public:
+    const char* getName() const override
+    {
+        return "mqtt";
+    }
+    UplinkFormat getFormat() const override
+    {
+        return UplinkFormat::NATIVE;
+    }
+    UplinkBatchPolicy getBatchPolicy() const override
+    {
+        return {config.mqttPublishInterval, 1};
+    }
+    UplinkRetryPolicy getRetryPolicy() const override
+    {
+        return {MQTT_RECONNECT_INTERVAL, MQTT_RECONNECT_INTERVAL};
+    }
+    bool isEnabled() const override
+    {
+        return config.flags.mqttEnabled;
+    }
+    UplinkDeliveryResult deliver(const UplinkBatch& /*batch*/) override
+    {
+        // Публикация - сетевая запись, а приёмники опрашиваются под WebServerLock: её выполняет
+        // handleMQTT() вне блокировки, итог приходит через takeDeliveryResult()
+        requestSensorDataPublish();
+        return UplinkDeliveryResult::PENDING;
+    }
+    bool takeDeliveryResult(UplinkDeliveryResult& result) override
+    {
+        MqttPublishResult published = MqttPublishResult::NOT_CONNECTED;
+        if (!takeSensorDataPublishResult(published))
+        {
+            return false;
+        }
+        // publishSensorData() сам проверяет подключение и дедуплицирует данные; без изменений
+        // публиковать нечего - сэмплы считаются доставленными (state-топик сохраняется брокером)
+        switch (published)
+        {
+            case MqttPublishResult::PUBLISHED:
+            case MqttPublishResult::UNCHANGED:
+                result = UplinkDeliveryResult::SENT;
+                break;
+            case MqttPublishResult::NOT_CONNECTED:
+            case MqttPublishResult::FAILED:
+            default:
+                result = UplinkDeliveryResult::RETRY;
+                break;
+        }
+        return true;
+    }
+};
+
+class ThingSpeakSink : public IUplinkSink
+{
+   public:
+    const char* getName() const override
+    {
+        return "thingspeak";
+    }
+    UplinkFormat getFormat() const override
+    {
+        return UplinkFormat::NATIVE;
+    }
+    UplinkBatchPolicy getBatchPolicy() const override
+    {
+        return {config.thingSpeakInterval, 1};
+    }
+    UplinkRetryPolicy getRetryPolicy() const override
+    {
+        return {THINGSPEAK_SINK_RETRY_BASE_MS, THINGSPEAK_SINK_RETRY_MAX_MS};
+    }
+    bool isEnabled() const override
+    {
+        return config.flags.thingSpeakEnabled;
+    }
+    bool isReady() override
+    {
+        // Лимиты ThingSpeak, блокировка после ошибок, незавершённая отправка
+        return canSendToThingSpeak();
+    }
+    void onSample(const UplinkSample& /*sample*/) override
+    {
+        queueThingSpeakSample();  // Сэмпл в буфер пакетной отправки bulk_update
+    }
+    void poll() override
+    {
+        handleThingSpeak();
+    }
+    UplinkDeliveryResult deliver(const UplinkBatch& /*batch*/) override
+    {
+        // Запрос выполняет фоновая задача ThingSpeak; итог приходит через handleThingSpeak()
+        return sendDataToThingSpeak() ? UplinkDeliveryResult::PENDING : UplinkDeliveryResult::RETRY;
+    }
+    bool takeDeliveryResult(UplinkDeliveryResult& result) override
+    {
+        bool delivered = false;
+        if (!takeThingSpeakUploadOutcome(delivered))
+        {
+            return false;
+        }
+        // Отклонённые сэмплы клиент держит в своём буфере и досылает сам - только повтор, не DROP
+        result = delivered ? UplinkDeliveryResult::SENT : UplinkDeliveryResult::RETRY;
+        return true;
+    }
+};
+
+class InfluxDbSink : public IUplinkSink
+{
+   public:
+    const char* getName() const override
+    {
+        return "influxdb";
+    }
+    UplinkFormat getFormat() const override
+    {
+        return UplinkFormat::INFLUX_LINE;
+    }
+    UplinkBatchPolicy getBatchPolicy() const override
+    {
+        return {UPLINK_SINK_INTERVAL_MS, UPLINK_SINK_MAX_BATCH};
+    }
+    UplinkRetryPolicy getRetryPolicy() const override
+    {
+        return {HTTP_SINK_RETRY_BASE_MS, HTTP_SINK_RETRY_MAX_MS};
+    }
+    bool isEnabled() const override
+    {
+        return config.flags.influxEnabled && config.influxUrl[0] != '\0';
+    }
+    UplinkDeliveryResult deliver(const UplinkBatch& batch) override
+    {
+        std::array<char, 112> authorization = {""};
+        if (config.influxToken[0] != '\0')
+        {
+            snprintf(authorization.data(), authorization.size(), "Token %s", config.influxToken);
+        }
+        return submitUplinkHttpPost(batch, config.influxUrl, "text/plain; charset=utf-8", authorization.data());
+    }
+};
+
+class HttpJsonSink : public IUplinkSink
+{
+   public:
+    const char* getName() const override
+    {
+        return "http_json";
+    }
+    UplinkFormat getFormat() const override
+    {
+        return UplinkFormat::JSON_SAMPLES;
+    }
+    UplinkBatchPolicy getBatchPolicy() const override
+    {
+        return {UPLINK_SINK_INTERVAL_MS, UPLINK_SINK_MAX_BATCH};
+    }
+    UplinkRetryPolicy getRetryPolicy() const override
+    {
+        return {HTTP_SINK_RETRY_BASE_MS, HTTP_SINK_RETRY_MAX_MS};
+    }
+    bool isEnabled() const override
+    {
+        return config.flags.httpJsonEnabled && config.httpJsonUrl[0] != '\0';
+    }
+    UplinkDeliveryResult deliver(const UplinkBatch& batch) override
+    {
+        return submitUplinkHttpPost(batch, config.httpJsonUrl, "application/json", nullptr);
+    }
+};
+
+MqttSink mqttSink;
+ThingSpeakSink thingSpeakSink;
+InfluxDbSink influxDbSink;
+HttpJsonSink httpJsonSink;
+}  // namespace
+
+void registerBuiltinUplinkSinks()  // NOLINT(misc-use-internal-linkage)
+{
+    registerUplinkSink(&mqttSink);
+    registerUplinkSink(&thingSpeakSink);
+    registerUplinkSink(&influxDbSink);
+    registerUplinkSink(&httpJsonSink);
+}
@@ -0,0 +1,459 @@
+/**
+ * @file uplink_tls_client.cpp
+ * @brief Рукопожатие TLS с кэшем сессий и проверкой по закреплённым корням
+ * @details Повторяет start_ssl_client() из ядра Arduino, но до рукопожатия
+ *          предлагает серверу сохранённую сессию (mbedtls_ssl_set_session) и
+ *          использует общий, разобранный один раз набор корней. После
+ *          подключения чтение/запись выполняет штатный WiFiClientSecure.
+ *          stop_ssl_socket() ядра 2.0.x освобождает ssl_conf.ca_chain при
+ *          каждом stop() - общие корни отвязываются от конфигурации до этого.
+ */
+
+#include "uplink_tls_client.h"
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <lwip/sockets.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/sha256.h>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include "jxct_constants.h"
+#include "logger.h"
+#include "uplink_tls_anchors.h"
+
+namespace
+{
+constexpr size_t MAX_TLS_CLIENTS = 4;
+constexpr char DRBG_PERSONALIZATION[] = "jxct-uplink-tls";
+
+// ----------------------------------------------------------------------------
+// Кэш сессий (общий для всех клиентов: OTA в loop(), приёмники в фоновой задаче)
+// ----------------------------------------------------------------------------
+struct TlsSessionEntry
+{
+    std::array<char, 64> host;
+    uint16_t port;
+    uint32_t savedMs;
+    bool valid;
+    uint32_t trustTag;  // Сессия возобновляется только при том же доверии
+    mbedtls_ssl_session session;
+};
+
+std::array<TlsSessionEntry, TLS_SESSION_CACHE_SIZE> sessionCache{};
+SemaphoreHandle_t cacheLock = nullptr;
+
+// Закреплённые корни разбираются один раз, а не на каждое подключение
+mbedtls_x509_crt trustAnchors;
+bool trustAnchorsReady = false;
+
+std::array<UplinkTlsClient*, MAX_TLS_CLIENTS> tlsClients{};
+size_t tlsClientCount = 0;
+
+void lockCache()
+{
+    if (cacheLock == nullptr)
+    {
+        cacheLock = xSemaphoreCreateMutex();
+    }
+    xSemaphoreTake(cacheLock, portMAX_DELAY);
+}
+
+void unlockCache()
+{
+    xSemaphoreGive(cacheLock);
+}
+
+mbedtls_x509_crt* getTrustAnchors()
+{
+    if (!trustAnchorsReady)
+    {
+        mbedtls_x509_crt_init(&trustAnchors);
+        const int ret =
+            mbedtls_x509_crt_parse(&trustAnchors, reinterpret_cast<const unsigned char*>(UPLINK_TLS_TRUST_ANCHORS),
+                                   sizeof(UPLINK_TLS_TRUST_ANCHORS));
+        if (ret != 0)
+        {
+            logErrorSafe("TLS: не удалось разобрать закреплённые корни (%d)", ret);
+        }
+        trustAnchorsReady = true;
+    }
+    return &trustAnchors;
+}
+
+TlsSessionEntry* findSession(const char* host, uint16_t port)
+{
+    for (auto& entry : sessionCache)
+    {
+        if (entry.valid && entry.port == port && strcmp(entry.host.data(), host) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+// Предложить серверу сохранённую сессию; true - сессия предложена
+bool restoreSession(mbedtls_ssl_context& ssl, const char* host, uint16_t port, uint32_t trustTag)
+{
+    lockCache();
+    bool offered = false;
+    TlsSessionEntry* entry = findSession(host, port);
+    if (entry != nullptr)
+    {
+        if (millis() - entry->savedMs > TLS_SESSION_MAX_AGE_MS || entry->trustTag != trustTag)
+        {
+            mbedtls_ssl_session_free(&entry->session);
+            entry->valid = false;
+        }
+        else
+        {
+            offered = mbedtls_ssl_set_session(&ssl, &entry->session) == 0;
+        }
+    }
+    unlockCache();
+    return offered;
+}
+
+void storeSession(const mbedtls_ssl_context& ssl, const char* host, uint16_t port, uint32_t trustTag)
+{
+    lockCache();
+    TlsSessionEntry* entry = findSession(host, port);
+    if (entry == nullptr)
+    {
+        // Свободная или самая старая запись
+        entry = &sessionCache[0];
+        for (auto& candidate : sessionCache)
+        {
+            if (!candidate.valid)
+            {
+                entry = &candidate;
+                break;
+            }
+            if (candidate.savedMs < entry->savedMs)
+            {
+                entry = &candidate;
+            }
+        }
+    }
+    if (entry->valid)
+    {
+        mbedtls_ssl_session_free(&entry->session);
+    }
+    mbedtls_ssl_session_init(&entry->session);
+    entry->valid = mbedtls_ssl_get_session(&ssl, &entry->session) == 0;
+    strlcpy(entry->host.data(), host, entry->host.size());
+    entry->port = port;
+    entry->trustTag = trustTag;
+    entry->savedMs = millis();
+    unlockCache();
+}
+
+void dropSession(const char* host, uint16_t port)
+{
+    lockCache();
+    TlsSessionEntry* entry = findSession(host, port);
+    if (entry != nullptr)
+    {
+        mbedtls_ssl_session_free(&entry->session);
+        entry->valid = false;
+    }
+    unlockCache();
+}
+}  // namespace
+
+UplinkTlsClient::UplinkTlsClient(const char* name) : clientName(name)
+{
+    if (tlsClientCount < tlsClients.size())
+    {
+        tlsClients[tlsClientCount++] = this;
+    }
+}
+
+UplinkTlsClient::~UplinkTlsClient()
+{
+    // Деструктор WiFiClientSecure вызывает свой stop(), а не переопределённый
+    stop();
+}
+
+void UplinkTlsClient::stop()
+{
+    // Корни общие для всех клиентов и подключений: освобождать их ядру нельзя
+    sslclient->ssl_conf.ca_chain = nullptr;
+    WiFiClientSecure::stop();
+}
+
+void UplinkTlsClient::setTrust(const UplinkTlsTrust& value)
+{
+    const uint32_t previousTag = trustTag();
+    trust = value;
+    if (trustTag() == previousTag)
+    {
+        return;
+    }
+    if (trust.insecure)
+    {
+        logWarnSafe("TLS %s: проверка сертификата сервера отключена настройкой", clientName);
+    }
+    if (_connected)
+    {
+        stop();
+    }
+}
+
+uint32_t UplinkTlsClient::trustTag() const
+{
+    // FNV-1a по режиму и отпечатку; 0 - только закреплённые корни
+    if (!trust.insecure && !trust.hasFingerprint)
+    {
+        return 0;
+    }
+    uint32_t hash = 2166136261U ^ (trust.insecure ? 1U : 2U);
+    hash *= 16777619U;
+    for (const uint8_t byte : trust.fingerprint)
+    {
+        hash = (hash ^ byte) * 16777619U;
+    }
+    return hash == 0 ? 1 : hash;
+}
+
+int UplinkTlsClient::connect(const char* host, uint16_t port)
+{
+    return connect(host, port, static_cast<int32_t>(TLS_CONNECT_TIMEOUT_MS));
+}
+
+int UplinkTlsClient::connect(const char* host, uint16_t port, int32_t timeoutMs)
+{
+    stop();
+    if (!openSocket(host, port, timeoutMs))
+    {
+        ++stats.failures;
+        stop();
+        return 0;
+    }
+
+    const int ret = handshake(host, port);
+    _lastError = ret;
+    if (ret != 0)
+    {
+        ++stats.failures;
+        stop();
+        return 0;
+    }
+    _connected = true;
+    return 1;
+}
+
+bool UplinkTlsClient::openSocket(const char* host, uint16_t port, int32_t timeoutMs)
+{
+    IPAddress address;
+    if (!WiFi.hostByName(host, address))
+    {
+        logWarnSafe("TLS: DNS не разрешил %s", host);
+        return false;
+    }
+
+    const int fd = lwip_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0)
+    {
+        return false;
+    }
+    sslclient->socket = fd;
+
+    struct sockaddr_in serverAddr = {};
+    serverAddr.sin_family = AF_INET;
+    serverAddr.sin_addr.s_addr = static_cast<uint32_t>(address);
+    serverAddr.sin_port = htons(port);
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    int res = lwip_connect(fd, reinterpret_cast<struct sockaddr*>(&serverAddr), sizeof(serverAddr));
+    if (res < 0 && errno != EINPROGRESS)
+    {
+        return false;
+    }
+
+    fd_set writeSet;
+    FD_ZERO(&writeSet);
+    FD_SET(fd, &writeSet);
+    struct timeval tv = {timeoutMs / 1000, (timeoutMs % 1000) * 1000};
+    res = select(fd + 1, nullptr, &writeSet, nullptr, &tv);
+    if (res <= 0)
+    {
+        logWarnSafe("TLS: таймаут TCP-подключения к %s:%u", host, static_cast<unsigned>(port));
+        return false;
+    }
+
+    int sockErr = 0;
+    socklen_t len = sizeof(sockErr);
+    getsockopt(fd, SOL_SOCKET, SO_ERROR, &sockErr, &len);
+    return sockErr == 0;
+}
+
+int UplinkTlsClient::onVerify(void* context, mbedtls_x509_crt* /*crt*/, int /*depth*/, uint32_t* /*flags*/)
+{
+    // Вызывается только при полном рукопожатии - при возобновлении сертификаты не передаются
+    static_cast<UplinkTlsClient*>(context)->certificateChecked = true;
+    return 0;  // Решение принимает mbedTLS по флагам (MBEDTLS_SSL_VERIFY_REQUIRED)
+}
+
+int UplinkTlsClient::handshake(const char* host, uint16_t port)
+{
+    mbedtls_ssl_init(&sslclient->ssl_ctx);
+    mbedtls_ssl_config_init(&sslclient->ssl_conf);
+    mbedtls_ctr_drbg_init(&sslclient->drbg_ctx);
+    mbedtls_entropy_init(&sslclient->entropy_ctx);
+
+    int ret = mbedtls_ctr_drbg_seed(&sslclient->drbg_ctx, mbedtls_entropy_func, &sslclient->entropy_ctx,
+                                    reinterpret_cast<const unsigned char*>(DRBG_PERSONALIZATION),
+                                    sizeof(DRBG_PERSONALIZATION) - 1);
+    if (ret == 0)
+    {
+        ret = mbedtls_ssl_config_defaults(&sslclient->ssl_conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                          MBEDTLS_SSL_PRESET_DEFAULT);
+    }
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    lockCache();
+    mbedtls_x509_crt* anchors = getTrustAnchors();
+    unlockCache();
+
+    // С отпечатком цепочка вне корней не обрывает рукопожатие - решение после него
+    int authMode = MBEDTLS_SSL_VERIFY_REQUIRED;
+    if (trust.insecure)
+    {
+        authMode = MBEDTLS_SSL_VERIFY_NONE;
+    }
+    else if (trust.hasFingerprint)
+    {
+        authMode = MBEDTLS_SSL_VERIFY_OPTIONAL;
+    }
+    mbedtls_ssl_conf_authmode(&sslclient->ssl_conf, authMode);
+    mbedtls_ssl_conf_ca_chain(&sslclient->ssl_conf, anchors, nullptr);
+    mbedtls_ssl_conf_verify(&sslclient->ssl_conf, onVerify, this);
+    mbedtls_ssl_conf_rng(&sslclient->ssl_conf, mbedtls_ctr_drbg_random, &sslclient->drbg_ctx);
+    mbedtls_ssl_conf_session_tickets(&sslclient->ssl_conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+
+    ret = mbedtls_ssl_setup(&sslclient->ssl_ctx, &sslclient->ssl_conf);
+    if (ret == 0)
+    {
+        ret = mbedtls_ssl_set_hostname(&sslclient->ssl_ctx, host);
+    }
+    if (ret != 0)
+    {
+        return ret;
+    }
+    mbedtls_ssl_set_bio(&sslclient->ssl_ctx, &sslclient->socket, mbedtls_net_send, mbedtls_net_recv, nullptr);
+
+    const uint32_t tag = trustTag();
+    const bool offered = restoreSession(sslclient->ssl_ctx, host, port, tag);
+    certificateChecked = false;
+
+    const unsigned long started = millis();
+    while ((ret = mbedtls_ssl_handshake(&sslclient->ssl_ctx)) != 0)
+    {
+        if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE)
+        {
+            break;
+        }
+        if (millis() - started > TLS_HANDSHAKE_TIMEOUT_MS)
+        {
+            ret = MBEDTLS_ERR_SSL_TIMEOUT;
+            break;
+        }
+        vTaskDelay(2);
+    }
+    const uint32_t elapsed = static_cast<uint32_t>(millis() - started);
+
+    // VERIFY_OPTIONAL: цепочка вне корней допустима только с закреплённым отпечатком
+    if (ret == 0 && authMode == MBEDTLS_SSL_VERIFY_OPTIONAL &&
+        mbedtls_ssl_get_verify_result(&sslclient->ssl_ctx) != 0 && !peerMatchesFingerprint())
+    {
+        ret = MBEDTLS_ERR_X509_CERT_VERIFY_FAILED;
+    }
+
+    if (ret != 0)
+    {
+        // Сессия могла быть отвергнута некорректно - следующее подключение будет полным
+        dropSession(host, port);
+        const uint32_t verifyFlags = mbedtls_ssl_get_verify_result(&sslclient->ssl_ctx);
+        if (ret == MBEDTLS_ERR_X509_CERT_VERIFY_FAILED && (verifyFlags & MBEDTLS_X509_BADCERT_NOT_TRUSTED) != 0)
+        {
+            ++stats.pinRejections;
+            logErrorSafe("TLS %s: цепочка %s не привязана к закреплённым корням", clientName, host);
+        }
+        else
+        {
+            logWarnSafe("TLS %s: рукопожатие с %s не удалось (-0x%04x, флаги 0x%lx)", clientName, host,
+                        static_cast<unsigned>(-ret), static_cast<unsigned long>(verifyFlags));
+        }
+        return ret;
+    }
+
+    const bool resumed = offered && !certificateChecked;
+    ++stats.handshakes;
+    stats.lastHandshakeMs = elapsed;
+    if (resumed)
+    {
+        ++stats.resumed;
+        stats.totalResumedMs += elapsed;
+    }
+    else
+    {
+        stats.totalFullMs += elapsed;
+    }
+    // Сохраняем и после возобновления: сервер мог выдать новый ticket
+    storeSession(sslclient->ssl_ctx, host, port, tag);
+    logDebugSafe("TLS %s: %s за %lu мс (%s)", clientName, host, static_cast<unsigned long>(elapsed),
+                 resumed ? "возобновлено" : "полное рукопожатие");
+    return 0;
+}
+
+bool UplinkTlsClient::peerMatchesFingerprint() const
+{
+    // При возобновлении сертификат берётся из сохранённой сессии
+    const mbedtls_x509_crt* peer = mbedtls_ssl_get_peer_cert(&sslclient->ssl_ctx);
+    if (peer == nullptr || peer->raw.p == nullptr)
+    {
+        return false;
+    }
+    std::array<unsigned char, 32> digest{};
+    if (mbedtls_sha256_ret(peer->raw.p, peer->raw.len, digest.data(), 0) != 0)
+    {
+        return false;
+    }
+    return memcmp(digest.data(), trust.fingerprint.data(), digest.size()) == 0;
+}
+
+String UplinkTlsClient::getStatsJson() const
+{
+    const uint32_t fullHandshakes = stats.handshakes - stats.resumed;
+    String json = "{\"name\":\"" + String(clientName) + "\"";
+    json += ",\"handshakes\":" + String(stats.handshakes);
+    json += ",\"resumed\":" + String(stats.resumed);
+    json += ",\"failures\":" + String(stats.failures);
+    json += ",\"pin_rejections\":" + String(stats.pinRejections);
+    json += ",\"last_handshake_ms\":" + String(stats.lastHandshakeMs);
+    json += ",\"avg_full_ms\":" + String(fullHandshakes > 0 ? stats.totalFullMs / fullHandshakes : 0);
+    json += ",\"avg_resumed_ms\":" + String(stats.resumed > 0 ? stats.totalResumedMs / stats.resumed : 0);
+    json += "}";
+    return json;
+}
+
+String getUplinkTlsStatsJson()
+{
+    String json = "[";
+    for (size_t i = 0; i < tlsClientCount; ++i)
+    {
+        if (i > 0)
+        {
+            json += ",";
+        }
+        json += tlsClients[i]->getStatsJson();
+    }
+    json += "]";
+    return json;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file uplink_tls_client.h
+ * @brief HTTPS-клиент с возобновлением TLS-сессий и закреплёнными корнями
+ * @details Полное рукопожатие TLS на ESP32 занимает секунды CPU. Клиент
+ *          сохраняет сессию (session ID / ticket) для каждого хоста и при
+ *          следующем подключении предлагает её серверу - сокращённое
+ *          рукопожатие без обмена сертификатами и операций с ключами.
+ *          Цепочка сервера проверяется против корней из uplink_tls_anchors.h;
+ *          для собственных серверов (частный CA, самоподписанный сертификат)
+ *          приёмник может закрепить SHA-256 сертификата сервера или явно
+ *          отключить проверку (UplinkTlsTrust). Время рукопожатий (полных и
+ *          возобновлённых) учитывается для диагностики.
+ */
+
+#ifndef UPLINK_TLS_CLIENT_H
+#define UPLINK_TLS_CLIENT_H
+
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+#include <array>
+
+// Статистика рукопожатий
+struct UplinkTlsStats
+{
+    uint32_t handshakes;      // Успешных рукопожатий
+    uint32_t resumed;         // Из них возобновлённых
+    uint32_t failures;        // Ошибок подключения/рукопожатия
+    uint32_t pinRejections;   // Цепочка не привязана к закреплённым корням
+    uint32_t lastHandshakeMs;
+    uint32_t totalFullMs;     // Суммарное время полных рукопожатий
+    uint32_t totalResumedMs;  // Суммарное время возобновлённых рукопожатий
+};
+
+// Доверие к серверу сверх закреплённых корней (config.uplinkTlsFingerprint, config.flags.uplinkTlsInsecure)
+struct UplinkTlsTrust
+{
+    std::array<uint8_t, 32> fingerprint;  // SHA-256 DER-сертификата сервера
+    bool hasFingerprint;                  // Цепочка вне корней принимается при совпадении отпечатка
+    bool insecure;                        // Явный отказ от проверки сертификата
+};
+
+class UplinkTlsClient : public WiFiClientSecure
+{
+   public:
+    explicit UplinkTlsClient(const char* name);
+    ~UplinkTlsClient() override;
+
+    int connect(const char* host, uint16_t port) override;
+    int connect(const char* host, uint16_t port, int32_t timeoutMs) override;
+    void stop() override;
+
+    // Новое доверие действует со следующего подключения; открытое соединение закрывается
+    void setTrust(const UplinkTlsTrust& value);
+
+    const UplinkTlsStats& getStats() const
+    {
+        return stats;
+    }
+    String getStatsJson() const;
+
+   private:
+    bool openSocket(const char* host, uint16_t port, int32_t timeoutMs);
+    int handshake(const char* host, uint16_t port);
+    bool peerMatchesFingerprint() const;
+    uint32_t trustTag() const;
+    static int onVerify(void* context, mbedtls_x509_crt* crt, int depth, uint32_t* flags);
+
+    const char* clientName;
+    bool certificateChecked = false;  // false после рукопожатия - сессия возобновлена
+    UplinkTlsTrust trust = {};
+    UplinkTlsStats stats = {};
+};
+
+// Статистика всех TLS-клиентов в JSON (массив)
+String getUplinkTlsStatsJson();
+
+#endif  // UPLINK_TLS_CLIENT_H
@@ -662,3 +662,46 @@ ValidationResult validateThingSpeakAPIKey(const String& apiKey)  // NOLINT(misc-
     }
     return ValidationResult{true, ""};
 }
+
+bool parseTlsFingerprint(const char* text, std::array<uint8_t, 32>& digest)  // NOLINT(misc-use-internal-linkage)
+{
+    size_t nibbles = 0;
+    for (const char* c = text; c != nullptr && *c != '\0'; ++c)
+    {
+        if (*c == ':' || *c == ' ')
+        {
+            continue;
+        }
+        int value = -1;
+        if (*c >= '0' && *c <= '9')
+        {
+            value = *c - '0';
+        }
+        else if (*c >= 'a' && *c <= 'f')
+        {
+            value = *c - 'a' + 10;
+        }
+        else if (*c >= 'A' && *c <= 'F')
+        {
+            value = *c - 'A' + 10;
+        }
+        if (value < 0 || nibbles >= digest.size() * 2)
+        {
+            return false;
+        }
+        const size_t index = nibbles / 2;
+        digest[index] = static_cast<uint8_t>((nibbles % 2 == 0) ? value << 4 : (digest[index] | value));
+        ++nibbles;
+    }
+    return nibbles == digest.size() * 2;
+}
+
+ValidationResult validateTlsFingerprint(const String& fingerprint)  // NOLINT(misc-use-internal-linkage)
+{
+    std::array<uint8_t, 32> digest{};
+    if (fingerprint.length() == 0 || parseTlsFingerprint(fingerprint.c_str(), digest))
+    {
+        return ValidationResult{true, ""};
+    }
+    return ValidationResult{false, "Отпечаток сертификата: 64 hex-цифры SHA-256 (разделители ':' допустимы)"};
+}
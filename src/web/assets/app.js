@@ -0,0 +1,548 @@
+// Панель устройства: разделы показаний, калибровки и сервиса рисуются в браузере.
+// Прошивка отдаёт только данные: /api/v1/bootstrap при загрузке, дальше - поток
+// показаний /api/v1/events (или опрос /sensor_json) и статусы через JSON API.
+
+const API_BOOTSTRAP = '/api/v1/bootstrap';
+const API_EVENTS = '/api/v1/events';
+
+// Как navHtml() на сервере: в режиме точки доступа - только настройки
+const NAV_LINKS = [
+    ['/', '⚙️ Настройки'],
+    ['/readings', '📊 Данные'],
+    ['/calibration', '🧪 Калибр.'],
+    ['/intervals', '⏱️ Интерв.'],
+    ['/config_manager', '📁 Конфиг'],
+    ['/updates', '🚀 ОТА'],
+    ['/service', '🔧 Сервис']
+];
+
+const CROP_NAMES = {
+    tomato: 'Томаты', cucumber: 'Огурцы', pepper: 'Перец', lettuce: 'Салат', blueberry: 'Голубика',
+    lawn: 'Газон', grape: 'Виноград', conifer: 'Хвойные', strawberry: 'Клубника', apple: 'Яблоня',
+    pear: 'Груша', cherry: 'Вишня', raspberry: 'Малина', currant: 'Смородина', spinach: 'Шпинат',
+    basil: 'Базилик', cannabis: 'Конопля', wheat: 'Пшеница', potato: 'Картофель', kale: 'Кале',
+    blackberry: 'Ежевика', soybean: 'Соя', carrot: 'Морковь'
+};
+
+let boot = null;
+// Таймеры и потоки текущего раздела - закрываются при переходе
+let cleanups = [];
+
+function byId(id) {
+    return document.getElementById(id);
+}
+
+function escapeHtml(text) {
+    return String(text).replace(/[&<>"']/g, c => ({'&': '&amp;', '<': '&lt;', '>': '&gt;', '"': '&quot;', "'": '&#39;'}[c]));
+}
+
+function setText(id, value) {
+    const element = byId(id);
+    if (element && value !== undefined && value !== null) {
+        element.textContent = value;
+    }
+}
+
+function setColor(id, cls) {
+    const element = byId(id);
+    if (!element) return;
+    element.classList.remove('red', 'orange', 'yellow', 'green');
+    element.classList.add(cls || 'green');
+}
+
+function getJson(url) {
+    return fetch(url).then(r => {
+        if (!r.ok) throw new Error('HTTP ' + r.status);
+        return r.json();
+    });
+}
+
+// POST с JSON-телом; токен CSRF из bootstrap уходит заголовком X-CSRF-Token
+function postJson(url, body) {
+    const headers = {'X-CSRF-Token': boot.csrf_token};
+    const options = {method: 'POST', headers: headers};
+    if (body !== undefined) {
+        headers['Content-Type'] = 'application/json';
+        options.body = JSON.stringify(body);
+    }
+    return fetch(url, options).then(r => r.json());
+}
+
+function csrfField() {
+    return "<input type='hidden' name='csrf_token' value='" + escapeHtml(boot.csrf_token) + "'>";
+}
+
+function section(title, body, extraClass) {
+    return "<div class='section panel " + (extraClass || '') + "'><h3>" + title + '</h3>' + body + '</div>';
+}
+
+function list(items) {
+    return "<ul style='margin:0;padding-left:20px;'>" + items.map(item => '<li>' + item + '</li>').join('') + '</ul>';
+}
+
+// ============================================================================
+// ПОКАЗАНИЯ
+// ============================================================================
+
+const SENSOR_ROWS = [
+    ['temp', '🌡️ Температура, °C', 'temperature', '', ''],
+    ['hum', '💧 Влажность, %', 'humidity', ' VWC', ' ASM'],
+    ['ec', '⚡ EC, µS/cm', 'ec', '', ''],
+    ['ph', '⚗️ pH', 'ph', '', ''],
+    ['n', '🌿 Азот (N), мг/кг', 'nitrogen', '', ''],
+    ['p', '🌱 Фосфор (P), мг/кг', 'phosphorus', '', ''],
+    ['k', '🍎 Калий (K), мг/кг', 'potassium', '', '']
+];
+
+// Рабочий диапазон и точность датчика JXCT для подсветки RAW
+const SENSOR_RANGES = {
+    temp: {min: -40, max: 80, precision: '±0.5°C'},
+    hum: {min: 0, max: 100, precision: '±3%RH', lowPrecision: '±5%RH'},
+    ec: {min: 0, max: 20000, precision: '±2-5%'},
+    ph: {min: 3, max: 9, precision: '±0.3pH'},
+    n: {min: 0, max: 1999, precision: '2%'},
+    p: {min: 0, max: 1999, precision: '2%'},
+    k: {min: 0, max: 1999, precision: '2%'}
+};
+
+// Порог стрелки ↑↓ для каждого параметра
+const ARROW_TOLERANCE = {temp: 0.2, hum: 0.5, ec: 20, ph: 0.05, n: 5, p: 3, k: 3};
+
+function colorSensorRange(value, key) {
+    const range = SENSOR_RANGES[key];
+    if (value < range.min || value > range.max) return 'red';
+    // Выше 53% влажности точность датчика падает до ±5%RH
+    if (key === 'hum' && value > 53) return 'yellow';
+    return 'green';
+}
+
+function colorCompensationDeviation(compensated, raw) {
+    if (raw === 0) return '';
+    const deviation = Math.abs((compensated - raw) / raw * 100);
+    if (deviation <= 5) return 'green';
+    if (deviation <= 10) return 'yellow';
+    if (deviation <= 15) return 'orange';
+    return 'red';
+}
+
+function colorDelta(value, target) {
+    const diff = Math.abs(value - target) / target * 100;
+    if (diff > 30) return 'red';
+    if (diff > 20) return 'orange';
+    if (diff > 10) return 'yellow';
+    return '';
+}
+
+function arrowSign(base, value, threshold) {
+    base = parseFloat(base);
+    value = parseFloat(value);
+    if (isNaN(base) || isNaN(value)) return '';
+    if (value > base + threshold) return '↑ ';
+    if (value < base - threshold) return '↓ ';
+    return '';
+}
+
+function readingsView() {
+    const recHeader = CROP_NAMES[boot.crop_id] || 'Реком.';
+    let rows = '';
+    SENSOR_ROWS.forEach(([key, label, , rawUnit, unit]) => {
+        const season = ['n', 'p', 'k'].includes(key) ? "<span id='" + key + "_season' class='season-adj'></span>" : '';
+        rows += '<tr><td>' + label + "</td><td><span id='" + key + "_raw'></span>" + rawUnit +
+            "</td><td><span id='" + key + "'></span>" + unit + "</td><td><span id='" + key + "_rec'></span>" + unit +
+            season + '</td></tr>';
+    });
+
+    return '<h1>📊 Показания датчика</h1>' +
+        "<div id='statusInfo' style='margin:10px 0;font-size:16px;color:#333'></div>" +
+        section('📋 Как работают показания', "<div class='cols'><div><h4>🔧 Компенсация показаний</h4>" + list([
+            '<strong>RAW</strong> - сырые данные с датчика JXCT: 🟢 в рабочем диапазоне, 🟡 диапазон с малой точностью, ' +
+            '🔴 за пределами датчика; в скобках - точность измерения',
+            '<strong>Компенс.</strong> - после математической компенсации: EC - температурная (Rhoades et al., 1989), ' +
+            'pH - поправка по Нернсту, NPK - по температуре и влажности (Delgado et al., 2020)',
+            'Отклонение от RAW: 🟢 ≤ ±5%, 🟡 ≤ ±10%, 🟠 ≤ ±15%, 🔴 > ±15%',
+            '<strong>Валидность данных:</strong> влажность ≥25%, температура 5-40°C, нет полива и ошибок датчика'
+        ]) + '</div><div><h4>🎯 Рекомендации</h4>' + list([
+            '<strong>Базовые нормы</strong> для выбранной культуры с сезонными корректировками и учётом типа среды',
+            'Отклонение от рекомендации: 🟢 ≤ ±10%, 🟡 ≤ ±20%, 🟠 ≤ ±30%, 🔴 > ±30%',
+            'Валидность: 🟢 данные валидны, 🔵 полив активен, 🟠 неоптимальные условия, 🔴 ошибки датчика',
+            '<strong>Детекция полива:</strong> по скачку влажности и времени'
+        ]) + '</div></div>') +
+        "<div class='section'><table class='data'><thead><tr><th></th><th>RAW</th><th>Компенс.</th><th>" +
+        escapeHtml(recHeader) + '</th></tr></thead><tbody>' + rows + '</tbody></table></div>' +
+        "<div class='section'><h2>🔬 Рекомендации по взаимодействию питательных веществ</h2>" +
+        "<div class='panel'><h4>⚠️ Антагонизмы и синергизмы</h4>" +
+        "<div id='nutrient-interactions' style='font-size:14px;line-height:1.6;'></div></div>" +
+        "<div class='panel panel-green'><h4>🌱 Специфические рекомендации по культурам</h4>" +
+        "<div id='crop-specific-recommendations' style='font-size:14px;line-height:1.6;'></div></div></div>" +
+        section('💡 Полезная информация', list([
+            '<strong>Стрелки ↑↓</strong> показывают направление изменений после компенсации',
+            '<strong>VWC</strong> - объёмная влажность почвы (сырые данные датчика)',
+            '<strong>ASM</strong> - доступная растениям влага: ASM = (VWC - PWP) / (FC - PWP) × 100%, ' +
+            'где FC - полевая влагоёмкость, PWP - точка увядания',
+            '<strong>Обновление:</strong> по каждому новому показанию'
+        ]), 'panel-green') +
+        "<div class='api-links'><b>API:</b> <a href='/api/v1/sensor' target='_blank'>/api/v1/sensor</a> " +
+        "(JSON, +timestamp) | <a href='/api/v2/sensor?fields=values,status' target='_blank'>/api/v2/sensor</a> " +
+        '(выбор полей)</div>';
+}
+
+function renderSensor(d) {
+    if (!d || typeof d !== 'object') return;
+
+    SENSOR_ROWS.forEach(([key, , field]) => {
+        const raw = d['raw_' + field];
+        if (raw !== undefined) {
+            const range = SENSOR_RANGES[key];
+            const precision = key === 'hum' && raw > 53 ? range.lowPrecision : range.precision;
+            setText(key + '_raw', raw + ' (' + precision + ')');
+            setColor(key + '_raw', colorSensorRange(parseFloat(raw), key));
+        }
+
+        // Температура и влажность без стрелок и без подсветки
+        const value = d[field];
+        const plain = key === 'temp' || key === 'hum';
+        setText(key, (plain ? '' : arrowSign(raw, value, ARROW_TOLERANCE[key])) + value);
+        setColor(key, plain ? '' : colorCompensationDeviation(parseFloat(value || 0), parseFloat(raw || 0)));
+
+        const rec = d['rec_' + field];
+        setText(key + '_rec', arrowSign(value, rec, ARROW_TOLERANCE[key]) + rec);
+        setColor(key + '_rec', colorDelta(parseFloat(value || 0), parseFloat(rec || 0)));
+    });
+
+    const percentages = d.correction_percentages || {};
+    [['n', 'nitrogen'], ['p', 'phosphorus'], ['k', 'potassium']].forEach(([key, field]) => {
+        const span = byId(key + '_season');
+        if (span && percentages[field] !== undefined) {
+            const value = parseFloat(percentages[field]);
+            span.textContent = ' (' + (value >= 0 ? '+' : '') + value + '%)';
+            span.className = 'season-adj ' + (value >= 0 ? 'up' : 'down');
+        }
+    });
+
+    let status = "<span class='green'>Данные валидны</span>";
+    if (d.irrigation) {
+        status = "<span class='blue'>Полив активен - данные временно не валидны</span>";
+    } else if (Array.isArray(d.alerts) && d.alerts.length > 0) {
+        status = "<span class='red'>Данные не валидны - ошибки датчика</span>";
+    } else if (d.humidity < 25 || d.temperature < 5 || d.temperature > 40) {
+        status = "<span class='orange'>Данные не валидны - неоптимальные условия</span>";
+    }
+    const seasonColor = {'Лето': 'green', 'Весна': 'yellow', 'Осень': 'yellow', 'Зима': 'red'}[d.season];
+    const season = seasonColor ? "<span class='" + seasonColor + "'>" + escapeHtml(d.season) + '</span>' : escapeHtml(d.season || '');
+    byId('statusInfo').innerHTML = status + ' | Сезон: ' + season;
+
+    const interactions = byId('nutrient-interactions');
+    interactions.innerHTML = d.nutrient_interactions ? escapeHtml(d.nutrient_interactions).replace(/\n/g, '<br>') :
+        "<p style='color:#28a745;'>✅ Антагонизмов питательных веществ не обнаружено</p>";
+    const crop = byId('crop-specific-recommendations');
+    crop.innerHTML = d.crop_specific_recommendations ? escapeHtml(d.crop_specific_recommendations).replace(/\n/g, '<br>') :
+        "<p style='color:#6c757d;'>ℹ️ Выберите культуру для получения специфических рекомендаций</p>";
+}
+
+function showSensorError() {
+    const error = "<p style='color:#dc3545;'>❌ Ошибка загрузки данных</p>";
+    byId('nutrient-interactions').innerHTML = error;
+    byId('crop-specific-recommendations').innerHTML = error;
+}
+
+function startReadings() {
+    renderSensor(boot.sensor);
+
+    // Новые показания приходят через Server-Sent Events; без EventSource или при отказе
+    // сервера (лимит потоков) раздел возвращается к опросу с интервалом из настроек
+    let poll = null;
+    const startPolling = () => {
+        if (!poll) {
+            poll = setInterval(() => getJson('/sensor_json').then(renderSensor).catch(showSensorError), boot.update_interval_ms);
+        }
+    };
+    cleanups.push(() => clearInterval(poll));
+
+    if (!window.EventSource) {
+        startPolling();
+        return;
+    }
+    const events = new EventSource(API_EVENTS);
+    events.addEventListener('reading', e => {
+        try {
+            renderSensor(JSON.parse(e.data));
+        } catch (x) {
+            showSensorError();
+        }
+    });
+    events.onerror = () => {
+        if (events.readyState === EventSource.CLOSED) startPolling();
+    };
+    cleanups.push(() => events.close());
+}
+
+// ============================================================================
+// КАЛИБРОВКА
+// ============================================================================
+
+function numberField(id, label, step, value, placeholder) {
+    return "<div class='form-group'><label>" + label + "</label><input type='number' id='" + id + "' step='" + step +
+        "'" + (value ? " value='" + value + "'" : '') + " placeholder='" + (placeholder || 'Введите измеренное значение') +
+        "'></div>";
+}
+
+function calibrationBlock(key, title, fields, columns, buttonText, note) {
+    return section(title, (note ? "<p style='font-size:14px;color:#666;'>" + note + '</p>' : '') +
+        "<div class='" + (columns === 3 ? 'cols-3' : 'cols') + "'>" + fields.join('') + '</div>' +
+        "<button class='btn btn-primary' style='width:100%' data-calibrate='" + key + "'>" + buttonText + '</button>' +
+        "<div id='" + key + "Result' class='result'></div>");
+}
+
+function calibrationView() {
+    const phPoints = [['4.01', 1], ['6.86', 2], ['9.18', 3]].map(([value, i]) =>
+        '<div>' + numberField('phExpected' + i, 'Ожидаемое значение pH:', '0.01', value) +
+        numberField('phMeasured' + i, 'Измеренное значение pH:', '0.01') + '</div>');
+    const ecPoints = [['1.41', 1], ['12.88', 2]].map(([value, i]) =>
+        '<div>' + numberField('ecExpected' + i, 'Ожидаемое значение EC (mS/cm):', '0.01', value) +
+        numberField('ecMeasured' + i, 'Измеренное значение EC (mS/cm):', '0.01') + '</div>');
+
+    return '<h1>🧪 Калибровка датчика JXCT 7-in-1</h1>' +
+        section('📋 Инструкции по калибровке', "<div class='cols'><div>" +
+            '<h4>🧪 pH (3-точечная)</h4>' + list(['Стандартные буферные растворы pH 4.01, 6.86, 9.18', 'Качество: R² > 0.95']) +
+            '<h4>⚡ EC (2-точечная)</h4>' + list(['Растворы KCl 1.41 и 12.88 mS/cm', 'Линейная коррекция по прямой']) +
+            '</div><div>' +
+            '<h4>🌡️ Температура и 💧 влажность</h4>' + list(['Сравните с эталонным прибором в стабильных условиях',
+                'Точность ±0.5°C и ±2%']) +
+            '<h4>🌿 NPK</h4>' + list(['Нулевая точка по дистиллированной воде для каждого элемента']) +
+            '</div></div>') +
+        section('📊 Статус калибровок', "<div id='calibrationStatus' style='font-size:14px;'></div>") +
+        calibrationBlock('ph', '🧪 pH Калибровка (3-точечная)', phPoints, 3, 'Калибровать pH') +
+        calibrationBlock('ec', '⚡ EC Калибровка (2-точечная)', ecPoints, 2, 'Калибровать EC') +
+        calibrationBlock('temp', '🌡️ Температурная калибровка', [
+            numberField('tempReference', 'Эталонная температура (°C):', '0.1', '', '25.0'),
+            numberField('tempMeasured', 'Измеренная температура (°C):', '0.1')], 2, 'Калибровать температуру') +
+        calibrationBlock('humidity', '💧 Влажностная калибровка', [
+            numberField('humidityReference', 'Эталонная влажность (%):', '0.1', '', '50.0'),
+            numberField('humidityMeasured', 'Измеренная влажность (%):', '0.1')], 2, 'Калибровать влажность') +
+        calibrationBlock('npk', '🌿 NPK Калибровка (нулевая точка)', [
+            numberField('npkNitrogen', 'Азот (N) - нулевая точка:', '0.1', '', '0.0'),
+            numberField('npkPhosphorus', 'Фосфор (P) - нулевая точка:', '0.1', '', '0.0'),
+            numberField('npkPotassium', 'Калий (K) - нулевая точка:', '0.1', '', '0.0')], 3, 'Калибровать NPK',
+            'Выставьте ноль по дистиллированной воде для каждого элемента') +
+        section('⚙️ Управление калибровкой', "<div class='cols-3'>" +
+            "<button class='btn btn-primary' data-calibrate='enable'>Включить калибровку</button>" +
+            "<button class='btn btn-secondary' data-calibrate='disable'>Отключить калибровку</button>" +
+            "<button class='btn btn-danger' data-calibrate='reset'>Сбросить к заводским</button></div>");
+}
+
+function renderCalibrationStatus(data) {
+    const sensors = [['ph_calibrated', 'pH'], ['ec_calibrated', 'EC'], ['temperature_calibrated', 'Температура'],
+        ['humidity_calibrated', 'Влажность'], ['npk_calibrated', 'NPK']];
+    byId('calibrationStatus').innerHTML = data && data.success ?
+        "<div class='cols'><div><h4>Статус калибровки:</h4><p>" + (data.calibration_enabled ? '✅ Включена' : '❌ Отключена') +
+        '</p></div><div><h4>Откалиброванные датчики:</h4>' +
+        list(sensors.filter(([field]) => data[field] === true).map(([, name]) => '✅ ' + name)) + '</div></div>' :
+        "<p style='color:#dc3545;'>❌ Ошибка загрузки статуса</p>";
+}
+
+function loadCalibrationStatus() {
+    getJson('/api/calibration/status').then(renderCalibrationStatus).catch(() => renderCalibrationStatus(null));
+}
+
+function showResult(key, message, ok) {
+    byId(key + 'Result').innerHTML = "<p style='margin:0;color:" + (ok ? '#28a745' : '#dc3545') + ";'>" + escapeHtml(message) + '</p>';
+}
+
+function readNumbers(ids) {
+    return ids.map(id => parseFloat(byId(id).value));
+}
+
+// Тело запроса для каждой калибровки; null - не все поля заполнены
+const CALIBRATIONS = {
+    ph: () => {
+        const v = readNumbers(['phExpected1', 'phMeasured1', 'phExpected2', 'phMeasured2', 'phExpected3', 'phMeasured3']);
+        return v.some(isNaN) ? null : {expected_1: v[0], measured_1: v[1], expected_2: v[2], measured_2: v[3], expected_3: v[4], measured_3: v[5]};
+    },
+    ec: () => {
+        const v = readNumbers(['ecExpected1', 'ecMeasured1', 'ecExpected2', 'ecMeasured2']);
+        return v.some(isNaN) ? null : {expected_1: v[0], measured_1: v[1], expected_2: v[2], measured_2: v[3]};
+    },
+    temp: () => {
+        const v = readNumbers(['tempReference', 'tempMeasured']);
+        return v.some(isNaN) ? null : {reference: v[0], measured: v[1]};
+    },
+    humidity: () => {
+        const v = readNumbers(['humidityReference', 'humidityMeasured']);
+        return v.some(isNaN) ? null : {reference: v[0], measured: v[1]};
+    },
+    npk: () => {
+        const v = readNumbers(['npkNitrogen', 'npkPhosphorus', 'npkPotassium']).map(x => x || 0);
+        return {nitrogen: v[0], phosphorus: v[1], potassium: v[2]};
+    }
+};
+
+const CALIBRATION_URLS = {ph: 'ph', ec: 'ec', temp: 'temperature', humidity: 'humidity', npk: 'npk'};
+
+function calibrate(key) {
+    const body = CALIBRATIONS[key]();
+    if (!body) {
+        showResult(key, 'Пожалуйста, заполните все поля', false);
+        return;
+    }
+    postJson('/api/calibration/' + CALIBRATION_URLS[key], body).then(data => {
+        if (data.success) {
+            const quality = data.r_squared !== undefined ? 'R² = ' + data.r_squared + ' (' + data.quality + ')' : data.quality;
+            showResult(key, '✅ Калибровка успешна' + (quality ? ': ' + quality : ''), true);
+            loadCalibrationStatus();
+        } else {
+            showResult(key, '❌ Ошибка: ' + (data.error || 'Неизвестная ошибка'), false);
+        }
+    }).catch(() => showResult(key, '❌ Ошибка соединения', false));
+}
+
+function manageCalibration(action) {
+    if (action === 'reset' && !confirm('⚠️ Вы уверены? Это сбросит все калибровки к заводским настройкам.')) return;
+    const body = action === 'reset' ? undefined : {enabled: action === 'enable'};
+    postJson('/api/calibration/' + action, body).then(data => {
+        showToast(data.success ? '✅ Готово' : '❌ Ошибка: ' + (data.error || 'Неизвестная ошибка'), data.success ? 'success' : 'error');
+        loadCalibrationStatus();
+    }).catch(() => showToast('❌ Ошибка соединения', 'error'));
+}
+
+function startCalibration() {
+    renderCalibrationStatus(boot.calibration);
+    byId('app').addEventListener('click', onCalibrationClick);
+    cleanups.push(() => byId('app').removeEventListener('click', onCalibrationClick));
+}
+
+function onCalibrationClick(e) {
+    const key = e.target.dataset.calibrate;
+    if (!key) return;
+    if (CALIBRATIONS[key]) {
+        calibrate(key);
+    } else {
+        manageCalibration(key);
+    }
+}
+
+// ============================================================================
+// СЕРВИС
+// ============================================================================
+
+function serviceView() {
+    const device = boot.device;
+    let thingspeak = '';
+    if (boot.thingspeak_enabled) {
+        thingspeak = "<div class='panel'><h3>🔗 ThingSpeak Управление</h3>" +
+            "<button type='button' class='btn btn-secondary' id='tsReset'>🔓 Сбросить блокировку</button> " +
+            "<button type='button' class='btn btn-primary' id='tsDiagnostics'>📊 Подробная диагностика</button></div>";
+    }
+    return '<h1>🔧 Сервис</h1>' +
+        "<div class='info-block' id='status-block'></div>" +
+        "<div class='info-block'><b>Производитель:</b> " + escapeHtml(device.manufacturer) + '<br><b>Модель:</b> ' +
+        escapeHtml(device.model) + '<br><b>Версия:</b> ' + escapeHtml(device.version) + '</div>' +
+        "<div class='section' style='margin-top:20px;'>" +
+        "<form method='post' action='/reset' style='margin-bottom:10px'>" + csrfField() +
+        "<button type='submit' class='btn btn-danger'>🔄 Сбросить настройки</button></form>" +
+        "<form method='post' action='/reboot' style='margin-bottom:10px'>" + csrfField() +
+        "<button type='submit' class='btn btn-secondary'>🔄 Перезагрузить</button></form>" + thingspeak + '</div>' +
+        "<div class='api-links'><b>API:</b> <a href='/service_status' target='_blank'>/service_status</a> " +
+        "(JSON, статусы сервисов) | <a href='/health' target='_blank'>/health</a> (JSON, подробная диагностика)</div>";
+}
+
+function dot(status) {
+    const cls = status === true ? 'dot-ok' : status === false ? 'dot-err' : status === 'warn' ? 'dot-warn' : 'dot-off';
+    return "<span class='status-dot " + cls + "'></span>";
+}
+
+function renderServiceStatus(d) {
+    const e = escapeHtml;
+    let html = dot(d.wifi_connected) + '<b>WiFi:</b> ' +
+        (d.wifi_connected ? 'Подключено (' + e(d.wifi_ip) + ', ' + e(d.wifi_ssid) + ', RSSI ' + d.wifi_rssi + ' dBm)' : 'Не подключено') + '<br>';
+    html += dot(d.mqtt_enabled ? d.mqtt_connected : false) + '<b>MQTT:</b> ' + (d.mqtt_enabled ?
+        (d.mqtt_connected ? 'Подключено' : 'Ошибка' + (d.mqtt_last_error ? ' (' + e(d.mqtt_last_error) + ')' : '')) : 'Отключено') + '<br>';
+    html += dot(d.thingspeak_enabled ? !d.thingspeak_last_error : false) + '<b>ThingSpeak:</b> ' + (d.thingspeak_enabled ?
+        (d.thingspeak_last_error ? 'Ошибка: ' + e(d.thingspeak_last_error) :
+            (d.thingspeak_last_pub && d.thingspeak_last_pub !== '0' ? 'Последняя публикация: ' + e(d.thingspeak_last_pub) : 'Нет публикаций')) :
+        'Отключено') + '<br>';
+    html += dot(d.hass_enabled) + '<b>Home Assistant:</b> ' + (d.hass_enabled ? 'Включено' : 'Отключено') + '<br>';
+    html += dot(d.sensor_ok) + '<b>Датчик:</b> ' + (d.sensor_ok ? 'Ок' : 'Ошибка' + (d.sensor_last_error ? ' (' + e(d.sensor_last_error) + ')' : ''));
+    byId('status-block').innerHTML = html;
+}
+
+function showThingSpeakDiagnostics() {
+    getJson('/api/thingspeak_diagnostics').then(data => {
+        let message = '=== ДИАГНОСТИКА THINGSPEAK ===\n';
+        message += 'Статус: ' + (data.blocked ? '🔴 ЗАБЛОКИРОВАН' : data.enabled ? '🟢 АКТИВЕН' : '⚪ ОТКЛЮЧЕН') + '\n';
+        message += 'WiFi: ' + (data.wifi_connected ? 'ПОДКЛЮЧЕН' : 'ОТКЛЮЧЕН') + '\n';
+        message += 'Данные: ' + (data.data_valid ? 'ВАЛИДНЫ' : 'НЕВАЛИДНЫ') + '\n';
+        message += 'Ошибок подряд: ' + data.consecutive_fail_count + '\n';
+        message += 'Интервал: ' + data.interval_ms / 1000 + ' сек\n';
+        message += 'Последняя публикация: ' + data.time_since_last_publish_ms / 1000 + ' сек назад\n';
+        if (data.blocked) message += '🔴 Блокировка: осталось ' + data.remaining_block_time_min + ' мин\n';
+        if (data.last_error) message += 'Последняя ошибка: ' + data.last_error + '\n';
+        alert(message);
+    }).catch(error => alert('Ошибка получения диагностики: ' + error));
+}
+
+function resetThingSpeak() {
+    fetch('/reset_thingspeak', {method: 'POST', headers: {'X-CSRF-Token': boot.csrf_token}})
+        .then(r => r.text().then(text => showToast(text, r.ok ? 'success' : 'error')))
+        .catch(() => showToast('❌ Ошибка соединения', 'error'));
+}
+
+function startService() {
+    renderServiceStatus(boot.status);
+    const timer = setInterval(() => getJson('/service_status').then(renderServiceStatus).catch(() => {}), boot.update_interval_ms);
+    cleanups.push(() => clearInterval(timer));
+    if (boot.thingspeak_enabled) {
+        byId('tsReset').onclick = resetThingSpeak;
+        byId('tsDiagnostics').onclick = showThingSpeakDiagnostics;
+    }
+    if (boot.status.thingspeak_enabled && boot.status.thingspeak_last_error) {
+        showToast('Ошибка ThingSpeak: ' + boot.status.thingspeak_last_error, 'error');
+    }
+}
+
+// ============================================================================
+// МАРШРУТИЗАЦИЯ
+// ============================================================================
+
+const VIEWS = {
+    '/readings': {title: '📊 Показания датчика', render: readingsView, start: startReadings},
+    '/calibration': {title: '🧪 Калибровка датчика', render: calibrationView, start: startCalibration},
+    '/service': {title: '🔧 Сервис', render: serviceView, start: startService}
+};
+
+function renderNav() {
+    byId('nav').innerHTML = NAV_LINKS.filter(([path]) => !boot.ap_mode || path === '/')
+        .map(([path, text]) => "<a href='" + path + "'>" + text + '</a>').join('');
+}
+
+function showView(path) {
+    cleanups.forEach(cleanup => cleanup());
+    cleanups = [];
+    const view = VIEWS[path] || VIEWS['/readings'];
+    document.title = view.title;
+    if (boot.ap_mode) {
+        byId('app').innerHTML = '<h1>' + view.title + "</h1><div class='msg msg-warning'>⚠️ Эта страница недоступна " +
+            "в режиме точки доступа</div><p><a href='/' style='color:#4CAF50;text-decoration:none;'>← Вернуться на главную</a></p>";
+        return;
+    }
+    byId('app').innerHTML = view.render();
+    view.start();
+}
+
+// Переходы между разделами панели - без перезагрузки и без повторного bootstrap
+document.addEventListener('click', e => {
+    const link = e.target.closest('a');
+    if (!link || !boot || !VIEWS[link.getAttribute('href')] || e.ctrlKey || e.metaKey || link.target) return;
+    e.preventDefault();
+    history.pushState(null, '', link.getAttribute('href'));
+    showView(location.pathname);
+});
+
+window.addEventListener('popstate', () => showView(location.pathname));
+
+getJson(API_BOOTSTRAP).then(data => {
+    boot = data;
+    renderNav();
+    showView(location.pathname);
+}).catch(() => {
+    byId('app').innerHTML = "<div class='msg msg-error'>❌ Не удалось загрузить данные устройства</div>";
+});
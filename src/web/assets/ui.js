@@ -0,0 +1,31 @@
+function showToast(message, type) {
+    const toast = document.createElement('div');
+    toast.className = 'toast';
+    toast.textContent = message;
+
+    const colors = {
+        'success': '#4CAF50',
+        'error': '#F44336',
+        'warning': '#FFC107',
+        'info': '#2196F3'
+    };
+
+    toast.style.background = colors[type] || colors['info'];
+    document.body.appendChild(toast);
+
+    setTimeout(() => toast.classList.add('show'), 100);
+    setTimeout(() => {
+        toast.classList.remove('show');
+        setTimeout(() => document.body.removeChild(toast), 300);
+    }, 3000);
+}
+
+// Показать toast при загрузке если есть сообщение
+window.addEventListener('load', function() {
+    const urlParams = new URLSearchParams(window.location.search);
+    const msg = urlParams.get('msg');
+    const type = urlParams.get('type') || 'info';
+    if (msg) {
+        showToast(decodeURIComponent(msg), type);
+    }
+});
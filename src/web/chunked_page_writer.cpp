@@ -0,0 +1,64 @@
+/**
+ * @file chunked_page_writer.cpp
+ * @brief Реализация потоковой отдачи крупных ответов
+ */
+
+#include "../../include/web/chunked_page_writer.h"
+#include <cstring>
+
+ChunkedPageWriter::~ChunkedPageWriter()
+{
+    // Обработчик мог выйти раньше - клиент всё равно должен получить завершающий чанк
+    if (started && !finished)
+    {
+        end();
+    }
+}
+
+void ChunkedPageWriter::begin(int code, const char* contentType)
+{
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(code, contentType, "");
+    started = true;
+}
+
+ChunkedPageWriter& ChunkedPageWriter::write(const char* data, size_t length)
+{
+    if (length >= buffer.size())
+    {
+        // Крупный фрагмент отправляется напрямую, без копирования
+        flush();
+        server.sendContent(data, length);
+        return *this;
+    }
+
+    if (used + length > buffer.size())
+    {
+        flush();
+    }
+    memcpy(buffer.data() + used, data, length);
+    used += length;
+    return *this;
+}
+
+ChunkedPageWriter& ChunkedPageWriter::operator<<(const char* text)
+{
+    return write(text, strlen(text));
+}
+
+void ChunkedPageWriter::flush()
+{
+    if (used == 0)
+    {
+        return;
+    }
+    server.sendContent(buffer.data(), used);
+    used = 0;
+}
+
+void ChunkedPageWriter::end()
+{
+    flush();
+    server.sendContent("");  // Нулевой чанк - конец ответа
+    finished = true;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file conditional_get.cpp
+ * @brief Реализация условных GET-запросов для JSON API
+ */
+
+#include "../../include/web/conditional_get.h"
+#include <cstdio>
+#include "../../include/web_routes.h"
+
+namespace
+{
+uint32_t getEtagBootSalt()
+{
+    // random() на ESP32 берёт значения из аппаратного ГСЧ
+    static const uint32_t salt = static_cast<uint32_t>(random(1, 0x7FFFFFFF));
+    return salt;
+}
+}  // namespace
+
+uint32_t hashEtagBytes(uint32_t hash, const void* data, size_t length)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+bool etagMatches(const String& ifNoneMatch, const char* etag)
+{
+    return ifNoneMatch == "*" || ifNoneMatch.indexOf(etag) >= 0;
+}
+
+void makeGenerationEtag(uint32_t generation, uint32_t configHash, EtagBuffer& etag)
+{
+    snprintf(etag.data(), etag.size(), "\"%08lx-%08lx-%08lx\"", static_cast<unsigned long>(getEtagBootSalt()),
+             static_cast<unsigned long>(generation), static_cast<unsigned long>(configHash));
+}
+
+bool sendNotModifiedIfMatch(const char* etag)
+{
+    webServer.sendHeader("ETag", etag);
+    webServer.sendHeader("Cache-Control", HTTP_CACHE_REVALIDATE);
+
+    if (webServer.hasHeader("If-None-Match") && etagMatches(webServer.header("If-None-Match"), etag))
+    {
+        webServer.send(HTTP_NOT_MODIFIED);
+        return true;
+    }
+    return false;
+}
+
+void sendJsonWithEtag(const String& json)
+{
+    // Длина в теге снижает шанс коллизии 32-битного хэша между телами разного размера
+    EtagBuffer etag;
+    snprintf(etag.data(), etag.size(), "\"c%lx-%08lx\"", static_cast<unsigned long>(json.length()),
+             static_cast<unsigned long>(hashEtagBytes(ETAG_HASH_SEED, json.c_str(), json.length())));
+
+    if (sendNotModifiedIfMatch(etag.data()))
+    {
+        return;
+    }
+    webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, json);
+}
@@ -88,7 +88,7 @@ bool validateCSRFToken(const String& token)  // NOLINT(misc-use-internal-linkage
     return isValid;
 }
 
-String getCSRFHiddenField()  // NOLINT(misc-use-internal-linkage)
+String getCSRFToken()  // NOLINT(misc-use-internal-linkage)
 {
     // Генерируем новый токен если текущий пустой или истек
     if (currentCSRFToken.isEmpty() || (millis() - tokenGeneratedTime) > CSRF_TOKEN_LIFETIME)
@@ -96,7 +96,12 @@ String getCSRFHiddenField()  // NOLINT(misc-use-internal-linkage)
         generateCSRFToken();
     }
 
-    return R"(<input type="hidden" name="csrf_token" value=")" + currentCSRFToken + R"(">)";
+    return currentCSRFToken;
+}
+
+String getCSRFHiddenField()  // NOLINT(misc-use-internal-linkage)
+{
+    return R"(<input type="hidden" name="csrf_token" value=")" + getCSRFToken() + R"(">)";
 }
 
 bool checkCSRFSafety()
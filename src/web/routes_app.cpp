@@ -0,0 +1,84 @@
+/**
+ * @file routes_app.cpp
+ * @brief Панель устройства: оболочка страниц и начальные данные
+ * @details /readings, /calibration и /service отдают одну и ту же оболочку из flash
+ *          (app.html, gzip, ETag по содержимому); разделы рисует app.js в браузере.
+ *          Всё, что раньше подставлялось в страницу на устройстве, приходит одним
+ *          JSON API_BOOTSTRAP: сведения об устройстве, токен CSRF, настройки панели,
+ *          последнее показание и статусы сервисов и калибровки. Дальше панель
+ *          обновляется через поток показаний и обычные JSON API.
+ */
+
+#include <ArduinoJson.h>
+#include "../../include/jxct_config_vars.h"
+#include "../../include/jxct_constants.h"
+#include "../../include/jxct_device_info.h"
+#include "../../include/jxct_strings.h"
+#include "../../include/logger.h"
+#include "../../include/web/conditional_get.h"
+#include "../../include/web_assets_generated.h"
+#include "../../include/web_routes.h"
+#include "../wifi_manager.h"
+#include "routes_calibration.h"
+
+namespace
+{
+// Разделы панели; остальные страницы пока собираются на устройстве
+const char* const APP_PAGES[] = {"/readings", "/calibration", "/service"};
+
+void sendAppShell()
+{
+    // URL оболочки не версионирован: браузер хранит её, но перепроверяет (304 без тела)
+    if (sendNotModifiedIfMatch(WEB_ASSET_APP_HTML_ETAG))
+    {
+        return;
+    }
+
+    webServer.sendHeader("Content-Encoding", "gzip");
+    webServer.send_P(HTTP_OK, WEB_ASSET_APP_HTML_MIME, reinterpret_cast<const char*>(WEB_ASSET_APP_HTML_GZ),
+                     WEB_ASSET_APP_HTML_GZ_LEN);
+}
+
+void sendBootstrapJson()
+{
+    logWebRequest("GET", API_BOOTSTRAP, webServer.client().remoteIP().toString());
+
+    DynamicJsonDocument doc(JSON_DOC_MEDIUM);
+    doc["device"]["manufacturer"] = DEVICE_MANUFACTURER;
+    doc["device"]["model"] = DEVICE_MODEL;
+    doc["device"]["version"] = FIRMWARE_VERSION;
+    doc["ap_mode"] = currentWiFiMode == WiFiMode::AP;
+
+    // В режиме точки доступа разделы недоступны - панель показывает только сообщение
+    if (currentWiFiMode != WiFiMode::AP)
+    {
+        doc["csrf_token"] = getCSRFToken();
+        doc["update_interval_ms"] = config.webUpdateInterval;
+        doc["crop_id"] = config.cropId;
+        doc["thingspeak_enabled"] = static_cast<bool>(config.flags.thingSpeakEnabled);
+        fillServiceStatusJson(doc.createNestedObject("status"));
+        fillCalibrationStatusJson(doc.createNestedObject("calibration"));
+
+        // Показание - готовый ответ /sensor_json из кэша, вставляется без разбора и копии
+        const String& sensorJson = getCachedSensorJson();
+        doc["sensor"] = serialized(sensorJson.c_str(), sensorJson.length());
+    }
+
+    String json;
+    serializeJson(doc, json);
+    sendJsonWithEtag(json);
+}
+}  // namespace
+
+void setupAppRoutes()
+{
+    logDebug("Настройка маршрутов панели");
+
+    for (const char* page : APP_PAGES)
+    {
+        webServer.on(page, HTTP_GET, sendAppShell);
+    }
+    webServer.on(API_BOOTSTRAP, HTTP_GET, sendBootstrapJson);
+
+    logDebug("Панель: /readings, /calibration, /service (оболочка из flash), " API_BOOTSTRAP);
+}
@@ -6,8 +6,10 @@
 #ifndef ROUTES_CALIBRATION_H
 #define ROUTES_CALIBRATION_H
 
-// Основная страница калибровки
-void handleCalibrationPage();
+#include <ArduinoJson.h>
+
+// Статус калибровок (success, *_calibrated, calibration_enabled) - для API и начальных данных панели
+void fillCalibrationStatusJson(JsonObject root);
 
 // API маршруты для калибровки
 void handleCalibrationStatus();      // GET /api/calibration/status
@@ -378,7 +378,7 @@ void setupConfigRoutes()
                          "<!DOCTYPE html><html><head><meta charset='UTF-8'><meta http-equiv='refresh' "
                          "content='3;url=/intervals'>";
                      html += "<title>" UI_ICON_SUCCESS " Настройки сохранены</title>";
-                     html += "<style>" + String(getUnifiedCSS()) + "</style></head><body><div class='container'>";
+                     html += String(getStylesheetHTML()) + "</head><body><div class='container'>";
                      html += "<h1>" UI_ICON_SUCCESS " Настройки интервалов сохранены!</h1>";
                      html += "<div class='msg msg-success'>" UI_ICON_SUCCESS " Новые настройки вступили в силу</div>";
                      html += "<p><strong>Текущие интервалы:</strong><br>";
@@ -430,7 +430,7 @@ void setupConfigRoutes()
                          "<!DOCTYPE html><html><head><meta charset='UTF-8'><meta http-equiv='refresh' "
                          "content='2;url=/intervals'>";
                      html += "<title>" UI_ICON_RESET " Сброс настроек</title>";
-                     html += "<style>" + String(getUnifiedCSS()) + "</style></head><body><div class='container'>";
+                     html += String(getStylesheetHTML()) + "</head><body><div class='container'>";
                      html += "<h1>" UI_ICON_RESET " Настройки сброшены</h1>";
                      html += "<div class='msg msg-success'>" UI_ICON_SUCCESS
                              " Настройки интервалов возвращены к значениям по умолчанию</div>";
@@ -449,7 +449,7 @@ void setupConfigRoutes()
                      {
                          String html = "<!DOCTYPE html><html><head><meta charset='UTF-8'><title>" UI_ICON_FOLDER
                                        " Конфигурация</title>";
-                         html += "<style>" + String(getUnifiedCSS()) + "</style></head><body><div class='container'>";
+                         html += String(getStylesheetHTML()) + "</head><body><div class='container'>";
                          html += "<h1>" UI_ICON_FOLDER " Конфигурация</h1>";
                          html += "<div class='msg msg-error'>" UI_ICON_ERROR
                                  " Недоступно в режиме точки доступа</div></div></body></html>";
@@ -461,7 +461,7 @@ void setupConfigRoutes()
                          "<!DOCTYPE html><html><head><meta charset='UTF-8'><meta name='viewport' "
                          "content='width=device-width, initial-scale=1.0'>";
                      html += "<title>" UI_ICON_FOLDER " Управление конфигурацией JXCT</title>";
-                     html += "<style>" + String(getUnifiedCSS()) + "</style></head><body><div class='container'>";
+                     html += String(getStylesheetHTML()) + "</head><body><div class='container'>";
                      html += navHtml();
                      html += "<h1>" UI_ICON_FOLDER " Управление конфигурацией</h1>";
 
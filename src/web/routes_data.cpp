@@ -12,8 +12,9 @@
 #include "../../include/jxct_constants.h"
 #include "../../include/jxct_format_utils.h"
 #include "../../include/jxct_strings.h"
-#include "../../include/jxct_ui_system.h"
 #include "../../include/logger.h"
+#include "../../include/web/chunked_page_writer.h"
+#include "../../include/web/conditional_get.h"
 #include "../../include/web/csrf_protection.h"  // 🔒 CSRF защита
 #include "../../include/web_routes.h"
 #include "../modbus_sensor.h"
@@ -21,10 +22,14 @@
 #include "business_services.h"
 #include "calibration_manager.h"
 #include "../../include/advanced_filters.h"
+#include "../../include/business/crop_rules.h"
+#include "../business/calibration_csv_parser.h"
 #include "../business/sensor_calibration_service.h"
 #include "../../include/sensor_types.h"
 #include "../sensor_correction.h"
+#include "../business/crop_ranking.h"
 #include "../business/crop_recommendation_engine.h"
+#include "../business/crop_target_cache.h"
 #include "../business/sensor_compensation_service.h"
 #include "routes_calibration.h"
 
@@ -38,64 +43,98 @@ extern NTPClient* timeClient;
 // extern String formatValue(float value, const char* unit, int precision);  // объявлено в jxct_format_utils.h
 // extern String getApSsid();  // объявлено в wifi_manager.h
 
-// Общая функция для определения текущего сезона
-const char* getCurrentSeasonName()
+namespace
 {
-    if (timeClient == nullptr)
+constexpr const char* SEASON_DISPLAY_NAMES[] = {"Весна", "Лето", "Осень", "Зима"};  // по Season
+
+// Текущий сезон по уже синхронизированному времени NTP; false, пока синхронизации не было.
+// Синхронизирует время loop() (handleWiFi() и периодическое обновление) - путь запроса не ходит
+// в сеть: вызывается на каждый опрос /sensor_json, в том числе для ответа 304
+bool getCurrentSeason(Season& season)
+{
+    if (timeClient == nullptr || !timeClient->isTimeSet())
     {
-        extern WiFiUDP ntpUDP;
-        timeClient = new NTPClient(ntpUDP, "pool.ntp.org", 0, 3600000);
-        timeClient->begin();
+        return false;
     }
-
-    time_t now = timeClient ? (time_t)timeClient->getEpochTime() : time(nullptr);
+    time_t now = static_cast<time_t>(timeClient->getEpochTime());
     if (now < NTP_TIMESTAMP_2000)
     {
-        if (timeClient)
-        {
-            timeClient->forceUpdate();
-            now = (time_t)timeClient->getEpochTime();
-            if (now < NTP_TIMESTAMP_2000)
-            {
-                return "Н/Д";
-            }
-        }
-        else
-        {
-            return "Н/Д";
-        }
+        return false;
     }
     struct tm* timeInfo = localtime(&now);
     if (!timeInfo)
     {
-        return "Н/Д";
+        return false;
     }
     uint8_t month = timeInfo->tm_mon + 1;
     if (month == 12 || month == 1 || month == 2)
     {
-        return "Зима";
+        season = Season::WINTER;
+    }
+    else if (month >= 3 && month <= 5)
+    {
+        season = Season::SPRING;
     }
-    if (month >= 3 && month <= 5)
+    else if (month >= 6 && month <= 8)
     {
-        return "Весна";
+        season = Season::SUMMER;
     }
-    if (month >= 6 && month <= 8)
+    else
     {
-        return "Лето";
+        season = Season::AUTUMN;
     }
-    return "Осень";
+    return true;
+}
+}  // namespace
+
+// Общая функция для определения текущего сезона
+const char* getCurrentSeasonName()
+{
+    Season season = Season::SPRING;
+    return getCurrentSeason(season) ? SEASON_DISPLAY_NAMES[static_cast<size_t>(season)] : "Н/Д";
 }
 
 // Буфер для загрузки файлов (калибровка через /readings)
 namespace
 {
 File uploadFile;
+// CSV пишется во временный файл и заменяет custom.csv только после успешного разбора
+String uploadTempPath;
 SoilProfile uploadProfile = SoilProfile::SAND;
+// Таблица собирается по мере прихода кусков upload.buf, без чтения файла целиком
+CalibrationTable uploadTable;
+CalibrationCsvParser uploadParser;
 
 // Используем RecValues из бизнес-сервиса
 
 // Функции сезонной коррекции NPK перенесены в бизнес-сервис CropRecommendationEngine
 
+void discardUploadTemp()
+{
+    if (uploadFile)
+    {
+        uploadFile.close();
+    }
+    if (uploadTempPath.length() > 0 && LittleFS.exists(uploadTempPath))
+    {
+        LittleFS.remove(uploadTempPath);
+    }
+}
+
+void commitUploadTemp(const char* path)
+{
+    // LittleFS заменяет существующий файл при rename; запасной путь - удалить и повторить
+    if (!LittleFS.rename(uploadTempPath.c_str(), path))
+    {
+        LittleFS.remove(path);
+        if (!LittleFS.rename(uploadTempPath.c_str(), path))
+        {
+            logErrorSafe("Не удалось заменить %s загруженным CSV", path);
+            LittleFS.remove(uploadTempPath);
+        }
+    }
+}
+
 }  // namespace
 
 void handleReadingsUpload()  // ✅ Убираем static - функция extern в header
@@ -105,11 +144,13 @@ void handleReadingsUpload()  // ✅ Убираем static - функция exter
     {
         CalibrationManager::init();
         const char* path = CalibrationManager::profileToFilename(SoilProfile::SAND);  // custom.csv
-        uploadFile = LittleFS.open(path, "w");
+        uploadTempPath = String(path) + ".tmp";
+        uploadFile = LittleFS.open(uploadTempPath, "w");
         if (!uploadFile)
         {
-            logErrorSafe("\1", path);
+            logErrorSafe("\1", uploadTempPath.c_str());
         }
+        uploadParser.begin(uploadTable);
     }
     else if (upload.status == UPLOAD_FILE_WRITE)
     {
@@ -117,17 +158,46 @@ void handleReadingsUpload()  // ✅ Убираем static - функция exter
         {
             uploadFile.write(upload.buf, upload.currentSize);
         }
+        uploadParser.feed(upload.buf, upload.currentSize);
     }
     else if (upload.status == UPLOAD_FILE_END)
     {
+        const bool stored = static_cast<bool>(uploadFile);
         if (uploadFile)
         {
             uploadFile.close();
             logSuccessSafe("\1", upload.totalSize);
         }
+
+        if (!uploadParser.finish())
+        {
+            discardUploadTemp();  // прежний custom.csv остаётся нетронутым
+            logWarnSafe("Калибровочный CSV отклонён: строка %u, %s", static_cast<unsigned>(uploadParser.errorLine()),
+                        CalibrationCsvParser::errorText(uploadParser.error()));
+            uploadTable = CalibrationTable();
+            std::array<char, 96> location{};
+            snprintf(location.data(), location.size(), "/readings?toast=Ошибка+CSV,+строка+%u",
+                     static_cast<unsigned>(uploadParser.errorLine()));
+            webServer.sendHeader("Location", location.data(), true);
+            webServer.send(HTTP_REDIRECT, "text/plain", "Redirect");
+            return;
+        }
+
+        if (stored)
+        {
+            commitUploadTemp(CalibrationManager::profileToFilename(SoilProfile::SAND));
+        }
+        logSuccessSafe("Калибровочный CSV: %u точек", static_cast<unsigned>(uploadParser.pointCount()));
+        gCalibrationService.installCalibrationTable(uploadProfile, std::move(uploadTable));
+        uploadTable = CalibrationTable();
         webServer.sendHeader("Location", "/readings?toast=Калибровка+загружена", true);
         webServer.send(HTTP_REDIRECT, "text/plain", "Redirect");
     }
+    else if (upload.status == UPLOAD_FILE_ABORTED)
+    {
+        discardUploadTemp();
+        uploadTable = CalibrationTable();
+    }
 }
 
 namespace
@@ -176,820 +246,809 @@ String sanitizeForJson(const String& input) {
     return sanitized;
 }
 
-void sendSensorJson()  // ✅ Убираем static - функция extern в header
+namespace
 {
-    // unified JSON response for sensor data
-    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
-    if (currentWiFiMode != WiFiMode::STA)
+// Кэш сериализованного ответа /sensor_json: пересобирается только при новом поколении
+// показаний или изменении настроек, влияющих на рекомендации
+struct SensorJsonCache
+{
+    String json;
+    uint32_t generation = 0;
+    uint32_t configHash = 0;
+    bool filled = false;
+};
+
+SensorJsonCache sensorJsonCache;
+
+// FNV-1a по полям конфигурации, от которых зависит содержимое ответа, и по текущему сезону:
+// смена сезона или синхронизация времени меняют рекомендации и поле season без нового показания
+uint32_t getSensorJsonConfigHash()
+{
+    const uint8_t seasonalAdjust = config.flags.seasonalAdjustEnabled;
+    Season season = Season::SPRING;
+    const uint8_t timeValid = getCurrentSeason(season) ? 1 : 0;
+    const uint8_t seasonIndex = timeValid != 0 ? static_cast<uint8_t>(season) : 0;
+    uint32_t hash = ETAG_HASH_SEED;
+    hash = hashEtagBytes(hash, &timeValid, sizeof(timeValid));
+    hash = hashEtagBytes(hash, &seasonIndex, sizeof(seasonIndex));
+    hash = hashEtagBytes(hash, &config.soilProfile, sizeof(config.soilProfile));
+    hash = hashEtagBytes(hash, &config.environmentType, sizeof(config.environmentType));
+    hash = hashEtagBytes(hash, &seasonalAdjust, sizeof(seasonalAdjust));
+    hash = hashEtagBytes(hash, config.cropId, strnlen(config.cropId, sizeof(config.cropId)));
+    return hash;
+}
+
+// ✅ Дополнительная проверка: если cropId пустой, устанавливаем "none" (до расчёта хэша)
+void ensureCropIdSet()
+{
+    if (strlen(config.cropId) == 0)
     {
-        webServer.send(HTTP_FORBIDDEN, HTTP_CONTENT_TYPE_JSON, R"({"error":"AP mode"})");
-        return;
+        strlcpy(config.cropId, "none", sizeof(config.cropId));
+        logDebugSafe("JSON API: cropId was empty, set to 'none'");
     }
+}
 
+// Поля ответа датчика: бит на поле, порядок как в /sensor_json.
+// /api/v2/sensor?fields= собирает только выбранные поля и не считает остальные
+constexpr uint32_t FIELD_TEMPERATURE = 1U << 0;
+constexpr uint32_t FIELD_HUMIDITY = 1U << 1;
+constexpr uint32_t FIELD_EC = 1U << 2;
+constexpr uint32_t FIELD_PH = 1U << 3;
+constexpr uint32_t FIELD_NITROGEN = 1U << 4;
+constexpr uint32_t FIELD_PHOSPHORUS = 1U << 5;
+constexpr uint32_t FIELD_POTASSIUM = 1U << 6;
+constexpr uint32_t FIELD_RAW_TEMPERATURE = 1U << 7;
+constexpr uint32_t FIELD_RAW_HUMIDITY = 1U << 8;
+constexpr uint32_t FIELD_RAW_EC = 1U << 9;
+constexpr uint32_t FIELD_RAW_PH = 1U << 10;
+constexpr uint32_t FIELD_RAW_NITROGEN = 1U << 11;
+constexpr uint32_t FIELD_RAW_PHOSPHORUS = 1U << 12;
+constexpr uint32_t FIELD_RAW_POTASSIUM = 1U << 13;
+constexpr uint32_t FIELD_IRRIGATION = 1U << 14;
+constexpr uint32_t FIELD_VALID = 1U << 15;
+constexpr uint32_t FIELD_MEASUREMENT_STATUS = 1U << 16;
+constexpr uint32_t FIELD_NUTRIENT_INTERACTIONS = 1U << 17;
+constexpr uint32_t FIELD_CROP_ID = 1U << 18;
+constexpr uint32_t FIELD_CROP_RECOMMENDATIONS = 1U << 19;
+constexpr uint32_t FIELD_REC_TEMPERATURE = 1U << 20;
+constexpr uint32_t FIELD_REC_HUMIDITY = 1U << 21;
+constexpr uint32_t FIELD_REC_EC = 1U << 22;
+constexpr uint32_t FIELD_REC_PH = 1U << 23;
+constexpr uint32_t FIELD_REC_NITROGEN = 1U << 24;
+constexpr uint32_t FIELD_REC_PHOSPHORUS = 1U << 25;
+constexpr uint32_t FIELD_REC_POTASSIUM = 1U << 26;
+constexpr uint32_t FIELD_SEASON = 1U << 27;
+constexpr uint32_t FIELD_ALERTS = 1U << 28;
+constexpr uint32_t FIELD_TIMESTAMP = 1U << 29;
+// Коды рекомендаций вместо текста - только по ?fields=, в /sensor_json не входят
+constexpr uint32_t FIELD_INTERACTION_CODES = 1U << 30;
+constexpr uint32_t FIELD_CROP_CODES = 1U << 31;
+
+constexpr uint32_t FIELDS_VALUES =
+    FIELD_TEMPERATURE | FIELD_HUMIDITY | FIELD_EC | FIELD_PH | FIELD_NITROGEN | FIELD_PHOSPHORUS | FIELD_POTASSIUM;
+constexpr uint32_t FIELDS_RAW = FIELD_RAW_TEMPERATURE | FIELD_RAW_HUMIDITY | FIELD_RAW_EC | FIELD_RAW_PH |
+                                FIELD_RAW_NITROGEN | FIELD_RAW_PHOSPHORUS | FIELD_RAW_POTASSIUM;
+constexpr uint32_t FIELDS_REC = FIELD_REC_TEMPERATURE | FIELD_REC_HUMIDITY | FIELD_REC_EC | FIELD_REC_PH |
+                                FIELD_REC_NITROGEN | FIELD_REC_PHOSPHORUS | FIELD_REC_POTASSIUM;
+constexpr uint32_t FIELDS_STATUS = FIELD_IRRIGATION | FIELD_VALID | FIELD_MEASUREMENT_STATUS | FIELD_ALERTS;
+// Длинные тексты рекомендаций - основная часть ответа; ?text=0 их исключает
+constexpr uint32_t FIELDS_TEXT = FIELD_NUTRIENT_INTERACTIONS | FIELD_CROP_RECOMMENDATIONS;
+constexpr uint32_t FIELDS_ALL = (1U << 30) - 1U;
+constexpr uint32_t FIELDS_CODES = FIELD_INTERACTION_CODES | FIELD_CROP_CODES;
+
+struct SensorFieldName
+{
+    const char* name;
+    uint32_t mask;
+};
+
+// Имена полей и групп для ?fields=
+constexpr SensorFieldName SENSOR_FIELD_NAMES[] = {
+    {"temperature", FIELD_TEMPERATURE},
+    {"humidity", FIELD_HUMIDITY},
+    {"ec", FIELD_EC},
+    {"ph", FIELD_PH},
+    {"nitrogen", FIELD_NITROGEN},
+    {"phosphorus", FIELD_PHOSPHORUS},
+    {"potassium", FIELD_POTASSIUM},
+    {"raw_temperature", FIELD_RAW_TEMPERATURE},
+    {"raw_humidity", FIELD_RAW_HUMIDITY},
+    {"raw_ec", FIELD_RAW_EC},
+    {"raw_ph", FIELD_RAW_PH},
+    {"raw_nitrogen", FIELD_RAW_NITROGEN},
+    {"raw_phosphorus", FIELD_RAW_PHOSPHORUS},
+    {"raw_potassium", FIELD_RAW_POTASSIUM},
+    {"irrigation", FIELD_IRRIGATION},
+    {"valid", FIELD_VALID},
+    {"measurement_status", FIELD_MEASUREMENT_STATUS},
+    {"nutrient_interactions", FIELD_NUTRIENT_INTERACTIONS},
+    {"crop_id", FIELD_CROP_ID},
+    {"crop_specific_recommendations", FIELD_CROP_RECOMMENDATIONS},
+    {"rec_temperature", FIELD_REC_TEMPERATURE},
+    {"rec_humidity", FIELD_REC_HUMIDITY},
+    {"rec_ec", FIELD_REC_EC},
+    {"rec_ph", FIELD_REC_PH},
+    {"rec_nitrogen", FIELD_REC_NITROGEN},
+    {"rec_phosphorus", FIELD_REC_PHOSPHORUS},
+    {"rec_potassium", FIELD_REC_POTASSIUM},
+    {"season", FIELD_SEASON},
+    {"alerts", FIELD_ALERTS},
+    {"timestamp", FIELD_TIMESTAMP},
+    {"interaction_codes", FIELD_INTERACTION_CODES},
+    {"crop_codes", FIELD_CROP_CODES},
+    {"values", FIELDS_VALUES},
+    {"raw", FIELDS_RAW},
+    {"rec", FIELDS_REC},
+    {"status", FIELDS_STATUS},
+    {"recommendations", FIELDS_TEXT},
+    {"codes", FIELDS_CODES},
+    {"all", FIELDS_ALL},
+};
+
+uint32_t findSensorField(const char* name, size_t length)
+{
+    for (const SensorFieldName& field : SENSOR_FIELD_NAMES)
+    {
+        if (strlen(field.name) == length && strncmp(field.name, name, length) == 0)
+        {
+            return field.mask;
+        }
+    }
+    return 0;
+}
+
+// "ph,raw,season" -> маска; false и имя в unknownField, если поле не найдено
+bool parseSensorFields(const String& list, uint32_t& fields, std::array<char, 32>& unknownField)
+{
+    fields = 0;
+    const char* cursor = list.c_str();
+    while (*cursor != '\0')
+    {
+        const char* separator = strchr(cursor, ',');
+        const size_t length = separator != nullptr ? static_cast<size_t>(separator - cursor) : strlen(cursor);
+        if (length > 0)
+        {
+            const uint32_t mask = findSensorField(cursor, length);
+            if (mask == 0)
+            {
+                // Имя возвращается клиенту в JSON: всё, кроме [a-z0-9_], заменяем на '?'
+                const size_t copied = std::min(length, unknownField.size() - 1);
+                for (size_t i = 0; i < copied; ++i)
+                {
+                    const char symbol = cursor[i];
+                    const bool allowed = (symbol >= 'a' && symbol <= 'z') || (symbol >= '0' && symbol <= '9') ||
+                                         symbol == '_';
+                    unknownField[i] = allowed ? symbol : '?';
+                }
+                unknownField[copied] = '\0';
+                return false;
+            }
+            fields |= mask;
+        }
+        cursor += length;
+        if (*cursor == ',')
+        {
+            ++cursor;
+        }
+    }
+    return fields != 0;
+}
+
+String buildSensorJson(uint32_t fields)
+{
     StaticJsonDocument<SENSOR_JSON_DOC_SIZE> doc;
+    const SoilType soilType = static_cast<SoilType>(config.soilProfile);
+
     // Температура НЕ компенсируется - используем сырые данные
-    doc["temperature"] = format_temperature(sensorData.raw_temperature);
-    doc["humidity"] = format_moisture(sensorData.humidity);
-    
-    doc["ec"] = format_ec(sensorData.ec);
-    doc["ph"] = format_ph(sensorData.ph);
-    doc["nitrogen"] = format_npk(sensorData.nitrogen);
-    doc["phosphorus"] = format_npk(sensorData.phosphorus);
-    doc["potassium"] = format_npk(sensorData.potassium);
-    doc["raw_temperature"] = format_temperature(sensorData.raw_temperature);
-    doc["raw_humidity"] = format_moisture(sensorData.raw_humidity);
-    doc["raw_ec"] = format_ec(sensorData.raw_ec);
-    doc["raw_ph"] = format_ph(sensorData.raw_ph);
-    doc["raw_nitrogen"] = format_npk(sensorData.raw_nitrogen);
-    doc["raw_phosphorus"] = format_npk(sensorData.raw_phosphorus);
-    doc["raw_potassium"] = format_npk(sensorData.raw_potassium);
-    doc["irrigation"] = sensorData.recentIrrigation;
-    // ПРАВИЛЬНАЯ ЛОГИКА ВАЛИДАЦИИ - проверяем условия измерения
-    bool isDataValid = true;
-    String validationStatus = "optimal"; // optimal, suboptimal, irrigation, error
-    
-    // 🔴 Красный: Ошибки датчика (выход за физические пределы JXCT)
-    if (sensorData.temperature < SENSOR_TEMP_MIN || sensorData.temperature > SENSOR_TEMP_MAX ||
-        sensorData.humidity < SENSOR_HUMIDITY_MIN || sensorData.humidity > SENSOR_HUMIDITY_MAX ||
-        sensorData.ec < SENSOR_EC_MIN || sensorData.ec > SENSOR_EC_MAX ||
-        sensorData.ph < SENSOR_PH_MIN || sensorData.ph > SENSOR_PH_MAX ||
-        sensorData.nitrogen < SENSOR_NPK_MIN || sensorData.nitrogen > SENSOR_NPK_MAX ||
-        sensorData.phosphorus < SENSOR_NPK_MIN || sensorData.phosphorus > SENSOR_NPK_MAX ||
-        sensorData.potassium < SENSOR_NPK_MIN || sensorData.potassium > SENSOR_NPK_MAX) {
-        isDataValid = false;
-        validationStatus = "error";
-    }
-    // 🔵 Синий: Полив активен (временная невалидность)
-    else if (sensorData.recentIrrigation) {
-        validationStatus = "irrigation";
-    }
-    // 🟠 Оранжевый: Неоптимальные условия измерения
-    else if (sensorData.humidity < 25.0F || sensorData.temperature < 5.0F || sensorData.temperature > 40.0F) {
-        validationStatus = "suboptimal";
-    }
-    // 🟢 Зеленый: Оптимальные условия измерения
-    else {
-        validationStatus = "optimal";
+    if ((fields & FIELD_TEMPERATURE) != 0)
+    {
+        doc["temperature"] = format_temperature(sensorData.raw_temperature);
+    }
+    if ((fields & FIELD_HUMIDITY) != 0)
+    {
+        // ✅ ОПТИМИЗАЦИЯ: Простая конвертация VWC → ASM для второй колонки (без экземпляра сервиса)
+        float asmHumidity = SensorCompensationService::vwcToAsm(sensorData.humidity / 100.0F, soilType);
+        doc["humidity"] = format_moisture(asmHumidity);
+    }
+    if ((fields & FIELD_EC) != 0)
+    {
+        doc["ec"] = format_ec(sensorData.ec);
+    }
+    if ((fields & FIELD_PH) != 0)
+    {
+        doc["ph"] = format_ph(sensorData.ph);
+    }
+    if ((fields & FIELD_NITROGEN) != 0)
+    {
+        doc["nitrogen"] = format_npk(sensorData.nitrogen);
+    }
+    if ((fields & FIELD_PHOSPHORUS) != 0)
+    {
+        doc["phosphorus"] = format_npk(sensorData.phosphorus);
+    }
+    if ((fields & FIELD_POTASSIUM) != 0)
+    {
+        doc["potassium"] = format_npk(sensorData.potassium);
+    }
+    if ((fields & FIELD_RAW_TEMPERATURE) != 0)
+    {
+        doc["raw_temperature"] = format_temperature(sensorData.raw_temperature);
+    }
+    if ((fields & FIELD_RAW_HUMIDITY) != 0)
+    {
+        doc["raw_humidity"] = format_moisture(sensorData.raw_humidity);
+    }
+    if ((fields & FIELD_RAW_EC) != 0)
+    {
+        doc["raw_ec"] = format_ec(sensorData.raw_ec);
+    }
+    if ((fields & FIELD_RAW_PH) != 0)
+    {
+        doc["raw_ph"] = format_ph(sensorData.raw_ph);
+    }
+    if ((fields & FIELD_RAW_NITROGEN) != 0)
+    {
+        doc["raw_nitrogen"] = format_npk(sensorData.raw_nitrogen);
+    }
+    if ((fields & FIELD_RAW_PHOSPHORUS) != 0)
+    {
+        doc["raw_phosphorus"] = format_npk(sensorData.raw_phosphorus);
+    }
+    if ((fields & FIELD_RAW_POTASSIUM) != 0)
+    {
+        doc["raw_potassium"] = format_npk(sensorData.raw_potassium);
+    }
+    if ((fields & FIELD_IRRIGATION) != 0)
+    {
+        doc["irrigation"] = sensorData.recentIrrigation;
+    }
+
+    if ((fields & (FIELD_VALID | FIELD_MEASUREMENT_STATUS)) != 0)
+    {
+        // ПРАВИЛЬНАЯ ЛОГИКА ВАЛИДАЦИИ - проверяем условия измерения
+        bool isDataValid = true;
+        const char* validationStatus = "optimal";  // optimal, suboptimal, irrigation, error
+
+        // 🔴 Красный: Ошибки датчика (выход за физические пределы JXCT)
+        if (sensorData.temperature < SENSOR_TEMP_MIN || sensorData.temperature > SENSOR_TEMP_MAX ||
+            sensorData.humidity < SENSOR_HUMIDITY_MIN || sensorData.humidity > SENSOR_HUMIDITY_MAX ||
+            sensorData.ec < SENSOR_EC_MIN || sensorData.ec > SENSOR_EC_MAX ||
+            sensorData.ph < SENSOR_PH_MIN || sensorData.ph > SENSOR_PH_MAX ||
+            sensorData.nitrogen < SENSOR_NPK_MIN || sensorData.nitrogen > SENSOR_NPK_MAX ||
+            sensorData.phosphorus < SENSOR_NPK_MIN || sensorData.phosphorus > SENSOR_NPK_MAX ||
+            sensorData.potassium < SENSOR_NPK_MIN || sensorData.potassium > SENSOR_NPK_MAX)
+        {
+            isDataValid = false;
+            validationStatus = "error";
+        }
+        // 🔵 Синий: Полив активен (временная невалидность)
+        else if (sensorData.recentIrrigation)
+        {
+            validationStatus = "irrigation";
+        }
+        // 🟠 Оранжевый: Неоптимальные условия измерения
+        else if (sensorData.humidity < 25.0F || sensorData.temperature < 5.0F || sensorData.temperature > 40.0F)
+        {
+            validationStatus = "suboptimal";
+        }
+        // 🟢 Зеленый: Оптимальные условия измерения
+
+        if ((fields & FIELD_VALID) != 0)
+        {
+            doc["valid"] = isDataValid;
+        }
+        if ((fields & FIELD_MEASUREMENT_STATUS) != 0)
+        {
+            doc["measurement_status"] = validationStatus;
+        }
     }
-    
-    doc["valid"] = isDataValid;
-    doc["measurement_status"] = validationStatus;
-
-    // ❌ ОТКЛЮЧАЕМ СТАРУЮ СИСТЕМУ - используем только новый системный алгоритм
-    // RecValues rec = computeRecommendations();
-    // doc["rec_temperature"] = format_temperature(rec.t);
-    // doc["rec_humidity"] = format_moisture(rec.hum);
-    // doc["rec_ec"] = format_ec(rec.ec);
-    // doc["rec_ph"] = format_ph(rec.ph);
-    // doc["rec_nitrogen"] = format_npk(rec.n);
-    // doc["rec_phosphorus"] = format_npk(rec.p);
-    // doc["rec_potassium"] = format_npk(rec.k);
 
     // ---- Рекомендации по взаимодействию питательных веществ ----
-    NPKReferences npk{sensorData.nitrogen, sensorData.phosphorus, sensorData.potassium};
-    SoilType soilType = static_cast<SoilType>(config.soilProfile);
-    
+    if ((fields & FIELD_NUTRIENT_INTERACTIONS) != 0)
+    {
+        NPKReferences npk{sensorData.nitrogen, sensorData.phosphorus, sensorData.potassium};
+        doc["nutrient_interactions"] =
+            getNutrientInteractionService().generateAntagonismRecommendations(npk, soilType, sensorData.ph);
+    }
 
-    
-    // Получаем рекомендации по антагонизмам
-    String antagonismRecommendations = getNutrientInteractionService().generateAntagonismRecommendations(
-        npk, soilType, sensorData.ph);
-    doc["nutrient_interactions"] = antagonismRecommendations;
-    
-    // ✅ Дополнительная проверка: если cropId пустой, устанавливаем "none"
-    if (strlen(config.cropId) == 0) {
-        strlcpy(config.cropId, "none", sizeof(config.cropId));
-        logDebugSafe("JSON API: cropId was empty, set to 'none'");
+    // Те же рекомендации кодами: {code, value, reference}; текст и уровень кода - /api/v2/advice
+    if ((fields & FIELD_INTERACTION_CODES) != 0)
+    {
+        const NPKReferences npk{sensorData.nitrogen, sensorData.phosphorus, sensorData.potassium};
+        JsonArray codes = doc.createNestedArray("interaction_codes");
+        for (const Advice::Item& item :
+             getNutrientInteractionService().assessAntagonisms(npk, soilType, sensorData.ph))
+        {
+            JsonObject code = codes.createNestedObject();
+            code["code"] = static_cast<uint8_t>(item.code);
+            code["value"] = item.value;
+            code["reference"] = item.reference;
+        }
     }
-    
+    if ((fields & FIELD_CROP_CODES) != 0)
+    {
+        JsonArray codes = doc.createNestedArray("crop_codes");
+        if (strlen(config.cropId) > 0 && strcmp(config.cropId, "none") != 0)
+        {
+            const NPKReferences npk{sensorData.nitrogen, sensorData.phosphorus, sensorData.potassium};
+            for (const CropRules::MessageId id :
+                 CropRules::evaluate(cropIdFromName(config.cropId), soilType, npk, sensorData.ph))
+            {
+                codes.add(static_cast<uint8_t>(id));
+            }
+        }
+    }
+
     // ✅ Добавляем cropId в JSON (БЕЗОПАСНО)
-                doc["crop_id"] = sanitizeForJson(String(config.cropId));
-            
-            // ✅ ОТЛАДОЧНОЕ ЛОГИРОВАНИЕ для проблемы отображения культуры
-            logDebugSafe("JSON API: cropId='%s', len=%d, envType=%d", 
-                        config.cropId, strlen(config.cropId), config.environmentType);
-    
-    // Проверяем валидность crop_id
-    bool lenCheck = strlen(config.cropId) > 0;
-    bool strCheck = strcmp(config.cropId, "none") != 0;
-    
-    // ✅ crop_specific_recommendations обрабатывается ниже в системном алгоритме
-    
-    // ============================================================================
-    // ОПТИМИЗИРОВАННЫЙ АЛГОРИТМ: Только необходимые расчеты
-    // ============================================================================
-    
-    // ✅ ОПТИМИЗАЦИЯ: Определяем сезон ОДИН РАЗ
-    const char* seasonName = getCurrentSeasonName();
-    
-    // ✅ ОПТИМИЗАЦИЯ: Простая конвертация VWC → ASM для второй колонки
-    SensorCompensationService compensationService;
-    float asmHumidity = compensationService.vwcToAsm(sensorData.humidity / 100.0F, soilType);
-    doc["humidity"] = format_moisture(asmHumidity);
-    
-    // ✅ ВОЗВРАЩАЕМ УМНЫЕ РЕКОМЕНДАЦИИ
-    if (lenCheck && strCheck) {
-        // Используем научно компенсированные значения для умных рекомендаций
-        NPKReferences scientificNPK;
-        scientificNPK.nitrogen = sensorData.nitrogen;
-        scientificNPK.phosphorus = sensorData.phosphorus;
-        scientificNPK.potassium = sensorData.potassium;
-        
-        String cropRecommendations = getCropEngine().generateCropSpecificRecommendations(
-            String(config.cropId), scientificNPK, soilType, sensorData.ph, String(seasonName));
-        doc["crop_specific_recommendations"] = cropRecommendations;
-        
-        logDebugSafe("JSON API: crop='%s', rec_len=%d", config.cropId, cropRecommendations.length());
-    } else {
-        doc["crop_specific_recommendations"] = "";
+    if ((fields & FIELD_CROP_ID) != 0)
+    {
+        doc["crop_id"] = sanitizeForJson(String(config.cropId));
+        logDebugSafe("JSON API: cropId='%s', len=%d, envType=%d", config.cropId, strlen(config.cropId),
+                     config.environmentType);
     }
-    
+
+    // ✅ ОПТИМИЗАЦИЯ: Определяем сезон ОДИН РАЗ и только если он нужен
+    Season season = Season::SPRING;
+    const bool seasonKnown = (fields & (FIELD_SEASON | FIELDS_REC)) != 0 && getCurrentSeason(season);
+    const char* seasonName = "";
+    if ((fields & FIELD_SEASON) != 0)
+    {
+        seasonName = seasonKnown ? SEASON_DISPLAY_NAMES[static_cast<size_t>(season)] : "Н/Д";
+    }
+
+    // ✅ УМНЫЕ РЕКОМЕНДАЦИИ для выбранной культуры
+    if ((fields & FIELD_CROP_RECOMMENDATIONS) != 0)
+    {
+        const bool cropSelected = strlen(config.cropId) > 0 && strcmp(config.cropId, "none") != 0;
+        if (cropSelected)
+        {
+            // Используем научно компенсированные значения для умных рекомендаций
+            NPKReferences scientificNPK;
+            scientificNPK.nitrogen = sensorData.nitrogen;
+            scientificNPK.phosphorus = sensorData.phosphorus;
+            scientificNPK.potassium = sensorData.potassium;
+
+            // Правила культуры - таблица во flash, текст разворачивается из кодов сообщений
+            String cropRecommendations = getCropEngine().generateCropSpecificRecommendations(
+                cropIdFromName(config.cropId), scientificNPK, soilType, sensorData.ph);
+            doc["crop_specific_recommendations"] = cropRecommendations;
+
+            logDebugSafe("JSON API: crop='%s', rec_len=%d", config.cropId, cropRecommendations.length());
+        }
+        else
+        {
+            doc["crop_specific_recommendations"] = "";
+        }
+    }
+
     // ✅ РЕКОМЕНДУЕМЫЕ ЗНАЧЕНИЯ ДЛЯ ВЫБРАННОЙ КУЛЬТУРЫ
-    CropConfig cropConfig = getCropEngine().getCropConfig(String(config.cropId));
-    doc["rec_temperature"] = format_temperature(cropConfig.temperature);
-    doc["rec_humidity"] = format_moisture(cropConfig.humidity);
-    doc["rec_ec"] = format_ec(cropConfig.ec);
-    doc["rec_ph"] = format_ph(cropConfig.ph);
-    doc["rec_nitrogen"] = format_npk(cropConfig.nitrogen);
-    doc["rec_phosphorus"] = format_npk(cropConfig.phosphorus);
-    doc["rec_potassium"] = format_npk(cropConfig.potassium);
+    if ((fields & FIELDS_REC) != 0)
+    {
+        // Цель культуры с коррекциями среды, почвы и сезона - из кэша, пересчёт только после
+        // saveConfig() или смены сезона; id культуры переводится в CropId без String
+        const CropConfig& cropConfig = getCropTargets(season, seasonKnown)[cropIdFromName(config.cropId)];
+        if ((fields & FIELD_REC_TEMPERATURE) != 0)
+        {
+            doc["rec_temperature"] = format_temperature(cropConfig.temperature);
+        }
+        if ((fields & FIELD_REC_HUMIDITY) != 0)
+        {
+            doc["rec_humidity"] = format_moisture(cropConfig.humidity);
+        }
+        if ((fields & FIELD_REC_EC) != 0)
+        {
+            doc["rec_ec"] = format_ec(cropConfig.ec);
+        }
+        if ((fields & FIELD_REC_PH) != 0)
+        {
+            doc["rec_ph"] = format_ph(cropConfig.ph);
+        }
+        if ((fields & FIELD_REC_NITROGEN) != 0)
+        {
+            doc["rec_nitrogen"] = format_npk(cropConfig.nitrogen);
+        }
+        if ((fields & FIELD_REC_PHOSPHORUS) != 0)
+        {
+            doc["rec_phosphorus"] = format_npk(cropConfig.phosphorus);
+        }
+        if ((fields & FIELD_REC_POTASSIUM) != 0)
+        {
+            doc["rec_potassium"] = format_npk(cropConfig.potassium);
+        }
+    }
 
     // ---- Дополнительная информация ----
-    doc["season"] = seasonName;
+    if ((fields & FIELD_SEASON) != 0)
+    {
+        doc["season"] = seasonName;
+    }
 
-    // Проверяем отклонения
-    String alerts = "";
-    auto append = [&](const char* n)
+    if ((fields & FIELD_ALERTS) != 0)
     {
-        if (alerts.length())
+        // Проверяем отклонения
+        String alerts = "";
+        auto append = [&](const char* n)
+        {
+            if (alerts.length())
+            {
+                alerts += ", ";
+            }
+            alerts += n;
+        };
+        // Физические пределы датчика
+        if (sensorData.temperature < TEMP_MIN_VALID || sensorData.temperature > TEMP_MAX_VALID)
+        {
+            append("T");
+        }
+        if (sensorData.humidity < HUM_MIN_VALID || sensorData.humidity > HUM_MAX_VALID)
+        {
+            append("θ");
+        }
+        if (sensorData.ec < 0 || sensorData.ec > EC_MAX_VALID)
+        {
+            append("EC");
+        }
+        if (sensorData.ph < 3 || sensorData.ph > 9)
+        {
+            append("pH");
+        }
+        if (sensorData.nitrogen < 0 || sensorData.nitrogen > NPK_MAX_VALID)
+        {
+            append("N");
+        }
+        if (sensorData.phosphorus < 0 || sensorData.phosphorus > NPK_MAX_VALID)
         {
-            alerts += ", ";
+            append("P");
         }
-        alerts += n;
-    };
-    // Физические пределы датчика
-    if (sensorData.temperature < TEMP_MIN_VALID || sensorData.temperature > TEMP_MAX_VALID)
+        if (sensorData.potassium < 0 || sensorData.potassium > NPK_MAX_VALID)
+        {
+            append("K");
+        }
+        doc["alerts"] = alerts;
+    }
+
+    // Время сборки ответа, то есть момент прихода показаний, а не момент запроса
+    if ((fields & FIELD_TIMESTAMP) != 0)
     {
-        append("T");
+        doc["timestamp"] = static_cast<long>(timeClient != nullptr ? timeClient->getEpochTime() : 0);
     }
-    if (sensorData.humidity < HUM_MIN_VALID || sensorData.humidity > HUM_MAX_VALID)
+
+    String json;
+    serializeJson(doc, json);
+    return json;
+}
+
+// Имена каналов в ответе ранжирования, по CROP_CHANNELS
+constexpr const char* CROP_CHANNEL_NAMES[] = {"temperature", "humidity", "ec", "ph", "nitrogen", "phosphorus",
+                                              "potassium"};
+static_assert(sizeof(CROP_CHANNEL_NAMES) / sizeof(CROP_CHANNEL_NAMES[0]) == CROP_CHANNEL_COUNT,
+              "Имя на каждый канал CropConfig");
+
+float roundTenth(float value)
+{
+    return roundf(value * 10.0F) / 10.0F;
+}
+
+void sendCropRanking()
+{
+    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
+    if (currentWiFiMode != WiFiMode::STA)
     {
-        append("θ");
+        webServer.send(HTTP_FORBIDDEN, HTTP_CONTENT_TYPE_JSON, R"({"error":"AP mode"})");
+        return;
     }
-    if (sensorData.ec < 0 || sensorData.ec > EC_MAX_VALID)
+
+    size_t limit = CROP_COUNT;
+    if (webServer.hasArg("limit"))
     {
-        append("EC");
+        const long requested = webServer.arg("limit").toInt();
+        if (requested > 0 && static_cast<size_t>(requested) < CROP_COUNT)
+        {
+            limit = static_cast<size_t>(requested);
+        }
     }
-    if (sensorData.ph < 3 || sensorData.ph > 9)
+
+    ensureCropIdSet();
+    EtagBuffer etag;
+    makeGenerationEtag(getSensorDataGeneration(), hashEtagBytes(getSensorJsonConfigHash(), &limit, sizeof(limit)),
+                       etag);
+    if (sendNotModifiedIfMatch(etag.data()))
     {
-        append("pH");
+        return;
     }
-    if (sensorData.nitrogen < 0 || sensorData.nitrogen > NPK_MAX_VALID)
+
+    // Показание - те же значения, что в /sensor_json; влажность в ASM, как цели культур
+    const SoilType soilType = soilTypeFromProfile(config.soilProfile);
+    const CropReading reading(sensorData.raw_temperature,
+                              SensorCompensationService::vwcToAsm(sensorData.humidity / 100.0F, soilType),
+                              sensorData.ec, sensorData.ph, sensorData.nitrogen, sensorData.phosphorus,
+                              sensorData.potassium);
+
+    Season season = Season::SPRING;
+    const bool seasonKnown = getCurrentSeason(season);
+    const CropTargets& targets = getCropTargets(season, seasonKnown);
+    CropRanking ranking;
+    rankCrops(targets, reading, ranking);
+
+    DynamicJsonDocument doc(CROP_RANKING_JSON_DOC_SIZE);
+    doc["soil"] = soilTypeName(targets.soil);
+    doc["environment"] = ENVIRONMENT_TYPE_NAMES[static_cast<size_t>(targets.environment)];
+    doc["season"] = targets.seasonApplied ? SEASON_NAMES[static_cast<size_t>(targets.season)] : "none";
+    JsonArray channels = doc.createNestedArray("channels");
+    for (const char* name : CROP_CHANNEL_NAMES)
     {
-        append("N");
+        channels.add(name);
     }
-    if (sensorData.phosphorus < 0 || sensorData.phosphorus > NPK_MAX_VALID)
+    JsonArray crops = doc.createNestedArray("crops");
+    for (size_t i = 0; i < limit; ++i)
     {
-        append("P");
+        const CropFit& fit = ranking[i];
+        JsonObject crop = crops.createNestedObject();
+        crop["id"] = CROP_TABLE[static_cast<size_t>(fit.crop)].name;
+        crop["score"] = roundTenth(fit.score);
+        JsonArray deviation = crop.createNestedArray("deviation");
+        for (const float value : fit.deviation)
+        {
+            deviation.add(roundTenth(value));
+        }
     }
-    if (sensorData.potassium < 0 || sensorData.potassium > NPK_MAX_VALID)
+
+    String json;
+    serializeJson(doc, json);
+    webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, json);
+}
+
+// Кэш /api/v2/soils/asm: зависит только от показания и выбранного профиля почвы
+struct SoilAsmCache
+{
+    String json;
+    uint32_t generation = 0;
+    uint8_t soilProfile = 0;
+    bool filled = false;
+};
+
+SoilAsmCache soilAsmCache;
+
+// {"vwc":23.4,"current":1,"soils":[{"id":"sand","asm":100},...]}; индекс массива - config.soilProfile
+// (порядок SensorProcessing::SOIL_TYPES совпадает с SoilType)
+const String& getCachedSoilAsmJson()
+{
+    const uint32_t generation = getSensorDataGeneration();
+    if (soilAsmCache.filled && soilAsmCache.generation == generation &&
+        soilAsmCache.soilProfile == config.soilProfile)
     {
-        append("K");
+        return soilAsmCache.json;
     }
-    doc["alerts"] = alerts;
 
-    doc["timestamp"] = static_cast<long>(timeClient != nullptr ? timeClient->getEpochTime() : 0);
+    // Все 13 почв одним проходом по столбцам PWP и 100 / (FC - PWP)
+    SoilAsmValues asmBySoil;
+    SensorCompensationService::vwcToAsmAllSoils(sensorData.humidity / 100.0F, asmBySoil);
+
+    DynamicJsonDocument doc(SOIL_ASM_JSON_DOC_SIZE);
+    doc["vwc"] = roundTenth(sensorData.humidity);
+    doc["current"] = static_cast<uint8_t>(soilTypeFromProfile(config.soilProfile));
+    JsonArray soils = doc.createNestedArray("soils");
+    for (size_t i = 0; i < SOIL_TYPE_COUNT; ++i)
+    {
+        JsonObject soil = soils.createNestedObject();
+        soil["id"] = SOIL_TYPE_NAMES[i];
+        soil["asm"] = roundTenth(asmBySoil[i]);
+    }
 
     String json;
     serializeJson(doc, json);
-    webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, json);
+    soilAsmCache.json = json;
+    soilAsmCache.generation = generation;
+    soilAsmCache.soilProfile = config.soilProfile;
+    soilAsmCache.filled = true;
+    return soilAsmCache.json;
 }
 
-void setupDataRoutes()
+void sendSoilAsmComparison()
 {
-    // Красивая страница показаний с иконками (оригинальный дизайн)
-    webServer.on(
-        "/readings", HTTP_GET,
-        []()
-        {
-            logWebRequest("GET", "/readings", webServer.client().remoteIP().toString());
+    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
+    if (currentWiFiMode != WiFiMode::STA)
+    {
+        webServer.send(HTTP_FORBIDDEN, HTTP_CONTENT_TYPE_JSON, R"({"error":"AP mode"})");
+        return;
+    }
 
-            if (currentWiFiMode == WiFiMode::AP)
-            {
-                webServer.send(200, "text/html; charset=utf-8",
-                               generateApModeUnavailablePage("Показания", UI_ICON_DATA));
-                return;
-            }
+    EtagBuffer etag;
+    makeGenerationEtag(getSensorDataGeneration(),
+                       hashEtagBytes(ETAG_HASH_SEED, &config.soilProfile, sizeof(config.soilProfile)), etag);
+    if (sendNotModifiedIfMatch(etag.data()))
+    {
+        return;
+    }
+
+    webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, getCachedSoilAsmJson());
+}
 
-            String html = generatePageHeader("Показания датчика", UI_ICON_DATA);
-            html += navHtml();
-            html += "<h1>" UI_ICON_DATA " Показания датчика</h1>";
-
-            // Информационная строка состояния
-            html += "<div id='statusInfo' style='margin:10px 0;font-size:16px;color:#333'></div>";
-
-            // ======= ОБЪЯСНЕНИЕ ПРОЦЕССОВ =======
-            html += "<div class='section' style='background:#f8f9fa;padding:15px;border-radius:8px;margin:15px 0;'>";
-            html += "<h3>📋 Как работают показания</h3>";
-            html += "<div style='display:grid;grid-template-columns:1fr 1fr;gap:20px;font-size:14px;'>";
-
-            // Левая колонка - компенсация
-            html += "<div>";
-            html += "<h4>🔧 Компенсация показаний</h4>";
-            html += "<ul style='margin:0;padding-left:20px;'>";
-            html += "<li><strong>RAW</strong> - сырые данные с датчика JXCT</li>";
-            html += "<ul style='margin:5px 0;padding-left:15px;'>";
-            html += "<li><strong>Цветовая индикация RAW:</strong></li>";
-            html += "<ul style='margin:5px 0;padding-left:15px;'>";
-            html += "<li>🟢 <strong>Зеленый:</strong> значение в рабочем диапазоне датчика</li>";
-            html += "<li>🟡 <strong>Желтый:</strong> значение в диапазоне с малой точностью</li>";
-            html += "<li>🔴 <strong>Красный:</strong> значение за пределами датчика</li>";
-            html += "</ul>";
-            html += "<li><strong>Точность в скобках:</strong> указана точность измерений для каждого параметра</li>";
-            html += "<li><strong>Валидность данных:</strong> данные считаются валидными при влажности ≥25%, температуре 5-40°C, отсутствии полива и ошибок датчика</li>";
-            html += "</ul>";
-            html += "<li><strong>Компенс.</strong> - данные после математической компенсации:</li>";
-            html += "<ul style='margin:5px 0;padding-left:15px;'>";
-            html += "<li>🌡️ <strong>Температура:</strong> без изменений</li>";
-            html += "<li>💧 <strong>Влажность:</strong> без изменений</li>";
-            html += "<li>⚡ <strong>EC:</strong> температурная компенсация (Rhoades et al., 1989)</li>";
-            html += "<li>⚗️ <strong>pH:</strong> температурная поправка по Нернсту (Nernst, 1889)</li>";
-            html +=
-                "<li>🌿🌱🍎 <strong>NPK:</strong> экспоненциальная компенсация по T и влажности (Delgado et al., 2020)</li>";
-            html += "</ul>";
-            html += "<ul style='margin:5px 0;padding-left:15px;'>";
-            html += "<li><strong>Цветовая индикация Компенс.:</strong></li>";
-            html += "<ul style='margin:5px 0;padding-left:15px;'>";
-            html += "<li>🟢 <strong>Зеленый:</strong> отклонение от RAW ≤ ±5%</li>";
-            html += "<li>🟡 <strong>Желтый:</strong> отклонение от RAW ≤ ±10%</li>";
-            html += "<li>🟠 <strong>Оранжевый:</strong> отклонение от RAW ≤ ±15%</li>";
-            html += "<li>🔴 <strong>Красный:</strong> отклонение от RAW > ±15%</li>";
-            html += "</ul>";
-            html += "</ul>";
-            html += "</ul>";
-            html += "</div>";
-
-            // Правая колонка - рекомендации
-            html += "<div>";
-            html += "<h4>🎯 Рекомендации</h4>";
-            html += "<ul style='margin:0;padding-left:20px;'>";
-            html += "<li><strong>Базовые нормы</strong> для выбранной культуры</li>";
-            html += "<li><strong>Сезонные корректировки</strong> (весна/лето/осень/зима)</li>";
-            html += "<li><strong>Тип среды</strong> (открытый грунт/теплица/помещение)</li>";
-            html += "<li><strong>Цветовая индикация Рекомендаций:</strong></li>";
-            html += "<ul style='margin:5px 0;padding-left:15px;'>";
-            html += "<li>🟢 <strong>Зеленый:</strong> отклонение от рекомендации ≤ ±10%</li>";
-            html += "<li>🟡 <strong>Желтый:</strong> отклонение от рекомендации ≤ ±20%</li>";
-            html += "<li>🟠 <strong>Оранжевый:</strong> отклонение от рекомендации ≤ ±30%</li>";
-            html += "<li>🔴 <strong>Красный:</strong> отклонение от рекомендации > ±30%</li>";
-            html += "</ul>";
-            html += "<li><strong>Цветовая индикация валидности данных:</strong></li>";
-            html += "<ul style='margin:5px 0;padding-left:15px;'>";
-            html += "<li>🟢 <strong>Зеленый:</strong> данные валидны</li>";
-            html += "<li>🔵 <strong>Синий:</strong> полив активен - данные временно не валидны</li>";
-            html += "<li>🟠 <strong>Оранжевый:</strong> данные не валидны - неоптимальные условия</li>";
-            html += "<li>🔴 <strong>Красный:</strong> данные не валидны - ошибки датчика</li>";
-            html += "</ul>";
-            html += "<li><strong>Детекция полива:</strong> автоматическое определение полива по скачку влажности и времени</li>";
-            html += "</ul>";
-            html += "</div>";
-
-            html += "</div>";
-            html += "</div>";
-
-            // Заголовок 4-го столбца: выбранная культура или «Реком.»
-            String recHeader = "Реком.";
-            if (strlen(config.cropId) > 0)
+// Тексты каталога пишутся в JSON без экранирования (для Advice::ADVICE_TEXTS - проверка в advice_codes.h)
+constexpr bool cropMessagesAreJsonSafe()
+{
+    for (const CropRules::MessageText& message : CropRules::MESSAGE_TEXTS)
+    {
+        for (const char* c = message.text; *c != '\0'; ++c)
+        {
+            if (*c == '"' || *c == '\\' || *c == '\n')
             {
-                const char* cropId = config.cropId;
-                
-                // Lookup table для названий культур - более поддерживаемо
-                static const struct {
-                    const char* id;
-                    const char* name;
-                } cropNames[] = {
-                    // Основные культуры
-                    {"tomato", "Томаты"},
-                    {"cucumber", "Огурцы"},
-                    {"pepper", "Перец"},
-                    {"lettuce", "Салат"},
-                    {"blueberry", "Голубика"},
-                    {"lawn", "Газон"},
-                    {"grape", "Виноград"},
-                    {"conifer", "Хвойные"},
-                    {"strawberry", "Клубника"},
-                    {"apple", "Яблоня"},
-                    {"pear", "Груша"},
-                    {"cherry", "Вишня"},
-                    {"raspberry", "Малина"},
-                    {"currant", "Смородина"},
-                    
-                    // НОВЫЕ КУЛЬТУРЫ (Фаза 1 - Приоритетные, научно обоснованные 2024)
-                    {"spinach", "Шпинат"},
-                    {"basil", "Базилик"},
-                    {"cannabis", "Конопля"},
-                    
-                    // НОВЫЕ КУЛЬТУРЫ (Фаза 2 - Важные, стратегические)
-                    {"wheat", "Пшеница"},
-                    {"potato", "Картофель"},
-                    
-                    // НОВЫЕ КУЛЬТУРЫ (Фаза 3 - Завершающие, полное покрытие)
-                    {"kale", "Кале"},
-                    {"blackberry", "Ежевика"},
-                    {"soybean", "Соя"},
-                    {"carrot", "Морковь"},
-                    
-                    // Завершающий элемент для определения размера массива
-                    {nullptr, nullptr}
-                };
-                
-                // Поиск культуры в lookup table
-                for (int i = 0; cropNames[i].id != nullptr; i++) {
-                    if (strcmp(cropId, cropNames[i].id) == 0) {
-                        recHeader = cropNames[i].name;
-                        break;
-                    }
-                }
+                return false;
             }
+        }
+    }
+    return true;
+}
+static_assert(cropMessagesAreJsonSafe(), "Текст CropRules::MESSAGE_TEXTS требует экранирования в JSON");
 
-            html += "<div class='section'><table class='data'><thead><tr><th></th><th>RAW</th><th>Компенс.</th><th>" +
-                    recHeader + "</th></tr></thead><tbody>";
-            html +=
-                "<tr><td>🌡️ Температура, °C</td><td><span id='temp_raw'></span></td><td><span "
-                "id='temp'></span></td><td><span id='temp_rec'></span></td></tr>";
-            html +=
-                "<tr><td>💧 Влажность, %</td><td><span id='hum_raw'></span> VWC</td><td><span "
-                "id='hum'></span> ASM</td><td><span id='hum_rec'></span> ASM</td></tr>";
-            html +=
-                "<tr><td>⚡ EC, µS/cm</td><td><span id='ec_raw'></span></td><td><span id='ec'></span></td><td><span "
-                "id='ec_rec'></span></td></tr>";
-            html +=
-                "<tr><td>⚗️ pH</td><td><span id='ph_raw'></span></td><td><span id='ph'></span></td><td><span "
-                "id='ph_rec'></span></td></tr>";
-            html +=
-                "<tr><td>🌿 Азот (N), мг/кг</td><td><span id='n_raw'></span></td><td><span "
-                "id='n'></span></td><td><span id='n_rec'></span><span id='n_season' "
-                "class='season-adj'></span></td></tr>";
-            html +=
-                "<tr><td>🌱 Фосфор (P), мг/кг</td><td><span id='p_raw'></span></td><td><span "
-                "id='p'></span></td><td><span id='p_rec'></span><span id='p_season' "
-                "class='season-adj'></span></td></tr>";
-            html +=
-                "<tr><td>🍎 Калий (K), мг/кг</td><td><span id='k_raw'></span></td><td><span "
-                "id='k'></span></td><td><span id='k_rec'></span><span id='k_season' "
-                "class='season-adj'></span></td></tr>";
-            html += "</tbody></table></div>";
-
-            // ======= РЕКОМЕНДАЦИИ ПО ВЗАИМОДЕЙСТВИЮ ПИТАТЕЛЬНЫХ ВЕЩЕСТВ =======
-            html += "<div class='section'><h2>🔬 Рекомендации по взаимодействию питательных веществ</h2>";
-            
-            // Антагонизмы и синергизмы
-            html += "<div style='background:#f8f9fa;padding:15px;border-radius:8px;margin:15px 0;'>";
-            html += "<h4>⚠️ Антагонизмы и синергизмы</h4>";
-            html += "<div id='nutrient-interactions' style='font-size:14px;line-height:1.6;'>";
-            html += "<p><em>Загрузка рекомендаций...</em></p>";
-            html += "</div>";
-            html += "</div>";
-            
-            // Специфические рекомендации по культурам
-            html += "<div style='background:#e8f5e8;padding:15px;border-radius:8px;margin:15px 0;'>";
-            html += "<h4>🌱 Специфические рекомендации по культурам</h4>";
-            html += "<div id='crop-specific-recommendations' style='font-size:14px;line-height:1.6;'>";
-            html += "<p><em>Загрузка рекомендаций...</em></p>";
-            html += "</div>";
-            html += "</div>";
-            
-            html += "</div>";
-
-
-
-
-
-            // ======= ДОПОЛНИТЕЛЬНАЯ ИНФОРМАЦИЯ =======
-            html += "<div class='section' style='background:#e8f5e8;padding:15px;border-radius:8px;margin:15px 0;'>";
-            html += "<h4>💡 Полезная информация</h4>";
-            html += "<ul style='margin:5px 0;padding-left:20px;font-size:14px;'>";
-            html += "<li><strong>Стрелки ↑↓</strong> показывают направление изменений после компенсации</li>";
-            html += "<li><strong>Сезонные корректировки</strong> учитывают потребности растений в разные периоды</li>";
-            html += "<li><strong>Валидность данных</strong> проверяется по диапазонам и логическим связям</li>";
-            html += "<li><strong>Интервал обновления:</strong> каждые 5 секунд</li>";
-            html += "</ul>";
-            
-            // Добавляем пояснение о показаниях влажности
-            html += "<div style='margin-top:15px;padding:10px;background:#e8f4fd;border-left:4px solid #2196F3;border-radius:4px;'>";
-            html += "<h5 style='margin:0 0 8px 0;color:#1976D2;'>💧 Пояснение показаний влажности</h5>";
-            html += "<ul style='margin:0;padding-left:20px;font-size:13px;'>";
-            html += "<li><strong>VWC (Volumetric Water Content):</strong> объемная влажность почвы - сырые данные датчика в % от объема почвы</li>";
-            html += "<li><strong>ASM (Available Soil Moisture):</strong> доступная влага - процент от полевой влагоемкости, доступный растениям</li>";
-            html += "<li><strong>FC (Field Capacity):</strong> полевая влагоемкость - максимальное количество воды, которое почва удерживает после стекания избытка</li>";
-            html += "<li><strong>PWP (Permanent Wilting Point):</strong> точка увядания - минимальная влажность, при которой растения начинают увядать</li>";
-            html += "<li><strong>Формула ASM:</strong> ASM = (VWC - PWP) / (FC - PWP) × 100%</li>";
-            html += "</ul>";
-            html += "</div>";
-            html += "</div>";
-
-            html += "<style>";
-            html += ".season-adj { font-size: 0.8em; margin-left: 5px; }";
-            html += ".season-adj.up { color: #2ecc71; }";
-            html += ".season-adj.down { color: #e74c3c; }";
-            html +=
-                ".data{width:100%;border-collapse:collapse}.data th,.data td{border:1px solid "
-                "#ccc;padding:6px;text-align:center}.data "
-                "th{background:#f5f5f5}.green{color:#4CAF50}.yellow{color:#FFC107}.orange{color:#FF9800}.red{color:#"
-                "F44336}.blue{color:#2196F3}";
-            html += "</style>";
-
-            html += "<script>";
-            html += "function set(id,v){if(v!==undefined&&v!==null){document.getElementById(id).textContent=v;}}";
-            html +=
-                "function colorDelta(a,b){var diff=Math.abs(a-b)/b*100;if(diff>30)return 'red';if(diff>20)return "
-                "'orange';if(diff>10)return 'yellow';return '';}";
-            html +=
-                "function colorRange(v,min,max){var span=(max-min);if(span<=0)return '';if(v<min||v>max)return "
-                "'red';if(v<min+0.05*span||v>max-0.05*span)return 'orange';if(v<min+0.10*span||v>max-0.10*span)return "
-                "'yellow';return '';}";
-            
-            // 🌈 НОВАЯ ЛОГИКА РАСКРАСКИ ДЛЯ JXCT ДАТЧИКА
-            html += "function colorSensorRange(value, sensorType) {";
-            html += "  const ranges = {";
-            html += "    temp: { min: -40, max: 80, precision: '±0.5°C' },";
-            html += "    hum: { min: 0, max: 100, precision: '±3%RH' },";
-            html += "    ph: { min: 3, max: 9, precision: '±0.3pH' },";
-            html += "    ec: { min: 0, max: 20000, precision: '±2-5%' },";
-            html += "    n: { min: 0, max: 1999, precision: '2%' },";
-            html += "    p: { min: 0, max: 1999, precision: '2%' },";
-            html += "    k: { min: 0, max: 1999, precision: '2%' }";
-            html += "  };";
-            html += "  const range = ranges[sensorType];";
-            html += "  if (!range) return '';";
-            html += "  if (value < range.min || value > range.max) return 'red';";
-            html += "  /* ОСОБАЯ ЛОГИКА ДЛЯ ВЛАЖНОСТИ: желтый выше 53% */";
-            html += "  if (sensorType === 'hum' && value > 53) return 'yellow';";
-            html += "  return 'green';";
-            html += "}";
-            
-            html += "function colorCompensationDeviation(compensated, raw) {";
-            html += "  if (raw === 0) return '';";
-            html += "  const deviation = Math.abs((compensated - raw) / raw * 100);";
-            html += "  if (deviation <= 5) return 'green';";
-            html += "  if (deviation <= 10) return 'yellow';";
-            html += "  if (deviation <= 15) return 'orange';";
-            html += "  return 'red';";
-            html += "}";
-            html +=
-                "function applyColor(spanId,cls){var "
-                "el=document.getElementById(spanId);if(!el)return;el.classList.remove('red','orange','yellow','green');"
-                "if(cls){el.classList.add(cls);}else{el.classList.add('green');}}";
-            html +=
-                "var "
-                "limits={temp:{min:5,max:40},hum:{min:25,max:60},ec:{min:1000,max:3000},ph:{min:6.0,max:7.0},n:{min:150,max:"
-                "350},p:{min:80,max:180},k:{min:180,max:450}};";
-            html += "function updateSensor(){";
-            html += "fetch('/sensor_json')";
-            html += ".then(r => {";
-            html += "  if (!r.ok) throw new Error('HTTP ' + r.status);";
-            html += "  return r.json();";
-            html += "})";
-            html += ".then(d => {";
-            html += "  if (!d || typeof d !== 'object') throw new Error('Invalid data');";
-            html += "  console.log('Valid sensor data received:', d);";
-            // 🌈 ФУНКЦИЯ ДЛЯ ОТОБРАЖЕНИЯ RAW ЗНАЧЕНИЙ С ТОЧНОСТЬЮ В СКОБКАХ (ГЛОБАЛЬНАЯ)
-            html += "function setRawWithPrecision(id, value, sensorType) {";
-            html += "  const ranges = {";
-            html += "    temp: { precision: '±0.5°C' },";
-            html += "    hum: { precision: '±3%RH', lowPrecisionMin: 53, lowPrecisionMax: 100, lowPrecision: '±5%RH' },";
-            html += "    ph: { precision: '±0.3pH' },";
-            html += "    ec: { precision: '±2-5%' },";
-            html += "    n: { precision: '2%' },";
-            html += "    p: { precision: '2%' },";
-            html += "    k: { precision: '2%' }";
-            html += "  };";
-            html += "  const range = ranges[sensorType];";
-            html += "  if (!range) {";
-            html += "    set(id, value);";
-            html += "    return;";
-            html += "  }";
-            html += "  const element = document.getElementById(id);";
-            html += "  if (element) {";
-            html += "    let precision = range.precision;";
-            html += "    /* ОСОБАЯ ЛОГИКА ДЛЯ ВЛАЖНОСТИ: показываем ±5%RH выше 53% */";
-            html += "    if (sensorType === 'hum' && value > 53 && range.lowPrecision) {";
-            html += "      precision = range.lowPrecision;";
-            html += "    }";
-            html += "    element.textContent = value + ' (' + precision + ')';";
-            html += "  }";
-            html += "}";
-            
-            // 🌈 УСТАНОВКА RAW ЗНАЧЕНИЙ С ТОЧНОСТЬЮ В СКОБКАХ
-            html += "setRawWithPrecision('temp_raw',d.raw_temperature,'temp');";
-            html += "setRawWithPrecision('hum_raw',d.raw_humidity,'hum');";
-            html += "setRawWithPrecision('ec_raw',d.raw_ec,'ec');";
-            html += "setRawWithPrecision('ph_raw',d.raw_ph,'ph');";
-            html += "setRawWithPrecision('n_raw',d.raw_nitrogen,'n');";
-            html += "setRawWithPrecision('p_raw',d.raw_phosphorus,'p');";
-            html += "setRawWithPrecision('k_raw',d.raw_potassium,'k');";
-            html +=
-                "set('temp_rec',d.rec_temperature);set('hum_rec',d.rec_humidity);set('ec_rec',d.rec_ec);set('ph_rec',d."
-                "rec_ph);set('n_rec',d.rec_nitrogen);set('p_rec',d.rec_phosphorus);set('k_rec',d.rec_potassium);";
-            // === Arrow indicators block ===
-            html += "const tol={temp:0.2,hum:0.5,ec:20,ph:0.05,n:5,p:3,k:3};";
-            html +=
-                "function "
-                "arrowSign(base,val,thr){base=parseFloat(base);val=parseFloat(val);if(isNaN(base)||isNaN(val))return "
-                "'';if(val>base+thr)return '↑ ';if(val<base-thr)return '↓ ';return '';};";
-            html += "function showWithArrow(id,sign,value){document.getElementById(id).textContent=sign+value;}";
-
-            // Compensated vs RAW arrows
-            // Температура и влажность БЕЗ стрелок (просто значения)
-            html += "showWithArrow('temp', '', d.temperature);";
-            html += "showWithArrow('hum',  '', d.humidity);";
-            html += "showWithArrow('ec',   arrowSign(d.raw_ec          ,d.ec          ,tol.ec  ), d.ec);";
-            html += "showWithArrow('ph',   arrowSign(d.raw_ph          ,d.ph          ,tol.ph  ), d.ph);";
-            html += "showWithArrow('n',    arrowSign(d.raw_nitrogen    ,d.nitrogen    ,tol.n   ), d.nitrogen);";
-            html += "showWithArrow('p',    arrowSign(d.raw_phosphorus  ,d.phosphorus  ,tol.p   ), d.phosphorus);";
-            html += "showWithArrow('k',    arrowSign(d.raw_potassium   ,d.potassium   ,tol.k   ), d.potassium);";
-
-            // Recommendation arrows (target vs current)
-            html +=
-                "showWithArrow('temp_rec', arrowSign(d.temperature ,d.rec_temperature ,tol.temp), d.rec_temperature);";
-            html += "showWithArrow('hum_rec',  arrowSign(d.humidity    ,d.rec_humidity    ,tol.hum ), d.rec_humidity);";
-            html += "showWithArrow('ec_rec',   arrowSign(d.ec          ,d.rec_ec          ,tol.ec  ), d.rec_ec);";
-            html += "showWithArrow('ph_rec',   arrowSign(d.ph          ,d.rec_ph          ,tol.ph  ), d.rec_ph);";
-            html += "showWithArrow('n_rec',    arrowSign(d.nitrogen    ,d.rec_nitrogen    ,tol.n   ), d.rec_nitrogen);";
-            html +=
-                "showWithArrow('p_rec',    arrowSign(d.phosphorus  ,d.rec_phosphorus  ,tol.p   ), d.rec_phosphorus);";
-            html +=
-                "showWithArrow('k_rec',    arrowSign(d.potassium   ,d.rec_potassium   ,tol.k   ), d.rec_potassium);";
-            // === End arrow indicators ===
-
-            // Добавляем индикацию сезонных корректировок из новых данных JSON API
-            html += "function updateSeasonalAdjustments(d) {";
-            html += "  if (d.correction_percentages) {";
-            html += "    const percentages = d.correction_percentages;";
-            html += "    const spanN = document.getElementById('n_season');";
-            html += "    const spanP = document.getElementById('p_season');";
-            html += "    const spanK = document.getElementById('k_season');";
-            html += "    if(spanN && percentages.nitrogen !== undefined) {";
-            html += "      const valueN = parseFloat(percentages.nitrogen);";
-            html += "      const signN = valueN >= 0 ? '+' : '';";
-            html += "      spanN.textContent = ` (${signN}${valueN}%)`;";
-            html += "      spanN.className = 'season-adj ' + (valueN >= 0 ? 'up' : 'down');";
-            html += "    }";
-            html += "    if(spanP && percentages.phosphorus !== undefined) {";
-            html += "      const valueP = parseFloat(percentages.phosphorus);";
-            html += "      const signP = valueP >= 0 ? '+' : '';";
-            html += "      spanP.textContent = ` (${signP}${valueP}%)`;";
-            html += "      spanP.className = 'season-adj ' + (valueP >= 0 ? 'up' : 'down');";
-            html += "    }";
-            html += "    if(spanK && percentages.potassium !== undefined) {";
-            html += "      const valueK = parseFloat(percentages.potassium);";
-            html += "      const signK = valueK >= 0 ? '+' : '';";
-            html += "      spanK.textContent = ` (${signK}${valueK}%)`;";
-            html += "      spanK.className = 'season-adj ' + (valueK >= 0 ? 'up' : 'down');";
-            html += "    }";
-            html += "  }";
-            html += "}";
-
-            // 🌈 ОБНОВЛЕННАЯ ЛОГИКА ВАЛИДАЦИИ С СИНЕЙ ОКРАСКОЙ ДЛЯ ПОЛИВА
-            html += "var statusHtml = '';";
-            html += "if (d.irrigation) {";
-            html += "  statusHtml = '<span class=\"blue\">Полив активен - данные временно не валидны</span>';";
-            html += "} else if (d.alerts && Array.isArray(d.alerts) && d.alerts.length > 0) {";
-            html += "  statusHtml = '<span class=\"red\">Данные не валидны - ошибки датчика</span>';";
-            html += "} else if (d.humidity < 25 || d.temperature < 5 || d.temperature > 40) {";
-            html += "  statusHtml = '<span class=\"orange\">Данные не валидны - неоптимальные условия</span>';";
-            html += "} else {";
-            html += "  statusHtml = '<span class=\"green\">Данные валидны</span>';";
-            html += "}";
-            html +=
-                R"(var seasonColor={'Лето':'green','Весна':'yellow','Осень':'yellow','Зима':'red','Н/Д':''}[d.season]||'';)";
-            html += R"(var seasonHtml=seasonColor?(`<span class=\"${seasonColor}\">${d.season}</span>`):d.season;)";
-            html += "document.getElementById('statusInfo').innerHTML=statusHtml+' | Сезон: '+seasonHtml;";
-            html += "updateSeasonalAdjustments(d);";
-            
-            // Обновление рекомендаций по взаимодействию питательных веществ
-            html += "console.log('Sensor data received:', d);";
-            html += "console.log('nutrient_interactions:', d.nutrient_interactions);";
-            html += "console.log('crop_specific_recommendations:', d.crop_specific_recommendations);";
-            html += "console.log('nutrient-interactions div exists:', !!document.getElementById('nutrient-interactions'));";
-            html += "console.log('crop-specific-recommendations div exists:', !!document.getElementById('crop-specific-recommendations'));";
-            
-            html += "const interactionsDiv = document.getElementById('nutrient-interactions');";
-            html += "if(interactionsDiv) {";
-            html += "  if(d.nutrient_interactions && typeof d.nutrient_interactions === 'string' && d.nutrient_interactions.length > 0) {";
-            html += "    interactionsDiv.innerHTML = d.nutrient_interactions.replace(/\\\\n/g, '<br>');";
-            html += "    console.log('Updated nutrient interactions');";
-            html += "  } else {";
-            html += "    interactionsDiv.innerHTML = '<p style=\\\"color:#28a745;\\\">✅ Антагонизмов питательных веществ не обнаружено</p>';";
-            html += "    console.log('No nutrient interactions found');";
-            html += "  }";
-            html += "} else {";
-            html += "  console.error('nutrient-interactions div not found');";
-            html += "}";
-            
-            html += "const cropDiv = document.getElementById('crop-specific-recommendations');";
-            html += "if(cropDiv) {";
-            html += "  if(d.crop_specific_recommendations && typeof d.crop_specific_recommendations === 'string' && d.crop_specific_recommendations.length > 0) {";
-            html += "    cropDiv.innerHTML = d.crop_specific_recommendations.replace(/\\\\n/g, '<br>');";
-            html += "    console.log('Updated crop recommendations');";
-            html += "  } else {";
-            html += "    cropDiv.innerHTML = '<p style=\\\"color:#6c757d;\\\">ℹ️ Выберите культуру для получения специфических рекомендаций</p>';";
-            html += "    console.log('No crop selected or no recommendations');";
-            html += "  }";
-            html += "} else {";
-            html += "  console.error('crop-specific-recommendations div not found');";
-            html += "}";
-            
-            // 🌈 НОВАЯ РАСКРАСКА RAW ЗНАЧЕНИЙ ПО ДИАПАЗОНАМ JXCT
-            html += "var tvr=parseFloat(d.raw_temperature);applyColor('temp_raw',colorSensorRange(tvr,'temp'));";
-            html += "var hvr=parseFloat(d.raw_humidity);applyColor('hum_raw',colorSensorRange(hvr,'hum'));";
-            html += "var evr=parseFloat(d.raw_ec);applyColor('ec_raw',colorSensorRange(evr,'ec'));";
-            html += "var pvr=parseFloat(d.raw_ph);applyColor('ph_raw',colorSensorRange(pvr,'ph'));";
-            html += "var nvr=parseFloat(d.raw_nitrogen);applyColor('n_raw',colorSensorRange(nvr,'n'));";
-            html += "var p2r=parseFloat(d.raw_phosphorus);applyColor('p_raw',colorSensorRange(p2r,'p'));";
-            html += "var kvr=parseFloat(d.raw_potassium);applyColor('k_raw',colorSensorRange(kvr,'k'));";
-            html +=
-                "['temp','hum','ec','ph','n','p','k'].forEach(function(id){var "
-                "el=document.getElementById(id);if(el){el.classList.remove('red','orange','yellow','green');}});";
-            html += "var ct=parseFloat(d.temperature||0);";
-            html += "var ch=parseFloat(d.humidity||0);";
-            html += "var ce=parseFloat(d.ec||0);";
-            html += "var cph=parseFloat(d.ph||0);";
-            html += "var cn=parseFloat(d.nitrogen||0);";
-            html += "var cp=parseFloat(d.phosphorus||0);";
-            html += "var ck=parseFloat(d.potassium||0);";
-            
-            // 🌈 РАСКРАСКА КОМПЕНСИРОВАННЫХ ЗНАЧЕНИЙ ПО ОТКЛОНЕНИЮ ОТ RAW
-            // Температура и влажность НЕ окрашиваем (серый цвет)
-            html += "applyColor('temp', '');";  // Серый цвет (без окраски)
-            html += "applyColor('hum',  '');";  // Серый цвет (без окраски)
-            html += "applyColor('ec',   colorCompensationDeviation(ce, parseFloat(d.raw_ec||0)));";
-            html += "applyColor('ph',   colorCompensationDeviation(cph, parseFloat(d.raw_ph||0)));";
-            html += "applyColor('n',    colorCompensationDeviation(cn, parseFloat(d.raw_nitrogen||0)));";
-            html += "applyColor('p',    colorCompensationDeviation(cp, parseFloat(d.raw_phosphorus||0)));";
-            html += "applyColor('k',    colorCompensationDeviation(ck, parseFloat(d.raw_potassium||0)));";
-            
-            // Применяем цвета к рекомендациям
-            html += "applyColor('temp_rec', colorDelta(ct, parseFloat(d.rec_temperature||0)));";
-            html += "applyColor('hum_rec',  colorDelta(ch, parseFloat(d.rec_humidity||0)));";
-            html += "applyColor('ec_rec',   colorDelta(ce, parseFloat(d.rec_ec||0)));";
-            html += "applyColor('ph_rec',   colorDelta(cph,parseFloat(d.rec_ph||0)));";
-            html += "applyColor('n_rec',    colorDelta(cn, parseFloat(d.rec_nitrogen||0)));";
-            html += "applyColor('p_rec',    colorDelta(cp, parseFloat(d.rec_phosphorus||0)));";
-            html += "applyColor('k_rec',    colorDelta(ck, parseFloat(d.rec_potassium||0)));";
-            
-            html += "}).catch(err => {";
-            html += "  console.error('Sensor data fetch error:', err);";
-            html += "  const interactionsDiv = document.getElementById('nutrient-interactions');";
-            html += "  if(interactionsDiv) interactionsDiv.innerHTML = '<p style=\\\"color:#dc3545;\\\">❌ Ошибка загрузки данных</p>';";
-            html += "  const cropDiv = document.getElementById('crop-specific-recommendations');";
-            html += "  if(cropDiv) cropDiv.innerHTML = '<p style=\\\"color:#dc3545;\\\">❌ Ошибка загрузки данных</p>';";
-            html += "});";
-            html += "}";
-            
-            // Добавляем автоматический запуск обновления
-            html += "updateSensor();";
-            html += "setInterval(updateSensor, 5000);"; // Оптимизированный интервал
-
-
-            
-            // Функции калибровки температуры и влажности
-
-
-            // ======= ФУНКЦИИ УПРАВЛЕНИЯ КОРРЕКЦИЕЙ =======
-            html += "function loadCorrectionSettings() {";
-            html += "  fetch('/api/correction/settings')";
-            html += "    .then(response => response.json())";
-            html += "    .then(data => {";
-            html += "      if(data.success) {";
-            html += "        document.getElementById('correction_enabled').value = data.enabled ? 'true' : 'false';";
-            html += "        document.getElementById('humidity_slope').value = data.humidity_slope || 1.25;";
-            html += "        document.getElementById('humidity_offset').value = data.humidity_offset || -5.0;";
-            html += "        document.getElementById('ec_slope').value = data.ec_slope || 1.35;";
-            html += "        document.getElementById('ec_offset').value = data.ec_offset || 0.0;";
-            html += "        document.getElementById('correction-enabled-status').innerHTML = '✅ Настройки коррекции загружены';";
-            html += "        document.getElementById('correction-enabled-status').style.color = '#28a745';";
-            html += "        console.log('Calibration settings loaded:', data);";
-            html += "      } else {";
-            html += "        document.getElementById('correction-enabled-status').innerHTML = '❌ Ошибка загрузки: ' + (data.error || 'Неизвестная ошибка');";
-            html += "        document.getElementById('correction-enabled-status').style.color = '#dc3545';";
-            html += "      }";
-            html += "    })";
-            html += "    .catch(err => {";
-            html += "      console.error('Load calibration settings error:', err);";
-            html += "      document.getElementById('correction-enabled-status').innerHTML = '❌ Ошибка соединения';";
-            html += "      document.getElementById('correction-enabled-status').style.color = '#dc3545';";
-            html += "    });";
-            html += "}";
-
-            html += "function updateCorrectionEnabled() {";
-            html += "  const enabled = document.getElementById('correction_enabled').value === 'true';";
-            html += "  fetch('/api/correction/enable', {";
-            html += "    method: 'POST',";
-            html += "    headers: {'Content-Type': 'application/json'},";
-            html += "    body: JSON.stringify({enabled: enabled})";
-            html += "  }).then(response => response.json())";
-            html += "    .then(data => {";
-            html += "      if(data.success) {";
-            html += "        const status = enabled ? 'включена' : 'отключена';";
-            html += "        document.getElementById('correction-enabled-status').innerHTML = '✅ Коррекция ' + status;";
-            html += "        document.getElementById('correction-enabled-status').style.color = '#28a745';";
-            html += "        console.log('Correction enabled updated:', data);";
-            html += "      } else {";
-            html += "        document.getElementById('correction-enabled-status').innerHTML = '❌ Ошибка: ' + (data.error || 'Неизвестная ошибка');";
-            html += "        document.getElementById('correction-enabled-status').style.color = '#dc3545';";
-            html += "      }";
-            html += "    })";
-            html += "    .catch(err => {";
-            html += "      console.error('Update calibration enabled error:', err);";
-            html += "      document.getElementById('correction-enabled-status').innerHTML = '❌ Ошибка соединения';";
-            html += "      document.getElementById('correction-enabled-status').style.color = '#dc3545';";
-            html += "    });";
-            html += "}";
-
-            html += "function updateCorrectionFactors() {";
-            html += "  const humidity_slope = parseFloat(document.getElementById('humidity_slope').value);";
-            html += "  const humidity_offset = parseFloat(document.getElementById('humidity_offset').value);";
-            html += "  const ec_slope = parseFloat(document.getElementById('ec_slope').value);";
-            html += "  const ec_offset = parseFloat(document.getElementById('ec_offset').value);";
-            html += "  if(isNaN(humidity_slope) || isNaN(humidity_offset) || isNaN(ec_slope) || isNaN(ec_offset)) {";
-            html += "    alert('⚠️ Введите корректные числовые значения');";
-            html += "    return;";
-            html += "  }";
-            html += "  if(humidity_slope < 0.1 || humidity_slope > 3.0) {";
-            html += "    alert('⚠️ Коэффициент влажности должен быть в диапазоне 0.1-3.0');";
-            html += "    return;";
-            html += "  }";
-            html += "  if(humidity_offset < -20 || humidity_offset > 20) {";
-            html += "    alert('⚠️ Смещение влажности должно быть в диапазоне -20 до +20%');";
-            html += "    return;";
-            html += "  }";
-            html += "  if(ec_slope < 0.1 || ec_slope > 3.0) {";
-            html += "    alert('⚠️ Коэффициент EC должен быть в диапазоне 0.1-3.0');";
-            html += "    return;";
-            html += "  }";
-            html += "  if(ec_offset < -1000 || ec_offset > 1000) {";
-            html += "    alert('⚠️ Смещение EC должно быть в диапазоне -1000 до +1000');";
-            html += "    return;";
-            html += "  }";
-            html += "  fetch('/api/correction/factors', {";
-            html += "    method: 'POST',";
-            html += "    headers: {'Content-Type': 'application/json'},";
-            html += "    body: JSON.stringify({";
-            html += "      humidity_slope: humidity_slope,";
-            html += "      humidity_offset: humidity_offset,";
-            html += "      ec_slope: ec_slope,";
-            html += "      ec_offset: ec_offset";
-            html += "    })";
-            html += "  }).then(response => response.json())";
-            html += "    .then(data => {";
-            html += "      if(data.success) {";
-            html += "        document.getElementById('correction-factors-status').innerHTML = '✅ Коэффициенты коррекции обновлены';";
-            html += "        document.getElementById('correction-factors-status').style.color = '#28a745';";
-            html += "        console.log('Correction factors updated:', data);";
-            html += "      } else {";
-            html += "        document.getElementById('correction-factors-status').innerHTML = '❌ Ошибка: ' + (data.error || 'Неизвестная ошибка');";
-            html += "        document.getElementById('correction-factors-status').style.color = '#dc3545';";
-            html += "      }";
-            html += "    })";
-            html += "    .catch(err => {";
-            html += "      console.error('Update calibration factors error:', err);";
-            html += "      document.getElementById('correction-factors-status').innerHTML = '❌ Ошибка соединения';";
-            html += "      document.getElementById('correction-factors-status').style.color = '#dc3545';";
-            html += "    });";
-            html += "}";
-
-            html += "function resetCorrectionToDefaults() {";
-            html += "  if(confirm('⚠️ Сбросить коэффициенты коррекции к заводским настройкам?\\n\\nЗаводские коэффициенты:\\n• Влажность: 1.25x -5%\\n• EC: 1.35x\\n• Температура: 1.0x')) {";
-            html += "    fetch('/api/correction/reset', {method: 'POST'})";
-            html += "      .then(response => response.json())";
-            html += "      .then(data => {";
-            html += "        if(data.success) {";
-            html += "          loadCorrectionSettings();";
-            html += "          alert('✅ Коэффициенты коррекции сброшены к заводским настройкам');";
-            html += "        } else {";
-            html += "          alert('❌ Ошибка сброса: ' + (data.error || 'Неизвестная ошибка'));";
-            html += "        }";
-            html += "      })";
-            html += "      .catch(err => {";
-            html += "        console.error('Reset correction error:', err);";
-            html += "        alert('❌ Ошибка соединения');";
-            html += "      });";
-            html += "  }";
-            html += "}";
-
-            // УДАЛЕНО: Дублированный setInterval - оставляем только один
-            html += "updateSensor();";
-            html += "loadCorrectionSettings();";
-            html += "</script>";
-
-            // API-ссылка внизу страницы
-            html += "<div style='margin-top:15px;font-size:14px;color:#555'><b>API:</b> <a href='" +
-                    String(API_SENSOR) + "' target='_blank'>" + String(API_SENSOR) + "</a> (JSON, +timestamp)</div>";
-
-            html += generatePageFooter();
-            webServer.send(200, "text/html; charset=utf-8", html);
-        });
+// FNV-1a, как hashEtagBytes(), но во время компиляции; завершающий ноль разделяет соседние тексты
+constexpr uint32_t hashCatalogueByte(uint32_t hash, uint8_t byte)
+{
+    return (hash ^ byte) * 16777619U;
+}
+
+constexpr uint32_t hashCatalogueText(uint32_t hash, const char* text)
+{
+    for (; *text != '\0'; ++text)
+    {
+        hash = hashCatalogueByte(hash, static_cast<uint8_t>(*text));
+    }
+    return hashCatalogueByte(hash, 0);
+}
+
+// Хэш всего, что попадает в ответ каталога: названия уровней, уровни и тексты кодов, тексты культур
+constexpr uint32_t adviceCatalogueHash()
+{
+    uint32_t hash = ETAG_HASH_SEED;
+    for (const char* name : Advice::SEVERITY_NAMES)
+    {
+        hash = hashCatalogueText(hash, name);
+    }
+    for (const Advice::CodeText& entry : Advice::ADVICE_TEXTS)
+    {
+        hash = hashCatalogueByte(hash, static_cast<uint8_t>(entry.severity));
+        hash = hashCatalogueText(hash, entry.text);
+    }
+    for (const CropRules::MessageText& message : CropRules::MESSAGE_TEXTS)
+    {
+        hash = hashCatalogueText(hash, message.text);
+    }
+    return hash;
+}
+constexpr uint32_t ADVICE_CATALOGUE_HASH = adviceCatalogueHash();
+
+// Каталог кодов для interaction_codes и crop_codes: индекс массива - код.
+// {"severities":[...],"advice":[[уровень,"текст"],...],"crop":["текст",...]}
+// Тексты во flash: ответ потоковый, без сборки String. Тег - хэш содержимого каталога без соли
+// загрузки: переживает перезагрузку и меняется только вместе с текстами в прошивке
+void sendAdviceCatalogue()
+{
+    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
+    EtagBuffer etag;
+    snprintf(etag.data(), etag.size(), "\"a%08lx\"", static_cast<unsigned long>(ADVICE_CATALOGUE_HASH));
+    if (sendNotModifiedIfMatch(etag.data()))
+    {
+        return;
+    }
+
+    ChunkedPageWriter writer(webServer);
+    writer.begin(HTTP_OK, HTTP_CONTENT_TYPE_JSON);
+    writer << R"({"severities":[)";
+    const char* separator = "\"";
+    for (const char* name : Advice::SEVERITY_NAMES)
+    {
+        writer << separator << name;
+        separator = "\",\"";
+    }
+    writer << R"("],"advice":[)";
+    separator = "[";
+    for (const Advice::CodeText& entry : Advice::ADVICE_TEXTS)
+    {
+        const char severity[] = {static_cast<char>('0' + static_cast<uint8_t>(entry.severity)), ',', '"', '\0'};
+        writer << separator << severity << entry.text << "\"]";
+        separator = ",[";
+    }
+    writer << R"(],"crop":[)";
+    separator = "\"";
+    for (const CropRules::MessageText& message : CropRules::MESSAGE_TEXTS)
+    {
+        writer << separator << message.text;
+        separator = "\",\"";
+    }
+    writer << "\"]}";
+    writer.end();
+}
+}  // namespace
+
+const String& getCachedSensorJson()
+{
+    ensureCropIdSet();
+
+    // Повторные опросы, несколько открытых панелей и поток событий получают готовые байты без пересчёта
+    const uint32_t generation = getSensorDataGeneration();
+    const uint32_t configHash = getSensorJsonConfigHash();
+    if (!sensorJsonCache.filled || sensorJsonCache.generation != generation ||
+        sensorJsonCache.configHash != configHash)
+    {
+        sensorJsonCache.json = buildSensorJson(FIELDS_ALL);
+        sensorJsonCache.generation = generation;
+        sensorJsonCache.configHash = configHash;
+        sensorJsonCache.filled = true;
+        logDebugSafe("JSON API: ответ пересобран (поколение %lu)", static_cast<unsigned long>(generation));
+    }
+    return sensorJsonCache.json;
+}
+
+void sendSensorJson()  // ✅ Убираем static - функция extern в header
+{
+    // unified JSON response for sensor data
+    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
+    if (currentWiFiMode != WiFiMode::STA)
+    {
+        webServer.send(HTTP_FORBIDDEN, HTTP_CONTENT_TYPE_JSON, R"({"error":"AP mode"})");
+        return;
+    }
+
+    // Тег известен до сериализации: неизменившиеся показания отдаются как 304 без сборки JSON
+    ensureCropIdSet();
+    EtagBuffer etag;
+    makeGenerationEtag(getSensorDataGeneration(), getSensorJsonConfigHash(), etag);
+    if (sendNotModifiedIfMatch(etag.data()))
+    {
+        return;
+    }
+
+    webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, getCachedSensorJson());
+}
+
+void sendSensorJsonV2()
+{
+    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
+    if (currentWiFiMode != WiFiMode::STA)
+    {
+        webServer.send(HTTP_FORBIDDEN, HTTP_CONTENT_TYPE_JSON, R"({"error":"AP mode"})");
+        return;
+    }
+
+    uint32_t fields = FIELDS_ALL;
+    if (webServer.hasArg("fields"))
+    {
+        std::array<char, 32> unknownField{};
+        if (!parseSensorFields(webServer.arg("fields"), fields, unknownField))
+        {
+            std::array<char, 96> error{};
+            snprintf(error.data(), error.size(), R"({"error":"unknown field","field":"%s"})", unknownField.data());
+            webServer.send(HTTP_BAD_REQUEST, HTTP_CONTENT_TYPE_JSON, error.data());
+            return;
+        }
+    }
+    if (webServer.arg("text") == "0")
+    {
+        fields &= ~FIELDS_TEXT;
+    }
+
+    // Набор полей входит в тег: у разных проекций одного показания разные теги
+    ensureCropIdSet();
+    EtagBuffer etag;
+    makeGenerationEtag(getSensorDataGeneration(), hashEtagBytes(getSensorJsonConfigHash(), &fields, sizeof(fields)),
+                       etag);
+    if (sendNotModifiedIfMatch(etag.data()))
+    {
+        return;
+    }
+
+    // Полный набор совпадает с /sensor_json - берём его из общего кэша
+    if (fields == FIELDS_ALL)
+    {
+        webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, getCachedSensorJson());
+        return;
+    }
+    webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, buildSensorJson(fields));
+}
+
+void setupDataRoutes()
+{
+    // Страницы /readings и /calibration - разделы панели (routes_app.cpp), данные - JSON API ниже
 
     // AJAX эндпоинт для обновления показаний
     webServer.on("/sensor_json", HTTP_GET, sendSensorJson);
@@ -997,8 +1056,17 @@ void setupDataRoutes()
     // Primary API v1 endpoint
     webServer.on(API_SENSOR, HTTP_GET, sendSensorJson);
 
-    // Страница калибровки датчика
-    webServer.on("/calibration", HTTP_GET, handleCalibrationPage);
+    // API v2: проекция полей (?fields=, ?text=0)
+    webServer.on(API_V2_SENSOR, HTTP_GET, sendSensorJsonV2);
+
+    // ASM текущего показания для каждого профиля почвы - для выбора профиля
+    webServer.on(API_V2_SOILS_ASM, HTTP_GET, sendSoilAsmComparison);
+
+    // Каталог кодов рекомендаций: тексты и уровни для ?fields=codes
+    webServer.on(API_V2_ADVICE, HTTP_GET, sendAdviceCatalogue);
+
+    // Все культуры базы по близости к текущему показанию (?limit=N - первые N)
+    webServer.on(API_V2_CROPS_RANK, HTTP_GET, sendCropRanking);
 
     // Загрузка калибровочного CSV через вкладку
     webServer.on("/readings/upload", HTTP_POST, []() {}, handleReadingsUpload);
@@ -0,0 +1,157 @@
+/**
+ * @file routes_events.cpp
+ * @brief Поток показаний через Server-Sent Events
+ * @details Страница показаний открывает EventSource на API_EVENTS и получает событие
+ *          reading при каждом новом поколении данных датчика вместо опроса
+ *          /sensor_json раз в 5 секунд. Кадр - тот же JSON, что отдаёт /sensor_json,
+ *          собранный один раз на поколение и разосланный всем потокам. Число потоков
+ *          ограничено SSE_MAX_CLIENTS; в паузах между показаниями отправляется
+ *          комментарий-пинг, по ошибке записи которого обрываются мёртвые соединения.
+ *          Запись не блокирует цикл: кадр уходит, только если помещается в окно TCP.
+ */
+
+#include <array>
+#include "../../include/jxct_constants.h"
+#include "../../include/logger.h"
+#include "../../include/web_routes.h"
+#include "../modbus_sensor.h"
+#include "../wifi_manager.h"
+
+namespace
+{
+struct EventStream
+{
+    WiFiClient client;
+    unsigned long lastSendMs = 0;
+    uint32_t generation = 0;  // Последнее отправленное поколение показаний
+};
+
+// Сокет остаётся открытым, пока жива копия WiFiClient: WebServer отпускает свою после ответа
+std::array<EventStream, SSE_MAX_CLIENTS> eventStreams;
+
+// Кадр пишется, только если целиком помещается в окно отправки TCP: write() на заполненном окне
+// ждёт подтверждений клиента, а вызывающий держит блокировку веб-сервера. Не поместившийся кадр
+// пропускается до следующего цикла; поток, окно которого не освобождается SSE_STALL_TIMEOUT_MS,
+// закрывается
+bool writeFrame(EventStream& stream, const String& frame)
+{
+    if (stream.client.availableForWrite() < static_cast<int>(frame.length()))
+    {
+        if (millis() - stream.lastSendMs >= SSE_STALL_TIMEOUT_MS)
+        {
+            logWarnSafe("SSE: поток %s не принимает данные, закрыт", stream.client.remoteIP().toString().c_str());
+            stream.client.stop();
+        }
+        return false;
+    }
+
+    const size_t written = stream.client.write(reinterpret_cast<const uint8_t*>(frame.c_str()), frame.length());
+    if (written != frame.length())
+    {
+        stream.client.stop();
+        return false;
+    }
+    stream.lastSendMs = millis();
+    return true;
+}
+
+String buildReadingFrame(uint32_t generation)
+{
+    const String& json = getCachedSensorJson();
+    String frame;
+    frame.reserve(json.length() + 40);
+    frame += "event: reading\nid: ";
+    frame += String(generation);
+    frame += "\ndata: ";
+    frame += json;  // serializeJson() пишет JSON в одну строку - кадр не нужно разбивать
+    frame += "\n\n";
+    return frame;
+}
+
+EventStream* findFreeStream()
+{
+    for (EventStream& stream : eventStreams)
+    {
+        if (!stream.client.connected())
+        {
+            return &stream;
+        }
+    }
+    return nullptr;
+}
+
+void handleEventStream()
+{
+    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
+    if (currentWiFiMode != WiFiMode::STA)
+    {
+        webServer.send(HTTP_FORBIDDEN, HTTP_CONTENT_TYPE_JSON, R"({"error":"AP mode"})");
+        return;
+    }
+
+    EventStream* stream = findFreeStream();
+    if (stream == nullptr)
+    {
+        // EventSource закроется, страница перейдёт на опрос /sensor_json
+        logWarnSafe("SSE: достигнут лимит потоков (%u)", static_cast<unsigned>(SSE_MAX_CLIENTS));
+        webServer.send(HTTP_SERVICE_UNAVAILABLE, HTTP_CONTENT_TYPE_JSON, R"({"error":"too many event streams"})");
+        return;
+    }
+
+    stream->client = webServer.client();
+    stream->client.setNoDelay(true);
+    stream->client.print(
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/event-stream\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Connection: keep-alive\r\n\r\n");
+
+    // Текущее показание сразу, чтобы страница не ждала следующего цикла датчика;
+    // не поместившийся в окно кадр дошлёт handleSensorEvents()
+    const uint32_t generation = getSensorDataGeneration();
+    stream->generation = generation - 1U;  // Заведомо не текущее
+    stream->lastSendMs = millis();
+    if (writeFrame(*stream, "retry: " + String(SSE_RETRY_MS) + "\n\n" + buildReadingFrame(generation)))
+    {
+        stream->generation = generation;
+    }
+    logDebugSafe("SSE: поток открыт для %s", stream->client.remoteIP().toString().c_str());
+}
+}  // namespace
+
+void setupEventRoutes()
+{
+    logDebug("Настройка маршрута потока событий");
+    webServer.on(API_EVENTS, HTTP_GET, handleEventStream);
+}
+
+void handleSensorEvents()
+{
+    const unsigned long now = millis();
+    const uint32_t generation = getSensorDataGeneration();
+
+    String frame;
+    for (EventStream& stream : eventStreams)
+    {
+        if (!stream.client.connected())
+        {
+            continue;
+        }
+
+        if (stream.generation != generation)
+        {
+            if (frame.length() == 0)
+            {
+                frame = buildReadingFrame(generation);  // Один раз на все потоки
+            }
+            if (writeFrame(stream, frame))
+            {
+                stream.generation = generation;  // Иначе поколение уйдёт в следующем цикле
+            }
+        }
+        else if (now - stream.lastSendMs >= SSE_KEEPALIVE_INTERVAL_MS)
+        {
+            writeFrame(stream, ": ping\n\n");
+        }
+    }
+}
@@ -64,6 +64,13 @@ void setupMainRoutes()
                         return;
                     }
                 }
+                const ValidationResult fingerprintRes = validateTlsFingerprint(webServer.arg("uplink_tls_fp"));
+                if (!fingerprintRes.isValid)
+                {
+                    const String html = generateErrorPage(HTTP_BAD_REQUEST, fingerprintRes.message);
+                    webServer.send(HTTP_BAD_REQUEST, HTTP_CONTENT_TYPE_HTML, html);
+                    return;
+                }
             }
 
             // Сохранение настроек в конфигурацию
@@ -85,6 +92,22 @@ void setupMainRoutes()
                 config.mqttQos = webServer.arg("mqtt_qos").toInt();
                 strlcpy(config.thingSpeakChannelId, webServer.arg("ts_channel_id").c_str(),
                         sizeof(config.thingSpeakChannelId));
+                config.flags.influxEnabled = static_cast<uint8_t>(webServer.hasArg("influx_enabled"));
+                strlcpy(config.influxUrl, webServer.arg("influx_url").c_str(), sizeof(config.influxUrl));
+                // Токен не выводится в форму: пустое поле оставляет сохранённый, флажок удаляет его
+                if (webServer.hasArg("influx_token_clear"))
+                {
+                    config.influxToken[0] = '\0';
+                }
+                else if (webServer.arg("influx_token").length() > 0)
+                {
+                    strlcpy(config.influxToken, webServer.arg("influx_token").c_str(), sizeof(config.influxToken));
+                }
+                config.flags.httpJsonEnabled = static_cast<uint8_t>(webServer.hasArg("http_json_enabled"));
+                strlcpy(config.httpJsonUrl, webServer.arg("http_json_url").c_str(), sizeof(config.httpJsonUrl));
+                strlcpy(config.uplinkTlsFingerprint, webServer.arg("uplink_tls_fp").c_str(),
+                        sizeof(config.uplinkTlsFingerprint));
+                config.flags.uplinkTlsInsecure = static_cast<uint8_t>(webServer.hasArg("uplink_tls_insecure"));
                 config.flags.useRealSensor = static_cast<uint8_t>(webServer.hasArg("real_sensor"));
                 config.flags.compensationEnabled = static_cast<uint8_t>(webServer.hasArg("comp_enabled"));
                 // Тип среды выращивания v3.12.0 (расширенный)
@@ -182,18 +205,18 @@ void handleRoot()
         "<!DOCTYPE html><html><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width, "
         "initial-scale=1.0'>";
     html += "<title>" UI_ICON_CONFIG " Настройки JXCT</title>";
-    html += "<style>" + String(getUnifiedCSS()) + "</style></head><body><div class='container'>";
+    html += String(getStylesheetHTML()) + "</head><body><div class='container'>";
     html += navHtml();
     html += "<h1>" UI_ICON_CONFIG " Настройки JXCT</h1>";
     html += "<form action='/save' method='post'>";
     html += getCSRFHiddenField();  // Добавляем CSRF токен
     html += "<div class='section'><h2>WiFi настройки</h2>";
     html += "<div class='form-group'><label for='ssid'>SSID:</label><input type='text' id='ssid' name='ssid' value='" +
-            String(config.ssid) + "' required></div>";
+            htmlAttrEscape(config.ssid) + "' required></div>";
     html +=
         "<div class='form-group'><label for='password'>Пароль:</label><input type='password' id='password' "
         "name='password' value='" +
-        String(config.password) + "' required></div></div>";
+        htmlAttrEscape(config.password) + "' required></div></div>";
 
     // Показываем остальные настройки только в режиме STA
     if (currentWiFiMode == WiFiMode::STA)
@@ -207,7 +230,7 @@ void handleRoot()
         html +=
             "<div class='form-group'><label for='mqtt_server'>MQTT сервер:</label><input type='text' id='mqtt_server' "
             "name='mqtt_server' value='" +
-            String(config.mqttServer) + "'" + (config.flags.mqttEnabled ? " required" : "") + "></div>";
+            htmlAttrEscape(config.mqttServer) + "'" + (config.flags.mqttEnabled ? " required" : "") + "></div>";
         html +=
             "<div class='form-group'><label for='mqtt_port'>MQTT порт:</label><input type='text' id='mqtt_port' "
             "name='mqtt_port' value='" +
@@ -215,11 +238,11 @@ void handleRoot()
         html +=
             "<div class='form-group'><label for='mqtt_user'>MQTT пользователь:</label><input type='text' "
             "id='mqtt_user' name='mqtt_user' value='" +
-            String(config.mqttUser) + "'></div>";
+            htmlAttrEscape(config.mqttUser) + "'></div>";
         html +=
             "<div class='form-group'><label for='mqtt_password'>MQTT пароль:</label><input type='password' "
             "id='mqtt_password' name='mqtt_password' value='" +
-            String(config.mqttPassword) + "'></div>";
+            htmlAttrEscape(config.mqttPassword) + "'></div>";
         const String hassChecked = config.flags.hassEnabled ? " checked" : "";
         html +=
             "<div class='form-group'><label for='hass_enabled'>Интеграция с Home Assistant:</label><input "
@@ -234,14 +257,57 @@ void handleRoot()
         html +=
             "<div class='form-group'><label for='ts_api_key'>API ключ:</label><input type='text' id='ts_api_key' "
             "name='ts_api_key' value='" +
-            String(config.thingSpeakApiKey) + "'" + (config.flags.thingSpeakEnabled ? " required" : "") + "></div>";
+            htmlAttrEscape(config.thingSpeakApiKey) + "'" + (config.flags.thingSpeakEnabled ? " required" : "") +
+            "></div>";
         html +=
             "<div class='form-group'><label for='ts_channel_id'>Channel ID:</label><input type='text' "
             "id='ts_channel_id' name='ts_channel_id' value='" +
-            String(config.thingSpeakChannelId) + "'></div>";
+            htmlAttrEscape(config.thingSpeakChannelId) + "'></div>";
         html +=
             "<div style='color:#888;font-size:13px'>💡 Интервал публикации настраивается в разделе <a "
             "href='/intervals' style='color:#4CAF50'>Интервалы</a></div></div>";
+        const String influxChecked = config.flags.influxEnabled ? " checked" : "";
+        const String httpJsonChecked = config.flags.httpJsonEnabled ? " checked" : "";
+        html += "<div class='section'><h2>Дополнительные выгрузки</h2>";
+        html +=
+            "<div class='form-group'><label for='influx_enabled'>InfluxDB (line protocol):</label><input "
+            "type='checkbox' id='influx_enabled' name='influx_enabled'" +
+            influxChecked + "></div>";
+        html +=
+            "<div class='form-group'><label for='influx_url'>URL записи InfluxDB:</label><input type='text' "
+            "id='influx_url' name='influx_url' placeholder='https://host/api/v2/write?org=...&bucket=...&precision=s' "
+            "value='" +
+            htmlAttrEscape(config.influxUrl) + "'></div>";
+        const char* influxTokenPlaceholder =
+            config.influxToken[0] != '\0' ? "сохранён - оставьте пустым, чтобы не менять" : "не задан";
+        html +=
+            "<div class='form-group'><label for='influx_token'>Токен InfluxDB:</label><input type='password' "
+            "id='influx_token' name='influx_token' autocomplete='new-password' placeholder='" +
+            String(influxTokenPlaceholder) + "' value=''></div>";
+        html +=
+            "<div class='form-group'><label for='influx_token_clear'>Удалить сохранённый токен:</label><input "
+            "type='checkbox' id='influx_token_clear' name='influx_token_clear'></div>";
+        html +=
+            "<div class='form-group'><label for='http_json_enabled'>HTTP JSON приёмник:</label><input "
+            "type='checkbox' id='http_json_enabled' name='http_json_enabled'" +
+            httpJsonChecked + "></div>";
+        html +=
+            "<div class='form-group'><label for='http_json_url'>URL приёмника:</label><input type='text' "
+            "id='http_json_url' name='http_json_url' value='" +
+            htmlAttrEscape(config.httpJsonUrl) + "'></div>";
+        const String tlsInsecureChecked = config.flags.uplinkTlsInsecure ? " checked" : "";
+        html +=
+            "<div class='form-group'><label for='uplink_tls_fp'>SHA-256 сертификата своего HTTPS-сервера:</label>"
+            "<input type='text' id='uplink_tls_fp' name='uplink_tls_fp' placeholder='AB:CD:... (частный CA, "
+            "самоподписанный)' value='" +
+            htmlAttrEscape(config.uplinkTlsFingerprint) + "'></div>";
+        html +=
+            "<div class='form-group'><label for='uplink_tls_insecure'>Не проверять сертификат (небезопасно):</label>"
+            "<input type='checkbox' id='uplink_tls_insecure' name='uplink_tls_insecure'" +
+            tlsInsecureChecked + "></div>";
+        html +=
+            "<div style='color:#888;font-size:13px'>💡 По умолчанию HTTPS-приёмники проверяются по встроенным "
+            "корневым CA (Let's Encrypt, Amazon, DigiCert, USERTrust)</div></div>";
         const String realSensorChecked = config.flags.useRealSensor ? " checked" : "";
         html += "<div class='section'><h2>Датчик</h2>";
         html +=
@@ -413,7 +479,7 @@ void handleRoot()
         html +=
             "<div class='form-group'><label for='ntp_server'>NTP сервер:</label><input type='text' id='ntp_server' "
             "name='ntp_server' value='" +
-            String(config.ntpServer) + "' required></div>";
+            htmlAttrEscape(config.ntpServer) + "' required></div>";
         html +=
             "<div class='form-group'><label for='ntp_interval'>Интервал обновления NTP (мс):</label><input "
             "type='number' id='ntp_interval' name='ntp_interval' min='10000' max='86400000' value='" +
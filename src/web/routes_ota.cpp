@@ -7,6 +7,7 @@
 #include "../../include/jxct_ui_system.h"
 #include "../../include/logger.h"
 #include "../../include/version.h"
+#include "../../include/web/conditional_get.h"
 #include "../../include/web_routes.h"
 #include "../wifi_manager.h"
 #include "ota_manager.h"
@@ -44,7 +45,13 @@ void setupOtaRoutes()
                          webServer.send(HTTP_FORBIDDEN, HTTP_CONTENT_TYPE_JSON, R"({"error":"unavailable"})");
                          return;
                      }
-                     triggerOtaCheck();  // уже включает handleOTA()
+                     // Уже включает handleOTA(); занятая сессия - проверка повторится из loop()
+                     if (!triggerOtaCheck())
+                     {
+                         webServer.send(HTTP_SERVICE_UNAVAILABLE, HTTP_CONTENT_TYPE_JSON,
+                                        R"({"ok":false,"error":"busy","retry":true})");
+                         return;
+                     }
                      webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, R"({"ok":true})");
                  });
 
@@ -262,8 +269,12 @@ void setupOtaRoutes()
             html += "  btn.textContent = '⏳ Проверяем...';\n";
             html += "  \n";
             html += "  fetch('/api/ota/check', {method: 'POST'})\n";
-            html += "    .then(() => {\n";
-            html += "      showToast('🔍 Проверка обновлений запущена', 'info');\n";
+            html += "    .then(r => {\n";
+            html += "      if (r.status === 503) {\n";
+            html += "        showToast('⏳ Сеть занята - проверка будет повторена автоматически', 'info');\n";
+            html += "      } else {\n";
+            html += "        showToast('🔍 Проверка обновлений запущена', 'info');\n";
+            html += "      }\n";
             html += "      isOtaActive = true;\n";
             html += "    })\n";
             html += "    .catch(e => {\n";
@@ -372,7 +383,7 @@ static void sendOtaStatusJson()
     doc["version"] = JXCT_VERSION_STRING;
     String json;
     serializeJson(doc, json);
-    webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, json);
+    sendJsonWithEtag(json);
 }
 
 // NOLINTNEXTLINE(misc-use-anonymous-namespace)
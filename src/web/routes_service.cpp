@@ -10,13 +10,14 @@
 #include "../../include/jxct_device_info.h"
 #include "../../include/jxct_format_utils.h"
 #include "../../include/jxct_strings.h"
-#include "../../include/jxct_ui_system.h"
 #include "../../include/logger.h"
+#include "../../include/web/conditional_get.h"
 #include "../../include/web/csrf_protection.h"  // 🔒 CSRF защита
 #include "../../include/web_routes.h"           // ✅ CSRF защита
 #include "../modbus_sensor.h"
 #include "../mqtt_client.h"
 #include "../thingspeak_client.h"
+#include "../uplink_sink.h"
 #include "../wifi_manager.h"
 
 // Внешние зависимости (уже объявлены в заголовочных файлах)
@@ -78,120 +79,19 @@ void setupServiceRoutes()
     webServer.on("/api/thingspeak_diagnostics", HTTP_GET, 
         []() {
             logWebRequest("GET", "/api/thingspeak_diagnostics", webServer.client().remoteIP().toString());
-            webServer.send(HTTP_OK, "application/json", getThingSpeakDiagnosticsJson());
+            sendJsonWithEtag(getThingSpeakDiagnosticsJson());
         }
     );
 
-    // Красивая страница сервисов (оригинальный дизайн)
-    webServer.on(
-        "/service", HTTP_GET,
-        []()
-        {
-            logWebRequest("GET", "/service", webServer.client().remoteIP().toString());
-
-            if (currentWiFiMode == WiFiMode::AP)
-            {
-                webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_HTML,
-                               generateApModeUnavailablePage("Сервис", UI_ICON_SERVICE));
-                return;
-            }
+    // Состояние uplink-приёмников (очередь, доставлено/потеряно, повторы)
+    webServer.on("/api/uplinks/status", HTTP_GET,
+        []() {
+            logWebRequest("GET", "/api/uplinks/status", webServer.client().remoteIP().toString());
+            sendJsonWithEtag(getUplinkSinksStatusJson());
+        }
+    );
 
-            String html = generatePageHeader("Сервис", UI_ICON_SERVICE);
-            html += navHtml();
-            html += "<h1>" UI_ICON_SERVICE " Сервис</h1>";
-            html += "<div class='info-block' id='status-block'>Загрузка статусов...</div>";
-            html += "<div class='info-block'><b>Производитель:</b> " + String(DEVICE_MANUFACTURER) +
-                    "<br><b>Модель:</b> " + String(DEVICE_MODEL) + "<br><b>Версия:</b> " + String(FIRMWARE_VERSION) +
-                    "</div>";
-            html += "<div class='section' style='margin-top:20px;'>";
-            html += "<form method='post' action='/reset' style='margin-bottom:10px'>";
-            html += getCSRFHiddenField();
-            html +=
-                generateButton(ButtonType::DANGER, ButtonConfig{UI_ICON_RESET, "Сбросить настройки", ""}) + "</form>";
-            html += "<form method='post' action='/reboot' style='margin-bottom:10px'>";
-            html += getCSRFHiddenField();
-            html += generateButton(ButtonType::SECONDARY, ButtonConfig{"🔄", "Перезагрузить", ""}) + "</form>";
-            
-            // ✅ ДОБАВЛЕНО: Кнопки управления ThingSpeak
-            if (config.flags.thingSpeakEnabled) {
-                html += "<div style='margin-top:15px;padding:10px;background:#f8f9fa;border-radius:5px;'>";
-                html += "<h3>🔗 ThingSpeak Управление</h3>";
-                html += "<form method='post' action='/reset_thingspeak' style='margin-bottom:10px'>";
-                html += getCSRFHiddenField();
-                html += generateButton(ButtonType::SECONDARY, ButtonConfig{"🔓", "Сбросить блокировку", ""}) + "</form>";
-                html += "<form method='get' action='/diagnose_thingspeak' style='margin-bottom:10px'>";
-                html += generateButton(ButtonType::PRIMARY, ButtonConfig{"🔍", "Диагностика", ""}) + "</form>";
-                html += "<button type='button' onclick='showThingSpeakDiagnostics()' class='btn btn-info' style='margin-bottom:10px'>📊 Подробная диагностика</button>";
-                html += "</div>";
-            }
-            
-            html += "</div>";
-            html +=
-                "<div class='section' style='margin-top:15px;font-size:14px;color:#555'><b>API:</b> <a "
-                "href='/service_status' target='_blank'>/service_status</a> (JSON, статусы сервисов) | <a "
-                "href='/health' target='_blank'>/health</a> (JSON, подробная диагностика)</div>";
-            html += "<script>";
-            html += "function dot(status){";
-            html += "if(status===true)return'<span class=\"status-dot dot-ok\"></span>';";
-            html += "if(status===false)return'<span class=\"status-dot dot-err\"></span>';";
-            html += "if(status==='warn')return'<span class=\"status-dot dot-warn\"></span>';";
-            html += "return'<span class=\"status-dot dot-off\"></span>';";
-            html += "}";
-            html += "function updateStatus(){fetch('/service_status').then(r=>r.json()).then(d=>{let html='';";
-            html +=
-                "html+=dot(d.wifi_connected)+'<b>WiFi:</b> '+(d.wifi_connected?'Подключено ('+d.wifi_ip+', "
-                "'+d.wifi_ssid+', RSSI '+d.wifi_rssi+' dBm)':'Не подключено')+'<br>';";
-            html +=
-                "html+=dot(d.mqtt_enabled?d.mqtt_connected:false)+'<b>MQTT:</b> "
-                "'+(d.mqtt_enabled?(d.mqtt_connected?'Подключено':'Ошибка'+(d.mqtt_last_error?' "
-                "('+d.mqtt_last_error+')':'')):'Отключено')+'<br>';";
-            html +=
-                "html+=dot(d.thingspeak_enabled?(d.thingspeak_last_error?false:true):false)+'<b>ThingSpeak:</b> "
-                "'+(d.thingspeak_enabled?(d.thingspeak_last_error?'Ошибка: "
-                "'+d.thingspeak_last_error:((d.thingspeak_last_pub && d.thingspeak_last_pub!=='0')?'Последняя "
-                "публикация: '+d.thingspeak_last_pub:'Нет публикаций')):'Отключено')+'<br>';";
-            html +=
-                "if(d.thingspeak_enabled && d.thingspeak_last_error){showToast('Ошибка ThingSpeak: "
-                "'+d.thingspeak_last_error,'error');}";
-            html +=
-                "html+=dot(d.hass_enabled)+'<b>Home Assistant:</b> '+(d.hass_enabled?'Включено':'Отключено')+'<br>';";
-            html +=
-                "html+=dot(d.sensor_ok)+'<b>Датчик:</b> '+(d.sensor_ok?'Ок':'Ошибка'+(d.sensor_last_error?' "
-                "('+d.sensor_last_error+')':''));";
-            html += "document.getElementById('status-block').innerHTML=html;";
-            html += "});}setInterval(updateStatus," + String(config.webUpdateInterval) + ");updateStatus();";
-            
-            // ✅ ДОБАВЛЕНО: JavaScript для отображения диагностики ThingSpeak
-            html += "function showThingSpeakDiagnostics() {";
-            html += "  fetch('/api/thingspeak_diagnostics')";
-            html += "    .then(response => response.json())";
-            html += "    .then(data => {";
-            html += "      let status = data.blocked ? '🔴 ЗАБЛОКИРОВАН' : (data.enabled ? '🟢 АКТИВЕН' : '⚪ ОТКЛЮЧЕН');";
-            html += "      let message = '=== ДИАГНОСТИКА THINGSPEAK ===\\n';";
-            html += "      message += 'Статус: ' + status + '\\n';";
-            html += "      message += 'WiFi: ' + (data.wifi_connected ? 'ПОДКЛЮЧЕН' : 'ОТКЛЮЧЕН') + '\\n';";
-            html += "      message += 'Данные: ' + (data.data_valid ? 'ВАЛИДНЫ' : 'НЕВАЛИДНЫ') + '\\n';";
-            html += "      message += 'Ошибок подряд: ' + data.consecutive_fail_count + '\\n';";
-            html += "      message += 'Интервал: ' + (data.interval_ms / 1000) + ' сек\\n';";
-            html += "      message += 'Последняя публикация: ' + (data.time_since_last_publish_ms / 1000) + ' сек назад\\n';";
-            html += "      if (data.blocked) {";
-            html += "        message += '🔴 БЛОКИРОВКА АКТИВНА!\\n';";
-            html += "        message += 'Осталось: ' + data.remaining_block_time_min + ' мин\\n';";
-            html += "      }";
-            html += "      if (data.last_error) {";
-            html += "        message += 'Последняя ошибка: ' + data.last_error + '\\n';";
-            html += "      }";
-            html += "      message += '==============================';";
-            html += "      alert(message);";
-            html += "    })";
-            html += "    .catch(error => {";
-            html += "      alert('Ошибка получения диагностики: ' + error);";
-            html += "    });";
-            html += "}";
-            html += "</script>";
-            html += generatePageFooter();
-            webServer.send(200, "text/html; charset=utf-8", html);
-        });
+    // Страница /service - раздел панели (routes_app.cpp), статусы отдаёт /service_status
 
     // POST обработчики для сервисных функций
     webServer.on("/reset", HTTP_POST,
@@ -398,11 +298,8 @@ static void sendHealthJson()
     webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, json);
 }
 
-// NOLINTNEXTLINE(misc-use-anonymous-namespace)
-static void sendServiceStatusJson()
+void fillServiceStatusJson(JsonObject doc)  // NOLINT(misc-use-internal-linkage)
 {
-    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
-    StaticJsonDocument<JSON_DOC_SMALL> doc;
     doc["wifi_connected"] = wifiConnected;
     doc["wifi_ip"] = WiFi.localIP().toString();
     doc["wifi_ssid"] = WiFi.SSID();
@@ -416,8 +313,16 @@ static void sendServiceStatusJson()
     doc["hass_enabled"] = static_cast<bool>(config.flags.hassEnabled);
     doc["sensor_ok"] = sensorData.valid;
     doc["sensor_last_error"] = getSensorLastError();
+}
+
+// NOLINTNEXTLINE(misc-use-anonymous-namespace)
+static void sendServiceStatusJson()
+{
+    logWebRequest("GET", webServer.uri(), webServer.client().remoteIP().toString());
+    StaticJsonDocument<JSON_DOC_SMALL> doc;
+    fillServiceStatusJson(doc.to<JsonObject>());
 
     String json;
     serializeJson(doc, json);
-    webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, json);
+    sendJsonWithEtag(json);
 }
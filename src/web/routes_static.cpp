@@ -0,0 +1,67 @@
+/**
+ * @file routes_static.cpp
+ * @brief Статические ресурсы веб-интерфейса из flash
+ * @details CSS и JS (включая скрипт панели app.js) сжимаются gzip при сборке и отдаются без копирования в кучу.
+ *          Страницы ссылаются на URL с хэшем содержимого (?v=<etag>), поэтому
+ *          браузер кэширует ресурс как immutable и загружает его один раз на
+ *          версию прошивки; повторная проверка получает 304 без тела.
+ */
+
+#include "../../include/jxct_constants.h"
+#include "../../include/logger.h"
+#include "../../include/web/conditional_get.h"
+#include "../../include/web_assets_generated.h"
+#include "../../include/web_routes.h"
+
+namespace
+{
+struct StaticAsset
+{
+    const char* path;
+    const char* mime;
+    const char* etag;
+    const uint8_t* data;
+    size_t length;
+};
+
+const StaticAsset STATIC_ASSETS[] = {
+    {WEB_ASSET_UI_CSS_PATH, WEB_ASSET_UI_CSS_MIME, WEB_ASSET_UI_CSS_ETAG, WEB_ASSET_UI_CSS_GZ, WEB_ASSET_UI_CSS_GZ_LEN},
+    {WEB_ASSET_UI_JS_PATH, WEB_ASSET_UI_JS_MIME, WEB_ASSET_UI_JS_ETAG, WEB_ASSET_UI_JS_GZ, WEB_ASSET_UI_JS_GZ_LEN},
+    {WEB_ASSET_APP_JS_PATH, WEB_ASSET_APP_JS_MIME, WEB_ASSET_APP_JS_ETAG, WEB_ASSET_APP_JS_GZ, WEB_ASSET_APP_JS_GZ_LEN},
+};
+
+// Не const: WebServer::collectHeaders() принимает const char*[]
+const char* collectedHeaders[] = {"If-None-Match", "X-CSRF-Token"};
+
+void sendStaticAsset(const StaticAsset& asset)
+{
+    webServer.sendHeader("ETag", asset.etag);
+    webServer.sendHeader("Cache-Control", HTTP_CACHE_IMMUTABLE);
+
+    if (webServer.hasHeader("If-None-Match") && etagMatches(webServer.header("If-None-Match"), asset.etag))
+    {
+        webServer.send(HTTP_NOT_MODIFIED);
+        return;
+    }
+
+    webServer.sendHeader("Content-Encoding", "gzip");
+    webServer.send_P(HTTP_OK, asset.mime, reinterpret_cast<const char*>(asset.data), asset.length);
+}
+}  // namespace
+
+void collectWebRequestHeaders()
+{
+    webServer.collectHeaders(collectedHeaders, sizeof(collectedHeaders) / sizeof(collectedHeaders[0]));
+}
+
+void setupStaticRoutes()
+{
+    logDebug("Настройка маршрутов статических ресурсов");
+
+    for (const StaticAsset& asset : STATIC_ASSETS)
+    {
+        webServer.on(asset.path, HTTP_GET, [&asset]() { sendStaticAsset(asset); });
+    }
+
+    logDebug("Статические ресурсы: /static/ui.css, /static/ui.js, /static/app.js (gzip, immutable)");
+}
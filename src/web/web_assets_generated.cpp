@@ -0,0 +1,711 @@
+// Auto-generated. DO NOT EDIT MANUALLY.
+// Generated by scripts/build_web_assets.py from src/web/assets/
+
+#include "web_assets_generated.h"
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+const uint8_t WEB_ASSET_UI_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x57, 0x5b, 0x8b, 0xdb, 0x38,
+    0x14, 0xfe, 0x2b, 0x86, 0xa1, 0x74, 0xb2, 0xc4, 0xc6, 0x97, 0xd8, 0xc9, 0xd8, 0x14, 0x7a, 0x81,
+    0x81, 0x7d, 0xd8, 0xa7, 0x52, 0xd8, 0x65, 0xe9, 0x83, 0x6c, 0xc9, 0x89, 0x18, 0x59, 0x32, 0x92,
+    0xd2, 0x24, 0x35, 0xfe, 0xef, 0xab, 0x8b, 0xed, 0x58, 0x8e, 0x4b, 0x77, 0x0c, 0x83, 0x2d, 0x1d,
+    0x7d, 0xe7, 0xf6, 0x9d, 0xa3, 0x93, 0x3f, 0xba, 0x92, 0x5d, 0x7d, 0x81, 0x7f, 0x62, 0x7a, 0xcc,
+    0x4b, 0xc6, 0x21, 0xe2, 0xbe, 0x5a, 0xe9, 0x4b, 0x06, 0x6f, 0x5d, 0xcd, 0xa8, 0xf4, 0x6b, 0xd0,
+    0x60, 0x72, 0xcb, 0x3f, 0x71, 0x0c, 0xc8, 0xd6, 0x07, 0x6d, 0x4b, 0x90, 0x2f, 0x6e, 0x42, 0xa2,
+    0x66, 0xfb, 0x99, 0x60, 0xfa, 0xf6, 0x17, 0xa8, 0xbe, 0x9a, 0xcf, 0x57, 0x25, 0xbd, 0x7d, 0xff,
+    0x15, 0x1d, 0x19, 0xf2, 0xbe, 0xfd, 0xf9, 0x7e, 0x2b, 0x00, 0x15, 0xbe, 0x40, 0x1c, 0xd7, 0x45,
+    0x03, 0xf8, 0x11, 0xd3, 0x3c, 0x2c, 0x5a, 0x00, 0xa1, 0xd6, 0x14, 0x87, 0xed, 0xb5, 0x28, 0x41,
+    0xf5, 0x76, 0xe4, 0xec, 0x4c, 0x61, 0xfe, 0x54, 0xa7, 0xfa, 0x29, 0x2a, 0x46, 0x18, 0xcf, 0x9f,
+    0x92, 0x24, 0x29, 0x8c, 0x72, 0x65, 0x18, 0xca, 0xa3, 0x4c, 0x09, 0x2b, 0x55, 0xc8, 0x3f, 0x21,
+    0x7c, 0x3c, 0xc9, 0x3c, 0x0a, 0xd2, 0x3e, 0xa8, 0xd4, 0x3e, 0x50, 0x8b, 0xbc, 0x6b, 0xc0, 0xd5,
+    0xbf, 0x60, 0x28, 0x4f, 0x79, 0x14, 0x86, 0x1a, 0x78, 0x54, 0xe7, 0x81, 0xb3, 0x64, 0x73, 0x35,
+    0x97, 0x13, 0x96, 0xa8, 0x18, 0xdc, 0xe4, 0x00, 0xe2, 0xb3, 0xc8, 0x35, 0xb8, 0x89, 0xc1, 0x09,
+    0x40, 0x76, 0x51, 0x87, 0xe2, 0xf6, 0xea, 0x45, 0x0a, 0xc6, 0xe3, 0xc7, 0x12, 0x3c, 0x87, 0x5b,
+    0xf3, 0x04, 0xd1, 0x66, 0x32, 0x3e, 0x51, 0x9b, 0xfd, 0x29, 0xea, 0x56, 0x8d, 0x8d, 0xe3, 0xb9,
+    0x01, 0x0a, 0x4d, 0x23, 0x85, 0x56, 0xe0, 0x62, 0xcd, 0xcf, 0xc2, 0xb0, 0x3f, 0xc5, 0xeb, 0xc7,
+    0xa3, 0xc3, 0xfd, 0xb8, 0x3d, 0xea, 0x45, 0xf1, 0x03, 0x42, 0x1a, 0x86, 0xc5, 0x94, 0x2c, 0x29,
+    0x59, 0x93, 0x6b, 0x19, 0xc1, 0x08, 0x86, 0xde, 0xd3, 0xee, 0xcb, 0xa7, 0xd7, 0x74, 0x0a, 0xf5,
+    0x28, 0xa0, 0xdc, 0xec, 0x03, 0x0a, 0x7e, 0x74, 0x16, 0x7c, 0x5c, 0xd6, 0xbe, 0x4c, 0x8e, 0x45,
+    0xd6, 0x56, 0x17, 0x39, 0xba, 0x23, 0x43, 0x08, 0x0b, 0x13, 0x42, 0x5f, 0xb4, 0xa0, 0x42, 0x39,
+    0x65, 0x17, 0x0e, 0xda, 0x82, 0xfd, 0x40, 0xbc, 0x26, 0xec, 0xe2, 0x5f, 0x73, 0x13, 0x70, 0x88,
+    0x45, 0x4b, 0xc0, 0x2d, 0xaf, 0x09, 0xba, 0x16, 0xfa, 0x9f, 0xaf, 0xc5, 0x46, 0xe9, 0xa3, 0x7a,
+    0x4d, 0x07, 0x63, 0x3c, 0xd0, 0x8d, 0xc2, 0x98, 0x9a, 0x0c, 0x97, 0x84, 0x55, 0x6f, 0x85, 0x44,
+    0x57, 0xe9, 0x43, 0x54, 0x31, 0x0e, 0x24, 0x66, 0x54, 0x1d, 0xa5, 0x68, 0xe4, 0xc6, 0xe0, 0xde,
+    0x22, 0xa0, 0xf3, 0x10, 0xee, 0x66, 0x2e, 0x1d, 0x74, 0x32, 0x63, 0x93, 0xe2, 0x79, 0xd2, 0xb5,
+    0x88, 0xe4, 0x8a, 0xa0, 0xd8, 0xe0, 0x87, 0x41, 0x2c, 0x3c, 0x04, 0x04, 0x5a, 0x73, 0xcf, 0x78,
+    0x20, 0x4e, 0x5c, 0x71, 0x3d, 0x0f, 0x07, 0xb3, 0xf3, 0x93, 0x76, 0xba, 0x9b, 0x33, 0x78, 0xb0,
+    0xcb, 0x5a, 0x69, 0x89, 0x66, 0x34, 0xd4, 0x8c, 0x37, 0xb9, 0x79, 0x23, 0x40, 0xa2, 0x7f, 0x9e,
+    0x7d, 0x15, 0xd0, 0x4d, 0x1f, 0x08, 0x54, 0x69, 0xd5, 0x8b, 0x74, 0xc4, 0xe9, 0x3c, 0x1d, 0xe9,
+    0x64, 0xf7, 0x32, 0x0b, 0x2b, 0x14, 0x9e, 0x17, 0x13, 0xd0, 0x4f, 0x1f, 0x68, 0xd5, 0xbe, 0x5e,
+    0x6c, 0x97, 0x6a, 0x34, 0x83, 0x09, 0x28, 0x11, 0x99, 0xe2, 0x6f, 0x03, 0xef, 0x8a, 0x69, 0xdc,
+    0x65, 0x9c, 0xef, 0xac, 0xed, 0x31, 0x6d, 0xcf, 0xf2, 0x5f, 0x79, 0x6b, 0xd1, 0x07, 0x9d, 0xb0,
+    0xef, 0xdb, 0xd9, 0x42, 0x0b, 0x84, 0xb8, 0x28, 0x23, 0x9d, 0x45, 0x7a, 0x6e, 0x4a, 0xc4, 0x9d,
+    0x25, 0xd4, 0x00, 0x4c, 0x9c, 0x95, 0x1a, 0x13, 0xf4, 0x7d, 0x2b, 0x10, 0x51, 0x01, 0xda, 0x6a,
+    0x5c, 0xc0, 0x11, 0xe8, 0xa6, 0xfa, 0x7e, 0xe7, 0xb0, 0x75, 0x0c, 0x4f, 0xfc, 0xbb, 0xf0, 0x2c,
+    0xba, 0xc9, 0x5a, 0xee, 0xad, 0x3f, 0x79, 0xcd, 0xaa, 0xb3, 0x18, 0xf4, 0x0f, 0x1f, 0xa3, 0x15,
+    0xf6, 0xb3, 0x63, 0x67, 0xa9, 0xb9, 0x6a, 0x59, 0x39, 0xa8, 0x72, 0xc9, 0xe9, 0xf4, 0x13, 0xfd,
+    0x24, 0x63, 0x3b, 0xd9, 0x67, 0xdb, 0x68, 0x9f, 0x6e, 0x0f, 0xb6, 0xa5, 0xf4, 0x41, 0x29, 0xe9,
+    0x7a, 0x09, 0x38, 0x04, 0xce, 0xee, 0x9e, 0xce, 0x95, 0xae, 0xfb, 0xb7, 0x5b, 0x64, 0x4d, 0x37,
+    0x8b, 0xea, 0xcc, 0x85, 0xb2, 0xaf, 0x65, 0x98, 0x4a, 0xc4, 0xd7, 0xeb, 0xcb, 0x89, 0x49, 0x32,
+    0xd4, 0xc3, 0x40, 0x08, 0x6e, 0xfb, 0xee, 0xbd, 0xb9, 0x4e, 0xdd, 0xc1, 0x2c, 0xa9, 0xef, 0x21,
+    0x41, 0xa6, 0xb1, 0x1b, 0x78, 0x40, 0xf0, 0x91, 0xe6, 0x15, 0xd2, 0x0a, 0x8d, 0x9f, 0x43, 0xcd,
+    0xac, 0x17, 0x85, 0x4a, 0xe0, 0xc6, 0x0d, 0xdb, 0x6e, 0xa8, 0xdc, 0x45, 0x1b, 0x4e, 0x6d, 0xd0,
+    0xfc, 0x96, 0x63, 0x65, 0xc9, 0xed, 0x37, 0x25, 0xe8, 0xc8, 0xae, 0x15, 0x6d, 0x0a, 0xc2, 0xdd,
+    0x8b, 0x95, 0x52, 0x15, 0xc9, 0x28, 0x5c, 0x62, 0xc6, 0xd1, 0x4b, 0xf6, 0x9a, 0x3c, 0x62, 0x4e,
+    0xd2, 0x2b, 0xa8, 0x61, 0xb9, 0x87, 0x10, 0x58, 0x39, 0x08, 0xe8, 0x71, 0xb1, 0xfd, 0xba, 0xdb,
+    0x25, 0x49, 0xf6, 0x08, 0x69, 0x45, 0x57, 0xf0, 0x60, 0x12, 0xd7, 0x71, 0x6d, 0x85, 0x06, 0xf2,
+    0xcd, 0xf7, 0x4d, 0x1c, 0x5b, 0x45, 0x50, 0x2a, 0x8b, 0x25, 0x0f, 0x97, 0xd5, 0x61, 0x37, 0x1c,
+    0xa8, 0xff, 0xd5, 0xcb, 0xfa, 0xa0, 0x11, 0xc7, 0x6e, 0xde, 0x99, 0xcc, 0xcd, 0x56, 0x3c, 0xf6,
+    0x95, 0x5f, 0x91, 0xf3, 0xf1, 0xea, 0x22, 0xa8, 0x96, 0xba, 0x13, 0x5b, 0xdb, 0x8c, 0x06, 0x5f,
+    0x9c, 0xab, 0x0a, 0x09, 0xe1, 0x58, 0x83, 0x0e, 0x75, 0x8a, 0x0e, 0xa3, 0x6b, 0x31, 0xda, 0xab,
+    0x78, 0xcc, 0x31, 0xdc, 0xe2, 0xb3, 0x38, 0x88, 0x73, 0xe6, 0xfa, 0x54, 0xd7, 0xa8, 0x44, 0xd3,
+    0x2d, 0x52, 0x65, 0xf1, 0x21, 0x3e, 0xac, 0xa1, 0xd8, 0xec, 0x58, 0x94, 0x0b, 0xe0, 0x54, 0xf9,
+    0xbb, 0xc0, 0xa9, 0x0f, 0x28, 0x1a, 0x71, 0xea, 0x74, 0x5f, 0xb9, 0x1e, 0x4d, 0x38, 0xaf, 0x5f,
+    0xa2, 0x70, 0x6f, 0x71, 0x30, 0xad, 0x99, 0xeb, 0x52, 0xa2, 0x12, 0x0a, 0x47, 0x90, 0x28, 0xcd,
+    0xd2, 0x6a, 0x15, 0xc4, 0xb2, 0xaf, 0x0f, 0x4e, 0x88, 0xb4, 0xe3, 0xc0, 0x90, 0x65, 0xd9, 0xb2,
+    0xdc, 0x87, 0x2c, 0x48, 0x66, 0xae, 0xd6, 0x61, 0x57, 0xde, 0x08, 0xca, 0xb1, 0x54, 0x75, 0x58,
+    0xa9, 0xeb, 0x46, 0x02, 0x79, 0x16, 0x3e, 0x64, 0x72, 0xbd, 0xdd, 0x8c, 0xe5, 0xab, 0x4e, 0x8f,
+    0x43, 0xd6, 0xe3, 0xad, 0x99, 0xaa, 0xee, 0xeb, 0x34, 0x04, 0x3d, 0xac, 0x28, 0xee, 0x48, 0x5c,
+    0x01, 0x32, 0x14, 0x7c, 0x83, 0x21, 0x24, 0x8a, 0x2e, 0x4a, 0x93, 0xcf, 0xde, 0x56, 0x58, 0x65,
+    0xb7, 0x74, 0x64, 0xdd, 0xa2, 0x18, 0xc2, 0xa5, 0x37, 0x55, 0xf2, 0x56, 0x0a, 0x66, 0xc0, 0xac,
+    0x6b, 0x67, 0xaf, 0x2c, 0xcb, 0x3e, 0x20, 0x0c, 0x40, 0x4d, 0x61, 0x4b, 0xf7, 0xe4, 0x4e, 0xf7,
+    0x3a, 0xd1, 0xcf, 0xe8, 0x86, 0x8e, 0x4f, 0xf2, 0x30, 0x28, 0x3d, 0xfa, 0x68, 0x83, 0x61, 0xc8,
+    0x3c, 0x04, 0xc3, 0xbc, 0x03, 0xaa, 0xda, 0x88, 0xe9, 0x8f, 0xa2, 0xc5, 0xd4, 0x8b, 0x84, 0xa7,
+    0x03, 0x08, 0xb8, 0xa7, 0xd2, 0x8b, 0xa9, 0xbe, 0xf0, 0x57, 0x43, 0xfb, 0xd0, 0x42, 0xfb, 0x8f,
+    0x6f, 0xe8, 0x56, 0x73, 0xd0, 0x20, 0xe1, 0x69, 0xa4, 0x2e, 0x7c, 0x37, 0xeb, 0x8a, 0x9c, 0xa9,
+    0x54, 0xa1, 0xe7, 0x10, 0xa2, 0xe3, 0xa6, 0xd7, 0x17, 0xde, 0xe3, 0x5e, 0x92, 0xd9, 0xdd, 0x3e,
+    0x90, 0x0c, 0x08, 0xd9, 0xb5, 0x6c, 0xe8, 0xdb, 0x35, 0xbe, 0x22, 0x58, 0x68, 0x37, 0x8d, 0xc1,
+    0xfc, 0x6e, 0xbb, 0x5b, 0xb9, 0xe9, 0x6a, 0x99, 0xce, 0x47, 0x97, 0xe5, 0xb5, 0xff, 0x53, 0x71,
+    0x18, 0xa2, 0x6b, 0xfe, 0xa2, 0xfe, 0x0a, 0xa6, 0xc6, 0x23, 0x2c, 0x6f, 0x6a, 0x9e, 0x5f, 0x69,
+    0xe6, 0x7f, 0x3f, 0x6b, 0xa3, 0x37, 0xf3, 0xeb, 0x04, 0x10, 0xe2, 0x4d, 0x57, 0xca, 0x60, 0x74,
+    0x20, 0x4e, 0xec, 0xd2, 0x8d, 0x48, 0xd1, 0x3a, 0x52, 0xb8, 0xe9, 0x3f, 0x36, 0x08, 0x62, 0xe0,
+    0x3d, 0xdf, 0x87, 0xfc, 0x7d, 0xa6, 0x68, 0xb7, 0xe9, 0xcc, 0x2f, 0x94, 0xf9, 0x2c, 0x30, 0xff,
+    0x49, 0xe0, 0xfc, 0xce, 0x18, 0xc6, 0xe9, 0xd4, 0x4e, 0xed, 0xb3, 0x51, 0xdd, 0xcc, 0xf1, 0x71,
+    0xe7, 0xce, 0x06, 0xcb, 0xc1, 0x74, 0x9e, 0x44, 0x8d, 0xa1, 0x06, 0xe4, 0xf5, 0xfb, 0x6d, 0x3e,
+    0xa3, 0x38, 0x39, 0x0f, 0x97, 0x77, 0xa6, 0x19, 0x7f, 0xc7, 0x01, 0x70, 0x72, 0x21, 0xd6, 0xab,
+    0xbf, 0x1c, 0xd9, 0xcc, 0xa1, 0xfe, 0x3f, 0x87, 0x5e, 0xc0, 0x28, 0xaf, 0x0d, 0x00, 0x00,
+};
+
+const uint8_t WEB_ASSET_UI_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x52, 0xdf, 0x6b, 0xdb, 0x30,
+    0x10, 0x7e, 0xd7, 0x5f, 0x21, 0xd8, 0x83, 0x64, 0x30, 0x26, 0x69, 0xb2, 0x96, 0xd6, 0x74, 0x50,
+    0x4c, 0x03, 0x83, 0x32, 0x46, 0xd7, 0x3e, 0x95, 0x3e, 0xa8, 0xd2, 0xc5, 0x11, 0xb3, 0x75, 0x41,
+    0x92, 0xe3, 0x85, 0x34, 0xff, 0xfb, 0x24, 0xd9, 0x4e, 0xbb, 0xb5, 0x6f, 0x77, 0xdf, 0xdd, 0x77,
+    0xdf, 0xfd, 0x5a, 0x77, 0x46, 0x7a, 0x8d, 0x86, 0xba, 0x0d, 0xf6, 0x0f, 0x28, 0x9c, 0xe7, 0x2d,
+    0x38, 0x27, 0x6a, 0xc8, 0xa9, 0xdf, 0x6f, 0x21, 0xa3, 0x07, 0x22, 0xd1, 0x38, 0x4f, 0x7d, 0x0c,
+    0xd2, 0x6b, 0xaa, 0x50, 0x76, 0x2d, 0x18, 0x5f, 0x48, 0x0b, 0xc2, 0xc3, 0x6d, 0x03, 0xd1, 0xe3,
+    0x4c, 0xe9, 0x1d, 0xcb, 0x4a, 0x92, 0xd2, 0x0a, 0xd9, 0x08, 0xe7, 0x7e, 0x88, 0x16, 0x02, 0x81,
+    0x25, 0x88, 0x4d, 0x21, 0x0f, 0x7f, 0x7c, 0x85, 0xc6, 0x07, 0x52, 0x08, 0x8e, 0x62, 0xe5, 0x28,
+    0x22, 0xb1, 0x41, 0xeb, 0x02, 0x7e, 0x20, 0xcc, 0x75, 0x52, 0x86, 0x28, 0xbb, 0xa2, 0xec, 0xcb,
+    0xb2, 0xba, 0x59, 0x7d, 0x9d, 0xb1, 0x9c, 0x30, 0xb0, 0x16, 0x6d, 0xc2, 0x56, 0xcb, 0xe5, 0x62,
+    0x71, 0x1e, 0xb1, 0x5e, 0x58, 0xa3, 0x4d, 0x3d, 0xa0, 0xab, 0x6a, 0x3e, 0xbb, 0x88, 0xa8, 0x36,
+    0x6b, 0x4c, 0xd0, 0xd9, 0xfc, 0xf2, 0x7c, 0xb5, 0x60, 0xe4, 0x38, 0xb5, 0xe0, 0xfc, 0xbe, 0x81,
+    0xe2, 0x45, 0xc8, 0xdf, 0xb5, 0xc5, 0xce, 0xa8, 0xa0, 0x37, 0x08, 0x3f, 0xc5, 0x91, 0x9f, 0xe9,
+    0xeb, 0xeb, 0xe4, 0x0f, 0x45, 0x9e, 0x4b, 0x72, 0x9a, 0xfa, 0x05, 0xd5, 0xbe, 0x10, 0xdb, 0x2d,
+    0x18, 0x55, 0x6d, 0x74, 0xa3, 0x78, 0x2a, 0x19, 0x06, 0x77, 0xe0, 0x1f, 0x74, 0x0b, 0xd8, 0x79,
+    0xce, 0x33, 0x7a, 0xfd, 0x8d, 0xbe, 0xdb, 0xc4, 0x9d, 0x0e, 0x96, 0x50, 0x8a, 0xb3, 0xb8, 0x66,
+    0x96, 0xe5, 0x74, 0x3e, 0x9b, 0x7d, 0xc6, 0x39, 0x90, 0xff, 0x59, 0x16, 0x5a, 0xdc, 0xc1, 0x44,
+    0xfc, 0x84, 0xf2, 0x6f, 0x67, 0x43, 0xfa, 0xfb, 0xce, 0x72, 0xba, 0x48, 0x5a, 0xc7, 0x64, 0x24,
+    0x8b, 0xf4, 0xda, 0x28, 0xec, 0x63, 0x47, 0xb7, 0xbb, 0x40, 0x8d, 0x42, 0x60, 0xc0, 0x72, 0xd6,
+    0xa0, 0x50, 0x2c, 0xa7, 0xeb, 0xf1, 0x2b, 0xf8, 0xdb, 0xf9, 0x3b, 0xdb, 0xfc, 0x14, 0x56, 0xb4,
+    0xf1, 0x38, 0x06, 0x7a, 0xfa, 0x78, 0x7f, 0xf7, 0x0b, 0x84, 0x95, 0x9b, 0x01, 0xe5, 0x63, 0xc9,
+    0x06, 0xa5, 0x88, 0xcc, 0xc2, 0xa5, 0x60, 0x36, 0x1d, 0xb6, 0x75, 0x75, 0x20, 0x9e, 0x8a, 0x14,
+    0x35, 0x84, 0x97, 0x09, 0x20, 0x3b, 0x65, 0xc4, 0xd5, 0x7f, 0x4c, 0x89, 0x28, 0xcb, 0xe2, 0x45,
+    0x86, 0x53, 0x94, 0x44, 0xaf, 0x29, 0x0f, 0xc4, 0xd8, 0xd9, 0xdb, 0xcf, 0x2a, 0x90, 0xa8, 0xe0,
+    0xf1, 0xfe, 0x7b, 0x85, 0xed, 0x16, 0x4d, 0x7c, 0xc8, 0x98, 0x33, 0xfe, 0x70, 0x1c, 0xf9, 0x98,
+    0x95, 0x7f, 0x01, 0x15, 0x30, 0x5c, 0x89, 0xec, 0x02, 0x00, 0x00,
+};
+
+const uint8_t WEB_ASSET_APP_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x3d, 0xdb, 0x72, 0xdc, 0xc6,
+    0x95, 0xef, 0xfc, 0x8a, 0xb6, 0x52, 0x36, 0x66, 0x56, 0xc3, 0xe1, 0x4d, 0x72, 0xec, 0xe1, 0x45,
+    0x45, 0xd3, 0x74, 0xa4, 0xd8, 0xa6, 0xb8, 0x24, 0x63, 0xa7, 0x8a, 0x61, 0xb1, 0xc0, 0x19, 0x90,
+    0x03, 0x6b, 0x06, 0x40, 0x00, 0x8c, 0x24, 0xae, 0xc2, 0x2a, 0x4b, 0xb2, 0xad, 0x24, 0x72, 0x24,
+    0x59, 0x4e, 0xca, 0x5e, 0x25, 0xb2, 0x2d, 0x6f, 0xb6, 0xb2, 0x95, 0xbd, 0x84, 0xba, 0x30, 0xa1,
+    0x28, 0x89, 0xae, 0xf2, 0xfe, 0xc0, 0xcc, 0x2f, 0xf8, 0x07, 0x36, 0x9f, 0xb0, 0xe7, 0xd2, 0x0d,
+    0x74, 0x03, 0x18, 0x92, 0xce, 0x3a, 0xfb, 0x20, 0x73, 0xd0, 0x97, 0xd3, 0xa7, 0x4f, 0x9f, 0x3e,
+    0xb7, 0x3e, 0xdd, 0xae, 0xfb, 0x5e, 0x14, 0x8b, 0xe9, 0xf9, 0x33, 0xab, 0xaf, 0x9c, 0x3d, 0xbb,
+    0xb4, 0xb8, 0xb4, 0x30, 0x3d, 0x2f, 0x26, 0x85, 0x35, 0x64, 0x07, 0xee, 0xd0, 0xf9, 0x91, 0xa1,
+    0x35, 0xdf, 0x8f, 0xa3, 0x38, 0xb4, 0x03, 0x6b, 0x7c, 0xa0, 0x9e, 0x34, 0x9d, 0x7d, 0x6b, 0x76,
+    0x6e, 0x69, 0x51, 0x6f, 0xe7, 0x9c, 0x77, 0xbc, 0x38, 0x4a, 0x1a, 0xcd, 0x4d, 0xbf, 0xb5, 0xfa,
+    0xc6, 0x99, 0xb9, 0xd7, 0xb1, 0xcd, 0xf2, 0xc0, 0xb2, 0x35, 0x64, 0x55, 0x84, 0xf5, 0xcd, 0x9d,
+    0x7f, 0xfe, 0x9f, 0xdd, 0x9b, 0xa2, 0x7b, 0xb7, 0xbb, 0xdd, 0xbb, 0xdc, 0xbb, 0xd2, 0x7b, 0xb7,
+    0xbb, 0xdf, 0x7d, 0xdc, 0xdd, 0xeb, 0xee, 0x5a, 0x2b, 0x15, 0x6c, 0x13, 0x3a, 0x76, 0xc3, 0xf5,
+    0x36, 0x22, 0x6c, 0xfb, 0xd7, 0xcf, 0x3f, 0xfe, 0xa5, 0xe8, 0xfe, 0xba, 0xbb, 0xdd, 0x7d, 0xd6,
+    0x7d, 0xd6, 0xbb, 0xde, 0xdd, 0x91, 0x6d, 0xea, 0x76, 0xcb, 0x5d, 0x0b, 0xed, 0xd8, 0xf5, 0x3d,
+    0x6e, 0xf6, 0x87, 0x3f, 0x8a, 0xee, 0x1d, 0x68, 0xf6, 0xa4, 0xbb, 0xdb, 0xbd, 0xdf, 0x7b, 0xb7,
+    0x2a, 0xdb, 0xb9, 0x5e, 0xec, 0x84, 0xe7, 0xed, 0x16, 0x01, 0xfb, 0xe6, 0xe6, 0x7d, 0x1a, 0xf8,
+    0x53, 0x00, 0x75, 0xa5, 0xbb, 0x03, 0x03, 0x3f, 0x50, 0xed, 0x00, 0xdd, 0x75, 0x77, 0x63, 0xb5,
+    0x6d, 0x7b, 0xf6, 0x86, 0x13, 0xca, 0x91, 0x2f, 0x23, 0xc8, 0x7d, 0x68, 0xfc, 0x1e, 0x00, 0x7d,
+    0x28, 0x5b, 0x76, 0x82, 0x86, 0x1d, 0x3b, 0x12, 0xb9, 0x3b, 0xef, 0x8a, 0xee, 0x67, 0xdd, 0x2f,
+    0xbb, 0xb7, 0x64, 0x65, 0x04, 0x83, 0xb9, 0x75, 0x87, 0x2b, 0x7f, 0xfd, 0x07, 0xd1, 0xbd, 0xc7,
+    0xc3, 0x74, 0x77, 0x7b, 0x97, 0xad, 0x95, 0x81, 0x15, 0x45, 0x97, 0x99, 0x85, 0xb3, 0xf3, 0xab,
+    0x73, 0xd3, 0x6f, 0xce, 0x22, 0x61, 0x2e, 0x0d, 0xc4, 0x7e, 0xdb, 0x8e, 0xfd, 0x9a, 0xb0, 0x00,
+    0xd4, 0x7e, 0xf7, 0x29, 0xd0, 0xe5, 0x4a, 0xef, 0x3a, 0x00, 0xa9, 0x77, 0xea, 0x9d, 0xf6, 0x9a,
+    0x13, 0x62, 0xcd, 0x67, 0xdd, 0x87, 0xbd, 0xab, 0xbd, 0x77, 0x7b, 0x1f, 0x50, 0x4d, 0xe0, 0x04,
+    0x01, 0x97, 0x7f, 0x4e, 0x23, 0xec, 0xf4, 0x3e, 0x80, 0xd2, 0x96, 0x13, 0xc7, 0x9d, 0xba, 0x83,
+    0xc5, 0xf7, 0x88, 0x16, 0x00, 0x08, 0x8a, 0xd7, 0x5a, 0x1d, 0x07, 0xa0, 0x84, 0x9b, 0x58, 0xf1,
+    0x31, 0x8c, 0xf0, 0xa4, 0x77, 0xb5, 0x7b, 0x1f, 0xe6, 0xb4, 0xd7, 0xdd, 0xb6, 0x2a, 0x03, 0x2d,
+    0xfb, 0x82, 0xc7, 0x35, 0xdb, 0xdd, 0xbf, 0xe0, 0x7c, 0xa1, 0xcb, 0x06, 0x2c, 0x35, 0xc1, 0xb9,
+    0x0d, 0xcd, 0x9e, 0x41, 0xe1, 0x43, 0x18, 0x64, 0xbb, 0xfb, 0x08, 0x91, 0xf2, 0x3d, 0x77, 0x9d,
+    0xc7, 0xfe, 0x57, 0x98, 0x19, 0xae, 0x1d, 0xaf, 0x4c, 0x45, 0x20, 0x87, 0x5c, 0x48, 0x46, 0xba,
+    0x23, 0xc7, 0x79, 0xa6, 0x46, 0x12, 0x76, 0x10, 0xb4, 0x08, 0xea, 0x9f, 0xa0, 0xf8, 0x09, 0x91,
+    0xf6, 0x26, 0x20, 0x10, 0x38, 0x36, 0x81, 0xfb, 0x18, 0xa6, 0x77, 0xb5, 0xf7, 0x73, 0x6a, 0x5a,
+    0x6f, 0x2a, 0x30, 0x80, 0x01, 0x94, 0x51, 0x4b, 0x11, 0xda, 0x51, 0x90, 0xc0, 0xff, 0x9d, 0x5c,
+    0xee, 0x67, 0xdc, 0xa1, 0x13, 0x86, 0xb6, 0x17, 0xf3, 0xdc, 0x9f, 0x76, 0xf7, 0x89, 0xad, 0x1e,
+    0x25, 0xd5, 0x51, 0xe0, 0x7a, 0x76, 0xbd, 0x89, 0xd5, 0xff, 0xd6, 0xfd, 0x8a, 0x8b, 0x91, 0x38,
+    0x03, 0x6b, 0x76, 0xe4, 0xb6, 0xb0, 0xf8, 0x23, 0x9a, 0xfe, 0x2e, 0x81, 0xdc, 0x43, 0x80, 0xb6,
+    0xe7, 0xd9, 0x6b, 0x6e, 0xc4, 0x53, 0xd9, 0x27, 0x2a, 0x7c, 0x05, 0x53, 0x42, 0x3c, 0x2e, 0x34,
+    0x1d, 0x9b, 0x86, 0xfa, 0x1c, 0x50, 0xdb, 0xc1, 0x19, 0xf6, 0x3e, 0xa0, 0x61, 0x02, 0x3f, 0x96,
+    0x2b, 0x09, 0xcc, 0x08, 0xd3, 0xb9, 0x02, 0x88, 0xbc, 0x07, 0x2d, 0x9e, 0xf4, 0x3e, 0x84, 0xda,
+    0x73, 0x36, 0x4f, 0x9f, 0x19, 0x75, 0x07, 0x47, 0x6f, 0xd9, 0xf5, 0x73, 0xc9, 0x8c, 0x7e, 0xd3,
+    0xfd, 0x33, 0xb4, 0x7d, 0x90, 0xd0, 0x2b, 0xf2, 0x37, 0xd7, 0x1c, 0xdb, 0xe3, 0x39, 0xed, 0xd3,
+    0xc8, 0x75, 0x3b, 0x0c, 0xfd, 0x98, 0xa7, 0x8f, 0x73, 0xdc, 0x03, 0xac, 0x1e, 0x00, 0xf0, 0x81,
+    0xad, 0xf1, 0x01, 0x58, 0x7e, 0x81, 0x1b, 0x15, 0x78, 0xca, 0xeb, 0xb4, 0x5a, 0x5c, 0x50, 0x6f,
+    0x01, 0x84, 0x4e, 0x10, 0xe1, 0x0e, 0x04, 0xfe, 0x5b, 0xef, 0x78, 0x75, 0xdc, 0x35, 0x62, 0x6d,
+    0xf3, 0x4c, 0xa3, 0xe4, 0x36, 0xca, 0xc0, 0x7e, 0xa1, 0x13, 0x77, 0x42, 0x4f, 0x34, 0x7c, 0xe0,
+    0x36, 0xd8, 0xbe, 0xd5, 0x0d, 0x27, 0x9e, 0x6d, 0x39, 0xf8, 0xf3, 0x15, 0xd9, 0x68, 0x7c, 0x60,
+    0x2b, 0xed, 0xe9, 0x44, 0x75, 0x60, 0x8e, 0xd3, 0x71, 0xbb, 0x55, 0x8a, 0x9d, 0x8b, 0xb1, 0x06,
+    0x61, 0x31, 0x0e, 0x61, 0xe3, 0x72, 0x69, 0x35, 0x74, 0x02, 0x98, 0x9c, 0x53, 0x1a, 0x5a, 0x7e,
+    0x61, 0x62, 0xea, 0x98, 0xb5, 0x32, 0xb4, 0x01, 0xd8, 0x8b, 0xc9, 0x29, 0x51, 0xba, 0x64, 0xbd,
+    0x60, 0xc1, 0x0c, 0x5e, 0xb0, 0xdb, 0xc1, 0x38, 0x6e, 0x95, 0x09, 0xfa, 0x6a, 0xc5, 0xf4, 0x31,
+    0x45, 0x1f, 0x1b, 0xfc, 0x71, 0x8c, 0x3e, 0x7e, 0xda, 0xf1, 0xe9, 0xf3, 0x98, 0x75, 0x0c, 0x3f,
+    0xbf, 0x37, 0xf6, 0xf2, 0xb8, 0xb5, 0xb5, 0x5c, 0x5f, 0x29, 0x9b, 0x78, 0x45, 0x4e, 0xbc, 0x04,
+    0x23, 0x03, 0xbe, 0x15, 0x01, 0x5b, 0xbe, 0xe3, 0x20, 0x66, 0xbc, 0xdf, 0x1c, 0x9e, 0x0e, 0xd0,
+    0x60, 0x2d, 0x99, 0x91, 0xbb, 0x2e, 0x4a, 0xaa, 0xfc, 0x85, 0x17, 0xb8, 0x87, 0x78, 0x6e, 0x72,
+    0x52, 0x74, 0xbc, 0x86, 0xb3, 0xee, 0x7a, 0x4e, 0xc3, 0x2c, 0x46, 0x92, 0x22, 0x44, 0xd9, 0xa7,
+    0x8a, 0xb3, 0x9c, 0xf1, 0x41, 0xbe, 0x10, 0x5c, 0x6a, 0x87, 0xe8, 0x98, 0x08, 0xcd, 0xf8, 0x2d,
+    0x3f, 0x24, 0x8c, 0xea, 0xad, 0xe8, 0x70, 0x7c, 0x9e, 0x93, 0x15, 0x65, 0xc1, 0x14, 0x1d, 0x4f,
+    0x46, 0xab, 0xb7, 0xec, 0x28, 0x7a, 0xc3, 0x8d, 0x62, 0xa0, 0x6b, 0xdb, 0x3f, 0xef, 0x94, 0xac,
+    0xd0, 0x69, 0x20, 0x89, 0x7c, 0xe0, 0xfa, 0x0d, 0x92, 0x38, 0x9b, 0x4e, 0xab, 0xe5, 0x5f, 0xc0,
+    0x5f, 0x1b, 0xa1, 0xe3, 0x78, 0x56, 0xb9, 0xa8, 0xb7, 0xdd, 0x68, 0x94, 0x00, 0x15, 0xf1, 0xb3,
+    0x9f, 0x69, 0xcd, 0x34, 0x9c, 0x61, 0xed, 0x7f, 0x18, 0xf9, 0x5e, 0xa9, 0x13, 0xb6, 0xb4, 0x85,
+    0x5d, 0x77, 0xe2, 0x7a, 0x93, 0xca, 0xaa, 0x71, 0xd3, 0xf1, 0x4a, 0x21, 0xae, 0xe3, 0x25, 0x46,
+    0x39, 0xac, 0xfa, 0xe7, 0xca, 0x22, 0x6e, 0x86, 0xfe, 0x05, 0xe1, 0x39, 0x17, 0xc4, 0x2c, 0x30,
+    0x68, 0x58, 0xb2, 0x4e, 0x2f, 0x2d, 0xcd, 0x0b, 0x4b, 0x1c, 0x17, 0x61, 0x35, 0x82, 0x3d, 0xd1,
+    0x89, 0x60, 0x1c, 0x09, 0x2d, 0xac, 0xbe, 0x83, 0x43, 0xe0, 0xc0, 0xe6, 0xe0, 0x81, 0x1f, 0x25,
+    0xa3, 0x83, 0xd8, 0xf2, 0x1b, 0x9b, 0x29, 0xc9, 0x60, 0xc7, 0x35, 0x9c, 0x10, 0xd9, 0xf8, 0x92,
+    0xf5, 0xe3, 0xc1, 0x99, 0xc5, 0x85, 0xd7, 0x06, 0x97, 0xfc, 0x73, 0x80, 0x7f, 0x8d, 0x78, 0xbe,
+    0x5a, 0x8f, 0xc2, 0xf5, 0xd5, 0x18, 0x4b, 0xb6, 0x94, 0x94, 0xf5, 0x03, 0x84, 0x4a, 0x5d, 0xda,
+    0x4e, 0xdc, 0xf4, 0x1b, 0xc0, 0x3d, 0xf3, 0x67, 0x17, 0x97, 0x80, 0x44, 0x12, 0x5a, 0x4d, 0xfd,
+    0xd8, 0x62, 0xfa, 0xe3, 0x90, 0x26, 0x0f, 0x20, 0x02, 0xb2, 0xcd, 0xb2, 0x25, 0x97, 0x7b, 0x70,
+    0x69, 0x33, 0x70, 0xac, 0x15, 0xd4, 0x7b, 0x28, 0xd1, 0xdc, 0x3a, 0xe9, 0xa1, 0x21, 0x9c, 0x14,
+    0x68, 0x3e, 0x39, 0x6a, 0x95, 0x60, 0x4d, 0x8a, 0x1f, 0x2e, 0x9e, 0x9d, 0x03, 0x0a, 0xe0, 0xc6,
+    0x70, 0xd7, 0x37, 0x69, 0x04, 0x9a, 0x74, 0x96, 0xb2, 0x15, 0x85, 0xae, 0x4e, 0x62, 0x45, 0x29,
+    0x93, 0x4c, 0x38, 0xd5, 0xd7, 0x5c, 0xa7, 0xd5, 0x28, 0x69, 0x4b, 0x74, 0x6c, 0xc2, 0xf5, 0x82,
+    0x4e, 0x2c, 0x62, 0xc0, 0x6d, 0xd2, 0x6a, 0xba, 0x8d, 0x06, 0xd0, 0x46, 0x78, 0x76, 0x1b, 0xbe,
+    0x52, 0xda, 0x58, 0xcc, 0xa8, 0x93, 0xd6, 0x31, 0x58, 0x19, 0x6d, 0x23, 0x67, 0x48, 0x58, 0x86,
+    0xda, 0x63, 0xd6, 0xd4, 0xb1, 0xcc, 0xfe, 0xa2, 0xbf, 0xa5, 0xd8, 0x8d, 0x5b, 0x0e, 0x2f, 0x4f,
+    0x45, 0xc0, 0x26, 0x08, 0xed, 0x19, 0x64, 0x2f, 0x03, 0x97, 0x86, 0x7b, 0x5e, 0x10, 0xd3, 0x4d,
+    0x5a, 0xb2, 0x9b, 0x08, 0x6c, 0xcf, 0x69, 0x09, 0x1c, 0xb7, 0x94, 0x76, 0x22, 0x3e, 0xb4, 0xe4,
+    0x70, 0x13, 0xcd, 0xb1, 0x29, 0xac, 0xa7, 0x01, 0xe0, 0xaf, 0x35, 0x31, 0x04, 0x25, 0xc8, 0x43,
+    0x44, 0x4b, 0x2a, 0x00, 0xc0, 0x53, 0x96, 0x81, 0x56, 0x0b, 0xd8, 0xba, 0xe4, 0xc6, 0x4e, 0xdb,
+    0xc4, 0xa0, 0xd3, 0x02, 0x75, 0xb4, 0xd9, 0x82, 0xa9, 0xb6, 0xed, 0x70, 0xc3, 0xf5, 0x6a, 0xc3,
+    0xe3, 0x01, 0x30, 0x3f, 0x2c, 0xc3, 0x60, 0xcb, 0x59, 0x8f, 0x6b, 0xa3, 0xc3, 0xc1, 0xc5, 0x71,
+    0x8b, 0xc6, 0xa3, 0xce, 0xd5, 0xb6, 0x1d, 0x10, 0x18, 0xa4, 0xbb, 0x35, 0xd1, 0x72, 0x69, 0x60,
+    0x2a, 0xa0, 0x81, 0xb1, 0xa0, 0x5c, 0x7d, 0xc7, 0x77, 0xbd, 0x12, 0x23, 0x0c, 0x65, 0x9d, 0x16,
+    0xe3, 0xc2, 0xec, 0xb6, 0x38, 0x3b, 0xb7, 0x78, 0x76, 0x61, 0x75, 0xe1, 0xec, 0xdb, 0xca, 0xdc,
+    0x81, 0xce, 0x01, 0xdb, 0x02, 0x1f, 0xde, 0x23, 0xcb, 0xe3, 0x4b, 0x10, 0xef, 0x4f, 0x41, 0x8b,
+    0xa0, 0xca, 0x46, 0x25, 0x7f, 0x15, 0xff, 0x56, 0xc4, 0xd7, 0xdb, 0x33, 0xd8, 0x0c, 0x9b, 0x3b,
+    0x60, 0xd4, 0x74, 0x42, 0xda, 0xcf, 0xf4, 0x8f, 0xec, 0x8a, 0x66, 0xa7, 0xcd, 0x60, 0x6e, 0x83,
+    0x49, 0x71, 0x1b, 0xf5, 0x3a, 0x28, 0x0a, 0xd0, 0x47, 0x64, 0x3e, 0x7d, 0x58, 0x11, 0xcf, 0x63,
+    0x2d, 0x34, 0x72, 0x1b, 0x6e, 0xbc, 0x89, 0xbf, 0xc5, 0x5b, 0x6f, 0x13, 0x44, 0x31, 0xbd, 0xf8,
+    0x26, 0x83, 0x70, 0xea, 0x6c, 0x7a, 0xdd, 0x13, 0xb3, 0x33, 0x30, 0xe0, 0xce, 0xe2, 0x50, 0x9d,
+    0x60, 0x72, 0x79, 0x3a, 0x54, 0xd0, 0xe4, 0x76, 0x9f, 0x20, 0xbe, 0xc1, 0x69, 0xfc, 0xe0, 0xa2,
+    0xb4, 0x89, 0xb4, 0xb8, 0x3e, 0xfc, 0x4a, 0x74, 0x6f, 0xa1, 0xc1, 0xd0, 0xbb, 0x22, 0x4a, 0x73,
+    0xe5, 0x8a, 0x80, 0x99, 0x3d, 0x1c, 0x02, 0x85, 0xf4, 0x10, 0xeb, 0x3d, 0x37, 0x0e, 0xfd, 0x0d,
+    0xc7, 0xcb, 0x40, 0x97, 0x5d, 0xef, 0x8b, 0xee, 0xef, 0x09, 0xfd, 0xf7, 0x50, 0x89, 0x89, 0xd2,
+    0x7c, 0xb6, 0x7b, 0xd0, 0xf4, 0x23, 0xf8, 0x17, 0x76, 0x22, 0x13, 0xc0, 0x39, 0x06, 0xf0, 0xab,
+    0x1b, 0xa9, 0xb5, 0xf7, 0x58, 0x94, 0x5e, 0xcf, 0x75, 0x07, 0x35, 0x1c, 0x45, 0x2e, 0x93, 0x8d,
+    0x7b, 0xa7, 0xc6, 0x97, 0x5a, 0xa7, 0xe9, 0xb9, 0x1f, 0x28, 0xfb, 0x0b, 0x08, 0x5f, 0x03, 0x21,
+    0x01, 0x5c, 0x22, 0x06, 0x4f, 0x0c, 0x57, 0x44, 0xdb, 0xbe, 0x58, 0x13, 0x2f, 0xc1, 0x8f, 0x20,
+    0x74, 0xea, 0x6e, 0x04, 0x6c, 0x06, 0xa2, 0xe3, 0xeb, 0xfb, 0xc3, 0xd5, 0x93, 0xb8, 0x54, 0x5b,
+    0x95, 0x01, 0x20, 0xb6, 0xea, 0xa0, 0x9a, 0x8f, 0x0c, 0xe7, 0xda, 0x8f, 0x3d, 0xbf, 0x80, 0x14,
+    0x04, 0xa9, 0x3c, 0x6f, 0x94, 0x9f, 0xc4, 0x72, 0x80, 0xe2, 0xd4, 0xb3, 0x40, 0x46, 0x87, 0x87,
+    0xf3, 0x60, 0x46, 0x07, 0x4f, 0x3e, 0x8f, 0xcd, 0x83, 0xa6, 0x6a, 0x3e, 0x26, 0x9b, 0xbf, 0x9c,
+    0xc7, 0x70, 0x2c, 0x20, 0xd0, 0x5e, 0x0e, 0xbd, 0x97, 0x5f, 0xce, 0xb4, 0x1e, 0x65, 0xa0, 0x47,
+    0x6d, 0x78, 0xee, 0x68, 0x0d, 0x07, 0x12, 0xf1, 0x3b, 0xbd, 0x00, 0x5b, 0x61, 0x75, 0xe9, 0xec,
+    0x1b, 0xb3, 0x40, 0xea, 0x99, 0x59, 0xa4, 0x34, 0x13, 0x7a, 0xb8, 0x3a, 0x0a, 0x12, 0x18, 0x29,
+    0x08, 0x04, 0x05, 0x11, 0x52, 0xc7, 0x79, 0x03, 0xa4, 0x26, 0x16, 0x0c, 0x43, 0x09, 0xc0, 0x82,
+    0xff, 0x06, 0x34, 0x4f, 0x18, 0x76, 0x6c, 0x4b, 0xb3, 0x5b, 0xea, 0xa8, 0x51, 0x17, 0x1d, 0x2f,
+    0xf2, 0xc3, 0x05, 0xd4, 0x7c, 0x25, 0x12, 0x68, 0xd0, 0xce, 0xd1, 0x94, 0x05, 0xe9, 0x44, 0x18,
+    0xd0, 0x58, 0xea, 0x65, 0x68, 0xb2, 0xc2, 0x72, 0x9e, 0xb5, 0xfa, 0x04, 0xb7, 0xab, 0xc2, 0xac,
+    0x50, 0x0e, 0x71, 0xe1, 0x94, 0x2a, 0xb4, 0x2f, 0x2a, 0x2d, 0x2c, 0x48, 0xd7, 0x72, 0x4f, 0x80,
+    0x21, 0x26, 0x41, 0x41, 0xd0, 0x9e, 0x4c, 0x0d, 0x84, 0x29, 0x71, 0x72, 0x2c, 0x6d, 0x2e, 0x35,
+    0x71, 0xa2, 0xf0, 0xa4, 0xa6, 0x35, 0x85, 0x38, 0xce, 0x63, 0xc6, 0x87, 0x1d, 0xef, 0x45, 0xa4,
+    0x3f, 0x5e, 0x75, 0xce, 0xbb, 0xf4, 0xa3, 0x54, 0x57, 0xa5, 0x4e, 0x03, 0x4d, 0xde, 0x0b, 0x65,
+    0xa9, 0x6a, 0xe1, 0x27, 0x8d, 0x3d, 0x9c, 0x8e, 0x94, 0x78, 0x5a, 0x0d, 0xd5, 0x1b, 0x66, 0xfd,
+    0xa6, 0x1d, 0x37, 0xab, 0xf6, 0x5a, 0x54, 0xd2, 0x21, 0x89, 0x41, 0x06, 0x35, 0x84, 0x7f, 0xc4,
+    0x3f, 0x20, 0xbb, 0x4a, 0xa3, 0x23, 0xed, 0x3a, 0x31, 0x29, 0x4e, 0xa6, 0xb0, 0x15, 0xd2, 0xb9,
+    0x36, 0x23, 0xc3, 0x05, 0x53, 0xcd, 0xb7, 0xd2, 0x40, 0x49, 0x23, 0x25, 0x25, 0x08, 0x13, 0x34,
+    0x4b, 0x8e, 0x57, 0x9d, 0x56, 0x6c, 0xab, 0x05, 0x8d, 0x41, 0x6c, 0x3b, 0x71, 0xba, 0xa6, 0x0d,
+    0x77, 0x7d, 0x5d, 0x9f, 0x1c, 0x13, 0x7e, 0x30, 0x69, 0x37, 0x24, 0x7f, 0xf1, 0xdc, 0x24, 0x42,
+    0xd8, 0x67, 0x4a, 0x8c, 0x0d, 0x17, 0x2d, 0xa5, 0xac, 0x1c, 0x1d, 0x2e, 0xc0, 0x53, 0xab, 0x2f,
+    0x9c, 0xad, 0x46, 0x7f, 0x6d, 0x12, 0x68, 0x9b, 0x5f, 0x58, 0x74, 0x37, 0xbc, 0x12, 0x78, 0x15,
+    0x8e, 0xb4, 0x42, 0x2b, 0x68, 0x1b, 0x39, 0x51, 0xd3, 0x6f, 0x91, 0x31, 0x81, 0x35, 0x30, 0x8d,
+    0xc0, 0x0e, 0x23, 0xe7, 0xb5, 0x96, 0x6f, 0xc7, 0xd4, 0x16, 0x96, 0x82, 0xe7, 0x63, 0xd4, 0xb0,
+    0x15, 0xcb, 0xd8, 0xb8, 0xd1, 0x9c, 0x3d, 0xc7, 0x6d, 0x91, 0x59, 0xf9, 0x93, 0x1b, 0x18, 0xec,
+    0x90, 0xb2, 0xf7, 0x94, 0xa0, 0xb1, 0x8e, 0xeb, 0xe3, 0xab, 0x86, 0xdf, 0x7c, 0xf0, 0x91, 0xb0,
+    0xcc, 0xbd, 0x40, 0x8d, 0x07, 0x8b, 0x1b, 0x7f, 0x2c, 0xfa, 0xce, 0x59, 0x79, 0xeb, 0x6f, 0xb9,
+    0xce, 0x85, 0x92, 0xb6, 0x03, 0x9d, 0xfa, 0x69, 0x32, 0x9b, 0x60, 0x46, 0xa9, 0xb7, 0xbb, 0xcc,
+    0x76, 0x46, 0xe8, 0x07, 0xab, 0x6e, 0x63, 0x85, 0x94, 0x7f, 0xf7, 0x0b, 0xd0, 0x89, 0xe8, 0xc5,
+    0x3c, 0xad, 0x5a, 0xec, 0xb1, 0x00, 0x0d, 0xd1, 0x66, 0xc3, 0x71, 0x34, 0x95, 0x5a, 0x5d, 0xf7,
+    0xc3, 0x59, 0xf0, 0xe0, 0x4a, 0x25, 0xdc, 0xc7, 0x20, 0x54, 0xed, 0x35, 0x07, 0x8c, 0x26, 0xda,
+    0x20, 0x3f, 0x02, 0x6d, 0x53, 0x01, 0x9b, 0xcd, 0x8d, 0x57, 0xca, 0x6c, 0x99, 0x32, 0x12, 0x91,
+    0x63, 0x47, 0xb4, 0x23, 0xa4, 0xd2, 0x22, 0xf5, 0x73, 0xce, 0x5a, 0xa9, 0xba, 0x5e, 0xbd, 0xd5,
+    0x69, 0x38, 0x51, 0x89, 0xa4, 0xc6, 0x29, 0x30, 0x17, 0x22, 0x30, 0x4f, 0x84, 0xdb, 0x60, 0xc3,
+    0x08, 0x37, 0x39, 0x58, 0x24, 0xab, 0xdc, 0xdf, 0x4a, 0x2d, 0x19, 0xfc, 0x1c, 0xb4, 0x1b, 0xef,
+    0x80, 0xad, 0x32, 0x84, 0x3d, 0xc0, 0x7c, 0xa8, 0x11, 0xa2, 0x84, 0xf3, 0x71, 0x40, 0x7a, 0x22,
+    0x0e, 0xa7, 0x26, 0xe2, 0x06, 0x19, 0x0f, 0x84, 0x22, 0x02, 0x9a, 0x18, 0x82, 0x12, 0x2c, 0x2d,
+    0x1e, 0x06, 0x66, 0xa0, 0x01, 0x3c, 0xae, 0x66, 0x24, 0x8e, 0x0f, 0x1c, 0xd2, 0xd3, 0xe8, 0xd5,
+    0xa1, 0x2e, 0x87, 0x0f, 0x06, 0x1a, 0x3f, 0xdf, 0x6d, 0x40, 0x92, 0x8a, 0xcc, 0x1a, 0xec, 0x3b,
+    0x04, 0xf3, 0xb0, 0xd8, 0x40, 0x57, 0xeb, 0x3e, 0xd1, 0x1c, 0x99, 0xe2, 0x78, 0xcc, 0xe7, 0xb0,
+    0x5c, 0x7b, 0xe4, 0x2e, 0x6f, 0x93, 0xef, 0x0b, 0x96, 0xcd, 0x23, 0xb2, 0x67, 0xae, 0xb1, 0xeb,
+    0x0a, 0x76, 0xdb, 0x08, 0x52, 0x60, 0x80, 0x0d, 0x41, 0x44, 0x81, 0x7d, 0x80, 0x33, 0xde, 0xba,
+    0x6f, 0x65, 0xec, 0xb2, 0x11, 0x30, 0xc4, 0xc4, 0xf0, 0xf8, 0x3a, 0xd8, 0xd6, 0x83, 0x91, 0xfb,
+    0x4f, 0x4e, 0x6d, 0xe4, 0x45, 0xb0, 0xcc, 0x48, 0x1e, 0xd4, 0xbe, 0x37, 0x36, 0x36, 0x86, 0xd8,
+    0xa2, 0xd5, 0x77, 0x8c, 0xb0, 0x64, 0x13, 0x14, 0xa3, 0x33, 0xd7, 0xd9, 0x04, 0xd8, 0x13, 0x14,
+    0x99, 0xb8, 0x8f, 0x76, 0x08, 0xe0, 0x70, 0x03, 0xac, 0x11, 0x30, 0xb0, 0x32, 0xf8, 0xa1, 0xf3,
+    0xa8, 0xdb, 0xa4, 0x00, 0x3d, 0x02, 0xb8, 0x08, 0x76, 0xa2, 0x79, 0x62, 0x8a, 0x63, 0x35, 0x77,
+    0x28, 0xf6, 0xf2, 0x15, 0xfa, 0xf3, 0xbd, 0xcb, 0x00, 0xea, 0x03, 0x9e, 0x59, 0x06, 0x58, 0xf7,
+    0x31, 0xcc, 0xee, 0x04, 0x91, 0x8e, 0x2c, 0xcf, 0xe5, 0x01, 0x6b, 0x02, 0xcc, 0x7b, 0xdf, 0xdb,
+    0x98, 0x5a, 0x98, 0x7e, 0x1b, 0x08, 0xcb, 0xbf, 0x61, 0x27, 0x81, 0x79, 0x73, 0xbd, 0xf7, 0x2e,
+    0x86, 0x46, 0x88, 0x3c, 0x2a, 0x82, 0x05, 0xe5, 0x19, 0x72, 0x89, 0x1f, 0xfe, 0x78, 0x66, 0xa9,
+    0x26, 0xfe, 0xfa, 0xf9, 0xe7, 0x5f, 0x8a, 0xee, 0x83, 0x74, 0x3e, 0xd7, 0xd0, 0x5a, 0x14, 0x14,
+    0xc4, 0xd8, 0x06, 0x34, 0x64, 0x74, 0xa6, 0xbb, 0x53, 0xc1, 0xa6, 0xf7, 0x72, 0x15, 0x04, 0xf8,
+    0x29, 0x59, 0x45, 0xfb, 0x60, 0x15, 0x51, 0xec, 0xe1, 0x5a, 0x6a, 0x26, 0xf6, 0x6e, 0xa0, 0x41,
+    0x78, 0x7c, 0x00, 0x23, 0x53, 0x8f, 0x04, 0x4e, 0x07, 0xe6, 0x86, 0xa1, 0x23, 0x80, 0xb3, 0x43,
+    0x36, 0xe5, 0xd3, 0xee, 0x6e, 0x06, 0xb3, 0x71, 0xc2, 0xe7, 0x32, 0xed, 0xcf, 0xfb, 0x58, 0xd0,
+    0x7b, 0x1f, 0x27, 0x96, 0x81, 0x2c, 0xa0, 0xf1, 0x5f, 0xa0, 0x37, 0x05, 0xa2, 0x14, 0xc1, 0x53,
+    0xb2, 0x98, 0x84, 0xad, 0xea, 0x24, 0x42, 0xe2, 0x02, 0xf8, 0x27, 0x48, 0x22, 0x0a, 0x7b, 0x91,
+    0x7d, 0x8c, 0x7f, 0x77, 0x71, 0xf6, 0x72, 0xe4, 0xc7, 0x82, 0x05, 0x84, 0xb9, 0x36, 0xdd, 0xdd,
+    0x1a, 0xd8, 0xb2, 0x8c, 0x4e, 0xde, 0xaa, 0xc6, 0xf0, 0xce, 0x4d, 0x51, 0x5a, 0x68, 0xfa, 0x20,
+    0x84, 0x22, 0x01, 0x62, 0xc5, 0x6e, 0x55, 0x2b, 0x60, 0xb3, 0xbc, 0xf4, 0x72, 0x59, 0xd2, 0x21,
+    0x38, 0x2d, 0x31, 0x20, 0x32, 0x6c, 0x77, 0x1f, 0xd0, 0x5a, 0x60, 0x01, 0xc6, 0x26, 0x11, 0xd8,
+    0x33, 0x9a, 0xdf, 0xd5, 0x8a, 0x98, 0x9b, 0x7f, 0x5d, 0xb6, 0x2d, 0x1e, 0x0d, 0xd0, 0x07, 0xd2,
+    0x3d, 0x30, 0x2d, 0x73, 0x28, 0x2a, 0x81, 0x46, 0xdb, 0xb0, 0x1b, 0x7e, 0x32, 0xfe, 0xe8, 0x30,
+    0xa8, 0x1b, 0x24, 0x4e, 0xf7, 0x33, 0x68, 0xb0, 0xc7, 0x41, 0x30, 0x26, 0x1a, 0x02, 0x41, 0x5b,
+    0x1a, 0xb8, 0x48, 0xf2, 0xc2, 0x37, 0xbf, 0xf8, 0xbd, 0x40, 0x63, 0x51, 0xae, 0x37, 0x7f, 0x8e,
+    0x0c, 0xf3, 0xf7, 0x17, 0xea, 0x9b, 0xeb, 0x61, 0x49, 0xa7, 0xf8, 0xcb, 0x20, 0xfd, 0x6d, 0x69,
+    0x24, 0x3f, 0xd2, 0x57, 0x2b, 0x61, 0xc6, 0xde, 0xfb, 0xb5, 0x74, 0x35, 0xb2, 0xe8, 0x43, 0xcb,
+    0x6f, 0x7e, 0xf1, 0xaf, 0xa3, 0x08, 0xbe, 0x70, 0xce, 0xdb, 0xe2, 0x24, 0xd8, 0xca, 0x60, 0x0f,
+    0x83, 0xed, 0x0d, 0x53, 0x50, 0xfb, 0x0e, 0x47, 0x7b, 0x80, 0x74, 0xdc, 0xc5, 0xe9, 0xfc, 0x1c,
+    0xc3, 0xb1, 0xb8, 0x81, 0x32, 0x8c, 0x65, 0x0d, 0xac, 0x94, 0x53, 0x87, 0x4e, 0xdb, 0x88, 0x37,
+    0xfe, 0x24, 0x52, 0x8d, 0x40, 0x84, 0x79, 0xa4, 0x96, 0x9b, 0xf6, 0x9d, 0x55, 0xb0, 0xef, 0x64,
+    0xe8, 0x0e, 0x03, 0x61, 0xb4, 0xd9, 0x9e, 0x51, 0x64, 0xec, 0x69, 0xef, 0xba, 0x36, 0xb9, 0x47,
+    0x18, 0xb9, 0x13, 0xd4, 0xe2, 0x3e, 0xad, 0xf6, 0x33, 0x0a, 0xe8, 0x21, 0x6b, 0xf5, 0xae, 0x62,
+    0x78, 0x8e, 0x67, 0xd5, 0xbb, 0x8e, 0xbb, 0x08, 0x58, 0x6c, 0x47, 0x6e, 0x36, 0xdc, 0xb2, 0xb4,
+    0x2f, 0xf6, 0x10, 0x28, 0x31, 0xf8, 0x1e, 0xb1, 0x27, 0x86, 0x17, 0x89, 0x63, 0xb8, 0x7a, 0x57,
+    0x40, 0xf7, 0x6b, 0xbd, 0x8f, 0x70, 0x6f, 0xc0, 0xa6, 0xc5, 0x26, 0xb8, 0x33, 0x51, 0x08, 0xd0,
+    0x16, 0xc3, 0xa8, 0xed, 0x41, 0xab, 0xce, 0x90, 0xf3, 0x93, 0x36, 0x58, 0x41, 0xad, 0xbd, 0xe2,
+    0x85, 0xd1, 0x0c, 0x2f, 0x8c, 0x0d, 0xeb, 0xbc, 0x00, 0x5f, 0x34, 0x66, 0x01, 0x0f, 0x28, 0x61,
+    0xa3, 0x8b, 0x25, 0x5c, 0x35, 0xd5, 0xae, 0x77, 0x9d, 0xe0, 0xec, 0x68, 0x4b, 0x2a, 0x50, 0xd6,
+    0xd2, 0xb4, 0x1e, 0x20, 0x86, 0x72, 0x5c, 0x9a, 0x06, 0x6e, 0x20, 0xac, 0x20, 0xd9, 0xd3, 0xfb,
+    0x50, 0x89, 0xb9, 0xab, 0xb4, 0xb3, 0xf7, 0x29, 0xfa, 0x7d, 0x53, 0xe2, 0x95, 0xb0, 0xc4, 0x5e,
+    0x4e, 0xd6, 0x18, 0x7c, 0xfb, 0x6b, 0x64, 0x28, 0xa2, 0xb5, 0x26, 0x85, 0x25, 0x6b, 0xe9, 0x3c,
+    0x4b, 0x3b, 0xf2, 0x32, 0x49, 0xa6, 0x6b, 0xb8, 0x92, 0x45, 0x9b, 0x90, 0xb6, 0x26, 0xd1, 0x97,
+    0x69, 0xbb, 0x9b, 0x61, 0x3e, 0x8e, 0x29, 0x94, 0x13, 0x75, 0x65, 0xc6, 0x2d, 0x40, 0x4d, 0xc4,
+    0xf6, 0x5a, 0xcb, 0x51, 0xc5, 0x0d, 0x3b, 0xb6, 0xb1, 0x0c, 0x83, 0x42, 0x53, 0xac, 0xed, 0x9b,
+    0xa8, 0x2e, 0x9b, 0xf4, 0x83, 0x54, 0x80, 0xfc, 0x9d, 0x93, 0x7b, 0xb2, 0x1c, 0x15, 0x99, 0x16,
+    0x7a, 0x49, 0x2c, 0x25, 0x89, 0x13, 0x83, 0x0b, 0x09, 0x26, 0x8f, 0x81, 0xd1, 0x0f, 0x62, 0x7c,
+    0xb6, 0x32, 0xa8, 0x11, 0x95, 0xc1, 0x5f, 0x44, 0x4d, 0x4d, 0xa1, 0xff, 0x0c, 0x9a, 0xa3, 0xa8,
+    0xe3, 0xfe, 0xa3, 0xef, 0xd6, 0x92, 0x52, 0xef, 0x01, 0x29, 0x39, 0x5c, 0xc8, 0x7d, 0x52, 0x0a,
+    0x8f, 0x89, 0x82, 0xb8, 0x7e, 0x37, 0xb0, 0xc5, 0x2e, 0x69, 0xd8, 0x2b, 0x1c, 0xce, 0x66, 0xf9,
+    0x81, 0x7d, 0x76, 0x7a, 0xbf, 0x40, 0x51, 0x8d, 0x2d, 0x61, 0x8b, 0x8e, 0xd2, 0xfc, 0x0c, 0x3c,
+    0x28, 0xf2, 0x63, 0xd1, 0x06, 0xff, 0xe6, 0xce, 0x17, 0x14, 0x08, 0xb9, 0x45, 0x47, 0x30, 0xdb,
+    0xdd, 0x87, 0xb4, 0x13, 0x48, 0x7d, 0xc0, 0xd6, 0xc3, 0x5d, 0x74, 0x99, 0x62, 0xf3, 0x28, 0x68,
+    0x1e, 0xaa, 0x72, 0xa5, 0x70, 0x35, 0x73, 0xc2, 0xeb, 0xc4, 0xa1, 0x8b, 0xa1, 0x38, 0x3a, 0xe0,
+    0xb1, 0x69, 0x9e, 0x51, 0x62, 0x59, 0x68, 0xb6, 0xc4, 0x09, 0xb0, 0x25, 0x5a, 0xae, 0xe7, 0x0c,
+    0x36, 0x1d, 0x77, 0xa3, 0x19, 0xd7, 0x46, 0xaa, 0x2f, 0x8e, 0x2b, 0x8b, 0x22, 0xb5, 0x2b, 0xf2,
+    0xe8, 0x72, 0xb8, 0x6a, 0x90, 0x7d, 0x20, 0x29, 0x9b, 0x30, 0x6c, 0x71, 0x8f, 0xa4, 0x20, 0x32,
+    0xe5, 0x7b, 0x9a, 0x8e, 0xc2, 0x6d, 0xdc, 0x6f, 0x07, 0x4b, 0xda, 0x1a, 0x62, 0x06, 0xa5, 0x46,
+    0xc1, 0xac, 0xd0, 0x30, 0x1e, 0x8c, 0x02, 0x70, 0xa8, 0xd7, 0xdd, 0xfa, 0x20, 0x30, 0x86, 0xdf,
+    0x6e, 0x3b, 0x5e, 0xc3, 0xfe, 0x3f, 0xcc, 0xae, 0xd0, 0x76, 0xba, 0x7d, 0x8f, 0x6d, 0xb8, 0x27,
+    0x24, 0xe6, 0x58, 0x55, 0x22, 0xd9, 0x39, 0x1c, 0x43, 0x1a, 0xf8, 0x03, 0x69, 0x36, 0xe5, 0x64,
+    0xed, 0x3d, 0x3a, 0xb1, 0x43, 0x83, 0x01, 0xb7, 0x30, 0xf8, 0x11, 0xe0, 0x1d, 0x98, 0x1b, 0x92,
+    0xad, 0x25, 0x90, 0x01, 0x0f, 0x94, 0x3d, 0xf6, 0x0c, 0xcd, 0x14, 0xa9, 0x63, 0x9f, 0xa4, 0x72,
+    0x4f, 0x5a, 0x0d, 0x89, 0x28, 0x7c, 0x6c, 0xd8, 0x03, 0x85, 0x2a, 0x5f, 0x17, 0x12, 0x6f, 0xbd,
+    0x3d, 0x63, 0xd8, 0x12, 0x60, 0xa2, 0xf4, 0x7e, 0xd9, 0xfb, 0x08, 0x3a, 0xc9, 0x19, 0xe5, 0x15,
+    0x1a, 0xc1, 0xbf, 0x86, 0x5a, 0x40, 0x94, 0xfa, 0x99, 0x67, 0xa6, 0x54, 0x2a, 0xeb, 0x23, 0x4e,
+    0x2f, 0xbe, 0x69, 0x8c, 0xf8, 0x48, 0x02, 0xbe, 0x0a, 0x70, 0x79, 0x4c, 0xd2, 0x8f, 0x97, 0x69,
+    0x8f, 0x90, 0x1d, 0x84, 0xf6, 0x1b, 0xa3, 0xf1, 0x10, 0x04, 0x17, 0x86, 0xe3, 0xc0, 0x1b, 0x29,
+    0x01, 0xe6, 0xd0, 0x7d, 0xfe, 0xed, 0x79, 0xf4, 0x5a, 0x4b, 0xaf, 0x25, 0x1f, 0xff, 0xfd, 0x09,
+    0xba, 0xae, 0xcf, 0x4b, 0xfb, 0x04, 0xba, 0xc0, 0x26, 0x14, 0x54, 0x2d, 0xe5, 0xdf, 0x0e, 0xd1,
+    0xf4, 0x66, 0x0a, 0x73, 0x9f, 0xe6, 0xbb, 0x97, 0x86, 0x02, 0x01, 0x4e, 0x6a, 0xa1, 0xa1, 0x3d,
+    0x03, 0xc8, 0x3d, 0x00, 0x3c, 0x1e, 0xa5, 0xa6, 0xb0, 0xb6, 0x98, 0x9f, 0xd1, 0xf1, 0xdc, 0xbe,
+    0xbe, 0x2c, 0x59, 0xe9, 0x4a, 0xab, 0xf9, 0x67, 0x9c, 0x2a, 0x6c, 0xc5, 0xab, 0x42, 0x36, 0x97,
+    0x1f, 0x59, 0x43, 0xfb, 0x06, 0x8a, 0x56, 0x74, 0xb4, 0xb4, 0xcd, 0x93, 0x13, 0xac, 0x76, 0xe0,
+    0x0e, 0x02, 0xd3, 0x9e, 0x43, 0x0b, 0x7c, 0x6d, 0x6a, 0x7a, 0xfe, 0x0c, 0x0c, 0xb9, 0x36, 0x25,
+    0x26, 0x6c, 0x01, 0xae, 0xe7, 0xfa, 0x64, 0x72, 0x96, 0x1c, 0x51, 0x90, 0xc7, 0x92, 0x6e, 0xfd,
+    0xa4, 0xb5, 0xba, 0xd6, 0xb2, 0xbd, 0x73, 0xd6, 0x94, 0x59, 0x3f, 0x31, 0x64, 0x4f, 0x09, 0xda,
+    0x46, 0x25, 0x0c, 0xb5, 0x57, 0xc4, 0xf1, 0xd8, 0x6d, 0x3b, 0xe0, 0x6e, 0xb4, 0x03, 0x70, 0x94,
+    0xb3, 0x50, 0x47, 0x65, 0xaf, 0x53, 0xeb, 0x18, 0x3f, 0x8f, 0x26, 0xc9, 0xf9, 0x8d, 0x2a, 0xec,
+    0x9d, 0xf4, 0x1b, 0x6a, 0x34, 0x3b, 0x94, 0x55, 0x62, 0x43, 0x82, 0x82, 0x97, 0xc9, 0xd2, 0x3c,
+    0x2e, 0x17, 0x85, 0xa7, 0x43, 0xd8, 0xc0, 0x8e, 0x0c, 0x58, 0x95, 0x1a, 0x2a, 0x94, 0xf3, 0x5c,
+    0x03, 0x9d, 0x5f, 0x8c, 0xd5, 0xfb, 0xeb, 0xa2, 0x41, 0x47, 0x0e, 0x96, 0xbf, 0xf6, 0x0e, 0x6c,
+    0x51, 0x2b, 0x3d, 0xfb, 0x39, 0xc0, 0xfb, 0xad, 0x08, 0x9a, 0x80, 0xe9, 0xee, 0x52, 0x7c, 0x48,
+    0x34, 0x96, 0x2d, 0xf8, 0xb1, 0x8a, 0xfa, 0x82, 0xdb, 0x8c, 0x27, 0xc1, 0xa3, 0xdc, 0xc9, 0xc6,
+    0xe1, 0xd1, 0x32, 0x6e, 0x91, 0x04, 0xf9, 0xa0, 0x55, 0x2e, 0x02, 0x86, 0x90, 0x31, 0xfe, 0x05,
+    0x7e, 0x34, 0x87, 0xce, 0xf4, 0x78, 0x27, 0xf8, 0xc7, 0x5c, 0x98, 0x80, 0x18, 0x1f, 0x50, 0x07,
+    0x75, 0xec, 0x92, 0x5a, 0xe4, 0xff, 0x92, 0x1f, 0x8f, 0x5f, 0xa2, 0x84, 0x98, 0xa7, 0x03, 0x42,
+    0x51, 0x19, 0xcf, 0xa8, 0x92, 0xc3, 0x34, 0xb3, 0x57, 0x2e, 0x1c, 0xa8, 0x85, 0x4f, 0x30, 0xde,
+    0xc5, 0x81, 0xc1, 0x72, 0x1a, 0xa5, 0x57, 0x61, 0x96, 0xc6, 0xb2, 0xa2, 0x8e, 0x9c, 0x62, 0xcb,
+    0x76, 0x8d, 0xe9, 0x51, 0xf0, 0x1e, 0x57, 0xc9, 0x98, 0xb0, 0x81, 0x7d, 0x45, 0x94, 0xb8, 0xdb,
+    0x29, 0x61, 0x59, 0x30, 0xd3, 0x34, 0xfe, 0x03, 0x43, 0x27, 0xe1, 0x9f, 0x4c, 0x1c, 0x94, 0x08,
+    0x5b, 0x46, 0x65, 0xaf, 0xc2, 0x3b, 0xfa, 0xd4, 0x2a, 0xc2, 0x80, 0x78, 0x40, 0x94, 0x30, 0x1b,
+    0x27, 0x42, 0x54, 0x87, 0x61, 0xbe, 0x26, 0x01, 0xb8, 0x14, 0x09, 0x90, 0xc4, 0x65, 0x24, 0x8f,
+    0x38, 0x75, 0x83, 0x47, 0x72, 0x8b, 0x42, 0x27, 0x03, 0xe9, 0x8c, 0xe4, 0x64, 0xa0, 0xb8, 0xcf,
+    0x8c, 0xd0, 0x3e, 0x71, 0xea, 0x85, 0x2b, 0x45, 0xa0, 0xb4, 0x08, 0xdf, 0x51, 0x50, 0x07, 0x3c,
+    0x13, 0xd4, 0xb7, 0x12, 0xf4, 0x03, 0x27, 0xac, 0x83, 0xda, 0xb7, 0x37, 0x1c, 0x0c, 0x11, 0x35,
+    0xaa, 0x75, 0x3f, 0x0c, 0x59, 0xaf, 0xad, 0xea, 0x55, 0xd0, 0xf3, 0xd2, 0xd6, 0xf8, 0xc0, 0xb2,
+    0x8c, 0xfb, 0x24, 0x87, 0x11, 0x2b, 0x15, 0x21, 0x0f, 0x21, 0xb4, 0x03, 0x06, 0x2a, 0x3c, 0x67,
+    0x1e, 0x1b, 0xac, 0xac, 0x64, 0x77, 0x5c, 0xc1, 0x7e, 0xa3, 0xf8, 0x8a, 0x3c, 0xc2, 0x55, 0x73,
+    0x95, 0x21, 0x23, 0x19, 0xb4, 0xa3, 0x16, 0xb0, 0x45, 0x34, 0xdc, 0x24, 0xdb, 0xf5, 0xdb, 0x8b,
+    0x05, 0x51, 0xc0, 0x7c, 0x67, 0x24, 0x32, 0x40, 0xce, 0x1c, 0x41, 0xcb, 0xad, 0xa3, 0xa2, 0x7f,
+    0x93, 0x62, 0x18, 0xb9, 0xe8, 0xb8, 0x45, 0x21, 0xaa, 0x84, 0xdf, 0x10, 0xcb, 0xe7, 0xcb, 0x96,
+    0x84, 0x40, 0x22, 0x79, 0xce, 0x6e, 0xe3, 0x90, 0x5a, 0x7c, 0x4b, 0x14, 0x00, 0xea, 0x04, 0x04,
+    0xa9, 0xe1, 0x5f, 0x90, 0x67, 0xc6, 0xb8, 0x2a, 0x18, 0xaf, 0x63, 0xe1, 0x09, 0x00, 0x64, 0x14,
+    0x4d, 0x8a, 0x79, 0x69, 0x3a, 0xe9, 0xc9, 0x3b, 0x19, 0x1f, 0x43, 0x45, 0xa1, 0x64, 0xb8, 0xb5,
+    0xea, 0x86, 0xa1, 0xbb, 0x41, 0xcc, 0x8d, 0xf4, 0xe8, 0x03, 0x16, 0x93, 0x59, 0x00, 0xea, 0xe7,
+    0x7d, 0xfc, 0x12, 0x56, 0xcb, 0xfa, 0x88, 0x9a, 0xe5, 0xff, 0x0c, 0xf5, 0xd9, 0xb3, 0x03, 0xf0,
+    0xd8, 0x12, 0x4e, 0x2b, 0x72, 0x04, 0xa2, 0x33, 0x1d, 0x86, 0xf6, 0x66, 0xd5, 0x8d, 0xe8, 0x2f,
+    0x20, 0x67, 0xb7, 0x9c, 0x30, 0x8e, 0xca, 0xb8, 0x9a, 0xea, 0xa3, 0xda, 0x72, 0xbc, 0x8d, 0xb8,
+    0x09, 0xc2, 0x6f, 0xf8, 0x00, 0x84, 0x31, 0xe0, 0x9c, 0xa1, 0x42, 0x1e, 0x05, 0xb2, 0x5f, 0xfa,
+    0xba, 0x46, 0x85, 0x08, 0x36, 0xaa, 0xea, 0xc4, 0x4f, 0x4c, 0x88, 0xd1, 0x93, 0xc8, 0xf3, 0x8d,
+    0xaa, 0x76, 0x84, 0x08, 0xa5, 0x05, 0x85, 0x53, 0xe2, 0xc4, 0x41, 0xc8, 0xca, 0x00, 0xf8, 0x91,
+    0xf0, 0x3d, 0xaa, 0xeb, 0xa7, 0x61, 0x6f, 0xc4, 0x65, 0x49, 0x48, 0xd0, 0x79, 0x7e, 0xf7, 0xb7,
+    0xe4, 0xee, 0xed, 0x63, 0xb6, 0x07, 0xb3, 0x4d, 0x85, 0x12, 0x7f, 0xd0, 0xb8, 0xc6, 0xf4, 0x9d,
+    0x9a, 0x9e, 0xdc, 0x00, 0x3e, 0xf4, 0x65, 0x32, 0x0a, 0x3f, 0xcc, 0x94, 0x7f, 0xc2, 0x78, 0x60,
+    0x29, 0xd2, 0x7c, 0x6b, 0xb9, 0x51, 0xe5, 0x81, 0x12, 0x19, 0x9f, 0xc4, 0x83, 0x75, 0x04, 0x4e,
+    0x65, 0x48, 0x80, 0x91, 0x3d, 0xbd, 0x9e, 0x4f, 0xc2, 0xcd, 0xe3, 0x72, 0x05, 0x59, 0xba, 0x6c,
+    0x34, 0x3f, 0xdc, 0x1d, 0x05, 0x4d, 0xe4, 0x09, 0xf7, 0xf8, 0x00, 0x89, 0x09, 0x3d, 0x0e, 0x5a,
+    0xae, 0xba, 0x9e, 0xe7, 0x84, 0xa7, 0x97, 0xde, 0x7c, 0x03, 0x51, 0xe2, 0x05, 0x41, 0x0d, 0xf8,
+    0x33, 0xca, 0x1b, 0xe3, 0x00, 0x44, 0x8d, 0xb6, 0x22, 0x83, 0x52, 0xd3, 0xd0, 0x7d, 0x1e, 0x25,
+    0x7f, 0xfa, 0x78, 0x44, 0x28, 0x87, 0xb4, 0x6f, 0x63, 0xc4, 0x46, 0x55, 0xf5, 0x59, 0x35, 0x20,
+    0x9e, 0x32, 0xa7, 0x51, 0xd8, 0x48, 0x4b, 0xef, 0xf9, 0x89, 0x87, 0x99, 0x3d, 0xd6, 0xc4, 0x5a,
+    0x88, 0x4e, 0x74, 0x0d, 0x6c, 0xbd, 0x40, 0x79, 0x2a, 0x32, 0x88, 0x3b, 0xfa, 0x92, 0xfd, 0xfd,
+    0x13, 0x27, 0xc1, 0x31, 0xf9, 0xe6, 0x77, 0xef, 0x17, 0xba, 0x7e, 0xc8, 0x29, 0x47, 0x73, 0x30,
+    0x25, 0x2f, 0xee, 0x93, 0xdd, 0x8a, 0x09, 0x56, 0x57, 0x29, 0x65, 0x0a, 0x36, 0xf6, 0xc4, 0x50,
+    0x80, 0x2c, 0xc6, 0x14, 0x42, 0x47, 0x2a, 0xa1, 0xcc, 0xc1, 0x5e, 0x15, 0xaa, 0x16, 0x68, 0x90,
+    0xa1, 0x0c, 0x1d, 0x51, 0xa8, 0x3e, 0xab, 0x99, 0x3e, 0x59, 0x0a, 0x1d, 0xd8, 0xf8, 0x5b, 0x51,
+    0xea, 0xc5, 0xfa, 0xf7, 0x4f, 0x7e, 0xbf, 0x81, 0x94, 0x7a, 0xef, 0x31, 0xf9, 0xc9, 0xb7, 0xc9,
+    0xcc, 0x44, 0x6f, 0x18, 0x69, 0xb3, 0x93, 0x8d, 0x56, 0x5d, 0x4d, 0x02, 0x5b, 0x5f, 0x71, 0x5a,
+    0x1f, 0xc5, 0x8c, 0x39, 0x24, 0x0f, 0xbb, 0xa4, 0xd0, 0x55, 0x05, 0x9a, 0xf6, 0x71, 0x55, 0x1f,
+    0x4b, 0x1a, 0xea, 0x39, 0x1f, 0x4d, 0x50, 0xff, 0x64, 0x5d, 0x71, 0x5a, 0x8f, 0x96, 0xc2, 0x84,
+    0xdf, 0x24, 0x3f, 0xb2, 0x93, 0x68, 0xd4, 0xc7, 0x4e, 0xf2, 0x72, 0xdf, 0x05, 0x8f, 0xeb, 0xb3,
+    0x44, 0xaa, 0x6d, 0x53, 0xd0, 0x19, 0x33, 0x09, 0x61, 0x0e, 0x7f, 0x49, 0xc4, 0x9c, 0x0a, 0x45,
+    0xca, 0xc1, 0x0f, 0xe4, 0x66, 0x63, 0x95, 0x08, 0x03, 0xd5, 0xe1, 0x90, 0x45, 0x2e, 0xea, 0xa8,
+    0x4f, 0x13, 0x0c, 0xff, 0x78, 0x41, 0x9e, 0x64, 0xc9, 0xac, 0x1a, 0xcd, 0x6c, 0xa7, 0x53, 0x2b,
+    0xf6, 0x01, 0xa4, 0xce, 0x0b, 0xfc, 0x56, 0x2b, 0x49, 0xb3, 0x93, 0xc2, 0x05, 0x61, 0xcc, 0x43,
+    0x39, 0xc0, 0x40, 0x27, 0xaf, 0xac, 0xe5, 0x48, 0x61, 0x73, 0x84, 0x2a, 0xbb, 0x81, 0x85, 0x74,
+    0x46, 0x26, 0xa6, 0x96, 0xb8, 0x9d, 0x4a, 0xbb, 0xb2, 0xa4, 0xab, 0xb1, 0x4a, 0xc9, 0x44, 0x2a,
+    0x15, 0x48, 0xc3, 0xa5, 0x5c, 0xad, 0xdb, 0x98, 0x31, 0x94, 0x59, 0x98, 0x72, 0x85, 0xb3, 0xa0,
+    0x38, 0x3b, 0x75, 0x55, 0xa5, 0xbd, 0xae, 0xb6, 0x23, 0x56, 0xd5, 0x80, 0xa4, 0xcc, 0x03, 0xac,
+    0x06, 0x9d, 0xa8, 0x29, 0x47, 0xc5, 0xb2, 0x30, 0xc1, 0x84, 0x90, 0x54, 0x89, 0x68, 0x17, 0x5c,
+    0x0f, 0x34, 0x7d, 0x75, 0x16, 0xf3, 0x79, 0x17, 0xfd, 0x0e, 0x58, 0x20, 0x52, 0x6b, 0x24, 0x73,
+    0x2c, 0x25, 0x47, 0x43, 0xa9, 0x60, 0xe7, 0xf4, 0x5f, 0x24, 0x0c, 0x26, 0x82, 0xa5, 0x7d, 0x4b,
+    0x69, 0xb6, 0x30, 0x66, 0xa5, 0x51, 0x2b, 0x4c, 0x45, 0xa3, 0x26, 0x98, 0x97, 0xe6, 0xc0, 0xea,
+    0x60, 0x4a, 0x1b, 0xad, 0x00, 0x48, 0x73, 0x87, 0x89, 0x17, 0x87, 0x9b, 0xd9, 0xb5, 0xa0, 0x7c,
+    0x2a, 0xb2, 0x8e, 0x4a, 0x4e, 0x15, 0x83, 0x71, 0x64, 0x20, 0x0a, 0xa2, 0x8a, 0x28, 0x5d, 0x24,
+    0x2c, 0xb3, 0x4c, 0xab, 0xac, 0x15, 0x39, 0xb0, 0xef, 0x29, 0xe6, 0xd5, 0x17, 0x49, 0x56, 0x22,
+    0x0e, 0x9b, 0x8b, 0x20, 0x8c, 0x1d, 0x32, 0xfa, 0xb5, 0x49, 0x54, 0x67, 0xde, 0x38, 0xbb, 0x38,
+    0xfb, 0x6a, 0x59, 0x64, 0xa9, 0xd0, 0x87, 0xba, 0x12, 0x60, 0xbd, 0xe5, 0x03, 0xae, 0x99, 0x14,
+    0x2e, 0x8f, 0xf2, 0x7a, 0x39, 0x89, 0x0b, 0xb3, 0x03, 0xe5, 0x69, 0x26, 0x10, 0x22, 0x48, 0xfc,
+    0x06, 0x92, 0x1a, 0x78, 0x12, 0x8b, 0xa1, 0xc1, 0xe2, 0xdc, 0x2a, 0xb0, 0x51, 0xdb, 0xe0, 0x66,
+    0xfb, 0x60, 0x9b, 0x4d, 0x4d, 0x10, 0x0c, 0x3e, 0x98, 0x4a, 0x0f, 0x1e, 0xb9, 0xd0, 0xc8, 0x0d,
+    0xe3, 0xb1, 0xad, 0xe4, 0x64, 0xd0, 0x6d, 0x90, 0x8e, 0xa3, 0xc1, 0xa5, 0xfa, 0x83, 0x5f, 0xe8,
+    0x51, 0xd3, 0x87, 0x34, 0x03, 0x41, 0x4d, 0xea, 0xb9, 0x63, 0xca, 0x96, 0xc4, 0x36, 0xca, 0xbe,
+    0x3c, 0xa6, 0xa3, 0xcc, 0xcd, 0x4a, 0x5a, 0x09, 0x1f, 0xf7, 0xde, 0x26, 0x3b, 0xed, 0x91, 0x92,
+    0x67, 0xe6, 0xc9, 0x11, 0x06, 0x17, 0x76, 0x84, 0x8c, 0x49, 0x5d, 0x53, 0x21, 0x09, 0x0e, 0x21,
+    0x24, 0xe7, 0x80, 0x66, 0xde, 0x40, 0x9a, 0x08, 0xfe, 0x4a, 0xcb, 0xaf, 0x9f, 0x63, 0x1f, 0x4a,
+    0xa6, 0xa8, 0xb1, 0x93, 0x4f, 0xae, 0x47, 0xa7, 0xed, 0xc1, 0x8f, 0xb5, 0x4e, 0x1c, 0xfb, 0x1e,
+    0xfa, 0x39, 0x15, 0xe1, 0xf9, 0xb1, 0xa3, 0xd1, 0x35, 0x93, 0xdd, 0x56, 0xc2, 0x6a, 0xb2, 0x0d,
+    0x82, 0x3e, 0x71, 0x37, 0x25, 0xb2, 0x5f, 0x7c, 0x51, 0xa6, 0x91, 0x51, 0x0f, 0xb2, 0x07, 0x82,
+    0xa9, 0xc4, 0xe8, 0x36, 0x43, 0x1f, 0x44, 0x12, 0x89, 0x0d, 0xb1, 0x17, 0x3a, 0xcd, 0x74, 0x1a,
+    0x39, 0x38, 0x46, 0x5d, 0xe8, 0x60, 0xb2, 0x9c, 0xda, 0x1c, 0x3c, 0x83, 0x4c, 0xda, 0x59, 0x1a,
+    0xec, 0xe5, 0xf9, 0x24, 0xa6, 0x71, 0xec, 0x09, 0xf8, 0x37, 0x18, 0x84, 0x6e, 0xdb, 0x0e, 0x37,
+    0x93, 0x80, 0xe1, 0x05, 0xb7, 0x11, 0x37, 0x6b, 0x18, 0x59, 0xb2, 0x04, 0xee, 0x98, 0x41, 0x45,
+    0x34, 0x27, 0x73, 0x9a, 0x8c, 0x1f, 0x29, 0x89, 0x78, 0x30, 0xfe, 0xce, 0x9c, 0xe6, 0x6a, 0xbd,
+    0x16, 0x9c, 0xa8, 0xd3, 0x8a, 0xad, 0xd4, 0xda, 0xa5, 0x4f, 0xb5, 0x56, 0xe5, 0x7e, 0x8b, 0x95,
+    0x49, 0x17, 0x08, 0x9a, 0xf3, 0x30, 0x45, 0x12, 0x1d, 0xe0, 0xb4, 0x9d, 0xa8, 0x0e, 0x8f, 0x80,
+    0x10, 0x18, 0x21, 0xcf, 0xec, 0xc5, 0xea, 0x4b, 0x2f, 0xc2, 0xc7, 0x28, 0x7d, 0xbc, 0x5c, 0x1d,
+    0x79, 0x09, 0x3e, 0xc6, 0xc0, 0x3f, 0xc3, 0x7c, 0xbd, 0xd2, 0xb2, 0xdc, 0x2b, 0x2e, 0x79, 0x66,
+    0x03, 0xd6, 0x84, 0xa4, 0x8d, 0xb1, 0xc1, 0xc0, 0xd9, 0x9b, 0xbd, 0x08, 0xaa, 0x21, 0x06, 0xab,
+    0x10, 0xf9, 0x9d, 0x8c, 0x48, 0xb0, 0x1b, 0x76, 0x49, 0xfd, 0xec, 0x90, 0xfd, 0x91, 0xe7, 0x3a,
+    0x11, 0x9c, 0xae, 0xa1, 0x5d, 0x39, 0xcc, 0xc8, 0xc8, 0x8c, 0xe2, 0xe3, 0x03, 0x19, 0xc8, 0x6f,
+    0x82, 0x69, 0xd6, 0x09, 0x35, 0xc8, 0x9f, 0x1e, 0x81, 0xa3, 0x0d, 0xd8, 0xfa, 0xaa, 0x26, 0x8e,
+    0xae, 0x53, 0xd7, 0x09, 0x32, 0x52, 0x3d, 0x91, 0x12, 0x64, 0x64, 0xb4, 0xfa, 0xd2, 0x4b, 0x44,
+    0x91, 0x6f, 0x45, 0x04, 0xa7, 0xfe, 0xb7, 0x10, 0x61, 0x76, 0x46, 0x94, 0xda, 0x98, 0x2c, 0x58,
+    0x3e, 0x9c, 0x18, 0x4e, 0xfd, 0x6f, 0x23, 0x46, 0xd1, 0x18, 0x19, 0xa2, 0x98, 0x39, 0x08, 0x99,
+    0xcb, 0x1e, 0xea, 0x24, 0xae, 0xe8, 0x58, 0x5d, 0x7c, 0x1f, 0x4c, 0x88, 0xc1, 0x91, 0x24, 0x23,
+    0x21, 0x93, 0x41, 0xf0, 0xa9, 0x3c, 0xe3, 0x45, 0x93, 0x64, 0xcf, 0x8c, 0xd7, 0xe7, 0xe0, 0xef,
+    0x1c, 0x90, 0x45, 0x40, 0x51, 0x41, 0x3e, 0x25, 0x00, 0xe4, 0x82, 0xd3, 0xa2, 0x34, 0x36, 0x28,
+    0x83, 0xb0, 0x3b, 0x74, 0x54, 0xbe, 0xdd, 0xbb, 0x59, 0xce, 0x1c, 0x60, 0x5a, 0x18, 0x4b, 0x27,
+    0xfb, 0xe7, 0x91, 0xbc, 0x2b, 0x20, 0xdd, 0xad, 0xfb, 0x60, 0xc7, 0xbd, 0x27, 0x0f, 0xa0, 0xaf,
+    0xf3, 0xc9, 0xc2, 0xb6, 0x3c, 0x89, 0xd9, 0xa7, 0x23, 0x4a, 0x80, 0x8f, 0x5b, 0xa4, 0x22, 0x70,
+    0x6f, 0x54, 0x84, 0xdc, 0x14, 0x7c, 0xe7, 0xe0, 0x9a, 0x32, 0x95, 0xbb, 0xfb, 0x35, 0xb1, 0xf0,
+    0xf5, 0x03, 0xf4, 0x4e, 0xab, 0x2f, 0x9f, 0xb4, 0x30, 0x40, 0xc3, 0x28, 0x72, 0x12, 0xa8, 0x28,
+    0x8d, 0x1e, 0x01, 0xc3, 0x2f, 0x32, 0x23, 0xbf, 0x3e, 0xd3, 0x12, 0xc8, 0x8c, 0x78, 0x54, 0x43,
+    0x7c, 0x28, 0xda, 0x2a, 0x93, 0x14, 0x9c, 0x38, 0x3a, 0xb9, 0xc1, 0xfb, 0x20, 0x1c, 0xa4, 0xd6,
+    0x8f, 0x4c, 0xd3, 0x63, 0x3c, 0xca, 0x3a, 0xc0, 0xc8, 0x38, 0x1e, 0xbf, 0x2a, 0xb4, 0xd2, 0x63,
+    0x60, 0x2b, 0xa5, 0xe4, 0x41, 0x49, 0xb3, 0x88, 0x00, 0xe7, 0xc3, 0xe6, 0xa2, 0xfc, 0x05, 0x64,
+    0xe6, 0xa3, 0x87, 0x67, 0x52, 0xe9, 0xe0, 0x09, 0xef, 0xaf, 0x88, 0xf4, 0x4f, 0xd2, 0x33, 0x5e,
+    0x4e, 0x86, 0xd8, 0xe5, 0xa0, 0x2e, 0x9d, 0xe1, 0x52, 0xea, 0x03, 0x35, 0xc3, 0xbb, 0x32, 0xa9,
+    0x47, 0x62, 0x7a, 0xb7, 0xbd, 0xf7, 0xe9, 0x90, 0xf5, 0xcb, 0x4c, 0x4a, 0x84, 0x4a, 0x16, 0x45,
+    0x3c, 0xbf, 0xbe, 0x3f, 0xfa, 0xbc, 0x46, 0x7f, 0x4a, 0x9d, 0x9d, 0x9b, 0x7f, 0x3d, 0x87, 0xe7,
+    0x5d, 0xb4, 0xed, 0x93, 0x18, 0xbf, 0x16, 0xc3, 0x67, 0xb2, 0xa1, 0xce, 0xa4, 0x13, 0x4d, 0x68,
+    0xf4, 0x24, 0x39, 0x81, 0xd6, 0x4e, 0xb2, 0x1f, 0xf0, 0xb1, 0x5d, 0xe2, 0x13, 0xa4, 0x91, 0xfb,
+    0x87, 0x78, 0x4c, 0xfa, 0x2b, 0x02, 0x4e, 0x26, 0x3f, 0xce, 0xca, 0x24, 0x7d, 0x7a, 0x08, 0xaa,
+    0xef, 0x90, 0x5f, 0x0a, 0xe6, 0x51, 0xa2, 0xfa, 0xe5, 0xfc, 0xa6, 0xd8, 0xa7, 0x9b, 0x32, 0xda,
+    0x01, 0x56, 0x2a, 0xe0, 0x17, 0x65, 0x48, 0xbd, 0x58, 0x79, 0xa6, 0x0a, 0x02, 0x46, 0xcc, 0xe9,
+    0x70, 0x99, 0x72, 0xac, 0xf6, 0x52, 0xe1, 0x5e, 0x2f, 0xda, 0x60, 0x78, 0x01, 0x47, 0x2a, 0x92,
+    0x0a, 0xe6, 0x8e, 0x5a, 0xb9, 0x9e, 0xdb, 0xb4, 0x38, 0xc1, 0x69, 0xab, 0x78, 0x5c, 0x3d, 0x4b,
+    0xba, 0xcf, 0xb0, 0xa3, 0x85, 0xc3, 0x2a, 0x71, 0x0d, 0x52, 0xb9, 0xff, 0xb0, 0xb3, 0x33, 0x7d,
+    0x86, 0x3d, 0x52, 0x9e, 0x78, 0xb2, 0xa9, 0x72, 0x48, 0x41, 0xd7, 0x65, 0x53, 0x12, 0x23, 0xc0,
+    0x05, 0x67, 0xdd, 0x01, 0xcb, 0x99, 0x6f, 0xa3, 0x75, 0xff, 0x53, 0xe7, 0x77, 0xc5, 0x5f, 0x45,
+    0xfb, 0xaa, 0x04, 0x4c, 0xab, 0xe4, 0xf0, 0x88, 0x4a, 0x9f, 0x1e, 0x3d, 0x59, 0x1d, 0xb6, 0xca,
+    0x95, 0xfc, 0x20, 0x89, 0xc0, 0x2f, 0x12, 0xf6, 0x47, 0x1e, 0xa5, 0xbc, 0x72, 0x20, 0xdd, 0x8a,
+    0x60, 0xf4, 0xae, 0xf6, 0xa1, 0xa5, 0x9e, 0x06, 0x5f, 0x98, 0x30, 0xff, 0xad, 0x08, 0xa9, 0xa0,
+    0x1d, 0x46, 0xcc, 0x82, 0xb3, 0xc6, 0xd2, 0xf3, 0x39, 0x32, 0x9e, 0x1c, 0x2e, 0x20, 0xa3, 0x1a,
+    0xe2, 0x50, 0x52, 0x1e, 0x32, 0xc6, 0x21, 0x44, 0xcc, 0xf7, 0xee, 0x43, 0x40, 0x2f, 0x38, 0x97,
+    0x24, 0xf8, 0x63, 0xde, 0x53, 0xf1, 0x36, 0x00, 0x19, 0x52, 0x2c, 0xac, 0xca, 0x79, 0x22, 0x02,
+    0xc4, 0x39, 0xed, 0x3a, 0x80, 0x7e, 0x6b, 0x80, 0xe2, 0x88, 0x7d, 0x20, 0x65, 0xa9, 0x57, 0x44,
+    0x3c, 0x00, 0x3d, 0x6f, 0x5c, 0x15, 0xc8, 0xde, 0x2b, 0xf8, 0x2e, 0x06, 0xd0, 0x2f, 0x13, 0x98,
+    0xd7, 0x0e, 0xbe, 0x35, 0xf4, 0x95, 0x03, 0xe5, 0x12, 0x90, 0x9b, 0x33, 0x76, 0x40, 0xcf, 0xb0,
+    0xe6, 0x79, 0x80, 0xa1, 0x1e, 0x99, 0xd3, 0x84, 0x2a, 0xe8, 0xef, 0xa4, 0x0a, 0x0c, 0xb9, 0xaf,
+    0xee, 0xe7, 0xfe, 0x4b, 0xd1, 0x99, 0x7d, 0x7e, 0xd7, 0xa0, 0x16, 0x2f, 0x30, 0x8c, 0xc0, 0xa1,
+    0x91, 0xd9, 0x0d, 0x87, 0x38, 0x29, 0x59, 0x8f, 0xc4, 0xf1, 0x30, 0xa7, 0xc5, 0xc2, 0xdc, 0xb5,
+    0x3d, 0x40, 0xfe, 0x06, 0x9a, 0x73, 0xcc, 0xc1, 0xb9, 0xb1, 0x7b, 0x57, 0x13, 0xff, 0xe4, 0xa0,
+    0xa1, 0x60, 0x66, 0xbe, 0xd7, 0x28, 0x1c, 0xac, 0xe1, 0x46, 0x72, 0x34, 0x99, 0x99, 0xf5, 0x5d,
+    0x8c, 0xd7, 0xc0, 0x18, 0x7a, 0x98, 0x1f, 0x0c, 0x7c, 0x23, 0x07, 0x5c, 0xa3, 0xee, 0x3d, 0x86,
+    0x88, 0xa9, 0x2e, 0x72, 0x20, 0x8e, 0x8c, 0xd1, 0xa2, 0xc9, 0x7c, 0x92, 0xa7, 0xc9, 0x48, 0x85,
+    0x9e, 0x14, 0x87, 0x44, 0x66, 0xb2, 0xea, 0xb6, 0x44, 0x01, 0x11, 0x2d, 0xff, 0x19, 0x83, 0x20,
+    0xd2, 0x87, 0x08, 0x9a, 0xab, 0x09, 0x2e, 0x24, 0x64, 0x40, 0x0b, 0x92, 0x3f, 0xe1, 0xd4, 0x33,
+    0x15, 0xa0, 0xa7, 0xa8, 0x42, 0x3b, 0x37, 0xc8, 0xb4, 0x28, 0xb6, 0xc9, 0x92, 0xcb, 0x4a, 0x24,
+    0xcf, 0xb2, 0x5d, 0x72, 0xf7, 0x96, 0x78, 0x10, 0xd8, 0x60, 0x99, 0x96, 0xb8, 0x0b, 0x56, 0x56,
+    0x92, 0xc0, 0x5e, 0xce, 0xa4, 0x30, 0x83, 0x79, 0x38, 0x63, 0x3a, 0x94, 0x81, 0xbf, 0xd5, 0xa8,
+    0x53, 0xaf, 0x3b, 0x51, 0x24, 0x4e, 0x0d, 0x1c, 0x94, 0xee, 0x7b, 0xb0, 0x4d, 0x03, 0xd4, 0xaf,
+    0x91, 0x69, 0x36, 0x11, 0x90, 0x43, 0x4c, 0x34, 0xad, 0x6a, 0x68, 0xac, 0x32, 0x87, 0x36, 0xd0,
+    0x75, 0xa7, 0x88, 0x76, 0xca, 0xa8, 0x3b, 0x74, 0x5c, 0x81, 0x8e, 0xbc, 0x8c, 0x7d, 0x5e, 0xc9,
+    0x54, 0x49, 0x93, 0x2b, 0x98, 0xca, 0x24, 0x3e, 0xca, 0xa6, 0x19, 0xa1, 0x50, 0x9c, 0x93, 0x22,
+    0xd1, 0x43, 0x43, 0x99, 0x2c, 0x47, 0xb9, 0xca, 0xd5, 0x75, 0xb7, 0x15, 0x3b, 0x21, 0xb8, 0x83,
+    0xda, 0x51, 0x25, 0xe2, 0xae, 0x4e, 0x1c, 0x31, 0xde, 0x10, 0x87, 0xe0, 0xb7, 0x49, 0xaf, 0xb1,
+    0x42, 0xb7, 0x03, 0xb9, 0x1d, 0x4d, 0x84, 0x5c, 0x46, 0x28, 0x2a, 0xe7, 0xb3, 0xe3, 0x0a, 0xa3,
+    0xd5, 0xdf, 0x22, 0xd0, 0xcb, 0xe2, 0x8c, 0x49, 0x8e, 0xe7, 0x59, 0xd9, 0x38, 0x73, 0xcb, 0xb7,
+    0x1b, 0x79, 0x6e, 0x46, 0x4e, 0x4e, 0x23, 0xa3, 0x98, 0x8b, 0xa1, 0x2d, 0xc3, 0x50, 0xa4, 0xd8,
+    0x41, 0x0b, 0x92, 0xe6, 0x60, 0xa8, 0x78, 0x29, 0x87, 0xe4, 0xfa, 0x6d, 0x1b, 0xba, 0xdb, 0x5b,
+    0xce, 0x45, 0xbe, 0x39, 0xb6, 0xc1, 0x21, 0xa5, 0x36, 0xf0, 0x95, 0xbd, 0x01, 0x5e, 0x36, 0xde,
+    0x76, 0xbd, 0x34, 0xa0, 0x1f, 0xfa, 0xca, 0x10, 0x88, 0xc9, 0x97, 0x1a, 0xb9, 0x92, 0x0b, 0x88,
+    0x4c, 0x37, 0x62, 0x2a, 0xff, 0x1c, 0xb2, 0x8f, 0x3c, 0x1a, 0x21, 0x8e, 0x91, 0xe4, 0xe4, 0xe8,
+    0xcf, 0x78, 0xee, 0xc8, 0x49, 0x8e, 0x5f, 0x4e, 0x22, 0x4c, 0xb9, 0x5b, 0x18, 0x73, 0xa4, 0xb7,
+    0xa2, 0x92, 0xdb, 0xd0, 0x6f, 0x42, 0xc2, 0x17, 0x5f, 0x6d, 0x6c, 0x20, 0x01, 0xf4, 0x6b, 0x27,
+    0xf2, 0xe6, 0x71, 0x55, 0x5e, 0x22, 0x49, 0xa3, 0xb8, 0x33, 0xd3, 0x6f, 0x9c, 0x79, 0x65, 0x61,
+    0x7a, 0xe9, 0xcc, 0xd9, 0x39, 0xbe, 0x1f, 0x87, 0x37, 0xb3, 0x4a, 0xc6, 0xd1, 0xf7, 0x79, 0x28,
+    0xd7, 0xc7, 0x5c, 0xd6, 0x62, 0x2c, 0x23, 0x7c, 0xbe, 0xae, 0xec, 0x19, 0xf9, 0xa9, 0x6a, 0x47,
+    0xcd, 0xda, 0x51, 0xb3, 0x76, 0xcc, 0xac, 0x1d, 0xb3, 0x56, 0x52, 0xe7, 0xff, 0x7c, 0x35, 0xf2,
+    0xdb, 0x0e, 0x5f, 0x84, 0xc1, 0x4b, 0x1b, 0xb8, 0x68, 0x40, 0xb8, 0x4b, 0x8e, 0xec, 0xbb, 0x3a,
+    0x52, 0x13, 0xe7, 0x97, 0x87, 0x57, 0x70, 0xad, 0xb8, 0x3b, 0x97, 0x60, 0xd4, 0x24, 0x69, 0x33,
+    0x8a, 0x25, 0xa3, 0x7a, 0x1b, 0x2a, 0x19, 0xd3, 0xdb, 0x8c, 0x61, 0xc9, 0x09, 0xbd, 0x0d, 0x95,
+    0x9c, 0x5c, 0xd9, 0x02, 0x1a, 0xf1, 0xad, 0xbd, 0xc3, 0xa8, 0x91, 0x06, 0x5b, 0x46, 0xf8, 0x96,
+    0xa5, 0x41, 0x8d, 0xb4, 0x76, 0xd4, 0xac, 0x1d, 0xfd, 0xff, 0x9b, 0x2f, 0xcf, 0x85, 0x2f, 0xe4,
+    0x1d, 0x36, 0x9b, 0x9c, 0x3b, 0x61, 0x98, 0xfe, 0x47, 0x40, 0x39, 0x54, 0x9d, 0xb3, 0x18, 0x33,
+    0xbe, 0x8c, 0x8b, 0x52, 0x1c, 0x87, 0xe3, 0x53, 0x68, 0x95, 0xe7, 0xec, 0xe8, 0xef, 0x0a, 0x2f,
+    0xd0, 0x50, 0x87, 0xa3, 0x94, 0xb1, 0x71, 0x73, 0x76, 0xa9, 0x61, 0x47, 0xae, 0xb0, 0x08, 0xbe,
+    0x88, 0x20, 0x2f, 0x72, 0x9a, 0x4b, 0x82, 0xea, 0x25, 0x95, 0xac, 0xa2, 0x50, 0x4a, 0x33, 0x55,
+    0xd4, 0xe2, 0x26, 0x69, 0x2a, 0xbc, 0xb6, 0x5b, 0xea, 0x84, 0x27, 0xbb, 0x79, 0x57, 0x7f, 0xb4,
+    0xf0, 0x06, 0x6d, 0x60, 0xdc, 0xbf, 0xec, 0x53, 0x23, 0xef, 0xb2, 0x97, 0xcb, 0x2b, 0x9f, 0xb9,
+    0x73, 0x9c, 0x2e, 0x81, 0xee, 0x47, 0x11, 0x01, 0xc8, 0x2f, 0x30, 0x2e, 0x62, 0x2a, 0xa5, 0x5d,
+    0x32, 0xae, 0x5e, 0xca, 0x6b, 0xef, 0xba, 0x0c, 0xa1, 0xfc, 0xa0, 0x92, 0x3a, 0x59, 0x52, 0xd7,
+    0xfa, 0xb3, 0x02, 0xd6, 0xa2, 0x9c, 0x8e, 0x3f, 0x53, 0x22, 0xc1, 0x55, 0x99, 0x7a, 0xbc, 0x5d,
+    0x61, 0x55, 0xc2, 0x29, 0x76, 0x2a, 0x7e, 0x03, 0x56, 0xf1, 0xe5, 0xae, 0xca, 0x4d, 0xa7, 0x2c,
+    0xd5, 0x75, 0xbb, 0x45, 0x77, 0xe8, 0xd2, 0xf3, 0xa8, 0xe4, 0x29, 0x81, 0xbc, 0xde, 0x40, 0x35,
+    0x97, 0xa5, 0x12, 0xa1, 0x28, 0x9f, 0x1c, 0x60, 0x7d, 0x42, 0x76, 0x45, 0x72, 0x38, 0xa4, 0x5b,
+    0x17, 0xe9, 0x5c, 0x7f, 0xda, 0x01, 0xb0, 0xf1, 0xa6, 0xb4, 0x42, 0xaa, 0xe1, 0x6a, 0x04, 0x25,
+    0xc0, 0x3d, 0x99, 0x67, 0x24, 0x40, 0xd0, 0x63, 0x20, 0x6e, 0x92, 0x14, 0x6c, 0xa6, 0x65, 0x92,
+    0xf1, 0x46, 0xe5, 0x0a, 0x20, 0x25, 0xbd, 0x01, 0x83, 0xea, 0x85, 0xe3, 0x79, 0x8a, 0x91, 0xf5,
+    0x51, 0xe4, 0x9e, 0x91, 0x9a, 0x45, 0xeb, 0xec, 0xe7, 0x6c, 0x90, 0x80, 0xc2, 0x51, 0xa0, 0x01,
+    0x19, 0xce, 0x29, 0x50, 0x05, 0x74, 0x50, 0x51, 0x61, 0xcb, 0x60, 0x7c, 0xa0, 0x8f, 0x22, 0x4e,
+    0x32, 0x4f, 0x0a, 0xd6, 0x2d, 0xab, 0xfd, 0x19, 0x3c, 0x93, 0x8c, 0x0f, 0xda, 0xe8, 0xe0, 0xe7,
+    0x2e, 0x98, 0x40, 0x78, 0xda, 0xf3, 0x40, 0x06, 0x28, 0xa5, 0x53, 0x9b, 0x66, 0xbd, 0x6c, 0x23,
+    0x1a, 0x6a, 0x25, 0xf1, 0xc0, 0xce, 0x50, 0xdd, 0x87, 0x0e, 0x8b, 0x07, 0xde, 0xfb, 0x7c, 0xb4,
+    0xa4, 0x32, 0x8a, 0x35, 0xde, 0x30, 0x95, 0x3b, 0xbf, 0xf3, 0xa3, 0xcd, 0xb3, 0xc4, 0x47, 0xcc,
+    0x2a, 0x3d, 0x93, 0xbf, 0x38, 0xeb, 0x8f, 0xad, 0x76, 0x34, 0x31, 0x9f, 0xa3, 0x57, 0x82, 0xc2,
+    0x36, 0xba, 0x48, 0x5f, 0xa8, 0xe3, 0x79, 0x4a, 0xb0, 0x55, 0x9e, 0x7a, 0xef, 0xfa, 0x29, 0x41,
+    0xd1, 0x01, 0xba, 0x95, 0xa0, 0x59, 0xf9, 0x09, 0xcf, 0x16, 0x58, 0x9b, 0xc5, 0xf6, 0x3f, 0x65,
+    0x4d, 0x1b, 0xef, 0x23, 0x6d, 0xe3, 0x15, 0xc9, 0x72, 0x9a, 0x1e, 0x6a, 0xec, 0xb7, 0x02, 0x8c,
+    0x4f, 0x69, 0x2c, 0x88, 0x6a, 0x83, 0xad, 0xd6, 0x9a, 0xd1, 0x54, 0x3a, 0x5b, 0xb0, 0xaf, 0x0f,
+    0xd9, 0x30, 0xdc, 0xa9, 0xcf, 0x0e, 0xc1, 0xb5, 0x59, 0xf2, 0x6d, 0xb0, 0x45, 0x4d, 0x2b, 0x5c,
+    0x72, 0xe8, 0xc7, 0x74, 0x37, 0x8f, 0xe2, 0x85, 0xba, 0x6d, 0xfc, 0xdd, 0x30, 0x4c, 0x76, 0x44,
+    0xf9, 0x93, 0x06, 0x22, 0x60, 0xd6, 0x81, 0x5c, 0x9d, 0x67, 0x32, 0x9e, 0xc8, 0x91, 0xd9, 0x4b,
+    0x0d, 0x52, 0xce, 0x27, 0x14, 0xe8, 0xfc, 0x95, 0xe6, 0x14, 0xe4, 0xf1, 0xe0, 0x4b, 0xb1, 0x69,
+    0x71, 0x92, 0x2c, 0x64, 0x07, 0x01, 0x58, 0x95, 0xf9, 0x73, 0xf2, 0x7a, 0xcb, 0xad, 0x63, 0x90,
+    0xc6, 0xf7, 0x34, 0x60, 0x33, 0x58, 0x58, 0x2e, 0x3e, 0x8a, 0xd6, 0xc1, 0xf1, 0xfb, 0x31, 0x47,
+    0x87, 0x68, 0x4e, 0x2c, 0xdf, 0xa0, 0xa4, 0xbd, 0xb3, 0x43, 0xa9, 0xb2, 0xc2, 0xa9, 0x72, 0x1e,
+    0x35, 0x1d, 0xcf, 0x03, 0x2b, 0x26, 0x73, 0x73, 0xa4, 0x0a, 0x20, 0x85, 0xa1, 0xd8, 0x18, 0x4b,
+    0x72, 0xda, 0x82, 0x40, 0x1a, 0x0a, 0x46, 0x93, 0x40, 0xf9, 0xdd, 0x2b, 0x1b, 0x98, 0xaf, 0x95,
+    0xd0, 0x53, 0x5c, 0x99, 0x73, 0x46, 0xbc, 0xa1, 0x5e, 0xc7, 0x64, 0x47, 0xa2, 0x39, 0x7f, 0x71,
+    0x46, 0x47, 0xdc, 0xc4, 0xdc, 0x8f, 0xc0, 0xb1, 0xcf, 0xc9, 0xbb, 0xc7, 0xfc, 0x1e, 0x0c, 0xb4,
+    0x4a, 0x6b, 0x94, 0xe7, 0x87, 0xf0, 0x8c, 0xf6, 0xc5, 0xd7, 0x5d, 0xc6, 0xf0, 0xd2, 0xcd, 0x27,
+    0x62, 0x09, 0x5b, 0x2e, 0x52, 0xcb, 0xa2, 0x98, 0x0a, 0x3d, 0x72, 0x62, 0x84, 0x13, 0xf8, 0x98,
+    0x9e, 0x3f, 0xac, 0x03, 0x82, 0x19, 0x18, 0x71, 0x8f, 0xa3, 0x05, 0x8e, 0x2a, 0xc0, 0x50, 0x1f,
+    0x8b, 0x7c, 0x68, 0x81, 0xdf, 0xd9, 0xda, 0x4b, 0x2f, 0xac, 0x69, 0x31, 0x0c, 0x71, 0xf4, 0x51,
+    0x93, 0x68, 0x0d, 0x8f, 0xf9, 0xaa, 0x6b, 0x6f, 0x78, 0x20, 0x30, 0xdc, 0x7a, 0x64, 0x69, 0x77,
+    0x82, 0x1f, 0xd1, 0x20, 0xf7, 0xd5, 0x4e, 0xe5, 0xfb, 0xa9, 0x0f, 0xd3, 0xab, 0x58, 0x9c, 0xcb,
+    0x68, 0xc6, 0x35, 0xb4, 0xb7, 0x70, 0xe4, 0xe9, 0x5e, 0xe6, 0xdd, 0xb4, 0xcc, 0x65, 0x62, 0x89,
+    0x98, 0xeb, 0xad, 0xfb, 0x83, 0x6b, 0x18, 0xb1, 0xb4, 0xb4, 0xfb, 0xc5, 0xb2, 0xa4, 0xdf, 0xcd,
+    0x1e, 0xad, 0x13, 0x5e, 0x3d, 0xe8, 0x7e, 0x4e, 0xf8, 0xb2, 0x8c, 0xd9, 0x57, 0x39, 0x09, 0x18,
+    0x66, 0xe3, 0x1b, 0x09, 0xd9, 0xa4, 0x3f, 0xe2, 0x16, 0xb0, 0xdc, 0xbc, 0xce, 0x3a, 0x88, 0x43,
+    0xb0, 0x98, 0xe4, 0x95, 0xad, 0xb5, 0x90, 0xa0, 0xfd, 0x4e, 0xde, 0x9a, 0x4a, 0xfa, 0x5b, 0xe6,
+    0x45, 0x2f, 0xd5, 0xdf, 0x6f, 0x38, 0x2d, 0xa3, 0x23, 0x26, 0x3a, 0xbe, 0x4b, 0x4b, 0x76, 0x33,
+    0xe9, 0x58, 0x30, 0xf0, 0x79, 0xb0, 0x34, 0xdd, 0x24, 0xe7, 0xf0, 0xc0, 0x1b, 0x5f, 0xa6, 0xe7,
+    0x39, 0x18, 0xfb, 0x81, 0xf6, 0xde, 0x0d, 0x74, 0xc1, 0xbc, 0x11, 0xc1, 0x6f, 0x22, 0x01, 0xbf,
+    0xc2, 0x42, 0x5a, 0x52, 0xc0, 0x4f, 0xe2, 0xf3, 0x7b, 0xa4, 0x3d, 0x4c, 0x08, 0x6b, 0x3e, 0xac,
+    0x59, 0x9b, 0xee, 0x6a, 0xb3, 0x67, 0xaa, 0xbf, 0x41, 0x94, 0x63, 0xa2, 0xa8, 0xb3, 0xd6, 0x76,
+    0x63, 0xab, 0x4f, 0x5c, 0x0c, 0x97, 0xf8, 0xbd, 0x02, 0x56, 0xcd, 0xea, 0xbb, 0x5d, 0x8d, 0x55,
+    0x10, 0xe1, 0x23, 0xe1, 0x8e, 0x3b, 0xf6, 0xef, 0x82, 0x7c, 0xba, 0xef, 0x24, 0xfe, 0xf2, 0xe1,
+    0x3d, 0x23, 0xd4, 0xb1, 0xcb, 0xe7, 0x8f, 0x39, 0xb4, 0x75, 0xe9, 0xd2, 0x7f, 0xf5, 0x0e, 0xbd,
+    0x18, 0x23, 0x65, 0xda, 0x6a, 0xdf, 0xeb, 0x2a, 0x66, 0x83, 0xdc, 0xd5, 0x18, 0x3d, 0x0a, 0x43,
+    0x37, 0x5d, 0xd3, 0x5d, 0x86, 0xc2, 0xc1, 0xbc, 0x2f, 0xd3, 0x74, 0xec, 0x56, 0xdc, 0x2c, 0x18,
+    0x84, 0x2b, 0x08, 0xb8, 0x84, 0x4b, 0x96, 0xf8, 0x51, 0x36, 0x7f, 0xb9, 0x28, 0x85, 0xa7, 0xe1,
+    0xc7, 0x25, 0xf9, 0x44, 0x58, 0x22, 0xa7, 0xf1, 0x89, 0xb2, 0x24, 0x27, 0x56, 0x05, 0xae, 0x50,
+    0xbd, 0x43, 0xe3, 0x41, 0xff, 0x1c, 0x6a, 0x77, 0xad, 0x92, 0x4c, 0x3c, 0x55, 0x0b, 0xfa, 0x38,
+    0x53, 0x6d, 0x5d, 0xb0, 0x43, 0xcf, 0x52, 0xf5, 0xfc, 0x51, 0x93, 0xa0, 0xd6, 0xd7, 0xd3, 0x97,
+    0x2d, 0xcc, 0x3c, 0x60, 0x29, 0x51, 0xa0, 0x15, 0x09, 0x02, 0xc4, 0xc8, 0x78, 0x72, 0xa1, 0xf0,
+    0x96, 0x0f, 0x91, 0x5f, 0xc5, 0x62, 0xb5, 0x64, 0x49, 0xd4, 0x8a, 0xc9, 0x86, 0x66, 0x85, 0xd3,
+    0x84, 0x5f, 0xe8, 0x39, 0xc0, 0xec, 0x1b, 0xd5, 0x0b, 0xee, 0xba, 0xbb, 0x0a, 0x6d, 0x3d, 0xf2,
+    0xda, 0xa5, 0x74, 0x98, 0x7a, 0xdb, 0x7d, 0xcd, 0x4d, 0x45, 0x49, 0xae, 0x19, 0xce, 0x88, 0xe5,
+    0xae, 0x11, 0x65, 0xdc, 0x67, 0x87, 0xc2, 0x51, 0xed, 0xdd, 0x80, 0xe0, 0x55, 0x84, 0x51, 0x0a,
+    0x0e, 0x64, 0x43, 0x96, 0x2f, 0x2c, 0x2e, 0x9e, 0x61, 0xdf, 0x84, 0xab, 0x42, 0xa8, 0x23, 0xc7,
+    0xa4, 0xf1, 0x4a, 0x9b, 0xdc, 0x10, 0xb2, 0xc5, 0xe4, 0x2a, 0x9b, 0x43, 0x59, 0x89, 0x20, 0x03,
+    0x32, 0xd2, 0x8c, 0x8e, 0xab, 0x29, 0xb5, 0x7f, 0x1a, 0xc7, 0x5a, 0xa8, 0x54, 0x16, 0xa4, 0xc8,
+    0xd7, 0xa4, 0x65, 0x2e, 0xe7, 0xfa, 0xe6, 0x3f, 0x2e, 0x2d, 0xa5, 0xd2, 0x2f, 0xd7, 0x7f, 0xa0,
+    0x94, 0x03, 0xd0, 0x67, 0xf6, 0x8c, 0xb0, 0x66, 0xb9, 0xe9, 0xf0, 0x60, 0x69, 0x01, 0x28, 0xd9,
+    0x98, 0xa7, 0x94, 0xe7, 0xe5, 0xe4, 0x2b, 0xcb, 0x89, 0x07, 0x66, 0xa1, 0xc5, 0xcd, 0x00, 0xaf,
+    0x1c, 0x79, 0xea, 0x79, 0x8b, 0x01, 0x46, 0x7b, 0xce, 0x28, 0xd7, 0x10, 0xc9, 0x10, 0x22, 0x35,
+    0x17, 0x0c, 0x72, 0x14, 0xc1, 0x1c, 0x28, 0xf5, 0x83, 0x79, 0xca, 0x24, 0x41, 0x2d, 0x59, 0xfb,
+    0xc2, 0xe6, 0x98, 0x8c, 0x5c, 0x50, 0x17, 0x74, 0xd6, 0xf8, 0xba, 0x43, 0x51, 0x05, 0x5d, 0x59,
+    0x1b, 0xb6, 0xd4, 0x2a, 0xf0, 0xad, 0x4d, 0xba, 0x1c, 0x70, 0x93, 0x12, 0x3d, 0xe8, 0xe9, 0xcf,
+    0x27, 0xbc, 0xed, 0x39, 0xfb, 0xa3, 0x3f, 0x12, 0x00, 0xaf, 0xac, 0xd8, 0x8c, 0xde, 0x11, 0xc8,
+    0x76, 0xee, 0x3e, 0xa6, 0x65, 0x18, 0xf8, 0x76, 0xcb, 0xd0, 0x84, 0x7d, 0x9c, 0x9a, 0x6c, 0x4c,
+    0xdd, 0xd3, 0x7e, 0xdb, 0x11, 0xd3, 0xc0, 0xe0, 0xb0, 0xbd, 0xbd, 0xd8, 0xa0, 0xb0, 0xde, 0x9c,
+    0xa6, 0x75, 0xbb, 0x98, 0xb1, 0x8e, 0x8e, 0x80, 0xcc, 0xe5, 0xc5, 0x88, 0x31, 0x8f, 0x8e, 0xd7,
+    0x2a, 0x54, 0x1c, 0xdf, 0x18, 0x3b, 0x69, 0xc9, 0x2b, 0xd7, 0xdd, 0xeb, 0xc7, 0xc5, 0xb2, 0x61,
+    0x3f, 0x3e, 0xce, 0x55, 0x9b, 0x9c, 0x6c, 0xde, 0x42, 0x90, 0xa6, 0x90, 0x19, 0xb7, 0x6e, 0x92,
+    0x80, 0xca, 0x04, 0xc2, 0x53, 0x9e, 0xd4, 0x2c, 0xbf, 0x82, 0xf0, 0xbc, 0xb6, 0xb0, 0x0d, 0xcd,
+    0x44, 0xcc, 0x39, 0x8c, 0x28, 0xff, 0x64, 0x40, 0x1b, 0xad, 0x6d, 0x14, 0xd2, 0x40, 0x9a, 0x4f,
+    0xbb, 0xb7, 0xc0, 0x57, 0xbc, 0x0b, 0xd3, 0xbf, 0xd7, 0xfd, 0x12, 0xbe, 0xee, 0x74, 0x6f, 0x89,
+    0xa5, 0xd3, 0x67, 0xe6, 0x7e, 0xb0, 0x38, 0x3f, 0x3b, 0xfd, 0x3a, 0x8a, 0xf2, 0x9f, 0xe0, 0x7b,
+    0x54, 0xaa, 0x23, 0x3e, 0xb7, 0xa3, 0x1f, 0xe5, 0xe8, 0x6e, 0x24, 0xcd, 0x8c, 0x97, 0x91, 0xdf,
+    0x1d, 0xf8, 0x04, 0x60, 0x7f, 0xd4, 0xfd, 0x2d, 0xc0, 0xbe, 0x03, 0x90, 0xbf, 0x80, 0xbf, 0xb7,
+    0xa1, 0xe4, 0x6e, 0x12, 0x64, 0xd1, 0xd6, 0x9d, 0x9f, 0x46, 0xb8, 0x05, 0x0d, 0x11, 0x89, 0xdb,
+    0xdd, 0xdf, 0x70, 0x33, 0x70, 0xfa, 0xff, 0xc8, 0xaf, 0xfd, 0xde, 0x01, 0x38, 0xff, 0xd5, 0xfd,
+    0x03, 0x55, 0x10, 0x7d, 0x73, 0x68, 0x91, 0xe0, 0xd6, 0xd0, 0x29, 0x94, 0xdb, 0x9f, 0xc1, 0x94,
+    0x75, 0x50, 0xbc, 0xe2, 0x47, 0x82, 0xaf, 0x5f, 0xcf, 0xd1, 0xc7, 0xc1, 0xff, 0xac, 0x9e, 0x07,
+    0xc7, 0x48, 0x31, 0xf0, 0x2d, 0x00, 0xf5, 0x29, 0xb4, 0xbe, 0xdb, 0xfd, 0x77, 0x25, 0xc8, 0x7f,
+    0x93, 0x29, 0xee, 0x33, 0xc2, 0x67, 0xfa, 0xdb, 0x1d, 0x52, 0xbf, 0xe3, 0x3d, 0xe2, 0x5a, 0x1a,
+    0xc5, 0x42, 0xdd, 0xe6, 0xd4, 0x3b, 0xb1, 0x7b, 0xde, 0x59, 0x5d, 0xb7, 0xdd, 0x16, 0xcc, 0xb0,
+    0xe3, 0xc5, 0xc5, 0xe0, 0xb4, 0x37, 0x97, 0x31, 0x02, 0xa2, 0x41, 0xd1, 0x72, 0xd5, 0xc5, 0x10,
+    0xde, 0x7f, 0x1e, 0x26, 0xdd, 0x43, 0x97, 0x7c, 0xf6, 0xf2, 0x80, 0xbe, 0x8d, 0xac, 0x21, 0xf8,
+    0x78, 0x1d, 0x78, 0x35, 0x72, 0x3d, 0x30, 0x8b, 0x94, 0xb0, 0x69, 0xb9, 0x51, 0xb3, 0x70, 0x38,
+    0xbe, 0xaa, 0x8e, 0x16, 0xdd, 0xa3, 0x9f, 0x24, 0x4f, 0x9f, 0x69, 0xfc, 0x54, 0x16, 0x3a, 0x2e,
+    0xcc, 0x59, 0x1f, 0x65, 0x3d, 0x2c, 0x14, 0xb7, 0xd2, 0xe8, 0xa1, 0x24, 0x11, 0xf8, 0xf5, 0xa1,
+    0x16, 0xfa, 0x73, 0xda, 0xb6, 0xeb, 0xc1, 0x36, 0x59, 0x25, 0x98, 0xab, 0x84, 0x1e, 0xbe, 0x40,
+    0x87, 0x58, 0xe0, 0x5b, 0x22, 0xdd, 0x67, 0xe6, 0xd0, 0xfa, 0x5e, 0x3e, 0x8c, 0x12, 0xfb, 0x59,
+    0x91, 0x9f, 0x81, 0x90, 0xac, 0x0d, 0x5d, 0x60, 0x4b, 0xce, 0x94, 0xb4, 0x38, 0x88, 0xcc, 0x8c,
+    0x9f, 0x12, 0xdc, 0xc2, 0x32, 0x8f, 0xf5, 0xf2, 0xb7, 0x4c, 0x0a, 0xed, 0xbc, 0x5d, 0x29, 0xea,
+    0x09, 0xe9, 0xec, 0xc1, 0x35, 0x5e, 0x34, 0x4d, 0xc4, 0x09, 0xc9, 0x10, 0x7e, 0x03, 0x55, 0x7a,
+    0x1e, 0xab, 0xa9, 0x0c, 0x01, 0xd3, 0xa4, 0xff, 0xc3, 0xad, 0x87, 0xbe, 0x02, 0xbb, 0x55, 0x1e,
+    0x30, 0x5e, 0x52, 0xc5, 0xcb, 0x92, 0x25, 0x29, 0x89, 0xf0, 0xb7, 0x19, 0xef, 0x89, 0x29, 0x27,
+    0x1c, 0xdf, 0xb2, 0xed, 0x13, 0x44, 0x2a, 0x03, 0xb8, 0xbf, 0x5f, 0xa8, 0x48, 0x5a, 0x8e, 0xc6,
+    0xd5, 0x13, 0xdd, 0x96, 0xe4, 0x1b, 0x28, 0xea, 0x1d, 0x5d, 0x36, 0x2a, 0x91, 0x73, 0xc2, 0x43,
+    0x6f, 0x93, 0x18, 0x1e, 0x43, 0xe6, 0x42, 0x89, 0x36, 0x82, 0x19, 0x07, 0xbb, 0xb4, 0x75, 0xe0,
+    0x85, 0x92, 0xc3, 0xef, 0x92, 0x10, 0x6e, 0xea, 0x32, 0xc9, 0x01, 0x51, 0x14, 0x56, 0x47, 0x2a,
+    0x88, 0x51, 0xae, 0xfa, 0x1e, 0x45, 0xa2, 0xe8, 0x78, 0xc5, 0x60, 0x94, 0xf1, 0xa4, 0xe9, 0xab,
+    0x86, 0x62, 0x49, 0x3b, 0xf4, 0xd5, 0x53, 0x48, 0xed, 0x04, 0x0d, 0x26, 0x44, 0x91, 0x35, 0x05,
+    0x96, 0x4e, 0x9f, 0x16, 0xfa, 0x0e, 0xd4, 0x83, 0x9d, 0xe6, 0xe6, 0xd0, 0xec, 0x36, 0xc1, 0x6f,
+    0xd6, 0x1e, 0x02, 0xac, 0xa2, 0x05, 0x28, 0xb7, 0x92, 0xc3, 0xd7, 0xb7, 0xce, 0xcc, 0xbe, 0xcd,
+    0xa7, 0xae, 0xda, 0x4b, 0xf8, 0xc0, 0xee, 0x74, 0x2f, 0xa1, 0xa6, 0x5e, 0xc4, 0x3f, 0xec, 0x05,
+    0x36, 0xbc, 0x4f, 0x4f, 0x8b, 0x5c, 0x33, 0x1e, 0xe8, 0xab, 0x30, 0xb7, 0xd5, 0xcc, 0x0b, 0x4f,
+    0x5b, 0x95, 0x01, 0xf3, 0x45, 0x7d, 0x63, 0xb8, 0xa3, 0x25, 0x5b, 0x6b, 0x03, 0x66, 0xb2, 0xfc,
+    0xcd, 0x31, 0xb5, 0xa8, 0x1d, 0x0d, 0xab, 0x5e, 0xcc, 0x37, 0x86, 0xcc, 0xbe, 0x9c, 0x9f, 0xc2,
+    0xd6, 0xa2, 0x7a, 0x26, 0x5c, 0xc9, 0xcc, 0x74, 0x10, 0x96, 0xf1, 0xca, 0xe6, 0xec, 0xf3, 0xa5,
+    0x94, 0xd7, 0x3c, 0xfb, 0x7c, 0xc6, 0xe2, 0x49, 0xfe, 0x27, 0x05, 0x69, 0x06, 0x45, 0x60, 0xc7,
+    0x4d, 0x4e, 0x8c, 0x78, 0x8e, 0x96, 0xd1, 0x0e, 0x56, 0x31, 0x6c, 0x83, 0x71, 0x69, 0xac, 0x62,
+    0xaf, 0x72, 0xc8, 0x02, 0x91, 0xc0, 0xa9, 0x14, 0x58, 0x88, 0x47, 0x6a, 0x17, 0xe5, 0x03, 0x84,
+    0xc7, 0x12, 0x37, 0x1a, 0x5d, 0x47, 0xea, 0x92, 0x5c, 0xb0, 0x88, 0x93, 0xab, 0x15, 0xb6, 0xfe,
+    0xa2, 0x70, 0xce, 0xe6, 0xa2, 0xc8, 0x25, 0x76, 0x25, 0x37, 0x52, 0xed, 0x38, 0x75, 0x2b, 0x5d,
+    0x16, 0xa8, 0x9d, 0x07, 0x3f, 0xe9, 0x8a, 0x51, 0xe6, 0xb5, 0x77, 0x79, 0x5a, 0x09, 0x90, 0xa0,
+    0x80, 0x38, 0x8b, 0xa7, 0x86, 0x13, 0xe1, 0x4f, 0x8d, 0xc9, 0xa0, 0x7d, 0xf2, 0x04, 0x3c, 0x3f,
+    0xc1, 0x3c, 0x49, 0x5d, 0xf9, 0x43, 0xdb, 0xca, 0x92, 0x1a, 0x29, 0x4d, 0x39, 0xb0, 0xac, 0xd3,
+    0x94, 0x42, 0x79, 0xb8, 0x0b, 0x52, 0x00, 0x7c, 0x1f, 0x09, 0x8a, 0xf5, 0x90, 0x47, 0x3b, 0xda,
+    0x10, 0xf0, 0x8f, 0x9c, 0x72, 0xbc, 0xf9, 0x95, 0x3c, 0x10, 0x44, 0x29, 0x96, 0x42, 0xc6, 0x83,
+    0xb6, 0xd5, 0x0b, 0xfb, 0x7c, 0xe9, 0x38, 0xf3, 0xec, 0x0a, 0x87, 0x38, 0xf8, 0xe1, 0xbc, 0x1d,
+    0xba, 0xd1, 0xf0, 0x14, 0x93, 0xbc, 0x55, 0x22, 0xde, 0xae, 0xf9, 0x4e, 0xcb, 0xb6, 0xcc, 0x6b,
+    0x09, 0xa6, 0xd2, 0x50, 0x87, 0x95, 0x49, 0x6c, 0x39, 0x31, 0x33, 0xfd, 0xda, 0xc9, 0xe1, 0x71,
+    0x5c, 0xa9, 0xc1, 0x86, 0x53, 0xf7, 0x99, 0x5f, 0x6b, 0x9e, 0xef, 0x39, 0x98, 0xed, 0xf2, 0xc1,
+    0x2d, 0xc1, 0x31, 0x3b, 0xcc, 0xfd, 0xa3, 0xa7, 0xf5, 0x2e, 0xe3, 0x06, 0x44, 0x54, 0x40, 0x11,
+    0x3e, 0xe1, 0x5c, 0x73, 0xa8, 0xb9, 0x81, 0x4b, 0x2c, 0x73, 0x5d, 0xd2, 0x93, 0xc9, 0x7e, 0x24,
+    0x23, 0x4a, 0x31, 0xc7, 0xe2, 0xc9, 0x04, 0x7d, 0x12, 0x6b, 0xf3, 0xfd, 0xb5, 0x64, 0x69, 0xfa,
+    0x1f, 0x07, 0x38, 0xfa, 0x11, 0x35, 0x06, 0x92, 0xf4, 0x58, 0x3c, 0x5d, 0x43, 0x43, 0xa1, 0x65,
+    0xab, 0xc7, 0x09, 0x9e, 0xa3, 0x26, 0xc0, 0x09, 0xc4, 0xe3, 0xf4, 0x83, 0x79, 0x02, 0xcb, 0xf1,
+    0x7f, 0x02, 0x30, 0x1d, 0xc7, 0xa1, 0xbb, 0xd6, 0x89, 0x9d, 0x92, 0x85, 0x84, 0xb2, 0xca, 0xc4,
+    0x37, 0x4e, 0xb5, 0x1e, 0x87, 0xad, 0xd7, 0x9d, 0x4d, 0xfe, 0x00, 0x05, 0x6d, 0xcb, 0x0f, 0xea,
+    0xa7, 0x9e, 0x63, 0x4d, 0x1e, 0xb0, 0xc7, 0x97, 0x3f, 0x10, 0xdf, 0x57, 0x9d, 0x75, 0x1b, 0x4f,
+    0xef, 0x60, 0xf4, 0x26, 0xa0, 0xee, 0x87, 0x9b, 0xa4, 0x3e, 0xe8, 0xaa, 0x1d, 0x25, 0xe0, 0x70,
+    0x9e, 0x64, 0xdf, 0xc1, 0xcb, 0x7c, 0x00, 0x4a, 0xdb, 0x02, 0x2c, 0x27, 0x5a, 0x92, 0x2a, 0x72,
+    0x33, 0xa5, 0x2c, 0xf1, 0x23, 0x11, 0xf2, 0xd6, 0x62, 0x9e, 0x44, 0x81, 0x1f, 0xa0, 0x28, 0xc6,
+    0x33, 0xee, 0x54, 0x7d, 0xf7, 0x01, 0x05, 0x70, 0x94, 0x02, 0x35, 0xfe, 0x7f, 0x28, 0x39, 0x2f,
+    0x46, 0xfe, 0xbf, 0x16, 0xb0, 0x60, 0x7c, 0x40, 0x93, 0x35, 0x87, 0x22, 0x6a, 0xea, 0xda, 0xbe,
+    0x1c, 0x71, 0xac, 0x68, 0xa7, 0xb0, 0xca, 0xe0, 0x94, 0xab, 0xbb, 0x74, 0xd7, 0x9e, 0x2e, 0xf0,
+    0x28, 0x3b, 0x33, 0x1f, 0x8e, 0xcc, 0x3c, 0x3e, 0x79, 0x35, 0x8d, 0xb1, 0xca, 0x9b, 0x1d, 0xdb,
+    0x69, 0x50, 0xae, 0x3c, 0xfe, 0xbf, 0xc4, 0xdc, 0x8e, 0x36, 0x08, 0x66, 0x00, 0x00,
+};
+
+const uint8_t WEB_ASSET_APP_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x54, 0xcb, 0x8e, 0xd3, 0x30,
+    0x14, 0xdd, 0xcf, 0x57, 0x04, 0x8d, 0x50, 0x40, 0x9a, 0xbc, 0x9a, 0xa6, 0x49, 0xd3, 0x07, 0xa0,
+    0x42, 0x17, 0x6c, 0x60, 0x31, 0x48, 0xb0, 0xbc, 0xb5, 0x6f, 0x52, 0x0f, 0x4e, 0x62, 0xd9, 0xee,
+    0x8b, 0x2a, 0x12, 0x12, 0x1f, 0xc1, 0x6f, 0x8c, 0xc4, 0x02, 0x89, 0xaf, 0xe8, 0xfc, 0x11, 0x4e,
+    0xd3, 0x76, 0xa6, 0x8c, 0x66, 0x81, 0xa2, 0xc4, 0x37, 0xc7, 0xe7, 0x9e, 0xfb, 0x70, 0x6e, 0x86,
+    0xcf, 0xde, 0x7e, 0x98, 0x5c, 0x7f, 0xf9, 0xf8, 0xce, 0x9a, 0xeb, 0x82, 0x8f, 0x2f, 0x86, 0xc7,
+    0x05, 0x81, 0x9a, 0xa5, 0x40, 0x0d, 0x16, 0x99, 0x83, 0x54, 0xa8, 0x47, 0xf6, 0xa7, 0xeb, 0xa9,
+    0x93, 0xd8, 0x47, 0xb8, 0x84, 0x02, 0x47, 0xf6, 0x92, 0xe1, 0x4a, 0x54, 0x52, 0xdb, 0x16, 0xa9,
+    0x4a, 0x8d, 0xa5, 0xa1, 0xad, 0x18, 0xd5, 0xf3, 0x11, 0xc5, 0x25, 0x23, 0xe8, 0xec, 0x5f, 0xae,
+    0x2c, 0x56, 0x32, 0xcd, 0x80, 0x3b, 0x8a, 0x00, 0xc7, 0x51, 0xe0, 0xfa, 0x8d, 0x8c, 0x66, 0x9a,
+    0xe3, 0xf8, 0xfd, 0xe7, 0xc9, 0xf5, 0xd0, 0x6b, 0xed, 0x8b, 0x21, 0x67, 0xe5, 0x57, 0x4b, 0x22,
+    0x1f, 0xd9, 0x4a, 0x6f, 0x38, 0xaa, 0x39, 0xa2, 0xd1, 0x9e, 0x4b, 0xcc, 0x46, 0xb6, 0xa7, 0x34,
+    0x68, 0x46, 0xbc, 0x05, 0x73, 0x89, 0x52, 0xaf, 0x96, 0x23, 0x24, 0xfd, 0xfe, 0xcc, 0x8f, 0xc3,
+    0x84, 0x76, 0x93, 0xa8, 0x13, 0x85, 0x8d, 0xe8, 0xde, 0x6d, 0xec, 0x52, 0xd0, 0xb0, 0xdd, 0x07,
+    0x4f, 0x03, 0xdf, 0x7f, 0x3e, 0x98, 0x55, 0x92, 0xa2, 0x74, 0x48, 0xc5, 0x39, 0x08, 0x85, 0xe9,
+    0xd1, 0xa8, 0xf7, 0x4c, 0xcb, 0xe4, 0x78, 0x30, 0xe8, 0xb6, 0xa5, 0xa6, 0x81, 0x58, 0x5b, 0xaa,
+    0xe2, 0x8c, 0x5a, 0x97, 0x84, 0x90, 0x81, 0x00, 0x4a, 0x59, 0x99, 0xa7, 0x3d, 0xb1, 0x1e, 0x68,
+    0x5c, 0x6b, 0x07, 0x38, 0xcb, 0xcb, 0x94, 0x98, 0x92, 0x51, 0x9e, 0x54, 0xb6, 0x33, 0x20, 0x5f,
+    0x73, 0x59, 0x2d, 0x4a, 0x9a, 0x5e, 0x66, 0x51, 0x73, 0xd5, 0x6e, 0x2e, 0x11, 0xcb, 0xad, 0x89,
+    0x58, 0xc9, 0xf4, 0xb2, 0x3b, 0x79, 0x33, 0x8d, 0xfc, 0xda, 0xdd, 0x20, 0xe7, 0xd5, 0xea, 0x88,
+    0x4e, 0xa7, 0x93, 0xc0, 0x8f, 0x6b, 0xb7, 0x92, 0x50, 0xe6, 0x78, 0x8f, 0xf6, 0x13, 0xdf, 0x70,
+    0x25, 0xd2, 0x13, 0xd4, 0xed, 0x86, 0x61, 0xaf, 0x76, 0x67, 0x7c, 0x71, 0xa2, 0x75, 0x82, 0x7e,
+    0x6f, 0x1a, 0xd6, 0xae, 0x42, 0x50, 0x55, 0xe9, 0x00, 0xbd, 0xd9, 0x66, 0xe6, 0x30, 0x1c, 0xc5,
+    0xbe, 0x61, 0xea, 0xbb, 0x09, 0x16, 0x83, 0x02, 0x64, 0xce, 0x4a, 0x87, 0x63, 0xa6, 0xd3, 0x48,
+    0xac, 0x1f, 0x72, 0xdd, 0x85, 0x38, 0x09, 0x21, 0x21, 0x71, 0x70, 0xb6, 0x49, 0xab, 0xd5, 0x29,
+    0x75, 0x8c, 0xbb, 0x24, 0x24, 0xb5, 0x2b, 0xa0, 0x44, 0x7e, 0x5e, 0x69, 0x92, 0xf5, 0x33, 0x38,
+    0xf5, 0x28, 0x30, 0x21, 0x8e, 0x1d, 0x97, 0x40, 0xd9, 0x42, 0xa5, 0x89, 0x41, 0xda, 0x24, 0xf6,
+    0xbb, 0x96, 0x7f, 0x90, 0x71, 0xda, 0xe6, 0x3c, 0x14, 0xc3, 0x24, 0x8b, 0x30, 0xa9, 0x5d, 0x13,
+    0x55, 0x6d, 0x29, 0x53, 0x82, 0xc3, 0x26, 0xcd, 0x25, 0xa3, 0x83, 0xe6, 0xe1, 0x68, 0x2c, 0x0c,
+    0xa2, 0xb1, 0x39, 0xcb, 0x45, 0x51, 0xaa, 0x34, 0xc8, 0xa4, 0x65, 0xee, 0x41, 0x0e, 0x22, 0xed,
+    0xf8, 0x26, 0xce, 0x7d, 0xf1, 0x41, 0xb7, 0xa9, 0xb5, 0x11, 0x72, 0xc2, 0xff, 0x90, 0x3a, 0x97,
+    0xfb, 0x27, 0x6d, 0x89, 0x6a, 0xc1, 0xf5, 0xf6, 0xd0, 0x51, 0x5d, 0x09, 0xf3, 0x81, 0x3d, 0x0a,
+    0x3a, 0x28, 0xcc, 0xde, 0x1c, 0x59, 0x3e, 0xd7, 0x7b, 0x91, 0xda, 0x05, 0xc1, 0x9c, 0xe6, 0xe3,
+    0x56, 0x67, 0x9e, 0xd1, 0x63, 0xcf, 0x43, 0xb3, 0xa3, 0x28, 0xaa, 0x5f, 0x17, 0x48, 0x19, 0x58,
+    0x2f, 0x0a, 0x58, 0xb7, 0x83, 0x94, 0xc6, 0x3d, 0xd3, 0xc8, 0x97, 0xdb, 0x7d, 0x49, 0x57, 0xc7,
+    0xc2, 0x9e, 0xac, 0xa5, 0xae, 0x87, 0x5e, 0x3b, 0x0f, 0x17, 0x43, 0xef, 0x30, 0xd2, 0xb3, 0x8a,
+    0x6e, 0xcc, 0x42, 0xd9, 0xd2, 0x22, 0x1c, 0x94, 0x1a, 0xd9, 0xcd, 0xe0, 0x02, 0x2b, 0x51, 0xda,
+    0xe7, 0x78, 0x09, 0x4b, 0xdb, 0x62, 0xb4, 0x35, 0xc6, 0x43, 0xcf, 0x6c, 0x1d, 0x08, 0x0d, 0x08,
+    0x42, 0x18, 0x50, 0x8c, 0x77, 0x3f, 0x77, 0xb7, 0xbb, 0x5f, 0x77, 0xdf, 0xef, 0x7e, 0xec, 0x7e,
+    0xef, 0xfe, 0xec, 0x6e, 0x5d, 0xd7, 0x1d, 0x7a, 0xe2, 0x44, 0x3f, 0x2c, 0x8a, 0x48, 0x26, 0xb4,
+    0xa5, 0x24, 0x39, 0x1b, 0xe3, 0x9b, 0x66, 0x8a, 0xfd, 0xb8, 0xdf, 0xf7, 0x21, 0x8b, 0x67, 0x01,
+    0x42, 0x1c, 0x24, 0xb4, 0x89, 0xd5, 0xf2, 0x9f, 0x70, 0x34, 0xa1, 0x5b, 0xcf, 0xd0, 0x27, 0x61,
+    0xcf, 0x47, 0x00, 0xa0, 0x9d, 0x38, 0xe9, 0x75, 0xce, 0x3c, 0xbd, 0x43, 0xa5, 0xde, 0xfe, 0x97,
+    0xf6, 0x17, 0x30, 0xd9, 0xc0, 0x13, 0xe9, 0x04, 0x00, 0x00,
+};
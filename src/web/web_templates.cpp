@@ -327,7 +327,7 @@ String generatePageHeaderImpl(const PageInfo& page)
     String html = "<!DOCTYPE html><html><head><meta charset='UTF-8'>";
     html += "<meta name='viewport' content='width=device-width, initial-scale=1.0'>";
     html += "<title>" + iconStr + page.title + "</title>";
-    html += "<style>" + String(getUnifiedCSS()) + "</style>";
+    html += getStylesheetHTML();
     html += "</head><body><div class='container'>";
     return html;
 }
@@ -364,6 +364,38 @@ String generateBasePage(
     return generateBasePageImpl(PageInfo::builder().setTitle(titleText).setIcon(iconText).build(), contentText);
 }
 
+String htmlAttrEscape(const String& value)  // NOLINT(misc-use-internal-linkage)
+{
+    String escaped;
+    escaped.reserve(value.length() + 8);
+    for (size_t i = 0; i < value.length(); ++i)
+    {
+        const char symbol = value[i];
+        switch (symbol)
+        {
+            case '&':
+                escaped += "&amp;";
+                break;
+            case '<':
+                escaped += "&lt;";
+                break;
+            case '>':
+                escaped += "&gt;";
+                break;
+            case '"':
+                escaped += "&quot;";
+                break;
+            case '\'':
+                escaped += "&#39;";
+                break;
+            default:
+                escaped += symbol;
+                break;
+        }
+    }
+    return escaped;
+}
+
 String generateErrorPage(
     int errorCode,
     const String& errorMessage)  // NOLINT(bugprone-easily-swappable-parameters,misc-use-internal-linkage)
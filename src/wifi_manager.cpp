@@ -46,8 +46,75 @@ unsigned long ledLastToggle = 0;
 bool ledState = false;
 unsigned long ledBlinkInterval = 0;
 bool ledFastBlink = false;
+
+// Веб-сервер обслуживается отдельной задачей, но по-прежнему один клиент за раз: это не
+// параллельные соединения. Обработчики меняют config, калибровку, кэши JSON и uplink-приёмники,
+// поэтому задача держит рекурсивный мьютекс WebServerLock на время handleClient(), а главный цикл
+// и задачи датчика берут тот же мьютекс вокруг каждого обращения к этому состоянию.
+// Обработчики могут сами вызывать startAPMode()/setupWebServer() без взаимной блокировки.
+SemaphoreHandle_t webServerMutex = nullptr;
+TaskHandle_t webServerTaskHandle = nullptr;
+
+void webServerTask(void* parameters)
+{
+    (void)parameters;
+    const TickType_t pollDelay = pdMS_TO_TICKS(WEB_SERVER_TASK_POLL_MS);
+    for (;;)
+    {
+        {
+            WebServerLock lock;
+            if (currentWiFiMode == WiFiMode::AP)
+            {
+                dnsServer.processNextRequest();
+            }
+            webServer.handleClient();
+            if (currentWiFiMode == WiFiMode::STA)
+            {
+                handleSensorEvents();  // Новое показание - открытым страницам, без опроса
+            }
+        }
+        vTaskDelay(pollDelay);
+    }
+}
+
+// Учётные данные копируются под WebServerLock: подключение длится секунды, а config в это
+// время может сохранить обработчик веб-сервера
+struct WifiCredentials
+{
+    std::array<char, sizeof(Config::ssid)> ssid = {""};
+    std::array<char, sizeof(Config::password)> password = {""};
+};
+
+WifiCredentials copyWifiCredentials()
+{
+    WifiCredentials credentials;
+    const WebServerLock webStateLock;
+    strlcpy(credentials.ssid.data(), config.ssid, credentials.ssid.size());
+    strlcpy(credentials.password.data(), config.password, credentials.password.size());
+    return credentials;
+}
+
+void startWebServerTask()
+{
+    if (webServerTaskHandle != nullptr)
+    {
+        return;
+    }
+    xTaskCreate(webServerTask, "WebServer", WEB_SERVER_TASK_STACK_SIZE, nullptr, WEB_SERVER_TASK_PRIORITY,
+                &webServerTaskHandle);
+}
 }  // namespace
 
+WebServerLock::WebServerLock()
+{
+    xSemaphoreTakeRecursive(webServerMutex, portMAX_DELAY);
+}
+
+WebServerLock::~WebServerLock()
+{
+    xSemaphoreGiveRecursive(webServerMutex);
+}
+
 extern NTPClient* timeClient;
 extern WiFiUDP ntpUDP;
 
@@ -115,6 +182,7 @@ void setupWiFi()
 
     pinMode(STATUS_LED_PIN, OUTPUT);
     setLedBlink(static_cast<unsigned long>(WifiConstants::LED_SLOW_BLINK_INTERVAL));
+    webServerMutex = xSemaphoreCreateRecursiveMutex();
 
     // Сначала отключаем WiFi и очищаем настройки
     WiFi.disconnect(true);  // NOLINT(readability-static-accessed-through-instance)
@@ -144,20 +212,18 @@ void handleWiFi()
     updateLed();
     if (currentWiFiMode == WiFiMode::AP)
     {
-        dnsServer.processNextRequest();
-        webServer.handleClient();
-
         // Периодическая попытка вернуться в STA-режим, если точка доступа пуста
         static unsigned long lastStaRetry = 0;
+        const WifiCredentials credentials = copyWifiCredentials();
         if (WiFi.softAPgetStationNum() ==
                 0 &&  // никого не подключено // NOLINT(readability-static-accessed-through-instance)
             millis() - lastStaRetry >=
                 static_cast<unsigned long>(WifiConstants::WIFI_RECONNECT_INTERVAL) &&  // прошло ≥ интервала
-            strlen(config.ssid) > 0 &&
-            strlen(config.password) > 0)  // есть сохранённые уч. данные
+            strlen(credentials.ssid.data()) > 0 &&
+            strlen(credentials.password.data()) > 0)  // есть сохранённые уч. данные
         {
             lastStaRetry = millis();
-            logWiFiSafe("AP режим: пробуем снова подключиться к WiFi \"%s\"", config.ssid);
+            logWiFiSafe("AP режим: пробуем снова подключиться к WiFi \"%s\"", credentials.ssid.data());
             startSTAMode();  // если не получится, функция сама вернёт нас в AP
             return;          // ждём следующего цикла
         }
@@ -190,9 +256,11 @@ void handleWiFi()
                 {
                     logWarnSafe("\1", reconnectAttempts + 1, MAX_RECONNECT_ATTEMPTS);
 
+                    const WifiCredentials credentials = copyWifiCredentials();
                     WiFi.disconnect(true);  // NOLINT(readability-static-accessed-through-instance)
                     delay(static_cast<unsigned long>(WifiConstants::WIFI_MODE_DELAY));
-                    WiFi.begin(config.ssid, config.password);  // NOLINT(readability-static-accessed-through-instance)
+                    WiFi.begin(credentials.ssid.data(),
+                               credentials.password.data());  // NOLINT(readability-static-accessed-through-instance)
 
                     lastReconnectAttempt = millis();
                     reconnectAttempts++;
@@ -215,13 +283,16 @@ void handleWiFi()
                 logSuccessSafe(
                     "\1", WiFi.localIP().toString().c_str());    // NOLINT(readability-static-accessed-through-instance)
                 logSystemSafe("\1", WiFi.macAddress().c_str());  // NOLINT(readability-static-accessed-through-instance)
-                logSystemSafe("\1", config.ssid);
+                logSystemSafe("\1", copyWifiCredentials().ssid.data());
                 logSystemSafe("\1", WiFi.RSSI());  // NOLINT(readability-static-accessed-through-instance)
-                // --- Первичная синхронизация времени NTP (блок до 5 сек) ---
-                if (timeClient == nullptr)
+                // --- Первичная синхронизация времени NTP (блок до 5 сек, вне WebServerLock) ---
                 {
-                    timeClient = new NTPClient(ntpUDP, "pool.ntp.org", 0, 3600000);
-                    timeClient->begin();
+                    const WebServerLock webStateLock;  // timeClient читают обработчики веб-сервера
+                    if (timeClient == nullptr)
+                    {
+                        timeClient = new NTPClient(ntpUDP, "pool.ntp.org", 0, 3600000);
+                        timeClient->begin();
+                    }
                 }
                 if (timeClient != nullptr)
                 {
@@ -238,7 +309,6 @@ void handleWiFi()
                 return;
             }
         }
-        webServer.handleClient();
     }
 }
 
@@ -262,8 +332,11 @@ void startAPMode()
     WiFi.mode(WIFI_AP);  // NOLINT(readability-static-accessed-through-instance)
     const String apSsid = getApSsid();
     WiFi.softAP(apSsid.c_str(), JXCT_WIFI_AP_PASS);  // NOLINT(readability-static-accessed-through-instance)
-    dnsServer.start(static_cast<uint16_t>(WifiConstants::DNS_SERVER_PORT), "*",
-                    WiFi.softAPIP());  // NOLINT(readability-static-accessed-through-instance)
+    {
+        WebServerLock lock;
+        dnsServer.start(static_cast<uint16_t>(WifiConstants::DNS_SERVER_PORT), "*",
+                        WiFi.softAPIP());  // NOLINT(readability-static-accessed-through-instance)
+    }
     setupWebServer();
     setLedBlink(static_cast<unsigned long>(WifiConstants::LED_SLOW_BLINK_INTERVAL));
     logWiFi("Режим точки доступа запущен");
@@ -282,12 +355,13 @@ void startSTAMode()
     const String hostname = getApSsid();
     WiFi.setHostname(hostname.c_str());  // NOLINT(readability-static-accessed-through-instance)
 
-    if (strlen(config.ssid) > 0)
+    const WifiCredentials credentials = copyWifiCredentials();
+    if (strlen(credentials.ssid.data()) > 0)
     {
         logWiFi("Подключение к WiFi...");
-        WiFi.begin(
-            config.ssid,
-            config.password);  // Явно вызываем подключение // NOLINT(readability-static-accessed-through-instance)
+        // Явно вызываем подключение
+        WiFi.begin(credentials.ssid.data(),
+                   credentials.password.data());  // NOLINT(readability-static-accessed-through-instance)
 
         int attempts = 0;
         setLedBlink(WIFI_RETRY_DELAY_MS);
@@ -315,7 +389,7 @@ void startSTAMode()
         {
             wifiConnected = true;
             setLedOn();
-            logSuccessSafe("\1", config.ssid);
+            logSuccessSafe("\1", credentials.ssid.data());
             logSystemSafe("\1",
                           WiFi.localIP().toString().c_str());  // NOLINT(readability-static-accessed-through-instance)
             logSystemSafe("\1", WiFi.macAddress().c_str());    // NOLINT(readability-static-accessed-through-instance)
@@ -392,7 +466,7 @@ void handleStatus()  // NOLINT(misc-use-internal-linkage)
 {
     String html = "<!DOCTYPE html><html><head><meta charset='UTF-8'>";
     html += "<title>" UI_ICON_STATUS " Статус JXCT</title>";
-    html += "<style>" + String(getUnifiedCSS()) + "</style></head><body><div class='container'>";
+    html += String(getStylesheetHTML()) + "</head><body><div class='container'>";
     html += navHtml();
     html += "<h1>" UI_ICON_STATUS " Статус системы</h1>";
     html += "<div class='section'><h2>WiFi</h2><ul>";
@@ -419,12 +493,18 @@ void setupWebServer()
 {
     logInfo("🏗️ Настройка модульного веб-сервера v2.4.5...");
 
+    WebServerLock lock;  // Задача веб-сервера не обходит таблицу маршрутов во время регистрации
+
     // ============================================================================
     // МОДУЛЬНАЯ АРХИТЕКТУРА - Настройка всех маршрутов по группам
     // ============================================================================
 
+    collectWebRequestHeaders();  // If-None-Match (304), X-CSRF-Token
+    setupStaticRoutes();         // CSS/JS из flash (/static/*, gzip + ETag)
+    setupAppRoutes();            // Панель (/readings, /calibration, /service, /api/v1/bootstrap)
     setupMainRoutes();     // Основные маршруты (/, /save, /status)
-    setupDataRoutes();     // Данные датчика (/readings, /sensor_json, /api/sensor)
+    setupDataRoutes();     // Данные датчика (/sensor_json, /api/sensor)
+    setupEventRoutes();    // Поток показаний (/api/v1/events, Server-Sent Events)
     setupConfigRoutes();   // Конфигурация (/intervals, /config_manager, /api/config/*)
     setupServiceRoutes();  // Сервис
     setupOtaRoutes();      // OTA (/updates, api)
@@ -437,7 +517,8 @@ void setupWebServer()
     // ============================================================================
 
     webServer.begin();
+    startWebServerTask();
     logSuccessSafe("\1", currentWiFiMode == WiFiMode::AP ? "AP" : "STA");
-    logSystem("✅ Активные модули: main, data, config, service, ota, error_handlers");
+    logSystem("✅ Активные модули: static, main, data, events, config, service, ota, error_handlers");
     logSystem("📋 Полный набор маршрутов готов к использованию");
 }
@@ -24,6 +24,18 @@ enum class WiFiMode : std::uint8_t
 extern bool wifiConnected;
 extern WiFiMode currentWiFiMode;
 
+// Блокировка общего состояния веб-интерфейса (config, калибровка, кэши JSON, uplink-приёмники).
+// Обработчики маршрутов выполняются в задаче WebServer под этой блокировкой; главный цикл и
+// задачи датчика берут её вокруг каждого чтения и изменения того же состояния. Рекурсивная.
+class WebServerLock
+{
+   public:
+    WebServerLock();
+    ~WebServerLock();
+    WebServerLock(const WebServerLock&) = delete;
+    WebServerLock& operator=(const WebServerLock&) = delete;
+};
+
 // Пин светодиода статуса
 #define STATUS_LED_PIN 2
 
@@ -25,10 +25,10 @@ def test_all_18_crops():
         "kale", "raspberry", "blackberry", "soybean", "carrot"
     ]
     
-    # Читаем файл движка
-    engine_path = "src/business/crop_recommendation_engine.cpp"
+    # Читаем таблицу правил движка
+    engine_path = "include/business/crop_rules.h"
     if not os.path.exists(engine_path):
-        print("ОШИБКА: Файл crop_recommendation_engine.cpp не найден")
+        print("ОШИБКА: Файл crop_rules.h не найден")
         return False
     
     with open(engine_path, 'r', encoding='utf-8') as f:
@@ -50,7 +50,7 @@ def test_all_18_crops():
     
     for i, crop in enumerate(all_crops, 1):
         # Проверяем в движке
-        engine_pattern = f'cropName == "{crop}"'
+        engine_pattern = f'(CropId::{crop.upper()}, MessageId::'
         engine_ok = engine_pattern in content
         
         # Проверяем в веб-интерфейсе
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""
+Тест кодов рекомендаций (include/business/advice_codes.h)
+Собирает сервис взаимодействий и движок рекомендаций g++: коды с числовыми
+параметрами разворачиваются в прежний текст; RecommendationResult и
+ColorIndicators - перечисления; /sensor_json отдаёт коды по ?fields=codes,
+каталог текстов - /api/v2/advice
+"""
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+DRIVER = r"""
+#include <cstdio>
+#include "business/crop_recommendation_engine.h"
+#include "business/nutrient_interaction_service.h"
+#include "jxct_config_vars.h"
+
+Config config;
+void logDebug(const String&) {}
+void logError(const String&) {}
+void logWarn(const String&) {}
+void logInfo(const String&) {}
+void logSuccess(const String&) {}
+void logSystem(const String&) {}
+
+int main()
+{
+    NutrientInteractionService service;
+    unsigned soil = 0;
+    float n = 0, p = 0, k = 0, ph = 0;
+    while (scanf("%u %f %f %f %f", &soil, &n, &p, &k, &ph) == 5)
+    {
+        const NPKReferences npk(n, p, k);
+        for (const Advice::Item& item : service.assessAntagonisms(npk, static_cast<SoilType>(soil), ph))
+        {
+            printf("%u:%.4g:%.4g ", static_cast<unsigned>(item.code), item.value, item.reference);
+        }
+        // Текст в одну строку: перевод строки -> '|'
+        printf("= ");
+        for (const char symbol : service.generateAntagonismRecommendations(npk, static_cast<SoilType>(soil), ph))
+        {
+            putchar(symbol == '\n' ? '|' : symbol);
+        }
+        printf("\n");
+    }
+
+    // Черника на глине, pH выше цели: коды условий и прежний текст
+    config.soilProfile = 3;  // CLAY
+    CropRecommendationEngine engine;
+    SensorData data{};
+    data.temperature = 22.0F;
+    data.humidity = 60.0F;
+    data.ec = 1500.0F;
+    data.ph = 6.8F;
+    data.nitrogen = 150.0F;
+    data.phosphorus = 60.0F;
+    data.potassium = 200.0F;
+    const RecommendationResult result = engine.generateRecommendation(data, "blueberry", "outdoor", "summer");
+    printf("engine %u %u %u %u %u %s\n", static_cast<unsigned>(result.crop), static_cast<unsigned>(result.soilType),
+           static_cast<unsigned>(result.season), static_cast<unsigned>(result.healthStatus), result.healthScore,
+           INDICATOR_NAMES[static_cast<size_t>(result.colorIndicators.ph)]);
+    for (const Advice::Item& item : result.recommendations)
+    {
+        printf("code %u %.4g %.4g\n", static_cast<unsigned>(item.code), item.value, item.reference);
+    }
+    printf("render %s\n", Advice::render(result.recommendations, Advice::Code::CONDITIONS_OPTIMAL).c_str());
+    printf("notes %d\n", engine.getScientificNotes(CropId::LAWN, SoilType::SANDPEAT).indexOf("Песчано-торфяной") >= 0);
+    return 0;
+}
+"""
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def advice_codes():
+    header = read("include", "business", "advice_codes.h")
+    body = re.search(r"enum class Code : uint8_t\s*\{(.*?)\};", header, re.S).group(1)
+    return re.findall(r"^\s+(\w+)(?: = 0)?,$", body, re.M)
+
+
+def run_driver(cases):
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(DRIVER)
+        program = os.path.join(output_dir, "advice_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/web_bench/shim", "-Iinclude",
+                                 "-Isrc", driver, "src/business/nutrient_interaction_service.cpp",
+                                 "src/business/crop_recommendation_engine.cpp",
+                                 "src/business/sensor_compensation_service.cpp", "src/business/crop_target_cache.cpp",
+                                 "src/validation_utils.cpp", "-o", program],
+                                cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        stdin = "".join(f"{soil} {n} {p} {k} {ph}\n" for soil, n, p, k, ph in cases)
+        result = subprocess.run([program], input=stdin, capture_output=True, text=True, timeout=60)
+        assert result.returncode == 0, result.stderr
+    return result.stdout
+
+
+def test_interaction_codes():
+    """Коды взаимодействий с параметрами; текст совпадает с прежним"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка сервисов пропущена")
+        return
+    codes = advice_codes()
+    cases = [
+        (1, 120.0, 60.0, 200.0, 6.5),   # LOAM, норма
+        (1, 350.0, 250.0, 450.0, 5.5),  # избыток всего, кислая почва
+        (1, 120.0, 60.0, 200.0, 7.8),   # щелочная
+    ]
+    lines = run_driver(cases).splitlines()
+    assert lines[0] == "= ✅ Антагонизмов питательных веществ не обнаружено", lines[0]
+
+    items, text = lines[1].split("= ")
+    fired = {codes[int(code)]: (float(value), float(reference))
+             for code, value, reference in (item.split(":") for item in items.split())}
+    assert fired["POTASSIUM_BLOCKS_MAGNESIUM"] == (450.0, 400.0), fired
+    assert fired["NITROGEN_NEEDS_SULFUR"] == (350.0, 300.0), fired
+    assert fired["PHOSPHORUS_BLOCKS_ZINC"] == (250.0, 200.0), fired
+    assert fired["ACIDIC_LIME_BORON"] == (5.5, 6.0), fired
+    # Прежний текст: каждая строка с переводом строки, в том числе последняя
+    assert text == ("💡 Высокий K → внести MgSO4|💡 Высокий N → внести серу|💡 Высокий P → внести цинк|"
+                    "💡 Кислая почва → известковать, бор|"), text
+
+    items, text = lines[2].split("= ")
+    assert [codes[int(item.split(":")[0])] for item in items.split()] == ["ALKALINE_SOIL"], items
+    assert text == "⚠️ Щелочная почва → подкислить|", text
+
+
+def test_engine_returns_enums():
+    """Движок возвращает перечисления и коды; текст - по запросу"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка сервисов пропущена")
+        return
+    codes = advice_codes()
+    output = run_driver([])
+    engine = next(line for line in output.splitlines() if line.startswith("engine ")).split()
+    assert engine[1:4] == ["5", "3", "1"], engine  # BLUEBERRY, CLAY, SUMMER
+    fired = [line.split() for line in output.splitlines() if line.startswith("code ")]
+    names = [codes[int(row[1])] for row in fired]
+    assert "BLUEBERRY_HIGH_PH_CLAY" in names, names
+    row = fired[names.index("BLUEBERRY_HIGH_PH_CLAY")]
+    assert float(row[2]) == 6.8 and float(row[3]) < 6.8, row
+    assert "🫐 Для черники: pH слишком высокий. Внесите серу или кислый торф, добавьте торф для подкисления" in output
+    assert "notes 1" in output
+
+    header = read("src", "business", "crop_recommendation_engine.h")
+    result = header[header.index("struct RecommendationResult"):]
+    assert "String" not in result[:result.index("};")]
+    colors = header[header.index("struct ColorIndicators"):]
+    assert "String" not in colors[:colors.index("};")]
+    source = read("src", "business", "crop_recommendation_engine.cpp")
+    assert '= "green"' not in source and "RecommendationParams" not in source
+
+
+def test_codes_are_served():
+    """?fields=codes отдаёт коды; каталог текстов и уровней - /api/v2/advice"""
+    routes = read("src", "web", "routes_data.cpp")
+    assert '{"codes", FIELDS_CODES}' in routes
+    assert 'doc.createNestedArray("interaction_codes")' in routes
+    assert 'doc.createNestedArray("crop_codes")' in routes
+    assert "webServer.on(API_V2_ADVICE, HTTP_GET, sendAdviceCatalogue);" in routes
+    handler = routes[routes.index("void sendAdviceCatalogue()"):routes.index("const String& getCachedSensorJson()")]
+    assert "sendNotModifiedIfMatch" in handler and "ChunkedPageWriter" in handler
+    # Тег - хэш содержимого каталога во время компиляции, а не постоянная с солью загрузки
+    assert "makeGenerationEtag" not in handler and "ADVICE_CATALOGUE_HASH" in handler
+    catalogue_hash = routes[routes.index("constexpr uint32_t adviceCatalogueHash()"):routes.index("void sendAdviceCatalogue()")]
+    for table in ("Advice::SEVERITY_NAMES", "Advice::ADVICE_TEXTS", "CropRules::MESSAGE_TEXTS", "entry.severity"):
+        assert table in catalogue_hash, table
+    assert "constexpr uint32_t ADVICE_CATALOGUE_HASH = adviceCatalogueHash();" in catalogue_hash
+    assert 'API_V2_ADVICE API_V2_ROOT "/advice"' in read("include", "jxct_strings.h")
+
+    # Таблица текстов в порядке кодов
+    header = read("include", "business", "advice_codes.h")
+    rows = re.findall(r"\{Code::(\w+), Severity::", header)
+    assert rows == advice_codes(), rows
+
+
+def main():
+    print("🧪 Тестирование кодов рекомендаций")
+    print("=" * 60)
+
+    tests = [
+        test_interaction_codes,
+        test_engine_returns_enums,
+        test_codes_are_served,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+"""
+Тест потокового разбора калибровочного CSV (src/business/calibration_csv_parser.cpp)
+Собирает настоящий CalibrationCsvParser g++ с шимами test/web_bench и кормит его
+кусками разной длины (от 1 байта, как upload.buf при медленной загрузке): результат
+не зависит от разбиения и совпадает с зеркалом на Python; ошибки указывают строку;
+загрузка файла разбирается по кускам, а не через чтение String целиком
+"""
+
+import math
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+SENSORS = ["temperature", "humidity", "ec", "ph", "nitrogen", "phosphorus", "potassium"]
+FIELD_SIZE = 24  # CALIBRATION_CSV_FIELD_SIZE
+MAX_POINTS = 64  # CALIBRATION_CSV_MAX_POINTS
+ERRORS = ["NONE", "FIELD_TOO_LONG", "BAD_NUMBER", "UNKNOWN_SENSOR", "COLUMN_COUNT", "TOO_MANY_POINTS",
+          "NOT_ASCENDING", "EMPTY"]
+
+DRIVER = r"""
+#include <cstdio>
+#include <vector>
+#include "business/calibration_csv_parser.h"
+
+int main(int argc, char** argv)
+{
+    const size_t chunk = static_cast<size_t>(atoi(argv[2]));
+    FILE* input = fopen(argv[1], "rb");
+    std::vector<uint8_t> buffer(chunk);
+    CalibrationTable table;
+    CalibrationCsvParser parser;
+    parser.begin(table);
+    size_t read = 0;
+    while ((read = fread(buffer.data(), 1, chunk, input)) > 0)
+    {
+        parser.feed(buffer.data(), read);
+    }
+    fclose(input);
+    const bool ok = parser.finish();
+    printf("%d %d %zu %zu\n", ok ? 1 : 0, static_cast<int>(parser.error()), parser.errorLine(), parser.pointCount());
+    const std::vector<CalibrationPoint>* columns[] = {&table.temperaturePoints, &table.humidityPoints, &table.ecPoints,
+                                                      &table.phPoints, &table.nitrogenPoints, &table.phosphorusPoints,
+                                                      &table.potassiumPoints};
+    for (const auto* points : columns)
+    {
+        for (const auto& point : *points)
+        {
+            printf("%g:%g ", point.rawValue, point.referenceValue);
+        }
+        printf("\n");
+    }
+    return 0;
+}
+"""
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def parse_number(text):
+    """strtof() с проверкой, что разобрано всё поле и число конечно"""
+    try:
+        value = float(text)
+    except ValueError:
+        return None
+    return value if "_" not in text and math.isfinite(value) else None
+
+
+def mirror_parse(data):
+    """Зеркало CalibrationCsvParser: (ошибка, строка, таблица)"""
+    table = {name: [] for name in SENSORS}
+    header_allowed = True
+    lines = data.split("\n")
+    for number, raw_line in enumerate(lines, start=1):
+        text = raw_line.replace("\r", "")
+        if text.lstrip(" \t") == "" or text.lstrip(" \t").startswith("#"):
+            continue
+        fields = text.split(",")
+        target = None
+        raw = None
+        for index, field in enumerate(fields):
+            if len(field.lstrip(" \t")) >= FIELD_SIZE:
+                return "FIELD_TOO_LONG", number, table
+            field = field.strip(" \t")
+            if index == 0:
+                target = table.get(field)
+                if target is None and not header_allowed:
+                    return "UNKNOWN_SENSOR", number, table
+                header_allowed = False
+                if target is None:
+                    break
+            elif index == 1:
+                raw = parse_number(field)
+                if raw is None:
+                    return "BAD_NUMBER", number, table
+            elif index == 2:
+                reference = parse_number(field)
+                if reference is None:
+                    return "BAD_NUMBER", number, table
+                if len(target) >= MAX_POINTS:
+                    return "TOO_MANY_POINTS", number, table
+                if target and raw <= target[-1][0]:
+                    return "NOT_ASCENDING", number, table
+                target.append((raw, reference))
+            else:
+                return "COLUMN_COUNT", number, table
+        else:
+            if len(fields) != 3:
+                return "COLUMN_COUNT", number, table
+    if not any(table.values()):
+        return "EMPTY", len(lines), table
+    return "NONE", 0, table
+
+
+def build_driver(output_dir):
+    driver = os.path.join(output_dir, "driver.cpp")
+    with open(driver, "w", encoding="utf-8") as handle:
+        handle.write(DRIVER)
+    program = os.path.join(output_dir, "csv_driver")
+    result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/web_bench/shim", "-Iinclude",
+                             "-Isrc", "-Isrc/web", driver, "src/business/calibration_csv_parser.cpp", "-o", program],
+                            cwd=PROJECT_DIR, capture_output=True, text=True)
+    assert result.returncode == 0, result.stderr[-2000:]
+    return program
+
+
+def run_driver(program, output_dir, data, chunk):
+    path = os.path.join(output_dir, "input.csv")
+    with open(path, "wb") as handle:
+        handle.write(data.encode("utf-8"))
+    result = subprocess.run([program, path, str(chunk)], capture_output=True, text=True, timeout=30)
+    assert result.returncode == 0, result.stderr
+    lines = result.stdout.split("\n")
+    ok, error, line, count = (int(value) for value in lines[0].split())
+    table = {}
+    for name, points in zip(SENSORS, lines[1:]):
+        table[name] = [tuple(float(part) for part in point.split(":")) for point in points.split()]
+    return bool(ok), ERRORS[error], line, count, table
+
+
+VALID_CSV = (
+    "sensor_type,raw_value,reference_value\r\n"
+    "# Кислотность\r\n"
+    "ph, 4.0 ,4.1\r\n"
+    "ph,7.0,6.9\r\n"
+    "\r\n"
+    "ec,0,0\n"
+    "ec,1000,1180.5\n"
+    "temperature,-5,-4.5\n"
+    "potassium,100,96"
+)
+
+CASES = [
+    ("valid", VALID_CSV),
+    ("no_header", "ph,4,4.1\nph,7,7.2\n"),
+    ("bad_number", "sensor_type,raw,ref\nph,4,4.1\nph,7x,7.2\n"),
+    ("unknown_sensor", "sensor_type,raw,ref\nph,4,4.1\nsalinity,1,1\n"),
+    ("columns", "sensor_type,raw,ref\nph,4,4.1,9\n"),
+    ("short_line", "sensor_type,raw,ref\nph,4\n"),
+    ("descending", "sensor_type,raw,ref\nec,1000,1\nec,500,1\n"),
+    ("long_field", "sensor_type,raw,ref\nph,4.00000000000000000000000001,4\n"),
+    ("empty", "sensor_type,raw,ref\n# только комментарий\n"),
+    ("too_many", "sensor_type,raw,ref\n" + "".join(f"ec,{i},{i}\n" for i in range(MAX_POINTS + 1))),
+]
+
+
+def test_mirror_cases():
+    """Зеркало: корректный файл, заголовок необязателен, ошибки с номером строки"""
+    error, line, table = mirror_parse(VALID_CSV)
+    assert error == "NONE" and table["ph"] == [(4.0, 4.1), (7.0, 6.9)] and table["potassium"] == [(100.0, 96.0)]
+    assert mirror_parse(CASES[1][1])[2]["ph"] == [(4.0, 4.1), (7.0, 7.2)]
+    expected = {"bad_number": ("BAD_NUMBER", 3), "unknown_sensor": ("UNKNOWN_SENSOR", 3), "columns": ("COLUMN_COUNT", 2),
+                "short_line": ("COLUMN_COUNT", 2), "descending": ("NOT_ASCENDING", 3),
+                "long_field": ("FIELD_TOO_LONG", 2), "too_many": ("TOO_MANY_POINTS", MAX_POINTS + 2)}
+    for name, data in CASES:
+        if name in expected:
+            assert mirror_parse(data)[:2] == expected[name], name
+    assert mirror_parse(CASES[8][1])[0] == "EMPTY"
+
+
+def test_native_parser_matches_mirror():
+    """C++ парсер даёт тот же результат при любом разбиении на куски"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка парсера пропущена")
+        return
+    with tempfile.TemporaryDirectory() as output_dir:
+        program = build_driver(output_dir)
+        for name, data in CASES:
+            error, line, table = mirror_parse(data)
+            for chunk in (1, 2, 3, 7, 64, 1436):
+                ok, native_error, native_line, count, native_table = run_driver(program, output_dir, data, chunk)
+                assert native_error == error, f"{name}/{chunk}: {native_error} != {error}"
+                assert ok == (error == "NONE"), name
+                if error == "NONE":
+                    assert count == sum(len(points) for points in table.values()), name
+                    for sensor in SENSORS:
+                        assert [(round(r, 3), round(v, 3)) for r, v in native_table[sensor]] == \
+                               [(round(r, 3), round(v, 3)) for r, v in table[sensor]], f"{name}/{sensor}"
+                elif error != "EMPTY":
+                    assert native_line == line, f"{name}/{chunk}: строка {native_line} != {line}"
+
+        # Длинный файл с комментариями: память парсера не растёт с размером, таблица - до предела точек
+        big = "sensor_type,raw,ref\n" + "# комментарий калибровки\n" * 20000 + "".join(
+            f"{sensor},{i},{i * 1.01:.2f}\n" for sensor in SENSORS for i in range(MAX_POINTS))
+        ok, error, _, count, _ = run_driver(program, output_dir, big, 1436)
+        assert ok and error == "NONE" and count == len(SENSORS) * MAX_POINTS
+
+
+def test_upload_streams_into_parser():
+    """Загрузка кормит парсер кусками upload.buf и заменяет custom.csv только принятым CSV;
+    строковый разбор через indexOf/substring удалён"""
+    routes = read("src", "web", "routes_data.cpp")
+    handler = routes[routes.index("void handleReadingsUpload()"):routes.index("void handleProfileSave()")]
+    assert "uploadParser.begin(uploadTable);" in handler
+    assert "uploadParser.feed(upload.buf, upload.currentSize);" in handler
+    assert "gCalibrationService.installCalibrationTable(uploadProfile, std::move(uploadTable));" in handler
+
+    # custom.csv заменяется только после успешного разбора: запись во временный файл
+    assert 'uploadTempPath = String(path) + ".tmp";' in handler
+    assert "LittleFS.open(uploadTempPath" in handler and "LittleFS.open(path" not in handler
+    rejected = handler[handler.index("if (!uploadParser.finish())"):]
+    assert rejected.index("discardUploadTemp();") < rejected.index("return;")
+    assert handler.index("commitUploadTemp(") > handler.index("if (!uploadParser.finish())")
+    aborted = handler[handler.index("UPLOAD_FILE_ABORTED"):]
+    assert "discardUploadTemp();" in aborted
+    helpers = routes[routes.index("void discardUploadTemp()"):routes.index("void handleReadingsUpload()")]
+    assert "LittleFS.remove(uploadTempPath);" in helpers
+    assert "LittleFS.rename(uploadTempPath.c_str(), path)" in helpers
+
+    service = read("src", "business", "sensor_calibration_service.cpp")
+    parse = service[service.index("bool SensorCalibrationService::parseCalibrationCSV"):
+                    service.index("bool SensorCalibrationService::validateCalibrationPoints")]
+    assert "CalibrationCsvParser parser;" in parse
+    assert "substring" not in parse and "indexOf" not in parse
+
+    parser = read("src", "business", "calibration_csv_parser.cpp")
+    assert "String" not in parser
+    assert "business/calibration_csv_parser.cpp" in read("platformio.ini")
+
+
+def main():
+    print("🧪 Тестирование потокового разбора калибровочного CSV")
+    print("=" * 60)
+
+    tests = [
+        test_mirror_cases,
+        test_native_parser_matches_mirror,
+        test_upload_streams_into_parser,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
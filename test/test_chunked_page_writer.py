@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""
+Тест потоковой отдачи ответов (include/web/chunked_page_writer.h)
+Зеркало ChunkedPageWriter отдаёт фрагменты через локальный HTTP/1.1 сервер
+чанками; проверяется сборка ответа клиентом и граница буфера. Страницы панели -
+оболочка SPA (test_web_app.py); писателем отдаётся каталог /api/v2/advice
+"""
+
+import http.client
+import os
+import sys
+import threading
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+CHUNK_BUFFER_SIZE = 1024  # WEB_CHUNK_BUFFER_SIZE
+
+
+class ChunkedPageWriter:
+    """Зеркало ChunkedPageWriter: фиксированный буфер, крупные фрагменты - напрямую"""
+
+    def __init__(self, send_chunk):
+        self.send_chunk = send_chunk
+        self.buffer = bytearray()
+        self.peak = 0
+        self.chunks = 0
+
+    def write(self, data):
+        if len(data) >= CHUNK_BUFFER_SIZE:
+            self.flush()
+            self._emit(data)
+            return
+        if len(self.buffer) + len(data) > CHUNK_BUFFER_SIZE:
+            self.flush()
+        self.buffer += data
+        self.peak = max(self.peak, len(self.buffer))
+
+    def _emit(self, data):
+        self.send_chunk(bytes(data))
+        self.chunks += 1
+
+    def flush(self):
+        if self.buffer:
+            self._emit(self.buffer)
+            self.buffer = bytearray()
+
+    def end(self):
+        self.flush()
+        self.send_chunk(b"")
+
+
+def page_fragments():
+    """Фрагменты типичной страницы: мелкие теги, строки таблицы, крупный блок скрипта"""
+    fragments = [b"<!DOCTYPE html><html><head><meta charset='UTF-8'>", "<title>Показания</title>".encode("utf-8")]
+    for row in range(120):
+        fragments.append(f"<tr><td>Параметр {row}</td><td><span id='v{row}'></span></td></tr>".encode("utf-8"))
+    fragments.append(b"<script>" + b"var x=1;" * (CHUNK_BUFFER_SIZE // 4) + b"</script>")
+    fragments.append(b"</body></html>")
+    return fragments
+
+
+class StreamingStandIn(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    fragments = []
+    writer = None
+
+    def do_GET(self):  # noqa: N802 - имя задано http.server
+        self.send_response(200)
+        self.send_header("Content-Type", "text/html; charset=utf-8")
+        self.send_header("Transfer-Encoding", "chunked")
+        self.end_headers()
+
+        def send_chunk(data):
+            self.wfile.write(f"{len(data):x}\r\n".encode() + data + b"\r\n")
+
+        writer = ChunkedPageWriter(send_chunk)
+        StreamingStandIn.writer = writer
+        for fragment in self.fragments:
+            writer.write(fragment)
+        writer.end()
+
+    def log_message(self, *_args):
+        pass
+
+
+def test_page_streamed_and_reassembled():
+    """Клиент собирает страницу из чанков байт-в-байт"""
+    fragments = page_fragments()
+    StreamingStandIn.fragments = fragments
+    server = ThreadingHTTPServer(("127.0.0.1", 0), StreamingStandIn)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    try:
+        conn = http.client.HTTPConnection("127.0.0.1", server.server_address[1], timeout=5)
+        conn.request("GET", "/readings")
+        response = conn.getresponse()
+        body = response.read()
+        assert response.status == 200
+        assert response.getheader("Transfer-Encoding") == "chunked"
+        assert body == b"".join(fragments)
+        writer = StreamingStandIn.writer
+        assert writer.peak <= CHUNK_BUFFER_SIZE
+        assert writer.chunks >= len(body) // CHUNK_BUFFER_SIZE
+        print(f"   {len(body)} байт страницы, {writer.chunks} чанков, буфер {writer.peak} байт")
+    finally:
+        server.shutdown()
+
+
+def test_large_fragment_bypasses_buffer():
+    """Фрагмент больше буфера уходит напрямую, предыдущие данные - раньше него"""
+    sent = []
+    writer = ChunkedPageWriter(sent.append)
+    writer.write(b"head")
+    writer.write(b"x" * (CHUNK_BUFFER_SIZE * 2))
+    writer.write(b"tail")
+    writer.end()
+    assert sent == [b"head", b"x" * (CHUNK_BUFFER_SIZE * 2), b"tail", b""]
+
+
+def main():
+    print("🧪 Тестирование потоковой отдачи HTML")
+    print("=" * 60)
+
+    tests = [
+        test_page_streamed_and_reassembled,
+        test_large_fragment_bypasses_buffer,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""
+Тест ядра компенсации (SensorCompensationService::compensate)
+EC, pH, NPK и ASM за один проход по строке почвы: результат совпадает с прежними
+формулами (std::exp и деление на FC - PWP) в пределах документированных погрешностей
+fastExpSmall() и asmScale; входы вне диапазона оставляют значения как есть; во внутреннем
+пути нет журнала, sensor_processing вызывает ядро
+"""
+
+import math
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+# Документированная граница: e^0.5 * 0.5^6 / 720 плюс округление float
+FAST_EXP_BOUND = 3.6e-5
+# Документированная граница asmScale относительно деления: 4 ulp, менее 2.5e-5 процентного пункта
+ASM_SCALE_MAX_ULP = 4
+ASM_SCALE_MAX_ABS = 2.5e-5
+
+DRIVER = r"""
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "business/sensor_compensation_service.h"
+
+void logDebug(const String&) {}
+
+int main()
+{
+    // ASM по строке почвы против прежнего (VWC - PWP) / (FC - PWP) * 100 с ограничением 0-100%
+    int32_t worstUlp = 0;
+    double worstAsm = 0.0;
+    for (size_t soil = 0; soil < SOIL_TYPE_COUNT; ++soil)
+    {
+        const float pwp = SOIL_COMPENSATION_ROWS[soil].wiltingPoint;
+        const float fc = SOIL_COMPENSATION_ROWS[soil].fieldCapacity;
+        for (int i = -10000; i <= 110000; ++i)
+        {
+            const float vwc = static_cast<float>(i) * 1e-5F;
+            float legacy = (vwc - pwp) / (fc - pwp) * 100.0F;
+            if (legacy < 0.0F) legacy = 0.0F;
+            if (legacy > 100.0F) legacy = 100.0F;
+            const float current = SensorCompensationService::vwcToAsm(vwc, static_cast<SoilType>(soil));
+            int32_t legacyBits = 0;
+            int32_t currentBits = 0;
+            memcpy(&legacyBits, &legacy, sizeof(float));
+            memcpy(&currentBits, &current, sizeof(float));
+            worstUlp = std::max(worstUlp, std::abs(legacyBits - currentBits));  // оба >= 0 - биты монотонны
+            worstAsm = std::fmax(worstAsm, std::fabs(static_cast<double>(legacy) - current));
+        }
+    }
+    printf("asm %d %.9g\n", worstUlp, worstAsm);
+
+    // Максимальная относительная ошибка fastExpSmall() на [-0.5, 0.5]
+    double worst = 0.0;
+    for (int i = -500000; i <= 500000; ++i)
+    {
+        const float x = static_cast<float>(i) * 1e-6F;
+        const double exact = std::exp(static_cast<double>(x));
+        worst = std::fmax(worst, std::fabs(fastExpSmall(x) - exact) / exact);
+    }
+    printf("fastexp %.9g\n", worst);
+
+    for (unsigned soil = 0; soil < SOIL_TYPE_COUNT + 1; ++soil)
+    {
+        for (const float t : {-60.0F, -50.0F, -10.0F, 5.0F, 20.0F, 25.0F, 38.5F, 60.0F, 100.0F, 120.0F})
+        {
+            for (const float h : {-5.0F, 0.0F, 4.0F, 15.0F, 30.0F, 47.5F, 80.0F, 100.0F, 110.0F})
+            {
+                SensorData data{};
+                data.temperature = t;
+                data.humidity = h;
+                data.ec = 1500.0F;
+                data.ph = 6.5F;
+                data.nitrogen = 120.0F;
+                data.phosphorus = 45.0F;
+                data.potassium = 210.0F;
+                const CompensatedReading r = SensorCompensationService::compensate(data, static_cast<SoilType>(soil));
+                const float asmSingle = SensorCompensationService::vwcToAsm(h / 100.0F, static_cast<SoilType>(soil));
+                printf("%u %.9g %.9g %.9g %.9g %.9g %.9g %.9g %.9g %d\n", soil, t, h, r.ec, r.ph, r.nitrogen,
+                       r.phosphorus, r.potassium, r.asmPercent, memcmp(&asmSingle, &r.asmPercent, sizeof(float)) == 0);
+            }
+        }
+    }
+    return 0;
+}
+"""
+
+# (FC, PWP, δN, δP, δK, εN, εP, εK) в порядке SoilType; последняя строка - по умолчанию
+SOILS = [
+    (0.10, 0.05, 0.0041, 0.0053, 0.0032, 0.01, 0.008, 0.012),
+    (0.20, 0.12, 0.0038, 0.0049, 0.0029, 0.009, 0.007, 0.011),
+    (0.45, 0.25, 0.0028, 0.0035, 0.0018, 0.012, 0.009, 0.015),
+    (0.35, 0.20, 0.0032, 0.0042, 0.0024, 0.008, 0.006, 0.010),
+    (0.30, 0.12, 0.0040, 0.0051, 0.0031, 0.010, 0.008, 0.012),
+    (0.15, 0.10, 0.0035, 0.0045, 0.0027, 0.009, 0.007, 0.011),
+    (0.25, 0.18, 0.0030, 0.0039, 0.0022, 0.008, 0.006, 0.010),
+    (0.50, 0.20, 0.0025, 0.0032, 0.0016, 0.013, 0.010, 0.016),
+    (0.12, 0.08, 0.0039, 0.0050, 0.0030, 0.010, 0.008, 0.012),
+    (0.18, 0.15, 0.0036, 0.0047, 0.0028, 0.009, 0.007, 0.011),
+    (0.30, 0.22, 0.0028, 0.0037, 0.0021, 0.008, 0.006, 0.010),
+    (0.20, 0.12, 0.0045, 0.0058, 0.0035, 0.007, 0.005, 0.008),
+    (0.25, 0.15, 0.0033, 0.0043, 0.0026, 0.009, 0.007, 0.011),
+    (0.20, 0.12, 0.0041, 0.0053, 0.0032, 0.01, 0.008, 0.012),
+]
+
+
+def f32(value):
+    return struct.unpack("f", struct.pack("f", value))[0]
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def run_driver():
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(DRIVER)
+        program = os.path.join(output_dir, "kernel_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/web_bench/shim",
+                                 "-Iinclude", "-Isrc", driver, "src/business/sensor_compensation_service.cpp",
+                                 "-o", program], cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=120)
+        assert result.returncode == 0, result.stderr
+    return result.stdout.splitlines()
+
+
+def reference(soil, t, h):
+    """Прежние формулы correctEC/correctPH/correctNPK и vwcToAsm в double"""
+    fc, pwp, dn, dp, dk, en, ep, ek = SOILS[soil]
+    temperature_valid = -50.0 <= t <= 100.0
+    soil_valid = soil < len(SOILS) - 1
+    npk_valid = temperature_valid and soil_valid and 0.0 <= h <= 100.0
+    ec = 1500.0 * (1.0 + 0.021 * (t - 25.0)) if temperature_valid and soil_valid else 1500.0
+    ph = 6.5 - 0.003 * (t - 25.0) if temperature_valid else 6.5
+
+    def npk(value, delta, epsilon):
+        return value * math.exp(delta * (t - 20.0)) * (1.0 + epsilon * (h - 30.0)) if npk_valid else value
+
+    asm = min(100.0, max(0.0, (h / 100.0 - pwp) / (fc - pwp) * 100.0))
+    return ec, ph, npk(120.0, dn, en), npk(45.0, dp, ep), npk(210.0, dk, ek), asm
+
+
+def test_kernel_matches_previous_formulas():
+    """Ядро совпадает с прежними формулами для всех почв, температур и влажностей"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка ядра пропущена")
+        return
+    lines = run_driver()
+    _, asm_ulp, asm_abs = lines[0].split()
+    assert int(asm_ulp) <= ASM_SCALE_MAX_ULP and float(asm_abs) < ASM_SCALE_MAX_ABS, lines[0]
+    lines = lines[1:]
+    worst = float(lines[0].split()[1])
+    assert worst < FAST_EXP_BOUND, worst
+
+    rows = [line.split() for line in lines[1:]]
+    assert len(rows) == len(SOILS) * 10 * 9
+    for row in rows:
+        soil, t, h = int(row[0]), float(row[1]), float(row[2])
+        ec, ph, n, p, k, asm = (float(value) for value in row[3:9])
+        assert row[9] == "1", row  # compensate() и vwcToAsm() считают ASM одной функцией
+        expected = reference(soil, t, h)
+        # EC и pH - те же операции во float
+        assert abs(ec - expected[0]) <= 1e-6 * abs(expected[0]) + 1e-3, (row, expected)
+        assert abs(ph - expected[1]) < 1e-5, (row, expected)
+        for value, exact in zip((n, p, k), expected[2:5]):
+            assert abs(value - exact) <= (FAST_EXP_BOUND + 1e-6) * abs(exact) + 1e-6, (row, expected)
+        # ASM: умножение на предрасчитанный 100 / (FC - PWP) вместо деления; граница проверена выше
+        assert abs(asm - expected[5]) < 1e-3, (row, expected)
+        if not 0.0 <= h <= 100.0 or not -50.0 <= t <= 100.0:
+            assert (n, p, k) == (f32(120.0), f32(45.0), f32(210.0)), row
+
+
+def test_kernel_has_no_logging():
+    """Во внутреннем пути нет журнала и std::exp; обработка показаний вызывает ядро"""
+    header = read("src", "business", "sensor_compensation_service.h")
+    kernel = header[header.index("static CompensatedReading compensate("):header.index("static float vwcToAsm(")]
+    assert "log" not in kernel and "exp(" not in kernel.replace("fastExpSmall(", "")
+    assert "static_assert(npkExponentsAreSmall()" in header
+    assert "SOIL_COMPENSATION_ROWS" in header and "asmScale" in header
+    assert "result.asmPercent = asmFromRow(row, data.humidity / 100.0F);" in kernel
+
+    processing = read("src", "sensor_processing.cpp")
+    assert "SensorCompensationService::compensate(sensorData, soil)" in processing
+    assert "gCompensationService.correctNPK" not in processing
+    source = read("src", "business", "sensor_compensation_service.cpp")
+    assert "exp(coeffs" not in source
+
+
+def main():
+    print("🧪 Тестирование ядра компенсации")
+    print("=" * 60)
+
+    tests = [
+        test_kernel_matches_previous_formulas,
+        test_kernel_has_no_logging,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -9,6 +9,23 @@ import re
 import os
 import sys
 
+RULES_PATH = "include/business/crop_rules.h"
+TERM_OPERATORS = {"Below": "<", "Above": ">", "AtLeast": ">="}
+TERM_CHANNELS = {"nitrogen": "n", "phosphorus": "p", "potassium": "k"}
+
+
+def rules_section(content, crop_id):
+    """Блок правил культуры (с комментарием) и тексты её сообщений из crop_rules.h; None - правил нет"""
+    rows = re.findall(rf'(?:^[ \t]*//.*\n)*(?:^[ \t]*when\w+\(CropId::{crop_id.upper()}, .*\n)+', content, re.M)
+    texts = re.findall(rf'\{{MessageId::{crop_id.upper()}_\w+,\s*((?:"[^"]*"\s*)+)\}}', content)
+    return "\n".join(rows + texts) if rows else None
+
+
+def rule_terms(section, prefix):
+    """Условия правил вида phBelow(6.5F) -> [("<", "6.5")]"""
+    return [(TERM_OPERATORS[op], value) for op, value in re.findall(rf'\b{prefix}(Below|Above|AtLeast)\(([\d.]+)F\)', section)]
+
+
 # Научно подтвержденные данные для культур
 SCIENTIFIC_CROP_DATA = {
     "tomato": {
@@ -89,17 +106,14 @@ def analyze_crop_implementation():
     """Анализ реализации культур в коде"""
     print("🔬 АНАЛИЗ: Реализация культур в коде")
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
-    with open(crop_engine_path, 'r', encoding='utf-8') as f:
+    with open(RULES_PATH, 'r', encoding='utf-8') as f:
         content = f.read()
     
     # Находим все культуры с рекомендациями
     implemented_crops = []
     
     for crop_id in SCIENTIFIC_CROP_DATA.keys():
-        pattern = rf'if \(cropName == "{crop_id}".*?\}}'
-        match = re.search(pattern, content, re.DOTALL)
-        if match:
+        if rules_section(content, crop_id):
             implemented_crops.append(crop_id)
             print(f"✅ {crop_id}: Реализован")
         else:
@@ -113,25 +127,22 @@ def validate_crop_conditions(crop_id, implemented_crops):
     if crop_id not in implemented_crops:
         return {"status": "not_implemented", "issues": ["Культура не реализована"]}
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
-    with open(crop_engine_path, 'r', encoding='utf-8') as f:
+    with open(RULES_PATH, 'r', encoding='utf-8') as f:
         content = f.read()
     
     # Извлекаем секцию культуры
-    pattern = rf'if \(cropName == "{crop_id}".*?\}}(?=\s*else if|\s*// 🌱)'
-    match = re.search(pattern, content, re.DOTALL)
+    crop_section = rules_section(content, crop_id)
     
-    if not match:
+    if not crop_section:
         return {"status": "parse_error", "issues": ["Не удалось найти секцию культуры"]}
     
-    crop_section = match.group(0)
     scientific_data = SCIENTIFIC_CROP_DATA[crop_id]
     
     issues = []
     recommendations = []
     
     # Проверяем pH условия
-    ph_conditions = re.findall(r'pH\s*([<>]=?)\s*([\d.]+)F', crop_section)
+    ph_conditions = rule_terms(crop_section, "ph")
     if ph_conditions:
         for operator, value in ph_conditions:
             value = float(value)
@@ -148,8 +159,7 @@ def validate_crop_conditions(crop_id, implemented_crops):
     
     # Проверяем NPK условия
     for nutrient in ["nitrogen", "phosphorus", "potassium"]:
-        npk_pattern = rf'npk\.{nutrient}\s*([<>]=?)\s*([\d.]+)F'
-        npk_conditions = re.findall(npk_pattern, crop_section)
+        npk_conditions = rule_terms(crop_section, TERM_CHANNELS[nutrient])
         
         if npk_conditions:
             for operator, value in npk_conditions:
@@ -215,22 +225,19 @@ def test_crop_triggers():
     if crop_id not in SCIENTIFIC_CROP_DATA:
         raise AssertionError(f"Культура {crop_id} не найдена в данных")
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
-    with open(crop_engine_path, 'r', encoding='utf-8') as f:
+    with open(RULES_PATH, 'r', encoding='utf-8') as f:
         content = f.read()
     
     # Извлекаем секцию культуры
-    pattern = rf'if \(cropName == "{crop_id}".*?\}}(?=\s*else if|\s*// 🌱)'
-    match = re.search(pattern, content, re.DOTALL)
+    crop_section = rules_section(content, crop_id)
     
-    if not match:
+    if not crop_section:
         raise AssertionError(f"Секция культуры {crop_id} не найдена в коде")
     
-    crop_section = match.group(0)
     triggers = []
     
     # Проверяем pH условия
-    ph_conditions = re.findall(r'if \(pH\s*([<>]=?)\s*([\d.]+)F\)', crop_section)
+    ph_conditions = rule_terms(crop_section, "ph")
     for operator, value in ph_conditions:
         value = float(value)
         ph = sensor_values["ph"]
@@ -246,8 +253,7 @@ def test_crop_triggers():
     
     # Проверяем NPK условия
     for nutrient in ["nitrogen", "phosphorus", "potassium"]:
-        npk_pattern = rf'if \(npk\.{nutrient}\s*([<>]=?)\s*([\d.]+)F\)'
-        npk_conditions = re.findall(npk_pattern, crop_section)
+        npk_conditions = rule_terms(crop_section, TERM_CHANNELS[nutrient])
         
         for operator, value in npk_conditions:
             value = float(value)
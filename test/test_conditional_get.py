@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Тест условных GET-запросов JSON API (src/web/conditional_get.cpp)
+Зеркало логики: тег по поколению и настройкам меняется вместе с данными и солью
+загрузки, тег по хэшу тела - вместе с телом; совпавший If-None-Match даёт 304
+без тела; маршруты /sensor_json, /api/calibration/status, /api/ota/status и
+/service_status отвечают через общий модуль
+"""
+
+import os
+import re
+import sys
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+ETAG_HASH_SEED = 2166136261
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def hash_etag_bytes(hash_value, data):
+    """Зеркало hashEtagBytes()"""
+    for byte in data:
+        hash_value ^= byte
+        hash_value = (hash_value * 16777619) & 0xFFFFFFFF
+    return hash_value
+
+
+def etag_matches(if_none_match, etag):
+    """Зеркало etagMatches()"""
+    return if_none_match == "*" or etag in if_none_match
+
+
+def make_generation_etag(boot_salt, generation, config_hash):
+    """Зеркало makeGenerationEtag()"""
+    return f'"{boot_salt:08x}-{generation:08x}-{config_hash:08x}"'
+
+
+def content_etag(body):
+    """Тег sendJsonWithEtag(): длина и FNV-1a тела"""
+    data = body.encode("utf-8")
+    return f'"c{len(data):x}-{hash_etag_bytes(ETAG_HASH_SEED, data):08x}"'
+
+
+def respond(etag, body, if_none_match=None):
+    """Зеркало sendNotModifiedIfMatch() + отправки тела"""
+    headers = {"ETag": etag, "Cache-Control": "no-cache"}
+    if if_none_match is not None and etag_matches(if_none_match, etag):
+        return 304, headers, ""
+    return 200, headers, body
+
+
+def test_generation_etag():
+    """Тег меняется с поколением, настройками и после перезагрузки; помещается в буфер"""
+    base = make_generation_etag(0x1234ABCD, 7, 0xDEADBEEF)
+    assert base == '"1234abcd-00000007-deadbeef"'
+    assert make_generation_etag(0x1234ABCD, 8, 0xDEADBEEF) != base
+    assert make_generation_etag(0x1234ABCD, 7, 0xDEADBEEE) != base
+    assert make_generation_etag(0x0BADF00D, 7, 0xDEADBEEF) != base
+    longest = make_generation_etag(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF)
+    assert len(longest) + 1 <= 32  # WEB_ETAG_BUFFER_SIZE
+    assert len(content_etag("x" * 0xFFFFFFF)) + 1 <= 32
+
+
+def test_content_etag():
+    """Одинаковое тело - одинаковый тег; любое изменение - другой"""
+    body = '{"wifi_connected":true,"sensor_ok":true}'
+    assert content_etag(body) == content_etag(body)
+    assert content_etag(body) != content_etag(body.replace("true", "false", 1))
+    assert content_etag(body).startswith(f'"c{len(body):x}-')
+
+
+def test_not_modified_flow():
+    """Первый запрос - 200 с телом, повтор с тегом - 304 без тела, слабый тег и * тоже совпадают"""
+    body = '{"status":"idle","version":"3.13.2"}'
+    etag = content_etag(body)
+    code, headers, sent = respond(etag, body)
+    assert code == 200 and sent == body and headers["ETag"] == etag
+    assert headers["Cache-Control"] == "no-cache"
+
+    code, headers, sent = respond(etag, body, headers["ETag"])
+    assert code == 304 and sent == "" and headers["ETag"] == etag
+    assert respond(etag, body, f'W/{etag}')[0] == 304
+    assert respond(etag, body, f'"other", {etag}')[0] == 304
+    assert respond(etag, body, "*")[0] == 304
+
+    changed = body.replace("idle", "checking")
+    assert respond(content_etag(changed), changed, etag)[0] == 200
+
+
+def test_routes_use_shared_middleware():
+    """JSON-маршруты отвечают через conditional_get, /sensor_json - до сериализации"""
+    data = read("src", "web", "routes_data.cpp")
+    handler = data[data.index("void sendSensorJson()"):data.index("void setupDataRoutes()")]
+    etag_at = handler.index("makeGenerationEtag(getSensorDataGeneration(), getSensorJsonConfigHash(), etag);")
+    assert etag_at < handler.index("if (sendNotModifiedIfMatch(etag.data()))") < handler.index("getCachedSensorJson()")
+
+    calibration = read("src", "web", "routes_calibration.cpp")
+    status = calibration[calibration.index("void handleCalibrationStatus()"):]
+    assert "sendJsonWithEtag(response);" in status[:status.index("catch")]
+
+    ota = read("src", "web", "routes_ota.cpp")
+    assert "sendJsonWithEtag(json);" in ota[ota.index("static void sendOtaStatusJson()\n{"):]
+
+    service = read("src", "web", "routes_service.cpp")
+    assert "sendJsonWithEtag(json);" in service[service.index("static void sendServiceStatusJson()\n{"):]
+
+    static = read("src", "web", "routes_static.cpp")
+    assert "bool etagMatches" not in static and "conditional_get.h" in static
+    assert re.search(r'"If-None-Match"', static)
+
+
+def main():
+    print("🧪 Тестирование условных GET (ETag / 304)")
+    print("=" * 60)
+
+    tests = [
+        test_generation_etag,
+        test_content_etag,
+        test_not_modified_flow,
+        test_routes_use_shared_middleware,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
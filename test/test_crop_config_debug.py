@@ -42,9 +42,11 @@ def test_crop_engine_support():
     try:
         with open('src/business/crop_recommendation_engine.cpp', 'r', encoding='utf-8') as f:
             content = f.read()
+        with open('include/business/crop_table.h', 'r', encoding='utf-8') as f:
+            table = f.read()
             
-        # Проверяем конфигурацию голубики
-        if 'cropConfigs["blueberry"]' in content:
+        # Проверяем конфигурацию голубики (таблица культур во flash)
+        if '{CropId::BLUEBERRY, "blueberry", CropConfig(' in table:
             print("✅ Конфигурация голубики найдена в CropEngine")
         else:
             print("❌ Конфигурация голубики НЕ найдена в CropEngine")
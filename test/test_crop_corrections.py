@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+Тест таблиц коррекций культур (include/business/crop_corrections.h)
+Зеркало прежних цепочек сравнений String ("greenhouse", "sand", "spring", ...)
+на Python; собранные g++ таблицы множителей дают те же значения для каждой
+культуры, среды, почвы и сезона, неизвестные названия не меняют значений;
+движок больше не сравнивает строки в коррекциях и не строит String из soilProfile
+"""
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+FIELDS = ["temperature", "humidity", "ec", "ph", "nitrogen", "phosphorus", "potassium"]
+ENVIRONMENTS = ["outdoor", "greenhouse", "indoor", "hydroponics", "aeroponics", "organic"]
+SOILS = ["sand", "loam", "peat", "clay", "sand_peat", "silt", "clay_loam", "organic", "sandy_loam", "silty_loam",
+         "loamy_clay", "saline", "alkaline"]
+SEASONS = ["spring", "summer", "autumn", "winter", "none"]
+
+# Коэффициенты прежних applyGrowingTypeCorrection/applySoilTypeCorrection/applySeasonalCorrection
+GROWING = {
+    "greenhouse": {"temperature": 1.05, "humidity": 1.05, "ec": 1.10, "nitrogen": 1.15, "phosphorus": 1.15,
+                   "potassium": 1.15},
+    "hydroponics": {"temperature": 1.03, "humidity": 1.02, "ec": 1.20, "nitrogen": 1.25, "phosphorus": 1.25,
+                    "potassium": 1.25},
+    "aeroponics": {"temperature": 1.04, "humidity": 1.03, "ec": 1.18, "nitrogen": 1.20, "phosphorus": 1.20,
+                   "potassium": 1.20},
+    "organic": {"temperature": 0.99, "humidity": 1.02, "ec": 0.90, "nitrogen": 0.90, "phosphorus": 0.90,
+                "potassium": 0.90},
+    "indoor": {"temperature": 1.02, "humidity": 1.03, "ec": 1.05, "nitrogen": 1.08, "phosphorus": 1.08,
+               "potassium": 1.08},
+}
+SOIL = {
+    "sand": {"nitrogen": 1.05, "phosphorus": 1.03, "potassium": 1.04, "humidity": 0.95, "ph": 1.02, "ec": 0.98},
+    "clay": {"nitrogen": 0.97, "phosphorus": 0.95, "potassium": 0.98, "humidity": 1.05, "ph": 0.99, "ec": 1.03},
+    "peat": {"nitrogen": 1.05, "phosphorus": 1.03, "potassium": 1.01, "humidity": 1.06, "ph": 0.95, "ec": 0.98},
+    "organic": {"nitrogen": 1.06, "phosphorus": 1.04, "potassium": 1.03, "humidity": 1.05, "ph": 0.96, "ec": 0.98},
+}
+SEASON = {
+    "spring": {"nitrogen": 1.15, "phosphorus": 1.10, "potassium": 1.12},
+    "summer": {"nitrogen": 1.05, "phosphorus": 1.03, "potassium": 1.08},
+    "autumn": {"nitrogen": 0.95, "phosphorus": 0.97, "potassium": 0.92},
+    "winter": {"nitrogen": 0.90, "phosphorus": 0.95, "potassium": 0.85},
+}
+
+DRIVER = r"""
+#include <cstdio>
+#include "business/crop_corrections.h"
+#include "business/crop_table.h"
+
+int main()
+{
+    for (const auto& crop : CROP_TABLE)
+    {
+        for (const char* environment : ENVIRONMENT_TYPE_NAMES)
+        {
+            for (uint8_t profile = 0; profile < SOIL_TYPE_COUNT + 1; ++profile)
+            {
+                for (const char* season : {"spring", "summer", "autumn", "winter", "none"})
+                {
+                    const SoilType soil = soilTypeFromProfile(profile);
+                    const CropConfig value = applyCropCorrections(crop.config, environmentTypeFromName(environment), soil,
+                                                                  seasonMultipliersFromName(season));
+                    printf("%s %s %s %s %.6g %.6g %.6g %.6g %.6g %.6g %.6g\n", crop.name, environment,
+                           profile < SOIL_TYPE_COUNT ? soilTypeName(soil) : "out_of_range", season, value.temperature,
+                           value.humidity, value.ec, value.ph, value.nitrogen, value.phosphorus, value.potassium);
+                }
+            }
+        }
+    }
+    const bool unknown = environmentTypeFromName("balcony") == EnvironmentType::OUTDOOR &&
+                         environmentTypeFromName(nullptr) == EnvironmentType::OUTDOOR &&
+                         &seasonMultipliersFromName("Spring") == &NO_CORRECTION;
+    printf("unknown %d\n", unknown ? 1 : 0);
+    return 0;
+}
+"""
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def crop_table():
+    header = read("include", "business", "crop_table.h")
+    shared = {name: [float(v) for v in re.findall(r"([\d.]+)F", values)]
+              for name, values in re.findall(r"constexpr CropConfig (\w+)\(([^)]*)\);", header)}
+    return {name: shared.get(values.strip()) or [float(v) for v in re.findall(r"([\d.]+)F", values)]
+            for name, values in re.findall(r'\{CropId::\w+, "(\w+)", ([^}]*)\}', header)}
+
+
+def mirror(values, environment, soil, season):
+    """Прежняя последовательность: тип выращивания, почва, сезон"""
+    result = dict(zip(FIELDS, values))
+    for table, key in ((GROWING, environment), (SOIL, soil), (SEASON, season)):
+        for field, multiplier in table.get(key, {}).items():
+            result[field] *= multiplier
+    return [result[field] for field in FIELDS]
+
+
+def test_mirror_matches_native_tables():
+    """Таблицы множителей повторяют прежние цепочки для всех сочетаний"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка таблиц пропущена")
+        return
+    table = crop_table()
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(DRIVER)
+        program = os.path.join(output_dir, "corrections_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/web_bench/shim", "-Iinclude",
+                                 "-Isrc", driver, "-o", program], cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=30)
+        assert result.returncode == 0, result.stderr
+
+    lines = result.stdout.splitlines()
+    assert lines[-1] == "unknown 1"
+    rows = [line.split() for line in lines[:-1]]
+    assert len(rows) == len(table) * len(ENVIRONMENTS) * (len(SOILS) + 1) * len(SEASONS)
+    for crop, environment, soil, season, *values in rows:
+        # soilProfile вне диапазона - суглинок, как прежний default в switch
+        expected = mirror(table[crop], environment, "loam" if soil == "out_of_range" else soil, season)
+        for field, got, want in zip(FIELDS, values, expected):
+            assert abs(float(got) - want) <= 1e-4 * max(1.0, abs(want)), f"{crop}/{environment}/{soil}/{season}/{field}"
+
+
+def test_tables_follow_enums():
+    """Размеры и порядок таблиц совпадают с перечислениями sensor_types.h"""
+    types = read("include", "sensor_types.h")
+    corrections = read("include", "business", "crop_corrections.h")
+
+    def enum_values(name):
+        block = re.search(rf"enum class {name} : uint8_t\s*\{{(.*?)\}};", types, re.S).group(1)
+        return re.findall(r"^\s*(\w+) = \d+", block, re.M)
+
+    assert [v.lower() for v in enum_values("EnvironmentType")] == ENVIRONMENTS
+    # SANDPEAT в API называется "sand_peat", как в прежнем switch
+    assert [v.lower() for v in enum_values("SoilType")] == [s if s != "sand_peat" else "sandpeat" for s in SOILS]
+    assert [v.lower() for v in enum_values("Season")] == SEASONS[:-1]
+    names = re.search(r"SOIL_TYPE_NAMES = \{\s*\{(.*?)\}\};", corrections, re.S).group(1)
+    assert re.findall(r'"(\w+)"', names) == SOILS
+
+    # Тип среды в настройках (0-5) - те же значения
+    routes_main = read("src", "web", "routes_main.cpp")
+    assert "envType >= 0 && envType <= 5" in routes_main
+
+
+def test_engine_has_no_string_chains():
+    """Коррекции движка - таблицы множителей, без сравнений String и switch по soilProfile"""
+    engine = read("src", "business", "crop_recommendation_engine.cpp")
+    header = read("src", "business", "crop_recommendation_engine.h")
+    for name in ("applyGrowingTypeCorrection", "applySoilTypeCorrection"):
+        assert name not in engine and name not in header
+    assert "CropConfig applySeasonalCorrection(const CropConfig&" not in header
+    assert 'growingType == "' not in engine and 'season == "' not in engine
+    assert "switch (config.soilProfile)" not in engine
+    assert "soilTypeFromProfile(config.soilProfile)" in engine
+    assert "seasonMultipliers(season)" in engine and "case Season::SPRING" not in engine
+
+
+def main():
+    print("🧪 Тестирование таблиц коррекций культур")
+    print("=" * 60)
+
+    tests = [
+        test_mirror_matches_native_tables,
+        test_tables_follow_enums,
+        test_engine_has_no_string_chains,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,278 @@
+#!/usr/bin/env python3
+"""
+Тест ранжирования культур по показанию (src/business/crop_ranking.cpp)
+Собирает ранжирование и кэш целей g++: отклонения и оценки всех культур совпадают
+с расчётом через деление на итоговую цель, порядок - по возрастанию оценки;
+показание, равное цели культуры, ставит её первой; пакетное ранжирование
+(на хосте - в потоках) совпадает с поштучным; NaN-оценки идут последними;
+пакетное ранжирование доступно на хосте через web_bench --rank-csv; /api/v2/crops/rank подключён
+"""
+
+import math
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+DRIVER = r"""
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "business/crop_ranking.h"
+#include "jxct_config_vars.h"
+
+Config config;
+
+namespace
+{
+CropReading readReading()
+{
+    CropReading reading;
+    for (const auto channel : CROP_CHANNELS)
+    {
+        if (scanf("%f", &(reading.*channel)) != 1)
+        {
+            reading.*channel = 0.0F;
+        }
+    }
+    return reading;
+}
+
+void printRanking(const CropRanking& ranking)
+{
+    for (const CropFit& fit : ranking)
+    {
+        printf("%u %.6g", static_cast<unsigned>(fit.crop), fit.score);
+        for (const float value : fit.deviation)
+        {
+            printf(" %.6g", value);
+        }
+        printf("\n");
+    }
+}
+}  // namespace
+
+int main()
+{
+    config.soilProfile = 2;      // PEAT
+    config.environmentType = 1;  // GREENHOUSE
+    config.flags.seasonalAdjustEnabled = 1;
+    const CropTargets& targets = getCropTargets(Season::SUMMER, true);
+    for (const CropConfig& target : targets.corrected)
+    {
+        for (const auto channel : CROP_CHANNELS)
+        {
+            printf("%.9g ", target.*channel);
+        }
+        printf("\n");
+    }
+
+    // Показание из stdin
+    CropRanking ranking;
+    rankCrops(targets, readReading(), ranking);
+    printRanking(ranking);
+
+    // Показание ровно на цели черники - она первая
+    rankCrops(targets, targets[CropId::BLUEBERRY], ranking);
+    printf("exact %u %.6g\n", static_cast<unsigned>(ranking[0].crop), ranking[0].score);
+
+    // Серия показаний: пакетом и по одному
+    std::vector<CropReading> readings;
+    for (unsigned i = 0; i < 5000; ++i)
+    {
+        readings.emplace_back(15.0F + i % 17, 40.0F + i % 43, 500.0F + 7 * (i % 300), 5.0F + (i % 30) * 0.1F,
+                              50.0F + i % 250, 20.0F + i % 90, 80.0F + i % 310);
+    }
+    std::vector<CropRanking> batch(readings.size());
+    rankCropsBatch(targets, readings.data(), readings.size(), batch.data());
+    bool same = true;
+    for (size_t i = 0; i < readings.size(); ++i)
+    {
+        rankCrops(targets, readings[i], ranking);
+        // Поля, а не memcmp: байты выравнивания CropFit не определены
+        for (size_t crop = 0; crop < ranking.size(); ++crop)
+        {
+            same = same && ranking[crop].crop == batch[i][crop].crop &&
+                   memcmp(&ranking[crop].score, &batch[i][crop].score, sizeof(float)) == 0 &&
+                   memcmp(ranking[crop].deviation.data(), batch[i][crop].deviation.data(),
+                          sizeof(ranking[crop].deviation)) == 0;
+        }
+    }
+    printf("batch %d\n", same ? 1 : 0);
+    rankCropsBatch(targets, readings.data(), 0, batch.data());
+
+    // Испорченные цели двух культур дают NaN-оценки - они в конце, остальные по возрастанию
+    CropTargets broken = targets;
+    broken.inverse[0][3] = NAN;
+    broken.inverse[2][7] = NAN;
+    rankCrops(broken, targets[CropId::BLUEBERRY], ranking);
+    printf("nan");
+    for (const CropFit& fit : ranking)
+    {
+        printf(" %u", static_cast<unsigned>(fit.crop));
+    }
+    printf("\n");
+
+    // Показание NaN: все оценки NaN - порядок по CropId
+    rankCrops(targets, CropReading(NAN, 60.0F, 1500.0F, 6.5F, 150.0F, 60.0F, 200.0F), ranking);
+    printf("nanreading");
+    for (const CropFit& fit : ranking)
+    {
+        printf(" %u", static_cast<unsigned>(fit.crop));
+    }
+    printf("\n");
+    return 0;
+}
+"""
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def run_driver(reading):
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(DRIVER)
+        program = os.path.join(output_dir, "ranking_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O2", "-pthread", "-DARDUINO=10819", "-Itest/web_bench/shim",
+                                 "-Iinclude", "-Isrc", driver, "src/business/crop_ranking.cpp",
+                                 "src/business/crop_target_cache.cpp", "-o", program],
+                                cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], input=" ".join(map(str, reading)), capture_output=True, text=True,
+                                timeout=60)
+        assert result.returncode == 0, result.stderr
+    return result.stdout.splitlines()
+
+
+def test_ranking_matches_reference():
+    """Отклонения и оценки - через деление на цель; порядок по оценке"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка ранжирования пропущена")
+        return
+    reading = [23.5, 71.0, 1650.0, 6.1, 142.0, 58.0, 215.0]
+    lines = run_driver(reading)
+    crop_count = next(i for i, line in enumerate(lines) if len(line.split()) == 9)
+    targets = [[float(value) for value in line.split()] for line in lines[:crop_count]]
+    ranking = [line.split() for line in lines[crop_count:2 * crop_count]]
+
+    assert sorted(int(row[0]) for row in ranking) == list(range(crop_count))
+    scores = [float(row[1]) for row in ranking]
+    assert scores == sorted(scores)
+    for row in ranking:
+        target = targets[int(row[0])]
+        expected = [(value - goal) / goal * 100.0 for value, goal in zip(reading, target)]
+        deviation = [float(value) for value in row[2:]]
+        assert all(math.isclose(a, b, rel_tol=1e-4, abs_tol=1e-3) for a, b in zip(deviation, expected)), row
+        assert math.isclose(float(row[1]), sum(map(abs, expected)) / 7, rel_tol=1e-4, abs_tol=1e-3), row
+
+    # Независимый порядок по эталонным оценкам (без почти равных соседей)
+    reference = sorted(range(crop_count), key=lambda crop: sum(abs((value - goal) / goal) for value, goal in
+                                                               zip(reading, targets[crop])))
+    assert [int(row[0]) for row in ranking][:5] == reference[:5]
+
+
+def test_exact_and_batch():
+    """Показание на цели - оценка 0; пакет (потоки на хосте) совпадает с поштучным"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка ранжирования пропущена")
+        return
+    rng = random.Random(45)
+    lines = run_driver([round(rng.uniform(10, 200), 1) for _ in range(7)])
+    checks = {line.split()[0]: line.split()[1:] for line in lines if line.startswith(("exact", "batch"))}
+    assert checks["exact"][0] == "5", checks  # CropId::BLUEBERRY
+    assert abs(float(checks["exact"][1])) < 1e-3, checks
+    assert checks["batch"] == ["1"], checks
+
+
+def test_nan_scores_sorted_last():
+    """NaN-оценки явно последними, между собой - по CropId"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка ранжирования пропущена")
+        return
+    lines = run_driver([23.5, 71.0, 1650.0, 6.1, 142.0, 58.0, 215.0])
+    orders = {line.split()[0]: [int(value) for value in line.split()[1:]] for line in lines
+              if line.startswith("nan")}
+    broken = orders["nan"]
+    assert broken[0] == 5 and broken[-2:] == [3, 7], broken
+    assert sorted(broken) == list(range(len(broken)))
+    assert orders["nanreading"] == list(range(len(broken))), orders["nanreading"]
+
+
+def test_batch_has_host_entry_point():
+    """web_bench --rank-csv ранжирует исторические показания через rankCropsBatch"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка стенда пропущена")
+        return
+    bench = read("test", "web_bench", "web_bench_main.cpp")
+    assert "rankCropsBatch(targets, readings.data(), readings.size(), rankings.data());" in bench
+
+    from test_web_bench import build_bench  # noqa: E402 - соседний тест собирает стенд
+
+    with tempfile.TemporaryDirectory() as output_dir:
+        program = build_bench(output_dir)
+        history = os.path.join(output_dir, "history.csv")
+        with open(history, "w", encoding="utf-8") as handle:
+            handle.write("# t,asm,ec,ph,n,p,k\n22.0,60.0,1500,6.5,150,60,200\nbroken line\n"
+                         "18.0,70.0,1200,5.0,100,40,150\nnan,60,1500,6.5,150,60,200\n")
+        result = subprocess.run([program, "--rank-csv", history], capture_output=True, text=True, timeout=60)
+        assert result.returncode == 0, result.stdout + result.stderr
+    rows = [line.split(",") for line in result.stdout.splitlines()]
+    assert rows[0] == ["row", "crop", "score"] and len(rows) == 4, rows
+    assert all(row[1] for row in rows[1:]), rows
+    assert math.isfinite(float(rows[1][2])) and math.isfinite(float(rows[2][2])), rows
+    assert rows[3][2] == "nan", rows
+
+
+def test_ranking_is_wired():
+    """Маршрут /api/v2/crops/rank берёт цели из общего кэша; обратные цели - в кэше"""
+    routes = read("src", "web", "routes_data.cpp")
+    assert "webServer.on(API_V2_CROPS_RANK, HTTP_GET, sendCropRanking);" in routes
+    handler = routes[routes.index("void sendCropRanking()"):routes.index("const String& getCachedSensorJson()")]
+    assert "getCropTargets(season, seasonKnown)" in handler
+    assert "rankCrops(targets, reading, ranking);" in handler
+    assert "sendNotModifiedIfMatch" in handler
+
+    assert "cropTargets.inverse[channel][index] = 1.0F /" in read("src", "business", "crop_target_cache.cpp")
+    ranking = read("src", "business", "crop_ranking.cpp")
+    assert "/" not in ranking[ranking.index("void scoreChannels"):ranking.index("void rankRange")].replace("//", "")
+    assert "#ifndef ESP_PLATFORM" in ranking
+    assert "business/crop_ranking.cpp" in read("platformio.ini")
+
+
+def main():
+    print("🧪 Тестирование ранжирования культур")
+    print("=" * 60)
+
+    tests = [
+        test_ranking_matches_reference,
+        test_exact_and_batch,
+        test_nan_scores_sorted_last,
+        test_batch_has_host_entry_point,
+        test_ranking_is_wired,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
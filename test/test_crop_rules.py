@@ -0,0 +1,949 @@
+#!/usr/bin/env python3
+"""
+Тест правил специфических рекомендаций культур (include/business/crop_rules.h)
+Собирает g++ движок рекомендаций вместе с прежней цепочкой if/else по названиям
+культур (эталон) и сверяет текст для всех культур и почв на сетке N/P/K/pH вокруг
+каждого порога прежнего кода; прежние случаи (томат, пороги дефицита, типы почвы,
+местные названия) дают прежний текст; движок больше не сравнивает названия культур String
+"""
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+SOILS = ["SAND", "LOAM", "PEAT", "CLAY", "SANDPEAT", "SILT", "CLAY_LOAM", "ORGANIC", "SANDY_LOAM", "SILTY_LOAM",
+         "LOAMY_CLAY", "SALINE", "ALKALINE"]
+CHANNELS = {"n": 0, "p": 1, "k": 2, "ph": 3}
+
+DRIVER = r"""
+#include <cstdio>
+#include "business/crop_rules.h"
+
+int main()
+{
+    unsigned crop = 0, soil = 0;
+    float n = 0, p = 0, k = 0, ph = 0;
+    while (scanf("%u %u %f %f %f %f", &crop, &soil, &n, &p, &k, &ph) == 6)
+    {
+        const CropRules::MessageList messages =
+            CropRules::evaluate(static_cast<CropId>(crop), static_cast<SoilType>(soil), NPKReferences(n, p, k), ph);
+        for (const CropRules::MessageId id : messages)
+        {
+            printf("%u ", static_cast<unsigned>(id));
+        }
+        printf("\n");
+    }
+    // Местные названия и неизвестная культура
+    printf("alias %d\n", CropRules::cropIdFromAnyName("томат") == CropId::TOMATO &&
+                             CropRules::cropIdFromAnyName("морковь") == CropId::CARROT &&
+                             CropRules::cropIdFromAnyName("carrot") == CropId::CARROT &&
+                             CropRules::cropIdFromAnyName("cactus") == CropId::GENERIC &&
+                             CropRules::cropIdFromAnyName(nullptr) == CropId::GENERIC);
+    for (const CropRules::MessageText& message : CropRules::MESSAGE_TEXTS)
+    {
+        printf("text %s\n", message.text);
+    }
+    return 0;
+}
+"""
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+# Прежняя generateCropSpecificRecommendations() до таблицы правил - эталон (без неиспользуемого сезона)
+LEGACY_CHAIN = r"""
+String legacyCropSpecificRecommendations(const String& cropName, const NPKReferences& npk, SoilType soilType,
+                                         float pH)
+{
+    String recommendations = "";
+
+    // Используем стандартные пороги дефицита (без сезонных корректировок)
+    // Согласно логике: "сырые значения потом коррекция, затем научная компенсация и на этом все"
+    float nitrogenThreshold = 100.0F;
+    float phosphorusThreshold = 50.0F;
+    float potassiumThreshold = 150.0F;
+
+    // Определяем общие дефициты на основе стандартных порогов
+    bool nitrogenDeficient = npk.nitrogen < nitrogenThreshold;
+    bool phosphorusDeficient = npk.phosphorus < phosphorusThreshold;
+    bool potassiumDeficient = npk.potassium < potassiumThreshold;
+
+    // 🔍 СПЕЦИФИЧЕСКИЕ ТРЕБОВАНИЯ КУЛЬТУР К ДОПОЛНИТЕЛЬНЫМ ЭЛЕМЕНТАМ
+
+    if (cropName == "tomato" || cropName == "томат") {
+        // Томаты требуют много кальция для предотвращения вершинной гнили
+        if (pH < 6.5F) {  // Расширили диапазон с 6.0 до 6.5
+            recommendations += "🍅 Томаты → кальций Ca(NO3)2\n";
+        }
+
+        // УДАЛЕНО: дублирует антагонизм K→Mg из nutrient_interactions
+
+        // Общие рекомендации для томатов
+        if (npk.nitrogen > 150.0F && npk.phosphorus < 100.0F) {
+            recommendations += "🍅 Томаты → баланс N/P\n";
+        }
+
+        // Томаты нуждаются в боре для качества плодов
+        if (pH > 7.0F || npk.potassium > 300.0F) {
+            recommendations += "🍅 Томаты → бор H3BO3\n";
+        }
+    }
+
+    else if (cropName == "cucumber" || cropName == "огурец") {
+        // Огурцы требуют много калия для качества плодов
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 200.0F) {
+            recommendations += "🥒 Огурцы требуют калий для качества плодов. ";
+            recommendations += "Рекомендуется: внести калийную селитру (KNO3) или сульфат калия (K2SO4)\n";
+        }
+
+        // Огурцы чувствительны к дефициту бора для завязывания плодов
+        if (pH > 7.5F) {  // Стандартный порог для доступности бора¹
+            recommendations += "🥒 Огурцы требуют бор для завязывания плодов. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
+        }
+
+        // УДАЛЕНО: дублирует антагонизм K→Mg из nutrient_interactions
+
+        // Огурцы требуют кальций для качества плодов
+        if (pH < 6.0F || npk.potassium > 250.0F) {
+            recommendations += "🥒 Огурцы требуют кальций для качества плодов. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
+        }
+
+        // Огурцы нуждаются в магнии для фотосинтеза
+        if (npk.potassium > 300.0F || pH > 7.0F) {
+            recommendations += "🥒 Огурцы требуют магний для фотосинтеза. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
+        }
+    }
+
+    else if (cropName == "pepper" || cropName == "перец") {
+        // Перец требует цинк при высоком фосфоре (антагонизм P→Zn)
+        if (npk.phosphorus > 100.0F) {  // Консервативный порог для антагонизма P→Zn (исследования показывают 100 мг/кг)
+            recommendations += "🌶️ Перец требует цинк при высоком фосфоре. ";
+            recommendations += "Рекомендуется: внести хелат цинка (Zn-EDTA) или сульфат цинка (ZnSO4)\n";
+        }
+
+        // Перец чувствителен к дефициту кальция (вершинная гниль)
+        if (pH < 6.5F) {  // Расширен с 6.0 до 6.5
+            recommendations += "🌶️ Перец требует кальций против вершинной гнили. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
+        }
+
+        // Перец нуждается в боре для завязывания плодов
+        if (pH > 7.0F || npk.potassium > 300.0F) {
+            recommendations += "🌶️ Перец требует бор для завязывания плодов. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
+        }
+
+        // Перец требует калий для качества плодов
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 180.0F) {
+            recommendations += "🌶️ Перец требует калий для качества и остроты плодов. ";
+            recommendations += "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)\n";
+        }
+
+        // Перец нуждается в магнии для фотосинтеза
+        if (npk.potassium > 350.0F || pH > 7.0F) {
+            recommendations += "🌶️ Перец требует магний для фотосинтеза. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
+        }
+    }
+
+    else if (cropName == "lettuce" || cropName == "салат") {
+        // Салат требует серу для синтеза белка при высоком азоте
+        if (npk.nitrogen > 250.0F) {
+            recommendations += "🥬 Салат требует серу для синтеза белка. ";
+            recommendations += "Рекомендуется: внести сульфат аммония ((NH4)2SO4) или элементарную серу (S)\n";
+        }
+
+        // Салат чувствителен к дефициту железа при высоком pH (хлороз)
+        if (pH > 7.0F) {
+            recommendations += "🥬 Салат требует железо для предотвращения хлороза. ";
+            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)\n";
+        }
+
+        // Салат требует много азота для быстрого роста листьев
+        // Проверяем только если общий дефицит азота не был уже определен
+        if (!nitrogenDeficient && npk.nitrogen < 150.0F) {
+            recommendations += "🥬 Салат требует много азота для интенсивного роста листьев. ";
+            recommendations += "Рекомендуется: внести аммиачную селитру (NH4NO3) или мочевину (CO(NH2)2)\n";
+        }
+
+        // Салат нуждается в кальции для качества листьев
+        if (pH < 6.0F || npk.potassium > 200.0F) {
+            recommendations += "🥬 Салат требует кальций для качества листьев. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
+        }
+    }
+
+    else if (cropName == "blueberry" || cropName == "черника") {
+        // Черника требует кислую почву (pH 4.0-5.5) для усвоения железа
+        if (pH > 5.5F) {
+            recommendations += "🫐 Черника требует кислую почву для усвоения железа. ";
+            recommendations += "Рекомендуется: внести элементарную серу (S) или сульфат аммония ((NH4)2SO4)\n";
+        }
+
+        // Черника чувствительна к дефициту железа при высоком pH (хлороз)
+        if (pH > 5.0F) {
+            recommendations += "🫐 Черника требует железо для предотвращения хлороза. ";
+            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)\n";
+        }
+
+        // Черника нуждается в марганце в кислой почве для фотосинтеза
+        if (pH < 5.5F && npk.nitrogen > 100.0F) {
+            recommendations += "🫐 Черника требует марганец для фотосинтеза. ";
+            recommendations += "Рекомендуется: внести сульфат марганца (MnSO4) или хелат марганца (Mn-EDTA)\n";
+        }
+
+        // Черника требует аммонийный азот вместо нитратного
+        // Проверяем только если общий дефицит азота не был уже определен
+        if (!nitrogenDeficient && npk.nitrogen < 80.0F && pH < 5.5F) {
+            recommendations += "🫐 Черника предпочитает аммонийный азот. ";
+            recommendations += "Рекомендуется: внести сульфат аммония ((NH4)2SO4) вместо нитратов\n";
+        }
+    }
+
+    else if (cropName == "strawberry" || cropName == "клубника") {
+        // Клубника требует кальций для качества ягод (против гнили)
+        if (pH < 6.0F) {
+            recommendations += "🍓 Клубника требует кальций для качества ягод. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
+        }
+
+        // Клубника нуждается в боре для опыления и развития плодов
+        if (pH > 6.5F || npk.potassium > 200.0F) {
+            recommendations += "🍓 Клубника требует бор для опыления и развития плодов. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
+        }
+
+        // Клубника чувствительна к дефициту цинка при высоком фосфоре
+        if (npk.phosphorus > 80.0F) {
+            recommendations += "🍓 Клубника требует цинк для синтеза ауксинов. ";
+            recommendations += "Рекомендуется: внести хелат цинка (Zn-EDTA) или сульфат цинка (ZnSO4)\n";
+        }
+
+        // Клубника требует калий для качества ягод
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 150.0F) {
+            recommendations += "🍓 Клубника требует калий для качества и сладости ягод. ";
+            recommendations += "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)\n";
+        }
+    }
+
+    else if (cropName == "apple" || cropName == "яблоня") {
+        // Яблоня требует кальций против горькой ямчатости плодов
+        if (pH < 6.5F || npk.potassium > 250.0F) {
+            recommendations += "🍎 Яблоня требует кальций против горькой ямчатости плодов. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
+        }
+
+        // Яблоня нуждается в боре для развития плодов и опыления
+        if (pH > 7.0F) {
+            recommendations += "🍎 Яблоня требует бор для развития плодов и опыления. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
+        }
+
+        // Яблоня чувствительна к дефициту цинка (розеточность листьев)
+        if (pH > 7.0F || npk.phosphorus > 60.0F) {
+            recommendations += "🍎 Яблоня требует цинк для предотвращения розеточности листьев. ";
+            recommendations += "Рекомендуется: внести сульфат цинка (ZnSO4) или хелат цинка (Zn-EDTA)\n";
+        }
+
+        // Яблоня требует калий для качества плодов
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 180.0F) {
+            recommendations += "🍎 Яблоня требует калий для качества и лежкости плодов. ";
+            recommendations += "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)\n";
+        }
+
+        // Яблоня нуждается в магнии для фотосинтеза
+        if (npk.potassium > 300.0F || pH > 7.0F) {
+            recommendations += "🍎 Яблоня требует магний для фотосинтеза. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
+        }
+    }
+
+    else if (cropName == "grape" || cropName == "виноград") {
+        // Виноград требует калий для качества ягод и сахаристости
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 200.0F) {
+            recommendations += "🍇 Виноград требует калий для качества ягод и сахаристости. ";
+            recommendations += "Рекомендуется: внести сульфат калия (K2SO4) или хлористый калий (KCl)\n";
+        }
+
+        // УДАЛЕНО: дублирует антагонизм K→Mg из nutrient_interactions
+
+        // Виноград чувствителен к дефициту бора для опыления
+        if (pH > 7.0F) {
+            recommendations += "🍇 Виноград требует бор для опыления и развития ягод. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3) или борат натрия (Na2B4O7)\n";
+        }
+
+        // Виноград требует кальций для качества ягод
+        if (pH < 6.0F || npk.potassium > 250.0F) {
+            recommendations += "🍇 Виноград требует кальций для качества ягод. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или хлорид кальция (CaCl2)\n";
+        }
+
+        // Виноград нуждается в магнии для фотосинтеза
+        if (npk.potassium > 300.0F || pH > 7.0F) {
+            recommendations += "🍇 Виноград требует магний для фотосинтеза. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
+        }
+    }
+
+    else if (cropName == "spinach" || cropName == "шпинат") {
+        // Шпинат требует много железа для предотвращения хлороза
+        if (pH > 7.0F || npk.nitrogen < 200.0F) {
+            recommendations += "🥬 Шпинат требует железо для предотвращения хлороза. ";
+            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
+        }
+
+        // Шпинат чувствителен к дефициту магния при высоком калии
+        if (npk.potassium > 400.0F) {
+            recommendations += "🥬 Высокий калий может блокировать магний у шпината. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
+        }
+
+        // Шпинат требует много азота для быстрого роста
+        // Проверяем только если общий дефицит азота не был уже определен
+        if (!nitrogenDeficient && npk.nitrogen < 200.0F) {
+            recommendations += "🥬 Шпинат требует много азота для интенсивного роста листьев. ";
+            recommendations += "Рекомендуется: внести азотные удобрения (NH4NO3)\n";
+        }
+    }
+
+    else if (cropName == "basil" || cropName == "базилик") {
+        // Базилик требует калий для развития эфирных масел
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 200.0F) {
+            recommendations += "🌿 Базилик требует калий для синтеза эфирных масел. ";
+            recommendations += "Рекомендуется: внести калийную селитру (KNO3)\n";
+        }
+
+        // Базилик чувствителен к дефициту магния
+        if (npk.potassium > 300.0F || pH > 6.5F) {
+            recommendations += "🌿 Базилик требует магний для фотосинтеза. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
+        }
+
+        // Базилик нуждается в боре для качества листьев
+        if (pH > 6.5F) {
+            recommendations += "🌿 Базилик требует бор для предотвращения деформации листьев. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
+        }
+    }
+
+    else if (cropName == "cannabis" || cropName == "конопля") {
+        // Конопля требует много азота в вегетативной фазе
+        // Проверяем только если общий дефицит азота не был уже определен
+        if (!nitrogenDeficient && npk.nitrogen < 160.0F) {
+            recommendations += "🌿 Конопля требует много азота для роста листьев. ";
+            recommendations += "Рекомендуется: внести азотные удобрения (NH4NO3)\n";
+        }
+
+        // Конопля нуждается в фосфоре для цветения
+        // Проверяем только если общий дефицит фосфора не был уже определен
+        if (!phosphorusDeficient && npk.phosphorus < 40.0F) {
+            recommendations += "🌿 Конопля требует фосфор для развития соцветий. ";
+            recommendations += "Рекомендуется: внести фосфорные удобрения (H3PO4)\n";
+        }
+
+        // Конопля требует калий для качества продукции
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 200.0F) {
+            recommendations += "🌿 Конопля требует калий для синтеза активных веществ. ";
+            recommendations += "Рекомендуется: внести калийную селитру (KNO3)\n";
+        }
+
+        // Конопля чувствительна к дефициту кальция
+        if (pH < 6.0F) {
+            recommendations += "🌿 Конопля требует кальций для структуры клеток. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
+        }
+
+        // Конопля нуждается в магнии при высоком калии
+        if (npk.potassium > 300.0F) {
+            recommendations += "🌿 Высокий калий может блокировать магний у конопли. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
+        }
+    }
+
+    else if (cropName == "wheat" || cropName == "пшеница") {
+        // Пшеница требует много азота для формирования белка
+        // Проверяем только если общий дефицит азота не был уже определен
+        if (!nitrogenDeficient && npk.nitrogen < 200.0F) {
+            recommendations += "🌾 Пшеница → азот NH4NO3\n";
+        }
+
+        // Пшеница нуждается в фосфоре для развития корневой системы
+        // Проверяем только если общий дефицит фосфора не был уже определен
+        if (!phosphorusDeficient && npk.phosphorus < 50.0F) {
+            recommendations += "🌾 Пшеница → фосфор\n";
+        }
+
+        // Пшеница чувствительна к дефициту серы
+        if (npk.nitrogen > 250.0F && pH > 7.0F) {
+            recommendations += "🌾 Пшеница → сера (NH4)2SO4\n";
+        }
+
+        // Пшеница нуждается в калии для устойчивости к болезням
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 150.0F) {
+            recommendations += "🌾 Пшеница → калий KCl\n";
+        }
+    }
+
+    else if (cropName == "potato" || cropName == "картофель") {
+        // Картофель требует много калия для качества клубней
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 250.0F) {
+            recommendations += "🥔 Картофель требует калий для качества клубней. ";
+            recommendations += "Рекомендуется: внести калийную селитру (KNO3)\n";
+        }
+
+        // Картофель чувствителен к дефициту магния
+        if (npk.potassium > 400.0F || pH < 6.0F) {
+            recommendations += "🥔 Картофель требует магний для фотосинтеза. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
+        }
+
+        // Картофель нуждается в кальции для предотвращения пятнистости
+        if (pH < 5.8F) {
+            recommendations += "🥔 Картофель требует кальций для качества клубней. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
+        }
+
+        // Картофель требует сбалансированное питание NPK
+        if (npk.nitrogen > 200.0F && npk.phosphorus < 50.0F) {
+            recommendations += "🥔 Картофель нуждается в сбалансированном питании. ";
+            recommendations += "Рекомендуется: увеличить фосфор для развития клубней\n";
+        }
+
+        // Картофель чувствителен к избытку азота
+        if (npk.nitrogen > 250.0F) {
+            recommendations += "🥔 Избыток азота снижает качество клубней картофеля. ";
+            recommendations += "Рекомендуется: сократить азотные подкормки\n";
+        }
+    }
+
+    else if (cropName == "kale" || cropName == "кале") {
+        // Кале требует кальций для предотвращения краевого ожога
+        if (pH < 6.0F) {
+            recommendations += "🥬 Кале требует кальций для качества листьев. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
+        }
+
+        // Кале чувствительна к дефициту серы (семейство крестоцветных)
+        if (npk.nitrogen > 200.0F && pH > 6.5F) {
+            recommendations += "🥬 Кале требует серу для синтеза глюкозинолатов. ";
+            recommendations += "Рекомендуется: внести сульфат аммония ((NH4)2SO4)\n";
+        }
+
+        // Кале нуждается в боре для предотвращения полых стеблей
+        if (pH > 7.0F || npk.potassium > 350.0F) {
+            recommendations += "🥬 Кале требует бор для структуры стеблей. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
+        }
+    }
+
+    else if (cropName == "raspberry" || cropName == "малина") {
+        // Малина требует железо для предотвращения хлороза
+        if (pH > 6.5F) {
+            recommendations += "🍇 Малина требует железо для зеленой окраски листьев. ";
+            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
+        }
+
+        // Малина чувствительна к дефициту марганца
+        if (pH < 5.5F && npk.nitrogen > 150.0F) {
+            recommendations += "🍇 Малина требует марганец для фотосинтеза. ";
+            recommendations += "Рекомендуется: внести сульфат марганца (MnSO4)\n";
+        }
+
+        // Малина нуждается в цинке для роста побегов
+        if (npk.phosphorus > 70.0F) {
+            recommendations += "🍇 Высокий фосфор может блокировать цинк у малины. ";
+            recommendations += "Рекомендуется: внести хелатный цинк (Zn-EDTA)\n";
+        }
+    }
+
+    else if (cropName == "blackberry" || cropName == "ежевика") {
+        // Ежевика требует железо (похоже на малину, но более устойчива)
+        if (pH > 7.0F) {
+            recommendations += "🫐 Ежевика требует железо при щелочной почве. ";
+            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
+        }
+
+        // Ежевика чувствительна к дефициту марганца
+        if (pH < 5.8F) {
+            recommendations += "🫐 Ежевика требует марганец для качества ягод. ";
+            recommendations += "Рекомендуется: внести сульфат марганца (MnSO4)\n";
+        }
+
+        // Ежевика нуждается в боре для завязывания плодов
+        if (pH > 6.8F || npk.potassium > 300.0F) {
+            recommendations += "🫐 Ежевика требует бор для формирования ягод. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
+        }
+    }
+
+    else if (cropName == "soybean" || cropName == "соя") {
+        // Соя требует фосфор для азотфиксации
+        // Проверяем только если общий дефицит фосфора не был уже определен
+        if (!phosphorusDeficient && npk.phosphorus < 40.0F) {
+            recommendations += "🌱 Соя требует фосфор для работы клубеньковых бактерий. ";
+            recommendations += "Рекомендуется: внести суперфосфат (Ca(H2PO4)2)\n";
+        }
+
+        // Соя нуждается в калии для налива бобов
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 200.0F) {
+            recommendations += "🌱 Соя требует калий для формирования бобов. ";
+            recommendations += "Рекомендуется: внести хлорид калия (KCl)\n";
+        }
+
+        // Соя требует молибден для азотфиксации
+        if (npk.nitrogen < 80.0F && pH < 6.0F) {
+            recommendations += "🌱 Соя требует молибден для фиксации азота. ";
+            recommendations += "Рекомендуется: внести молибдат аммония ((NH4)2MoO4)\n";
+        }
+
+        // Соя чувствительна к избытку азота (подавляет азотфиксацию)
+        if (npk.nitrogen > 120.0F) {
+            recommendations += "🌱 Избыток азота подавляет азотфиксацию у сои. ";
+            recommendations += "Рекомендуется: сократить азотные подкормки\n";
+        }
+    }
+
+    else if (cropName == "carrot" || cropName == "морковь") {
+        // Морковь требует бор для предотвращения растрескивания корней
+        if (pH > 7.0F || npk.potassium > 300.0F) {
+            recommendations += "🥕 Морковь требует бор для качества корнеплодов. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
+        }
+
+        // Морковь нуждается в кальции для предотвращения мягкой гнили
+        if (pH < 6.0F) {
+            recommendations += "🥕 Морковь требует кальций для устойчивости к болезням. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
+        }
+
+        // Морковь требует калий для качества и лежкости
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 200.0F) {
+            recommendations += "🥕 Морковь требует калий для сладости и лежкости. ";
+            recommendations += "Рекомендуется: внести калийную селитру (KNO3)\n";
+        }
+
+        // Морковь чувствительна к избытку азота (разветвление корней)
+        if (npk.nitrogen > 180.0F) {
+            recommendations += "🥕 Избыток азота вызывает разветвление корнеплодов моркови. ";
+            recommendations += "Рекомендуется: сократить азотные подкормки\n";
+        }
+    }
+
+    // 🌱 ДОБАВЛЯЕМ НЕДОСТАЮЩИЕ КУЛЬТУРЫ
+
+    else if (cropName == "lawn" || cropName == "газон") {
+        // Газон требует азот для роста листьев (N:P:K = 3:1:2 для газонов)
+        // Проверяем только если общий дефицит азота не был уже определен
+        // Используем стандартный порог без сезонных корректировок
+        if (!nitrogenDeficient && npk.nitrogen < 120.0F) {
+            recommendations += "🌱 Газон требует азот для активного роста листьев. ";
+            recommendations += "Рекомендуется: внести мочевину (CO(NH2)2) или аммиачную селитру (NH4NO3)\n";
+        }
+
+        // Газон нуждается в фосфоре для развития корневой системы
+        // Проверяем только если общий дефицит фосфора не был уже определен
+        if (!phosphorusDeficient && npk.phosphorus < 40.0F) {
+            recommendations += "🌱 Газон требует фосфор для развития корневой системы. ";
+            recommendations += "Рекомендуется: внести суперфосфат (Ca(H2PO4)2) или диаммофос (NH4H2PO4)\n";
+        }
+
+        // Газон требует калий для устойчивости к засухе и болезням
+        // Проверяем только если общий дефицит калия не был уже определен
+        if (!potassiumDeficient && npk.potassium < 80.0F) {
+            recommendations += "🌱 Газон требует калий для устойчивости к стрессам и болезням. ";
+            recommendations += "Рекомендуется: внести хлористый калий (KCl) или сульфат калия (K2SO4)\n";
+        }
+
+        // Газон чувствителен к дефициту железа при высоком pH (желтые пятна)
+        if (pH > 7.0F) {
+            recommendations += "🌱 Газон требует железо для предотвращения хлороза. ";
+            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA) или сульфат железа (FeSO4)\n";
+        }
+
+        // Газон нуждается в кальции для структуры почвы
+        if (pH < 6.0F) {
+            recommendations += "🌱 Газон требует кальций для улучшения структуры почвы. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2) или известь (CaCO3)\n";
+        }
+
+        // Газон чувствителен к дефициту магния при высоком калии
+        if (npk.potassium > 200.0F && pH > 6.5F) {
+            recommendations += "🌱 Высокий калий может блокировать магний у газона. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4) или доломитовую муку\n";
+        }
+
+        // Газон требует серу для синтеза белка (особенно при высоком азоте)
+        if (npk.nitrogen > 150.0F && pH > 7.0F) {
+            recommendations += "🌱 Газон требует серу для синтеза белка. ";
+            recommendations += "Рекомендуется: внести сульфат аммония ((NH4)2SO4) или элементарную серу\n";
+        }
+
+        // Газон нуждается в микроэлементах при интенсивном использовании
+        if (npk.nitrogen > 200.0F && npk.phosphorus > 60.0F) {
+            recommendations += "🌱 Газон требует микроэлементы при интенсивном питании. ";
+            recommendations += "Рекомендуется: внести комплексное микроудобрение (Zn, Mn, Cu, B)\n";
+        }
+    }
+
+    else if (cropName == "conifer" || cropName == "хвойные") {
+        // Хвойные требуют кислую почву
+        if (pH > 6.0F) {
+            recommendations += "🌲 Хвойные требуют кислую почву для нормального роста. ";
+            recommendations += "Рекомендуется: подкислить почву серой или торфом\n";
+        }
+
+        // Хвойные нуждаются в магнии для фотосинтеза
+        if (npk.potassium > 100.0F) {
+            recommendations += "🌲 Хвойные требуют магний для предотвращения пожелтения. ";
+            recommendations += "Рекомендуется: внести сульфат магния (MgSO4)\n";
+        }
+
+        // Хвойные чувствительны к избытку азота
+        if (npk.nitrogen > 100.0F) {
+            recommendations += "🌲 Избыток азота может повредить хвойные растения. ";
+            recommendations += "Рекомендуется: сократить азотные подкормки\n";
+        }
+    }
+
+    else if (cropName == "pear" || cropName == "груша") {
+        // Груша требует кальций против горькой ямчатости
+        if (pH < 6.5F || npk.potassium > 250.0F) {
+            recommendations += "🍐 Груша требует кальций для качества плодов. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
+        }
+
+        // Груша нуждается в боре для развития плодов
+        if (pH > 7.0F) {
+            recommendations += "🍐 Груша требует бор для формирования плодов. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
+        }
+
+        // Груша чувствительна к дефициту цинка
+        if (pH > 7.0F || npk.phosphorus > 60.0F) {
+            recommendations += "🍐 Груша требует цинк для нормального роста. ";
+            recommendations += "Рекомендуется: внести хелатный цинк (Zn-EDTA)\n";
+        }
+    }
+
+    else if (cropName == "cherry" || cropName == "вишня") {
+        // Вишня требует кальций для качества плодов
+        if (pH < 6.5F || npk.potassium > 250.0F) {
+            recommendations += "🍒 Вишня требует кальций для предотвращения растрескивания. ";
+            recommendations += "Рекомендуется: внести кальциевую селитру (Ca(NO3)2)\n";
+        }
+
+        // Вишня нуждается в боре для завязывания плодов
+        if (pH > 7.0F) {
+            recommendations += "🍒 Вишня требует бор для опыления и завязывания. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
+        }
+
+        // Вишня чувствительна к дефициту железа
+        if (pH > 7.0F) {
+            recommendations += "🍒 Вишня требует железо для предотвращения хлороза. ";
+            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
+        }
+    }
+
+    else if (cropName == "currant" || cropName == "смородина") {
+        // Смородина требует железо для предотвращения хлороза
+        if (pH > 7.0F) {
+            recommendations += "🫐 Смородина требует железо для предотвращения хлороза. ";
+            recommendations += "Рекомендуется: внести хелатное железо (Fe-EDTA)\n";
+        }
+
+        // Смородина нуждается в боре для завязывания ягод
+        if (pH > 6.8F || npk.potassium > 300.0F) {
+            recommendations += "🫐 Смородина требует бор для формирования ягод. ";
+            recommendations += "Рекомендуется: внести борную кислоту (H3BO3)\n";
+        }
+
+        // Смородина чувствительна к дефициту марганца
+        if (pH < 5.8F) {
+            recommendations += "🫐 Смородина требует марганец для качества ягод. ";
+            recommendations += "Рекомендуется: внести сульфат марганца (MnSO4)\n";
+        }
+    }
+
+    // 🌱 ОБЩИЕ РЕКОМЕНДАЦИИ ПО ТИПУ ПОЧВЫ
+
+    if (soilType == SoilType::CLAY || soilType == SoilType::CLAY_LOAM) {
+        recommendations += "🏺 Глинистые почвы могут связывать микроэлементы. ";
+        recommendations += "Рекомендуется: использовать хелатные формы удобрений\n";
+    }
+
+    if (soilType == SoilType::SAND || soilType == SoilType::SANDY_LOAM) {
+        recommendations += "🏖️ Песчаные почвы быстро теряют питательные вещества. ";
+        recommendations += "Рекомендуется: частые подкормки малыми дозами\n";
+    }
+
+    if (soilType == SoilType::PEAT && npk.phosphorus < 30.0F) {
+        recommendations += "🟫 Торф → дефицит P\n";
+    }
+
+    return recommendations;
+}
+"""
+
+LEGACY_DRIVER = r"""
+#include <cstdio>
+#include "business/crop_recommendation_engine.h"
+#include "jxct_config_vars.h"
+#include "validation_utils.h"
+
+Config config;
+void logDebug(const String&) {}
+void logInfo(const String&) {}
+void logWarn(const String&) {}
+void logError(const String&) {}
+void logSuccess(const String&) {}
+SensorValidationResult validateFullSensorData(const SensorData&)
+{
+    return SensorValidationResult();
+}
+void logSensorValidationResult(const SensorValidationResult&, const char*) {}
+
+namespace
+{
+@LEGACY@
+
+// Значения у порогов прежнего кода: сам порог и соседи с обеих сторон
+const float NPK_VALUES[] = {@NPK@};
+const float PH_VALUES[] = {@PH@};
+constexpr unsigned SOIL_COUNT = @SOILS@;
+constexpr unsigned CASES_PER_PAIR = 4000;
+
+template <size_t N>
+float pick(const float (&values)[N], uint32_t& state)
+{
+    state = state * 1664525U + 1013904223U;
+    return values[(state >> 8) % N];
+}
+}  // namespace
+
+int main()
+{
+    CropRecommendationEngine engine;
+    uint32_t state = 44;
+    unsigned checked = 0;
+    unsigned mismatches = 0;
+    for (size_t crop = 0; crop < CROP_COUNT; ++crop)
+    {
+        const char* name = CROP_TABLE[crop].name;
+        for (unsigned soil = 0; soil < SOIL_COUNT; ++soil)
+        {
+            for (unsigned i = 0; i < CASES_PER_PAIR; ++i)
+            {
+                const NPKReferences npk(pick(NPK_VALUES, state), pick(NPK_VALUES, state), pick(NPK_VALUES, state));
+                const float ph = pick(PH_VALUES, state);
+                const SoilType soilType = static_cast<SoilType>(soil);
+                const String expected = legacyCropSpecificRecommendations(name, npk, soilType, ph);
+                const String actual =
+                    engine.generateCropSpecificRecommendations(static_cast<CropId>(crop), npk, soilType, ph);
+                ++checked;
+                if (actual != expected)
+                {
+                    if (++mismatches <= 5)
+                    {
+                        printf("mismatch %s %u %g %g %g %g\n", name, soil, npk.nitrogen, npk.phosphorus,
+                               npk.potassium, ph);
+                    }
+                }
+            }
+        }
+    }
+    printf("checked %u mismatches %u\n", checked, mismatches);
+    return 0;
+}
+"""
+
+
+def legacy_grid():
+    """Пороги прежней цепочки: N/P/K - все литералы ±0.5, pH - литералы до 14 ±0.05"""
+    literals = sorted({float(value) for value in re.findall(r"(\d+(?:\.\d+)?)F\b", LEGACY_CHAIN)})
+    npk = sorted({value + delta for value in literals for delta in (-0.5, 0.0, 0.5)} | {0.0, 1000.0})
+    ph = sorted({round(value + delta, 2) for value in literals if value <= 14.0 for delta in (-0.05, 0.0, 0.05)})
+    return npk, ph
+
+
+def parse_rules():
+    """Строки RULES: (культура или None, маска почв, all/any, условия, сообщение)"""
+    header = read("include", "business", "crop_rules.h")
+    messages = re.findall(r"^\s+(\w+)(?: = 0)?,$", re.search(r"enum class MessageId : uint8_t\s*\{(.*?)\};", header,
+                                                            re.S).group(1), re.M)
+    crops = re.findall(r"^\s+(\w+)(?: = 0)?,$", re.search(r"enum class CropId : uint8_t\s*\{(.*?)\};",
+                                                         read("include", "business", "crop_table.h"), re.S).group(1),
+                       re.M)
+    constants = {name: float(value) for name, value in re.findall(r"constexpr float (\w+_DEFICIT) = ([\d.]+)F;", header)}
+    body = re.search(r"RULES = \{\{(.*?)\n\}\};", header, re.S).group(1)
+
+    rules = []
+    for kind, args in re.findall(r"^\s+(whenAll|whenAny|forSoils)\((.*)\),$", body, re.M):
+        terms = [(CHANNELS[channel], compare, constants.get(value) or float(value.rstrip("F")))
+                 for channel, compare, value in re.findall(r"\b(n|p|k|ph)(Below|Above|AtLeast)\((\w[\w.]*)\)", args)]
+        message = messages.index(re.search(r"MessageId::(\w+)", args).group(1))
+        if kind == "forSoils":
+            mask = {SOILS.index(name) for name in re.findall(r"SoilType::(\w+)", args)}
+            rules.append((None, mask, "all", terms, message))
+        else:
+            crop = crops.index(re.search(r"CropId::(\w+)", args).group(1))
+            rules.append((crop, set(range(len(SOILS))), "all" if kind == "whenAll" else "any", terms, message))
+    return rules, messages, crops
+
+
+def build_driver(output_dir):
+    driver = os.path.join(output_dir, "driver.cpp")
+    with open(driver, "w", encoding="utf-8") as handle:
+        handle.write(DRIVER)
+    program = os.path.join(output_dir, "rules_driver")
+    result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/web_bench/shim", "-Iinclude",
+                             "-Isrc", driver, "-o", program], cwd=PROJECT_DIR, capture_output=True, text=True)
+    assert result.returncode == 0, result.stderr[-2000:]
+    return program
+
+
+def run_driver(program, cases):
+    stdin = "".join(f"{crop} {soil} {n!r} {p!r} {k!r} {ph!r}\n" for crop, soil, (n, p, k, ph) in cases)
+    result = subprocess.run([program], input=stdin, capture_output=True, text=True, timeout=60)
+    assert result.returncode == 0, result.stderr
+    return result.stdout.splitlines()
+
+
+def test_native_matches_legacy_chain():
+    """Движок даёт тот же текст, что прежняя цепочка if/else, у всех культур, почв и порогов"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка правил пропущена")
+        return
+    npk, ph = legacy_grid()
+    assert 6.5 in ph and 150.0 in npk and 149.5 in npk
+    source = (LEGACY_DRIVER.replace("@LEGACY@", LEGACY_CHAIN)
+              .replace("@NPK@", ", ".join(f"{value!r}F" for value in npk))
+              .replace("@PH@", ", ".join(f"{value!r}F" for value in ph))
+              .replace("@SOILS@", str(len(SOILS))))
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(source)
+        program = os.path.join(output_dir, "legacy_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/web_bench/shim",
+                                 "-Iinclude", "-Isrc", driver, "src/business/crop_recommendation_engine.cpp",
+                                 "-o", program], cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=120)
+        assert result.returncode == 0, result.stderr
+
+    _, checked, _, mismatches = result.stdout.splitlines()[-1].split()
+    _, crops = parse_rules()[1:]
+    assert int(checked) == len(crops) * len(SOILS) * 4000, checked
+    assert int(mismatches) == 0, result.stdout
+
+
+def test_previous_cases():
+    """Прежние случаи: пороги культур и дефицита, почвы, местные названия"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка правил пропущена")
+        return
+    _, messages, crops = parse_rules()
+    cases = [
+        # Томат из логов ESP32 (pH 6.3, K 233): только кальций
+        (crops.index("TOMATO"), SOILS.index("LOAM"), (84.0, 118.8, 233.4, 6.3)),
+        # Томат: все три правила
+        (crops.index("TOMATO"), SOILS.index("LOAM"), (160.0, 90.0, 310.0, 6.3)),
+        # Огурец: калий ровно на пороге дефицита (150) - правило культуры, 149.9 - общий дефицит
+        (crops.index("CUCUMBER"), SOILS.index("LOAM"), (120.0, 60.0, 150.0, 6.5)),
+        (crops.index("CUCUMBER"), SOILS.index("LOAM"), (120.0, 60.0, 149.9, 6.5)),
+        # Неизвестная культура: только правила почвы; торф с P < 30
+        (crops.index("GENERIC"), SOILS.index("PEAT"), (120.0, 20.0, 200.0, 6.5)),
+        (crops.index("GENERIC"), SOILS.index("CLAY_LOAM"), (120.0, 20.0, 200.0, 6.5)),
+        # Газон: максимум сообщений для одной культуры
+        (crops.index("LAWN"), SOILS.index("SANDY_LOAM"), (210.0, 70.0, 210.0, 7.2)),
+    ]
+    expected = [
+        ["TOMATO_CALCIUM"],
+        ["TOMATO_CALCIUM", "TOMATO_NP_BALANCE", "TOMATO_BORON"],
+        ["CUCUMBER_POTASSIUM"],
+        [],
+        ["SOIL_PEAT_PHOSPHORUS"],
+        ["SOIL_CLAY_CHELATES"],
+        ["LAWN_IRON", "LAWN_MAGNESIUM", "LAWN_SULFUR", "LAWN_MICRONUTRIENTS", "SOIL_SAND_FREQUENT_FEEDING"],
+    ]
+    with tempfile.TemporaryDirectory() as output_dir:
+        lines = run_driver(build_driver(output_dir), cases)
+    for line, names in zip(lines, expected):
+        assert [messages[int(value)] for value in line.split()] == names, (line, names)
+
+    assert "alias 1" in lines
+    texts = [line[len("text "):] for line in lines if line.startswith("text ")]
+    assert len(texts) == len(messages)
+    assert texts[messages.index("TOMATO_CALCIUM")] == "🍅 Томаты → кальций Ca(NO3)2"
+    assert texts[messages.index("CUCUMBER_POTASSIUM")] == (
+        "🥒 Огурцы требуют калий для качества плодов. "
+        "Рекомендуется: внести калийную селитру (KNO3) или сульфат калия (K2SO4)")
+    assert all(text and "\n" not in text for text in texts)
+
+
+def test_engine_uses_rule_table():
+    """Движок разворачивает коды в текст; цепочки по названию культуры удалены"""
+    engine = read("src", "business", "crop_recommendation_engine.cpp")
+    assert "cropName ==" not in engine
+    assert "CropRules::evaluate(cropId, soilType, npk, pH)" in engine
+    assert "CropRules::cropIdFromAnyName(cropName.c_str())" in engine
+    assert "recommendations.reserve(length);" in engine
+
+    routes = read("src", "web", "routes_data.cpp")
+    assert "generateCropSpecificRecommendations(\n                cropIdFromName(config.cropId)," in routes
+
+    # У каждой культуры, кроме generic, есть правила
+    rules, _, crops = parse_rules()
+    with_rules = {crop for crop, *_ in rules if crop is not None}
+    assert with_rules == set(range(1, len(crops))), sorted(set(range(1, len(crops))) - with_rules)
+
+
+def main():
+    print("🧪 Тестирование правил рекомендаций культур")
+    print("=" * 60)
+
+    tests = [
+        test_native_matches_legacy_chain,
+        test_previous_cases,
+        test_engine_uses_rule_table,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
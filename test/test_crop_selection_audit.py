@@ -112,8 +112,11 @@ def test_crop_engine_integration():
     supported_crops = ['tomato', 'cucumber', 'pepper', 'lettuce', 'blueberry']
     missing_support = []
     
+    # Правила культур - таблица CropRules::RULES
+    with open("include/business/crop_rules.h", 'r', encoding='utf-8') as f:
+        rules = f.read()
     for crop in supported_crops:
-        if f'cropName == "{crop}"' not in content:
+        if f'(CropId::{crop.upper()}, MessageId::' not in rules:
             missing_support.append(crop)
     
     assert not missing_support, f"Отсутствует поддержка культур: {missing_support}"
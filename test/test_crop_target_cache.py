@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""
+Тест кэша рекомендуемых значений культур (src/business/crop_target_cache.cpp)
+Собирает настоящий кэш g++: цели совпадают с applyCropCorrections() для каждой
+культуры; без invalidateCropTargets() изменения config не видны (ответ - из кэша),
+после сброса, смены сезона и переключения сезонной поправки - пересчитаны;
+saveConfig() сбрасывает кэш, /sensor_json берёт rec_* из него
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+DRIVER = r"""
+#include <cstdio>
+#include "business/crop_target_cache.h"
+#include "jxct_config_vars.h"
+
+Config config;
+
+namespace
+{
+bool same(const CropConfig& a, const CropConfig& b)
+{
+    return a.temperature == b.temperature && a.humidity == b.humidity && a.ec == b.ec && a.ph == b.ph &&
+           a.nitrogen == b.nitrogen && a.phosphorus == b.phosphorus && a.potassium == b.potassium;
+}
+
+bool matches(const CropTargets& targets, EnvironmentType environment, SoilType soil, const CropMultipliers& season)
+{
+    for (const auto& crop : CROP_TABLE)
+    {
+        if (!same(targets[crop.id], applyCropCorrections(crop.config, environment, soil, season)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+int main()
+{
+    config.soilProfile = 3;      // CLAY
+    config.environmentType = 1;  // GREENHOUSE
+    config.flags.seasonalAdjustEnabled = 1;
+
+    const CropTargets* first = &getCropTargets(Season::SPRING, true);
+    printf("initial %d\n", matches(*first, EnvironmentType::GREENHOUSE, SoilType::CLAY, seasonMultipliers(Season::SPRING)));
+    printf("same_object %d\n", &getCropTargets(Season::SPRING, true) == first ? 1 : 0);
+
+    // Настройки меняются, но saveConfig() ещё не вызван - кэш отдаёт прежние цели
+    config.soilProfile = 0;  // SAND
+    printf("stale %d\n", matches(getCropTargets(Season::SPRING, true), EnvironmentType::GREENHOUSE, SoilType::CLAY,
+                                 seasonMultipliers(Season::SPRING)));
+
+    invalidateCropTargets();
+    printf("invalidated %d\n", matches(getCropTargets(Season::SPRING, true), EnvironmentType::GREENHOUSE, SoilType::SAND,
+                                       seasonMultipliers(Season::SPRING)));
+
+    // Смена сезона пересчитывает цели без сброса
+    printf("rollover %d\n", matches(getCropTargets(Season::AUTUMN, true), EnvironmentType::GREENHOUSE, SoilType::SAND,
+                                    seasonMultipliers(Season::AUTUMN)));
+
+    // Время не синхронизировано или поправка выключена - без сезонной коррекции
+    printf("unknown_season %d\n",
+           matches(getCropTargets(Season::AUTUMN, false), EnvironmentType::GREENHOUSE, SoilType::SAND, NO_CORRECTION));
+    config.flags.seasonalAdjustEnabled = 0;
+    printf("season_off %d\n",
+           matches(getCropTargets(Season::WINTER, true), EnvironmentType::GREENHOUSE, SoilType::SAND, NO_CORRECTION));
+
+    // Значения вне диапазона из старых настроек - суглинок и открытый грунт
+    config.soilProfile = 200;
+    config.environmentType = 9;
+    invalidateCropTargets();
+    printf("out_of_range %d\n",
+           matches(getCropTargets(Season::WINTER, true), EnvironmentType::OUTDOOR, SoilType::LOAM, NO_CORRECTION));
+    return 0;
+}
+"""
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def test_cache_behaviour():
+    """Кэш отдаёт цели всех культур и пересчитывает их только при сбросе или смене сезона"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка кэша пропущена")
+        return
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(DRIVER)
+        program = os.path.join(output_dir, "targets_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/web_bench/shim", "-Iinclude",
+                                 "-Isrc", driver, "src/business/crop_target_cache.cpp", "-o", program],
+                                cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=30)
+        assert result.returncode == 0, result.stderr
+
+    checks = dict(line.split() for line in result.stdout.splitlines())
+    expected = ["initial", "same_object", "stale", "invalidated", "rollover", "unknown_season", "season_off",
+                "out_of_range"]
+    assert list(checks) == expected
+    failed = [name for name, value in checks.items() if value != "1"]
+    assert not failed, failed
+
+
+def test_cache_is_wired():
+    """saveConfig() сбрасывает кэш; rec_* в /sensor_json - из кэша по текущему сезону"""
+    config = read("src", "config.cpp")
+    save = config[config.index("void saveConfig()"):config.index("void resetConfig()")]
+    assert "invalidateCropTargets();" in save
+
+    routes = read("src", "web", "routes_data.cpp")
+    assert "getCropTargets(season, seasonKnown)[cropIdFromName(config.cropId)]" in routes
+    assert "getCropEngine().getCropConfig(cropIdFromName(config.cropId))" not in routes
+    # Сезон определяется один раз и нужен рекомендуемым значениям тоже
+    assert "(fields & (FIELD_SEASON | FIELDS_REC)) != 0 && getCurrentSeason(season)" in routes
+    assert "business/crop_target_cache.cpp" in read("platformio.ini")
+
+
+def main():
+    print("🧪 Тестирование кэша рекомендуемых значений культур")
+    print("=" * 60)
+
+    tests = [
+        test_cache_behaviour,
+        test_cache_is_wired,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -94,11 +94,11 @@ def validate_specific_crops():
     
     for crop_id, crop_name, elements in test_crops:
         # Проверяем что культура реализована
-        crop_engine_path = "src/business/crop_recommendation_engine.cpp"
+        crop_engine_path = "include/business/crop_rules.h"
         with open(crop_engine_path, 'r', encoding='utf-8') as f:
             content = f.read()
         
-        if f'cropName == "{crop_id}"' in content:
+        if f'(CropId::{crop_id.upper()}, MessageId::' in content:
             print(f"✅ {crop_name}: Реализован ({elements})")
             passed += 1
         else:
@@ -0,0 +1,288 @@
+#!/usr/bin/env python3
+"""
+Тест таблицы коэффициентов взаимодействий (include/business/nutrient_interactions.h)
+Собирает g++ таблицу, сервис и прежние формулы getAntagonismFactor()/getSynergyFactor()
+(со сравнением названий String) и сверяет их побитово: на плотной сетке N, P, K,
+на соседних float у каждого порога и на особых значениях (0, отрицательные, inf);
+строковый API и applyNutrientInteractions() дают прежний результат
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+DRIVER = r"""
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "business/nutrient_interaction_service.h"
+
+using namespace NutrientInteractions;
+
+void logDebug(const String&) {}
+
+namespace
+{
+// Прежние формулы сервиса - эталон
+float legacyAntagonism(const String& element1, const String& element2, float ratio1)
+{
+    if (element1 == "N" && element2 == "K") {
+        float n_ratio = ratio1 / 200.0F;
+        if (n_ratio > 1.5F) {
+            return 1.0F - (0.3F * (n_ratio - 1.5F));
+        }
+    }
+    if (element1 == "K" && element2 == "Mg") {
+        float k_ratio = ratio1 / 200.0F;
+        if (k_ratio > 2.5F) {
+            return 1.0F - (0.25F * (k_ratio - 2.5F));
+        }
+    }
+    if (element1 == "P" && element2 == "Zn") {
+        float p_ratio = ratio1 / 100.0F;
+        if (p_ratio > 15.0F) {
+            return 1.0F - (0.4F * (p_ratio - 15.0F) / 15.0F);
+        }
+    }
+    return 1.0F;
+}
+
+float legacySynergy(const String& element1, const String& element2, float ratio1)
+{
+    if (element1 == "N" && element2 == "S") {
+        float optimal_ns_ratio = 15.0F;
+        float current_ratio = ratio1 / 10.0F;
+        if (current_ratio < optimal_ns_ratio) {
+            return 1.0F + (0.15F * (optimal_ns_ratio - current_ratio) / optimal_ns_ratio);
+        }
+    }
+    if (element1 == "Ca" && element2 == "B") {
+        return 1.0F + 0.1F;
+    }
+    return 1.0F;
+}
+
+float legacyPhosphorusPotassium(float p, float k)
+{
+    float pk_ratio = p / k;
+    if (pk_ratio > 0.8F) {
+        return 1.0F - (0.15F * (pk_ratio - 0.8F));
+    }
+    return 1.0F;
+}
+
+NPKReferences legacyApply(const NPKReferences& npk, float pH)
+{
+    NPKReferences corrected = npk;
+    corrected.potassium *= legacyAntagonism("N", "K", npk.nitrogen);
+    if (pH > 7.5F) {
+        corrected.phosphorus *= 1.0F - (0.3F * (pH - 7.5F));
+    }
+    float pk_ratio = npk.phosphorus / npk.potassium;
+    if (pk_ratio > 0.8F) {
+        corrected.potassium *= 1.0F - (0.15F * (pk_ratio - 0.8F));
+    }
+    return corrected;
+}
+
+bool same(float a, float b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+unsigned long long checked = 0;
+unsigned long long mismatches = 0;
+
+void expect(float actual, float expected, const char* what, float n, float p, float k)
+{
+    ++checked;
+    if (!same(actual, expected) && mismatches++ < 5)
+    {
+        printf("mismatch %s N=%.9g P=%.9g K=%.9g: %.9g != %.9g\n", what, n, p, k, actual, expected);
+    }
+}
+
+void checkTriple(float n, float p, float k)
+{
+    const Factors factors = computeFactors(NPKReferences(n, p, k));
+    expect(get(factors, Interaction::NITROGEN_BLOCKS_POTASSIUM), legacyAntagonism("N", "K", n), "N-K", n, p, k);
+    expect(get(factors, Interaction::POTASSIUM_BLOCKS_MAGNESIUM), legacyAntagonism("K", "Mg", k), "K-Mg", n, p, k);
+    expect(get(factors, Interaction::PHOSPHORUS_BLOCKS_ZINC), legacyAntagonism("P", "Zn", p), "P-Zn", n, p, k);
+    expect(get(factors, Interaction::PHOSPHORUS_BLOCKS_POTASSIUM), legacyPhosphorusPotassium(p, k), "P-K", n, p, k);
+    expect(get(factors, Interaction::NITROGEN_WITH_SULFUR), legacySynergy("N", "S", n), "N+S", n, p, k);
+    expect(get(factors, Interaction::CALCIUM_WITH_BORON), legacySynergy("Ca", "B", 0.0F), "Ca+B", n, p, k);
+}
+
+// Значения вокруг порога доли: по 64 соседних float с каждой стороны
+void addAroundOnset(std::vector<float>& values, float onset, float scale)
+{
+    const float center = onset * scale;
+    float below = center;
+    float above = center;
+    for (int i = 0; i < 64; ++i)
+    {
+        values.push_back(below);
+        values.push_back(above);
+        below = std::nextafter(below, 0.0F);
+        above = std::nextafter(above, std::numeric_limits<float>::infinity());
+    }
+}
+}  // namespace
+
+int main()
+{
+    // Значения: сетка 0..5000 с шагом 0.25, соседи порогов, особые значения
+    std::vector<float> values;
+    for (int i = 0; i <= 20000; ++i)
+    {
+        values.push_back(i * 0.25F);
+    }
+    for (const Coefficients& coefficients : INTERACTIONS)
+    {
+        if (coefficients.scale > 0.0F)
+        {
+            addAroundOnset(values, coefficients.onset, coefficients.scale);
+        }
+    }
+    for (const float special : {-0.0F, -1.0F, -350.0F, 1e-30F, 1e30F, std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::infinity()})
+    {
+        values.push_back(special);
+    }
+
+    // Однопараметрические формулы: каждое значение во всех ролях
+    for (const float value : values)
+    {
+        checkTriple(value, value, 200.0F);
+        checkTriple(value, 60.0F, value);
+    }
+    // P/K: сетка 0..1000 x 0..1000 с шагом 1 и соседи порога 0.8
+    for (int p = 0; p <= 1000; ++p)
+    {
+        for (int k = 0; k <= 1000; ++k)
+        {
+            checkTriple(150.0F, static_cast<float>(p), static_cast<float>(k));
+        }
+    }
+    for (int k = 1; k <= 1000; ++k)
+    {
+        float p = 0.8F * k;
+        for (int i = 0; i < 8; ++i)
+        {
+            checkTriple(150.0F, p, static_cast<float>(k));
+            checkTriple(150.0F, std::nextafter(p, 0.0F), static_cast<float>(k));
+            p = std::nextafter(p, 1e9F);
+        }
+    }
+
+    // Строковый API и итоговая коррекция сервиса
+    NutrientInteractionService service;
+    const char* symbols[] = {"N", "P", "K", "Ca", "Mg", "S", "Zn", "B", "Fe", ""};
+    for (const float value : values)
+    {
+        for (const char* first : symbols)
+        {
+            for (const char* second : symbols)
+            {
+                expect(service.getSynergyFactor(first, second, value, 0.0F), legacySynergy(first, second, value),
+                       "synergy", value, 0.0F, 0.0F);
+                if (strcmp(first, "P") != 0 || strcmp(second, "K") != 0)
+                {
+                    expect(service.getAntagonismFactor(first, second, value, 0.0F),
+                           legacyAntagonism(first, second, value), "antagonism", value, 0.0F, 0.0F);
+                }
+            }
+        }
+    }
+    // P-K в строковом API - новая пара: второе значение - количество калия
+    expect(service.getAntagonismFactor("P", "K", 400.0F, 250.0F), legacyPhosphorusPotassium(400.0F, 250.0F), "P-K api",
+           0.0F, 400.0F, 250.0F);
+    for (size_t i = 0; i + 2 < values.size(); i += 7)
+    {
+        for (const float ph : {5.5F, 7.5F, 8.2F})
+        {
+            const NPKReferences npk(values[i], values[i + 1], values[i + 2]);
+            const NPKReferences actual = service.applyNutrientInteractions(npk, SoilType::LOAM, ph);
+            const NPKReferences expected = legacyApply(npk, ph);
+            expect(actual.nitrogen, expected.nitrogen, "apply N", npk.nitrogen, npk.phosphorus, npk.potassium);
+            expect(actual.phosphorus, expected.phosphorus, "apply P", npk.nitrogen, npk.phosphorus, npk.potassium);
+            expect(actual.potassium, expected.potassium, "apply K", npk.nitrogen, npk.phosphorus, npk.potassium);
+        }
+    }
+
+    printf("checked %llu mismatches %llu\n", checked, mismatches);
+    return 0;
+}
+"""
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def test_table_matches_previous_formulas():
+    """Таблица и строковый API побитово совпадают с прежними формулами"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка таблицы пропущена")
+        return
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(DRIVER)
+        program = os.path.join(output_dir, "interactions_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O2", "-DARDUINO=10819", "-Itest/web_bench/shim",
+                                 "-Iinclude", "-Isrc", driver, "src/business/nutrient_interaction_service.cpp",
+                                 "-o", program], cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=120)
+        assert result.returncode == 0, result.stderr
+    summary = result.stdout.splitlines()[-1].split()
+    assert int(summary[1]) > 1_000_000, result.stdout
+    assert summary[3] == "0", result.stdout
+
+
+def test_service_uses_table():
+    """Сервис не сравнивает названия элементов в формулах; таблица проверяется при компиляции"""
+    service = read("src", "business", "nutrient_interaction_service.cpp")
+    assert 'element1 == "' not in service
+    assert 'getAntagonismFactor("N", "K"' not in service
+    assert "NutrientInteractions::computeFactors(npk)" in service
+    assert "std::map" not in read("src", "business", "nutrient_interaction_service.h")
+    header = read("include", "business", "nutrient_interactions.h")
+    assert "static_assert(interactionsAreConsistent()" in header
+    kernel = header[header.index("inline float factor("):header.index("inline Amounts amountsFromNpk")]
+    assert "if (" not in kernel and "std::fmax(0.0F" in kernel
+
+
+def main():
+    print("🧪 Тестирование таблицы взаимодействий питательных веществ")
+    print("=" * 60)
+
+    tests = [
+        test_table_matches_previous_formulas,
+        test_service_uses_table,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
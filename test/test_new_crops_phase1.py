@@ -13,10 +13,10 @@ def test_phase1_crops_implementation():
     print("🌱 ТЕСТ НОВЫХ КУЛЬТУР ФАЗЫ 1")
     print("=" * 50)
     
-    # Проверяем crop_recommendation_engine.cpp
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
+    # Проверяем таблицу правил crop_rules.h
+    crop_engine_path = "include/business/crop_rules.h"
     if not os.path.exists(crop_engine_path):
-        print("❌ Файл crop_recommendation_engine.cpp не найден")
+        print("❌ Файл crop_rules.h не найден")
         return False
     
     with open(crop_engine_path, 'r', encoding='utf-8') as f:
@@ -38,21 +38,21 @@ def test_phase1_crops_implementation():
             "display": "Шпинат",
             "emoji": "🥬",
             "critical_nutrients": ["N", "Fe", "Mg"],
-            "conditions": ["pH > 7.0F", "npk.nitrogen < 200.0F", "npk.potassium > 400.0F"]
+            "conditions": ["phAbove(7.0F)", "nBelow(200.0F)", "kAbove(400.0F)"]
         },
         "basil": {
             "russian": "базилик", 
             "display": "Базилик",
             "emoji": "🌿",
             "critical_nutrients": ["N", "K", "Mg"],
-            "conditions": ["npk.potassium < 200.0F", "npk.potassium > 300.0F", "pH > 6.5F"]
+            "conditions": ["kBelow(200.0F)", "kAbove(300.0F)", "phAbove(6.5F)"]
         },
         "cannabis": {
             "russian": "конопля",
             "display": "Конопля медицинская", 
             "emoji": "🌿",
             "critical_nutrients": ["N", "P", "K", "Ca", "Mg"],
-            "conditions": ["npk.nitrogen < 160.0F", "npk.phosphorus < 40.0F", "npk.potassium < 200.0F", "pH < 6.0F", "npk.potassium > 300.0F"]
+            "conditions": ["nBelow(160.0F)", "pBelow(40.0F)", "kBelow(200.0F)", "phBelow(6.0F)", "kAbove(300.0F)"]
         }
     }
     
@@ -61,9 +61,9 @@ def test_phase1_crops_implementation():
     for crop_id, data in phase1_crops.items():
         print(f"\n🔍 Тестирование: {data['display']} ({crop_id})")
         
-        # 1. Проверяем логику в crop_recommendation_engine.cpp
-        crop_pattern = f'cropName == "{crop_id}"'
-        russian_pattern = f'cropName == "{data["russian"]}"'
+        # 1. Проверяем правила культуры в crop_rules.h
+        crop_pattern = f'(CropId::{crop_id.upper()}, MessageId::'
+        russian_pattern = f'{{CropId::{crop_id.upper()}, "{data["russian"]}"}}'
         
         engine_implemented = crop_pattern in engine_content and russian_pattern in engine_content
         print(f"  {'✅' if engine_implemented else '❌'} Логика в CropRecommendationEngine: {engine_implemented}")
@@ -182,7 +182,7 @@ def test_integration_with_existing_system():
     # Проверяем что новые культуры не сломали существующие
     existing_crops = ["tomato", "cucumber", "pepper", "lettuce", "blueberry", "strawberry", "apple", "grape"]
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
+    crop_engine_path = "include/business/crop_rules.h"
     with open(crop_engine_path, 'r', encoding='utf-8') as f:
         content = f.read()
     
@@ -190,7 +190,7 @@ def test_integration_with_existing_system():
     
     integration_ok = True
     for crop in existing_crops:
-        pattern = f'cropName == "{crop}"'
+        pattern = f'(CropId::{crop.upper()}, MessageId::'
         if pattern in content:
             print(f"  ✅ {crop}: Работает")
         else:
@@ -198,7 +198,9 @@ def test_integration_with_existing_system():
             integration_ok = False
     
     # Проверяем общую структуру
-    if "generateCropSpecificRecommendations" in content:
+    with open("src/business/crop_recommendation_engine.cpp", 'r', encoding='utf-8') as f:
+        engine = f.read()
+    if "generateCropSpecificRecommendations" in engine and "CropRules::evaluate(" in engine:
         print("  ✅ Основная функция: Работает")
     else:
         print("  ❌ Основная функция: СЛОМАНА!")
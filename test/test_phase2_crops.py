@@ -13,8 +13,8 @@ def test_phase2_crops_implementation():
     print("🌾 ТЕСТ КУЛЬТУР ФАЗЫ 2: ПШЕНИЦА И КАРТОФЕЛЬ")
     print("=" * 60)
     
-    # Проверяем crop_recommendation_engine.cpp
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
+    # Проверяем таблицу правил crop_rules.h
+    crop_engine_path = "include/business/crop_rules.h"
     with open(crop_engine_path, 'r', encoding='utf-8') as f:
         engine_content = f.read()
     
@@ -31,10 +31,10 @@ def test_phase2_crops_implementation():
             "emoji": "🌾",
             "critical_nutrients": ["N", "P", "S"],  # Азот, Фосфор, Сера
             "conditions": [
-                "npk.nitrogen < 200.0F",      # Требует много азота
-                "npk.phosphorus < 50.0F",     # Нуждается в фосфоре
-                "npk.nitrogen > 250.0F",      # Для определения дефицита серы
-                "npk.potassium < 150.0F"      # Калий для иммунитета
+                "nBelow(200.0F)",      # Требует много азота
+                "pBelow(50.0F)",     # Нуждается в фосфоре
+                "nAbove(250.0F)",      # Для определения дефицита серы
+                "kBelow(150.0F)"      # Калий для иммунитета
             ],
             "scientific_basis": {
                 "high_protein": True,         # Высокое содержание белка
@@ -49,11 +49,11 @@ def test_phase2_crops_implementation():
             "emoji": "🥔",
             "critical_nutrients": ["K", "Mg", "Ca"],  # Калий, Магний, Кальций
             "conditions": [
-                "npk.potassium < 250.0F",     # Требует много калия
-                "npk.potassium > 400.0F",     # K-Mg антагонизм
-                "pH < 5.8F",                  # Кальций при кислой почве
-                "npk.nitrogen > 200.0F",      # Сбалансированное питание
-                "npk.nitrogen > 250.0F"       # Избыток азота вреден
+                "kBelow(250.0F)",     # Требует много калия
+                "kAbove(400.0F)",     # K-Mg антагонизм
+                "phBelow(5.8F)",                  # Кальций при кислой почве
+                "nAbove(200.0F)",      # Сбалансированное питание
+                "nAbove(250.0F)"       # Избыток азота вреден
             ],
             "scientific_basis": {
                 "tuber_quality": True,        # Качество клубней
@@ -70,9 +70,9 @@ def test_phase2_crops_implementation():
     for crop_id, data in phase2_crops.items():
         print(f"\n🔍 Тестирование: {data['display']} ({crop_id})")
         
-        # 1. Проверяем логику в crop_recommendation_engine.cpp
-        crop_pattern = f'cropName == "{crop_id}"'
-        russian_pattern = f'cropName == "{data["russian"]}"'
+        # 1. Проверяем правила культуры в crop_rules.h
+        crop_pattern = f'(CropId::{crop_id.upper()}, MessageId::'
+        russian_pattern = f'{{CropId::{crop_id.upper()}, "{data["russian"]}"}}'
         
         engine_implemented = crop_pattern in engine_content and russian_pattern in engine_content
         print(f"  {'✅' if engine_implemented else '❌'} Логика в CropRecommendationEngine: {engine_implemented}")
@@ -234,7 +234,7 @@ def test_integration_complete_system():
         "wheat", "potato"
     ]
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
+    crop_engine_path = "include/business/crop_rules.h"
     with open(crop_engine_path, 'r', encoding='utf-8') as f:
         content = f.read()
     
@@ -244,7 +244,7 @@ def test_integration_complete_system():
     implemented_crops = 0
     
     for crop in all_crops:
-        pattern = f'cropName == "{crop}"'
+        pattern = f'(CropId::{crop.upper()}, MessageId::'
         if pattern in content:
             print(f"  ✅ {crop}: Работает")
             implemented_crops += 1
@@ -14,8 +14,8 @@ def test_phase3_crops_implementation():
     print("🥬 ТЕСТ КУЛЬТУР ФАЗЫ 3: ЗАВЕРШАЮЩИЕ 5 КУЛЬТУР")
     print("=" * 70)
     
-    # Проверяем crop_recommendation_engine.cpp
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
+    # Проверяем таблицу правил crop_rules.h
+    crop_engine_path = "include/business/crop_rules.h"
     with open(crop_engine_path, 'r', encoding='utf-8') as f:
         engine_content = f.read()
     
@@ -31,7 +31,7 @@ def test_phase3_crops_implementation():
             "display": "Кале",
             "emoji": "🥬",
             "critical_nutrients": ["Ca", "S", "B"],
-            "conditions": ["pH < 6.0F", "npk.nitrogen > 200.0F", "pH > 7.0F", "npk.potassium > 350.0F"],
+            "conditions": ["phBelow(6.0F)", "nAbove(200.0F)", "phAbove(7.0F)", "kAbove(350.0F)"],
             "category": "brassicas",
             "scientific_basis": {
                 "calcium_deficiency": True,      # Краевой ожог листьев
@@ -45,7 +45,7 @@ def test_phase3_crops_implementation():
             "display": "Малина",
             "emoji": "🍇",
             "critical_nutrients": ["Fe", "Mn", "Zn"],
-            "conditions": ["pH > 6.5F", "pH < 5.5F", "npk.phosphorus > 70.0F"],
+            "conditions": ["phAbove(6.5F)", "phBelow(5.5F)", "pAbove(70.0F)"],
             "category": "berries",
             "scientific_basis": {
                 "iron_chlorosis": True,          # Хлороз при щелочной почве
@@ -59,7 +59,7 @@ def test_phase3_crops_implementation():
             "display": "Ежевика",
             "emoji": "🫐",
             "critical_nutrients": ["Fe", "Mn", "B"],
-            "conditions": ["pH > 7.0F", "pH < 5.8F", "pH > 6.8F", "npk.potassium > 300.0F"],
+            "conditions": ["phAbove(7.0F)", "phBelow(5.8F)", "phAbove(6.8F)", "kAbove(300.0F)"],
             "category": "berries",
             "scientific_basis": {
                 "iron_tolerance": True,          # Более устойчива к дефициту Fe
@@ -73,7 +73,7 @@ def test_phase3_crops_implementation():
             "display": "Соя",
             "emoji": "🌱",
             "critical_nutrients": ["P", "K", "Mo"],
-            "conditions": ["npk.phosphorus < 40.0F", "npk.potassium < 200.0F", "npk.nitrogen < 80.0F", "npk.nitrogen > 120.0F"],
+            "conditions": ["pBelow(40.0F)", "kBelow(200.0F)", "nBelow(80.0F)", "nAbove(120.0F)"],
             "category": "legumes",
             "scientific_basis": {
                 "nitrogen_fixation": True,       # Симбиоз с ризобиями
@@ -87,7 +87,7 @@ def test_phase3_crops_implementation():
             "display": "Морковь",
             "emoji": "🥕",
             "critical_nutrients": ["B", "Ca", "K"],
-            "conditions": ["pH > 7.0F", "npk.potassium > 300.0F", "pH < 6.0F", "npk.potassium < 200.0F", "npk.nitrogen > 180.0F"],
+            "conditions": ["phAbove(7.0F)", "kAbove(300.0F)", "phBelow(6.0F)", "kBelow(200.0F)", "nAbove(180.0F)"],
             "category": "root_vegetables",
             "scientific_basis": {
                 "boron_deficiency": True,        # Растрескивание корней
@@ -103,9 +103,9 @@ def test_phase3_crops_implementation():
     for crop_id, data in phase3_crops.items():
         print(f"\n🔍 Тестирование: {data['display']} ({crop_id})")
         
-        # 1. Проверяем логику в crop_recommendation_engine.cpp
-        crop_pattern = f'cropName == "{crop_id}"'
-        russian_pattern = f'cropName == "{data["russian"]}"'
+        # 1. Проверяем правила культуры в crop_rules.h
+        crop_pattern = f'(CropId::{crop_id.upper()}, MessageId::'
+        russian_pattern = f'{{CropId::{crop_id.upper()}, "{data["russian"]}"}}'
         
         engine_implemented = crop_pattern in engine_content and russian_pattern in engine_content
         print(f"  {'✅' if engine_implemented else '❌'} Логика в CropRecommendationEngine: {engine_implemented}")
@@ -223,7 +223,7 @@ def test_complete_system_validation():
         "carrot": {"phase": "phase3", "category": "root_vegetables"}
     }
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
+    crop_engine_path = "include/business/crop_rules.h"
     with open(crop_engine_path, 'r', encoding='utf-8') as f:
         content = f.read()
     
@@ -234,7 +234,7 @@ def test_complete_system_validation():
     category_stats = {}
     
     for crop, info in all_crops.items():
-        pattern = f'cropName == "{crop}"'
+        pattern = f'(CropId::{crop.upper()}, MessageId::'
         if pattern in content:
             print(f"  ✅ {crop}: Работает ({info['phase']}, {info['category']})")
             implemented_crops += 1
@@ -209,9 +209,9 @@ def test_existing_crops_scientific_validation():
     print("=" * 60)
     
     # Читаем текущий файл
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
+    crop_engine_path = "include/business/crop_rules.h"
     if not os.path.exists(crop_engine_path):
-        print("❌ Файл crop_recommendation_engine.cpp не найден")
+        print("❌ Файл crop_rules.h не найден")
         return False
     
     with open(crop_engine_path, 'r', encoding='utf-8') as f:
@@ -223,7 +223,7 @@ def test_existing_crops_scientific_validation():
         print(f"\n🔍 Проверка: {data['name']}")
         
         # Проверяем наличие в коде
-        crop_pattern = f'cropName == "{crop_id}"'
+        crop_pattern = f'(CropId::{crop_id.upper()}, MessageId::'
         if crop_pattern in content:
             print(f"  ✅ Найдена в коде: {crop_id}")
             
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+Тест /api/v2/sensor с выбором полей (src/web/routes_data.cpp)
+Зеркало логики: ?fields= разбирается в битовую маску по таблице имён и групп,
+неизвестное имя даёт 400, ?text=0 убирает тексты рекомендаций; сборщик ответа
+вызывает дорогие сервисы только для выбранных полей; полный набор совпадает с v1
+"""
+
+import os
+import re
+import sys
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+FIELDS = [
+    "temperature", "humidity", "ec", "ph", "nitrogen", "phosphorus", "potassium",
+    "raw_temperature", "raw_humidity", "raw_ec", "raw_ph", "raw_nitrogen", "raw_phosphorus", "raw_potassium",
+    "irrigation", "valid", "measurement_status", "nutrient_interactions", "crop_id",
+    "crop_specific_recommendations",
+    "rec_temperature", "rec_humidity", "rec_ec", "rec_ph", "rec_nitrogen", "rec_phosphorus", "rec_potassium",
+    "season", "alerts", "timestamp", "interaction_codes", "crop_codes",
+]
+BITS = {name: 1 << index for index, name in enumerate(FIELDS)}
+ALL = (1 << 30) - 1  # коды рекомендаций - только по ?fields=
+GROUPS = {
+    "values": FIELDS[0:7],
+    "raw": FIELDS[7:14],
+    "rec": FIELDS[20:27],
+    "status": ["irrigation", "valid", "measurement_status", "alerts"],
+    "recommendations": ["nutrient_interactions", "crop_specific_recommendations"],
+    "codes": ["interaction_codes", "crop_codes"],
+}
+TEXT = BITS["nutrient_interactions"] | BITS["crop_specific_recommendations"]
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def find_field(name):
+    """Зеркало findSensorField()"""
+    if name in BITS:
+        return BITS[name]
+    if name in GROUPS:
+        mask = 0
+        for field in GROUPS[name]:
+            mask |= BITS[field]
+        return mask
+    return ALL if name == "all" else 0
+
+
+def parse_fields(text):
+    """Зеркало parseSensorFields(): (ok, mask, unknown)"""
+    mask = 0
+    for name in text.split(","):
+        if not name:
+            continue
+        bit = find_field(name)
+        if bit == 0:
+            safe = "".join(c if c.isascii() and (c.islower() or c.isdigit() or c == "_") else "?" for c in name)
+            return False, 0, safe[:31]
+        mask |= bit
+    return mask != 0, mask, ""
+
+
+def project(args):
+    """Маска запроса, как в sendSensorJsonV2()"""
+    mask = ALL
+    if "fields" in args:
+        ok, mask, unknown = parse_fields(args["fields"])
+        if not ok:
+            return 400, unknown
+    if args.get("text") == "0":
+        mask &= ~TEXT
+    return 200, mask
+
+
+def selected(mask):
+    return [name for name in FIELDS if mask & BITS[name]]
+
+
+def test_field_table_matches_source():
+    """Биты и имена в таблице совпадают с порядком полей /sensor_json"""
+    source = read("src", "web", "routes_data.cpp")
+    bits = re.findall(r"constexpr uint32_t FIELD_(\w+) = 1U << (\d+);", source)
+    assert [int(bit) for _, bit in bits] == list(range(len(FIELDS)))
+    names = re.findall(r'\{"(\w+)", FIELD_(\w+)\}', source)
+    assert [name for name, _ in names] == FIELDS
+    for name, constant in names:
+        assert BITS[name] == 1 << int(dict(bits)[constant]), name
+    for group in GROUPS:
+        assert f'{{"{group}", FIELDS_' in source, group
+    assert "FIELDS_ALL = (1U << 30) - 1U" in source
+
+
+def test_parse_fields():
+    """Поля и группы складываются, пустые элементы пропускаются, неизвестные - 400"""
+    assert project({}) == (200, ALL)
+    assert selected(project({"fields": "ph"})[1]) == ["ph"]
+    assert selected(project({"fields": "raw,ph,"})[1]) == ["ph"] + GROUPS["raw"]
+    assert project({"fields": "all"}) == (200, ALL)
+    assert project({"fields": "ph,moisture"}) == (400, "moisture")
+    assert project({"fields": 'x"}<'}) == (400, "x???")
+    assert project({"fields": ","})[0] == 400
+
+
+def test_text_option():
+    """text=0 убирает тексты рекомендаций и из полного набора, и из проекции"""
+    code, mask = project({"text": "0"})
+    assert code == 200 and mask == ALL & ~TEXT
+    assert "crop_specific_recommendations" not in selected(mask) and "rec_ph" in selected(mask)
+    assert project({"fields": "recommendations", "text": "0"}) == (200, 0)
+    assert project({"fields": "ph", "text": "1"}) == (200, BITS["ph"])
+    # Коды не тексты: text=0 их не убирает, в полный набор они не входят
+    assert selected(project({"fields": "codes", "text": "0"})[1]) == ["interaction_codes", "crop_codes"]
+    assert "interaction_codes" not in selected(ALL)
+
+
+def test_builder_skips_unselected_work():
+    """Дорогие сервисы вызываются только внутри проверки своего бита"""
+    source = read("src", "web", "routes_data.cpp")
+    builder = source[source.index("String buildSensorJson(uint32_t fields)"):source.index("const String& getCachedSensorJson()")]
+    guards = {
+        "generateAntagonismRecommendations": "FIELD_NUTRIENT_INTERACTIONS",
+        "generateCropSpecificRecommendations": "FIELD_CROP_RECOMMENDATIONS",
+        "getCropTargets": "FIELDS_REC",
+        "vwcToAsm": "FIELD_HUMIDITY",
+    }
+    for call, guard in guards.items():
+        at = builder.index(call)
+        nearest = builder.rindex("if ((fields & ", 0, at)
+        assert builder.startswith(f"if ((fields & {guard}) != 0)", nearest), call
+    assert "(fields & (FIELD_SEASON | FIELDS_REC)) != 0 && getCurrentSeason(season)" in builder
+
+    assert "sensorJsonCache.json = buildSensorJson(FIELDS_ALL);" in source
+    handler = source[source.index("void sendSensorJsonV2()"):source.index("void setupDataRoutes()")]
+    assert "hashEtagBytes(getSensorJsonConfigHash(), &fields, sizeof(fields))" in handler
+    assert handler.index("sendNotModifiedIfMatch") < handler.index("buildSensorJson(fields)")
+    assert "webServer.on(API_V2_SENSOR, HTTP_GET, sendSensorJsonV2);" in source
+    assert '#define API_V2_SENSOR API_V2_ROOT "/sensor"' in read("include", "jxct_strings.h")
+
+
+def main():
+    print("🧪 Тестирование /api/v2/sensor (выбор полей)")
+    print("=" * 60)
+
+    tests = [
+        test_field_table_matches_source,
+        test_parse_fields,
+        test_text_option,
+        test_builder_skips_unselected_work,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""
+Тест кэша ответа /sensor_json (src/web/routes_data.cpp)
+Зеркало SensorJsonCache: ответ пересобирается только при смене поколения показаний
+или хэша конфигурации (включая текущий сезон и признак синхронизированного
+времени); источники данных обязаны повышать поколение
+"""
+
+import os
+import re
+import sys
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def fnv1a(hash_value, data):
+    """Зеркало hashEtagBytes() (conditional_get.cpp)"""
+    for byte in data:
+        hash_value ^= byte
+        hash_value = (hash_value * 16777619) & 0xFFFFFFFF
+    return hash_value
+
+
+def config_hash(config):
+    """Зеркало getSensorJsonConfigHash()"""
+    value = 2166136261
+    value = fnv1a(value, bytes([config["timeValid"]]))
+    value = fnv1a(value, bytes([config["season"] if config["timeValid"] else 0]))
+    value = fnv1a(value, bytes([config["soilProfile"]]))
+    value = fnv1a(value, bytes([config["environmentType"]]))
+    value = fnv1a(value, bytes([config["seasonalAdjust"]]))
+    return fnv1a(value, config["cropId"].encode("utf-8")[:16])
+
+
+class SensorJsonCache:
+    """Зеркало sendSensorJson(): кэш по (поколение, хэш конфигурации)"""
+
+    def __init__(self):
+        self.json = ""
+        self.generation = 0
+        self.config_hash = 0
+        self.filled = False
+        self.builds = 0
+
+    def serve(self, generation, config):
+        current_hash = config_hash(config)
+        if not self.filled or self.generation != generation or self.config_hash != current_hash:
+            self.builds += 1
+            self.json = f'{{"gen":{generation},"crop":"{config["cropId"]}"}}'
+            self.generation = generation
+            self.config_hash = current_hash
+            self.filled = True
+        return self.json
+
+
+def default_config():
+    return {"timeValid": 1, "season": 1, "soilProfile": 1, "environmentType": 0, "seasonalAdjust": 1,
+            "cropId": "tomato"}
+
+
+def test_repeated_polls_hit_cache():
+    """Повторные опросы без новых показаний не пересобирают ответ"""
+    cache = SensorJsonCache()
+    config = default_config()
+    first = cache.serve(7, config)
+    for _ in range(50):
+        assert cache.serve(7, config) == first
+    assert cache.builds == 1
+
+
+def test_new_generation_rebuilds():
+    """Новое поколение показаний - ровно одна пересборка"""
+    cache = SensorJsonCache()
+    config = default_config()
+    cache.serve(1, config)
+    cache.serve(2, config)
+    cache.serve(2, config)
+    assert cache.builds == 2
+
+
+def test_config_change_rebuilds():
+    """Смена культуры, профиля почвы, среды или сезонной коррекции пересобирает ответ"""
+    base = default_config()
+    changes = [("cropId", "potato"), ("soilProfile", 3), ("environmentType", 1), ("seasonalAdjust", 0)]
+    for field, value in changes:
+        changed = dict(base, **{field: value})
+        assert config_hash(changed) != config_hash(base), field
+        cache = SensorJsonCache()
+        cache.serve(5, base)
+        cache.serve(5, changed)
+        assert cache.builds == 2, field
+
+
+def test_season_change_rebuilds():
+    """Смена сезона и синхронизация времени пересобирают ответ без нового показания"""
+    base = default_config()
+    for changed in (dict(base, season=2), dict(base, timeValid=0)):
+        assert config_hash(changed) != config_hash(base), changed
+        cache = SensorJsonCache()
+        cache.serve(5, base)
+        cache.serve(5, changed)
+        assert cache.builds == 2, changed
+    # Пока время не синхронизировано, сезон не влияет на хэш
+    assert config_hash(dict(base, timeValid=0)) == config_hash(dict(base, timeValid=0, season=3))
+
+    source = read("src", "web", "routes_data.cpp")
+    start = source.index("uint32_t getSensorJsonConfigHash()")
+    body = source[start:source.index("\n}\n", start)]
+    assert "getCurrentSeason(season)" in body
+    assert "hashEtagBytes(hash, &timeValid, sizeof(timeValid));" in body
+    assert "hashEtagBytes(hash, &seasonIndex, sizeof(seasonIndex));" in body
+
+    # Сезон - только из уже синхронизированного времени: опрос и 304 не ждут NTP
+    season = source[source.index("bool getCurrentSeason(Season& season)"):source.index("const char* getCurrentSeasonName()")]
+    assert "timeClient->isTimeSet()" in season
+    assert "forceUpdate" not in season and "new NTPClient" not in season
+    loop = read("src", "main.cpp")
+    assert "timeClient->isTimeSet() ? 6UL * 3600UL * 1000UL : NTP_UNSYNCED_RETRY_MS" in loop
+
+
+def test_sources_bump_generation():
+    """Реальный и тестовый датчики повышают поколение после обработки данных"""
+    modbus = read("src", "modbus_sensor.cpp")
+    finalize = modbus[modbus.index("void finalizeSensorData"):modbus.index("}  // namespace", modbus.index("void finalizeSensorData"))]
+    assert finalize.count("markSensorDataUpdated();") == 2
+    fake = read("src", "fake_sensor.cpp")
+    assert len(re.findall(r"processSensorData\(sensorData, config\);\s*markSensorDataUpdated\(\);", fake)) == 2
+
+
+def test_handler_serves_cached_bytes():
+    """Обработчик отдаёт байты из кэша и не сериализует документ сам"""
+    source = read("src", "web", "routes_data.cpp")
+    handler = source[source.index("const String& getCachedSensorJson()"):source.index("void setupDataRoutes()")]
+    assert "return sensorJsonCache.json;" in handler
+    assert "webServer.send(HTTP_OK, HTTP_CONTENT_TYPE_JSON, getCachedSensorJson());" in handler
+    assert "serializeJson" not in handler
+    assert "getSensorDataGeneration()" in handler
+
+
+def main():
+    print("🧪 Тестирование кэша /sensor_json")
+    print("=" * 60)
+
+    tests = [
+        test_repeated_polls_hit_cache,
+        test_new_generation_rebuilds,
+        test_config_change_rebuilds,
+        test_season_change_rebuilds,
+        test_sources_bump_generation,
+        test_handler_serves_cached_bytes,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -8,13 +8,23 @@
 import re
 import os
 
+RULES_PATH = "include/business/crop_rules.h"
+TERM_CHANNELS = {"nitrogen": "n", "phosphorus": "p", "potassium": "k"}
+
+
+def crop_section(content, crop):
+    """Блок правил культуры (с комментарием) и тексты её сообщений из crop_rules.h"""
+    rows = re.findall(rf'(?:^[ \t]*//.*\n)*(?:^[ \t]*when\w+\(CropId::{crop.upper()}, .*\n)+', content, re.M)
+    texts = re.findall(rf'\{{MessageId::{crop.upper()}_\w+,\s*((?:"[^"]*"\s*)+)\}}', content)
+    return "\n".join(rows + texts) if rows else None
+
+
 def validate_all_crops():
     """Валидация всех культур"""
     print("ФИНАЛЬНАЯ ВАЛИДАЦИЯ СИСТЕМЫ JXCT")
     print("=" * 50)
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
-    with open(crop_engine_path, 'r', encoding='utf-8') as f:
+    with open(RULES_PATH, 'r', encoding='utf-8') as f:
         content = f.read()
     
     # Список всех культур
@@ -30,19 +40,16 @@ def validate_all_crops():
     
     for crop in expected_crops:
         # Проверяем реализацию
-        if f'cropName == "{crop}"' in content:
+        if f'(CropId::{crop.upper()}, MessageId::' in content:
             implemented_crops.append(crop)
             
-            # Извлекаем секцию культуры
-            pattern = rf'if \(cropName == "{crop}".*?\}}(?=\s*else if|\s*// 🌱)'
-            match = re.search(pattern, content, re.DOTALL)
+            # Извлекаем правила культуры
+            section = crop_section(content, crop)
             
-            if match:
-                crop_section = match.group(0)
-                
-                # Подсчитываем условия
-                conditions = len(re.findall(r'if \([^)]+\)', crop_section))
-                recommendations = len(re.findall(r'recommendations \+=', crop_section))
+            if section:
+                # Подсчитываем условия (строки правил) и тексты рекомендаций
+                conditions = len(re.findall(r'when(?:All|Any)\(', section))
+                recommendations = len(set(re.findall(r'MessageId::\w+', section)))
                 
                 print(f"[OK] {crop:12} | Условий: {conditions:2} | Рекомендаций: {recommendations:2}")
                 
@@ -72,16 +79,15 @@ def validate_all_crops():
     
     for crop in implemented_crops:
         if crop in critical_elements:
-            pattern = rf'if \(cropName == "{crop}".*?\}}(?=\s*else if|\s*// 🌱)'
-            match = re.search(pattern, content, re.DOTALL)
+            section = crop_section(content, crop)
             
-            if match:
-                crop_section = match.group(0).lower()
+            if section:
+                section = section.lower()
                 elements = critical_elements[crop]
                 found_elements = []
                 
                 for element in elements:
-                    if element in crop_section:
+                    if element in section:
                         found_elements.append(element)
                 
                 coverage = len(found_elements) / len(elements) * 100
@@ -125,8 +131,7 @@ def test_realistic_conditions():
     
     print(f"Тестовые значения: pH={sensor_values['ph']}, N={sensor_values['nitrogen']}, P={sensor_values['phosphorus']}, K={sensor_values['potassium']}")
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
-    with open(crop_engine_path, 'r', encoding='utf-8') as f:
+    with open(RULES_PATH, 'r', encoding='utf-8') as f:
         content = f.read()
     
     crops_that_trigger = []
@@ -134,15 +139,13 @@ def test_realistic_conditions():
     test_crops = ["tomato", "cucumber", "pepper", "lettuce", "blueberry"]
     
     for crop in test_crops:
-        pattern = rf'if \(cropName == "{crop}".*?\}}(?=\s*else if|\s*// 🌱)'
-        match = re.search(pattern, content, re.DOTALL)
+        section = crop_section(content, crop)
         
-        if match:
-            crop_section = match.group(0)
-            
-            # Проверяем pH условия
+        if section:
+            # Проверяем pH условия (phBelow/phAbove в строках правил)
             ph_triggers = 0
-            ph_conditions = re.findall(r'if \(pH\s*([<>]=?)\s*([\d.]+)F\)', crop_section)
+            ph_conditions = [({"Below": "<", "Above": ">"}[op], value)
+                             for op, value in re.findall(r'ph(Below|Above)\(([\d.]+)F\)', section)]
             for operator, value in ph_conditions:
                 value = float(value)
                 if operator == "<" and sensor_values["ph"] < value:
@@ -153,8 +156,9 @@ def test_realistic_conditions():
             # Проверяем NPK условия
             npk_triggers = 0
             for nutrient in ["nitrogen", "phosphorus", "potassium"]:
-                npk_pattern = rf'if \(npk\.{nutrient}\s*([<>]=?)\s*([\d.]+)F\)'
-                npk_conditions = re.findall(npk_pattern, crop_section)
+                npk_pattern = rf'\b{TERM_CHANNELS[nutrient]}(Below|Above)\(([\d.]+)F\)'
+                npk_conditions = [({"Below": "<", "Above": ">"}[op], value)
+                                  for op, value in re.findall(npk_pattern, section)]
                 for operator, value in npk_conditions:
                     value = float(value)
                     if operator == "<" and sensor_values[nutrient] < value:
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Тест сравнения ASM по профилям почвы (/api/v2/soils/asm)
+vwcToAsmAllSoils() пересчитывает один VWC для всех 13 почв одним проходом по
+столбцам PWP и 100 / (FC - PWP) и побитово совпадает с vwcToAsm() для каждой почвы;
+маршрут берёт ответ из кэша по поколению показаний
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+DRIVER = r"""
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include "business/sensor_compensation_service.h"
+
+void logDebug(const String&) {}
+
+int main()
+{
+    unsigned mismatches = 0;
+    unsigned checked = 0;
+    // VWC от -0.1 до 1.1 с шагом 1e-5, плюс NaN и бесконечности
+    for (int i = -10000; i <= 110000; ++i)
+    {
+        const float vwc = static_cast<float>(i) * 1e-5F;
+        SoilAsmValues asmBySoil;
+        SensorCompensationService::vwcToAsmAllSoils(vwc, asmBySoil);
+        for (size_t soil = 0; soil < SOIL_TYPE_COUNT; ++soil)
+        {
+            const float single = SensorCompensationService::vwcToAsm(vwc, static_cast<SoilType>(soil));
+            mismatches += memcmp(&single, &asmBySoil[soil], sizeof(float)) != 0;
+            ++checked;
+        }
+    }
+    for (const float vwc : {NAN, INFINITY, -INFINITY})
+    {
+        SoilAsmValues asmBySoil;
+        SensorCompensationService::vwcToAsmAllSoils(vwc, asmBySoil);
+        for (size_t soil = 0; soil < SOIL_TYPE_COUNT; ++soil)
+        {
+            const float single = SensorCompensationService::vwcToAsm(vwc, static_cast<SoilType>(soil));
+            mismatches += memcmp(&single, &asmBySoil[soil], sizeof(float)) != 0;
+            ++checked;
+        }
+    }
+    printf("checked %u mismatches %u\n", checked, mismatches);
+    return 0;
+}
+"""
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def test_batch_matches_single_soil():
+    """Пакетный пересчёт побитово совпадает с vwcToAsm() для каждой почвы"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка сервиса пропущена")
+        return
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(DRIVER)
+        program = os.path.join(output_dir, "soil_asm_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O2", "-DARDUINO=10819", "-Itest/web_bench/shim",
+                                 "-Iinclude", "-Isrc", driver, "src/business/sensor_compensation_service.cpp",
+                                 "-o", program], cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=60)
+        assert result.returncode == 0, result.stderr
+
+    _, checked, _, mismatches = result.stdout.split()
+    assert int(checked) == (120001 + 3) * 13, checked
+    assert int(mismatches) == 0, result.stdout
+
+
+def test_route_is_cached_per_generation():
+    """Маршрут подключён, ответ пересобирается только при новом поколении или смене профиля"""
+    routes = read("src", "web", "routes_data.cpp")
+    assert "webServer.on(API_V2_SOILS_ASM, HTTP_GET, sendSoilAsmComparison);" in routes
+    builder = routes[routes.index("const String& getCachedSoilAsmJson()"):routes.index("void sendSoilAsmComparison()")]
+    assert "soilAsmCache.generation == generation" in builder
+    assert "SensorCompensationService::vwcToAsmAllSoils(" in builder
+    assert "vwcToAsm(" not in builder.replace("vwcToAsmAllSoils(", "")
+    handler = routes[routes.index("void sendSoilAsmComparison()"):routes.index("const String& getCachedSensorJson()")]
+    assert "sendNotModifiedIfMatch" in handler
+    assert 'API_V2_SOILS_ASM API_V2_ROOT "/soils/asm"' in read("include", "jxct_strings.h")
+
+    header = read("src", "business", "sensor_compensation_service.h")
+    batch = header[header.index("static void vwcToAsmAllSoils("):header.index("static float asmToVwc(")]
+    assert "log" not in batch and "* SOIL_ASM_COLUMNS.asmScale[i]" in batch
+
+
+def main():
+    print("🧪 Тестирование сравнения ASM по профилям почвы")
+    print("=" * 60)
+
+    tests = [
+        test_batch_matches_single_soil,
+        test_route_is_cached_per_generation,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+Тест потока показаний Server-Sent Events (src/web/routes_events.cpp)
+Зеркало рассылки: кадр собирается один раз на поколение, лимит потоков даёт 503,
+в паузах идёт пинг, мёртвые соединения освобождают слот, кадр пишется только в свободное
+окно TCP (не поместившийся ждёт следующего цикла, застрявший поток закрывается); раздел /readings
+подписывается на EventSource с откатом на опрос
+"""
+
+import json
+import os
+import sys
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+SSE_MAX_CLIENTS = 4
+SSE_KEEPALIVE_INTERVAL_MS = 15000
+SSE_RETRY_MS = 5000
+SSE_STALL_TIMEOUT_MS = 30000
+
+
+class FakeClient:
+    def __init__(self, alive=True, window=1 << 16):
+        self.alive = alive
+        self.window = window
+        self.received = ""
+
+    def connected(self):
+        return self.alive
+
+    def available_for_write(self):
+        return self.window
+
+    def write(self, data):
+        if not self.alive:
+            return 0
+        assert len(data) <= self.window, "запись сверх окна TCP блокирует цикл"
+        self.received += data
+        return len(data)
+
+    def stop(self):
+        self.alive = False
+
+
+class EventStreams:
+    """Зеркало eventStreams / handleEventStream() / handleSensorEvents()"""
+
+    def __init__(self, sensor_json):
+        self.sensor_json = sensor_json
+        self.slots = [None] * SSE_MAX_CLIENTS
+        self.builds = 0
+
+    def frame(self, generation):
+        self.builds += 1
+        return f"event: reading\nid: {generation}\ndata: {self.sensor_json(generation)}\n\n"
+
+    def write(self, slot, data, now):
+        client = slot["client"]
+        if client.available_for_write() < len(data):
+            if now - slot["last"] >= SSE_STALL_TIMEOUT_MS:
+                client.stop()
+            return False
+        if client.write(data) != len(data):
+            client.stop()
+            return False
+        slot["last"] = now
+        return True
+
+    def open(self, client, generation, now):
+        for index, slot in enumerate(self.slots):
+            if slot is None or not slot["client"].connected():
+                slot = {"client": client, "last": now, "generation": generation - 1}
+                self.slots[index] = slot
+                if self.write(slot, f"retry: {SSE_RETRY_MS}\n\n" + self.frame(generation), now):
+                    slot["generation"] = generation
+                return 200
+        return 503
+
+    def tick(self, generation, now):
+        frame = None
+        for slot in self.slots:
+            if slot is None or not slot["client"].connected():
+                continue
+            if slot["generation"] != generation:
+                frame = frame or self.frame(generation)
+                if self.write(slot, frame, now):
+                    slot["generation"] = generation
+            elif now - slot["last"] >= SSE_KEEPALIVE_INTERVAL_MS:
+                self.write(slot, ": ping\n\n", now)
+
+
+def parse_events(stream):
+    """Разбор text/event-stream так, как это делает EventSource"""
+    events = []
+    for block in stream.split("\n\n"):
+        fields = {}
+        for line in block.split("\n"):
+            if not line or line.startswith(":"):
+                continue
+            name, _, value = line.partition(": ")
+            fields[name] = value
+        if "data" in fields:
+            events.append((fields.get("event", "message"), int(fields["id"]), json.loads(fields["data"])))
+    return events
+
+
+def sensor_json(generation):
+    return json.dumps({"temperature": "21.5", "generation": generation,
+                       "crop_specific_recommendations": "строка 1\nстрока 2"}, separators=(",", ":"))
+
+
+def test_frame_per_generation_fanned_out():
+    """Новое поколение - один кадр на все потоки; повтор поколения не рассылается"""
+    streams = EventStreams(sensor_json)
+    clients = [FakeClient() for _ in range(3)]
+    for client in clients:
+        assert streams.open(client, 1, 0) == 200
+    builds_after_open = streams.builds
+    streams.tick(2, 1000)
+    streams.tick(2, 2000)
+    assert streams.builds == builds_after_open + 1
+    for client in clients:
+        events = parse_events(client.received)
+        assert [event[1] for event in events] == [1, 2]
+        assert events[-1][0] == "reading" and events[-1][2]["generation"] == 2
+        assert events[-1][2]["crop_specific_recommendations"] == "строка 1\nстрока 2"
+
+
+def test_client_cap():
+    """Сверх SSE_MAX_CLIENTS - 503; закрытый поток освобождает слот"""
+    streams = EventStreams(sensor_json)
+    clients = [FakeClient() for _ in range(SSE_MAX_CLIENTS)]
+    for client in clients:
+        assert streams.open(client, 1, 0) == 200
+    assert streams.open(FakeClient(), 1, 0) == 503
+    clients[2].alive = False
+    assert streams.open(FakeClient(), 1, 0) == 200
+
+
+def test_keepalive_ping_and_dead_clients():
+    """Без новых данных - пинг по интервалу; ошибка записи закрывает поток"""
+    streams = EventStreams(sensor_json)
+    live, dying = FakeClient(), FakeClient()
+    streams.open(live, 1, 0)
+    streams.open(dying, 1, 0)
+    streams.tick(1, SSE_KEEPALIVE_INTERVAL_MS - 1)
+    assert ": ping" not in live.received
+    dying.write = lambda data: 0
+    streams.tick(1, SSE_KEEPALIVE_INTERVAL_MS)
+    assert live.received.endswith(": ping\n\n")
+    assert not dying.connected()
+
+
+def test_full_window_skips_without_blocking():
+    """Кадр не помещается в окно - пропуск без записи; освободилось - уходит новейшее поколение"""
+    streams = EventStreams(sensor_json)
+    slow, fast = FakeClient(window=0), FakeClient()
+    streams.open(slow, 1, 0)
+    streams.open(fast, 1, 0)
+    assert slow.received == ""
+    streams.tick(2, 1000)
+    streams.tick(3, 2000)
+    assert slow.received == "" and slow.connected()
+    assert [event[1] for event in parse_events(fast.received)] == [1, 2, 3]
+    slow.window = 1 << 16
+    streams.tick(3, 3000)
+    assert [event[1] for event in parse_events(slow.received)] == [3]
+
+
+def test_stalled_stream_closed():
+    """Окно не освобождается SSE_STALL_TIMEOUT_MS - поток закрывается и освобождает слот"""
+    streams = EventStreams(sensor_json)
+    stalled = FakeClient()
+    streams.open(stalled, 1, 0)
+    stalled.window = 0
+    streams.tick(2, SSE_STALL_TIMEOUT_MS - 1)
+    assert stalled.connected()
+    streams.tick(2, SSE_STALL_TIMEOUT_MS)
+    assert not stalled.connected()
+
+
+def test_source_checks_window_before_write():
+    """routes_events.cpp: availableForWrite() перед write(), поколение фиксируется только после записи"""
+    with open(os.path.join(PROJECT_DIR, "src", "web", "routes_events.cpp"), encoding="utf-8") as handle:
+        source = handle.read()
+    body = source[source.index("bool writeFrame("):source.index("String buildReadingFrame")]
+    assert body.index("availableForWrite()") < body.index("stream.client.write(")
+    assert "SSE_STALL_TIMEOUT_MS" in body
+    loop = source[source.index("void handleSensorEvents()"):]
+    assert "if (writeFrame(stream, frame))" in loop
+    with open(os.path.join(PROJECT_DIR, "include", "jxct_constants.h"), encoding="utf-8") as handle:
+        assert f"SSE_STALL_TIMEOUT_MS = {SSE_STALL_TIMEOUT_MS};" in handle.read()
+
+
+def test_readings_page_uses_event_source():
+    """Раздел /readings (app.js) подписан на API_EVENTS и откатывается на опрос"""
+    with open(os.path.join(PROJECT_DIR, "src", "web", "assets", "app.js"), encoding="utf-8") as handle:
+        source = handle.read()
+    assert "const API_EVENTS = '/api/v1/events';" in source
+    assert "new EventSource(API_EVENTS)" in source
+    assert "events.addEventListener('reading'" in source
+    assert "startPolling();" in source
+    assert "setInterval(updateSensor, 5000)" not in source
+    with open(os.path.join(PROJECT_DIR, "include", "jxct_strings.h"), encoding="utf-8") as handle:
+        assert '#define API_EVENTS API_ROOT "/events"' in handle.read()
+
+
+def main():
+    print("🧪 Тестирование потока Server-Sent Events")
+    print("=" * 60)
+
+    tests = [
+        test_frame_per_generation_fanned_out,
+        test_client_cap,
+        test_keepalive_ping_and_dead_clients,
+        test_full_window_skips_without_blocking,
+        test_stalled_stream_closed,
+        test_source_checks_window_before_write,
+        test_readings_page_uses_event_source,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
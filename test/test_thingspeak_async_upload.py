@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+Тест фоновой отправки ThingSpeak (очередь заданий + очередь результатов)
+Медленная локальная подмена ThingSpeak отвечает с задержкой; цикл loop()
+не должен блокироваться, а результат применяется только через handleThingSpeak()
+"""
+
+import queue
+import sys
+import threading
+import time
+import urllib.error
+import urllib.request
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+THINGSPEAK_UPLOAD_QUEUE_LENGTH = 2
+SERVER_DELAY_S = 0.5
+LOOP_TICK_S = 0.01  # vTaskDelay(10) в loop()
+
+
+class SlowThingSpeak(BaseHTTPRequestHandler):
+    status = 202
+
+    def do_POST(self):  # noqa: N802 - имя задано http.server
+        self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        time.sleep(SERVER_DELAY_S)  # медленный DNS/TLS/сервер
+        body = b'{"success":true}'
+        self.send_response(self.status)
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def log_message(self, *_args):
+        pass
+
+
+class AsyncUploader:
+    """Зеркало thingspeak_client.cpp: sendDataToThingSpeak() ставит задание, задача шлёт, loop() применяет"""
+
+    def __init__(self, url):
+        self.url = url
+        self.jobs = queue.Queue(THINGSPEAK_UPLOAD_QUEUE_LENGTH)
+        self.results = queue.Queue(THINGSPEAK_UPLOAD_QUEUE_LENGTH)
+        self.upload_in_flight = False
+        self.last_publish = "0"
+        self.last_error = ""
+        threading.Thread(target=self._task, daemon=True).start()
+
+    def _task(self):
+        while True:
+            body = self.jobs.get()
+            try:
+                request = urllib.request.Request(self.url, data=body, method="POST")
+                with urllib.request.urlopen(request, timeout=5) as response:
+                    code = response.status
+            except urllib.error.HTTPError as e:
+                code = e.code
+            self.results.put(code)
+
+    def can_send(self):
+        return not self.upload_in_flight
+
+    def send(self, body):
+        try:
+            self.jobs.put_nowait(body)
+        except queue.Full:
+            return False
+        self.upload_in_flight = True
+        return True
+
+    def handle(self, now_ms):
+        while True:
+            try:
+                code = self.results.get_nowait()
+            except queue.Empty:
+                return
+            self.upload_in_flight = False
+            if code in (200, 202):
+                self.last_publish = str(now_ms)
+                self.last_error = ""
+            else:
+                self.last_error = f"HTTP {code}"
+
+
+def run_loop(uploader, iterations, send_every):
+    """Крутит loop() и возвращает максимальную длительность итерации"""
+    worst = 0.0
+    for i in range(iterations):
+        started = time.perf_counter()
+        if i % send_every == 0 and uploader.can_send():
+            assert uploader.send(b'{"updates":[]}')
+        uploader.handle(int(time.monotonic() * 1000))
+        worst = max(worst, time.perf_counter() - started)
+        time.sleep(LOOP_TICK_S)
+    return worst
+
+
+def start_server(status):
+    SlowThingSpeak.status = status
+    server = ThreadingHTTPServer(("127.0.0.1", 0), SlowThingSpeak)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server, f"http://127.0.0.1:{server.server_address[1]}/bulk_update.json"
+
+
+def test_loop_never_blocks_on_slow_upload():
+    """Итерация loop() остаётся короткой, пока сервер отвечает 0.5с"""
+    server, url = start_server(202)
+    try:
+        uploader = AsyncUploader(url)
+        worst = run_loop(uploader, iterations=120, send_every=10)
+        assert worst < SERVER_DELAY_S / 10, f"loop() заблокирован на {worst * 1000:.0f} мс"
+        assert uploader.last_publish != "0"
+        assert uploader.last_error == ""
+    finally:
+        server.shutdown()
+
+
+def test_single_upload_in_flight():
+    """Пока задание выполняется, canSendToThingSpeak() не ставит новое"""
+    server, url = start_server(202)
+    try:
+        uploader = AsyncUploader(url)
+        assert uploader.send(b"{}")
+        assert not uploader.can_send()
+        deadline = time.monotonic() + 5
+        while uploader.upload_in_flight and time.monotonic() < deadline:
+            uploader.handle(0)
+            time.sleep(LOOP_TICK_S)
+        assert uploader.can_send()
+    finally:
+        server.shutdown()
+
+
+def test_error_status_reaches_loop():
+    """Ошибка сервера попадает в getThingSpeakLastError() через очередь результатов"""
+    server, url = start_server(429)
+    try:
+        uploader = AsyncUploader(url)
+        run_loop(uploader, iterations=80, send_every=100)
+        assert uploader.last_error == "HTTP 429"
+        assert uploader.last_publish == "0"
+    finally:
+        server.shutdown()
+
+
+def main():
+    print("🧪 Тестирование фоновой отправки ThingSpeak")
+    print("=" * 60)
+
+    tests = [
+        test_loop_never_blocks_on_slow_upload,
+        test_single_upload_in_flight,
+        test_error_status_reaches_loop,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,726 @@
+#!/usr/bin/env python3
+"""
+Тест пакетной отправки ThingSpeak (bulk_update.json)
+Поднимает локальную подмену ThingSpeak на http.server и проверяет пакеты,
+сформированные по той же схеме, что и thingspeak_client.cpp:
+кольцевой буфер сэмплов, метки времени из millis() + NTP, повтор при ошибке,
+досылка по одному сэмплу после 400 на пакет.
+Сам thingspeak_client.cpp собирается g++ с подменённой сессией исходящих запросов:
+HTTPS через TLS-клиент, метки времени пакета, сохранение буфера при 429, досылка
+после 400 (зеркало сверяется с ним) и число запросов за час работы
+"""
+
+import functools
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import urllib.error
+import urllib.request
+from datetime import datetime, timezone
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+# Константы из include/jxct_constants.h
+THINGSPEAK_BULK_MAX_SAMPLES = 32
+THINGSPEAK_BULK_SAMPLE_MIN_MS = 10000
+THINGSPEAK_BULK_HTTP_ACCEPTED = 202
+CONFIG_THINGSPEAK_MIN = 20000
+
+API_KEY = "ABCDEFGHIJKLMNOP"
+CHANNEL_ID = 123456
+CREATED_AT_RE = re.compile(r"^\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2} \+0000$")
+ISO_CREATED_AT_RE = re.compile(r"^\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}Z$")
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+# Драйвер включает thingspeak_client.cpp целиком: фоновую задачу заменяет pumpUpload(),
+# сессия исходящих запросов записывает запросы и отвечает по сценарию
+NATIVE_DRIVER = r"""
+#include <Arduino.h>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+// Однопоточные очереди FreeRTOS
+struct HostQueue
+{
+    size_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    (void)length;
+    return new HostQueue{itemSize, {}};
+}
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait)
+{
+    (void)wait;
+    auto* hostQueue = static_cast<HostQueue*>(queue);
+    const auto* bytes = static_cast<const uint8_t*>(item);
+    hostQueue->items.emplace_back(bytes, bytes + hostQueue->itemSize);
+    return pdTRUE;
+}
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t wait)
+{
+    (void)wait;
+    auto* hostQueue = static_cast<HostQueue*>(queue);
+    if (hostQueue->items.empty())
+    {
+        return pdFALSE;
+    }
+    memcpy(item, hostQueue->items.front().data(), hostQueue->itemSize);
+    hostQueue->items.pop_front();
+    return pdTRUE;
+}
+
+#include "thingspeak_client.cpp"
+
+// TLS-клиент без сети: рукопожатие проверяется в test_tls_session_resumption.py
+UplinkTlsClient::UplinkTlsClient(const char* name) : clientName(name) {}
+UplinkTlsClient::~UplinkTlsClient() {}
+int UplinkTlsClient::connect(const char* host, uint16_t port)
+{
+    (void)host;
+    (void)port;
+    return 1;
+}
+int UplinkTlsClient::connect(const char* host, uint16_t port, int32_t timeoutMs)
+{
+    (void)timeoutMs;
+    return connect(host, port);
+}
+void UplinkTlsClient::stop() {}
+
+unsigned long hostMillis = 1000;
+unsigned long millis()
+{
+    return hostMillis;
+}
+void delay(unsigned long ms)
+{
+    hostMillis += ms;
+}
+void logError(const String&) {}
+void logWarn(const String&) {}
+void logInfo(const String&) {}
+void logDebug(const String&) {}
+void logSuccess(const String&) {}
+void logSystem(const String&) {}
+
+Config config;
+ModbusSensorData sensorData;
+bool wifiConnected = true;
+WiFiClass WiFi;
+WiFiClient espClient;
+WiFiUDP hostUdp;
+NTPClient* timeClient = nullptr;
+
+// Показания сценария заведомо в диапазоне; проверка диапазонов - в modbus_sensor.cpp
+bool validateSensorData(ModbusSensorData& data)
+{
+    return data.valid;
+}
+
+namespace SensorProcessing
+{
+SoilType getSoilType(int profileIndex)
+{
+    (void)profileIndex;
+    return SoilType::LOAM;
+}
+}  // namespace SensorProcessing
+
+// Сессия исходящих запросов: запись запросов и ответы по сценарию
+std::deque<std::pair<int, std::string>> scriptedReplies;
+UplinkHttpSession::UplinkHttpSession() {}
+int UplinkHttpSession::post(WiFiClient& transport, const char* url, const char* contentType, const String& body,
+                            String& response, uint16_t timeoutMs, const char* authorization, TickType_t lockWait)
+{
+    (void)timeoutMs;
+    (void)authorization;
+    (void)lockWait;
+    const std::pair<int, std::string> reply = scriptedReplies.front();
+    scriptedReplies.pop_front();
+    response = reply.second.c_str();
+    const bool secure = dynamic_cast<UplinkTlsClient*>(&transport) != nullptr;
+    printf("post %d %s %s %s %s\n", reply.first, secure ? "tls" : "plain", url, contentType, body.c_str());
+    return reply.first;
+}
+String UplinkHttpSession::getStatsJson() const
+{
+    return "{}";
+}
+UplinkHttpSession& getUplinkSession()
+{
+    static UplinkHttpSession session;
+    return session;
+}
+
+void setReading(int index)
+{
+    sensorData.valid = true;
+    sensorData.temperature = 20.0F + static_cast<float>(index);
+    sensorData.humidity = 30.0F;
+    sensorData.ec = 1200.0F;
+    sensorData.ph = 6.5F;
+    sensorData.nitrogen = static_cast<float>(100 + index);
+    sensorData.phosphorus = 50.0F;
+    sensorData.potassium = 200.0F;
+}
+
+// Одна отправка: задание из очереди выполняется как в thingSpeakUploadTask(), результат - в loop()
+void sendWithReply(int code, const char* response)
+{
+    scriptedReplies.emplace_back(code, response);
+    if (!sendDataToThingSpeak())
+    {
+        printf("skipped\n");
+        return;
+    }
+    ThingSpeakUploadJob job;
+    while (xQueueReceive(uploadJobQueue, &job, 0) == pdTRUE)
+    {
+        const ThingSpeakUploadResult result = {performUpload(job)};
+        delete job.body;
+        xQueueSend(uploadResultQueue, &result, 0);
+    }
+    handleThingSpeak();
+    printf("buffered %zu\n", getThingSpeakBufferedSamples());
+}
+
+int main()
+{
+    config.flags.thingSpeakEnabled = 1;
+    strlcpy(config.thingSpeakApiKey, "ABCDEFGHIJKLMNOP", sizeof(config.thingSpeakApiKey));
+    strlcpy(config.thingSpeakChannelId, "123456", sizeof(config.thingSpeakChannelId));
+    timeClient = new NTPClient(hostUdp, "pool.ntp.org");
+    setupThingSpeak(espClient);
+
+    printf("scenario bulk-timestamps\n");
+    for (int i = 0; i < 6; ++i)
+    {
+        setReading(i);
+        queueThingSpeakSample();
+        hostMillis += THINGSPEAK_BULK_SAMPLE_MIN_MS;
+    }
+    printf("epoch %lu\n", timeClient->getEpochTime());
+    sendWithReply(THINGSPEAK_BULK_HTTP_ACCEPTED, "{\"success\":true}");
+
+    printf("scenario retained-on-429\n");
+    for (int i = 20; i < 23; ++i)
+    {
+        setReading(i);
+        queueThingSpeakSample();
+        hostMillis += THINGSPEAK_BULK_SAMPLE_MIN_MS;
+    }
+    sendWithReply(429, "0");  // слишком часто - буфер сохраняется целиком
+    setReading(23);
+    queueThingSpeakSample();
+    hostMillis += THINGSPEAK_BULK_SAMPLE_MIN_MS;
+    sendWithReply(THINGSPEAK_BULK_HTTP_ACCEPTED, "{\"success\":true}");
+
+    printf("scenario rejected-batch\n");
+    for (int i = 0; i < 4; ++i)
+    {
+        setReading(i);
+        queueThingSpeakSample();
+        hostMillis += THINGSPEAK_BULK_SAMPLE_MIN_MS;
+    }
+    sendWithReply(400, "0");   // пакет из 4 сэмплов отклонён
+    sendWithReply(200, "17");  // сэмпл 100 дослан
+    sendWithReply(400, "0");   // сэмпл 101 отклонён и поодиночке - удалён
+    sendWithReply(200, "18");  // сэмпл 102
+    sendWithReply(200, "19");  // сэмпл 103
+
+    printf("scenario back-to-bulk\n");
+    for (int i = 10; i < 12; ++i)
+    {
+        setReading(i);
+        queueThingSpeakSample();
+        hostMillis += THINGSPEAK_BULK_SAMPLE_MIN_MS;
+    }
+    sendWithReply(THINGSPEAK_BULK_HTTP_ACCEPTED, "{\"success\":true}");
+
+    // Время не синхронизировано: одиночная запись текущего состояния, буфер ждёт синхронизации
+    printf("scenario unsynced\n");
+    timeClient->setTimeOffset(-static_cast<long>(time(nullptr)));
+    for (int i = 30; i < 33; ++i)
+    {
+        setReading(i);
+        queueThingSpeakSample();
+        hostMillis += THINGSPEAK_BULK_SAMPLE_MIN_MS;
+    }
+    sendWithReply(200, "20");
+    sendWithReply(200, "21");
+    timeClient->setTimeOffset(0);
+    sendWithReply(THINGSPEAK_BULK_HTTP_ACCEPTED, "{\"success\":true}");
+
+    // Час работы: сэмпл каждые 10с, отправка по интервалу канала через canSendToThingSpeak()
+    printf("scenario hour\n");
+    config.thingSpeakInterval = 60000;
+    hostMillis += config.thingSpeakInterval;
+    for (int tick = 0; tick < 3600000 / static_cast<int>(THINGSPEAK_BULK_SAMPLE_MIN_MS); ++tick)
+    {
+        setReading(tick % 10);
+        queueThingSpeakSample();
+        if (canSendToThingSpeak())
+        {
+            sendWithReply(THINGSPEAK_BULK_HTTP_ACCEPTED, "{\"success\":true}");
+        }
+        hostMillis += THINGSPEAK_BULK_SAMPLE_MIN_MS;
+    }
+    printf("buffered %zu\n", getThingSpeakBufferedSamples());
+    return 0;
+}
+"""
+
+
+class ThingSpeakStandIn(BaseHTTPRequestHandler):
+    """Подмена api.thingspeak.com: принимает bulk_update.json и проверяет схему"""
+
+    requests_log = []
+    force_status = None
+    rejected_nitrogen = set()  # записи с таким field5 отклоняются с 400
+
+    def do_POST(self):  # noqa: N802 - имя задано http.server
+        length = int(self.headers.get("Content-Length", 0))
+        raw = self.rfile.read(length)
+        if self.path == "/update":
+            self.single_update(raw)
+            return
+        status = THINGSPEAK_BULK_HTTP_ACCEPTED
+        try:
+            assert self.path == f"/channels/{CHANNEL_ID}/bulk_update.json", self.path
+            assert self.headers.get("Content-Type") == "application/json"
+            payload = json.loads(raw)
+            assert payload["write_api_key"] == API_KEY
+            assert 0 < len(payload["updates"]) <= 960
+            for update in payload["updates"]:
+                assert CREATED_AT_RE.match(update["created_at"]), update["created_at"]
+                for field in range(1, 9):
+                    assert f"field{field}" in update
+                assert update["field5"] not in self.rejected_nitrogen
+            self.requests_log.append(payload)
+        except (AssertionError, KeyError, ValueError):
+            status = 400
+        if self.force_status is not None:
+            status = self.force_status
+
+        body = b'{"success":true}' if status == THINGSPEAK_BULK_HTTP_ACCEPTED else b"0"
+        self.reply(status, body)
+
+    def single_update(self, raw):
+        """POST /update: одна запись формой; 200 с entry_id"""
+        status = 200
+        try:
+            assert self.headers.get("Content-Type") == "application/x-www-form-urlencoded"
+            form = dict(pair.split("=", 1) for pair in raw.decode().split("&"))
+            assert form["api_key"] == API_KEY
+            assert ISO_CREATED_AT_RE.match(form["created_at"]), form["created_at"]
+            assert int(form["field5"]) not in self.rejected_nitrogen
+            self.requests_log.append(form)
+        except (AssertionError, KeyError, ValueError):
+            status = 400
+        if self.force_status is not None:
+            status = self.force_status
+        self.reply(status, str(len(self.requests_log)).encode() if status == 200 else b"0")
+
+    def reply(self, status, body):
+        self.send_response(status)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def log_message(self, *_args):
+        pass
+
+
+class BulkUploader:
+    """Зеркало логики буфера и bulk-отправки из thingspeak_client.cpp"""
+
+    def __init__(self, base_url):
+        self.base_url = base_url
+        self.samples = []
+        self.last_sample_time = 0
+        self.requests_sent = 0
+        self.single_fallback = 0  # singleSampleFallback: сэмплы отклонённого пакета, досылаемые по одному
+        self.sent_log = []        # (вид, field5 отправленных сэмплов, сэмплов в буфере после ответа)
+
+    def queue_sample(self, now_ms, reading):
+        """queueThingSpeakSample(): не чаще THINGSPEAK_BULK_SAMPLE_MIN_MS, вытеснение старейшего"""
+        if self.samples and (now_ms - self.last_sample_time) < THINGSPEAK_BULK_SAMPLE_MIN_MS:
+            return False
+        if len(self.samples) == THINGSPEAK_BULK_MAX_SAMPLES:
+            self.drop(1)
+        self.samples.append((now_ms, reading))
+        self.last_sample_time = now_ms
+        return True
+
+    def build_body(self, epoch_now, now_ms, count):
+        """buildBulkBody(): created_at = epochNow - (nowMs - capturedMs) / 1000"""
+        entries = []
+        for captured_ms, r in self.samples[:count]:
+            sample_epoch = epoch_now - (now_ms - captured_ms) // 1000
+            created_at = datetime.fromtimestamp(sample_epoch, tz=timezone.utc).strftime("%Y-%m-%d %H:%M:%S +0000")
+            entries.append(
+                '{"created_at":"%s","field1":%.2f,"field2":%.2f,"field3":%.2f,"field4":%.2f,'
+                '"field5":%d,"field6":%d,"field7":%d,"field8":"%d"}'
+                % (created_at, r["t"], r["asm"], r["ec"], r["ph"], r["n"], r["p"], r["k"], captured_ms)
+            )
+        return '{"write_api_key":"%s","updates":[%s]}' % (API_KEY, ",".join(entries))
+
+    def build_oldest_sample_body(self, epoch_now, now_ms):
+        """buildOldestSampleBody(): форма /update со своей меткой created_at в ISO 8601"""
+        captured_ms, r = self.samples[0]
+        sample_epoch = epoch_now - (now_ms - captured_ms) // 1000
+        created_at = datetime.fromtimestamp(sample_epoch, tz=timezone.utc).strftime("%Y-%m-%dT%H:%M:%SZ")
+        return ("api_key=%s&created_at=%s&field1=%.2f&field2=%.2f&field3=%.2f&field4=%.2f&field5=%d&field6=%d"
+                "&field7=%d&field8=%d" % (API_KEY, created_at, r["t"], r["asm"], r["ec"], r["ph"], r["n"], r["p"],
+                                          r["k"], captured_ms))
+
+    def drop(self, count):
+        """dropBulkSamples(): счётчик досылки не больше буфера"""
+        del self.samples[:count]
+        self.single_fallback = min(self.single_fallback, len(self.samples))
+
+    def flush(self, epoch_now, now_ms):
+        """sendDataToThingSpeak() + applyUploadResult(): 202/200 удаляет отправленное, 400 на пакет переводит
+        его в досылку по одному, 400 на одиночный сэмпл удаляет только его, прочие ошибки сохраняют буфер"""
+        if self.single_fallback > 0 and self.samples:
+            kind, count = "sample", 1
+            url = f"{self.base_url}/update"
+            body = self.build_oldest_sample_body(epoch_now, now_ms)
+            content_type = "application/x-www-form-urlencoded"
+        else:
+            kind, count = "bulk", len(self.samples)
+            url = f"{self.base_url}/channels/{CHANNEL_ID}/bulk_update.json"
+            body = self.build_body(epoch_now, now_ms, count)
+            content_type = "application/json"
+        nitrogen = [r["n"] for _, r in self.samples[:count]]
+        request = urllib.request.Request(url, data=body.encode(), headers={"Content-Type": content_type},
+                                         method="POST")
+        self.requests_sent += 1
+        try:
+            with urllib.request.urlopen(request, timeout=5) as response:
+                status = response.status
+        except urllib.error.HTTPError as e:
+            status = e.code
+
+        delivered = status in (200, THINGSPEAK_BULK_HTTP_ACCEPTED)
+        if delivered:
+            if kind == "sample":
+                self.single_fallback -= 1
+            self.drop(count)
+        elif status == 400:
+            if kind == "bulk" and count > 1:
+                self.single_fallback = count
+            else:
+                self.single_fallback = max(0, self.single_fallback - 1)
+                self.drop(1)
+        self.sent_log.append((kind, nitrogen, len(self.samples)))
+        return delivered
+
+
+def make_reading(i):
+    return {"t": 20.0 + i * 0.1, "asm": 55.5, "ec": 1200.0, "ph": 6.5, "n": 100 + i, "p": 50, "k": 200}
+
+
+def start_stand_in():
+    ThingSpeakStandIn.requests_log = []
+    ThingSpeakStandIn.force_status = None
+    ThingSpeakStandIn.rejected_nitrogen = set()
+    server = HTTPServer(("127.0.0.1", 0), ThingSpeakStandIn)
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    thread.start()
+    return server, f"http://127.0.0.1:{server.server_address[1]}"
+
+
+def test_bulk_batch_carries_per_sample_timestamps():
+    """Сэмплы с шагом 10с уходят одним запросом с собственными метками времени"""
+    server, base_url = start_stand_in()
+    try:
+        uploader = BulkUploader(base_url)
+        epoch_base = int(time.time())
+        for i in range(6):
+            assert uploader.queue_sample(i * THINGSPEAK_BULK_SAMPLE_MIN_MS, make_reading(i))
+        now_ms = 5 * THINGSPEAK_BULK_SAMPLE_MIN_MS
+        assert uploader.flush(epoch_base, now_ms)
+
+        assert uploader.requests_sent == 1
+        assert len(ThingSpeakStandIn.requests_log) == 1
+        updates = ThingSpeakStandIn.requests_log[0]["updates"]
+        assert len(updates) == 6
+        stamps = [datetime.strptime(u["created_at"], "%Y-%m-%d %H:%M:%S %z").timestamp() for u in updates]
+        deltas = [b - a for a, b in zip(stamps, stamps[1:])]
+        assert deltas == [10] * 5, f"Ожидался шаг 10с (суб-минутное разрешение): {deltas}"
+        assert stamps[-1] == epoch_base
+        assert updates[2]["field5"] == 102
+        assert not uploader.samples
+    finally:
+        server.shutdown()
+
+
+def test_sample_spacing_is_enforced():
+    """queueThingSpeakSample() отбрасывает сэмплы чаще THINGSPEAK_BULK_SAMPLE_MIN_MS"""
+    uploader = BulkUploader("http://127.0.0.1:9")
+    assert uploader.queue_sample(0, make_reading(0))
+    assert not uploader.queue_sample(THINGSPEAK_BULK_SAMPLE_MIN_MS - 1, make_reading(1))
+    assert uploader.queue_sample(THINGSPEAK_BULK_SAMPLE_MIN_MS, make_reading(2))
+    assert len(uploader.samples) == 2
+
+
+def test_failed_batch_is_retained_and_resent():
+    """При 429 буфер сохраняется и уходит целиком со следующей попыткой"""
+    server, base_url = start_stand_in()
+    try:
+        uploader = BulkUploader(base_url)
+        for i in range(3):
+            uploader.queue_sample(i * THINGSPEAK_BULK_SAMPLE_MIN_MS, make_reading(i))
+        ThingSpeakStandIn.force_status = 429
+        assert not uploader.flush(1_700_000_000, 30000)
+        assert len(uploader.samples) == 3
+
+        uploader.queue_sample(30000, make_reading(3))
+        ThingSpeakStandIn.force_status = None
+        assert uploader.flush(1_700_000_030, 60000)
+        assert len(ThingSpeakStandIn.requests_log[-1]["updates"]) == 4
+        assert not uploader.samples
+    finally:
+        server.shutdown()
+
+
+def test_ring_buffer_drops_oldest_when_full():
+    """Переполнение буфера вытесняет самые старые сэмплы"""
+    uploader = BulkUploader("http://127.0.0.1:9")
+    total = THINGSPEAK_BULK_MAX_SAMPLES + 5
+    for i in range(total):
+        uploader.queue_sample(i * THINGSPEAK_BULK_SAMPLE_MIN_MS, make_reading(i))
+    assert len(uploader.samples) == THINGSPEAK_BULK_MAX_SAMPLES
+    assert uploader.samples[0][0] == 5 * THINGSPEAK_BULK_SAMPLE_MIN_MS
+
+
+def test_full_batch_fits_device_buffers():
+    """Полный пакет укладывается в резерв String (48 + 176 байт на сэмпл)"""
+    uploader = BulkUploader("http://127.0.0.1:9")
+    for i in range(THINGSPEAK_BULK_MAX_SAMPLES):
+        uploader.queue_sample(i * THINGSPEAK_BULK_SAMPLE_MIN_MS, {
+            "t": -39.99, "asm": 100.0, "ec": 9999.99, "ph": 13.99, "n": 9999, "p": 9999, "k": 9999})
+    now_ms = 4_000_000_000
+    body = uploader.build_body(1_700_000_000, now_ms, THINGSPEAK_BULK_MAX_SAMPLES)
+    assert len(body) <= 48 + THINGSPEAK_BULK_MAX_SAMPLES * 176
+    json.loads(body)
+
+
+@functools.lru_cache(maxsize=None)
+def run_native_driver():
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(NATIVE_DRIVER)
+        program = os.path.join(output_dir, "thingspeak_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/thingspeak_shim",
+                                 "-Itest/uplink_tls_shim", "-Itest/web_bench/shim", "-Iinclude", "-Isrc",
+                                 driver, "src/business/sensor_compensation_service.cpp", "-o", program],
+                                cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-3000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=60)
+        assert result.returncode == 0, result.stderr
+    return tuple(result.stdout.splitlines())
+
+
+def scenario_lines(lines, name):
+    """Строки драйвера между "scenario <name>" и следующим сценарием"""
+    start = lines.index(f"scenario {name}") + 1
+    end = next((i for i in range(start, len(lines)) if lines[i].startswith("scenario ")), len(lines))
+    return list(lines[start:end])
+
+
+def parse_posts(lines):
+    """Строки драйвера: (код, url, тип, тело, буфер после ответа); все запросы - через TLS-клиент"""
+    posts = []
+    for line, after in zip(lines, lines[1:]):
+        if line.startswith("post "):
+            code, transport, url, content_type, body = line.split(" ", 5)[1:]
+            assert transport == "tls", line
+            posts.append((int(code), url, content_type, body, int(after.split()[1])))
+    return posts
+
+
+def bulk_nitrogen(body):
+    return [update["field5"] for update in json.loads(body)["updates"]]
+
+
+def form_nitrogen(body):
+    return int(dict(pair.split("=", 1) for pair in body.split("&"))["field5"])
+
+
+def native_available():
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка клиента пропущена")
+        return False
+    return True
+
+
+def test_native_bulk_over_https_with_timestamps():
+    """thingspeak_client.cpp: пакет уходит по HTTPS через TLS-клиент, метки сэмплов с шагом 10с"""
+    if not native_available():
+        return
+    lines = scenario_lines(run_native_driver(), "bulk-timestamps")
+    epoch = int(lines[0].split()[1])
+    (code, url, content_type, body, buffered), = parse_posts(lines[1:])
+    assert url == f"https://api.thingspeak.com/channels/{CHANNEL_ID}/bulk_update.json", url
+    assert content_type == "application/json" and buffered == 0
+    payload = json.loads(body)
+    assert payload["write_api_key"] == API_KEY
+    assert [update["field5"] for update in payload["updates"]] == [100, 101, 102, 103, 104, 105]
+    stamps = [datetime.strptime(u["created_at"], "%Y-%m-%d %H:%M:%S %z").timestamp() for u in payload["updates"]]
+    assert [b - a for a, b in zip(stamps, stamps[1:])] == [10] * 5, stamps
+    # Последний сэмпл снят за 10с до отправки
+    assert abs(stamps[-1] - (epoch - 10)) <= 1, (stamps[-1], epoch)
+
+
+def test_native_batch_retained_on_429():
+    """thingspeak_client.cpp: при 429 буфер сохраняется и уходит целиком со следующей отправкой"""
+    if not native_available():
+        return
+    posts = parse_posts(scenario_lines(run_native_driver(), "retained-on-429"))
+    assert [(post[0], post[4]) for post in posts] == [(429, 3), (THINGSPEAK_BULK_HTTP_ACCEPTED, 0)], posts
+    assert bulk_nitrogen(posts[0][3]) == [120, 121, 122]
+    assert bulk_nitrogen(posts[1][3]) == [120, 121, 122, 123]
+
+
+def test_native_rejected_batch_falls_back_to_single_samples():
+    """thingspeak_client.cpp: после 400 на пакет сэмплы досылаются по одному, удаляется только отклонённый"""
+    if not native_available():
+        return
+    lines = run_native_driver()
+    assert "skipped" not in lines, lines
+    posts = parse_posts(scenario_lines(lines, "rejected-batch"))
+    assert len(posts) == 5, lines
+
+    code, url, content_type, body, buffered = posts[0]
+    assert (code, content_type) == (400, "application/json") and url.endswith("/bulk_update.json"), posts[0]
+    assert len(json.loads(body)["updates"]) == 4
+    assert buffered == 4, "400 на пакет не должен выбрасывать буфер"
+
+    singles = posts[1:5]
+    for code, url, content_type, body, _ in singles:
+        assert url == "https://api.thingspeak.com/update", url
+        assert content_type == "application/x-www-form-urlencoded", content_type
+        form = dict(pair.split("=", 1) for pair in body.split("&"))
+        assert form["api_key"] == API_KEY
+        assert ISO_CREATED_AT_RE.match(form["created_at"]), form
+    assert [form_nitrogen(post[3]) for post in singles] == [100, 101, 102, 103]
+    assert [post[4] for post in singles] == [3, 2, 1, 0], "удаляется только досланный или отклонённый сэмпл"
+
+    (code, url, _, body, buffered), = parse_posts(scenario_lines(lines, "back-to-bulk"))
+    assert url.endswith("/bulk_update.json") and buffered == 0, url
+    assert bulk_nitrogen(body) == [110, 111]
+
+
+def test_mirror_rejected_batch_matches_native():
+    """Зеркало на подмене ThingSpeak проходит тот же сценарий 400, что и thingspeak_client.cpp"""
+    server, base_url = start_stand_in()
+    try:
+        ThingSpeakStandIn.rejected_nitrogen = {101}
+        uploader = BulkUploader(base_url)
+        for i in range(4):
+            uploader.queue_sample(i * THINGSPEAK_BULK_SAMPLE_MIN_MS, make_reading(i))
+        now_ms = 4 * THINGSPEAK_BULK_SAMPLE_MIN_MS
+        results = [uploader.flush(1_700_000_000, now_ms) for _ in range(5)]
+        assert results == [False, True, False, True, True], results
+        assert not uploader.samples and uploader.single_fallback == 0
+        assert [form["field5"] for form in ThingSpeakStandIn.requests_log] == ["100", "102", "103"]
+
+        uploader.queue_sample(now_ms + THINGSPEAK_BULK_SAMPLE_MIN_MS, make_reading(10))
+        assert uploader.flush(1_700_000_010, now_ms + THINGSPEAK_BULK_SAMPLE_MIN_MS)
+        assert uploader.sent_log[-1] == ("bulk", [110], 0)
+    finally:
+        server.shutdown()
+
+    if not native_available():
+        return
+    native = []
+    for code, url, _, body, buffered in parse_posts(scenario_lines(run_native_driver(), "rejected-batch")):
+        if url.endswith("/bulk_update.json"):
+            native.append(("bulk", bulk_nitrogen(body), buffered))
+        else:
+            native.append(("sample", [form_nitrogen(body)], buffered))
+    assert uploader.sent_log[:5] == native, (uploader.sent_log, native)
+
+
+def test_native_unsynced_write_keeps_buffer():
+    """thingspeak_client.cpp без NTP: запись текущего состояния не выбрасывает буфер, он уходит после синхронизации"""
+    if not native_available():
+        return
+    posts = parse_posts(scenario_lines(run_native_driver(), "unsynced"))
+    assert len(posts) == 3, posts
+    for code, url, content_type, body, buffered in posts[:2]:
+        assert (code, url) == (200, "https://api.thingspeak.com/update"), (code, url)
+        assert "created_at" not in body and form_nitrogen(body) == 132, body
+        assert buffered == 3, "одиночная запись без меток не должна удалять сэмплы буфера"
+    code, url, _, body, buffered = posts[2]
+    assert url.endswith("/bulk_update.json") and buffered == 0, url
+    assert bulk_nitrogen(body) == [130, 131, 132]
+    stamps = [datetime.strptime(u["created_at"], "%Y-%m-%d %H:%M:%S %z").timestamp()
+              for u in json.loads(body)["updates"]]
+    assert [b - a for a, b in zip(stamps, stamps[1:])] == [10] * 2, stamps
+
+
+def test_native_requests_per_hour_reduced():
+    """thingspeak_client.cpp за час: 360 сэмплов каждые 10с уходят 60 пакетами при интервале 60с"""
+    if not native_available():
+        return
+    lines = scenario_lines(run_native_driver(), "hour")
+    posts = parse_posts(lines)
+    requests_per_hour = len(posts)
+    delivered = sum(len(bulk_nitrogen(post[3])) for post in posts)
+    left = int(lines[-1].split()[1])
+    assert requests_per_hour == 3600 * 1000 // (CONFIG_THINGSPEAK_MIN * 3), requests_per_hour
+    assert all(post[1].endswith("/bulk_update.json") and post[0] == THINGSPEAK_BULK_HTTP_ACCEPTED for post in posts)
+    # Раньше один запрос доставлял одну точку: 60 точек в час; теперь все 360 сэмплов
+    assert delivered + left == 3600 * 1000 // THINGSPEAK_BULK_SAMPLE_MIN_MS, (delivered, left)
+    assert left < 6 and max(len(bulk_nitrogen(post[3])) for post in posts) <= THINGSPEAK_BULK_MAX_SAMPLES
+
+
+def main():
+    print("🧪 Тестирование пакетной отправки ThingSpeak (bulk_update.json)")
+    print("=" * 60)
+
+    tests = [
+        test_bulk_batch_carries_per_sample_timestamps,
+        test_sample_spacing_is_enforced,
+        test_failed_batch_is_retained_and_resent,
+        test_ring_buffer_drops_oldest_when_full,
+        test_full_batch_fits_device_buffers,
+        test_native_bulk_over_https_with_timestamps,
+        test_native_batch_retained_on_429,
+        test_native_rejected_batch_falls_back_to_single_samples,
+        test_mirror_rejected_batch_matches_native,
+        test_native_unsynced_write_keeps_buffer,
+        test_native_requests_per_hour_reduced,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,373 @@
+#!/usr/bin/env python3
+"""
+Тест возобновления TLS-сессий и закрепления корней (uplink_tls_client.cpp)
+Локальный TLS 1.2 сервер (mbedTLS на ESP32 - TLS 1.2) с сертификатом от
+тестового CA. Зеркало UplinkTlsClient хранит сессию на хост и предлагает её
+при следующем подключении; проверяется сокращённое рукопожатие, учёт времени
+полных/возобновлённых рукопожатий и отказ при цепочке от незакреплённого CA.
+Нативная часть собирает uplink_tls_client.cpp g++ с моделью WiFiClientSecure
+ядра 2.0.x (test/uplink_tls_shim): stop() освобождает ssl_conf.ca_chain, а
+последовательность рукопожатие/stop/рукопожатие не должна трогать общие корни
+"""
+
+import hashlib
+import os
+import shutil
+import socket
+import ssl
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+SESSION_MAX_AGE_S = 12 * 3600  # TLS_SESSION_MAX_AGE_MS
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+PRIVATE_LEAF_DER = b"private-ca-leaf-der"
+
+NATIVE_DRIVER = r"""
+#include <WiFi.h>
+#include <arpa/inet.h>
+#include <cstdio>
+#include <string>
+#include "uplink_tls_anchors.h"
+#include "uplink_tls_client.h"
+
+WiFiClass WiFi;
+unsigned long millis()
+{
+    static unsigned long now = 0;
+    return now += 10;
+}
+void delay(unsigned long) {}
+void logError(const String&) {}
+void logWarn(const String&) {}
+void logInfo(const String&) {}
+void logDebug(const String&) {}
+void logSuccess(const String&) {}
+void logSystem(const String&) {}
+
+const char PRIVATE_CA[] = "-----BEGIN CERTIFICATE-----\nPRIVATE\n-----END CERTIFICATE-----";
+unsigned char privateLeaf[] = "private-ca-leaf-der";
+
+int main(int argc, char** argv)
+{
+    // Слушающий сокет: неблокирующий connect() клиента завершается через backlog
+    const int listener = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    listen(listener, 64);
+    socklen_t length = sizeof(address);
+    getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length);
+    const uint16_t port = ntohs(address.sin_port);
+
+    // Сервер выдан первым закреплённым корнем
+    const std::string anchors(UPLINK_TLS_TRUST_ANCHORS);
+    const size_t end = anchors.find("-----END CERTIFICATE-----") + sizeof("-----END CERTIFICATE-----") - 1;
+    const std::string firstAnchor = anchors.substr(anchors.find("-----BEGIN CERTIFICATE-----"), end);
+    fakeTlsServer.issuerPem = firstAnchor.c_str();
+    fakeTlsServer.leaf.raw = {0x30, sizeof(privateLeaf) - 1, privateLeaf};
+
+    UplinkTlsClient uplink("uplink");
+    auto step = [&](const char* name, UplinkTlsClient& client)
+    {
+        const int connected = client.connect("sink.local", port);
+        printf("%s %d %u %u %u\n", name, connected, fakeTlsServer.fullHandshakes, fakeTlsServer.resumedHandshakes,
+               fakeTlsServer.freedChainUses);
+        client.stop();
+    };
+
+    step("pinned", uplink);
+    step("pinned-resumed", uplink);
+    fakeTlsServer.acceptResumption = false;
+    step("pinned-full-after-stop", uplink);
+    {
+        UplinkTlsClient scoped("scoped");
+        step("scoped", scoped);
+    }
+    step("after-destructor", uplink);
+
+    // Частный CA: закреплённых корней недостаточно
+    fakeTlsServer.issuerPem = PRIVATE_CA;
+    fakeTlsServer.acceptResumption = true;
+    fakeTlsServer.knownCount = 0;  // Другой сервер - прежние сессии ему неизвестны
+    step("private-default", uplink);
+
+    UplinkTlsTrust trust = {};
+    for (size_t i = 0; i < trust.fingerprint.size(); ++i)
+    {
+        sscanf(argv[1] + i * 2, "%2hhx", &trust.fingerprint[i]);
+    }
+    trust.hasFingerprint = true;
+    uplink.setTrust(trust);
+    step("private-fingerprint", uplink);
+    step("private-fingerprint-resumed", uplink);
+
+    trust.fingerprint[0] ^= 1U;
+    uplink.setTrust(trust);
+    step("private-wrong-fingerprint", uplink);
+
+    trust = {};
+    trust.insecure = true;
+    uplink.setTrust(trust);
+    step("private-insecure", uplink);
+
+    uplink.setTrust(UplinkTlsTrust{});
+    step("private-default-again", uplink);
+
+    printf("stats %u %u %u\n", uplink.getStats().handshakes, uplink.getStats().resumed,
+           uplink.getStats().pinRejections);
+    (void)argc;
+    return 0;
+}
+"""
+
+
+def make_ca(workdir, name):
+    key = os.path.join(workdir, f"{name}.key")
+    crt = os.path.join(workdir, f"{name}.pem")
+    subprocess.run(["openssl", "req", "-x509", "-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:prime256v1",
+                    "-nodes", "-keyout", key, "-out", crt, "-days", "2", "-subj", f"/CN={name}",
+                    "-addext", "basicConstraints=critical,CA:TRUE",
+                    "-addext", "keyUsage=critical,keyCertSign,cRLSign"],
+                   check=True, capture_output=True)
+    return key, crt
+
+
+def make_server_cert(workdir, ca_key, ca_crt):
+    key = os.path.join(workdir, "server.key")
+    csr = os.path.join(workdir, "server.csr")
+    crt = os.path.join(workdir, "server.pem")
+    ext = os.path.join(workdir, "server.ext")
+    with open(ext, "w", encoding="utf-8") as handle:
+        handle.write("subjectAltName=DNS:localhost,IP:127.0.0.1\nbasicConstraints=CA:FALSE\n")
+    subprocess.run(["openssl", "req", "-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:prime256v1", "-nodes",
+                    "-keyout", key, "-out", csr, "-subj", "/CN=localhost"], check=True, capture_output=True)
+    subprocess.run(["openssl", "x509", "-req", "-in", csr, "-CA", ca_crt, "-CAkey", ca_key, "-CAcreateserial",
+                    "-out", crt, "-days", "1", "-extfile", ext], check=True, capture_output=True)
+    return key, crt
+
+
+class LocalTlsServer:
+    """TLS 1.2 сервер с session tickets: на каждое подключение отвечает 'ok'"""
+
+    def __init__(self, cert, key):
+        self.context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        self.context.minimum_version = ssl.TLSVersion.TLSv1_2
+        self.context.maximum_version = ssl.TLSVersion.TLSv1_2
+        self.context.load_cert_chain(cert, key)
+        self.sock = socket.create_server(("127.0.0.1", 0))
+        self.port = self.sock.getsockname()[1]
+        self.running = True
+        threading.Thread(target=self._serve, daemon=True).start()
+
+    def _serve(self):
+        while self.running:
+            try:
+                conn, _ = self.sock.accept()
+            except OSError:
+                return
+            try:
+                with self.context.wrap_socket(conn, server_side=True) as tls:
+                    tls.recv(64)
+                    tls.sendall(b"ok")
+            except (ssl.SSLError, OSError):
+                pass
+
+    def close(self):
+        self.running = False
+        self.sock.close()
+
+
+class UplinkTlsClient:
+    """Зеркало UplinkTlsClient: кэш сессий по (host, port), проверка по закреплённым корням"""
+
+    session_cache = {}
+    contexts = {}  # корни разбираются один раз и общие для всех клиентов
+
+    def __init__(self, anchors):
+        if anchors not in self.contexts:
+            context = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+            context.maximum_version = ssl.TLSVersion.TLSv1_2
+            context.load_verify_locations(anchors)  # MBEDTLS_SSL_VERIFY_REQUIRED + ca_chain
+            self.contexts[anchors] = context
+        self.context = self.contexts[anchors]
+        self.stats = {"handshakes": 0, "resumed": 0, "failures": 0, "pin_rejections": 0,
+                      "total_full_ms": 0.0, "total_resumed_ms": 0.0}
+
+    def request(self, host, port):
+        key = (host, port)
+        cached = self.session_cache.get(key)
+        if cached is not None and time.monotonic() - cached[1] > SESSION_MAX_AGE_S:
+            cached = None
+        raw = socket.create_connection(("127.0.0.1", port), timeout=5)
+        started = time.perf_counter()
+        try:
+            tls = self.context.wrap_socket(raw, server_hostname=host,
+                                           session=cached[0] if cached else None)
+        except ssl.SSLCertVerificationError:
+            self.session_cache.pop(key, None)
+            self.stats["failures"] += 1
+            self.stats["pin_rejections"] += 1
+            raw.close()
+            return None
+        elapsed = (time.perf_counter() - started) * 1000
+        with tls:
+            tls.sendall(b"GET")
+            payload = tls.recv(64)
+            resumed = tls.session_reused
+            self.stats["handshakes"] += 1
+            if resumed:
+                self.stats["resumed"] += 1
+                self.stats["total_resumed_ms"] += elapsed
+            else:
+                self.stats["total_full_ms"] += elapsed
+            # Сохраняем и после возобновления: сервер мог выдать новый ticket
+            self.session_cache[key] = (tls.session, time.monotonic())
+        return payload, resumed
+
+
+def with_server(test):
+    def wrapper():
+        with tempfile.TemporaryDirectory() as workdir:
+            ca_key, ca_crt = make_ca(workdir, "PinnedRoot")
+            _, other_ca = make_ca(workdir, "OtherRoot")
+            key, crt = make_server_cert(workdir, ca_key, ca_crt)
+            server = LocalTlsServer(crt, key)
+            UplinkTlsClient.session_cache = {}
+            try:
+                test(server, ca_crt, other_ca)
+            finally:
+                server.close()
+    wrapper.__name__ = test.__name__
+    return wrapper
+
+
+@with_server
+def test_second_connection_is_resumed(server, anchors, _other):
+    """Первое подключение - полное рукопожатие, последующие - возобновлённые"""
+    client = UplinkTlsClient(anchors)
+    results = [client.request("localhost", server.port) for _ in range(5)]
+    assert all(payload == b"ok" for payload, _ in results)
+    assert [resumed for _, resumed in results] == [False, True, True, True, True]
+    assert client.stats["handshakes"] == 5 and client.stats["resumed"] == 4
+
+
+@with_server
+def test_session_shared_between_clients(server, anchors, _other):
+    """Кэш общий: сессия, полученная клиентом OTA, возобновляется клиентом приёмников"""
+    ota = UplinkTlsClient(anchors)
+    uplink = UplinkTlsClient(anchors)
+    assert ota.request("localhost", server.port)[1] is False
+    assert uplink.request("localhost", server.port)[1] is True
+
+
+@with_server
+def test_handshake_timing_recorded(server, anchors, _other):
+    """Время полных и возобновлённых рукопожатий учитывается раздельно"""
+    client = UplinkTlsClient(anchors)
+    for _ in range(20):
+        client.request("localhost", server.port)
+    full = client.stats["total_full_ms"]
+    resumed_avg = client.stats["total_resumed_ms"] / client.stats["resumed"]
+    assert full > 0 and resumed_avg > 0
+    print(f"   полное: {full:.2f} мс, возобновлённое (среднее): {resumed_avg:.2f} мс")
+
+
+@with_server
+def test_unpinned_root_rejected(server, _anchors, other_ca):
+    """Цепочка не привязана к закреплённому корню - подключение отвергается"""
+    client = UplinkTlsClient(other_ca)
+    assert client.request("localhost", server.port) is None
+    assert client.stats["pin_rejections"] == 1
+    assert ("localhost", server.port) not in UplinkTlsClient.session_cache
+
+
+@with_server
+def test_hostname_mismatch_rejected(server, anchors, _other):
+    """Закреплённый корень не отменяет проверку имени хоста"""
+    client = UplinkTlsClient(anchors)
+    assert client.request("github.com", server.port) is None
+
+
+def test_firmware_anchors_parse():
+    """Закреплённые корни из uplink_tls_anchors.h - корректные сертификаты CA"""
+    path = os.path.join(os.path.dirname(__file__), "..", "src", "uplink_tls_anchors.h")
+    with open(path, encoding="utf-8") as handle:
+        pem = "".join(line.strip().rstrip(";")[1:-3] + "\n" for line in handle if line.strip().startswith('"'))
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+    context.load_verify_locations(cadata=pem)
+    subjects = [dict(item[0] for item in cert["subject"])["commonName"] for cert in context.get_ca_certs()]
+    assert "USERTrust ECC Certification Authority" in subjects
+    assert "DigiCert Global Root G2" in subjects
+    assert len(subjects) == 6
+
+
+def test_native_handshake_stop_handshake():
+    """uplink_tls_client.cpp: stop() ядра не освобождает общие корни; отпечаток и явный отказ от проверки"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - нативная проверка пропущена")
+        return
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(NATIVE_DRIVER)
+        program = os.path.join(output_dir, "tls_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/uplink_tls_shim",
+                                 "-Itest/web_bench/shim", "-Iinclude", "-Isrc", driver, "src/uplink_tls_client.cpp",
+                                 "-o", program], cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program, hashlib.sha256(PRIVATE_LEAF_DER).hexdigest()], capture_output=True,
+                                text=True, timeout=60)
+        assert result.returncode == 0, result.stderr
+
+    rows = {line.split()[0]: [int(value) for value in line.split()[1:]] for line in result.stdout.splitlines()}
+    # имя: подключено, полных, возобновлённых, рукопожатий с освобождённой цепочкой
+    assert rows["pinned"] == [1, 1, 0, 0], rows
+    assert rows["pinned-resumed"] == [1, 1, 1, 0], rows
+    assert rows["pinned-full-after-stop"] == [1, 2, 1, 0], rows
+    assert rows["scoped"] == [1, 3, 1, 0], rows
+    assert rows["after-destructor"] == [1, 4, 1, 0], rows
+    assert rows["private-default"][0] == 0, rows
+    assert rows["private-fingerprint"][0] == 1, rows
+    assert rows["private-fingerprint-resumed"][:3] == [1, 6, 2], rows
+    # Смена доверия: сессия другого режима не предлагается, полная проверка отвергает отпечаток
+    assert rows["private-wrong-fingerprint"][:3] == [0, 7, 2], rows
+    assert rows["private-insecure"][0] == 1, rows
+    assert rows["private-default-again"][:3] == [0, 9, 2], rows
+    assert all(values[-1] == 0 for name, values in rows.items() if name != "stats"), rows
+    assert rows["stats"] == [7, 2, 3], rows
+
+
+def main():
+    print("🧪 Тестирование возобновления TLS-сессий и закрепления корней")
+    print("=" * 60)
+
+    tests = [
+        test_second_connection_is_resumed,
+        test_session_shared_between_clients,
+        test_handshake_timing_recorded,
+        test_unpinned_root_rejected,
+        test_hostname_mismatch_rejected,
+        test_firmware_anchors_parse,
+        test_native_handshake_stop_handshake,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
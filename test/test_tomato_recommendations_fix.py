@@ -12,15 +12,15 @@ def test_tomato_conditions_fix():
     """Тест исправленных условий для томата"""
     print("🍅 ТЕСТ: Исправленные условия для томата")
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
-    with open(crop_engine_path, 'r', encoding='utf-8') as f:
+    crop_rules_path = "include/business/crop_rules.h"
+    with open(crop_rules_path, 'r', encoding='utf-8') as f:
         content = f.read()
     
-    # Находим секцию томата
+    # Находим правила томата
     tomato_section = re.search(
-        r'if \(cropName == "tomato".*?\}(?=\s*else if|\s*// 🌱)', 
+        r'(?:^[ \t]*//.*\n)*(?:^[ \t]*when\w+\(CropId::TOMATO, .*\n)+', 
         content, 
-        re.DOTALL
+        re.M
     )
     
     if not tomato_section:
@@ -33,10 +33,10 @@ def test_tomato_conditions_fix():
     
     # Проверяем исправленные условия
     checks = {
-        "pH < 6.5F": "Расширенный диапазон pH (было 6.0, стало 6.5)",
-        "npk.potassium > 200.0F": "Снижен порог калия (было 350, стало 200)", 
-        "npk.nitrogen > 150.0F": "Добавлено условие для азота",
-        "npk.phosphorus < 100.0F": "Добавлено условие для фосфора"
+        "phBelow(6.5F)": "Расширенный диапазон pH (было 6.0, стало 6.5)",
+        "kAbove(200.0F)": "Снижен порог калия (было 350, стало 200)", 
+        "nAbove(150.0F)": "Добавлено условие для азота",
+        "pBelow(100.0F)": "Добавлено условие для фосфора"
     }
     
     results = {}
@@ -95,13 +95,13 @@ def test_expected_recommendations():
     """Тест ожидаемых рекомендаций"""
     print("\n📝 ТЕСТ: Ожидаемые рекомендации для томата")
     
-    crop_engine_path = "src/business/crop_recommendation_engine.cpp"
-    with open(crop_engine_path, 'r', encoding='utf-8') as f:
+    crop_rules_path = "include/business/crop_rules.h"
+    with open(crop_rules_path, 'r', encoding='utf-8') as f:
         content = f.read()
     
-    # Ищем все рекомендации для томата
+    # Ищем все тексты сообщений томата
     tomato_recommendations = re.findall(
-        r'recommendations \+= "🍅[^"]+";', 
+        r'\{MessageId::TOMATO_\w+, "🍅[^"]+"\}', 
         content
     )
     
@@ -0,0 +1,434 @@
+#!/usr/bin/env python3
+"""
+Тест постоянной HTTP-сессии исходящих запросов (uplink_http_session.cpp)
+Локальный HTTP/1.1 сервер считает TCP-подключения; зеркало сессии проверяет
+повторное использование сокета, прозрачное переподключение после закрытия
+сокета сервером и учёт сэкономленного времени подключения; loop() не ждёт сессию,
+занятую фоновой выгрузкой, а статистика читается из снимка под мьютексом.
+Сам uplink_http_session.cpp собирается g++ с моделью HTTPClient: соединения
+разных транспортов живут в пуле и не закрывают друг друга
+"""
+
+import http.client
+import os
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+# Модель HTTPClient ядра: ответ 200, пока транспорт подключён
+HTTP_CLIENT_MODEL = r"""
+#ifndef UPLINK_TEST_HTTP_CLIENT_H
+#define UPLINK_TEST_HTTP_CLIENT_H
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+
+enum followRedirects_t
+{
+    HTTPC_DISABLE_FOLLOW_REDIRECTS,
+    HTTPC_STRICT_FOLLOW_REDIRECTS
+};
+
+class HTTPClient
+{
+   public:
+    void setReuse(bool) {}
+    bool begin(WiFiClient& client, const char*)
+    {
+        transport = &client;
+        return true;
+    }
+    void setTimeout(uint16_t) {}
+    void setFollowRedirects(followRedirects_t) {}
+    void addHeader(const char*, const char*) {}
+    int GET()
+    {
+        return transport->connected() ? 200 : HTTPC_ERROR_CONNECTION_LOST;
+    }
+    int POST(const String&)
+    {
+        return GET();
+    }
+    String getString()
+    {
+        return "ok";
+    }
+    String getLocation()
+    {
+        return String();
+    }
+    void end() {}
+
+   private:
+    WiFiClient* transport = nullptr;
+};
+
+#endif
+"""
+
+SESSION_DRIVER = r"""
+#include <cstdio>
+#include <string>
+#include "uplink_http_session.h"
+
+unsigned long hostMillis = 1000;
+unsigned long millis()
+{
+    return hostMillis;
+}
+void logWarn(const String&) {}
+void logDebug(const String&) {}
+
+// Транспорт с одним сокетом: подключение стоит connectCostMs и считается
+class ModelTransport : public WiFiClient
+{
+   public:
+    explicit ModelTransport(unsigned long cost) : connectCostMs(cost) {}
+    int connect(const char* host, uint16_t port) override
+    {
+        (void)port;
+        hostMillis += connectCostMs;
+        ++connects;
+        open = true;
+        peer = host;
+        return 1;
+    }
+    uint8_t connected() override
+    {
+        return open ? 1 : 0;
+    }
+    void stop() override
+    {
+        open = false;
+    }
+
+    unsigned long connectCostMs;
+    unsigned connects = 0;
+    bool open = false;
+    std::string peer;
+};
+
+void report(const char* name, const UplinkHttpSession& session)
+{
+    const UplinkSessionStats stats = session.getStats();
+    printf("%s %u %u %u %u %u\n", name, stats.requests, stats.connects, stats.reusedRequests, stats.savedMs,
+           stats.evictions);
+}
+
+int main()
+{
+    String response;
+    {
+        // ThingSpeak (TLS, 900 мс на рукопожатие) и InfluxDB (30 мс) по очереди
+        UplinkHttpSession session;
+        ModelTransport thingSpeak(900);
+        ModelTransport influx(30);
+        for (int i = 0; i < 5; ++i)
+        {
+            session.post(thingSpeak, "https://api.thingspeak.com/update", "text/plain", "x", response, 1000);
+            session.post(influx, "http://influx.local:8086/api/v2/write", "text/plain", "x", response, 1000);
+        }
+        report("two-sinks", session);
+    }
+    {
+        // Пул на UPLINK_SESSION_SLOTS соединений: лишнее вытесняет давно не использованное
+        UplinkHttpSession session;
+        ModelTransport a(10);
+        ModelTransport b(10);
+        ModelTransport c(10);
+        ModelTransport d(10);
+        session.get(a, "http://a.local/", response, 1000);
+        session.get(b, "http://b.local/", response, 1000);
+        session.get(c, "http://c.local/", response, 1000);
+        session.get(a, "http://a.local/", response, 1000);
+        session.get(d, "http://d.local/", response, 1000);
+        printf("evicted %d %d %d %d\n", a.open, b.open, c.open, d.open);
+        report("pool", session);
+    }
+    {
+        // Один транспорт держит один сокет: смена хоста переподключает его
+        UplinkHttpSession session;
+        ModelTransport ota(500);
+        session.get(ota, "https://github.com/manifest.json", response, 1000);
+        session.get(ota, "https://objects.githubusercontent.com/fw.bin", response, 1000);
+        printf("peer %s\n", ota.peer.c_str());
+        report("host-switch", session);
+    }
+    return 0;
+}
+"""
+
+CONNECTION_LEVEL_ERRORS = (http.client.RemoteDisconnected, ConnectionResetError, BrokenPipeError,
+                           http.client.CannotSendRequest, http.client.BadStatusLine)
+
+
+class KeepAliveStandIn(BaseHTTPRequestHandler):
+    """HTTP/1.1 подмена с поддержкой keep-alive; close_after - закрыть сокет после N ответов"""
+
+    protocol_version = "HTTP/1.1"
+    connections = 0
+    close_after = None
+
+    def setup(self):
+        super().setup()
+        KeepAliveStandIn.connections += 1
+        self.served = 0
+
+    def _reply(self, body):
+        self.served += 1
+        self.send_response(200)
+        self.send_header("Content-Type", "text/plain")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+        if self.close_after is not None and self.served >= self.close_after:
+            self.close_connection = True
+
+    def do_POST(self):  # noqa: N802 - имя задано http.server
+        length = int(self.headers.get("Content-Length", 0))
+        self.rfile.read(length)
+        self._reply(b"42")
+
+    def do_GET(self):  # noqa: N802 - имя задано http.server
+        self._reply(b'{"version":"0.0.0"}')
+
+    def log_message(self, *_args):
+        pass
+
+
+class UplinkSession:
+    """Зеркало UplinkHttpSession: явное замеряемое подключение, повтор на свежем сокете"""
+
+    MAX_ATTEMPTS = 2
+
+    def __init__(self):
+        self.conn = None
+        self.active = None
+        self.stats = {"requests": 0, "reused_requests": 0, "connects": 0,
+                      "reconnect_retries": 0, "total_connect_ms": 0.0, "saved_ms": 0.0}
+
+    def avg_connect_ms(self):
+        return self.stats["total_connect_ms"] / self.stats["connects"] if self.stats["connects"] else 0.0
+
+    def close(self):
+        if self.conn is not None:
+            self.conn.close()
+        self.conn = None
+        self.active = None
+
+    def _connect(self, host, port):
+        if self.active == (host, port) and self.conn is not None and self.conn.sock is not None:
+            return True
+        self.close()
+        started = time.perf_counter()
+        self.conn = http.client.HTTPConnection(host, port, timeout=5)
+        self.conn.connect()
+        self.stats["total_connect_ms"] += (time.perf_counter() - started) * 1000
+        self.stats["connects"] += 1
+        self.active = (host, port)
+        return False
+
+    def request(self, host, port, method, path, body=None):
+        for attempt in range(self.MAX_ATTEMPTS):
+            reused = self._connect(host, port)
+            try:
+                self.conn.request(method, path, body=body)
+                response = self.conn.getresponse()
+                payload = response.read()
+            except CONNECTION_LEVEL_ERRORS:
+                self.stats["requests"] += 1
+                if reused and attempt + 1 < self.MAX_ATTEMPTS:
+                    self.stats["reconnect_retries"] += 1
+                    self.close()
+                    continue
+                self.close()
+                return -1, b""
+            self.stats["requests"] += 1
+            if reused:
+                self.stats["reused_requests"] += 1
+                self.stats["saved_ms"] += self.avg_connect_ms()
+            if response.will_close:
+                self.close()
+            return response.status, payload
+        return -1, b""
+
+
+def start_stand_in(close_after=None):
+    KeepAliveStandIn.connections = 0
+    KeepAliveStandIn.close_after = close_after
+    server = ThreadingHTTPServer(("127.0.0.1", 0), KeepAliveStandIn)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server, server.server_address[1]
+
+
+def test_socket_reused_across_publishes():
+    """10 публикаций - одно TCP-подключение"""
+    server, port = start_stand_in()
+    try:
+        session = UplinkSession()
+        for _ in range(10):
+            status, payload = session.request("127.0.0.1", port, "POST", "/update", body=b"api_key=X&field1=1")
+            assert status == 200 and payload == b"42"
+        assert KeepAliveStandIn.connections == 1
+        assert session.stats["connects"] == 1
+        assert session.stats["reused_requests"] == 9
+        assert session.stats["saved_ms"] >= 0
+        session.close()
+    finally:
+        server.shutdown()
+
+
+def test_transparent_reconnect_after_server_close():
+    """Сервер закрывает сокет после каждых 3 ответов - запросы не теряются"""
+    server, port = start_stand_in(close_after=3)
+    try:
+        session = UplinkSession()
+        for _ in range(9):
+            status, _ = session.request("127.0.0.1", port, "POST", "/update", body=b"x")
+            assert status == 200
+        assert KeepAliveStandIn.connections == 3
+        assert session.stats["connects"] == 3
+        session.close()
+    finally:
+        server.shutdown()
+
+
+def test_stale_socket_is_retried_once():
+    """Сокет закрыт сервером «молча» между запросами - один повтор на свежем сокете"""
+    server, port = start_stand_in()
+    try:
+        session = UplinkSession()
+        assert session.request("127.0.0.1", port, "GET", "/manifest.json")[0] == 200
+        # Имитация закрытия keep-alive сокета сервером по таймауту простоя
+        session.conn.sock.shutdown(socket.SHUT_RDWR)
+        status, payload = session.request("127.0.0.1", port, "GET", "/manifest.json")
+        assert status == 200 and payload.startswith(b"{")
+        assert session.stats["reconnect_retries"] == 1
+        assert session.stats["connects"] == 2
+        session.close()
+    finally:
+        server.shutdown()
+
+
+def run_session_driver():
+    with tempfile.TemporaryDirectory() as output_dir:
+        with open(os.path.join(output_dir, "HTTPClient.h"), "w", encoding="utf-8") as handle:
+            handle.write(HTTP_CLIENT_MODEL)
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(SESSION_DRIVER)
+        program = os.path.join(output_dir, "session_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", f"-I{output_dir}",
+                                 "-Itest/uplink_tls_shim", "-Itest/web_bench/shim", "-Iinclude", "-Isrc", driver,
+                                 "src/uplink_http_session.cpp", "-o", program], cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=60)
+        assert result.returncode == 0, result.stderr
+    return {line.split()[0]: line.split()[1:] for line in result.stdout.splitlines()}
+
+
+def test_native_pool_keeps_each_sink_connection():
+    """uplink_http_session.cpp: сокеты ThingSpeak и InfluxDB живут одновременно; пул вытесняет старейшее"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка сессии пропущена")
+        return
+    rows = run_session_driver()
+    # запросов, подключений, повторных, сэкономлено мс, вытеснений
+    requests, connects, reused, saved_ms, evictions = (int(value) for value in rows["two-sinks"])
+    assert (requests, connects, reused, evictions) == (10, 2, 8, 0), rows["two-sinks"]
+    # Экономия по фактическому подключению каждого соединения, а не по общему среднему
+    assert saved_ms == 4 * 900 + 4 * 30, saved_ms
+
+    assert rows["evicted"] == ["1", "0", "1", "1"], rows["evicted"]
+    assert [int(value) for value in rows["pool"]] == [5, 4, 1, 10, 1], rows["pool"]
+
+    assert rows["peer"] == ["objects.githubusercontent.com"], rows["peer"]
+    assert [int(value) for value in rows["host-switch"]] == [2, 2, 0, 0, 0], rows["host-switch"]
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def test_loop_callers_do_not_wait_for_session():
+    """Ожидание сессии ограничено; OTA откладывается, фоновые задачи ждут; статистика - снимок"""
+    source = read("src", "uplink_http_session.cpp")
+    execute = source[source.index("int UplinkHttpSession::execute("):source.index("int UplinkHttpSession::executeLocked(")]
+    assert "xSemaphoreTake(lock, lockWait) != pdTRUE" in execute
+    assert "return UPLINK_SESSION_BUSY;" in execute
+    assert "portMAX_DELAY" not in execute.replace("xSemaphoreTake(statsLock, portMAX_DELAY)", "")
+    assert "statsSnapshot = stats;" in execute
+    stats_json = source[source.index("String UplinkHttpSession::getStatsJson()"):
+                        source.index("UplinkConnectionSlot* UplinkHttpSession::acquireSlot(")]
+    assert "getStats()" in stats_json and "stats." not in stats_json
+    assert "xSemaphoreTake(statsLock, portMAX_DELAY);" in source
+
+    header = read("src", "uplink_http_session.h")
+    assert header.count("TickType_t lockWait = pdMS_TO_TICKS(UPLINK_SESSION_LOCK_WAIT_MS)") == 2
+    ota = read("src", "ota_manager.cpp")
+    assert "code == UPLINK_SESSION_BUSY" in ota and "return false;" in ota
+    assert "handleOTA() ? 3600000UL : OTA_SESSION_BUSY_RETRY_MS" in read("src", "main.cpp")
+    assert "THINGSPEAK_HTTP_TIMEOUT_MS, nullptr, portMAX_DELAY" in read("src", "thingspeak_client.cpp")
+    sinks = read("src", "uplink_sink.cpp")
+    assert "portMAX_DELAY)};" in sinks
+    assert "*httpTransports[job.transportIndex]" in sinks and "job.transportIndex = transportIndexFor(" in sinks
+
+
+def test_manual_ota_check_reports_busy():
+    """Ручная проверка OTA при занятой сессии отвечает 503 и повторяется из loop()"""
+    ota = read("src", "ota_manager.cpp")
+    trigger = ota[ota.index("bool triggerOtaCheck()"):ota.index("void triggerOtaInstall()")]
+    assert "const bool completed = handleOTA();" in trigger
+    assert "manualCheckRetryPending = !completed;" in trigger and "return completed;" in trigger
+    assert "millis() - manualCheckAttemptMs >= OTA_SESSION_BUSY_RETRY_MS" in trigger
+    assert "retryPendingOtaCheck();" in read("src", "main.cpp")
+
+    route = read("src", "web", "routes_ota.cpp")
+    assert "if (!triggerOtaCheck())" in route and "HTTP_SERVICE_UNAVAILABLE" in route
+    assert "r.status === 503" in route
+
+
+def main():
+    print("🧪 Тестирование keep-alive сессии исходящих запросов")
+    print("=" * 60)
+
+    tests = [
+        test_socket_reused_across_publishes,
+        test_transparent_reconnect_after_server_close,
+        test_stale_socket_is_retried_once,
+        test_native_pool_keeps_each_sink_connection,
+        test_loop_callers_do_not_wait_for_session,
+        test_manual_ota_check_reports_busy,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,373 @@
+#!/usr/bin/env python3
+"""
+Тест подключаемых uplink-приёмников (uplink_sink.cpp)
+Зеркало планировщика проверяет общую очередь сэмплов, кодирование один раз
+на формат, формат InfluxDB line protocol и семантику курсора/повторов/отбраковки.
+Локальный HTTP-сервер принимает пакеты InfluxDB и HTTP JSON
+"""
+
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import threading
+import urllib.request
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+ESCAPE_DRIVER = r"""
+#include <cstdio>
+#include "web_routes.h"
+
+String navHtml()
+{
+    return String();
+}
+const char* getStylesheetHTML()
+{
+    return "";
+}
+const char* getToastHTML()
+{
+    return "";
+}
+
+int main()
+{
+    printf("%s\n", htmlAttrEscape("https://h/api/v2/write?org=a&bucket=b'><script>alert(\"x\")</script>").c_str());
+    printf("%s\n", htmlAttrEscape("AB:CD:EF").c_str());
+    return 0;
+}
+"""
+QUEUE_SIZE = 32  # UPLINK_SAMPLE_QUEUE_SIZE
+MAX_BATCH = 16   # UPLINK_SINK_MAX_BATCH
+
+
+def encode_influx(sample, device="JXCT-TEST"):
+    line = (f"soil,device={device} temperature={sample['t']:.2f},humidity={sample['hv']:.2f},"
+            f"asm={sample['h']:.2f},ec={sample['e']:.1f},ph={sample['p']:.2f},nitrogen={sample['n']:.1f},"
+            f"phosphorus={sample['r']:.1f},potassium={sample['k']:.1f}")
+    if sample["ts"]:
+        line += f" {sample['ts']}"
+    return line
+
+
+def encode_json(sample):
+    return json.dumps({"seq": sample["seq"], "ts": sample["ts"], "t": round(sample["t"], 1),
+                       "h": round(sample["h"], 1), "hv": round(sample["hv"], 1), "e": round(sample["e"]),
+                       "p": round(sample["p"], 1), "n": round(sample["n"]), "r": round(sample["r"]),
+                       "k": round(sample["k"])}, separators=(",", ":"))
+
+
+class Sink:
+    def __init__(self, name, fmt, interval_ms, max_samples, retry=(15000, 600000)):
+        self.name = name
+        self.fmt = fmt
+        self.interval_ms = interval_ms
+        self.max_samples = max_samples
+        self.retry = retry
+        self.results = []  # очередь результатов deliver()
+        self.batches = []
+
+    def deliver(self, payload, count):
+        self.batches.append((payload, count))
+        return self.results.pop(0) if self.results else "SENT"
+
+
+class UplinkScheduler:
+    """Зеркало handleUplinkSinks(): кольцо по сквозному номеру, курсор на приёмник"""
+
+    def __init__(self):
+        self.samples = {}
+        self.next_seq = 1
+        self.count = 0
+        self.encodes = 0
+        self.cache = {}
+        self.sinks = []
+
+    def register(self, sink):
+        self.sinks.append({"sink": sink, "cursor": self.next_seq, "last": 0, "next_attempt": 0,
+                           "failures": 0, "delivered": 0, "lost": 0, "dropped": 0})
+
+    def publish(self, **values):
+        seq = self.next_seq
+        self.next_seq += 1
+        sample = {"seq": seq, "ts": 1700000000 + seq, "t": 21.5, "h": 42.0, "hv": 30.0, "e": 1200.0,
+                  "p": 6.5, "n": 40.0, "r": 20.0, "k": 60.0}
+        sample.update(values)
+        self.samples[seq % QUEUE_SIZE] = sample
+        self.cache = {key: val for key, val in self.cache.items() if key[0] != seq % QUEUE_SIZE}
+        self.count = min(self.count + 1, QUEUE_SIZE)
+
+    def encoded(self, seq, fmt):
+        key = (seq % QUEUE_SIZE, fmt)
+        if key not in self.cache:
+            sample = self.samples[seq % QUEUE_SIZE]
+            self.cache[key] = encode_influx(sample) if fmt == "influx" else encode_json(sample)
+            self.encodes += 1
+        return self.cache[key]
+
+    def payload(self, fmt, first, count):
+        if fmt == "native":
+            return ""
+        parts = [self.encoded(first + i, fmt) for i in range(count)]
+        return "\n".join(parts) if fmt == "influx" else "[" + ",".join(parts) + "]"
+
+    def handle(self, now):
+        oldest = self.next_seq - self.count
+        for state in self.sinks:
+            sink = state["sink"]
+            if state["cursor"] < oldest:
+                state["lost"] += oldest - state["cursor"]
+                state["cursor"] = oldest
+            pending = self.next_seq - state["cursor"]
+            if pending == 0 or now - state["last"] < sink.interval_ms:
+                continue
+            if state["next_attempt"] and now < state["next_attempt"]:
+                continue
+            count = pending if sink.fmt == "native" else min(pending, sink.max_samples)
+            result = sink.deliver(self.payload(sink.fmt, state["cursor"], count), count)
+            if result == "SENT":
+                state.update(cursor=state["cursor"] + count, last=now, next_attempt=0, failures=0)
+                state["delivered"] += count
+            elif result == "DROP":
+                state.update(cursor=state["cursor"] + count, last=now, next_attempt=0)
+                state["dropped"] += count
+            else:
+                state["failures"] += 1
+                base, cap = sink.retry
+                state["next_attempt"] = now + min(base << (state["failures"] - 1), cap)
+
+
+def http_outcome(code):
+    """Зеркало resolveHttpResult()"""
+    if 200 <= code < 300:
+        return "SENT"
+    if 400 <= code < 500 and code not in (408, 429):
+        return "DROP"
+    return "RETRY"
+
+
+def test_each_sample_encoded_once_per_format():
+    """Два приёмника одного формата и один другого - кодирований = сэмплы × форматы"""
+    scheduler = UplinkScheduler()
+    influx_a = Sink("influx_a", "influx", 60000, MAX_BATCH)
+    influx_b = Sink("influx_b", "influx", 60000, MAX_BATCH)
+    json_sink = Sink("http_json", "json", 60000, MAX_BATCH)
+    for sink in (influx_a, influx_b, json_sink):
+        scheduler.register(sink)
+    for _ in range(10):
+        scheduler.publish()
+    scheduler.handle(60000)
+    assert influx_a.batches[0] == influx_b.batches[0]
+    assert scheduler.encodes == 10 * 2
+    assert json.loads(json_sink.batches[0][0])[0]["seq"] == 1
+
+
+def test_influx_line_protocol():
+    """Строка: measurement,tag поля через запятую, метка времени в секундах"""
+    line = encode_influx({"seq": 1, "ts": 1700000000, "t": 21.5, "h": 42.0, "hv": 30.0, "e": 1200.0,
+                          "p": 6.5, "n": 40.0, "r": 20.0, "k": 60.0})
+    measurement, fields, timestamp = line.split(" ")
+    assert measurement == "soil,device=JXCT-TEST"
+    assert dict(item.split("=") for item in fields.split(","))["asm"] == "42.00"
+    assert timestamp == "1700000000"
+    # Без NTP метка не ставится
+    assert len(encode_influx({"seq": 1, "ts": 0, "t": 0, "h": 0, "hv": 0, "e": 0, "p": 0, "n": 0,
+                              "r": 0, "k": 0}).split(" ")) == 2
+
+
+def test_batch_limit_and_cursor():
+    """20 сэмплов при лимите 16 - два пакета, курсор доходит до конца"""
+    scheduler = UplinkScheduler()
+    sink = Sink("influxdb", "influx", 60000, MAX_BATCH)
+    scheduler.register(sink)
+    for _ in range(20):
+        scheduler.publish()
+    scheduler.handle(60000)
+    scheduler.handle(120000)
+    assert [count for _, count in sink.batches] == [16, 4]
+    assert scheduler.sinks[0]["delivered"] == 20
+
+
+def test_retry_backoff_and_drop():
+    """RETRY - экспоненциальная задержка без потери курсора; DROP - пакет пропускается"""
+    scheduler = UplinkScheduler()
+    sink = Sink("http_json", "json", 0, MAX_BATCH, retry=(1000, 4000))
+    sink.results = [http_outcome(503), http_outcome(-1), http_outcome(429), http_outcome(400)]
+    scheduler.register(sink)
+    scheduler.publish()
+    scheduler.handle(1)
+    assert scheduler.sinks[0]["next_attempt"] == 1001
+    scheduler.handle(500)  # задержка ещё не истекла
+    assert len(sink.batches) == 1
+    scheduler.handle(1001)
+    assert scheduler.sinks[0]["next_attempt"] == 1001 + 2000
+    scheduler.handle(3001)
+    assert scheduler.sinks[0]["next_attempt"] == 3001 + 4000  # ограничено maxDelayMs
+    scheduler.handle(7001)
+    state = scheduler.sinks[0]
+    assert state["dropped"] == 1 and state["cursor"] == 2 and len(sink.batches) == 4
+
+
+def test_native_sink_consumes_all_and_overflow_counted():
+    """NATIVE-приёмник поглощает всё ожидающее; вытесненные сэмплы учитываются как потерянные"""
+    scheduler = UplinkScheduler()
+    native = Sink("mqtt", "native", 60000, 1)
+    slow = Sink("influxdb", "influx", 60000, MAX_BATCH)
+    scheduler.register(native)
+    scheduler.register(slow)
+    for _ in range(QUEUE_SIZE + 8):
+        scheduler.publish()
+    slow.results = ["RETRY"]
+    scheduler.handle(60000)
+    assert native.batches == [("", QUEUE_SIZE)]
+    assert scheduler.sinks[0]["lost"] == 8
+    assert scheduler.sinks[1]["lost"] == 8 and scheduler.sinks[1]["delivered"] == 0
+
+
+class CollectorStandIn(BaseHTTPRequestHandler):
+    received = []
+
+    def do_POST(self):  # noqa: N802 - имя задано http.server
+        body = self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        CollectorStandIn.received.append((self.path, self.headers.get("Content-Type"),
+                                          self.headers.get("Authorization"), body))
+        self.send_response(204 if self.path.startswith("/api/v2/write") else 200)
+        self.send_header("Content-Length", "0")
+        self.end_headers()
+
+    def log_message(self, *_args):
+        pass
+
+
+def test_http_sinks_against_local_collector():
+    """Пакеты InfluxDB и HTTP JSON принимаются сервером; 204 считается успехом"""
+    CollectorStandIn.received = []
+    server = ThreadingHTTPServer(("127.0.0.1", 0), CollectorStandIn)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    base = f"http://127.0.0.1:{server.server_address[1]}"
+    try:
+        scheduler = UplinkScheduler()
+        for _ in range(3):
+            scheduler.publish()
+
+        def post(path, content_type, payload, authorization=None):
+            headers = {"Content-Type": content_type}
+            if authorization:
+                headers["Authorization"] = authorization
+            request = urllib.request.Request(base + path, data=payload.encode(), headers=headers)
+            with urllib.request.urlopen(request, timeout=5) as response:
+                return http_outcome(response.status)
+
+        assert post("/api/v2/write?org=o&bucket=b&precision=s", "text/plain; charset=utf-8",
+                    scheduler.payload("influx", 1, 3), "Token secret") == "SENT"
+        assert post("/ingest", "application/json", scheduler.payload("json", 1, 3)) == "SENT"
+
+        influx, http_json = CollectorStandIn.received
+        assert influx[2] == "Token secret"
+        assert len(influx[3].decode().split("\n")) == 3
+        assert http_json[2] is None
+        assert [item["seq"] for item in json.loads(http_json[3])] == [1, 2, 3]
+    finally:
+        server.shutdown()
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def test_adapters_report_real_result():
+    """MQTT и ThingSpeak возвращают фактический итог публикации, а не всегда SENT"""
+    builtin = read("src", "uplink_sinks_builtin.cpp")
+    mqtt = builtin[builtin.index("class MqttSink"):builtin.index("class ThingSpeakSink")]
+    assert "requestSensorDataPublish();" in mqtt and "switch (published)" in mqtt
+    assert "case MqttPublishResult::NOT_CONNECTED:" in mqtt and "case MqttPublishResult::FAILED:" in mqtt
+    assert "result = UplinkDeliveryResult::RETRY;" in mqtt
+
+    thingspeak = builtin[builtin.index("class ThingSpeakSink"):]
+    assert "UplinkDeliveryResult::PENDING : UplinkDeliveryResult::RETRY" in thingspeak
+    assert "takeThingSpeakUploadOutcome(delivered)" in thingspeak
+    assert "return UplinkDeliveryResult::SENT;" not in thingspeak
+
+    scheduler = read("src", "uplink_sink.cpp")
+    loop = scheduler[scheduler.index("void handleUplinkSinks()"):]
+    assert loop.index("sink->takeDeliveryResult(deferred)") < loop.index("if (state.inFlight)")
+
+    client = read("src", "thingspeak_client.cpp")
+    assert "uploadOutcomeDelivered = applyUploadResult(" in client
+
+
+def test_influx_token_not_rendered():
+    """Токен InfluxDB не попадает в HTML; пустое поле сохраняет прежний токен"""
+    routes = read("src", "web", "routes_main.cpp")
+    assert "String(config.influxToken)" not in routes
+    assert "name='influx_token' autocomplete='new-password'" in routes
+    save = routes[routes.index('webServer.hasArg("influx_token_clear")'):]
+    save = save[:save.index("}", save.index("strlcpy(config.influxToken"))]
+    assert 'webServer.arg("influx_token").length() > 0' in save
+
+
+def test_form_values_attribute_escaped():
+    """URL, отпечаток и прочие значения формы экранируются одним htmlAttrEscape() - без разрыва атрибута"""
+    routes = read("src", "web", "routes_main.cpp")
+    for field in ("influxUrl", "httpJsonUrl", "uplinkTlsFingerprint", "ssid", "mqttServer", "ntpServer"):
+        assert f"htmlAttrEscape(config.{field})" in routes, field
+        assert f"String(config.{field})" not in routes, field
+
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка htmlAttrEscape() пропущена")
+        return
+    with tempfile.TemporaryDirectory() as output_dir:
+        driver = os.path.join(output_dir, "driver.cpp")
+        with open(driver, "w", encoding="utf-8") as handle:
+            handle.write(ESCAPE_DRIVER)
+        program = os.path.join(output_dir, "escape_driver")
+        result = subprocess.run(["g++", "-std=gnu++17", "-O1", "-DARDUINO=10819", "-Itest/web_bench/shim",
+                                 "-Iinclude", "-Isrc", driver, "src/web/web_templates.cpp", "-o", program],
+                                cwd=PROJECT_DIR, capture_output=True, text=True)
+        assert result.returncode == 0, result.stderr[-2000:]
+        result = subprocess.run([program], capture_output=True, text=True, timeout=60)
+        assert result.returncode == 0, result.stderr
+    escaped, plain = result.stdout.splitlines()
+    assert escaped == ("https://h/api/v2/write?org=a&amp;bucket=b&#39;&gt;&lt;script&gt;alert(&quot;x&quot;)"
+                       "&lt;/script&gt;"), escaped
+    assert plain == "AB:CD:EF"
+
+
+def main():
+    print("🧪 Тестирование uplink-приёмников")
+    print("=" * 60)
+
+    tests = [
+        test_each_sample_encoded_once_per_format,
+        test_influx_line_protocol,
+        test_batch_limit_and_cursor,
+        test_retry_backoff_and_drop,
+        test_native_sink_consumes_all_and_overflow_counted,
+        test_http_sinks_against_local_collector,
+        test_adapters_report_real_result,
+        test_influx_token_not_rendered,
+        test_form_values_attribute_escaped,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
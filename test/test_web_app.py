@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""
+Тест панели устройства (src/web/assets/app.*, src/web/routes_app.cpp)
+Оболочка собирается со ссылками на актуальные версии ресурсов; /readings,
+/calibration и /service больше не собираются на устройстве; поля начальных
+данных, которые читает app.js, отдаёт /api/v1/bootstrap; разделы рисуются
+скриптом в node с минимальной заменой DOM
+"""
+
+import gzip
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def generated_asset(symbol):
+    match = re.search(rf"{symbol}_GZ\[\] PROGMEM = \{{(.*?)\}};", read("src", "web", "web_assets_generated.cpp"), re.S)
+    data = bytes(int(byte, 16) for byte in re.findall(r"0x([0-9a-f]{2})", match.group(1)))
+    return gzip.decompress(data).decode("utf-8")
+
+
+def header_define(name):
+    return re.search(rf'#define {name} "(.*)"', read("include", "web_assets_generated.h")).group(1)
+
+
+def test_shell_links_current_assets():
+    """Оболочка ссылается на версионные URL CSS и скриптов, плейсхолдеров не осталось"""
+    shell = generated_asset("WEB_ASSET_APP_HTML")
+    for symbol in ("WEB_ASSET_UI_CSS", "WEB_ASSET_UI_JS", "WEB_ASSET_APP_JS"):
+        assert header_define(f"{symbol}_URL") in shell, symbol
+    assert "{{" not in shell and "<!--" not in shell
+    assert "id='app'" in shell and "id='nav'" in shell
+    assert "WEB_ASSET_APP_JS_PATH" in read("src", "web", "routes_static.cpp")
+
+
+def test_pages_not_built_on_device():
+    """Разделы панели отдают одну оболочку; сборщики страниц удалены"""
+    app = read("src", "web", "routes_app.cpp")
+    pages = re.search(r"APP_PAGES\[\] = \{(.*?)\};", app).group(1)
+    assert re.findall(r'"(/\w+)"', pages) == ["/readings", "/calibration", "/service"]
+    assert "sendNotModifiedIfMatch(WEB_ASSET_APP_HTML_ETAG)" in app
+
+    data = read("src", "web", "routes_data.cpp")
+    service = read("src", "web", "routes_service.cpp")
+    calibration = read("src", "web", "routes_calibration.cpp")
+    assert '"/readings", HTTP_GET' not in data and '"/calibration", HTTP_GET' not in data
+    assert '"/service", HTTP_GET' not in service
+    assert "handleCalibrationPage" not in calibration and "ChunkedPageWriter" not in calibration
+    assert "setupAppRoutes();" in read("src", "wifi_manager.cpp")
+
+
+def bootstrap_keys():
+    """Ключи верхнего уровня документа sendBootstrapJson()"""
+    app = read("src", "web", "routes_app.cpp")
+    handler = app[app.index("void sendBootstrapJson()"):app.index("}  // namespace")]
+    keys = set(re.findall(r'doc\["(\w+)"\]', handler))
+    keys.update(re.findall(r'createNestedObject\("(\w+)"\)', handler))
+    return keys
+
+
+def test_bootstrap_covers_script():
+    """Каждое поле boot.*, которое читает app.js, есть в ответе bootstrap"""
+    script = read("src", "web", "assets", "app.js")
+    used = set(re.findall(r"\bboot\.(\w+)", script))
+    assert used and used <= bootstrap_keys(), used - bootstrap_keys()
+    assert "API_BOOTSTRAP API_ROOT \"/bootstrap\"" in read("include", "jxct_strings.h")
+    assert "const API_BOOTSTRAP = '/api/v1/bootstrap';" in script
+    assert "const API_EVENTS = '/api/v1/events';" in script
+
+
+# Минимальная замена DOM: элементы регистрируются по id при присваивании innerHTML
+DOM_STUB = r"""
+const elements = {};
+function makeElement(id) {
+    const element = {
+        id: id, textContent: '', className: '', _html: '', dataset: {}, listeners: {},
+        classList: {set: new Set(), add(c) { this.set.add(c); }, remove(...c) { c.forEach(x => this.set.delete(x)); }},
+        addEventListener(type, fn) { this.listeners[type] = fn; },
+        removeEventListener(type) { delete this.listeners[type]; },
+        get innerHTML() { return this._html; },
+        set innerHTML(html) {
+            this._html = html;
+            for (const match of html.matchAll(/id='([^']+)'/g)) elements[match[1]] = makeElement(match[1]);
+        }
+    };
+    return element;
+}
+elements.app = makeElement('app');
+elements.nav = makeElement('nav');
+global.document = {
+    title: '',
+    getElementById: id => elements[id] || null,
+    addEventListener() {}
+};
+global.window = {addEventListener() {}};
+global.history = {pushState() {}};
+global.location = {pathname: process.argv[2]};
+global.setInterval = () => 1;
+global.clearInterval = () => {};
+global.showToast = () => {};
+const bootstrap = JSON.parse(require('fs').readFileSync(process.argv[3], 'utf-8'));
+global.fetch = () => Promise.resolve({ok: true, json: () => Promise.resolve(bootstrap)});
+"""
+
+DOM_REPORT = r"""
+setTimeout(() => {
+    const report = {};
+    for (const [id, element] of Object.entries(elements)) {
+        report[id] = {text: element.textContent, html: element.innerHTML, cls: [...element.classList.set],
+                      className: element.className};
+    }
+    report.title = document.title;
+    console.log(JSON.stringify(report));
+}, 0);
+"""
+
+BOOTSTRAP = {
+    "device": {"manufacturer": "Eyera", "model": "JXCT-7in1", "version": "3.13.2"},
+    "ap_mode": False, "csrf_token": "abc123", "update_interval_ms": 5000, "crop_id": "tomato",
+    "thingspeak_enabled": True,
+    "status": {"wifi_connected": True, "wifi_ip": "192.168.1.50", "wifi_ssid": "home", "wifi_rssi": -55,
+               "mqtt_enabled": True, "mqtt_connected": False, "mqtt_last_error": "<timeout>",
+               "thingspeak_enabled": True, "thingspeak_last_pub": "0", "thingspeak_last_error": "",
+               "hass_enabled": False, "sensor_ok": True, "sensor_last_error": ""},
+    "calibration": {"success": True, "ph_calibrated": True, "ec_calibrated": False, "temperature_calibrated": False,
+                    "humidity_calibrated": False, "npk_calibrated": True, "calibration_enabled": True},
+    "sensor": {"temperature": "22.4", "humidity": "41.0", "ec": "1116", "ph": "6.4", "nitrogen": "148",
+               "phosphorus": "63", "potassium": "235", "raw_temperature": "22.4", "raw_humidity": "31.5",
+               "raw_ec": "1180", "raw_ph": "6.4", "raw_nitrogen": "145", "raw_phosphorus": "62",
+               "raw_potassium": "230", "irrigation": False, "valid": True,
+               "nutrient_interactions": "⚠️ Высокий N → уменьшить N\n💡 <b>K</b>",
+               "crop_specific_recommendations": "", "rec_temperature": "24.0", "rec_humidity": "80.0",
+               "rec_ec": "2000", "rec_ph": "6.5", "rec_nitrogen": "200", "rec_phosphorus": "80",
+               "rec_potassium": "300", "season": "Осень", "alerts": "", "timestamp": 1792325738,
+               "correction_percentages": {"nitrogen": -10, "phosphorus": 5}},
+}
+
+
+def render(output_dir, path, bootstrap):
+    script = os.path.join(output_dir, "run.js")
+    with open(script, "w", encoding="utf-8") as handle:
+        handle.write(DOM_STUB + generated_asset("WEB_ASSET_APP_JS") + DOM_REPORT)
+    data = os.path.join(output_dir, "bootstrap.json")
+    with open(data, "w", encoding="utf-8") as handle:
+        json.dump(bootstrap, handle, ensure_ascii=False)
+    result = subprocess.run(["node", script, path, data], capture_output=True, text=True, timeout=30)
+    assert result.returncode == 0, result.stderr[-2000:]
+    return json.loads(result.stdout)
+
+
+def test_views_render_from_bootstrap():
+    """Собранный app.js рисует каждый раздел только из начальных данных"""
+    if shutil.which("node") is None:
+        print("   ⚠️ node не найден - отрисовка разделов пропущена")
+        return
+    with tempfile.TemporaryDirectory() as output_dir:
+        readings = render(output_dir, "/readings", BOOTSTRAP)
+        assert "Томаты" in readings["app"]["html"]
+        assert readings["ph_raw"]["text"] == "6.4 (±0.3pH)" and readings["ph_raw"]["cls"] == ["green"]
+        assert readings["ec"]["text"] == "↓ 1116" and readings["ec"]["cls"] == ["yellow"]
+        assert readings["n_rec"]["text"] == "↑ 200" and readings["n_rec"]["cls"] == ["orange"]
+        assert readings["n_season"]["text"] == " (-10%)" and readings["n_season"]["className"] == "season-adj down"
+        assert readings["p_season"]["text"] == " (+5%)" and readings["k_season"]["text"] == ""
+        assert "Данные валидны" in readings["statusInfo"]["html"] and "Осень" in readings["statusInfo"]["html"]
+        # Тексты рекомендаций экранируются, переводы строк - <br>
+        interactions = readings["nutrient-interactions"]["html"]
+        assert "<br>" in interactions and "&lt;b&gt;" in interactions and "<b>" not in interactions
+        assert "Выберите культуру" in readings["crop-specific-recommendations"]["html"]
+        assert "/readings" in readings["nav"]["html"] and "/updates" in readings["nav"]["html"]
+
+        service = render(output_dir, "/service", BOOTSTRAP)
+        assert "JXCT-7in1" in service["app"]["html"] and "value='abc123'" in service["app"]["html"]
+        assert service["app"]["html"].count("name='csrf_token'") == 2 and "tsReset" in service
+        status = service["status-block"]["html"]
+        assert "192.168.1.50" in status and "&lt;timeout&gt;" in status and "Нет публикаций" in status
+
+        calibration = render(output_dir, "/calibration", BOOTSTRAP)
+        calibrated = calibration["calibrationStatus"]["html"]
+        assert "✅ Включена" in calibrated and "✅ pH" in calibrated and "✅ NPK" in calibrated
+        assert "✅ EC" not in calibrated
+        assert calibration["title"] == "🧪 Калибровка датчика"
+
+        access_point = render(output_dir, "/readings", {"device": BOOTSTRAP["device"], "ap_mode": True})
+        assert "недоступна в режиме точки доступа" in access_point["app"]["html"]
+        assert access_point["nav"]["html"].count("<a ") == 1
+
+
+def main():
+    print("🧪 Тестирование панели устройства")
+    print("=" * 60)
+
+    tests = [
+        test_shell_links_current_assets,
+        test_pages_not_built_on_device,
+        test_bootstrap_covers_script,
+        test_views_render_from_bootstrap,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+Тест хостового стенда веб-маршрутов (test/web_bench)
+Собирает стенд g++ по списку исходников из [env:web_bench] в platformio.ini,
+запускает с --json и проверяет отчёт: настоящие обработчики отвечают 200,
+кэш /sensor_json не выделяет память заново, совпавший ETag даёт 304 без тела,
+/api/v2/sensor с выбором полей дешевле полного ответа, /readings - готовая
+оболочка панели из flash без сборки страницы на устройстве
+"""
+
+import configparser
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+
+def read_bench_env():
+    parser = configparser.ConfigParser(interpolation=None, inline_comment_prefixes=(";",))
+    parser.read(os.path.join(PROJECT_DIR, "platformio.ini"), encoding="utf-8")
+    env = parser["env:web_bench"]
+    sources = []
+    for pattern in re.findall(r"\+<([^>]+)>", env["build_src_filter"]):
+        path = os.path.normpath(os.path.join(PROJECT_DIR, "src", pattern))
+        if "*" in pattern:
+            directory = os.path.dirname(path)
+            sources.extend(os.path.join(directory, name) for name in sorted(os.listdir(directory))
+                           if name.endswith(".cpp"))
+        else:
+            sources.append(path)
+    flags = env["build_flags"].replace("-I ", "-I").split()
+    return sources, flags
+
+
+def read_generated_header():
+    with open(os.path.join(PROJECT_DIR, "include", "web_assets_generated.h"), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def build_bench(output_dir):
+    sources, flags = read_bench_env()
+    objects = []
+    processes = []
+    for source in sources:
+        obj = os.path.join(output_dir, os.path.relpath(source, PROJECT_DIR).replace(os.sep, "_") + ".o")
+        processes.append((source, subprocess.Popen(["g++", *flags, "-c", source, "-o", obj], cwd=PROJECT_DIR,
+                                                    stderr=subprocess.PIPE, text=True)))
+        objects.append(obj)
+    for source, process in processes:
+        _, errors = process.communicate()
+        assert process.returncode == 0, f"{source}: {errors[-2000:]}"
+    program = os.path.join(output_dir, "web_bench")
+    link = subprocess.run(["g++", *objects, "-o", program], capture_output=True, text=True)
+    assert link.returncode == 0, link.stderr[-2000:]
+    return program
+
+
+def test_env_lists_real_handlers():
+    """Стенд собирает настоящие маршруты, а не заглушки"""
+    sources, flags = read_bench_env()
+    names = {os.path.relpath(path, PROJECT_DIR) for path in sources}
+    for required in ("src/web/routes_data.cpp", "src/web/routes_service.cpp", "src/web/routes_app.cpp",
+                     "test/web_bench/web_bench_alloc.cpp", "test/web_bench/web_bench_main.cpp"):
+        assert required in names, required
+    assert "-Itest/web_bench/shim" in flags and "-DTEST_BUILD" not in flags
+
+
+def test_bench_report():
+    """Все маршруты отвечают 200; байты, записи и выделения на месте"""
+    if shutil.which("g++") is None:
+        print("   ⚠️ g++ не найден - сборка стенда пропущена")
+        return
+    with tempfile.TemporaryDirectory() as output_dir:
+        program = build_bench(output_dir)
+        run = subprocess.run([program, "--iterations", "20", "--json"], capture_output=True, text=True, timeout=120)
+        assert run.returncode == 0, run.stdout + run.stderr
+        routes = {route["name"]: route for route in json.loads(run.stdout)["routes"]}
+
+        for name in ("/sensor_json (кэш)", "/sensor_json (новое)", "/api/v1/system/health", "/readings"):
+            assert routes[name]["status"] == 200, name
+            assert routes[name]["body_bytes"] > 0, name
+            assert routes[name]["latency_us"]["p99"] >= routes[name]["latency_us"]["p50"] > 0, name
+
+        cached = routes["/sensor_json (кэш)"]
+        rebuilt = routes["/sensor_json (новое)"]
+        assert cached["body_bytes"] == rebuilt["body_bytes"]
+        assert cached["heap"]["allocations_per_request"] < rebuilt["heap"]["allocations_per_request"]
+
+        not_modified = routes["/sensor_json (304)"]
+        assert not_modified["status"] == 304 and not_modified["body_bytes"] == 0
+        assert not_modified["heap"]["allocations_per_request"] < rebuilt["heap"]["allocations_per_request"]
+        assert routes["/service_status (304)"]["status"] == 304
+
+        # Оболочка панели: один send_P сжатого файла, выделений не больше, чем у ответа 304
+        shell_length = int(re.search(r"WEB_ASSET_APP_HTML_GZ_LEN = (\d+);", read_generated_header()).group(1))
+        assert routes["/readings"]["body_bytes"] == shell_length and routes["/readings"]["writes"] == 1
+        assert routes["/readings"]["heap"]["allocations_per_request"] <= not_modified["heap"]["allocations_per_request"]
+        assert routes["/readings (304)"]["status"] == 304 and routes["/readings (304)"]["body_bytes"] == 0
+        bootstrap = routes["/api/v1/bootstrap"]
+        assert bootstrap["status"] == 200 and bootstrap["body_bytes"] > rebuilt["body_bytes"]
+
+        full = routes["/api/v2/sensor (все)"]
+        for name in ("/api/v2/sensor (raw)", "/api/v2/sensor (text=0)"):
+            assert routes[name]["status"] == 200, name
+            assert 0 < routes[name]["body_bytes"] < full["body_bytes"], name
+            assert routes[name]["heap"]["allocations_per_request"] < full["heap"]["allocations_per_request"], name
+        assert full["body_bytes"] == rebuilt["body_bytes"]
+        assert routes["/api/v2/sensor (304)"]["status"] == 304
+        for name, route in routes.items():
+            print(f"   {name}: {route['latency_us']['p50']} мкс, {route['body_bytes']} байт, "
+                  f"{route['heap']['allocations_per_request']} выдел/запрос")
+
+        filtered = subprocess.run([program, "--iterations", "2", "--route", "/readings"], capture_output=True,
+                                  text=True, timeout=60)
+        assert filtered.returncode == 0 and "/readings" in filtered.stdout and "/sensor_json" not in filtered.stdout
+
+
+def main():
+    print("🧪 Тестирование стенда веб-маршрутов")
+    print("=" * 60)
+
+    tests = [
+        test_env_lists_real_handlers,
+        test_bench_report,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
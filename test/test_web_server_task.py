@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""
+Тест выноса веб-сервера из главного цикла (src/wifi_manager.cpp) и бенчмарка
+scripts/web_benchmark.py: handleWiFi() больше не обслуживает клиентов, задача
+WebServer делает это под мьютексом (по одному клиенту, без параллельных соединений);
+главный цикл и задачи датчика обращаются к общему состоянию под тем же мьютексом, а сетевые
+вызовы (MQTT, WiFi, OTA) выполняются вне его;
+бенчмарк с 4 клиентами против локального
+однопоточного сервера (аналог синхронного WebServer) отчитывается о RPS и хвостах
+"""
+
+import os
+import subprocess
+import sys
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+sys.path.insert(0, os.path.join(PROJECT_DIR, "scripts"))
+
+from web_benchmark import BenchmarkResult, run_benchmark  # noqa: E402
+
+
+def read(*parts):
+    with open(os.path.join(PROJECT_DIR, *parts), encoding="utf-8") as handle:
+        return handle.read()
+
+
+def function_body(source, signature):
+    start = source.index(signature)
+    depth = 0
+    for index in range(source.index("{", start), len(source)):
+        if source[index] == "{":
+            depth += 1
+        elif source[index] == "}":
+            depth -= 1
+            if depth == 0:
+                return source[start:index]
+    raise AssertionError(signature)
+
+
+def locked_scope(source, marker="WebServerLock webStateLock;"):
+    """Блок { ... }, в котором объявлена блокировка"""
+    start = source.rindex("{", 0, source.index(marker))
+    depth = 0
+    for index in range(start, len(source)):
+        if source[index] == "{":
+            depth += 1
+        elif source[index] == "}":
+            depth -= 1
+            if depth == 0:
+                return source[start:index]
+    raise AssertionError(marker)
+
+
+class SlowJsonHandler(BaseHTTPRequestHandler):
+    """Один клиент за раз и 2 мс на ответ - как WebServer::handleClient()"""
+
+    def do_GET(self):  # noqa: N802 - имя задано http.server
+        time.sleep(0.002)
+        body = b'{"temperature":"21.5"}'
+        self.send_response(200 if self.path != "/missing" else 404)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def log_message(self, *_args):
+        pass
+
+
+def test_main_loop_no_longer_serves_clients():
+    """handleWiFi() не вызывает handleClient()/processNextRequest()"""
+    handle_wifi = function_body(read("src", "wifi_manager.cpp"), "void handleWiFi()")
+    assert "handleClient" not in handle_wifi
+    assert "processNextRequest" not in handle_wifi
+    assert "handleSensorEvents" not in handle_wifi
+
+
+def test_web_server_task_under_lock():
+    """Задача WebServer обслуживает клиентов под рекурсивным мьютексом; регистрация маршрутов - тоже"""
+    source = read("src", "wifi_manager.cpp")
+    task = function_body(source, "void webServerTask(void* parameters)")
+    assert "WebServerLock lock;" in task and "webServer.handleClient();" in task
+    assert "vTaskDelay(pollDelay);" in task
+    setup = function_body(source, "void setupWebServer()")
+    assert "WebServerLock lock;" in setup and "startWebServerTask();" in setup
+    assert "xSemaphoreCreateRecursiveMutex()" in function_body(source, "void setupWiFi()")
+    assert "WEB_SERVER_TASK_STACK_SIZE, nullptr, WEB_SERVER_TASK_PRIORITY" in source
+
+
+def test_shared_state_under_same_lock():
+    """loop() и обработка показаний датчика читают config/калибровку/приёмники под WebServerLock"""
+    assert "class WebServerLock" in read("src", "wifi_manager.h")
+    source = read("src", "wifi_manager.cpp")
+    assert "WebServerLock::WebServerLock()" in source
+    assert "xSemaphoreTakeRecursive(webServerMutex, portMAX_DELAY);" in source
+
+    loop = function_body(read("src", "main.cpp"), "void loop()")
+    locked = locked_scope(loop)
+    for call in ("publishUplinkSample();", "handleUplinkSinks();", "autoOtaEnabled = config.flags.autoOtaEnabled;"):
+        assert call in locked, call
+    for call in ("publishUplinkSample();", "handleUplinkSinks();", "handleMQTT();", "handleWiFi();", "handleOTA()"):
+        assert loop.count(call) == 1, call
+
+    modbus = function_body(read("src", "modbus_sensor.cpp"), "void applyCompensationIfEnabled(")
+    assert "const WebServerLock webStateLock;" in modbus
+    fake = read("src", "fake_sensor.cpp")
+    assert fake.count("SensorProcessing::processSensorData(") == fake.count("const WebServerLock webStateLock;") == 2
+
+
+def test_network_calls_outside_lock():
+    """MQTT, WiFi и OTA ходят в сеть без WebServerLock: под ней только копии и запись общего состояния"""
+    loop = function_body(read("src", "main.cpp"), "void loop()")
+    locked = locked_scope(loop)
+    for call in ("handleMQTT();", "handleWiFi();", "handleOTA()", "retryPendingOtaCheck();"):
+        assert call not in locked, call
+    assert "if (autoOtaEnabled && (currentTime - lastOtaCheck >= otaCheckInterval))" in loop
+
+    mqtt = read("src", "mqtt_client.cpp")
+    connect = function_body(mqtt, "bool connectMQTTInternal()\n{")
+    copied = locked_scope(connect)
+    assert "strlcpy(password.data(), config.mqttPassword, password.size());" in copied
+    assert "mqttClient.connect(" not in copied and "mqttClient.connect(clientId.data()," in connect
+    publish = function_body(mqtt, "MqttPublishResult publishSensorDataInternal()\n{")
+    built = locked_scope(publish)
+    assert "buildSensorStateJson()" in built and "mqttClient.publish(" not in built
+    assert publish.index("}", publish.index("buildSensorStateJson()")) < publish.index("mqttClient.publish(")
+    discovery = function_body(mqtt, "void publishHomeAssistantConfigInternal()\n{")
+    assert "mqttClient.publish(" not in locked_scope(discovery)
+    handle = function_body(mqtt, "void handleMQTTInternal()\n{")
+    assert "sensorPublishResult = publishSensorDataInternal();" in handle
+
+    sinks = read("src", "uplink_sinks_builtin.cpp")
+    mqtt_sink = sinks[sinks.index("class MqttSink"):sinks.index("class ThingSpeakSink")]
+    assert "requestSensorDataPublish();" in mqtt_sink and "return UplinkDeliveryResult::PENDING;" in mqtt_sink
+    assert "publishSensorData()" not in mqtt_sink.replace("// publishSensorData()", "")
+
+    wifi = read("src", "wifi_manager.cpp")
+    assert "WiFi.begin(config.ssid" not in wifi
+    assert function_body(wifi, "void handleWiFi()").count("copyWifiCredentials()") >= 2
+    assert "const WifiCredentials credentials = copyWifiCredentials();" in function_body(wifi, "void startSTAMode()")
+
+    ota_source = read("src", "ota_manager.cpp")
+    ota = ota_source[ota_source.index("bool handleOTA()"):]  # в теле есть '{' в строках - без разбора скобок
+    assert ota.index("getUplinkSession().get(") < ota.index("const WebServerLock webStateLock;")
+    assert ota.index("const WebServerLock webStateLock;") < ota.index("pendingUpdateUrl = String(binUrl);")
+
+
+def test_percentiles():
+    """Перцентили по ближайшему рангу"""
+    result = BenchmarkResult(4, 100, 0, 2.0, [float(value) for value in range(1, 101)])
+    assert result.percentile(50) == 50.0
+    assert result.percentile(95) == 95.0
+    assert result.percentile(99) == 99.0
+    assert result.requests_per_second == 50.0
+
+
+def test_benchmark_with_four_clients():
+    """4 одновременных клиента: все запросы выполнены, p99 >= p50, RPS > 0"""
+    server = HTTPServer(("127.0.0.1", 0), SlowJsonHandler)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    try:
+        result = run_benchmark("127.0.0.1", server.server_address[1], ["/sensor_json", "/missing"], 4, 80)
+        data = result.to_dict()
+        assert data["completed"] == 80 and data["errors"] == 0
+        assert data["status_codes"] == {"200": 40, "404": 40}
+        assert data["latency_ms"]["p99"] >= data["latency_ms"]["p50"] > 0
+        assert data["rps"] > 0
+        print(f"   {data['rps']} запр/с, p50={data['latency_ms']['p50']} мс, p99={data['latency_ms']['p99']} мс")
+
+        cli = subprocess.run([sys.executable, os.path.join(PROJECT_DIR, "scripts", "web_benchmark.py"),
+                              "--host", "127.0.0.1", "--port", str(server.server_address[1]),
+                              "--clients", "4", "--requests", "20", "--path", "/sensor_json"],
+                             capture_output=True, text=True, timeout=60)
+        assert cli.returncode == 0, cli.stderr
+        assert "запр/с" in cli.stdout and "p99=" in cli.stdout
+    finally:
+        server.shutdown()
+
+
+def main():
+    print("🧪 Тестирование задачи веб-сервера и бенчмарка")
+    print("=" * 60)
+
+    tests = [
+        test_main_loop_no_longer_serves_clients,
+        test_web_server_task_under_lock,
+        test_shared_state_under_same_lock,
+        test_network_calls_outside_lock,
+        test_percentiles,
+        test_benchmark_with_four_clients,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Тест конвейера статических ресурсов веб-интерфейса (scripts/build_web_assets.py)
+Проверяет, что сгенерированные массивы актуальны и распаковываются в исходники,
+ETag совпадает с хэшем содержимого, страницы больше не встраивают CSS/JS, а
+логика 304 (зеркало routes_static.cpp) корректна
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import subprocess
+import sys
+
+PROJECT_DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+HEADER = os.path.join(PROJECT_DIR, "include", "web_assets_generated.h")
+SOURCE = os.path.join(PROJECT_DIR, "src", "web", "web_assets_generated.cpp")
+
+
+def read(path):
+    with open(path, encoding="utf-8") as handle:
+        return handle.read()
+
+
+def generated_array(symbol):
+    match = re.search(rf"{symbol}_GZ\[\] PROGMEM = \{{(.*?)\}};", read(SOURCE), re.S)
+    return bytes(int(byte, 16) for byte in re.findall(r"0x([0-9a-f]{2})", match.group(1)))
+
+
+def header_define(name):
+    return re.search(rf'#define {name} "(.*)"', read(HEADER)).group(1)
+
+
+def test_generated_files_up_to_date():
+    """Сгенерированные файлы соответствуют src/web/assets (скрипт ничего не меняет)"""
+    result = subprocess.run([sys.executable, os.path.join(PROJECT_DIR, "scripts", "build_web_assets.py")],
+                            capture_output=True, text=True, check=True)
+    assert "up to date" in result.stdout, result.stdout
+
+
+def test_gzip_arrays_roundtrip():
+    """Массивы - корректный gzip; длина совпадает с *_GZ_LEN; ETag - хэш содержимого"""
+    for symbol in ("WEB_ASSET_UI_CSS", "WEB_ASSET_UI_JS"):
+        data = generated_array(symbol)
+        declared = int(re.search(rf"{symbol}_GZ_LEN = (\d+);", read(HEADER)).group(1))
+        assert len(data) == declared
+        content = gzip.decompress(data)
+        etag = hashlib.sha256(content).hexdigest()[:16]
+        assert header_define(f"{symbol}_ETAG") == f'\\"{etag}\\"'
+        assert header_define(f"{symbol}_URL").endswith(f"?v={etag}")
+
+
+def test_css_minification_keeps_rules():
+    """Минификация CSS не теряет правил и сохраняет медиа-запросы"""
+    source = read(os.path.join(PROJECT_DIR, "src", "web", "assets", "ui.css"))
+    minified = gzip.decompress(generated_array("WEB_ASSET_UI_CSS")).decode("utf-8")
+    source_without_comments = re.sub(r"/\*.*?\*/", "", source, flags=re.S)
+    assert minified.count("{") == source_without_comments.count("{")
+    assert "@media (max-width:768px)" in minified
+    assert len(generated_array("WEB_ASSET_UI_CSS")) < len(source.encode("utf-8")) // 3
+
+
+def test_pages_do_not_inline_assets():
+    """Ни одна страница не встраивает стили или toast-скрипт целиком"""
+    for root, _dirs, files in os.walk(os.path.join(PROJECT_DIR, "src")):
+        for name in files:
+            if name.endswith(".cpp"):
+                text = read(os.path.join(root, name))
+                assert "getUnifiedCSS" not in text, name
+                assert "function showToast" not in text, name
+
+
+def etag_matches(if_none_match, etag):
+    """Зеркало etagMatches() из conditional_get.cpp"""
+    return if_none_match == "*" or etag in if_none_match
+
+
+def respond(if_none_match, etag='"ec99b0738d485253"'):
+    """Зеркало sendStaticAsset(): статус и заголовки ответа"""
+    headers = {"ETag": etag, "Cache-Control": "public, max-age=31536000, immutable"}
+    if if_none_match is not None and etag_matches(if_none_match, etag):
+        return 304, headers
+    headers["Content-Encoding"] = "gzip"
+    return 200, headers
+
+
+def test_conditional_requests():
+    """Совпавший ETag - 304 без тела; иначе 200 gzip; кэш immutable в обоих случаях"""
+    etag = '"ec99b0738d485253"'
+    assert respond(None)[0] == 200
+    assert respond(etag)[0] == 304
+    assert respond(f'"other", {etag}')[0] == 304
+    assert respond("*")[0] == 304
+    status, headers = respond('"stale"')
+    assert status == 200 and headers["Content-Encoding"] == "gzip"
+    assert "immutable" in respond(etag)[1]["Cache-Control"]
+
+
+def main():
+    print("🧪 Тестирование статических ресурсов веб-интерфейса")
+    print("=" * 60)
+
+    tests = [
+        test_generated_files_up_to_date,
+        test_gzip_arrays_roundtrip,
+        test_css_minification_keeps_rules,
+        test_pages_do_not_inline_assets,
+        test_conditional_requests,
+    ]
+
+    passed = 0
+    for test in tests:
+        try:
+            test()
+            passed += 1
+            print(f"✅ {test.__name__}: PASS")
+        except Exception as e:
+            print(f"❌ {test.__name__}: FAIL - {e}")
+
+    print("=" * 60)
+    print(f"📊 Результат: {passed}/{len(tests)}")
+    return 0 if passed == len(tests) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,30 @@
+/**
+ * @file HTTPClient.h
+ * @brief HTTPClient arduino-esp32 для хоста (отправка ThingSpeak)
+ * @details Коды ошибок совпадают с ядром. Сам клиент драйверу не нужен:
+ *          UplinkHttpSession подменяется в драйвере и HTTPClient не вызывает.
+ */
+
+#ifndef THINGSPEAK_SHIM_HTTP_CLIENT_H
+#define THINGSPEAK_SHIM_HTTP_CLIENT_H
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+class HTTPClient
+{
+};
+
+#endif  // THINGSPEAK_SHIM_HTTP_CLIENT_H
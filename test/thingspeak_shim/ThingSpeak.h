@@ -0,0 +1,34 @@
+/**
+ * @file ThingSpeak.h
+ * @brief Библиотека ThingSpeak для хоста (отправка ThingSpeak)
+ * @details Коды TS_ERR_* совпадают с библиотекой mathworks/ThingSpeak;
+ *          сама библиотека клиентом уже не используется, кроме begin().
+ */
+
+#ifndef THINGSPEAK_SHIM_THING_SPEAK_H
+#define THINGSPEAK_SHIM_THING_SPEAK_H
+
+#include "WiFiClient.h"
+
+#define TS_OK_SUCCESS 200
+#define TS_ERR_BADAPIKEY 400
+#define TS_ERR_BADURL 404
+#define TS_ERR_CONNECT_FAILED (-301)
+#define TS_ERR_UNEXPECTED_FAIL (-302)
+#define TS_ERR_BAD_RESPONSE (-303)
+#define TS_ERR_TIMEOUT (-304)
+#define TS_ERR_NOT_INSERTED (-401)
+
+class ThingSpeakClass
+{
+   public:
+    bool begin(WiFiClient& client)
+    {
+        (void)client;
+        return true;
+    }
+};
+
+inline ThingSpeakClass ThingSpeak;
+
+#endif  // THINGSPEAK_SHIM_THING_SPEAK_H
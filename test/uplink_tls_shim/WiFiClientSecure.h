@@ -0,0 +1,83 @@
+/**
+ * @file WiFiClientSecure.h
+ * @brief WiFiClientSecure arduino-esp32 2.0.x для хоста
+ * @details stop() повторяет stop_ssl_socket() ядра: сокет закрывается,
+ *          ssl_conf.ca_chain освобождается (mbedtls_x509_crt_free), контекст
+ *          обнуляется. Именно это освобождение делает общие корни
+ *          UplinkTlsClient недействительными, если их не отвязать до stop().
+ */
+
+#ifndef UPLINK_TLS_SHIM_WIFI_CLIENT_SECURE_H
+#define UPLINK_TLS_SHIM_WIFI_CLIENT_SECURE_H
+
+#include <unistd.h>
+#include "WiFiClient.h"
+#include "mbedtls/ssl.h"
+
+struct sslclient_context
+{
+    int socket;
+    mbedtls_ssl_context ssl_ctx;
+    mbedtls_ssl_config ssl_conf;
+    mbedtls_ctr_drbg_context drbg_ctx;
+    mbedtls_entropy_context entropy_ctx;
+    mbedtls_x509_crt ca_cert;
+    mbedtls_x509_crt client_cert;
+    mbedtls_pk_context client_key;
+    unsigned long handshake_timeout;
+};
+
+inline void stop_ssl_socket(sslclient_context* ssl_client)
+{
+    if (ssl_client->socket >= 0)
+    {
+        close(ssl_client->socket);
+        ssl_client->socket = -1;
+    }
+    // avoid memory leak if ssl connection attempt failed
+    if (ssl_client->ssl_conf.ca_chain != nullptr)
+    {
+        mbedtls_x509_crt_free(ssl_client->ssl_conf.ca_chain);
+    }
+    mbedtls_ssl_free(&ssl_client->ssl_ctx);
+    mbedtls_ssl_config_free(&ssl_client->ssl_conf);
+    mbedtls_ctr_drbg_free(&ssl_client->drbg_ctx);
+    mbedtls_entropy_free(&ssl_client->entropy_ctx);
+    const unsigned long handshakeTimeout = ssl_client->handshake_timeout;
+    memset(ssl_client, 0, sizeof(sslclient_context));
+    ssl_client->handshake_timeout = handshakeTimeout;
+    ssl_client->socket = -1;
+}
+
+class WiFiClientSecure : public WiFiClient
+{
+   public:
+    WiFiClientSecure() : sslclient(new sslclient_context())
+    {
+        sslclient->socket = -1;
+    }
+    ~WiFiClientSecure() override
+    {
+        stop();
+        delete sslclient;
+    }
+    void stop() override
+    {
+        if (sslclient->socket >= 0)
+        {
+            _connected = false;
+        }
+        stop_ssl_socket(sslclient);
+    }
+    uint8_t connected() override
+    {
+        return _connected ? 1 : 0;
+    }
+
+   protected:
+    sslclient_context* sslclient;
+    int _lastError = 0;
+    bool _connected = false;
+};
+
+#endif  // UPLINK_TLS_SHIM_WIFI_CLIENT_SECURE_H
@@ -0,0 +1,2 @@
+// FreeRTOS для хоста: типы и примитивы - в Arduino.h стенда
+#include <Arduino.h>
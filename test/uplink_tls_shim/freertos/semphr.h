@@ -0,0 +1,2 @@
+// Семафоры для хоста: пустышки из Arduino.h стенда
+#include <Arduino.h>
@@ -0,0 +1,19 @@
+/**
+ * @file sockets.h
+ * @brief lwIP сокеты на хосте - POSIX-сокеты
+ */
+
+#ifndef UPLINK_TLS_SHIM_LWIP_SOCKETS_H
+#define UPLINK_TLS_SHIM_LWIP_SOCKETS_H
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define lwip_socket ::socket
+#define lwip_connect ::connect
+
+#endif  // UPLINK_TLS_SHIM_LWIP_SOCKETS_H
@@ -0,0 +1,26 @@
+/**
+ * @file net_sockets.h
+ * @brief BIO-функции mbedTLS для хоста: рукопожатие модели сокет не читает
+ */
+
+#ifndef UPLINK_TLS_SHIM_MBEDTLS_NET_SOCKETS_H
+#define UPLINK_TLS_SHIM_MBEDTLS_NET_SOCKETS_H
+
+#include "ssl.h"
+
+inline int mbedtls_net_send(void* context, const unsigned char* buffer, size_t length)
+{
+    (void)context;
+    (void)buffer;
+    return static_cast<int>(length);
+}
+
+inline int mbedtls_net_recv(void* context, unsigned char* buffer, size_t length)
+{
+    (void)context;
+    (void)buffer;
+    (void)length;
+    return MBEDTLS_ERR_SSL_WANT_READ;
+}
+
+#endif  // UPLINK_TLS_SHIM_MBEDTLS_NET_SOCKETS_H
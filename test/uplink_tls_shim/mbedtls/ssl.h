@@ -0,0 +1,369 @@
+/**
+ * @file ssl.h
+ * @brief Модель mbedTLS 2.28 для проверки UplinkTlsClient на хосте
+ * @details Только функции, которые вызывает uplink_tls_client.cpp, и только та
+ *          семантика, от которой зависит клиент: владение цепочкой корней
+ *          (mbedtls_x509_crt_free), режимы проверки, обратный вызов проверки,
+ *          возобновление сессии и сертификат сервера. Криптографии нет:
+ *          рукопожатие - с моделью сервера FakeTlsServer. Цепочка, освобождённая
+ *          до рукопожатия, засчитывается в freedChainUses.
+ */
+
+#ifndef UPLINK_TLS_SHIM_MBEDTLS_SSL_H
+#define UPLINK_TLS_SHIM_MBEDTLS_SSL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#define MBEDTLS_SSL_IS_CLIENT 0
+#define MBEDTLS_SSL_TRANSPORT_STREAM 0
+#define MBEDTLS_SSL_PRESET_DEFAULT 0
+#define MBEDTLS_SSL_VERIFY_NONE 0
+#define MBEDTLS_SSL_VERIFY_OPTIONAL 1
+#define MBEDTLS_SSL_VERIFY_REQUIRED 2
+#define MBEDTLS_SSL_SESSION_TICKETS_ENABLED 1
+#define MBEDTLS_ERR_SSL_WANT_READ -0x6900
+#define MBEDTLS_ERR_SSL_WANT_WRITE -0x6880
+#define MBEDTLS_ERR_SSL_TIMEOUT -0x6800
+#define MBEDTLS_ERR_SSL_BAD_INPUT_DATA -0x7100
+#define MBEDTLS_ERR_X509_CERT_VERIFY_FAILED -0x2700
+#define MBEDTLS_X509_BADCERT_NOT_TRUSTED 0x08
+#define MBEDTLS_X509_BADCERT_SKIP_VERIFY 0x4000
+
+constexpr uint32_t FAKE_CRT_ALIVE = 0xC0FFEEU;
+constexpr uint32_t FAKE_CRT_FREED = 0xDEADU;
+
+struct mbedtls_x509_buf
+{
+    int tag;
+    size_t len;
+    unsigned char* p;
+};
+
+struct mbedtls_x509_crt
+{
+    uint32_t magic;  // FAKE_CRT_ALIVE после разбора, FAKE_CRT_FREED после free
+    const char* pem;  // Текст одного сертификата внутри буфера разбора
+    size_t pemLength;
+    mbedtls_x509_buf raw;
+    mbedtls_x509_crt* next;
+};
+
+struct mbedtls_ssl_session
+{
+    int id;  // 0 - пустая
+    uint32_t verifyResult;
+    const mbedtls_x509_crt* peer;
+};
+
+using mbedtls_verify_fn = int (*)(void*, mbedtls_x509_crt*, int, uint32_t*);
+using mbedtls_rng_fn = int (*)(void*, unsigned char*, size_t);
+
+struct mbedtls_ssl_config
+{
+    int authmode;
+    mbedtls_x509_crt* ca_chain;
+    mbedtls_verify_fn f_vrfy;
+    void* p_vrfy;
+};
+
+struct mbedtls_ssl_context
+{
+    const mbedtls_ssl_config* conf;
+    int offeredSession;
+    mbedtls_ssl_session session;
+};
+
+struct mbedtls_ctr_drbg_context
+{
+    int seeded;
+};
+
+struct mbedtls_entropy_context
+{
+    int ready;
+};
+
+struct mbedtls_pk_context
+{
+    void* key;
+};
+
+/**
+ * @brief Сервер на другом конце: один сертификат, выданный CA с текстом issuerPem
+ */
+struct FakeTlsServer
+{
+    const char* issuerPem = "";
+    mbedtls_x509_crt leaf = {FAKE_CRT_ALIVE, nullptr, 0, {0, 0, nullptr}, nullptr};
+    bool acceptResumption = true;
+    int nextSessionId = 1;
+    int knownSessions[16] = {};
+    size_t knownCount = 0;
+    unsigned fullHandshakes = 0;
+    unsigned resumedHandshakes = 0;
+    unsigned freedChainUses = 0;  // Рукопожатие с уже освобождённой цепочкой корней
+};
+
+inline FakeTlsServer fakeTlsServer;
+
+inline void mbedtls_x509_crt_init(mbedtls_x509_crt* crt)
+{
+    memset(crt, 0, sizeof(*crt));
+}
+
+// Каждый PEM-блок - узел цепочки; голова принадлежит вызывающему, хвост - куче
+inline int mbedtls_x509_crt_parse(mbedtls_x509_crt* chain, const unsigned char* buffer, size_t length)
+{
+    static const char BEGIN[] = "-----BEGIN CERTIFICATE-----";
+    static const char END[] = "-----END CERTIFICATE-----";
+    const char* text = reinterpret_cast<const char*>(buffer);
+    const char* cursor = text;
+    mbedtls_x509_crt* node = chain;
+    while (cursor < text + length)
+    {
+        const char* begin = strstr(cursor, BEGIN);
+        const char* end = begin != nullptr ? strstr(begin, END) : nullptr;
+        if (end == nullptr)
+        {
+            break;
+        }
+        if (node->magic == FAKE_CRT_ALIVE)
+        {
+            node->next = new mbedtls_x509_crt();
+            node = node->next;
+        }
+        node->magic = FAKE_CRT_ALIVE;
+        node->pem = begin;
+        node->pemLength = static_cast<size_t>(end + sizeof(END) - 1 - begin);
+        cursor = end + sizeof(END) - 1;
+    }
+    return chain->magic == FAKE_CRT_ALIVE ? 0 : -0x2180;
+}
+
+// Как в mbedTLS: голова обнуляется, узлы хвоста освобождаются (здесь - помечаются)
+inline void mbedtls_x509_crt_free(mbedtls_x509_crt* crt)
+{
+    for (mbedtls_x509_crt* node = crt->next; node != nullptr; node = node->next)
+    {
+        node->magic = FAKE_CRT_FREED;
+    }
+    memset(crt, 0, sizeof(*crt));
+    crt->magic = FAKE_CRT_FREED;
+}
+
+inline void mbedtls_ssl_init(mbedtls_ssl_context* ssl)
+{
+    memset(ssl, 0, sizeof(*ssl));
+}
+inline void mbedtls_ssl_free(mbedtls_ssl_context* ssl)
+{
+    memset(ssl, 0, sizeof(*ssl));
+}
+inline void mbedtls_ssl_config_init(mbedtls_ssl_config* conf)
+{
+    memset(conf, 0, sizeof(*conf));
+}
+// Как в mbedTLS: ca_chain не освобождается - это делает stop_ssl_socket() ядра
+inline void mbedtls_ssl_config_free(mbedtls_ssl_config* conf)
+{
+    memset(conf, 0, sizeof(*conf));
+}
+inline int mbedtls_ssl_config_defaults(mbedtls_ssl_config* conf, int endpoint, int transport, int preset)
+{
+    (void)endpoint;
+    (void)transport;
+    (void)preset;
+    conf->authmode = MBEDTLS_SSL_VERIFY_REQUIRED;
+    return 0;
+}
+inline void mbedtls_ctr_drbg_init(mbedtls_ctr_drbg_context* ctx)
+{
+    ctx->seeded = 0;
+}
+inline void mbedtls_ctr_drbg_free(mbedtls_ctr_drbg_context* ctx)
+{
+    ctx->seeded = 0;
+}
+inline void mbedtls_entropy_init(mbedtls_entropy_context* ctx)
+{
+    ctx->ready = 1;
+}
+inline void mbedtls_entropy_free(mbedtls_entropy_context* ctx)
+{
+    ctx->ready = 0;
+}
+inline void mbedtls_pk_free(mbedtls_pk_context* ctx)
+{
+    ctx->key = nullptr;
+}
+inline int mbedtls_entropy_func(void* data, unsigned char* output, size_t length)
+{
+    (void)data;
+    memset(output, 0x5A, length);
+    return 0;
+}
+inline int mbedtls_ctr_drbg_random(void* data, unsigned char* output, size_t length)
+{
+    return mbedtls_entropy_func(data, output, length);
+}
+inline int mbedtls_ctr_drbg_seed(mbedtls_ctr_drbg_context* ctx, int (*entropy)(void*, unsigned char*, size_t),
+                                 void* entropyContext, const unsigned char* custom, size_t length)
+{
+    (void)entropy;
+    (void)entropyContext;
+    (void)custom;
+    (void)length;
+    ctx->seeded = 1;
+    return 0;
+}
+
+inline void mbedtls_ssl_conf_authmode(mbedtls_ssl_config* conf, int authmode)
+{
+    conf->authmode = authmode;
+}
+inline void mbedtls_ssl_conf_ca_chain(mbedtls_ssl_config* conf, mbedtls_x509_crt* chain, void* crl)
+{
+    (void)crl;
+    conf->ca_chain = chain;
+}
+inline void mbedtls_ssl_conf_verify(mbedtls_ssl_config* conf, mbedtls_verify_fn verify, void* context)
+{
+    conf->f_vrfy = verify;
+    conf->p_vrfy = context;
+}
+inline void mbedtls_ssl_conf_rng(mbedtls_ssl_config* conf, mbedtls_rng_fn rng, void* context)
+{
+    (void)conf;
+    (void)rng;
+    (void)context;
+}
+inline void mbedtls_ssl_conf_session_tickets(mbedtls_ssl_config* conf, int enabled)
+{
+    (void)conf;
+    (void)enabled;
+}
+inline int mbedtls_ssl_setup(mbedtls_ssl_context* ssl, const mbedtls_ssl_config* conf)
+{
+    ssl->conf = conf;
+    return 0;
+}
+inline int mbedtls_ssl_set_hostname(mbedtls_ssl_context* ssl, const char* host)
+{
+    (void)ssl;
+    return host != nullptr ? 0 : MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+}
+using mbedtls_ssl_send_t = int(void*, const unsigned char*, size_t);
+using mbedtls_ssl_recv_t = int(void*, unsigned char*, size_t);
+using mbedtls_ssl_recv_timeout_t = int(void*, unsigned char*, size_t, uint32_t);
+
+inline void mbedtls_ssl_set_bio(mbedtls_ssl_context* ssl, void* bio, mbedtls_ssl_send_t* send, mbedtls_ssl_recv_t* recv,
+                                mbedtls_ssl_recv_timeout_t* recvTimeout)
+{
+    (void)ssl;
+    (void)bio;
+    (void)send;
+    (void)recv;
+    (void)recvTimeout;
+}
+
+inline void mbedtls_ssl_session_init(mbedtls_ssl_session* session)
+{
+    memset(session, 0, sizeof(*session));
+}
+inline void mbedtls_ssl_session_free(mbedtls_ssl_session* session)
+{
+    memset(session, 0, sizeof(*session));
+}
+inline int mbedtls_ssl_set_session(mbedtls_ssl_context* ssl, const mbedtls_ssl_session* session)
+{
+    if (session->id == 0)
+    {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+    ssl->offeredSession = session->id;
+    ssl->session = *session;
+    return 0;
+}
+inline int mbedtls_ssl_get_session(const mbedtls_ssl_context* ssl, mbedtls_ssl_session* session)
+{
+    *session = ssl->session;
+    return session->id != 0 ? 0 : MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+}
+inline uint32_t mbedtls_ssl_get_verify_result(const mbedtls_ssl_context* ssl)
+{
+    return ssl->session.verifyResult;
+}
+inline const mbedtls_x509_crt* mbedtls_ssl_get_peer_cert(const mbedtls_ssl_context* ssl)
+{
+    return ssl->session.peer;
+}
+
+// Цепочка доверена, если среди живых узлов ca_chain есть CA сервера
+inline bool fakeChainTrusts(const mbedtls_x509_crt* chain, const char* issuerPem)
+{
+    const size_t issuerLength = strlen(issuerPem);
+    for (const mbedtls_x509_crt* node = chain; node != nullptr && node->magic == FAKE_CRT_ALIVE; node = node->next)
+    {
+        if (node->pemLength == issuerLength && memcmp(node->pem, issuerPem, issuerLength) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline int mbedtls_ssl_handshake(mbedtls_ssl_context* ssl)
+{
+    FakeTlsServer& server = fakeTlsServer;
+    const mbedtls_ssl_config& conf = *ssl->conf;
+    if (conf.authmode != MBEDTLS_SSL_VERIFY_NONE && conf.ca_chain != nullptr && conf.ca_chain->magic != FAKE_CRT_ALIVE)
+    {
+        ++server.freedChainUses;
+    }
+
+    // Сокращённое рукопожатие: сертификаты не передаются, обратный вызов не вызывается
+    if (ssl->offeredSession != 0 && server.acceptResumption)
+    {
+        for (size_t i = 0; i < server.knownCount; ++i)
+        {
+            if (server.knownSessions[i] == ssl->offeredSession)
+            {
+                ++server.resumedHandshakes;
+                return 0;
+            }
+        }
+    }
+
+    ++server.fullHandshakes;
+    uint32_t flags = 0;
+    if (conf.authmode == MBEDTLS_SSL_VERIFY_NONE)
+    {
+        flags = MBEDTLS_X509_BADCERT_SKIP_VERIFY;
+    }
+    else
+    {
+        flags = fakeChainTrusts(conf.ca_chain, server.issuerPem) ? 0 : MBEDTLS_X509_BADCERT_NOT_TRUSTED;
+        if (conf.f_vrfy != nullptr)
+        {
+            uint32_t depthFlags = flags;
+            conf.f_vrfy(conf.p_vrfy, &server.leaf, 0, &depthFlags);
+            flags = depthFlags;
+        }
+    }
+    ssl->session.id = server.nextSessionId++;
+    ssl->session.verifyResult = flags;
+    ssl->session.peer = &server.leaf;
+    if (conf.authmode == MBEDTLS_SSL_VERIFY_REQUIRED && flags != 0)
+    {
+        return MBEDTLS_ERR_X509_CERT_VERIFY_FAILED;
+    }
+    if (server.knownCount < sizeof(server.knownSessions) / sizeof(server.knownSessions[0]))
+    {
+        server.knownSessions[server.knownCount++] = ssl->session.id;
+    }
+    return 0;
+}
+
+#endif  // UPLINK_TLS_SHIM_MBEDTLS_SSL_H
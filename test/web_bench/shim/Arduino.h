@@ -0,0 +1,605 @@
+/**
+ * @file Arduino.h
+ * @brief Хостовая замена Arduino-ядра для стенда веб-маршрутов
+ * @details Только то, что используют маршруты и бизнес-сервисы на пути запроса.
+ *          String хранит данные в std::string, поэтому его выделения памяти видны
+ *          счётчику аллокаций стенда так же, как выделения Arduino String в куче ESP32.
+ */
+
+#ifndef WEB_BENCH_ARDUINO_H
+#define WEB_BENCH_ARDUINO_H
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <math.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define PROGMEM
+#define F(text) (text)
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define INPUT_PULLUP 2
+#define DEC 10
+#define HEX 16
+#define SERIAL_8N1 0x800001c
+
+using byte = uint8_t;
+using boolean = bool;
+
+// FreeRTOS: стенд однопоточный, примитивы синхронизации - пустышки
+using UBaseType_t = unsigned int;
+using BaseType_t = int;
+using TickType_t = uint32_t;
+using SemaphoreHandle_t = void*;
+using QueueHandle_t = void*;
+using TaskHandle_t = void*;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFU
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) (ms)
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char* destination, const char* source, size_t size)
+{
+    const size_t length = strlen(source);
+    if (size > 0)
+    {
+        const size_t count = length < size - 1 ? length : size - 1;
+        memcpy(destination, source, count);
+        destination[count] = '\0';
+    }
+    return length;
+}
+#endif
+
+class String
+{
+   public:
+    String() = default;
+    String(const char* text) : data(text != nullptr ? text : "") {}  // NOLINT(google-explicit-constructor)
+    String(const std::string& text) : data(text) {}                   // NOLINT(google-explicit-constructor)
+    String(const char* text, size_t length) : data(text, length) {}
+    explicit String(char value) : data(1, value) {}
+    explicit String(int value, unsigned char base = DEC) : data(toBase(static_cast<long>(value), base)) {}
+    explicit String(unsigned int value, unsigned char base = DEC)
+        : data(toBase(static_cast<unsigned long>(value), base))
+    {
+    }
+    explicit String(long value, unsigned char base = DEC) : data(toBase(value, base)) {}
+    explicit String(unsigned long value, unsigned char base = DEC) : data(toBase(value, base)) {}
+    explicit String(long long value) : data(std::to_string(value)) {}
+    explicit String(unsigned long long value) : data(std::to_string(value)) {}
+    explicit String(float value, unsigned int decimals = 2) : data(fixed(value, decimals)) {}
+    explicit String(double value, unsigned int decimals = 2) : data(fixed(value, decimals)) {}
+
+    const char* c_str() const
+    {
+        return data.c_str();
+    }
+    unsigned int length() const
+    {
+        return static_cast<unsigned int>(data.size());
+    }
+    bool isEmpty() const
+    {
+        return data.empty();
+    }
+    bool reserve(unsigned int size)
+    {
+        data.reserve(size);
+        return true;
+    }
+    const char* begin() const
+    {
+        return data.data();
+    }
+    const char* end() const
+    {
+        return data.data() + data.size();
+    }
+    char charAt(unsigned int index) const
+    {
+        return index < data.size() ? data[index] : '\0';
+    }
+    char operator[](unsigned int index) const
+    {
+        return charAt(index);
+    }
+    char& operator[](unsigned int index)
+    {
+        return data[index];
+    }
+
+    String& operator+=(const String& other)
+    {
+        data += other.data;
+        return *this;
+    }
+    String& operator+=(const char* other)
+    {
+        data += other != nullptr ? other : "";
+        return *this;
+    }
+    String& operator+=(char value)
+    {
+        data += value;
+        return *this;
+    }
+    String& operator+=(int value)
+    {
+        data += std::to_string(value);
+        return *this;
+    }
+    String& operator+=(unsigned int value)
+    {
+        data += std::to_string(value);
+        return *this;
+    }
+    String& operator+=(long value)
+    {
+        data += std::to_string(value);
+        return *this;
+    }
+    String& operator+=(unsigned long value)
+    {
+        data += std::to_string(value);
+        return *this;
+    }
+    String& operator+=(float value)
+    {
+        data += fixed(value, 2);
+        return *this;
+    }
+    String& operator+=(double value)
+    {
+        data += fixed(value, 2);
+        return *this;
+    }
+    bool concat(const String& other)
+    {
+        *this += other;
+        return true;
+    }
+    bool concat(const char* other)
+    {
+        *this += other;
+        return true;
+    }
+
+    bool equals(const String& other) const
+    {
+        return data == other.data;
+    }
+    bool equalsIgnoreCase(const String& other) const
+    {
+        String left = *this;
+        String right = other;
+        left.toLowerCase();
+        right.toLowerCase();
+        return left.data == right.data;
+    }
+    bool operator==(const String& other) const
+    {
+        return data == other.data;
+    }
+    bool operator==(const char* other) const
+    {
+        return data == (other != nullptr ? other : "");
+    }
+    bool operator!=(const String& other) const
+    {
+        return data != other.data;
+    }
+    bool operator!=(const char* other) const
+    {
+        return !(*this == other);
+    }
+    bool operator<(const String& other) const
+    {
+        return data < other.data;
+    }
+    int compareTo(const String& other) const
+    {
+        return data.compare(other.data);
+    }
+
+    bool startsWith(const String& prefix) const
+    {
+        return data.compare(0, prefix.data.size(), prefix.data) == 0;
+    }
+    bool endsWith(const String& suffix) const
+    {
+        return data.size() >= suffix.data.size() &&
+               data.compare(data.size() - suffix.data.size(), suffix.data.size(), suffix.data) == 0;
+    }
+    int indexOf(char value, unsigned int from = 0) const
+    {
+        return position(data.find(value, from));
+    }
+    int indexOf(const String& value, unsigned int from = 0) const
+    {
+        return position(data.find(value.data, from));
+    }
+    int lastIndexOf(char value) const
+    {
+        return position(data.rfind(value));
+    }
+    int lastIndexOf(const String& value) const
+    {
+        return position(data.rfind(value.data));
+    }
+    String substring(unsigned int begin) const
+    {
+        return begin < data.size() ? String(data.substr(begin)) : String();
+    }
+    String substring(unsigned int begin, unsigned int end) const
+    {
+        if (begin > end)
+        {
+            std::swap(begin, end);
+        }
+        return begin < data.size() ? String(data.substr(begin, end - begin)) : String();
+    }
+
+    void replace(const String& from, const String& to)
+    {
+        if (from.data.empty())
+        {
+            return;
+        }
+        size_t pos = 0;
+        while ((pos = data.find(from.data, pos)) != std::string::npos)
+        {
+            data.replace(pos, from.data.size(), to.data);
+            pos += to.data.size();
+        }
+    }
+    void replace(char from, char to)
+    {
+        std::replace(data.begin(), data.end(), from, to);
+    }
+    void remove(unsigned int index)
+    {
+        if (index < data.size())
+        {
+            data.erase(index);
+        }
+    }
+    void remove(unsigned int index, unsigned int count)
+    {
+        if (index < data.size())
+        {
+            data.erase(index, count);
+        }
+    }
+    void trim()
+    {
+        const auto notSpace = [](unsigned char value) { return !std::isspace(value); };
+        data.erase(data.begin(), std::find_if(data.begin(), data.end(), notSpace));
+        data.erase(std::find_if(data.rbegin(), data.rend(), notSpace).base(), data.end());
+    }
+    void toLowerCase()
+    {
+        std::transform(data.begin(), data.end(), data.begin(), [](unsigned char value) { return std::tolower(value); });
+    }
+    void toUpperCase()
+    {
+        std::transform(data.begin(), data.end(), data.begin(), [](unsigned char value) { return std::toupper(value); });
+    }
+    long toInt() const
+    {
+        return std::strtol(data.c_str(), nullptr, 10);
+    }
+    float toFloat() const
+    {
+        return std::strtof(data.c_str(), nullptr);
+    }
+    void toCharArray(char* buffer, unsigned int size) const
+    {
+        if (size == 0)
+        {
+            return;
+        }
+        const size_t count = std::min<size_t>(size - 1, data.size());
+        memcpy(buffer, data.data(), count);
+        buffer[count] = '\0';
+    }
+
+    friend String operator+(const String& left, const String& right)
+    {
+        return String(left.data + right.data);
+    }
+    friend String operator+(const String& left, const char* right)
+    {
+        return String(left.data + (right != nullptr ? right : ""));
+    }
+    friend String operator+(const char* left, const String& right)
+    {
+        return String((left != nullptr ? left : "") + right.data);
+    }
+    friend String operator+(const String& left, char right)
+    {
+        return String(left.data + right);
+    }
+    friend String operator+(const String& left, int right)
+    {
+        return String(left.data + std::to_string(right));
+    }
+    friend String operator+(const String& left, unsigned long right)
+    {
+        return String(left.data + std::to_string(right));
+    }
+    friend String operator+(const String& left, float right)
+    {
+        return String(left.data + fixed(right, 2));
+    }
+
+   private:
+    std::string data;
+
+    static int position(size_t pos)
+    {
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+    template <typename T>
+    static std::string toBase(T value, unsigned char base)
+    {
+        char buffer[40];
+        if (base == HEX)
+        {
+            snprintf(buffer, sizeof(buffer), "%lx", static_cast<unsigned long>(value));
+        }
+        else
+        {
+            snprintf(buffer, sizeof(buffer), "%s", std::to_string(value).c_str());
+        }
+        return buffer;
+    }
+    static std::string fixed(double value, unsigned int decimals)
+    {
+        char buffer[48];
+        snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(decimals), value);
+        return buffer;
+    }
+};
+
+class Print
+{
+   public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t value)
+    {
+        (void)value;
+        return 1;
+    }
+    virtual size_t write(const uint8_t* buffer, size_t size)
+    {
+        (void)buffer;
+        return size;
+    }
+    virtual int availableForWrite()
+    {
+        return 0;
+    }
+    size_t print(const String& text)
+    {
+        return write(reinterpret_cast<const uint8_t*>(text.c_str()), text.length());
+    }
+    size_t print(const char* text)
+    {
+        return write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+    }
+    size_t print(char value)
+    {
+        return write(static_cast<uint8_t>(value));
+    }
+    size_t print(int value)
+    {
+        return print(String(value));
+    }
+    size_t print(unsigned int value)
+    {
+        return print(String(value));
+    }
+    size_t print(long value)
+    {
+        return print(String(value));
+    }
+    size_t print(unsigned long value)
+    {
+        return print(String(value));
+    }
+    size_t print(double value, int decimals = 2)
+    {
+        return print(String(value, static_cast<unsigned int>(decimals)));
+    }
+    template <typename T>
+    size_t println(const T& value)
+    {
+        return print(value) + print("\n");
+    }
+    size_t println()
+    {
+        return print("\n");
+    }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print
+{
+   public:
+    virtual int available()
+    {
+        return 0;
+    }
+    virtual int read()
+    {
+        return -1;
+    }
+    String readString()
+    {
+        return String();
+    }
+    String readStringUntil(char terminator)
+    {
+        (void)terminator;
+        return String();
+    }
+    void setTimeout(unsigned long timeoutMs)
+    {
+        (void)timeoutMs;
+    }
+};
+
+class HardwareSerial : public Stream
+{
+   public:
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1)
+    {
+        (void)baud;
+        (void)config;
+        (void)rxPin;
+        (void)txPin;
+    }
+    void flush() {}
+    unsigned long baudRate() const
+    {
+        return 9600;
+    }
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
+
+struct EspClass
+{
+    uint32_t getFreeHeap() const;
+    uint32_t getMinFreeHeap() const;
+    uint32_t getMaxAllocHeap() const;
+    uint32_t getHeapSize() const;
+    uint64_t getEfuseMac() const
+    {
+        return 0x010000C40A24ULL;
+    }
+    const char* getChipModel() const
+    {
+        return "host";
+    }
+    uint8_t getChipRevision() const
+    {
+        return 3;
+    }
+    uint32_t getPsramSize() const
+    {
+        return 0;
+    }
+    uint32_t getFreePsram() const
+    {
+        return 0;
+    }
+    uint32_t getCpuFreqMHz() const
+    {
+        return 240;
+    }
+    void restart() {}
+};
+extern EspClass ESP;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+long random(long max);
+long random(long min, long max);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+template <typename T, typename L, typename H>
+inline T constrain(T value, L low, H high)
+{
+    return value < low ? static_cast<T>(low) : (value > high ? static_cast<T>(high) : value);
+}
+
+inline bool isAlphaNumeric(int value)
+{
+    return std::isalnum(value) != 0;
+}
+inline bool isDigit(int value)
+{
+    return std::isdigit(value) != 0;
+}
+inline bool isAlpha(int value)
+{
+    return std::isalpha(value) != 0;
+}
+inline bool isSpace(int value)
+{
+    return std::isspace(value) != 0;
+}
+
+// Фоновые задачи на стенде не запускаются: замеряется только путь запроса
+using TaskFunction_t = void (*)(void*);
+inline BaseType_t xTaskCreate(TaskFunction_t task, const char* name, uint32_t stackDepth, void* parameters,
+                              UBaseType_t priority, TaskHandle_t* handle)
+{
+    (void)task;
+    (void)name;
+    (void)stackDepth;
+    (void)parameters;
+    (void)priority;
+    if (handle != nullptr)
+    {
+        *handle = nullptr;
+    }
+    return pdPASS;
+}
+inline void vTaskDelete(TaskHandle_t handle)
+{
+    (void)handle;
+}
+
+inline void vTaskDelay(TickType_t ticks)
+{
+    (void)ticks;
+}
+inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return nullptr;
+}
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex()
+{
+    return nullptr;
+}
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t ticks)
+{
+    (void)handle;
+    (void)ticks;
+    return pdTRUE;
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t handle)
+{
+    (void)handle;
+    return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t handle, TickType_t ticks)
+{
+    return xSemaphoreTake(handle, ticks);
+}
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t handle)
+{
+    return xSemaphoreGive(handle);
+}
+
+#endif  // WEB_BENCH_ARDUINO_H
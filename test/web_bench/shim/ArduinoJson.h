@@ -0,0 +1,734 @@
+/**
+ * @file ArduinoJson.h
+ * @brief Хостовая замена ArduinoJson 6 для стенда веб-маршрутов
+ * @details Подмножество API, которое используют маршруты: построение документа через
+ *          operator[], вложенные объекты/массивы, значения по умолчанию через |,
+ *          serializeJson() в String/буфер. Разбор входного JSON (deserializeJson)
+ *          стенду не нужен - POST-маршруты не замеряются - и всегда возвращает ошибку.
+ *          Выделения узлов не учитываются счётчиком: на устройстве они живут в пуле
+ *          документа; DynamicJsonDocument учитывает один блок своей ёмкости, как на ESP32.
+ */
+
+#ifndef WEB_BENCH_ARDUINOJSON_H
+#define WEB_BENCH_ARDUINOJSON_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "web_bench_alloc.h"
+
+namespace web_bench_json
+{
+struct Node
+{
+    enum class Type
+    {
+        Null,
+        Bool,
+        Integer,
+        Real,
+        Text,
+        Object,
+        Array,
+        Raw  // serialized(): готовый JSON, выводится как есть
+    };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    long long integer = 0;
+    double real = 0.0;
+    std::string text;
+    std::vector<std::pair<std::string, std::shared_ptr<Node>>> members;
+    std::vector<std::shared_ptr<Node>> items;
+
+    void clear()
+    {
+        type = Type::Null;
+        text.clear();
+        members.clear();
+        items.clear();
+    }
+};
+
+inline void appendEscaped(std::string& out, const std::string& text)
+{
+    out += '"';
+    for (const char symbol : text)
+    {
+        switch (symbol)
+        {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            case '\b':
+                out += "\\b";
+                break;
+            case '\f':
+                out += "\\f";
+                break;
+            default:
+                out += symbol;
+        }
+    }
+    out += '"';
+}
+
+inline void serialize(const Node& node, std::string& out)
+{
+    switch (node.type)
+    {
+        case Node::Type::Null:
+            out += "null";
+            break;
+        case Node::Type::Bool:
+            out += node.boolean ? "true" : "false";
+            break;
+        case Node::Type::Integer:
+            out += std::to_string(node.integer);
+            break;
+        case Node::Type::Real:
+        {
+            char buffer[32];
+            snprintf(buffer, sizeof(buffer), "%.9g", node.real);
+            out += buffer;
+            break;
+        }
+        case Node::Type::Text:
+            appendEscaped(out, node.text);
+            break;
+        case Node::Type::Raw:
+            out += node.text;
+            break;
+        case Node::Type::Object:
+        {
+            out += '{';
+            bool first = true;
+            for (const auto& member : node.members)
+            {
+                if (!first)
+                {
+                    out += ',';
+                }
+                first = false;
+                appendEscaped(out, member.first);
+                out += ':';
+                serialize(*member.second, out);
+            }
+            out += '}';
+            break;
+        }
+        case Node::Type::Array:
+        {
+            out += '[';
+            for (size_t index = 0; index < node.items.size(); ++index)
+            {
+                if (index > 0)
+                {
+                    out += ',';
+                }
+                serialize(*node.items[index], out);
+            }
+            out += ']';
+            break;
+        }
+    }
+}
+}  // namespace web_bench_json
+
+class JsonObject;
+class JsonArray;
+
+// serialized(): вставка готового JSON без разбора; как и ArduinoJson, const char* не копируется
+struct SerializedValue
+{
+    const char* data;
+    size_t size;
+};
+
+inline SerializedValue serialized(const char* data, size_t size)
+{
+    return SerializedValue{data, size};
+}
+
+inline SerializedValue serialized(const char* data)
+{
+    return SerializedValue{data, strlen(data)};
+}
+
+class JsonVariant
+{
+   public:
+    JsonVariant() = default;
+    explicit JsonVariant(std::shared_ptr<web_bench_json::Node> target) : node(std::move(target)) {}
+
+    JsonVariant operator[](const char* key) const
+    {
+        WebBenchUntrackedScope untracked;
+        if (node->type != web_bench_json::Node::Type::Object)
+        {
+            node->clear();
+            node->type = web_bench_json::Node::Type::Object;
+        }
+        for (const auto& member : node->members)
+        {
+            if (member.first == key)
+            {
+                return JsonVariant(member.second);
+            }
+        }
+        node->members.emplace_back(key, std::make_shared<web_bench_json::Node>());
+        return JsonVariant(node->members.back().second);
+    }
+    JsonVariant operator[](const String& key) const
+    {
+        return (*this)[key.c_str()];
+    }
+    JsonVariant operator[](int index) const
+    {
+        if (node->type != web_bench_json::Node::Type::Array || index < 0 ||
+            static_cast<size_t>(index) >= node->items.size())
+        {
+            return JsonVariant(detachedNull());
+        }
+        return JsonVariant(node->items[index]);
+    }
+
+    JsonVariant& operator=(bool value)
+    {
+        reset(web_bench_json::Node::Type::Bool).boolean = value;
+        return *this;
+    }
+    JsonVariant& operator=(int value)
+    {
+        return setInteger(value);
+    }
+    JsonVariant& operator=(unsigned int value)
+    {
+        return setInteger(value);
+    }
+    JsonVariant& operator=(long value)
+    {
+        return setInteger(value);
+    }
+    JsonVariant& operator=(unsigned long value)
+    {
+        return setInteger(static_cast<long long>(value));
+    }
+    JsonVariant& operator=(long long value)
+    {
+        return setInteger(value);
+    }
+    JsonVariant& operator=(unsigned long long value)
+    {
+        return setInteger(static_cast<long long>(value));
+    }
+    JsonVariant& operator=(uint8_t value)
+    {
+        return setInteger(value);
+    }
+    JsonVariant& operator=(uint16_t value)
+    {
+        return setInteger(value);
+    }
+    JsonVariant& operator=(float value)
+    {
+        reset(web_bench_json::Node::Type::Real).real = value;
+        return *this;
+    }
+    JsonVariant& operator=(double value)
+    {
+        reset(web_bench_json::Node::Type::Real).real = value;
+        return *this;
+    }
+    JsonVariant& operator=(const char* value)
+    {
+        if (value == nullptr)
+        {
+            reset(web_bench_json::Node::Type::Null);
+            return *this;
+        }
+        WebBenchUntrackedScope untracked;
+        reset(web_bench_json::Node::Type::Text).text = value;
+        return *this;
+    }
+    JsonVariant& operator=(const String& value)
+    {
+        return *this = value.c_str();
+    }
+    JsonVariant& operator=(const SerializedValue& value)
+    {
+        WebBenchUntrackedScope untracked;
+        reset(web_bench_json::Node::Type::Raw).text.assign(value.data, value.size);
+        return *this;
+    }
+    JsonVariant& operator=(const JsonVariant& other)
+    {
+        if (node == nullptr)
+        {
+            node = other.node;
+            return *this;
+        }
+        WebBenchUntrackedScope untracked;
+        *node = *other.node;
+        return *this;
+    }
+
+    bool isNull() const
+    {
+        return node == nullptr || node->type == web_bench_json::Node::Type::Null;
+    }
+    bool containsKey(const char* key) const
+    {
+        if (node == nullptr || node->type != web_bench_json::Node::Type::Object)
+        {
+            return false;
+        }
+        for (const auto& member : node->members)
+        {
+            if (member.first == key)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    size_t size() const
+    {
+        return node->type == web_bench_json::Node::Type::Array ? node->items.size() : node->members.size();
+    }
+
+    template <typename T>
+    T as() const;
+
+    template <typename T>
+    operator T() const  // NOLINT(google-explicit-constructor)
+    {
+        return as<T>();
+    }
+
+    template <typename T>
+    bool is() const;
+
+    template <typename T>
+    T to();
+
+    JsonObject createNestedObject(const char* key) const;
+    JsonArray createNestedArray(const char* key) const;
+    JsonObject createNestedObject() const;
+
+    // Обход элементов массива: for (JsonObject item : array)
+    class Iterator
+    {
+       public:
+        Iterator(const std::vector<std::shared_ptr<web_bench_json::Node>>* items, size_t index)
+            : items(items), index(index)
+        {
+        }
+        JsonVariant operator*() const
+        {
+            return JsonVariant((*items)[index]);
+        }
+        Iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+        bool operator!=(const Iterator& other) const
+        {
+            return index != other.index;
+        }
+
+       private:
+        const std::vector<std::shared_ptr<web_bench_json::Node>>* items;
+        size_t index;
+    };
+    Iterator begin() const
+    {
+        return Iterator(&node->items, 0);
+    }
+    Iterator end() const
+    {
+        return Iterator(&node->items, node->type == web_bench_json::Node::Type::Array ? node->items.size() : 0);
+    }
+
+    template <typename T>
+    bool add(const T& value) const
+    {
+        WebBenchUntrackedScope untracked;
+        if (node->type != web_bench_json::Node::Type::Array)
+        {
+            node->clear();
+            node->type = web_bench_json::Node::Type::Array;
+        }
+        node->items.push_back(std::make_shared<web_bench_json::Node>());
+        JsonVariant item(node->items.back());
+        item = value;
+        return true;
+    }
+
+    const web_bench_json::Node& raw() const
+    {
+        return *node;
+    }
+
+   protected:
+    std::shared_ptr<web_bench_json::Node> node;
+
+   private:
+    static std::shared_ptr<web_bench_json::Node> detachedNull()
+    {
+        WebBenchUntrackedScope untracked;
+        return std::make_shared<web_bench_json::Node>();
+    }
+    web_bench_json::Node& reset(web_bench_json::Node::Type type)
+    {
+        WebBenchUntrackedScope untracked;
+        node->clear();
+        node->type = type;
+        return *node;
+    }
+    JsonVariant& setInteger(long long value)
+    {
+        reset(web_bench_json::Node::Type::Integer).integer = value;
+        return *this;
+    }
+    double number() const
+    {
+        if (node == nullptr)
+        {
+            return 0.0;
+        }
+        switch (node->type)
+        {
+            case web_bench_json::Node::Type::Bool:
+                return node->boolean ? 1.0 : 0.0;
+            case web_bench_json::Node::Type::Integer:
+                return static_cast<double>(node->integer);
+            case web_bench_json::Node::Type::Real:
+                return node->real;
+            case web_bench_json::Node::Type::Text:
+                return std::strtod(node->text.c_str(), nullptr);
+            default:
+                return 0.0;
+        }
+    }
+};
+
+class JsonObject : public JsonVariant
+{
+   public:
+    JsonObject() = default;
+    explicit JsonObject(std::shared_ptr<web_bench_json::Node> target) : JsonVariant(std::move(target)) {}
+    using JsonVariant::operator=;
+};
+
+class JsonArray : public JsonVariant
+{
+   public:
+    JsonArray() = default;
+    explicit JsonArray(std::shared_ptr<web_bench_json::Node> target) : JsonVariant(std::move(target)) {}
+    using JsonVariant::operator=;
+};
+
+inline JsonObject JsonVariant::createNestedObject(const char* key) const
+{
+    JsonVariant member = (*this)[key];
+    member.reset(web_bench_json::Node::Type::Object);
+    return JsonObject(member.node);
+}
+
+inline JsonObject JsonVariant::createNestedObject() const
+{
+    WebBenchUntrackedScope untracked;
+    if (node->type != web_bench_json::Node::Type::Array)
+    {
+        node->clear();
+        node->type = web_bench_json::Node::Type::Array;
+    }
+    node->items.push_back(std::make_shared<web_bench_json::Node>());
+    node->items.back()->type = web_bench_json::Node::Type::Object;
+    return JsonObject(node->items.back());
+}
+
+inline JsonArray JsonVariant::createNestedArray(const char* key) const
+{
+    JsonVariant member = (*this)[key];
+    member.reset(web_bench_json::Node::Type::Array);
+    return JsonArray(member.node);
+}
+
+template <>
+inline JsonObject JsonVariant::to<JsonObject>()
+{
+    reset(web_bench_json::Node::Type::Object);
+    return JsonObject(node);
+}
+
+template <>
+inline JsonArray JsonVariant::to<JsonArray>()
+{
+    reset(web_bench_json::Node::Type::Array);
+    return JsonArray(node);
+}
+
+template <>
+inline bool JsonVariant::as<bool>() const
+{
+    return number() != 0.0;
+}
+template <>
+inline int JsonVariant::as<int>() const
+{
+    return static_cast<int>(number());
+}
+template <>
+inline long JsonVariant::as<long>() const
+{
+    return static_cast<long>(number());
+}
+template <>
+inline unsigned long JsonVariant::as<unsigned long>() const
+{
+    return static_cast<unsigned long>(number());
+}
+template <>
+inline uint8_t JsonVariant::as<uint8_t>() const
+{
+    return static_cast<uint8_t>(number());
+}
+template <>
+inline uint16_t JsonVariant::as<uint16_t>() const
+{
+    return static_cast<uint16_t>(number());
+}
+template <>
+inline float JsonVariant::as<float>() const
+{
+    return static_cast<float>(number());
+}
+template <>
+inline double JsonVariant::as<double>() const
+{
+    return number();
+}
+template <>
+inline const char* JsonVariant::as<const char*>() const
+{
+    return node != nullptr && node->type == web_bench_json::Node::Type::Text ? node->text.c_str() : nullptr;
+}
+template <>
+inline String JsonVariant::as<String>() const
+{
+    const char* text = as<const char*>();
+    return String(text != nullptr ? text : "null");
+}
+template <>
+inline JsonObject JsonVariant::as<JsonObject>() const
+{
+    return JsonObject(node);
+}
+template <>
+inline JsonArray JsonVariant::as<JsonArray>() const
+{
+    return JsonArray(node);
+}
+
+template <>
+inline bool JsonVariant::is<bool>() const
+{
+    return node != nullptr && node->type == web_bench_json::Node::Type::Bool;
+}
+template <>
+inline bool JsonVariant::is<int>() const
+{
+    return node != nullptr && node->type == web_bench_json::Node::Type::Integer;
+}
+template <>
+inline bool JsonVariant::is<float>() const
+{
+    return node != nullptr &&
+           (node->type == web_bench_json::Node::Type::Integer || node->type == web_bench_json::Node::Type::Real);
+}
+template <>
+inline bool JsonVariant::is<const char*>() const
+{
+    return node != nullptr && node->type == web_bench_json::Node::Type::Text;
+}
+template <>
+inline bool JsonVariant::is<JsonObject>() const
+{
+    return node != nullptr && node->type == web_bench_json::Node::Type::Object;
+}
+template <>
+inline bool JsonVariant::is<JsonArray>() const
+{
+    return node != nullptr && node->type == web_bench_json::Node::Type::Array;
+}
+
+// Значение по умолчанию: doc["key"] | fallback
+template <typename T>
+inline T operator|(const JsonVariant& variant, T fallback)
+{
+    return variant.isNull() ? fallback : variant.as<T>();
+}
+inline const char* operator|(const JsonVariant& variant, const char* fallback)
+{
+    const char* text = variant.as<const char*>();
+    return text != nullptr ? text : fallback;
+}
+
+class JsonDocument : public JsonVariant
+{
+   public:
+    JsonDocument() : JsonVariant(makeRoot()) {}
+    JsonDocument(const JsonDocument&) = delete;
+    JsonDocument& operator=(const JsonDocument&) = delete;
+
+    void clear()
+    {
+        WebBenchUntrackedScope untracked;
+        node->clear();
+    }
+    size_t memoryUsage() const
+    {
+        return 0;
+    }
+    bool overflowed() const
+    {
+        return false;
+    }
+    using JsonVariant::operator=;
+
+   private:
+    static std::shared_ptr<web_bench_json::Node> makeRoot()
+    {
+        WebBenchUntrackedScope untracked;
+        return std::make_shared<web_bench_json::Node>();
+    }
+};
+
+template <size_t Capacity>
+class StaticJsonDocument : public JsonDocument
+{
+    // Пул на стеке вызывающего - в куче ничего не выделяется
+};
+
+class DynamicJsonDocument : public JsonDocument
+{
+   public:
+    // Как на ESP32: один блок ёмкости документа в куче на время жизни документа
+    explicit DynamicJsonDocument(size_t capacity) : pool(new char[capacity]), poolCapacity(capacity) {}
+    size_t capacity() const
+    {
+        return poolCapacity;
+    }
+
+   private:
+    std::unique_ptr<char[]> pool;
+    size_t poolCapacity;
+};
+
+class DeserializationError
+{
+   public:
+    enum Code
+    {
+        Ok,
+        EmptyInput,
+        IncompleteInput,
+        InvalidInput,
+        NoMemory,
+        NotSupported,
+        TooDeep
+    };
+
+    DeserializationError(Code value = Ok) : code(value) {}  // NOLINT(google-explicit-constructor)
+    explicit operator bool() const
+    {
+        return code != Ok;
+    }
+    bool operator==(Code other) const
+    {
+        return code == other;
+    }
+    const char* c_str() const
+    {
+        return code == Ok ? "Ok" : "NotSupported";
+    }
+
+   private:
+    Code code;
+};
+
+template <typename Input>
+inline DeserializationError deserializeJson(JsonDocument& doc, const Input& input)
+{
+    (void)input;
+    doc.clear();
+    return DeserializationError::NotSupported;
+}
+
+inline size_t serializeJson(const JsonVariant& source, String& output)
+{
+    std::string text;
+    {
+        WebBenchUntrackedScope untracked;
+        web_bench_json::serialize(source.raw(), text);
+    }
+    output = String(text);  // Итоговая строка - выделение, которое есть и на устройстве
+    return output.length();
+}
+
+inline size_t serializeJson(const JsonVariant& source, char* buffer, size_t size)
+{
+    std::string text;
+    {
+        WebBenchUntrackedScope untracked;
+        web_bench_json::serialize(source.raw(), text);
+    }
+    if (size == 0)
+    {
+        return 0;
+    }
+    const size_t count = std::min(size - 1, text.size());
+    memcpy(buffer, text.data(), count);
+    buffer[count] = '\0';
+    return count;
+}
+
+inline size_t serializeJson(const JsonVariant& source, Print& output)
+{
+    std::string text;
+    WebBenchUntrackedScope untracked;
+    web_bench_json::serialize(source.raw(), text);
+    return output.write(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+}
+
+inline size_t serializeJsonPretty(const JsonVariant& source, String& output)
+{
+    return serializeJson(source, output);
+}
+
+inline size_t measureJson(const JsonVariant& source)
+{
+    std::string text;
+    WebBenchUntrackedScope untracked;
+    web_bench_json::serialize(source.raw(), text);
+    return text.size();
+}
+
+#endif  // WEB_BENCH_ARDUINOJSON_H
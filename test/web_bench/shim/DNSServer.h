@@ -0,0 +1,25 @@
+/**
+ * @file DNSServer.h
+ * @brief Хостовая замена DNSServer для стенда веб-маршрутов
+ */
+
+#ifndef WEB_BENCH_DNS_SERVER_H
+#define WEB_BENCH_DNS_SERVER_H
+
+#include "WiFiClient.h"
+
+class DNSServer
+{
+   public:
+    bool start(uint16_t port, const String& domain, const IPAddress& address)
+    {
+        (void)port;
+        (void)domain;
+        (void)address;
+        return true;
+    }
+    void stop() {}
+    void processNextRequest() {}
+};
+
+#endif  // WEB_BENCH_DNS_SERVER_H
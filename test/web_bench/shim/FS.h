@@ -0,0 +1,98 @@
+/**
+ * @file FS.h
+ * @brief Хостовая замена файловой системы для стенда веб-маршрутов: файлов нет, открытие всегда неуспешно
+ */
+
+#ifndef WEB_BENCH_FS_H
+#define WEB_BENCH_FS_H
+
+#include "Arduino.h"
+
+namespace fs
+{
+class File : public Stream
+{
+   public:
+    explicit operator bool() const
+    {
+        return false;
+    }
+    size_t size() const
+    {
+        return 0;
+    }
+    void close() {}
+    const char* name() const
+    {
+        return "";
+    }
+    bool isDirectory() const
+    {
+        return false;
+    }
+    File openNextFile()
+    {
+        return File();
+    }
+};
+
+class FS
+{
+   public:
+    File open(const char* path, const char* mode = "r")
+    {
+        (void)path;
+        (void)mode;
+        return File();
+    }
+    File open(const String& path, const char* mode = "r")
+    {
+        return open(path.c_str(), mode);
+    }
+    bool exists(const char* path)
+    {
+        (void)path;
+        return false;
+    }
+    bool exists(const String& path)
+    {
+        return exists(path.c_str());
+    }
+    bool remove(const char* path)
+    {
+        (void)path;
+        return false;
+    }
+    bool remove(const String& path)
+    {
+        return remove(path.c_str());
+    }
+    bool rename(const char* pathFrom, const char* pathTo)
+    {
+        (void)pathFrom;
+        (void)pathTo;
+        return false;
+    }
+    bool rename(const String& pathFrom, const String& pathTo)
+    {
+        return rename(pathFrom.c_str(), pathTo.c_str());
+    }
+    bool mkdir(const char* path)
+    {
+        (void)path;
+        return true;
+    }
+    size_t totalBytes() const
+    {
+        return 0;
+    }
+    size_t usedBytes() const
+    {
+        return 0;
+    }
+};
+}  // namespace fs
+
+using fs::File;
+
+#endif  // WEB_BENCH_FS_H
@@ -0,0 +1,23 @@
+/**
+ * @file LittleFS.h
+ * @brief Хостовая замена LittleFS для стенда веб-маршрутов
+ */
+
+#ifndef WEB_BENCH_LITTLEFS_H
+#define WEB_BENCH_LITTLEFS_H
+
+#include "FS.h"
+
+class LittleFSFS : public fs::FS
+{
+   public:
+    bool begin(bool formatOnFail = false)
+    {
+        (void)formatOnFail;
+        return true;
+    }
+};
+
+extern LittleFSFS LittleFS;
+
+#endif  // WEB_BENCH_LITTLEFS_H
@@ -0,0 +1,58 @@
+/**
+ * @file ModbusMaster.h
+ * @brief Хостовая замена ModbusMaster для стенда веб-маршрутов
+ * @details Датчика на стенде нет: любой запрос завершается таймаутом. Показания
+ *          стенд записывает в sensorData сам, до замеров.
+ */
+
+#ifndef WEB_BENCH_MODBUS_MASTER_H
+#define WEB_BENCH_MODBUS_MASTER_H
+
+#include "Arduino.h"
+
+class ModbusMaster
+{
+   public:
+    static const uint8_t ku8MBSuccess = 0x00;
+    static const uint8_t ku8MBIllegalFunction = 0x01;
+    static const uint8_t ku8MBIllegalDataAddress = 0x02;
+    static const uint8_t ku8MBIllegalDataValue = 0x03;
+    static const uint8_t ku8MBSlaveDeviceFailure = 0x04;
+    static const uint8_t ku8MBInvalidSlaveID = 0xE0;
+    static const uint8_t ku8MBInvalidFunction = 0xE1;
+    static const uint8_t ku8MBResponseTimedOut = 0xE2;
+    static const uint8_t ku8MBInvalidCRC = 0xE3;
+
+    void begin(uint8_t slave, Stream& serial)
+    {
+        (void)slave;
+        (void)serial;
+    }
+    void preTransmission(void (*callback)())
+    {
+        (void)callback;
+    }
+    void postTransmission(void (*callback)())
+    {
+        (void)callback;
+    }
+    uint8_t readHoldingRegisters(uint16_t address, uint16_t quantity)
+    {
+        (void)address;
+        (void)quantity;
+        return ku8MBResponseTimedOut;
+    }
+    uint8_t writeSingleRegister(uint16_t address, uint16_t value)
+    {
+        (void)address;
+        (void)value;
+        return ku8MBResponseTimedOut;
+    }
+    uint16_t getResponseBuffer(uint8_t index)
+    {
+        (void)index;
+        return 0;
+    }
+};
+
+#endif  // WEB_BENCH_MODBUS_MASTER_H
@@ -0,0 +1,51 @@
+/**
+ * @file NTPClient.h
+ * @brief Хостовая замена NTPClient для стенда веб-маршрутов
+ * @details Время берётся из часов хоста - сеть стенду не нужна.
+ */
+
+#ifndef WEB_BENCH_NTP_CLIENT_H
+#define WEB_BENCH_NTP_CLIENT_H
+
+#include <ctime>
+#include "Arduino.h"
+#include "WiFiUdp.h"
+
+class NTPClient
+{
+   public:
+    NTPClient(WiFiUDP& udp, const char* server, long offset = 0, unsigned long interval = 60000)
+    {
+        (void)udp;
+        (void)server;
+        (void)interval;
+        timeOffset = offset;
+    }
+
+    void begin() {}
+    bool update()
+    {
+        return true;
+    }
+    bool forceUpdate()
+    {
+        return true;
+    }
+    bool isTimeSet() const
+    {
+        return true;
+    }
+    void setTimeOffset(long offset)
+    {
+        timeOffset = offset;
+    }
+    unsigned long getEpochTime() const
+    {
+        return static_cast<unsigned long>(time(nullptr) + timeOffset);
+    }
+
+   private:
+    long timeOffset = 0;
+};
+
+#endif  // WEB_BENCH_NTP_CLIENT_H
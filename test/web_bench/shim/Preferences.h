@@ -0,0 +1,126 @@
+/**
+ * @file Preferences.h
+ * @brief Хостовая замена NVS Preferences для стенда веб-маршрутов
+ * @details Хранилище пустое: чтение возвращает значение по умолчанию, запись
+ *          игнорируется. Маршруты на замеряемом пути NVS не трогают.
+ */
+
+#ifndef WEB_BENCH_PREFERENCES_H
+#define WEB_BENCH_PREFERENCES_H
+
+#include "Arduino.h"
+
+class Preferences
+{
+   public:
+    bool begin(const char* name, bool readOnly = false)
+    {
+        (void)name;
+        (void)readOnly;
+        return true;
+    }
+    void end() {}
+    bool clear()
+    {
+        return true;
+    }
+    bool remove(const char* key)
+    {
+        (void)key;
+        return true;
+    }
+    bool isKey(const char* key)
+    {
+        (void)key;
+        return false;
+    }
+
+    bool getBool(const char* key, bool fallback = false)
+    {
+        (void)key;
+        return fallback;
+    }
+    float getFloat(const char* key, float fallback = 0.0F)
+    {
+        (void)key;
+        return fallback;
+    }
+    uint8_t getUChar(const char* key, uint8_t fallback = 0)
+    {
+        (void)key;
+        return fallback;
+    }
+    uint16_t getUShort(const char* key, uint16_t fallback = 0)
+    {
+        (void)key;
+        return fallback;
+    }
+    uint32_t getUInt(const char* key, uint32_t fallback = 0)
+    {
+        (void)key;
+        return fallback;
+    }
+    uint32_t getULong(const char* key, uint32_t fallback = 0)
+    {
+        (void)key;
+        return fallback;
+    }
+    String getString(const char* key, const String& fallback = String())
+    {
+        (void)key;
+        return fallback;
+    }
+    size_t getString(const char* key, char* value, size_t maxLength)
+    {
+        (void)key;
+        if (maxLength > 0)
+        {
+            value[0] = '\0';
+        }
+        return 0;
+    }
+
+    template <typename T>
+    size_t put(const char* key, T value)
+    {
+        (void)key;
+        (void)value;
+        return sizeof(T);
+    }
+    size_t putBool(const char* key, bool value)
+    {
+        return put(key, value);
+    }
+    size_t putFloat(const char* key, float value)
+    {
+        return put(key, value);
+    }
+    size_t putUChar(const char* key, uint8_t value)
+    {
+        return put(key, value);
+    }
+    size_t putUShort(const char* key, uint16_t value)
+    {
+        return put(key, value);
+    }
+    size_t putUInt(const char* key, uint32_t value)
+    {
+        return put(key, value);
+    }
+    size_t putULong(const char* key, uint32_t value)
+    {
+        return put(key, value);
+    }
+    size_t putString(const char* key, const String& value)
+    {
+        (void)key;
+        return value.length();
+    }
+    size_t putString(const char* key, const char* value)
+    {
+        (void)key;
+        return strlen(value);
+    }
+};
+
+#endif  // WEB_BENCH_PREFERENCES_H
@@ -0,0 +1,30 @@
+/**
+ * @file PubSubClient.h
+ * @brief Хостовая замена PubSubClient для стенда веб-маршрутов
+ * @details Брокера на стенде нет: клиент всегда отключён.
+ */
+
+#ifndef WEB_BENCH_PUB_SUB_CLIENT_H
+#define WEB_BENCH_PUB_SUB_CLIENT_H
+
+#include "WiFiClient.h"
+
+class PubSubClient
+{
+   public:
+    PubSubClient() = default;
+    explicit PubSubClient(WiFiClient& client)
+    {
+        (void)client;
+    }
+    bool connected()
+    {
+        return false;
+    }
+    int state()
+    {
+        return -1;
+    }
+};
+
+#endif  // WEB_BENCH_PUB_SUB_CLIENT_H
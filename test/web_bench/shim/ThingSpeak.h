@@ -0,0 +1,12 @@
+/**
+ * @file ThingSpeak.h
+ * @brief Хостовая замена библиотеки ThingSpeak для стенда веб-маршрутов
+ * @details Маршрутам нужны только объявления из thingspeak_client.h.
+ */
+
+#ifndef WEB_BENCH_THING_SPEAK_H
+#define WEB_BENCH_THING_SPEAK_H
+
+#include "WiFiClient.h"
+
+#endif  // WEB_BENCH_THING_SPEAK_H
@@ -0,0 +1,307 @@
+/**
+ * @file WebServer.h
+ * @brief In-memory WebServer для стенда веб-маршрутов
+ * @details API совпадает с используемой маршрутами частью arduino-esp32 WebServer:
+ *          маршруты регистрируются как на устройстве (setupDataRoutes() и т.д.), а
+ *          стенд вызывает их через dispatch() и читает код ответа, число байт тела и
+ *          число отправок (send/sendContent) без сокетов.
+ */
+
+#ifndef WEB_BENCH_WEB_SERVER_H
+#define WEB_BENCH_WEB_SERVER_H
+
+#include <functional>
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "FS.h"
+#include "WiFiClient.h"
+#include "web_bench_alloc.h"
+
+enum HTTPMethod
+{
+    HTTP_ANY,
+    HTTP_GET,
+    HTTP_HEAD,
+    HTTP_POST,
+    HTTP_PUT,
+    HTTP_PATCH,
+    HTTP_DELETE,
+    HTTP_OPTIONS
+};
+
+enum HTTPUploadStatus
+{
+    UPLOAD_FILE_START,
+    UPLOAD_FILE_WRITE,
+    UPLOAD_FILE_END,
+    UPLOAD_FILE_ABORTED
+};
+
+struct HTTPUpload
+{
+    HTTPUploadStatus status = UPLOAD_FILE_START;
+    String filename;
+    String name;
+    String type;
+    size_t totalSize = 0;
+    size_t currentSize = 0;
+    uint8_t buf[1436] = {};
+};
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+// Последний ответ, сформированный обработчиком
+struct WebBenchResponse
+{
+    int code = 0;
+    String contentType;
+    size_t bodyBytes = 0;
+    size_t writes = 0;  // send()/sendContent() - на устройстве это отдельные записи в сокет
+    bool chunked = false;
+    String etag;        // Заголовок ETag, если обработчик его выставил
+    String body;        // Заполняется, только если включён захват тела
+};
+
+class WebServer
+{
+   public:
+    using THandlerFunction = std::function<void()>;
+
+    explicit WebServer(int port = 80) : serverPort(port) {}
+
+    void begin() {}
+    void handleClient() {}
+    void enableCORS(bool enable = true)
+    {
+        (void)enable;
+    }
+    void collectHeaders(const char* headerKeys[], size_t headerKeysCount)
+    {
+        (void)headerKeys;
+        (void)headerKeysCount;
+    }
+
+    void on(const String& uri, THandlerFunction handler)
+    {
+        on(uri, HTTP_ANY, std::move(handler));
+    }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler)
+    {
+        routes.push_back({uri, method, std::move(handler)});
+    }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction upload)
+    {
+        (void)upload;
+        on(uri, method, std::move(handler));
+    }
+    void onNotFound(THandlerFunction handler)
+    {
+        notFoundHandler = std::move(handler);
+    }
+
+    // --- запрос ---
+    String uri() const
+    {
+        return requestUri;
+    }
+    HTTPMethod method() const
+    {
+        return requestMethod;
+    }
+    String arg(const String& name) const
+    {
+        for (const auto& item : requestArgs)
+        {
+            if (item.first == name)
+            {
+                return item.second;
+            }
+        }
+        return String();
+    }
+    String arg(int index) const
+    {
+        return index >= 0 && static_cast<size_t>(index) < requestArgs.size() ? requestArgs[index].second : String();
+    }
+    String argName(int index) const
+    {
+        return index >= 0 && static_cast<size_t>(index) < requestArgs.size() ? requestArgs[index].first : String();
+    }
+    int args() const
+    {
+        return static_cast<int>(requestArgs.size());
+    }
+    bool hasArg(const String& name) const
+    {
+        for (const auto& item : requestArgs)
+        {
+            if (item.first == name)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    String header(const String& name) const
+    {
+        for (const auto& item : requestHeaders)
+        {
+            if (item.first.equalsIgnoreCase(name))
+            {
+                return item.second;
+            }
+        }
+        return String();
+    }
+    bool hasHeader(const String& name) const
+    {
+        for (const auto& item : requestHeaders)
+        {
+            if (item.first.equalsIgnoreCase(name))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    WiFiClient client()
+    {
+        return WiFiClient();
+    }
+    HTTPUpload& upload()
+    {
+        return currentUpload;
+    }
+
+    // --- ответ ---
+    void setContentLength(size_t length)
+    {
+        contentLength = length;
+    }
+    void sendHeader(const String& name, const String& value, bool first = false)
+    {
+        (void)first;
+        if (name.equalsIgnoreCase("ETag"))
+        {
+            WebBenchUntrackedScope untracked;
+            response.etag = value;
+        }
+    }
+    void send(int code, const char* contentType = nullptr, const String& content = String())
+    {
+        {
+            WebBenchUntrackedScope untracked;
+            response.code = code;
+            response.contentType = contentType != nullptr ? contentType : "";
+            response.chunked = contentLength == CONTENT_LENGTH_UNKNOWN;
+        }
+        record(content.c_str(), content.length());
+    }
+    void send(int code, const String& contentType, const String& content)
+    {
+        send(code, contentType.c_str(), content);
+    }
+    void send_P(int code, const char* contentType, const char* content, size_t length)
+    {
+        send(code, contentType, String());
+        record(content, length);
+    }
+    void sendContent(const String& content)
+    {
+        record(content.c_str(), content.length());
+    }
+    void sendContent(const char* content, size_t length)
+    {
+        record(content, length);
+    }
+    template <typename T>
+    size_t streamFile(T& file, const String& contentType)
+    {
+        (void)file;
+        send(200, contentType.c_str(), String());
+        return 0;
+    }
+
+    // --- стенд ---
+    void setCaptureBody(bool enabled)
+    {
+        captureBody = enabled;
+    }
+    bool dispatch(HTTPMethod method, const String& uri,
+                  std::vector<std::pair<String, String>> args = {},
+                  std::vector<std::pair<String, String>> headers = {})
+    {
+        {
+            // Разбор запроса - работа WebServer, а не обработчика: в замер не входит
+            WebBenchUntrackedScope untracked;
+            requestMethod = method;
+            requestUri = uri;
+            requestArgs = std::move(args);
+            requestHeaders = std::move(headers);
+            response = WebBenchResponse();
+            contentLength = CONTENT_LENGTH_NOT_SET;
+        }
+
+        for (const auto& route : routes)
+        {
+            if (route.uri == uri && (route.method == HTTP_ANY || route.method == method))
+            {
+                route.handler();
+                return true;
+            }
+        }
+        if (notFoundHandler)
+        {
+            notFoundHandler();
+        }
+        return false;
+    }
+    const WebBenchResponse& lastResponse() const
+    {
+        return response;
+    }
+    size_t routeCount() const
+    {
+        return routes.size();
+    }
+
+   private:
+    struct Route
+    {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+    };
+
+    void record(const char* content, size_t length)
+    {
+        // Пустой sendContent("") в chunked-режиме - завершающий чанк, а не данные
+        if (length == 0)
+        {
+            return;
+        }
+        response.bodyBytes += length;
+        ++response.writes;
+        if (captureBody)
+        {
+            WebBenchUntrackedScope untracked;
+            response.body += String(std::string(content, length));
+        }
+    }
+
+    int serverPort;
+    std::vector<Route> routes;
+    THandlerFunction notFoundHandler;
+    HTTPMethod requestMethod = HTTP_GET;
+    String requestUri;
+    std::vector<std::pair<String, String>> requestArgs;
+    std::vector<std::pair<String, String>> requestHeaders;
+    HTTPUpload currentUpload;
+    WebBenchResponse response;
+    size_t contentLength = CONTENT_LENGTH_NOT_SET;
+    bool captureBody = false;
+};
+
+#endif  // WEB_BENCH_WEB_SERVER_H
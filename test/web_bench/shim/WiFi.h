@@ -0,0 +1,127 @@
+/**
+ * @file WiFi.h
+ * @brief Хостовая замена WiFi для стенда веб-маршрутов
+ * @details Станция "подключена" с фиксированными адресами, чтобы страницы и
+ *          JSON-ответы формировались целиком, как на работающем устройстве.
+ */
+
+#ifndef WEB_BENCH_WIFI_H
+#define WEB_BENCH_WIFI_H
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+#include "WiFiUdp.h"
+
+enum wl_status_t
+{
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+};
+
+enum wifi_mode_t
+{
+    WIFI_OFF,
+    WIFI_STA,
+    WIFI_AP,
+    WIFI_AP_STA
+};
+
+class WiFiClass
+{
+   public:
+    static wl_status_t status()
+    {
+        return WL_CONNECTED;
+    }
+    String SSID() const
+    {
+        return "web-bench";
+    }
+    int8_t RSSI() const
+    {
+        return -55;
+    }
+    IPAddress localIP() const
+    {
+        return IPAddress(192, 168, 1, 50);
+    }
+    IPAddress softAPIP() const
+    {
+        return IPAddress(192, 168, 4, 1);
+    }
+    IPAddress gatewayIP() const
+    {
+        return IPAddress(192, 168, 1, 1);
+    }
+    IPAddress subnetMask() const
+    {
+        return IPAddress(255, 255, 255, 0);
+    }
+    IPAddress dnsIP() const
+    {
+        return IPAddress(192, 168, 1, 1);
+    }
+    String macAddress() const
+    {
+        return "24:0A:C4:00:00:01";
+    }
+    uint8_t* macAddress(uint8_t* mac) const
+    {
+        const uint8_t value[6] = {0x24, 0x0A, 0xC4, 0x00, 0x00, 0x01};
+        memcpy(mac, value, sizeof(value));
+        return mac;
+    }
+    int hostByName(const char* host, IPAddress& result)
+    {
+        (void)host;
+        result = IPAddress(127, 0, 0, 1);
+        return 1;
+    }
+    bool mode(wifi_mode_t value)
+    {
+        (void)value;
+        return true;
+    }
+    wifi_mode_t getMode() const
+    {
+        return WIFI_STA;
+    }
+    void begin(const char* ssid, const char* password = nullptr)
+    {
+        (void)ssid;
+        (void)password;
+    }
+    bool disconnect(bool wifiOff = false)
+    {
+        (void)wifiOff;
+        return true;
+    }
+    bool softAP(const char* ssid, const char* password = nullptr)
+    {
+        (void)ssid;
+        (void)password;
+        return true;
+    }
+    uint8_t softAPgetStationNum() const
+    {
+        return 0;
+    }
+    bool softAPdisconnect(bool wifiOff = false)
+    {
+        (void)wifiOff;
+        return true;
+    }
+    bool setHostname(const char* name)
+    {
+        (void)name;
+        return true;
+    }
+};
+
+extern WiFiClass WiFi;
+
+#endif  // WEB_BENCH_WIFI_H
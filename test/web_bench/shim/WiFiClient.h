@@ -0,0 +1,68 @@
+/**
+ * @file WiFiClient.h
+ * @brief Хостовая замена WiFiClient/IPAddress для стенда веб-маршрутов
+ */
+
+#ifndef WEB_BENCH_WIFI_CLIENT_H
+#define WEB_BENCH_WIFI_CLIENT_H
+
+#include "Arduino.h"
+
+class IPAddress
+{
+   public:
+    IPAddress() = default;
+    IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth) : octets{first, second, third, fourth} {}
+    String toString() const
+    {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+        return String(buffer);
+    }
+    operator uint32_t() const  // NOLINT(google-explicit-constructor)
+    {
+        return static_cast<uint32_t>(octets[0]) | (static_cast<uint32_t>(octets[1]) << 8) |
+               (static_cast<uint32_t>(octets[2]) << 16) | (static_cast<uint32_t>(octets[3]) << 24);
+    }
+
+   private:
+    uint8_t octets[4] = {0, 0, 0, 0};
+};
+
+// Клиент стенда: запись уходит в никуда, соединение считается закрытым (SSE-потоков нет)
+class WiFiClient : public Stream
+{
+   public:
+    virtual ~WiFiClient() = default;
+    virtual int connect(const char* host, uint16_t port)
+    {
+        (void)host;
+        (void)port;
+        return 0;
+    }
+    virtual int connect(const char* host, uint16_t port, int32_t timeout)
+    {
+        (void)timeout;
+        return connect(host, port);
+    }
+    // Виртуальные, как в Client ядра: модели транспорта в тестах переопределяют их
+    virtual uint8_t connected()
+    {
+        return 0;
+    }
+    virtual void stop() {}
+    void setNoDelay(bool enabled)
+    {
+        (void)enabled;
+    }
+    IPAddress remoteIP() const
+    {
+        return IPAddress(127, 0, 0, 1);
+    }
+    explicit operator bool()
+    {
+        return false;
+    }
+};
+
+#endif  // WEB_BENCH_WIFI_CLIENT_H
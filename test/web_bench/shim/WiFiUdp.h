@@ -0,0 +1,13 @@
+/**
+ * @file WiFiUdp.h
+ * @brief Хостовая замена WiFiUDP для стенда веб-маршрутов
+ */
+
+#ifndef WEB_BENCH_WIFI_UDP_H
+#define WEB_BENCH_WIFI_UDP_H
+
+class WiFiUDP
+{
+};
+
+#endif  // WEB_BENCH_WIFI_UDP_H
@@ -0,0 +1,43 @@
+/**
+ * @file web_bench_alloc.h
+ * @brief Исключение служебных выделений шима из счётчика аллокаций стенда
+ * @details Узлы JSON-документа шима живут в куче хоста, а на устройстве ArduinoJson
+ *          размещает их в пуле документа (StaticJsonDocument - на стеке). Такие
+ *          выделения оборачиваются в WebBenchUntrackedScope, чтобы отчёт показывал
+ *          только выделения, которые реально случаются на ESP32.
+ */
+
+#ifndef WEB_BENCH_ALLOC_H
+#define WEB_BENCH_ALLOC_H
+
+#include <cstddef>
+
+// Счётчики кучи с момента последнего webBenchResetAllocStats()
+struct WebBenchAllocStats
+{
+    size_t allocations;
+    size_t allocatedBytes;
+    size_t peakLiveBytes;  // Максимум одновременно живых байт сверх уровня на момент сброса
+};
+
+extern thread_local int webBenchUntrackedDepth;
+
+void webBenchResetAllocStats();
+WebBenchAllocStats webBenchGetAllocStats();
+size_t webBenchLiveBytes();
+
+struct WebBenchUntrackedScope
+{
+    WebBenchUntrackedScope()
+    {
+        ++webBenchUntrackedDepth;
+    }
+    ~WebBenchUntrackedScope()
+    {
+        --webBenchUntrackedDepth;
+    }
+    WebBenchUntrackedScope(const WebBenchUntrackedScope&) = delete;
+    WebBenchUntrackedScope& operator=(const WebBenchUntrackedScope&) = delete;
+};
+
+#endif  // WEB_BENCH_ALLOC_H
@@ -0,0 +1,133 @@
+/**
+ * @file web_bench_alloc.cpp
+ * @brief Счётчик выделений кучи для стенда веб-маршрутов
+ * @details Глобальные operator new/delete хранят размер блока в заголовке, чтобы
+ *          delete мог вычесть его из числа живых байт. Блоки, выделенные внутри
+ *          WebBenchUntrackedScope, помечаются и не попадают в статистику даже при
+ *          освобождении вне области.
+ */
+
+#include <cstdlib>
+#include <new>
+#include "shim/web_bench_alloc.h"
+
+thread_local int webBenchUntrackedDepth = 0;  // NOLINT(misc-use-internal-linkage)
+
+namespace
+{
+struct alignas(alignof(std::max_align_t)) BlockHeader
+{
+    size_t size;
+    bool tracked;
+};
+
+WebBenchAllocStats stats{};
+size_t liveBytes = 0;
+size_t baselineLiveBytes = 0;
+
+void* allocate(size_t size)
+{
+    auto* header = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + size));
+    if (header == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    header->size = size;
+    header->tracked = webBenchUntrackedDepth == 0;
+    if (header->tracked)
+    {
+        ++stats.allocations;
+        stats.allocatedBytes += size;
+        liveBytes += size;
+        if (liveBytes > baselineLiveBytes && liveBytes - baselineLiveBytes > stats.peakLiveBytes)
+        {
+            stats.peakLiveBytes = liveBytes - baselineLiveBytes;
+        }
+    }
+    return header + 1;
+}
+
+void release(void* pointer)
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+    BlockHeader* header = static_cast<BlockHeader*>(pointer) - 1;
+    if (header->tracked)
+    {
+        liveBytes -= header->size;
+    }
+    std::free(header);
+}
+}  // namespace
+
+void webBenchResetAllocStats()
+{
+    stats = WebBenchAllocStats{};
+    baselineLiveBytes = liveBytes;
+}
+
+WebBenchAllocStats webBenchGetAllocStats()
+{
+    return stats;
+}
+
+size_t webBenchLiveBytes()
+{
+    return liveBytes;
+}
+
+void* operator new(size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t& /*tag*/) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t& /*tag*/) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* pointer) noexcept
+{
+    release(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    release(pointer);
+}
+
+void operator delete(void* pointer, size_t /*size*/) noexcept
+{
+    release(pointer);
+}
+
+void operator delete[](void* pointer, size_t /*size*/) noexcept
+{
+    release(pointer);
+}
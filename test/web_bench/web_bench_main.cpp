@@ -0,0 +1,403 @@
+/**
+ * @file web_bench_main.cpp
+ * @brief Хостовый стенд веб-маршрутов: задержка, объём ответа и выделения кучи
+ * @details Настоящие обработчики (sendSensorJson, sendHealthJson, оболочка панели /readings,
+ *          /api/v1/bootstrap) регистрируются через setupDataRoutes()/setupServiceRoutes()/
+ *          setupAppRoutes() в in-memory WebServer из test/web_bench/shim и вызываются N раз подряд.
+ *          Сценарии /api/v2/sensor передают ?fields= и ?text=0 как аргументы запроса.
+ *          Для каждого маршрута печатается медиана/p99 времени обработчика, байт тела,
+ *          число записей в сокет, выделений и байт кучи на запрос и пик живой памяти.
+ *
+ *          Сборка: pio run -e web_bench (программа .pio/build/web_bench/program) или
+ *          g++ напрямую - см. test/test_web_bench.py. Аргументы:
+ *            --iterations N  запросов на маршрут (по умолчанию 200)
+ *            --route PATH    замерять только маршруты с этим путём (можно несколько)
+ *            --json          отчёт в JSON
+ *            --rank-csv PATH ранжировать культуры по историческим показаниям из CSV
+ *                            (rankCropsBatch) вместо замера маршрутов
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "../../include/jxct_config_vars.h"
+#include "../../include/jxct_constants.h"
+#include "../../include/jxct_strings.h"
+#include "../../include/sensor_processing.h"
+#include "../../include/web_routes.h"
+#include "../../src/business/crop_ranking.h"
+#include "../../src/modbus_sensor.h"
+#include "../../src/wifi_manager.h"
+#include "shim/web_bench_alloc.h"
+
+extern WebServer webServer;
+
+namespace
+{
+constexpr int DEFAULT_ITERATIONS = 200;
+constexpr int WARMUP_ITERATIONS = 3;
+
+struct BenchScenario
+{
+    const char* name;
+    HTTPMethod method;
+    const char* uri;                // Может содержать строку запроса: "/path?a=1&b=2"
+    std::function<void()> prepare;  // Вызывается перед каждым запросом вне замера
+    bool revalidate;                // Слать If-None-Match с ETag предыдущего ответа (ожидается 304)
+};
+
+struct RouteReport
+{
+    const char* name;
+    const char* uri;
+    int iterations;
+    int statusCode;
+    double medianUs;
+    double p99Us;
+    double maxUs;
+    size_t bodyBytes;
+    size_t writes;
+    double allocationsPerRequest;
+    double allocatedBytesPerRequest;
+    size_t peakLiveBytes;
+};
+
+// Показание, как у тестового датчика (fake_sensor.cpp), прогнанное через общую обработку
+void fillSensorReading()
+{
+    sensorData.temperature = 22.4F;
+    sensorData.humidity = 31.5F;
+    sensorData.ec = 1180.0F;
+    sensorData.ph = 6.4F;
+    sensorData.nitrogen = 145.0F;
+    sensorData.phosphorus = 62.0F;
+    sensorData.potassium = 230.0F;
+
+    sensorData.raw_temperature = sensorData.temperature;
+    sensorData.raw_humidity = sensorData.humidity;
+    sensorData.raw_ec = sensorData.ec;
+    sensorData.raw_ph = sensorData.ph;
+    sensorData.raw_nitrogen = sensorData.nitrogen;
+    sensorData.raw_phosphorus = sensorData.phosphorus;
+    sensorData.raw_potassium = sensorData.potassium;
+
+    sensorData.valid = true;
+    sensorData.isValid = true;
+    sensorData.last_update = millis();
+
+    SensorProcessing::processSensorData(sensorData, config);
+    markSensorDataUpdated();
+}
+
+void configureDevice()
+{
+    strlcpy(config.ssid, "web-bench", sizeof(config.ssid));
+    strlcpy(config.cropId, "tomato", sizeof(config.cropId));
+    config.soilProfile = 1;  // Суглинок
+    config.environmentType = 0;
+    config.flags.compensationEnabled = 1;
+    config.flags.seasonalAdjustEnabled = 1;
+    config.webUpdateInterval = 5;
+
+    wifiConnected = true;
+    currentWiFiMode = WiFiMode::STA;
+}
+
+double percentile(std::vector<double> samples, double percent)
+{
+    if (samples.empty())
+    {
+        return 0.0;
+    }
+    std::sort(samples.begin(), samples.end());
+    const auto rank = static_cast<size_t>(std::max(1.0, std::ceil(percent / 100.0 * samples.size())));
+    return samples[std::min(rank, samples.size()) - 1];
+}
+
+// Путь без строки запроса
+String uriPath(const char* uri)
+{
+    const char* query = strchr(uri, '?');
+    return query != nullptr ? String(uri, static_cast<size_t>(query - uri)) : String(uri);
+}
+
+// "a=1&b=2" -> [(a, 1), (b, 2)], как аргументы, разобранные WebServer
+std::vector<std::pair<String, String>> uriArgs(const char* uri)
+{
+    std::vector<std::pair<String, String>> args;
+    const char* cursor = strchr(uri, '?');
+    while (cursor != nullptr && *cursor != '\0')
+    {
+        ++cursor;
+        const char* end = strchr(cursor, '&');
+        const std::string pair = end != nullptr ? std::string(cursor, end) : std::string(cursor);
+        const size_t equals = pair.find('=');
+        args.emplace_back(String(pair.substr(0, equals).c_str()),
+                          String(equals != std::string::npos ? pair.substr(equals + 1).c_str() : ""));
+        cursor = end;
+    }
+    return args;
+}
+
+RouteReport runScenario(const BenchScenario& scenario, int iterations)
+{
+    const String uri = uriPath(scenario.uri);
+    const std::vector<std::pair<String, String>> args = uriArgs(scenario.uri);
+
+    for (int warmup = 0; warmup < WARMUP_ITERATIONS; ++warmup)
+    {
+        if (scenario.prepare)
+        {
+            scenario.prepare();
+        }
+        webServer.dispatch(scenario.method, uri, args);
+    }
+
+    std::vector<double> latenciesUs;
+    String etag;
+    {
+        WebBenchUntrackedScope untracked;
+        latenciesUs.reserve(static_cast<size_t>(iterations));
+        etag = webServer.lastResponse().etag;
+    }
+
+    size_t totalAllocations = 0;
+    size_t totalAllocatedBytes = 0;
+    size_t peakLiveBytes = 0;
+
+    for (int iteration = 0; iteration < iterations; ++iteration)
+    {
+        if (scenario.prepare)
+        {
+            scenario.prepare();
+        }
+        std::vector<std::pair<String, String>> requestArgs;
+        std::vector<std::pair<String, String>> headers;
+        {
+            WebBenchUntrackedScope untracked;
+            requestArgs = args;
+            if (scenario.revalidate)
+            {
+                headers.emplace_back("If-None-Match", etag);
+            }
+        }
+
+        webBenchResetAllocStats();
+        const auto started = std::chrono::steady_clock::now();
+        webServer.dispatch(scenario.method, uri, std::move(requestArgs), std::move(headers));
+        const auto finished = std::chrono::steady_clock::now();
+        const WebBenchAllocStats stats = webBenchGetAllocStats();
+
+        latenciesUs.push_back(std::chrono::duration<double, std::micro>(finished - started).count());
+        totalAllocations += stats.allocations;
+        totalAllocatedBytes += stats.allocatedBytes;
+        peakLiveBytes = std::max(peakLiveBytes, stats.peakLiveBytes);
+    }
+
+    const WebBenchResponse& response = webServer.lastResponse();
+    RouteReport report{};
+    report.name = scenario.name;
+    report.uri = scenario.uri;
+    report.iterations = iterations;
+    report.statusCode = response.code;
+    report.medianUs = percentile(latenciesUs, 50.0);
+    report.p99Us = percentile(latenciesUs, 99.0);
+    report.maxUs = *std::max_element(latenciesUs.begin(), latenciesUs.end());
+    report.bodyBytes = response.bodyBytes;
+    report.writes = response.writes;
+    report.allocationsPerRequest = static_cast<double>(totalAllocations) / iterations;
+    report.allocatedBytesPerRequest = static_cast<double>(totalAllocatedBytes) / iterations;
+    report.peakLiveBytes = peakLiveBytes;
+    return report;
+}
+
+// printf считает байты, а не символы: кириллица в UTF-8 сбивает ширину колонок
+void printCell(const char* text, int width)
+{
+    int symbols = 0;
+    for (const char* cursor = text; *cursor != '\0'; ++cursor)
+    {
+        if ((static_cast<unsigned char>(*cursor) & 0xC0) != 0x80)
+        {
+            ++symbols;
+        }
+    }
+    printf("%s%*s", text, std::max(0, width - symbols), "");
+}
+
+void printTable(const std::vector<RouteReport>& reports)
+{
+    printf("🌐 Стенд веб-маршрутов: %d запросов на маршрут\n", reports.empty() ? 0 : reports.front().iterations);
+    const char* headers[] = {"код", "p50,мкс", "p99,мкс", "байт", "записей", "выдел/з", "байт/з", "пик,байт"};
+    printCell("маршрут", 26);
+    for (const char* header : headers)
+    {
+        printf(" ");
+        printCell(header, 9);
+    }
+    printf("\n");
+    for (const auto& report : reports)
+    {
+        printCell(report.name, 26);
+        printf(" %-9d %-9.1f %-9.1f %-9zu %-9zu %-9.1f %-9.0f %-9zu\n", report.statusCode, report.medianUs,
+               report.p99Us, report.bodyBytes, report.writes, report.allocationsPerRequest,
+               report.allocatedBytesPerRequest, report.peakLiveBytes);
+    }
+}
+
+// Исторические показания "t,asm,ec,ph,n,p,k" по строке (влажность - ASM, как у целей культур);
+// строки с '#' и неполные пропускаются. Печатает лучшую культуру для каждого показания
+int rankHistoryCsv(const char* path)
+{
+    FILE* file = fopen(path, "r");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "%s: не удалось открыть\n", path);
+        return 2;
+    }
+    std::vector<CropReading> readings;
+    std::array<char, 256> line{};
+    while (fgets(line.data(), line.size(), file) != nullptr)
+    {
+        CropReading reading;
+        if (line[0] != '#' && sscanf(line.data(), "%f,%f,%f,%f,%f,%f,%f", &reading.temperature, &reading.humidity,
+                                     &reading.ec, &reading.ph, &reading.nitrogen, &reading.phosphorus,
+                                     &reading.potassium) == static_cast<int>(CROP_CHANNEL_COUNT))
+        {
+            readings.push_back(reading);
+        }
+    }
+    fclose(file);
+
+    // Сезон исторических показаний неизвестен - цели без сезонной поправки
+    const CropTargets& targets = getCropTargets(Season::SPRING, false);
+    std::vector<CropRanking> rankings(readings.size());
+    const auto started = std::chrono::steady_clock::now();
+    rankCropsBatch(targets, readings.data(), readings.size(), rankings.data());
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - started;
+
+    printf("row,crop,score\n");
+    for (size_t index = 0; index < rankings.size(); ++index)
+    {
+        const CropFit& best = rankings[index].front();
+        printf("%zu,%s,%.1f\n", index, CROP_TABLE[static_cast<size_t>(best.crop)].name, best.score);
+    }
+    fprintf(stderr, "🌱 %zu показаний ранжировано за %.0f мкс\n", readings.size(), elapsed.count());
+    return readings.empty() ? 1 : 0;
+}
+
+void printJson(const std::vector<RouteReport>& reports)
+{
+    printf("{\"routes\":[");
+    for (size_t index = 0; index < reports.size(); ++index)
+    {
+        const RouteReport& report = reports[index];
+        printf("%s{\"name\":\"%s\",\"uri\":\"%s\",\"iterations\":%d,\"status\":%d,"
+               "\"latency_us\":{\"p50\":%.2f,\"p99\":%.2f,\"max\":%.2f},"
+               "\"body_bytes\":%zu,\"writes\":%zu,"
+               "\"heap\":{\"allocations_per_request\":%.2f,\"bytes_per_request\":%.1f,\"peak_bytes\":%zu}}",
+               index > 0 ? "," : "", report.name, report.uri, report.iterations, report.statusCode, report.medianUs,
+               report.p99Us, report.maxUs, report.bodyBytes, report.writes, report.allocationsPerRequest,
+               report.allocatedBytesPerRequest, report.peakLiveBytes);
+    }
+    printf("]}\n");
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    int iterations = DEFAULT_ITERATIONS;
+    bool jsonOutput = false;
+    const char* rankCsvPath = nullptr;
+    std::vector<String> routeFilter;
+
+    for (int index = 1; index < argc; ++index)
+    {
+        const String argument(argv[index]);
+        if (argument == "--iterations" && index + 1 < argc)
+        {
+            iterations = std::max(1, atoi(argv[++index]));
+        }
+        else if (argument == "--route" && index + 1 < argc)
+        {
+            routeFilter.emplace_back(argv[++index]);
+        }
+        else if (argument == "--json")
+        {
+            jsonOutput = true;
+        }
+        else if (argument == "--rank-csv" && index + 1 < argc)
+        {
+            rankCsvPath = argv[++index];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--iterations N] [--route PATH]... [--json] [--rank-csv PATH]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    configureDevice();
+    if (rankCsvPath != nullptr)
+    {
+        return rankHistoryCsv(rankCsvPath);
+    }
+    fillSensorReading();
+    setupDataRoutes();
+    setupServiceRoutes();
+    setupAppRoutes();
+
+    const std::vector<BenchScenario> scenarios = {
+        {"/sensor_json (кэш)", HTTP_GET, "/sensor_json", nullptr, false},
+        {"/sensor_json (новое)", HTTP_GET, "/sensor_json", markSensorDataUpdated, false},
+        {"/sensor_json (304)", HTTP_GET, "/sensor_json", nullptr, true},
+        {API_SENSOR, HTTP_GET, API_SENSOR, nullptr, false},
+        {"/api/v2/sensor (все)", HTTP_GET, API_V2_SENSOR, markSensorDataUpdated, false},
+        {"/api/v2/sensor (raw)", HTTP_GET, API_V2_SENSOR "?fields=raw", markSensorDataUpdated, false},
+        {"/api/v2/sensor (text=0)", HTTP_GET, API_V2_SENSOR "?text=0", markSensorDataUpdated, false},
+        {"/api/v2/sensor (304)", HTTP_GET, API_V2_SENSOR "?fields=values,status", nullptr, true},
+        {"/api/v2/sensor (codes)", HTTP_GET, API_V2_SENSOR "?fields=values,codes", markSensorDataUpdated, false},
+        {API_V2_CROPS_RANK, HTTP_GET, API_V2_CROPS_RANK, markSensorDataUpdated, false},
+        {"/api/v2/crops/rank (5)", HTTP_GET, API_V2_CROPS_RANK "?limit=5", markSensorDataUpdated, false},
+        {API_V2_SOILS_ASM, HTTP_GET, API_V2_SOILS_ASM, markSensorDataUpdated, false},
+        {"/api/v2/soils/asm (кэш)", HTTP_GET, API_V2_SOILS_ASM, nullptr, false},
+        {API_V2_ADVICE, HTTP_GET, API_V2_ADVICE, nullptr, false},
+        {API_SYSTEM_HEALTH, HTTP_GET, API_SYSTEM_HEALTH, nullptr, false},
+        {"/service_status", HTTP_GET, "/service_status", nullptr, false},
+        {"/service_status (304)", HTTP_GET, "/service_status", nullptr, true},
+        {"/readings", HTTP_GET, "/readings", nullptr, false},
+        {"/readings (304)", HTTP_GET, "/readings", nullptr, true},
+        {API_BOOTSTRAP, HTTP_GET, API_BOOTSTRAP, markSensorDataUpdated, false},
+    };
+
+    std::vector<RouteReport> reports;
+    for (const auto& scenario : scenarios)
+    {
+        const bool selected = routeFilter.empty() || std::any_of(routeFilter.begin(), routeFilter.end(),
+                                                                  [&](const String& path) { return path == uriPath(scenario.uri); });
+        if (selected)
+        {
+            reports.push_back(runScenario(scenario, iterations));
+        }
+    }
+
+    if (jsonOutput)
+    {
+        printJson(reports);
+    }
+    else
+    {
+        printTable(reports);
+    }
+
+    const bool allOk = std::all_of(reports.begin(), reports.end(),
+                                   [](const RouteReport& report)
+                                   { return report.statusCode == HTTP_OK || report.statusCode == HTTP_NOT_MODIFIED; });
+    return reports.empty() || !allOk ? 1 : 0;
+}
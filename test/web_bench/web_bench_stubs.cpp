@@ -0,0 +1,188 @@
+/**
+ * @file web_bench_stubs.cpp
+ * @brief Определения, которых нет в исходниках, собираемых для стенда
+ * @details Ядро Arduino (Serial, ESP, время), глобальные объекты из main.cpp и
+ *          config.cpp, а также модули вне замеряемого пути: MQTT, ThingSpeak,
+ *          uplink-приёмники и маршруты, которые стенд не вызывает.
+ */
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <NTPClient.h>
+#include <WiFi.h>
+#include <array>
+#include <chrono>
+#include <cstdarg>
+#include "../../include/jxct_config_vars.h"
+#include "../../include/web_routes.h"
+#include "../../src/mqtt_client.h"
+#include "../../src/thingspeak_client.h"
+#include "../../src/uplink_sink.h"
+#include "shim/web_bench_alloc.h"
+
+namespace
+{
+constexpr uint32_t WEB_BENCH_HEAP_SIZE = 327680;  // Куча ESP32 после старта Wi-Fi стека
+
+const auto benchStart = std::chrono::steady_clock::now();
+}  // namespace
+
+// ============================================================================
+// Ядро Arduino
+// ============================================================================
+
+HardwareSerial Serial;   // NOLINT(misc-use-internal-linkage)
+HardwareSerial Serial2;  // NOLINT(misc-use-internal-linkage)
+EspClass ESP;            // NOLINT(misc-use-internal-linkage)
+WiFiClass WiFi;          // NOLINT(misc-use-internal-linkage)
+LittleFSFS LittleFS;     // NOLINT(misc-use-internal-linkage)
+
+size_t Print::printf(const char* format, ...)
+{
+    std::array<char, 256> buffer{};
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(buffer.data(), buffer.size(), format, args);
+    va_end(args);
+    return length > 0 ? write(reinterpret_cast<const uint8_t*>(buffer.data()), strlen(buffer.data())) : 0;
+}
+
+// Свободная память считается по живым выделениям стенда
+uint32_t EspClass::getFreeHeap() const
+{
+    const size_t live = webBenchLiveBytes();
+    return live < WEB_BENCH_HEAP_SIZE ? static_cast<uint32_t>(WEB_BENCH_HEAP_SIZE - live) : 0;
+}
+
+uint32_t EspClass::getMinFreeHeap() const
+{
+    return getFreeHeap();
+}
+
+uint32_t EspClass::getMaxAllocHeap() const
+{
+    return getFreeHeap();
+}
+
+uint32_t EspClass::getHeapSize() const
+{
+    return WEB_BENCH_HEAP_SIZE;
+}
+
+unsigned long millis()
+{
+    return static_cast<unsigned long>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - benchStart).count());
+}
+
+unsigned long micros()
+{
+    return static_cast<unsigned long>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - benchStart).count());
+}
+
+// Задержки не ждут: стенд меряет работу обработчика, а не паузы
+void delay(unsigned long ms)
+{
+    (void)ms;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    (void)us;
+}
+
+void yield() {}
+
+long random(long max)
+{
+    return max > 0 ? std::rand() % max : 0;
+}
+
+long random(long min, long max)
+{
+    return max > min ? min + (std::rand() % (max - min)) : min;
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    (void)pin;
+    (void)value;
+}
+
+int digitalRead(uint8_t pin)
+{
+    (void)pin;
+    return LOW;
+}
+
+// ============================================================================
+// main.cpp / config.cpp
+// ============================================================================
+
+Config config;                    // NOLINT(misc-use-internal-linkage)
+Preferences preferences;          // NOLINT(misc-use-internal-linkage)
+WiFiUDP ntpUDP;                   // NOLINT(misc-use-internal-linkage)
+// Время уже синхронизировано, как после первого подключения STA (handleWiFi())
+NTPClient benchTimeClient(ntpUDP, "pool.ntp.org");
+NTPClient* timeClient = &benchTimeClient;  // NOLINT(misc-use-internal-linkage)
+
+// Конфигурацию задаёт стенд перед замерами, NVS не используется
+void loadConfig() {}
+void saveConfig() {}
+void resetConfig()
+{
+    config = Config{};
+}
+
+// ============================================================================
+// Выгрузки: на стенде отключены
+// ============================================================================
+
+WiFiClient espClient;                // NOLINT(misc-use-internal-linkage)
+PubSubClient mqttClient(espClient);  // NOLINT(misc-use-internal-linkage)
+bool mqttConnected = false;          // NOLINT(misc-use-internal-linkage)
+
+const char* getMqttLastError()
+{
+    return "";
+}
+
+const char* getThingSpeakLastPublish()
+{
+    return "0";
+}
+
+const char* getThingSpeakLastError()
+{
+    return "";
+}
+
+void resetThingSpeakBlock() {}
+void diagnoseThingSpeakStatus() {}
+
+String getThingSpeakDiagnosticsJson()
+{
+    return "{}";
+}
+
+String getUplinkSinksStatusJson()
+{
+    return "[]";
+}
+
+// ============================================================================
+// Маршруты, которые стенд не регистрирует
+// ============================================================================
+
+void setupMainRoutes() {}
+void setupConfigRoutes() {}
+void setupErrorHandlers() {}
+void setupOtaRoutes() {}
+void setupReportsRoutes() {}